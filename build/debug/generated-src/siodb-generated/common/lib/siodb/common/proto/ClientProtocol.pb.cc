@@ -0,0 +1,2035 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ClientProtocol.proto
+
+#include "ClientProtocol.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace siodb {
+namespace client_protocol {
+PROTOBUF_CONSTEXPR Command::Command(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parameter_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.statement_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.prepare_)*/false
+  , /*decltype(_impl_.close_statement_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommandDefaultTypeInternal() {}
+  union {
+    Command _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommandDefaultTypeInternal _Command_default_instance_;
+PROTOBUF_CONSTEXPR ServerResponse::ServerResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{}
+  , /*decltype(_impl_.column_description_)*/{}
+  , /*decltype(_impl_.freetext_message_)*/{}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.response_id_)*/0u
+  , /*decltype(_impl_.response_count_)*/0u
+  , /*decltype(_impl_.affected_row_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.has_affected_row_count_)*/false
+  , /*decltype(_impl_.parameter_count_)*/0u
+  , /*decltype(_impl_.statement_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerResponseDefaultTypeInternal() {}
+  union {
+    ServerResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerResponseDefaultTypeInternal _ServerResponse_default_instance_;
+PROTOBUF_CONSTEXPR BeginSessionRequest::BeginSessionRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.user_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BeginSessionRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeginSessionRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeginSessionRequestDefaultTypeInternal() {}
+  union {
+    BeginSessionRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeginSessionRequestDefaultTypeInternal _BeginSessionRequest_default_instance_;
+PROTOBUF_CONSTEXPR BeginSessionResponse::BeginSessionResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.challenge_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.session_started_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BeginSessionResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeginSessionResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeginSessionResponseDefaultTypeInternal() {}
+  union {
+    BeginSessionResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeginSessionResponseDefaultTypeInternal _BeginSessionResponse_default_instance_;
+PROTOBUF_CONSTEXPR ClientAuthenticationRequest::ClientAuthenticationRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.signature_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClientAuthenticationRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientAuthenticationRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientAuthenticationRequestDefaultTypeInternal() {}
+  union {
+    ClientAuthenticationRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientAuthenticationRequestDefaultTypeInternal _ClientAuthenticationRequest_default_instance_;
+PROTOBUF_CONSTEXPR ClientAuthenticationResponse::ClientAuthenticationResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.authenticated_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClientAuthenticationResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientAuthenticationResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientAuthenticationResponseDefaultTypeInternal() {}
+  union {
+    ClientAuthenticationResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientAuthenticationResponseDefaultTypeInternal _ClientAuthenticationResponse_default_instance_;
+}  // namespace client_protocol
+}  // namespace siodb
+static ::_pb::Metadata file_level_metadata_ClientProtocol_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ClientProtocol_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ClientProtocol_2eproto = nullptr;
+
+const uint32_t TableStruct_ClientProtocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _impl_.prepare_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _impl_.statement_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _impl_.parameter_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::Command, _impl_.close_statement_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.column_description_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.freetext_message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.response_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.response_count_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.has_affected_row_count_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.affected_row_count_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.statement_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ServerResponse, _impl_.parameter_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::BeginSessionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::BeginSessionRequest, _impl_.user_name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::BeginSessionResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::BeginSessionResponse, _impl_.session_started_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::BeginSessionResponse, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::BeginSessionResponse, _impl_.challenge_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ClientAuthenticationRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ClientAuthenticationRequest, _impl_.signature_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ClientAuthenticationResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ClientAuthenticationResponse, _impl_.authenticated_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ClientAuthenticationResponse, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::client_protocol::ClientAuthenticationResponse, _impl_.session_id_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::siodb::client_protocol::Command)},
+  { 12, -1, -1, sizeof(::siodb::client_protocol::ServerResponse)},
+  { 28, -1, -1, sizeof(::siodb::client_protocol::BeginSessionRequest)},
+  { 35, -1, -1, sizeof(::siodb::client_protocol::BeginSessionResponse)},
+  { 44, -1, -1, sizeof(::siodb::client_protocol::ClientAuthenticationRequest)},
+  { 51, -1, -1, sizeof(::siodb::client_protocol::ClientAuthenticationResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::siodb::client_protocol::_Command_default_instance_._instance,
+  &::siodb::client_protocol::_ServerResponse_default_instance_._instance,
+  &::siodb::client_protocol::_BeginSessionRequest_default_instance_._instance,
+  &::siodb::client_protocol::_BeginSessionResponse_default_instance_._instance,
+  &::siodb::client_protocol::_ClientAuthenticationRequest_default_instance_._instance,
+  &::siodb::client_protocol::_ClientAuthenticationResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ClientProtocol_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024ClientProtocol.proto\022\025siodb.client_pro"
+  "tocol\032\021CommonTypes.proto\"\221\001\n\007Command\022\022\n\n"
+  "request_id\030\001 \001(\004\022\014\n\004text\030\002 \001(\t\022\017\n\007prepar"
+  "e\030\003 \001(\010\022\024\n\014statement_id\030\004 \001(\004\022$\n\tparamet"
+  "er\030\005 \003(\0132\021.siodb.TypedValue\022\027\n\017close_sta"
+  "tement\030\006 \001(\010\"\263\002\n\016ServerResponse\022\022\n\nreque"
+  "st_id\030\001 \001(\004\022%\n\007message\030\002 \003(\0132\024.siodb.Sta"
+  "tusMessage\0224\n\022column_description\030\003 \003(\0132\030"
+  ".siodb.ColumnDescription\022\030\n\020freetext_mes"
+  "sage\030\004 \003(\t\022\023\n\013response_id\030\005 \001(\r\022\026\n\016respo"
+  "nse_count\030\006 \001(\r\022\036\n\026has_affected_row_coun"
+  "t\030\007 \001(\010\022\032\n\022affected_row_count\030\010 \001(\004\022\024\n\014s"
+  "tatement_id\030\t \001(\004\022\027\n\017parameter_count\030\n \001"
+  "(\r\"(\n\023BeginSessionRequest\022\021\n\tuser_name\030\001"
+  " \001(\t\"i\n\024BeginSessionResponse\022\027\n\017session_"
+  "started\030\001 \001(\010\022%\n\007message\030\002 \001(\0132\024.siodb.S"
+  "tatusMessage\022\021\n\tchallenge\030\003 \001(\014\"0\n\033Clien"
+  "tAuthenticationRequest\022\021\n\tsignature\030\001 \001("
+  "\014\"p\n\034ClientAuthenticationResponse\022\025\n\raut"
+  "henticated\030\001 \001(\010\022%\n\007message\030\002 \001(\0132\024.siod"
+  "b.StatusMessage\022\022\n\nsession_id\030\003 \001(\tB\002H\001b"
+  "\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ClientProtocol_2eproto_deps[1] = {
+  &::descriptor_table_CommonTypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ClientProtocol_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ClientProtocol_2eproto = {
+    false, false, 847, descriptor_table_protodef_ClientProtocol_2eproto,
+    "ClientProtocol.proto",
+    &descriptor_table_ClientProtocol_2eproto_once, descriptor_table_ClientProtocol_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_ClientProtocol_2eproto::offsets,
+    file_level_metadata_ClientProtocol_2eproto, file_level_enum_descriptors_ClientProtocol_2eproto,
+    file_level_service_descriptors_ClientProtocol_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ClientProtocol_2eproto_getter() {
+  return &descriptor_table_ClientProtocol_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ClientProtocol_2eproto(&descriptor_table_ClientProtocol_2eproto);
+namespace siodb {
+namespace client_protocol {
+
+// ===================================================================
+
+class Command::_Internal {
+ public:
+};
+
+void Command::clear_parameter() {
+  _impl_.parameter_.Clear();
+}
+Command::Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.client_protocol.Command)
+}
+Command::Command(const Command& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Command* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parameter_){from._impl_.parameter_}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.statement_id_){}
+    , decltype(_impl_.prepare_){}
+    , decltype(_impl_.close_statement_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.close_statement_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.close_statement_));
+  // @@protoc_insertion_point(copy_constructor:siodb.client_protocol.Command)
+}
+
+inline void Command::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parameter_){arena}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.statement_id_){uint64_t{0u}}
+    , decltype(_impl_.prepare_){false}
+    , decltype(_impl_.close_statement_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Command::~Command() {
+  // @@protoc_insertion_point(destructor:siodb.client_protocol.Command)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Command::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parameter_.~RepeatedPtrField();
+  _impl_.text_.Destroy();
+}
+
+void Command::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Command::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.client_protocol.Command)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parameter_.Clear();
+  _impl_.text_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.close_statement_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.close_statement_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Command::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 request_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.client_protocol.Command.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool prepare = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prepare_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 statement_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.statement_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.TypedValue parameter = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_parameter(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool close_statement = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.close_statement_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Command::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.client_protocol.Command)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_request_id(), target);
+  }
+
+  // string text = 2;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.client_protocol.Command.text");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_text(), target);
+  }
+
+  // bool prepare = 3;
+  if (this->_internal_prepare() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_prepare(), target);
+  }
+
+  // uint64 statement_id = 4;
+  if (this->_internal_statement_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_statement_id(), target);
+  }
+
+  // repeated .siodb.TypedValue parameter = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_parameter_size()); i < n; i++) {
+    const auto& repfield = this->_internal_parameter(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool close_statement = 6;
+  if (this->_internal_close_statement() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_close_statement(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.client_protocol.Command)
+  return target;
+}
+
+size_t Command::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.client_protocol.Command)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.TypedValue parameter = 5;
+  total_size += 1UL * this->_internal_parameter_size();
+  for (const auto& msg : this->_impl_.parameter_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string text = 2;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint64 statement_id = 4;
+  if (this->_internal_statement_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_statement_id());
+  }
+
+  // bool prepare = 3;
+  if (this->_internal_prepare() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool close_statement = 6;
+  if (this->_internal_close_statement() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Command::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Command::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Command::GetClassData() const { return &_class_data_; }
+
+
+void Command::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Command*>(&to_msg);
+  auto& from = static_cast<const Command&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.client_protocol.Command)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.parameter_.MergeFrom(from._impl_.parameter_);
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_statement_id() != 0) {
+    _this->_internal_set_statement_id(from._internal_statement_id());
+  }
+  if (from._internal_prepare() != 0) {
+    _this->_internal_set_prepare(from._internal_prepare());
+  }
+  if (from._internal_close_statement() != 0) {
+    _this->_internal_set_close_statement(from._internal_close_statement());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Command::CopyFrom(const Command& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.client_protocol.Command)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Command::IsInitialized() const {
+  return true;
+}
+
+void Command::InternalSwap(Command* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.parameter_.InternalSwap(&other->_impl_.parameter_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Command, _impl_.close_statement_)
+      + sizeof(Command::_impl_.close_statement_)
+      - PROTOBUF_FIELD_OFFSET(Command, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Command::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ClientProtocol_2eproto_getter, &descriptor_table_ClientProtocol_2eproto_once,
+      file_level_metadata_ClientProtocol_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerResponse::_Internal {
+ public:
+};
+
+void ServerResponse::clear_message() {
+  _impl_.message_.Clear();
+}
+void ServerResponse::clear_column_description() {
+  _impl_.column_description_.Clear();
+}
+ServerResponse::ServerResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.client_protocol.ServerResponse)
+}
+ServerResponse::ServerResponse(const ServerResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){from._impl_.message_}
+    , decltype(_impl_.column_description_){from._impl_.column_description_}
+    , decltype(_impl_.freetext_message_){from._impl_.freetext_message_}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.response_id_){}
+    , decltype(_impl_.response_count_){}
+    , decltype(_impl_.affected_row_count_){}
+    , decltype(_impl_.has_affected_row_count_){}
+    , decltype(_impl_.parameter_count_){}
+    , decltype(_impl_.statement_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.statement_id_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.statement_id_));
+  // @@protoc_insertion_point(copy_constructor:siodb.client_protocol.ServerResponse)
+}
+
+inline void ServerResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){arena}
+    , decltype(_impl_.column_description_){arena}
+    , decltype(_impl_.freetext_message_){arena}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.response_id_){0u}
+    , decltype(_impl_.response_count_){0u}
+    , decltype(_impl_.affected_row_count_){uint64_t{0u}}
+    , decltype(_impl_.has_affected_row_count_){false}
+    , decltype(_impl_.parameter_count_){0u}
+    , decltype(_impl_.statement_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerResponse::~ServerResponse() {
+  // @@protoc_insertion_point(destructor:siodb.client_protocol.ServerResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.~RepeatedPtrField();
+  _impl_.column_description_.~RepeatedPtrField();
+  _impl_.freetext_message_.~RepeatedPtrField();
+}
+
+void ServerResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.client_protocol.ServerResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.Clear();
+  _impl_.column_description_.Clear();
+  _impl_.freetext_message_.Clear();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.statement_id_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.statement_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 request_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.StatusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.ColumnDescription column_description = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_column_description(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string freetext_message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_freetext_message();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "siodb.client_protocol.ServerResponse.freetext_message"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 response_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.response_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 response_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.response_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool has_affected_row_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.has_affected_row_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 affected_row_count = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.affected_row_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 statement_id = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.statement_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 parameter_count = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.parameter_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.client_protocol.ServerResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_request_id(), target);
+  }
+
+  // repeated .siodb.StatusMessage message = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_message_size()); i < n; i++) {
+    const auto& repfield = this->_internal_message(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .siodb.ColumnDescription column_description = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_column_description_size()); i < n; i++) {
+    const auto& repfield = this->_internal_column_description(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string freetext_message = 4;
+  for (int i = 0, n = this->_internal_freetext_message_size(); i < n; i++) {
+    const auto& s = this->_internal_freetext_message(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.client_protocol.ServerResponse.freetext_message");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // uint32 response_id = 5;
+  if (this->_internal_response_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_response_id(), target);
+  }
+
+  // uint32 response_count = 6;
+  if (this->_internal_response_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_response_count(), target);
+  }
+
+  // bool has_affected_row_count = 7;
+  if (this->_internal_has_affected_row_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_has_affected_row_count(), target);
+  }
+
+  // uint64 affected_row_count = 8;
+  if (this->_internal_affected_row_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_affected_row_count(), target);
+  }
+
+  // uint64 statement_id = 9;
+  if (this->_internal_statement_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_statement_id(), target);
+  }
+
+  // uint32 parameter_count = 10;
+  if (this->_internal_parameter_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_parameter_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.client_protocol.ServerResponse)
+  return target;
+}
+
+size_t ServerResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.client_protocol.ServerResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.StatusMessage message = 2;
+  total_size += 1UL * this->_internal_message_size();
+  for (const auto& msg : this->_impl_.message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .siodb.ColumnDescription column_description = 3;
+  total_size += 1UL * this->_internal_column_description_size();
+  for (const auto& msg : this->_impl_.column_description_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string freetext_message = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.freetext_message_.size());
+  for (int i = 0, n = _impl_.freetext_message_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.freetext_message_.Get(i));
+  }
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint32 response_id = 5;
+  if (this->_internal_response_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_response_id());
+  }
+
+  // uint32 response_count = 6;
+  if (this->_internal_response_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_response_count());
+  }
+
+  // uint64 affected_row_count = 8;
+  if (this->_internal_affected_row_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_affected_row_count());
+  }
+
+  // bool has_affected_row_count = 7;
+  if (this->_internal_has_affected_row_count() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 parameter_count = 10;
+  if (this->_internal_parameter_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parameter_count());
+  }
+
+  // uint64 statement_id = 9;
+  if (this->_internal_statement_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_statement_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerResponse::GetClassData() const { return &_class_data_; }
+
+
+void ServerResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerResponse*>(&to_msg);
+  auto& from = static_cast<const ServerResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.client_protocol.ServerResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.message_.MergeFrom(from._impl_.message_);
+  _this->_impl_.column_description_.MergeFrom(from._impl_.column_description_);
+  _this->_impl_.freetext_message_.MergeFrom(from._impl_.freetext_message_);
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_response_id() != 0) {
+    _this->_internal_set_response_id(from._internal_response_id());
+  }
+  if (from._internal_response_count() != 0) {
+    _this->_internal_set_response_count(from._internal_response_count());
+  }
+  if (from._internal_affected_row_count() != 0) {
+    _this->_internal_set_affected_row_count(from._internal_affected_row_count());
+  }
+  if (from._internal_has_affected_row_count() != 0) {
+    _this->_internal_set_has_affected_row_count(from._internal_has_affected_row_count());
+  }
+  if (from._internal_parameter_count() != 0) {
+    _this->_internal_set_parameter_count(from._internal_parameter_count());
+  }
+  if (from._internal_statement_id() != 0) {
+    _this->_internal_set_statement_id(from._internal_statement_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerResponse::CopyFrom(const ServerResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.client_protocol.ServerResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerResponse::IsInitialized() const {
+  return true;
+}
+
+void ServerResponse::InternalSwap(ServerResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.message_.InternalSwap(&other->_impl_.message_);
+  _impl_.column_description_.InternalSwap(&other->_impl_.column_description_);
+  _impl_.freetext_message_.InternalSwap(&other->_impl_.freetext_message_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerResponse, _impl_.statement_id_)
+      + sizeof(ServerResponse::_impl_.statement_id_)
+      - PROTOBUF_FIELD_OFFSET(ServerResponse, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ClientProtocol_2eproto_getter, &descriptor_table_ClientProtocol_2eproto_once,
+      file_level_metadata_ClientProtocol_2eproto[1]);
+}
+
+// ===================================================================
+
+class BeginSessionRequest::_Internal {
+ public:
+};
+
+BeginSessionRequest::BeginSessionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.client_protocol.BeginSessionRequest)
+}
+BeginSessionRequest::BeginSessionRequest(const BeginSessionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BeginSessionRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.user_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_user_name().empty()) {
+    _this->_impl_.user_name_.Set(from._internal_user_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:siodb.client_protocol.BeginSessionRequest)
+}
+
+inline void BeginSessionRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.user_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BeginSessionRequest::~BeginSessionRequest() {
+  // @@protoc_insertion_point(destructor:siodb.client_protocol.BeginSessionRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BeginSessionRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.user_name_.Destroy();
+}
+
+void BeginSessionRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BeginSessionRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.client_protocol.BeginSessionRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.user_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BeginSessionRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string user_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_user_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.client_protocol.BeginSessionRequest.user_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BeginSessionRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.client_protocol.BeginSessionRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string user_name = 1;
+  if (!this->_internal_user_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_name().data(), static_cast<int>(this->_internal_user_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.client_protocol.BeginSessionRequest.user_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_user_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.client_protocol.BeginSessionRequest)
+  return target;
+}
+
+size_t BeginSessionRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.client_protocol.BeginSessionRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string user_name = 1;
+  if (!this->_internal_user_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_user_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeginSessionRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BeginSessionRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeginSessionRequest::GetClassData() const { return &_class_data_; }
+
+
+void BeginSessionRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BeginSessionRequest*>(&to_msg);
+  auto& from = static_cast<const BeginSessionRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.client_protocol.BeginSessionRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_user_name().empty()) {
+    _this->_internal_set_user_name(from._internal_user_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BeginSessionRequest::CopyFrom(const BeginSessionRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.client_protocol.BeginSessionRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BeginSessionRequest::IsInitialized() const {
+  return true;
+}
+
+void BeginSessionRequest::InternalSwap(BeginSessionRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_name_, lhs_arena,
+      &other->_impl_.user_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BeginSessionRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ClientProtocol_2eproto_getter, &descriptor_table_ClientProtocol_2eproto_once,
+      file_level_metadata_ClientProtocol_2eproto[2]);
+}
+
+// ===================================================================
+
+class BeginSessionResponse::_Internal {
+ public:
+  static const ::siodb::StatusMessage& message(const BeginSessionResponse* msg);
+};
+
+const ::siodb::StatusMessage&
+BeginSessionResponse::_Internal::message(const BeginSessionResponse* msg) {
+  return *msg->_impl_.message_;
+}
+void BeginSessionResponse::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+BeginSessionResponse::BeginSessionResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.client_protocol.BeginSessionResponse)
+}
+BeginSessionResponse::BeginSessionResponse(const BeginSessionResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BeginSessionResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.challenge_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.session_started_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.challenge_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.challenge_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_challenge().empty()) {
+    _this->_impl_.challenge_.Set(from._internal_challenge(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::siodb::StatusMessage(*from._impl_.message_);
+  }
+  _this->_impl_.session_started_ = from._impl_.session_started_;
+  // @@protoc_insertion_point(copy_constructor:siodb.client_protocol.BeginSessionResponse)
+}
+
+inline void BeginSessionResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.challenge_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.session_started_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.challenge_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.challenge_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BeginSessionResponse::~BeginSessionResponse() {
+  // @@protoc_insertion_point(destructor:siodb.client_protocol.BeginSessionResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BeginSessionResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.challenge_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void BeginSessionResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BeginSessionResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.client_protocol.BeginSessionResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.challenge_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  _impl_.session_started_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BeginSessionResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool session_started = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.session_started_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.StatusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes challenge = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_challenge();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BeginSessionResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.client_protocol.BeginSessionResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool session_started = 1;
+  if (this->_internal_session_started() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_session_started(), target);
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // bytes challenge = 3;
+  if (!this->_internal_challenge().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_challenge(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.client_protocol.BeginSessionResponse)
+  return target;
+}
+
+size_t BeginSessionResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.client_protocol.BeginSessionResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes challenge = 3;
+  if (!this->_internal_challenge().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_challenge());
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  // bool session_started = 1;
+  if (this->_internal_session_started() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeginSessionResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BeginSessionResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeginSessionResponse::GetClassData() const { return &_class_data_; }
+
+
+void BeginSessionResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BeginSessionResponse*>(&to_msg);
+  auto& from = static_cast<const BeginSessionResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.client_protocol.BeginSessionResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_challenge().empty()) {
+    _this->_internal_set_challenge(from._internal_challenge());
+  }
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::siodb::StatusMessage::MergeFrom(
+        from._internal_message());
+  }
+  if (from._internal_session_started() != 0) {
+    _this->_internal_set_session_started(from._internal_session_started());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BeginSessionResponse::CopyFrom(const BeginSessionResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.client_protocol.BeginSessionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BeginSessionResponse::IsInitialized() const {
+  return true;
+}
+
+void BeginSessionResponse::InternalSwap(BeginSessionResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.challenge_, lhs_arena,
+      &other->_impl_.challenge_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BeginSessionResponse, _impl_.session_started_)
+      + sizeof(BeginSessionResponse::_impl_.session_started_)
+      - PROTOBUF_FIELD_OFFSET(BeginSessionResponse, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BeginSessionResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ClientProtocol_2eproto_getter, &descriptor_table_ClientProtocol_2eproto_once,
+      file_level_metadata_ClientProtocol_2eproto[3]);
+}
+
+// ===================================================================
+
+class ClientAuthenticationRequest::_Internal {
+ public:
+};
+
+ClientAuthenticationRequest::ClientAuthenticationRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.client_protocol.ClientAuthenticationRequest)
+}
+ClientAuthenticationRequest::ClientAuthenticationRequest(const ClientAuthenticationRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientAuthenticationRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signature_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_signature().empty()) {
+    _this->_impl_.signature_.Set(from._internal_signature(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:siodb.client_protocol.ClientAuthenticationRequest)
+}
+
+inline void ClientAuthenticationRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.signature_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ClientAuthenticationRequest::~ClientAuthenticationRequest() {
+  // @@protoc_insertion_point(destructor:siodb.client_protocol.ClientAuthenticationRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClientAuthenticationRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.signature_.Destroy();
+}
+
+void ClientAuthenticationRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClientAuthenticationRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.client_protocol.ClientAuthenticationRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.signature_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientAuthenticationRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes signature = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_signature();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClientAuthenticationRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.client_protocol.ClientAuthenticationRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes signature = 1;
+  if (!this->_internal_signature().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_signature(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.client_protocol.ClientAuthenticationRequest)
+  return target;
+}
+
+size_t ClientAuthenticationRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.client_protocol.ClientAuthenticationRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes signature = 1;
+  if (!this->_internal_signature().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_signature());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientAuthenticationRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientAuthenticationRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientAuthenticationRequest::GetClassData() const { return &_class_data_; }
+
+
+void ClientAuthenticationRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientAuthenticationRequest*>(&to_msg);
+  auto& from = static_cast<const ClientAuthenticationRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.client_protocol.ClientAuthenticationRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_signature().empty()) {
+    _this->_internal_set_signature(from._internal_signature());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientAuthenticationRequest::CopyFrom(const ClientAuthenticationRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.client_protocol.ClientAuthenticationRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientAuthenticationRequest::IsInitialized() const {
+  return true;
+}
+
+void ClientAuthenticationRequest::InternalSwap(ClientAuthenticationRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.signature_, lhs_arena,
+      &other->_impl_.signature_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientAuthenticationRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ClientProtocol_2eproto_getter, &descriptor_table_ClientProtocol_2eproto_once,
+      file_level_metadata_ClientProtocol_2eproto[4]);
+}
+
+// ===================================================================
+
+class ClientAuthenticationResponse::_Internal {
+ public:
+  static const ::siodb::StatusMessage& message(const ClientAuthenticationResponse* msg);
+};
+
+const ::siodb::StatusMessage&
+ClientAuthenticationResponse::_Internal::message(const ClientAuthenticationResponse* msg) {
+  return *msg->_impl_.message_;
+}
+void ClientAuthenticationResponse::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+ClientAuthenticationResponse::ClientAuthenticationResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.client_protocol.ClientAuthenticationResponse)
+}
+ClientAuthenticationResponse::ClientAuthenticationResponse(const ClientAuthenticationResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientAuthenticationResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.authenticated_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::siodb::StatusMessage(*from._impl_.message_);
+  }
+  _this->_impl_.authenticated_ = from._impl_.authenticated_;
+  // @@protoc_insertion_point(copy_constructor:siodb.client_protocol.ClientAuthenticationResponse)
+}
+
+inline void ClientAuthenticationResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.authenticated_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ClientAuthenticationResponse::~ClientAuthenticationResponse() {
+  // @@protoc_insertion_point(destructor:siodb.client_protocol.ClientAuthenticationResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClientAuthenticationResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void ClientAuthenticationResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClientAuthenticationResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.client_protocol.ClientAuthenticationResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  _impl_.authenticated_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientAuthenticationResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool authenticated = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.authenticated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.StatusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.client_protocol.ClientAuthenticationResponse.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClientAuthenticationResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.client_protocol.ClientAuthenticationResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool authenticated = 1;
+  if (this->_internal_authenticated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_authenticated(), target);
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 3;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.client_protocol.ClientAuthenticationResponse.session_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_session_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.client_protocol.ClientAuthenticationResponse)
+  return target;
+}
+
+size_t ClientAuthenticationResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.client_protocol.ClientAuthenticationResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 3;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  // bool authenticated = 1;
+  if (this->_internal_authenticated() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientAuthenticationResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientAuthenticationResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientAuthenticationResponse::GetClassData() const { return &_class_data_; }
+
+
+void ClientAuthenticationResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientAuthenticationResponse*>(&to_msg);
+  auto& from = static_cast<const ClientAuthenticationResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.client_protocol.ClientAuthenticationResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::siodb::StatusMessage::MergeFrom(
+        from._internal_message());
+  }
+  if (from._internal_authenticated() != 0) {
+    _this->_internal_set_authenticated(from._internal_authenticated());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientAuthenticationResponse::CopyFrom(const ClientAuthenticationResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.client_protocol.ClientAuthenticationResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientAuthenticationResponse::IsInitialized() const {
+  return true;
+}
+
+void ClientAuthenticationResponse::InternalSwap(ClientAuthenticationResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClientAuthenticationResponse, _impl_.authenticated_)
+      + sizeof(ClientAuthenticationResponse::_impl_.authenticated_)
+      - PROTOBUF_FIELD_OFFSET(ClientAuthenticationResponse, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientAuthenticationResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ClientProtocol_2eproto_getter, &descriptor_table_ClientProtocol_2eproto_once,
+      file_level_metadata_ClientProtocol_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace client_protocol
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::siodb::client_protocol::Command*
+Arena::CreateMaybeMessage< ::siodb::client_protocol::Command >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::client_protocol::Command >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::client_protocol::ServerResponse*
+Arena::CreateMaybeMessage< ::siodb::client_protocol::ServerResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::client_protocol::ServerResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::client_protocol::BeginSessionRequest*
+Arena::CreateMaybeMessage< ::siodb::client_protocol::BeginSessionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::client_protocol::BeginSessionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::client_protocol::BeginSessionResponse*
+Arena::CreateMaybeMessage< ::siodb::client_protocol::BeginSessionResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::client_protocol::BeginSessionResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::client_protocol::ClientAuthenticationRequest*
+Arena::CreateMaybeMessage< ::siodb::client_protocol::ClientAuthenticationRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::client_protocol::ClientAuthenticationRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::client_protocol::ClientAuthenticationResponse*
+Arena::CreateMaybeMessage< ::siodb::client_protocol::ClientAuthenticationResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::client_protocol::ClientAuthenticationResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
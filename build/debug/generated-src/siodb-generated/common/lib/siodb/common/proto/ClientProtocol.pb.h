@@ -0,0 +1,2171 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ClientProtocol.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ClientProtocol_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ClientProtocol_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "CommonTypes.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ClientProtocol_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ClientProtocol_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ClientProtocol_2eproto;
+namespace siodb {
+namespace client_protocol {
+class BeginSessionRequest;
+struct BeginSessionRequestDefaultTypeInternal;
+extern BeginSessionRequestDefaultTypeInternal _BeginSessionRequest_default_instance_;
+class BeginSessionResponse;
+struct BeginSessionResponseDefaultTypeInternal;
+extern BeginSessionResponseDefaultTypeInternal _BeginSessionResponse_default_instance_;
+class ClientAuthenticationRequest;
+struct ClientAuthenticationRequestDefaultTypeInternal;
+extern ClientAuthenticationRequestDefaultTypeInternal _ClientAuthenticationRequest_default_instance_;
+class ClientAuthenticationResponse;
+struct ClientAuthenticationResponseDefaultTypeInternal;
+extern ClientAuthenticationResponseDefaultTypeInternal _ClientAuthenticationResponse_default_instance_;
+class Command;
+struct CommandDefaultTypeInternal;
+extern CommandDefaultTypeInternal _Command_default_instance_;
+class ServerResponse;
+struct ServerResponseDefaultTypeInternal;
+extern ServerResponseDefaultTypeInternal _ServerResponse_default_instance_;
+}  // namespace client_protocol
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::siodb::client_protocol::BeginSessionRequest* Arena::CreateMaybeMessage<::siodb::client_protocol::BeginSessionRequest>(Arena*);
+template<> ::siodb::client_protocol::BeginSessionResponse* Arena::CreateMaybeMessage<::siodb::client_protocol::BeginSessionResponse>(Arena*);
+template<> ::siodb::client_protocol::ClientAuthenticationRequest* Arena::CreateMaybeMessage<::siodb::client_protocol::ClientAuthenticationRequest>(Arena*);
+template<> ::siodb::client_protocol::ClientAuthenticationResponse* Arena::CreateMaybeMessage<::siodb::client_protocol::ClientAuthenticationResponse>(Arena*);
+template<> ::siodb::client_protocol::Command* Arena::CreateMaybeMessage<::siodb::client_protocol::Command>(Arena*);
+template<> ::siodb::client_protocol::ServerResponse* Arena::CreateMaybeMessage<::siodb::client_protocol::ServerResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace siodb {
+namespace client_protocol {
+
+// ===================================================================
+
+class Command final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.client_protocol.Command) */ {
+ public:
+  inline Command() : Command(nullptr) {}
+  ~Command() override;
+  explicit PROTOBUF_CONSTEXPR Command(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Command(const Command& from);
+  Command(Command&& from) noexcept
+    : Command() {
+    *this = ::std::move(from);
+  }
+
+  inline Command& operator=(const Command& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Command& operator=(Command&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Command& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Command* internal_default_instance() {
+    return reinterpret_cast<const Command*>(
+               &_Command_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Command& a, Command& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Command* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Command* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Command* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Command>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Command& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Command& from) {
+    Command::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Command* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.client_protocol.Command";
+  }
+  protected:
+  explicit Command(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParameterFieldNumber = 5,
+    kTextFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+    kStatementIdFieldNumber = 4,
+    kPrepareFieldNumber = 3,
+    kCloseStatementFieldNumber = 6,
+  };
+  // repeated .siodb.TypedValue parameter = 5;
+  int parameter_size() const;
+  private:
+  int _internal_parameter_size() const;
+  public:
+  void clear_parameter();
+  ::siodb::TypedValue* mutable_parameter(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >*
+      mutable_parameter();
+  private:
+  const ::siodb::TypedValue& _internal_parameter(int index) const;
+  ::siodb::TypedValue* _internal_add_parameter();
+  public:
+  const ::siodb::TypedValue& parameter(int index) const;
+  ::siodb::TypedValue* add_parameter();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >&
+      parameter() const;
+
+  // string text = 2;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 statement_id = 4;
+  void clear_statement_id();
+  uint64_t statement_id() const;
+  void set_statement_id(uint64_t value);
+  private:
+  uint64_t _internal_statement_id() const;
+  void _internal_set_statement_id(uint64_t value);
+  public:
+
+  // bool prepare = 3;
+  void clear_prepare();
+  bool prepare() const;
+  void set_prepare(bool value);
+  private:
+  bool _internal_prepare() const;
+  void _internal_set_prepare(bool value);
+  public:
+
+  // bool close_statement = 6;
+  void clear_close_statement();
+  bool close_statement() const;
+  void set_close_statement(bool value);
+  private:
+  bool _internal_close_statement() const;
+  void _internal_set_close_statement(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.client_protocol.Command)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue > parameter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    uint64_t request_id_;
+    uint64_t statement_id_;
+    bool prepare_;
+    bool close_statement_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ClientProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.client_protocol.ServerResponse) */ {
+ public:
+  inline ServerResponse() : ServerResponse(nullptr) {}
+  ~ServerResponse() override;
+  explicit PROTOBUF_CONSTEXPR ServerResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerResponse(const ServerResponse& from);
+  ServerResponse(ServerResponse&& from) noexcept
+    : ServerResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerResponse& operator=(const ServerResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerResponse& operator=(ServerResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerResponse* internal_default_instance() {
+    return reinterpret_cast<const ServerResponse*>(
+               &_ServerResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerResponse& a, ServerResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerResponse& from) {
+    ServerResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.client_protocol.ServerResponse";
+  }
+  protected:
+  explicit ServerResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 2,
+    kColumnDescriptionFieldNumber = 3,
+    kFreetextMessageFieldNumber = 4,
+    kRequestIdFieldNumber = 1,
+    kResponseIdFieldNumber = 5,
+    kResponseCountFieldNumber = 6,
+    kAffectedRowCountFieldNumber = 8,
+    kHasAffectedRowCountFieldNumber = 7,
+    kParameterCountFieldNumber = 10,
+    kStatementIdFieldNumber = 9,
+  };
+  // repeated .siodb.StatusMessage message = 2;
+  int message_size() const;
+  private:
+  int _internal_message_size() const;
+  public:
+  void clear_message();
+  ::siodb::StatusMessage* mutable_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >*
+      mutable_message();
+  private:
+  const ::siodb::StatusMessage& _internal_message(int index) const;
+  ::siodb::StatusMessage* _internal_add_message();
+  public:
+  const ::siodb::StatusMessage& message(int index) const;
+  ::siodb::StatusMessage* add_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >&
+      message() const;
+
+  // repeated .siodb.ColumnDescription column_description = 3;
+  int column_description_size() const;
+  private:
+  int _internal_column_description_size() const;
+  public:
+  void clear_column_description();
+  ::siodb::ColumnDescription* mutable_column_description(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >*
+      mutable_column_description();
+  private:
+  const ::siodb::ColumnDescription& _internal_column_description(int index) const;
+  ::siodb::ColumnDescription* _internal_add_column_description();
+  public:
+  const ::siodb::ColumnDescription& column_description(int index) const;
+  ::siodb::ColumnDescription* add_column_description();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >&
+      column_description() const;
+
+  // repeated string freetext_message = 4;
+  int freetext_message_size() const;
+  private:
+  int _internal_freetext_message_size() const;
+  public:
+  void clear_freetext_message();
+  const std::string& freetext_message(int index) const;
+  std::string* mutable_freetext_message(int index);
+  void set_freetext_message(int index, const std::string& value);
+  void set_freetext_message(int index, std::string&& value);
+  void set_freetext_message(int index, const char* value);
+  void set_freetext_message(int index, const char* value, size_t size);
+  std::string* add_freetext_message();
+  void add_freetext_message(const std::string& value);
+  void add_freetext_message(std::string&& value);
+  void add_freetext_message(const char* value);
+  void add_freetext_message(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& freetext_message() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_freetext_message();
+  private:
+  const std::string& _internal_freetext_message(int index) const;
+  std::string* _internal_add_freetext_message();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 response_id = 5;
+  void clear_response_id();
+  uint32_t response_id() const;
+  void set_response_id(uint32_t value);
+  private:
+  uint32_t _internal_response_id() const;
+  void _internal_set_response_id(uint32_t value);
+  public:
+
+  // uint32 response_count = 6;
+  void clear_response_count();
+  uint32_t response_count() const;
+  void set_response_count(uint32_t value);
+  private:
+  uint32_t _internal_response_count() const;
+  void _internal_set_response_count(uint32_t value);
+  public:
+
+  // uint64 affected_row_count = 8;
+  void clear_affected_row_count();
+  uint64_t affected_row_count() const;
+  void set_affected_row_count(uint64_t value);
+  private:
+  uint64_t _internal_affected_row_count() const;
+  void _internal_set_affected_row_count(uint64_t value);
+  public:
+
+  // bool has_affected_row_count = 7;
+  void clear_has_affected_row_count();
+  bool has_affected_row_count() const;
+  void set_has_affected_row_count(bool value);
+  private:
+  bool _internal_has_affected_row_count() const;
+  void _internal_set_has_affected_row_count(bool value);
+  public:
+
+  // uint32 parameter_count = 10;
+  void clear_parameter_count();
+  uint32_t parameter_count() const;
+  void set_parameter_count(uint32_t value);
+  private:
+  uint32_t _internal_parameter_count() const;
+  void _internal_set_parameter_count(uint32_t value);
+  public:
+
+  // uint64 statement_id = 9;
+  void clear_statement_id();
+  uint64_t statement_id() const;
+  void set_statement_id(uint64_t value);
+  private:
+  uint64_t _internal_statement_id() const;
+  void _internal_set_statement_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.client_protocol.ServerResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage > message_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription > column_description_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> freetext_message_;
+    uint64_t request_id_;
+    uint32_t response_id_;
+    uint32_t response_count_;
+    uint64_t affected_row_count_;
+    bool has_affected_row_count_;
+    uint32_t parameter_count_;
+    uint64_t statement_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ClientProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BeginSessionRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.client_protocol.BeginSessionRequest) */ {
+ public:
+  inline BeginSessionRequest() : BeginSessionRequest(nullptr) {}
+  ~BeginSessionRequest() override;
+  explicit PROTOBUF_CONSTEXPR BeginSessionRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BeginSessionRequest(const BeginSessionRequest& from);
+  BeginSessionRequest(BeginSessionRequest&& from) noexcept
+    : BeginSessionRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BeginSessionRequest& operator=(const BeginSessionRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BeginSessionRequest& operator=(BeginSessionRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BeginSessionRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BeginSessionRequest* internal_default_instance() {
+    return reinterpret_cast<const BeginSessionRequest*>(
+               &_BeginSessionRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(BeginSessionRequest& a, BeginSessionRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BeginSessionRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BeginSessionRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BeginSessionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BeginSessionRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BeginSessionRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BeginSessionRequest& from) {
+    BeginSessionRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BeginSessionRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.client_protocol.BeginSessionRequest";
+  }
+  protected:
+  explicit BeginSessionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserNameFieldNumber = 1,
+  };
+  // string user_name = 1;
+  void clear_user_name();
+  const std::string& user_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_name();
+  PROTOBUF_NODISCARD std::string* release_user_name();
+  void set_allocated_user_name(std::string* user_name);
+  private:
+  const std::string& _internal_user_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_name(const std::string& value);
+  std::string* _internal_mutable_user_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.client_protocol.BeginSessionRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ClientProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BeginSessionResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.client_protocol.BeginSessionResponse) */ {
+ public:
+  inline BeginSessionResponse() : BeginSessionResponse(nullptr) {}
+  ~BeginSessionResponse() override;
+  explicit PROTOBUF_CONSTEXPR BeginSessionResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BeginSessionResponse(const BeginSessionResponse& from);
+  BeginSessionResponse(BeginSessionResponse&& from) noexcept
+    : BeginSessionResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BeginSessionResponse& operator=(const BeginSessionResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BeginSessionResponse& operator=(BeginSessionResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BeginSessionResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BeginSessionResponse* internal_default_instance() {
+    return reinterpret_cast<const BeginSessionResponse*>(
+               &_BeginSessionResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(BeginSessionResponse& a, BeginSessionResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BeginSessionResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BeginSessionResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BeginSessionResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BeginSessionResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BeginSessionResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BeginSessionResponse& from) {
+    BeginSessionResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BeginSessionResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.client_protocol.BeginSessionResponse";
+  }
+  protected:
+  explicit BeginSessionResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChallengeFieldNumber = 3,
+    kMessageFieldNumber = 2,
+    kSessionStartedFieldNumber = 1,
+  };
+  // bytes challenge = 3;
+  void clear_challenge();
+  const std::string& challenge() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_challenge(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_challenge();
+  PROTOBUF_NODISCARD std::string* release_challenge();
+  void set_allocated_challenge(std::string* challenge);
+  private:
+  const std::string& _internal_challenge() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_challenge(const std::string& value);
+  std::string* _internal_mutable_challenge();
+  public:
+
+  // .siodb.StatusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::siodb::StatusMessage& message() const;
+  PROTOBUF_NODISCARD ::siodb::StatusMessage* release_message();
+  ::siodb::StatusMessage* mutable_message();
+  void set_allocated_message(::siodb::StatusMessage* message);
+  private:
+  const ::siodb::StatusMessage& _internal_message() const;
+  ::siodb::StatusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::siodb::StatusMessage* message);
+  ::siodb::StatusMessage* unsafe_arena_release_message();
+
+  // bool session_started = 1;
+  void clear_session_started();
+  bool session_started() const;
+  void set_session_started(bool value);
+  private:
+  bool _internal_session_started() const;
+  void _internal_set_session_started(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.client_protocol.BeginSessionResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr challenge_;
+    ::siodb::StatusMessage* message_;
+    bool session_started_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ClientProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientAuthenticationRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.client_protocol.ClientAuthenticationRequest) */ {
+ public:
+  inline ClientAuthenticationRequest() : ClientAuthenticationRequest(nullptr) {}
+  ~ClientAuthenticationRequest() override;
+  explicit PROTOBUF_CONSTEXPR ClientAuthenticationRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientAuthenticationRequest(const ClientAuthenticationRequest& from);
+  ClientAuthenticationRequest(ClientAuthenticationRequest&& from) noexcept
+    : ClientAuthenticationRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientAuthenticationRequest& operator=(const ClientAuthenticationRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientAuthenticationRequest& operator=(ClientAuthenticationRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientAuthenticationRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientAuthenticationRequest* internal_default_instance() {
+    return reinterpret_cast<const ClientAuthenticationRequest*>(
+               &_ClientAuthenticationRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ClientAuthenticationRequest& a, ClientAuthenticationRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientAuthenticationRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientAuthenticationRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientAuthenticationRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientAuthenticationRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientAuthenticationRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientAuthenticationRequest& from) {
+    ClientAuthenticationRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientAuthenticationRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.client_protocol.ClientAuthenticationRequest";
+  }
+  protected:
+  explicit ClientAuthenticationRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSignatureFieldNumber = 1,
+  };
+  // bytes signature = 1;
+  void clear_signature();
+  const std::string& signature() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_signature(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_signature();
+  PROTOBUF_NODISCARD std::string* release_signature();
+  void set_allocated_signature(std::string* signature);
+  private:
+  const std::string& _internal_signature() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_signature(const std::string& value);
+  std::string* _internal_mutable_signature();
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.client_protocol.ClientAuthenticationRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr signature_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ClientProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientAuthenticationResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.client_protocol.ClientAuthenticationResponse) */ {
+ public:
+  inline ClientAuthenticationResponse() : ClientAuthenticationResponse(nullptr) {}
+  ~ClientAuthenticationResponse() override;
+  explicit PROTOBUF_CONSTEXPR ClientAuthenticationResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientAuthenticationResponse(const ClientAuthenticationResponse& from);
+  ClientAuthenticationResponse(ClientAuthenticationResponse&& from) noexcept
+    : ClientAuthenticationResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientAuthenticationResponse& operator=(const ClientAuthenticationResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientAuthenticationResponse& operator=(ClientAuthenticationResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientAuthenticationResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientAuthenticationResponse* internal_default_instance() {
+    return reinterpret_cast<const ClientAuthenticationResponse*>(
+               &_ClientAuthenticationResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ClientAuthenticationResponse& a, ClientAuthenticationResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientAuthenticationResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientAuthenticationResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClientAuthenticationResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClientAuthenticationResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientAuthenticationResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientAuthenticationResponse& from) {
+    ClientAuthenticationResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientAuthenticationResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.client_protocol.ClientAuthenticationResponse";
+  }
+  protected:
+  explicit ClientAuthenticationResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 3,
+    kMessageFieldNumber = 2,
+    kAuthenticatedFieldNumber = 1,
+  };
+  // string session_id = 3;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // .siodb.StatusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::siodb::StatusMessage& message() const;
+  PROTOBUF_NODISCARD ::siodb::StatusMessage* release_message();
+  ::siodb::StatusMessage* mutable_message();
+  void set_allocated_message(::siodb::StatusMessage* message);
+  private:
+  const ::siodb::StatusMessage& _internal_message() const;
+  ::siodb::StatusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::siodb::StatusMessage* message);
+  ::siodb::StatusMessage* unsafe_arena_release_message();
+
+  // bool authenticated = 1;
+  void clear_authenticated();
+  bool authenticated() const;
+  void set_authenticated(bool value);
+  private:
+  bool _internal_authenticated() const;
+  void _internal_set_authenticated(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.client_protocol.ClientAuthenticationResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::siodb::StatusMessage* message_;
+    bool authenticated_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ClientProtocol_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Command
+
+// uint64 request_id = 1;
+inline void Command::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t Command::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Command::request_id() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.Command.request_id)
+  return _internal_request_id();
+}
+inline void Command::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void Command::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.Command.request_id)
+}
+
+// string text = 2;
+inline void Command::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& Command::text() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.Command.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Command::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.Command.text)
+}
+inline std::string* Command::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.Command.text)
+  return _s;
+}
+inline const std::string& Command::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void Command::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Command::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Command::release_text() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.Command.text)
+  return _impl_.text_.Release();
+}
+inline void Command::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.Command.text)
+}
+
+// bool prepare = 3;
+inline void Command::clear_prepare() {
+  _impl_.prepare_ = false;
+}
+inline bool Command::_internal_prepare() const {
+  return _impl_.prepare_;
+}
+inline bool Command::prepare() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.Command.prepare)
+  return _internal_prepare();
+}
+inline void Command::_internal_set_prepare(bool value) {
+  
+  _impl_.prepare_ = value;
+}
+inline void Command::set_prepare(bool value) {
+  _internal_set_prepare(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.Command.prepare)
+}
+
+// uint64 statement_id = 4;
+inline void Command::clear_statement_id() {
+  _impl_.statement_id_ = uint64_t{0u};
+}
+inline uint64_t Command::_internal_statement_id() const {
+  return _impl_.statement_id_;
+}
+inline uint64_t Command::statement_id() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.Command.statement_id)
+  return _internal_statement_id();
+}
+inline void Command::_internal_set_statement_id(uint64_t value) {
+  
+  _impl_.statement_id_ = value;
+}
+inline void Command::set_statement_id(uint64_t value) {
+  _internal_set_statement_id(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.Command.statement_id)
+}
+
+// repeated .siodb.TypedValue parameter = 5;
+inline int Command::_internal_parameter_size() const {
+  return _impl_.parameter_.size();
+}
+inline int Command::parameter_size() const {
+  return _internal_parameter_size();
+}
+inline ::siodb::TypedValue* Command::mutable_parameter(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.Command.parameter)
+  return _impl_.parameter_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >*
+Command::mutable_parameter() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.client_protocol.Command.parameter)
+  return &_impl_.parameter_;
+}
+inline const ::siodb::TypedValue& Command::_internal_parameter(int index) const {
+  return _impl_.parameter_.Get(index);
+}
+inline const ::siodb::TypedValue& Command::parameter(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.Command.parameter)
+  return _internal_parameter(index);
+}
+inline ::siodb::TypedValue* Command::_internal_add_parameter() {
+  return _impl_.parameter_.Add();
+}
+inline ::siodb::TypedValue* Command::add_parameter() {
+  ::siodb::TypedValue* _add = _internal_add_parameter();
+  // @@protoc_insertion_point(field_add:siodb.client_protocol.Command.parameter)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >&
+Command::parameter() const {
+  // @@protoc_insertion_point(field_list:siodb.client_protocol.Command.parameter)
+  return _impl_.parameter_;
+}
+
+// bool close_statement = 6;
+inline void Command::clear_close_statement() {
+  _impl_.close_statement_ = false;
+}
+inline bool Command::_internal_close_statement() const {
+  return _impl_.close_statement_;
+}
+inline bool Command::close_statement() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.Command.close_statement)
+  return _internal_close_statement();
+}
+inline void Command::_internal_set_close_statement(bool value) {
+  
+  _impl_.close_statement_ = value;
+}
+inline void Command::set_close_statement(bool value) {
+  _internal_set_close_statement(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.Command.close_statement)
+}
+
+// -------------------------------------------------------------------
+
+// ServerResponse
+
+// uint64 request_id = 1;
+inline void ServerResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t ServerResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t ServerResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.request_id)
+  return _internal_request_id();
+}
+inline void ServerResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void ServerResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.request_id)
+}
+
+// repeated .siodb.StatusMessage message = 2;
+inline int ServerResponse::_internal_message_size() const {
+  return _impl_.message_.size();
+}
+inline int ServerResponse::message_size() const {
+  return _internal_message_size();
+}
+inline ::siodb::StatusMessage* ServerResponse::mutable_message(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.ServerResponse.message)
+  return _impl_.message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >*
+ServerResponse::mutable_message() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.client_protocol.ServerResponse.message)
+  return &_impl_.message_;
+}
+inline const ::siodb::StatusMessage& ServerResponse::_internal_message(int index) const {
+  return _impl_.message_.Get(index);
+}
+inline const ::siodb::StatusMessage& ServerResponse::message(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.message)
+  return _internal_message(index);
+}
+inline ::siodb::StatusMessage* ServerResponse::_internal_add_message() {
+  return _impl_.message_.Add();
+}
+inline ::siodb::StatusMessage* ServerResponse::add_message() {
+  ::siodb::StatusMessage* _add = _internal_add_message();
+  // @@protoc_insertion_point(field_add:siodb.client_protocol.ServerResponse.message)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >&
+ServerResponse::message() const {
+  // @@protoc_insertion_point(field_list:siodb.client_protocol.ServerResponse.message)
+  return _impl_.message_;
+}
+
+// repeated .siodb.ColumnDescription column_description = 3;
+inline int ServerResponse::_internal_column_description_size() const {
+  return _impl_.column_description_.size();
+}
+inline int ServerResponse::column_description_size() const {
+  return _internal_column_description_size();
+}
+inline ::siodb::ColumnDescription* ServerResponse::mutable_column_description(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.ServerResponse.column_description)
+  return _impl_.column_description_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >*
+ServerResponse::mutable_column_description() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.client_protocol.ServerResponse.column_description)
+  return &_impl_.column_description_;
+}
+inline const ::siodb::ColumnDescription& ServerResponse::_internal_column_description(int index) const {
+  return _impl_.column_description_.Get(index);
+}
+inline const ::siodb::ColumnDescription& ServerResponse::column_description(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.column_description)
+  return _internal_column_description(index);
+}
+inline ::siodb::ColumnDescription* ServerResponse::_internal_add_column_description() {
+  return _impl_.column_description_.Add();
+}
+inline ::siodb::ColumnDescription* ServerResponse::add_column_description() {
+  ::siodb::ColumnDescription* _add = _internal_add_column_description();
+  // @@protoc_insertion_point(field_add:siodb.client_protocol.ServerResponse.column_description)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >&
+ServerResponse::column_description() const {
+  // @@protoc_insertion_point(field_list:siodb.client_protocol.ServerResponse.column_description)
+  return _impl_.column_description_;
+}
+
+// repeated string freetext_message = 4;
+inline int ServerResponse::_internal_freetext_message_size() const {
+  return _impl_.freetext_message_.size();
+}
+inline int ServerResponse::freetext_message_size() const {
+  return _internal_freetext_message_size();
+}
+inline void ServerResponse::clear_freetext_message() {
+  _impl_.freetext_message_.Clear();
+}
+inline std::string* ServerResponse::add_freetext_message() {
+  std::string* _s = _internal_add_freetext_message();
+  // @@protoc_insertion_point(field_add_mutable:siodb.client_protocol.ServerResponse.freetext_message)
+  return _s;
+}
+inline const std::string& ServerResponse::_internal_freetext_message(int index) const {
+  return _impl_.freetext_message_.Get(index);
+}
+inline const std::string& ServerResponse::freetext_message(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.freetext_message)
+  return _internal_freetext_message(index);
+}
+inline std::string* ServerResponse::mutable_freetext_message(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.ServerResponse.freetext_message)
+  return _impl_.freetext_message_.Mutable(index);
+}
+inline void ServerResponse::set_freetext_message(int index, const std::string& value) {
+  _impl_.freetext_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline void ServerResponse::set_freetext_message(int index, std::string&& value) {
+  _impl_.freetext_message_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline void ServerResponse::set_freetext_message(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.freetext_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline void ServerResponse::set_freetext_message(int index, const char* value, size_t size) {
+  _impl_.freetext_message_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline std::string* ServerResponse::_internal_add_freetext_message() {
+  return _impl_.freetext_message_.Add();
+}
+inline void ServerResponse::add_freetext_message(const std::string& value) {
+  _impl_.freetext_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline void ServerResponse::add_freetext_message(std::string&& value) {
+  _impl_.freetext_message_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline void ServerResponse::add_freetext_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.freetext_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline void ServerResponse::add_freetext_message(const char* value, size_t size) {
+  _impl_.freetext_message_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:siodb.client_protocol.ServerResponse.freetext_message)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ServerResponse::freetext_message() const {
+  // @@protoc_insertion_point(field_list:siodb.client_protocol.ServerResponse.freetext_message)
+  return _impl_.freetext_message_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ServerResponse::mutable_freetext_message() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.client_protocol.ServerResponse.freetext_message)
+  return &_impl_.freetext_message_;
+}
+
+// uint32 response_id = 5;
+inline void ServerResponse::clear_response_id() {
+  _impl_.response_id_ = 0u;
+}
+inline uint32_t ServerResponse::_internal_response_id() const {
+  return _impl_.response_id_;
+}
+inline uint32_t ServerResponse::response_id() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.response_id)
+  return _internal_response_id();
+}
+inline void ServerResponse::_internal_set_response_id(uint32_t value) {
+  
+  _impl_.response_id_ = value;
+}
+inline void ServerResponse::set_response_id(uint32_t value) {
+  _internal_set_response_id(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.response_id)
+}
+
+// uint32 response_count = 6;
+inline void ServerResponse::clear_response_count() {
+  _impl_.response_count_ = 0u;
+}
+inline uint32_t ServerResponse::_internal_response_count() const {
+  return _impl_.response_count_;
+}
+inline uint32_t ServerResponse::response_count() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.response_count)
+  return _internal_response_count();
+}
+inline void ServerResponse::_internal_set_response_count(uint32_t value) {
+  
+  _impl_.response_count_ = value;
+}
+inline void ServerResponse::set_response_count(uint32_t value) {
+  _internal_set_response_count(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.response_count)
+}
+
+// bool has_affected_row_count = 7;
+inline void ServerResponse::clear_has_affected_row_count() {
+  _impl_.has_affected_row_count_ = false;
+}
+inline bool ServerResponse::_internal_has_affected_row_count() const {
+  return _impl_.has_affected_row_count_;
+}
+inline bool ServerResponse::has_affected_row_count() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.has_affected_row_count)
+  return _internal_has_affected_row_count();
+}
+inline void ServerResponse::_internal_set_has_affected_row_count(bool value) {
+  
+  _impl_.has_affected_row_count_ = value;
+}
+inline void ServerResponse::set_has_affected_row_count(bool value) {
+  _internal_set_has_affected_row_count(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.has_affected_row_count)
+}
+
+// uint64 affected_row_count = 8;
+inline void ServerResponse::clear_affected_row_count() {
+  _impl_.affected_row_count_ = uint64_t{0u};
+}
+inline uint64_t ServerResponse::_internal_affected_row_count() const {
+  return _impl_.affected_row_count_;
+}
+inline uint64_t ServerResponse::affected_row_count() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.affected_row_count)
+  return _internal_affected_row_count();
+}
+inline void ServerResponse::_internal_set_affected_row_count(uint64_t value) {
+  
+  _impl_.affected_row_count_ = value;
+}
+inline void ServerResponse::set_affected_row_count(uint64_t value) {
+  _internal_set_affected_row_count(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.affected_row_count)
+}
+
+// uint64 statement_id = 9;
+inline void ServerResponse::clear_statement_id() {
+  _impl_.statement_id_ = uint64_t{0u};
+}
+inline uint64_t ServerResponse::_internal_statement_id() const {
+  return _impl_.statement_id_;
+}
+inline uint64_t ServerResponse::statement_id() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.statement_id)
+  return _internal_statement_id();
+}
+inline void ServerResponse::_internal_set_statement_id(uint64_t value) {
+  
+  _impl_.statement_id_ = value;
+}
+inline void ServerResponse::set_statement_id(uint64_t value) {
+  _internal_set_statement_id(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.statement_id)
+}
+
+// uint32 parameter_count = 10;
+inline void ServerResponse::clear_parameter_count() {
+  _impl_.parameter_count_ = 0u;
+}
+inline uint32_t ServerResponse::_internal_parameter_count() const {
+  return _impl_.parameter_count_;
+}
+inline uint32_t ServerResponse::parameter_count() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ServerResponse.parameter_count)
+  return _internal_parameter_count();
+}
+inline void ServerResponse::_internal_set_parameter_count(uint32_t value) {
+  
+  _impl_.parameter_count_ = value;
+}
+inline void ServerResponse::set_parameter_count(uint32_t value) {
+  _internal_set_parameter_count(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ServerResponse.parameter_count)
+}
+
+// -------------------------------------------------------------------
+
+// BeginSessionRequest
+
+// string user_name = 1;
+inline void BeginSessionRequest::clear_user_name() {
+  _impl_.user_name_.ClearToEmpty();
+}
+inline const std::string& BeginSessionRequest::user_name() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.BeginSessionRequest.user_name)
+  return _internal_user_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BeginSessionRequest::set_user_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.user_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.BeginSessionRequest.user_name)
+}
+inline std::string* BeginSessionRequest::mutable_user_name() {
+  std::string* _s = _internal_mutable_user_name();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.BeginSessionRequest.user_name)
+  return _s;
+}
+inline const std::string& BeginSessionRequest::_internal_user_name() const {
+  return _impl_.user_name_.Get();
+}
+inline void BeginSessionRequest::_internal_set_user_name(const std::string& value) {
+  
+  _impl_.user_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BeginSessionRequest::_internal_mutable_user_name() {
+  
+  return _impl_.user_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BeginSessionRequest::release_user_name() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.BeginSessionRequest.user_name)
+  return _impl_.user_name_.Release();
+}
+inline void BeginSessionRequest::set_allocated_user_name(std::string* user_name) {
+  if (user_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.user_name_.SetAllocated(user_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_name_.IsDefault()) {
+    _impl_.user_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.BeginSessionRequest.user_name)
+}
+
+// -------------------------------------------------------------------
+
+// BeginSessionResponse
+
+// bool session_started = 1;
+inline void BeginSessionResponse::clear_session_started() {
+  _impl_.session_started_ = false;
+}
+inline bool BeginSessionResponse::_internal_session_started() const {
+  return _impl_.session_started_;
+}
+inline bool BeginSessionResponse::session_started() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.BeginSessionResponse.session_started)
+  return _internal_session_started();
+}
+inline void BeginSessionResponse::_internal_set_session_started(bool value) {
+  
+  _impl_.session_started_ = value;
+}
+inline void BeginSessionResponse::set_session_started(bool value) {
+  _internal_set_session_started(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.BeginSessionResponse.session_started)
+}
+
+// .siodb.StatusMessage message = 2;
+inline bool BeginSessionResponse::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool BeginSessionResponse::has_message() const {
+  return _internal_has_message();
+}
+inline const ::siodb::StatusMessage& BeginSessionResponse::_internal_message() const {
+  const ::siodb::StatusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::siodb::StatusMessage&>(
+      ::siodb::_StatusMessage_default_instance_);
+}
+inline const ::siodb::StatusMessage& BeginSessionResponse::message() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.BeginSessionResponse.message)
+  return _internal_message();
+}
+inline void BeginSessionResponse::unsafe_arena_set_allocated_message(
+    ::siodb::StatusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:siodb.client_protocol.BeginSessionResponse.message)
+}
+inline ::siodb::StatusMessage* BeginSessionResponse::release_message() {
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::siodb::StatusMessage* BeginSessionResponse::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.BeginSessionResponse.message)
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::siodb::StatusMessage* BeginSessionResponse::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::siodb::StatusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::siodb::StatusMessage* BeginSessionResponse::mutable_message() {
+  ::siodb::StatusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.BeginSessionResponse.message)
+  return _msg;
+}
+inline void BeginSessionResponse::set_allocated_message(::siodb::StatusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.BeginSessionResponse.message)
+}
+
+// bytes challenge = 3;
+inline void BeginSessionResponse::clear_challenge() {
+  _impl_.challenge_.ClearToEmpty();
+}
+inline const std::string& BeginSessionResponse::challenge() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.BeginSessionResponse.challenge)
+  return _internal_challenge();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BeginSessionResponse::set_challenge(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.challenge_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.BeginSessionResponse.challenge)
+}
+inline std::string* BeginSessionResponse::mutable_challenge() {
+  std::string* _s = _internal_mutable_challenge();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.BeginSessionResponse.challenge)
+  return _s;
+}
+inline const std::string& BeginSessionResponse::_internal_challenge() const {
+  return _impl_.challenge_.Get();
+}
+inline void BeginSessionResponse::_internal_set_challenge(const std::string& value) {
+  
+  _impl_.challenge_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BeginSessionResponse::_internal_mutable_challenge() {
+  
+  return _impl_.challenge_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BeginSessionResponse::release_challenge() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.BeginSessionResponse.challenge)
+  return _impl_.challenge_.Release();
+}
+inline void BeginSessionResponse::set_allocated_challenge(std::string* challenge) {
+  if (challenge != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.challenge_.SetAllocated(challenge, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.challenge_.IsDefault()) {
+    _impl_.challenge_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.BeginSessionResponse.challenge)
+}
+
+// -------------------------------------------------------------------
+
+// ClientAuthenticationRequest
+
+// bytes signature = 1;
+inline void ClientAuthenticationRequest::clear_signature() {
+  _impl_.signature_.ClearToEmpty();
+}
+inline const std::string& ClientAuthenticationRequest::signature() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ClientAuthenticationRequest.signature)
+  return _internal_signature();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClientAuthenticationRequest::set_signature(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.signature_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ClientAuthenticationRequest.signature)
+}
+inline std::string* ClientAuthenticationRequest::mutable_signature() {
+  std::string* _s = _internal_mutable_signature();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.ClientAuthenticationRequest.signature)
+  return _s;
+}
+inline const std::string& ClientAuthenticationRequest::_internal_signature() const {
+  return _impl_.signature_.Get();
+}
+inline void ClientAuthenticationRequest::_internal_set_signature(const std::string& value) {
+  
+  _impl_.signature_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClientAuthenticationRequest::_internal_mutable_signature() {
+  
+  return _impl_.signature_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClientAuthenticationRequest::release_signature() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.ClientAuthenticationRequest.signature)
+  return _impl_.signature_.Release();
+}
+inline void ClientAuthenticationRequest::set_allocated_signature(std::string* signature) {
+  if (signature != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.signature_.SetAllocated(signature, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.signature_.IsDefault()) {
+    _impl_.signature_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.ClientAuthenticationRequest.signature)
+}
+
+// -------------------------------------------------------------------
+
+// ClientAuthenticationResponse
+
+// bool authenticated = 1;
+inline void ClientAuthenticationResponse::clear_authenticated() {
+  _impl_.authenticated_ = false;
+}
+inline bool ClientAuthenticationResponse::_internal_authenticated() const {
+  return _impl_.authenticated_;
+}
+inline bool ClientAuthenticationResponse::authenticated() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ClientAuthenticationResponse.authenticated)
+  return _internal_authenticated();
+}
+inline void ClientAuthenticationResponse::_internal_set_authenticated(bool value) {
+  
+  _impl_.authenticated_ = value;
+}
+inline void ClientAuthenticationResponse::set_authenticated(bool value) {
+  _internal_set_authenticated(value);
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ClientAuthenticationResponse.authenticated)
+}
+
+// .siodb.StatusMessage message = 2;
+inline bool ClientAuthenticationResponse::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool ClientAuthenticationResponse::has_message() const {
+  return _internal_has_message();
+}
+inline const ::siodb::StatusMessage& ClientAuthenticationResponse::_internal_message() const {
+  const ::siodb::StatusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::siodb::StatusMessage&>(
+      ::siodb::_StatusMessage_default_instance_);
+}
+inline const ::siodb::StatusMessage& ClientAuthenticationResponse::message() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ClientAuthenticationResponse.message)
+  return _internal_message();
+}
+inline void ClientAuthenticationResponse::unsafe_arena_set_allocated_message(
+    ::siodb::StatusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:siodb.client_protocol.ClientAuthenticationResponse.message)
+}
+inline ::siodb::StatusMessage* ClientAuthenticationResponse::release_message() {
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::siodb::StatusMessage* ClientAuthenticationResponse::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.ClientAuthenticationResponse.message)
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::siodb::StatusMessage* ClientAuthenticationResponse::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::siodb::StatusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::siodb::StatusMessage* ClientAuthenticationResponse::mutable_message() {
+  ::siodb::StatusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.ClientAuthenticationResponse.message)
+  return _msg;
+}
+inline void ClientAuthenticationResponse::set_allocated_message(::siodb::StatusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.ClientAuthenticationResponse.message)
+}
+
+// string session_id = 3;
+inline void ClientAuthenticationResponse::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& ClientAuthenticationResponse::session_id() const {
+  // @@protoc_insertion_point(field_get:siodb.client_protocol.ClientAuthenticationResponse.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClientAuthenticationResponse::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.client_protocol.ClientAuthenticationResponse.session_id)
+}
+inline std::string* ClientAuthenticationResponse::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:siodb.client_protocol.ClientAuthenticationResponse.session_id)
+  return _s;
+}
+inline const std::string& ClientAuthenticationResponse::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void ClientAuthenticationResponse::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClientAuthenticationResponse::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClientAuthenticationResponse::release_session_id() {
+  // @@protoc_insertion_point(field_release:siodb.client_protocol.ClientAuthenticationResponse.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void ClientAuthenticationResponse::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.client_protocol.ClientAuthenticationResponse.session_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace client_protocol
+}  // namespace siodb
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ClientProtocol_2eproto
@@ -0,0 +1,117 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ColumnDataType.proto
+
+#include "ColumnDataType.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace siodb {
+}  // namespace siodb
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ColumnDataType_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ColumnDataType_2eproto = nullptr;
+const uint32_t TableStruct_ColumnDataType_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_ColumnDataType_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024ColumnDataType.proto\022\005siodb*\250\006\n\016Column"
+  "DataType\022\031\n\025COLUMN_DATA_TYPE_BOOL\020\000\022\031\n\025C"
+  "OLUMN_DATA_TYPE_INT8\020\001\022\032\n\026COLUMN_DATA_TY"
+  "PE_UINT8\020\002\022\032\n\026COLUMN_DATA_TYPE_INT16\020\003\022\033"
+  "\n\027COLUMN_DATA_TYPE_UINT16\020\004\022\032\n\026COLUMN_DA"
+  "TA_TYPE_INT32\020\005\022\033\n\027COLUMN_DATA_TYPE_UINT"
+  "32\020\006\022\032\n\026COLUMN_DATA_TYPE_INT64\020\007\022\033\n\027COLU"
+  "MN_DATA_TYPE_UINT64\020\010\022\032\n\026COLUMN_DATA_TYP"
+  "E_FLOAT\020\t\022\033\n\027COLUMN_DATA_TYPE_DOUBLE\020\n\022\031"
+  "\n\025COLUMN_DATA_TYPE_TEXT\020\013\022\032\n\026COLUMN_DATA"
+  "_TYPE_NTEXT\020\014\022\033\n\027COLUMN_DATA_TYPE_BINARY"
+  "\020\r\022\031\n\025COLUMN_DATA_TYPE_DATE\020\016\022\031\n\025COLUMN_"
+  "DATA_TYPE_TIME\020\017\022!\n\035COLUMN_DATA_TYPE_TIM"
+  "E_WITH_TZ\020\020\022\036\n\032COLUMN_DATA_TYPE_TIMESTAM"
+  "P\020\021\022&\n\"COLUMN_DATA_TYPE_TIMESTAMP_WITH_T"
+  "Z\020\022\022\"\n\036COLUMN_DATA_TYPE_DATE_INTERVAL\020\023\022"
+  "\"\n\036COLUMN_DATA_TYPE_TIME_INTERVAL\020\024\022\033\n\027C"
+  "OLUMN_DATA_TYPE_STRUCT\020\025\022\030\n\024COLUMN_DATA_"
+  "TYPE_XML\020\026\022\031\n\025COLUMN_DATA_TYPE_JSON\020\027\022\031\n"
+  "\025COLUMN_DATA_TYPE_UUID\020\030\022\030\n\024COLUMN_DATA_"
+  "TYPE_MAX\020\031\022\034\n\030COLUMN_DATA_TYPE_UNKNOWN\020\177"
+  "B\002H\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_ColumnDataType_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ColumnDataType_2eproto = {
+    false, false, 852, descriptor_table_protodef_ColumnDataType_2eproto,
+    "ColumnDataType.proto",
+    &descriptor_table_ColumnDataType_2eproto_once, nullptr, 0, 0,
+    schemas, file_default_instances, TableStruct_ColumnDataType_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_ColumnDataType_2eproto,
+    file_level_service_descriptors_ColumnDataType_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ColumnDataType_2eproto_getter() {
+  return &descriptor_table_ColumnDataType_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ColumnDataType_2eproto(&descriptor_table_ColumnDataType_2eproto);
+namespace siodb {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ColumnDataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ColumnDataType_2eproto);
+  return file_level_enum_descriptors_ColumnDataType_2eproto[0];
+}
+bool ColumnDataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 127:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,133 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ColumnDataType.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ColumnDataType_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ColumnDataType_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ColumnDataType_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ColumnDataType_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ColumnDataType_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace siodb {
+
+enum ColumnDataType : int {
+  COLUMN_DATA_TYPE_BOOL = 0,
+  COLUMN_DATA_TYPE_INT8 = 1,
+  COLUMN_DATA_TYPE_UINT8 = 2,
+  COLUMN_DATA_TYPE_INT16 = 3,
+  COLUMN_DATA_TYPE_UINT16 = 4,
+  COLUMN_DATA_TYPE_INT32 = 5,
+  COLUMN_DATA_TYPE_UINT32 = 6,
+  COLUMN_DATA_TYPE_INT64 = 7,
+  COLUMN_DATA_TYPE_UINT64 = 8,
+  COLUMN_DATA_TYPE_FLOAT = 9,
+  COLUMN_DATA_TYPE_DOUBLE = 10,
+  COLUMN_DATA_TYPE_TEXT = 11,
+  COLUMN_DATA_TYPE_NTEXT = 12,
+  COLUMN_DATA_TYPE_BINARY = 13,
+  COLUMN_DATA_TYPE_DATE = 14,
+  COLUMN_DATA_TYPE_TIME = 15,
+  COLUMN_DATA_TYPE_TIME_WITH_TZ = 16,
+  COLUMN_DATA_TYPE_TIMESTAMP = 17,
+  COLUMN_DATA_TYPE_TIMESTAMP_WITH_TZ = 18,
+  COLUMN_DATA_TYPE_DATE_INTERVAL = 19,
+  COLUMN_DATA_TYPE_TIME_INTERVAL = 20,
+  COLUMN_DATA_TYPE_STRUCT = 21,
+  COLUMN_DATA_TYPE_XML = 22,
+  COLUMN_DATA_TYPE_JSON = 23,
+  COLUMN_DATA_TYPE_UUID = 24,
+  COLUMN_DATA_TYPE_MAX = 25,
+  COLUMN_DATA_TYPE_UNKNOWN = 127,
+  ColumnDataType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ColumnDataType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ColumnDataType_IsValid(int value);
+constexpr ColumnDataType ColumnDataType_MIN = COLUMN_DATA_TYPE_BOOL;
+constexpr ColumnDataType ColumnDataType_MAX = COLUMN_DATA_TYPE_UNKNOWN;
+constexpr int ColumnDataType_ARRAYSIZE = ColumnDataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ColumnDataType_descriptor();
+template<typename T>
+inline const std::string& ColumnDataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ColumnDataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ColumnDataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ColumnDataType_descriptor(), enum_t_value);
+}
+inline bool ColumnDataType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ColumnDataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ColumnDataType>(
+    ColumnDataType_descriptor(), name, value);
+}
+// ===================================================================
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace siodb
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::siodb::ColumnDataType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::siodb::ColumnDataType>() {
+  return ::siodb::ColumnDataType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ColumnDataType_2eproto
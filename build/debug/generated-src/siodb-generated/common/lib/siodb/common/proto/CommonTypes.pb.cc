@@ -0,0 +1,1485 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CommonTypes.proto
+
+#include "CommonTypes.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace siodb {
+PROTOBUF_CONSTEXPR StatusMessage::StatusMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatusMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatusMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatusMessageDefaultTypeInternal() {}
+  union {
+    StatusMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatusMessageDefaultTypeInternal _StatusMessage_default_instance_;
+PROTOBUF_CONSTEXPR AttributeDescription::AttributeDescription(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.attribute_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.is_null_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AttributeDescriptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AttributeDescriptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AttributeDescriptionDefaultTypeInternal() {}
+  union {
+    AttributeDescription _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AttributeDescriptionDefaultTypeInternal _AttributeDescription_default_instance_;
+PROTOBUF_CONSTEXPR ColumnDescription::ColumnDescription(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.attribute_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.is_null_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ColumnDescriptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ColumnDescriptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ColumnDescriptionDefaultTypeInternal() {}
+  union {
+    ColumnDescription _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ColumnDescriptionDefaultTypeInternal _ColumnDescription_default_instance_;
+PROTOBUF_CONSTEXPR TypedValue::TypedValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct TypedValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TypedValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TypedValueDefaultTypeInternal() {}
+  union {
+    TypedValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TypedValueDefaultTypeInternal _TypedValue_default_instance_;
+}  // namespace siodb
+static ::_pb::Metadata file_level_metadata_CommonTypes_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_CommonTypes_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_CommonTypes_2eproto = nullptr;
+
+const uint32_t TableStruct_CommonTypes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::StatusMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::StatusMessage, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::siodb::StatusMessage, _impl_.text_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::AttributeDescription, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::AttributeDescription, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::siodb::AttributeDescription, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::siodb::AttributeDescription, _impl_.is_null_),
+  PROTOBUF_FIELD_OFFSET(::siodb::AttributeDescription, _impl_.attribute_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::ColumnDescription, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::ColumnDescription, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::siodb::ColumnDescription, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::siodb::ColumnDescription, _impl_.is_null_),
+  PROTOBUF_FIELD_OFFSET(::siodb::ColumnDescription, _impl_.attribute_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::TypedValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::siodb::TypedValue, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::siodb::TypedValue, _impl_.value_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::siodb::StatusMessage)},
+  { 8, -1, -1, sizeof(::siodb::AttributeDescription)},
+  { 18, -1, -1, sizeof(::siodb::ColumnDescription)},
+  { 28, -1, -1, sizeof(::siodb::TypedValue)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::siodb::_StatusMessage_default_instance_._instance,
+  &::siodb::_AttributeDescription_default_instance_._instance,
+  &::siodb::_ColumnDescription_default_instance_._instance,
+  &::siodb::_TypedValue_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_CommonTypes_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021CommonTypes.proto\022\005siodb\032\024ColumnDataTy"
+  "pe.proto\"2\n\rStatusMessage\022\023\n\013status_code"
+  "\030\001 \001(\005\022\014\n\004text\030\002 \001(\t\"\212\001\n\024AttributeDescri"
+  "ption\022\014\n\004name\030\001 \001(\t\022#\n\004type\030\002 \001(\0162\025.siod"
+  "b.ColumnDataType\022\017\n\007is_null\030\003 \001(\010\022.\n\tatt"
+  "ribute\030\004 \003(\0132\033.siodb.AttributeDescriptio"
+  "n\"\207\001\n\021ColumnDescription\022\014\n\004name\030\001 \001(\t\022#\n"
+  "\004type\030\002 \001(\0162\025.siodb.ColumnDataType\022\017\n\007is"
+  "_null\030\003 \001(\010\022.\n\tattribute\030\004 \003(\0132\033.siodb.A"
+  "ttributeDescription\"\313\001\n\nTypedValue\022\024\n\nnu"
+  "ll_value\030\001 \001(\010H\000\022\024\n\nbool_value\030\002 \001(\010H\000\022\023"
+  "\n\tint_value\030\003 \001(\022H\000\022\024\n\nuint_value\030\004 \001(\004H"
+  "\000\022\025\n\013float_value\030\005 \001(\002H\000\022\026\n\014double_value"
+  "\030\006 \001(\001H\000\022\026\n\014string_value\030\007 \001(\tH\000\022\026\n\014bina"
+  "ry_value\030\010 \001(\014H\000B\007\n\005valueB\002H\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_CommonTypes_2eproto_deps[1] = {
+  &::descriptor_table_ColumnDataType_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_CommonTypes_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_CommonTypes_2eproto = {
+    false, false, 597, descriptor_table_protodef_CommonTypes_2eproto,
+    "CommonTypes.proto",
+    &descriptor_table_CommonTypes_2eproto_once, descriptor_table_CommonTypes_2eproto_deps, 1, 4,
+    schemas, file_default_instances, TableStruct_CommonTypes_2eproto::offsets,
+    file_level_metadata_CommonTypes_2eproto, file_level_enum_descriptors_CommonTypes_2eproto,
+    file_level_service_descriptors_CommonTypes_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_CommonTypes_2eproto_getter() {
+  return &descriptor_table_CommonTypes_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_CommonTypes_2eproto(&descriptor_table_CommonTypes_2eproto);
+namespace siodb {
+
+// ===================================================================
+
+class StatusMessage::_Internal {
+ public:
+};
+
+StatusMessage::StatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.StatusMessage)
+}
+StatusMessage::StatusMessage(const StatusMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatusMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.status_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_code_ = from._impl_.status_code_;
+  // @@protoc_insertion_point(copy_constructor:siodb.StatusMessage)
+}
+
+inline void StatusMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.status_code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StatusMessage::~StatusMessage() {
+  // @@protoc_insertion_point(destructor:siodb.StatusMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatusMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void StatusMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatusMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.StatusMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.text_.ClearToEmpty();
+  _impl_.status_code_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatusMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 status_code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.status_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.StatusMessage.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatusMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.StatusMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 status_code = 1;
+  if (this->_internal_status_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_status_code(), target);
+  }
+
+  // string text = 2;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.StatusMessage.text");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.StatusMessage)
+  return target;
+}
+
+size_t StatusMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.StatusMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string text = 2;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  // int32 status_code = 1;
+  if (this->_internal_status_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_status_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatusMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatusMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatusMessage::GetClassData() const { return &_class_data_; }
+
+
+void StatusMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatusMessage*>(&to_msg);
+  auto& from = static_cast<const StatusMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.StatusMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatusMessage::CopyFrom(const StatusMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.StatusMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatusMessage::IsInitialized() const {
+  return true;
+}
+
+void StatusMessage::InternalSwap(StatusMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  swap(_impl_.status_code_, other->_impl_.status_code_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatusMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CommonTypes_2eproto_getter, &descriptor_table_CommonTypes_2eproto_once,
+      file_level_metadata_CommonTypes_2eproto[0]);
+}
+
+// ===================================================================
+
+class AttributeDescription::_Internal {
+ public:
+};
+
+AttributeDescription::AttributeDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.AttributeDescription)
+}
+AttributeDescription::AttributeDescription(const AttributeDescription& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AttributeDescription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attribute_){from._impl_.attribute_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.is_null_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_null_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.is_null_));
+  // @@protoc_insertion_point(copy_constructor:siodb.AttributeDescription)
+}
+
+inline void AttributeDescription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attribute_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.is_null_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AttributeDescription::~AttributeDescription() {
+  // @@protoc_insertion_point(destructor:siodb.AttributeDescription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AttributeDescription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attribute_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void AttributeDescription::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AttributeDescription::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.AttributeDescription)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.attribute_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_null_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.is_null_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AttributeDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.AttributeDescription.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.ColumnDataType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::siodb::ColumnDataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_null = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.is_null_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.AttributeDescription attribute = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_attribute(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AttributeDescription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.AttributeDescription)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.AttributeDescription.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .siodb.ColumnDataType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // bool is_null = 3;
+  if (this->_internal_is_null() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_null(), target);
+  }
+
+  // repeated .siodb.AttributeDescription attribute = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_attribute_size()); i < n; i++) {
+    const auto& repfield = this->_internal_attribute(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.AttributeDescription)
+  return target;
+}
+
+size_t AttributeDescription::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.AttributeDescription)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.AttributeDescription attribute = 4;
+  total_size += 1UL * this->_internal_attribute_size();
+  for (const auto& msg : this->_impl_.attribute_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .siodb.ColumnDataType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // bool is_null = 3;
+  if (this->_internal_is_null() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AttributeDescription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AttributeDescription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AttributeDescription::GetClassData() const { return &_class_data_; }
+
+
+void AttributeDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AttributeDescription*>(&to_msg);
+  auto& from = static_cast<const AttributeDescription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.AttributeDescription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.attribute_.MergeFrom(from._impl_.attribute_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_is_null() != 0) {
+    _this->_internal_set_is_null(from._internal_is_null());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AttributeDescription::CopyFrom(const AttributeDescription& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.AttributeDescription)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AttributeDescription::IsInitialized() const {
+  return true;
+}
+
+void AttributeDescription::InternalSwap(AttributeDescription* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.attribute_.InternalSwap(&other->_impl_.attribute_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AttributeDescription, _impl_.is_null_)
+      + sizeof(AttributeDescription::_impl_.is_null_)
+      - PROTOBUF_FIELD_OFFSET(AttributeDescription, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AttributeDescription::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CommonTypes_2eproto_getter, &descriptor_table_CommonTypes_2eproto_once,
+      file_level_metadata_CommonTypes_2eproto[1]);
+}
+
+// ===================================================================
+
+class ColumnDescription::_Internal {
+ public:
+};
+
+ColumnDescription::ColumnDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.ColumnDescription)
+}
+ColumnDescription::ColumnDescription(const ColumnDescription& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ColumnDescription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attribute_){from._impl_.attribute_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.is_null_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_null_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.is_null_));
+  // @@protoc_insertion_point(copy_constructor:siodb.ColumnDescription)
+}
+
+inline void ColumnDescription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attribute_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.is_null_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ColumnDescription::~ColumnDescription() {
+  // @@protoc_insertion_point(destructor:siodb.ColumnDescription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ColumnDescription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attribute_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void ColumnDescription::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ColumnDescription::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.ColumnDescription)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.attribute_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_null_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.is_null_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ColumnDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.ColumnDescription.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.ColumnDataType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::siodb::ColumnDataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_null = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.is_null_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.AttributeDescription attribute = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_attribute(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ColumnDescription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.ColumnDescription)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.ColumnDescription.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .siodb.ColumnDataType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // bool is_null = 3;
+  if (this->_internal_is_null() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_null(), target);
+  }
+
+  // repeated .siodb.AttributeDescription attribute = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_attribute_size()); i < n; i++) {
+    const auto& repfield = this->_internal_attribute(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.ColumnDescription)
+  return target;
+}
+
+size_t ColumnDescription::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.ColumnDescription)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.AttributeDescription attribute = 4;
+  total_size += 1UL * this->_internal_attribute_size();
+  for (const auto& msg : this->_impl_.attribute_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .siodb.ColumnDataType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // bool is_null = 3;
+  if (this->_internal_is_null() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ColumnDescription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ColumnDescription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ColumnDescription::GetClassData() const { return &_class_data_; }
+
+
+void ColumnDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ColumnDescription*>(&to_msg);
+  auto& from = static_cast<const ColumnDescription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.ColumnDescription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.attribute_.MergeFrom(from._impl_.attribute_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_is_null() != 0) {
+    _this->_internal_set_is_null(from._internal_is_null());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ColumnDescription::CopyFrom(const ColumnDescription& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.ColumnDescription)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ColumnDescription::IsInitialized() const {
+  return true;
+}
+
+void ColumnDescription::InternalSwap(ColumnDescription* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.attribute_.InternalSwap(&other->_impl_.attribute_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ColumnDescription, _impl_.is_null_)
+      + sizeof(ColumnDescription::_impl_.is_null_)
+      - PROTOBUF_FIELD_OFFSET(ColumnDescription, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ColumnDescription::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CommonTypes_2eproto_getter, &descriptor_table_CommonTypes_2eproto_once,
+      file_level_metadata_CommonTypes_2eproto[2]);
+}
+
+// ===================================================================
+
+class TypedValue::_Internal {
+ public:
+};
+
+TypedValue::TypedValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.TypedValue)
+}
+TypedValue::TypedValue(const TypedValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TypedValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_value();
+  switch (from.value_case()) {
+    case kNullValue: {
+      _this->_internal_set_null_value(from._internal_null_value());
+      break;
+    }
+    case kBoolValue: {
+      _this->_internal_set_bool_value(from._internal_bool_value());
+      break;
+    }
+    case kIntValue: {
+      _this->_internal_set_int_value(from._internal_int_value());
+      break;
+    }
+    case kUintValue: {
+      _this->_internal_set_uint_value(from._internal_uint_value());
+      break;
+    }
+    case kFloatValue: {
+      _this->_internal_set_float_value(from._internal_float_value());
+      break;
+    }
+    case kDoubleValue: {
+      _this->_internal_set_double_value(from._internal_double_value());
+      break;
+    }
+    case kStringValue: {
+      _this->_internal_set_string_value(from._internal_string_value());
+      break;
+    }
+    case kBinaryValue: {
+      _this->_internal_set_binary_value(from._internal_binary_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:siodb.TypedValue)
+}
+
+inline void TypedValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_value();
+}
+
+TypedValue::~TypedValue() {
+  // @@protoc_insertion_point(destructor:siodb.TypedValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TypedValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void TypedValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TypedValue::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:siodb.TypedValue)
+  switch (value_case()) {
+    case kNullValue: {
+      // No need to clear
+      break;
+    }
+    case kBoolValue: {
+      // No need to clear
+      break;
+    }
+    case kIntValue: {
+      // No need to clear
+      break;
+    }
+    case kUintValue: {
+      // No need to clear
+      break;
+    }
+    case kFloatValue: {
+      // No need to clear
+      break;
+    }
+    case kDoubleValue: {
+      // No need to clear
+      break;
+    }
+    case kStringValue: {
+      _impl_.value_.string_value_.Destroy();
+      break;
+    }
+    case kBinaryValue: {
+      _impl_.value_.binary_value_.Destroy();
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void TypedValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.TypedValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TypedValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool null_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _internal_set_null_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool bool_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _internal_set_bool_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 int_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _internal_set_int_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 uint_value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _internal_set_uint_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float float_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _internal_set_float_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // double double_value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _internal_set_double_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string string_value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_string_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.TypedValue.string_value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes binary_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_binary_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TypedValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.TypedValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool null_value = 1;
+  if (_internal_has_null_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_null_value(), target);
+  }
+
+  // bool bool_value = 2;
+  if (_internal_has_bool_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_bool_value(), target);
+  }
+
+  // sint64 int_value = 3;
+  if (_internal_has_int_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(3, this->_internal_int_value(), target);
+  }
+
+  // uint64 uint_value = 4;
+  if (_internal_has_uint_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_uint_value(), target);
+  }
+
+  // float float_value = 5;
+  if (_internal_has_float_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_float_value(), target);
+  }
+
+  // double double_value = 6;
+  if (_internal_has_double_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_double_value(), target);
+  }
+
+  // string string_value = 7;
+  if (_internal_has_string_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_string_value().data(), static_cast<int>(this->_internal_string_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.TypedValue.string_value");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_string_value(), target);
+  }
+
+  // bytes binary_value = 8;
+  if (_internal_has_binary_value()) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_binary_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.TypedValue)
+  return target;
+}
+
+size_t TypedValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.TypedValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (value_case()) {
+    // bool null_value = 1;
+    case kNullValue: {
+      total_size += 1 + 1;
+      break;
+    }
+    // bool bool_value = 2;
+    case kBoolValue: {
+      total_size += 1 + 1;
+      break;
+    }
+    // sint64 int_value = 3;
+    case kIntValue: {
+      total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_int_value());
+      break;
+    }
+    // uint64 uint_value = 4;
+    case kUintValue: {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_uint_value());
+      break;
+    }
+    // float float_value = 5;
+    case kFloatValue: {
+      total_size += 1 + 4;
+      break;
+    }
+    // double double_value = 6;
+    case kDoubleValue: {
+      total_size += 1 + 8;
+      break;
+    }
+    // string string_value = 7;
+    case kStringValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_string_value());
+      break;
+    }
+    // bytes binary_value = 8;
+    case kBinaryValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_binary_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TypedValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TypedValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TypedValue::GetClassData() const { return &_class_data_; }
+
+
+void TypedValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TypedValue*>(&to_msg);
+  auto& from = static_cast<const TypedValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.TypedValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.value_case()) {
+    case kNullValue: {
+      _this->_internal_set_null_value(from._internal_null_value());
+      break;
+    }
+    case kBoolValue: {
+      _this->_internal_set_bool_value(from._internal_bool_value());
+      break;
+    }
+    case kIntValue: {
+      _this->_internal_set_int_value(from._internal_int_value());
+      break;
+    }
+    case kUintValue: {
+      _this->_internal_set_uint_value(from._internal_uint_value());
+      break;
+    }
+    case kFloatValue: {
+      _this->_internal_set_float_value(from._internal_float_value());
+      break;
+    }
+    case kDoubleValue: {
+      _this->_internal_set_double_value(from._internal_double_value());
+      break;
+    }
+    case kStringValue: {
+      _this->_internal_set_string_value(from._internal_string_value());
+      break;
+    }
+    case kBinaryValue: {
+      _this->_internal_set_binary_value(from._internal_binary_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TypedValue::CopyFrom(const TypedValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.TypedValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TypedValue::IsInitialized() const {
+  return true;
+}
+
+void TypedValue::InternalSwap(TypedValue* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TypedValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CommonTypes_2eproto_getter, &descriptor_table_CommonTypes_2eproto_once,
+      file_level_metadata_CommonTypes_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::siodb::StatusMessage*
+Arena::CreateMaybeMessage< ::siodb::StatusMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::StatusMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::AttributeDescription*
+Arena::CreateMaybeMessage< ::siodb::AttributeDescription >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::AttributeDescription >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::ColumnDescription*
+Arena::CreateMaybeMessage< ::siodb::ColumnDescription >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::ColumnDescription >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::TypedValue*
+Arena::CreateMaybeMessage< ::siodb::TypedValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::TypedValue >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1683 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CommonTypes.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_CommonTypes_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_CommonTypes_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "ColumnDataType.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_CommonTypes_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_CommonTypes_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_CommonTypes_2eproto;
+namespace siodb {
+class AttributeDescription;
+struct AttributeDescriptionDefaultTypeInternal;
+extern AttributeDescriptionDefaultTypeInternal _AttributeDescription_default_instance_;
+class ColumnDescription;
+struct ColumnDescriptionDefaultTypeInternal;
+extern ColumnDescriptionDefaultTypeInternal _ColumnDescription_default_instance_;
+class StatusMessage;
+struct StatusMessageDefaultTypeInternal;
+extern StatusMessageDefaultTypeInternal _StatusMessage_default_instance_;
+class TypedValue;
+struct TypedValueDefaultTypeInternal;
+extern TypedValueDefaultTypeInternal _TypedValue_default_instance_;
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::siodb::AttributeDescription* Arena::CreateMaybeMessage<::siodb::AttributeDescription>(Arena*);
+template<> ::siodb::ColumnDescription* Arena::CreateMaybeMessage<::siodb::ColumnDescription>(Arena*);
+template<> ::siodb::StatusMessage* Arena::CreateMaybeMessage<::siodb::StatusMessage>(Arena*);
+template<> ::siodb::TypedValue* Arena::CreateMaybeMessage<::siodb::TypedValue>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace siodb {
+
+// ===================================================================
+
+class StatusMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.StatusMessage) */ {
+ public:
+  inline StatusMessage() : StatusMessage(nullptr) {}
+  ~StatusMessage() override;
+  explicit PROTOBUF_CONSTEXPR StatusMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatusMessage(const StatusMessage& from);
+  StatusMessage(StatusMessage&& from) noexcept
+    : StatusMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline StatusMessage& operator=(const StatusMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatusMessage& operator=(StatusMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatusMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatusMessage* internal_default_instance() {
+    return reinterpret_cast<const StatusMessage*>(
+               &_StatusMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(StatusMessage& a, StatusMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatusMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatusMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatusMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatusMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatusMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatusMessage& from) {
+    StatusMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatusMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.StatusMessage";
+  }
+  protected:
+  explicit StatusMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextFieldNumber = 2,
+    kStatusCodeFieldNumber = 1,
+  };
+  // string text = 2;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // int32 status_code = 1;
+  void clear_status_code();
+  int32_t status_code() const;
+  void set_status_code(int32_t value);
+  private:
+  int32_t _internal_status_code() const;
+  void _internal_set_status_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.StatusMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    int32_t status_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_CommonTypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AttributeDescription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.AttributeDescription) */ {
+ public:
+  inline AttributeDescription() : AttributeDescription(nullptr) {}
+  ~AttributeDescription() override;
+  explicit PROTOBUF_CONSTEXPR AttributeDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AttributeDescription(const AttributeDescription& from);
+  AttributeDescription(AttributeDescription&& from) noexcept
+    : AttributeDescription() {
+    *this = ::std::move(from);
+  }
+
+  inline AttributeDescription& operator=(const AttributeDescription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AttributeDescription& operator=(AttributeDescription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AttributeDescription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AttributeDescription* internal_default_instance() {
+    return reinterpret_cast<const AttributeDescription*>(
+               &_AttributeDescription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(AttributeDescription& a, AttributeDescription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AttributeDescription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AttributeDescription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AttributeDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AttributeDescription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AttributeDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AttributeDescription& from) {
+    AttributeDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AttributeDescription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.AttributeDescription";
+  }
+  protected:
+  explicit AttributeDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttributeFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kIsNullFieldNumber = 3,
+  };
+  // repeated .siodb.AttributeDescription attribute = 4;
+  int attribute_size() const;
+  private:
+  int _internal_attribute_size() const;
+  public:
+  void clear_attribute();
+  ::siodb::AttributeDescription* mutable_attribute(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >*
+      mutable_attribute();
+  private:
+  const ::siodb::AttributeDescription& _internal_attribute(int index) const;
+  ::siodb::AttributeDescription* _internal_add_attribute();
+  public:
+  const ::siodb::AttributeDescription& attribute(int index) const;
+  ::siodb::AttributeDescription* add_attribute();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >&
+      attribute() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .siodb.ColumnDataType type = 2;
+  void clear_type();
+  ::siodb::ColumnDataType type() const;
+  void set_type(::siodb::ColumnDataType value);
+  private:
+  ::siodb::ColumnDataType _internal_type() const;
+  void _internal_set_type(::siodb::ColumnDataType value);
+  public:
+
+  // bool is_null = 3;
+  void clear_is_null();
+  bool is_null() const;
+  void set_is_null(bool value);
+  private:
+  bool _internal_is_null() const;
+  void _internal_set_is_null(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.AttributeDescription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription > attribute_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+    bool is_null_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_CommonTypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ColumnDescription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.ColumnDescription) */ {
+ public:
+  inline ColumnDescription() : ColumnDescription(nullptr) {}
+  ~ColumnDescription() override;
+  explicit PROTOBUF_CONSTEXPR ColumnDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ColumnDescription(const ColumnDescription& from);
+  ColumnDescription(ColumnDescription&& from) noexcept
+    : ColumnDescription() {
+    *this = ::std::move(from);
+  }
+
+  inline ColumnDescription& operator=(const ColumnDescription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ColumnDescription& operator=(ColumnDescription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ColumnDescription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ColumnDescription* internal_default_instance() {
+    return reinterpret_cast<const ColumnDescription*>(
+               &_ColumnDescription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ColumnDescription& a, ColumnDescription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ColumnDescription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ColumnDescription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ColumnDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ColumnDescription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ColumnDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ColumnDescription& from) {
+    ColumnDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ColumnDescription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.ColumnDescription";
+  }
+  protected:
+  explicit ColumnDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttributeFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kIsNullFieldNumber = 3,
+  };
+  // repeated .siodb.AttributeDescription attribute = 4;
+  int attribute_size() const;
+  private:
+  int _internal_attribute_size() const;
+  public:
+  void clear_attribute();
+  ::siodb::AttributeDescription* mutable_attribute(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >*
+      mutable_attribute();
+  private:
+  const ::siodb::AttributeDescription& _internal_attribute(int index) const;
+  ::siodb::AttributeDescription* _internal_add_attribute();
+  public:
+  const ::siodb::AttributeDescription& attribute(int index) const;
+  ::siodb::AttributeDescription* add_attribute();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >&
+      attribute() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .siodb.ColumnDataType type = 2;
+  void clear_type();
+  ::siodb::ColumnDataType type() const;
+  void set_type(::siodb::ColumnDataType value);
+  private:
+  ::siodb::ColumnDataType _internal_type() const;
+  void _internal_set_type(::siodb::ColumnDataType value);
+  public:
+
+  // bool is_null = 3;
+  void clear_is_null();
+  bool is_null() const;
+  void set_is_null(bool value);
+  private:
+  bool _internal_is_null() const;
+  void _internal_set_is_null(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.ColumnDescription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription > attribute_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+    bool is_null_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_CommonTypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TypedValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.TypedValue) */ {
+ public:
+  inline TypedValue() : TypedValue(nullptr) {}
+  ~TypedValue() override;
+  explicit PROTOBUF_CONSTEXPR TypedValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TypedValue(const TypedValue& from);
+  TypedValue(TypedValue&& from) noexcept
+    : TypedValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TypedValue& operator=(const TypedValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TypedValue& operator=(TypedValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TypedValue& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ValueCase {
+    kNullValue = 1,
+    kBoolValue = 2,
+    kIntValue = 3,
+    kUintValue = 4,
+    kFloatValue = 5,
+    kDoubleValue = 6,
+    kStringValue = 7,
+    kBinaryValue = 8,
+    VALUE_NOT_SET = 0,
+  };
+
+  static inline const TypedValue* internal_default_instance() {
+    return reinterpret_cast<const TypedValue*>(
+               &_TypedValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TypedValue& a, TypedValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TypedValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TypedValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TypedValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TypedValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TypedValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TypedValue& from) {
+    TypedValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TypedValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.TypedValue";
+  }
+  protected:
+  explicit TypedValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNullValueFieldNumber = 1,
+    kBoolValueFieldNumber = 2,
+    kIntValueFieldNumber = 3,
+    kUintValueFieldNumber = 4,
+    kFloatValueFieldNumber = 5,
+    kDoubleValueFieldNumber = 6,
+    kStringValueFieldNumber = 7,
+    kBinaryValueFieldNumber = 8,
+  };
+  // bool null_value = 1;
+  bool has_null_value() const;
+  private:
+  bool _internal_has_null_value() const;
+  public:
+  void clear_null_value();
+  bool null_value() const;
+  void set_null_value(bool value);
+  private:
+  bool _internal_null_value() const;
+  void _internal_set_null_value(bool value);
+  public:
+
+  // bool bool_value = 2;
+  bool has_bool_value() const;
+  private:
+  bool _internal_has_bool_value() const;
+  public:
+  void clear_bool_value();
+  bool bool_value() const;
+  void set_bool_value(bool value);
+  private:
+  bool _internal_bool_value() const;
+  void _internal_set_bool_value(bool value);
+  public:
+
+  // sint64 int_value = 3;
+  bool has_int_value() const;
+  private:
+  bool _internal_has_int_value() const;
+  public:
+  void clear_int_value();
+  int64_t int_value() const;
+  void set_int_value(int64_t value);
+  private:
+  int64_t _internal_int_value() const;
+  void _internal_set_int_value(int64_t value);
+  public:
+
+  // uint64 uint_value = 4;
+  bool has_uint_value() const;
+  private:
+  bool _internal_has_uint_value() const;
+  public:
+  void clear_uint_value();
+  uint64_t uint_value() const;
+  void set_uint_value(uint64_t value);
+  private:
+  uint64_t _internal_uint_value() const;
+  void _internal_set_uint_value(uint64_t value);
+  public:
+
+  // float float_value = 5;
+  bool has_float_value() const;
+  private:
+  bool _internal_has_float_value() const;
+  public:
+  void clear_float_value();
+  float float_value() const;
+  void set_float_value(float value);
+  private:
+  float _internal_float_value() const;
+  void _internal_set_float_value(float value);
+  public:
+
+  // double double_value = 6;
+  bool has_double_value() const;
+  private:
+  bool _internal_has_double_value() const;
+  public:
+  void clear_double_value();
+  double double_value() const;
+  void set_double_value(double value);
+  private:
+  double _internal_double_value() const;
+  void _internal_set_double_value(double value);
+  public:
+
+  // string string_value = 7;
+  bool has_string_value() const;
+  private:
+  bool _internal_has_string_value() const;
+  public:
+  void clear_string_value();
+  const std::string& string_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_value();
+  PROTOBUF_NODISCARD std::string* release_string_value();
+  void set_allocated_string_value(std::string* string_value);
+  private:
+  const std::string& _internal_string_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(const std::string& value);
+  std::string* _internal_mutable_string_value();
+  public:
+
+  // bytes binary_value = 8;
+  bool has_binary_value() const;
+  private:
+  bool _internal_has_binary_value() const;
+  public:
+  void clear_binary_value();
+  const std::string& binary_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_binary_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binary_value();
+  PROTOBUF_NODISCARD std::string* release_binary_value();
+  void set_allocated_binary_value(std::string* binary_value);
+  private:
+  const std::string& _internal_binary_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binary_value(const std::string& value);
+  std::string* _internal_mutable_binary_value();
+  public:
+
+  void clear_value();
+  ValueCase value_case() const;
+  // @@protoc_insertion_point(class_scope:siodb.TypedValue)
+ private:
+  class _Internal;
+  void set_has_null_value();
+  void set_has_bool_value();
+  void set_has_int_value();
+  void set_has_uint_value();
+  void set_has_float_value();
+  void set_has_double_value();
+  void set_has_string_value();
+  void set_has_binary_value();
+
+  inline bool has_value() const;
+  inline void clear_has_value();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      bool null_value_;
+      bool bool_value_;
+      int64_t int_value_;
+      uint64_t uint_value_;
+      float float_value_;
+      double double_value_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_value_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binary_value_;
+    } value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_CommonTypes_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// StatusMessage
+
+// int32 status_code = 1;
+inline void StatusMessage::clear_status_code() {
+  _impl_.status_code_ = 0;
+}
+inline int32_t StatusMessage::_internal_status_code() const {
+  return _impl_.status_code_;
+}
+inline int32_t StatusMessage::status_code() const {
+  // @@protoc_insertion_point(field_get:siodb.StatusMessage.status_code)
+  return _internal_status_code();
+}
+inline void StatusMessage::_internal_set_status_code(int32_t value) {
+  
+  _impl_.status_code_ = value;
+}
+inline void StatusMessage::set_status_code(int32_t value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:siodb.StatusMessage.status_code)
+}
+
+// string text = 2;
+inline void StatusMessage::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& StatusMessage::text() const {
+  // @@protoc_insertion_point(field_get:siodb.StatusMessage.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatusMessage::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.StatusMessage.text)
+}
+inline std::string* StatusMessage::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:siodb.StatusMessage.text)
+  return _s;
+}
+inline const std::string& StatusMessage::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void StatusMessage::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StatusMessage::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatusMessage::release_text() {
+  // @@protoc_insertion_point(field_release:siodb.StatusMessage.text)
+  return _impl_.text_.Release();
+}
+inline void StatusMessage::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.StatusMessage.text)
+}
+
+// -------------------------------------------------------------------
+
+// AttributeDescription
+
+// string name = 1;
+inline void AttributeDescription::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& AttributeDescription::name() const {
+  // @@protoc_insertion_point(field_get:siodb.AttributeDescription.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttributeDescription::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.AttributeDescription.name)
+}
+inline std::string* AttributeDescription::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:siodb.AttributeDescription.name)
+  return _s;
+}
+inline const std::string& AttributeDescription::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void AttributeDescription::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AttributeDescription::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AttributeDescription::release_name() {
+  // @@protoc_insertion_point(field_release:siodb.AttributeDescription.name)
+  return _impl_.name_.Release();
+}
+inline void AttributeDescription::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.AttributeDescription.name)
+}
+
+// .siodb.ColumnDataType type = 2;
+inline void AttributeDescription::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::siodb::ColumnDataType AttributeDescription::_internal_type() const {
+  return static_cast< ::siodb::ColumnDataType >(_impl_.type_);
+}
+inline ::siodb::ColumnDataType AttributeDescription::type() const {
+  // @@protoc_insertion_point(field_get:siodb.AttributeDescription.type)
+  return _internal_type();
+}
+inline void AttributeDescription::_internal_set_type(::siodb::ColumnDataType value) {
+  
+  _impl_.type_ = value;
+}
+inline void AttributeDescription::set_type(::siodb::ColumnDataType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:siodb.AttributeDescription.type)
+}
+
+// bool is_null = 3;
+inline void AttributeDescription::clear_is_null() {
+  _impl_.is_null_ = false;
+}
+inline bool AttributeDescription::_internal_is_null() const {
+  return _impl_.is_null_;
+}
+inline bool AttributeDescription::is_null() const {
+  // @@protoc_insertion_point(field_get:siodb.AttributeDescription.is_null)
+  return _internal_is_null();
+}
+inline void AttributeDescription::_internal_set_is_null(bool value) {
+  
+  _impl_.is_null_ = value;
+}
+inline void AttributeDescription::set_is_null(bool value) {
+  _internal_set_is_null(value);
+  // @@protoc_insertion_point(field_set:siodb.AttributeDescription.is_null)
+}
+
+// repeated .siodb.AttributeDescription attribute = 4;
+inline int AttributeDescription::_internal_attribute_size() const {
+  return _impl_.attribute_.size();
+}
+inline int AttributeDescription::attribute_size() const {
+  return _internal_attribute_size();
+}
+inline void AttributeDescription::clear_attribute() {
+  _impl_.attribute_.Clear();
+}
+inline ::siodb::AttributeDescription* AttributeDescription::mutable_attribute(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.AttributeDescription.attribute)
+  return _impl_.attribute_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >*
+AttributeDescription::mutable_attribute() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.AttributeDescription.attribute)
+  return &_impl_.attribute_;
+}
+inline const ::siodb::AttributeDescription& AttributeDescription::_internal_attribute(int index) const {
+  return _impl_.attribute_.Get(index);
+}
+inline const ::siodb::AttributeDescription& AttributeDescription::attribute(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.AttributeDescription.attribute)
+  return _internal_attribute(index);
+}
+inline ::siodb::AttributeDescription* AttributeDescription::_internal_add_attribute() {
+  return _impl_.attribute_.Add();
+}
+inline ::siodb::AttributeDescription* AttributeDescription::add_attribute() {
+  ::siodb::AttributeDescription* _add = _internal_add_attribute();
+  // @@protoc_insertion_point(field_add:siodb.AttributeDescription.attribute)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >&
+AttributeDescription::attribute() const {
+  // @@protoc_insertion_point(field_list:siodb.AttributeDescription.attribute)
+  return _impl_.attribute_;
+}
+
+// -------------------------------------------------------------------
+
+// ColumnDescription
+
+// string name = 1;
+inline void ColumnDescription::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& ColumnDescription::name() const {
+  // @@protoc_insertion_point(field_get:siodb.ColumnDescription.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ColumnDescription::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.ColumnDescription.name)
+}
+inline std::string* ColumnDescription::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:siodb.ColumnDescription.name)
+  return _s;
+}
+inline const std::string& ColumnDescription::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ColumnDescription::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ColumnDescription::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ColumnDescription::release_name() {
+  // @@protoc_insertion_point(field_release:siodb.ColumnDescription.name)
+  return _impl_.name_.Release();
+}
+inline void ColumnDescription::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.ColumnDescription.name)
+}
+
+// .siodb.ColumnDataType type = 2;
+inline void ColumnDescription::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::siodb::ColumnDataType ColumnDescription::_internal_type() const {
+  return static_cast< ::siodb::ColumnDataType >(_impl_.type_);
+}
+inline ::siodb::ColumnDataType ColumnDescription::type() const {
+  // @@protoc_insertion_point(field_get:siodb.ColumnDescription.type)
+  return _internal_type();
+}
+inline void ColumnDescription::_internal_set_type(::siodb::ColumnDataType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ColumnDescription::set_type(::siodb::ColumnDataType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:siodb.ColumnDescription.type)
+}
+
+// bool is_null = 3;
+inline void ColumnDescription::clear_is_null() {
+  _impl_.is_null_ = false;
+}
+inline bool ColumnDescription::_internal_is_null() const {
+  return _impl_.is_null_;
+}
+inline bool ColumnDescription::is_null() const {
+  // @@protoc_insertion_point(field_get:siodb.ColumnDescription.is_null)
+  return _internal_is_null();
+}
+inline void ColumnDescription::_internal_set_is_null(bool value) {
+  
+  _impl_.is_null_ = value;
+}
+inline void ColumnDescription::set_is_null(bool value) {
+  _internal_set_is_null(value);
+  // @@protoc_insertion_point(field_set:siodb.ColumnDescription.is_null)
+}
+
+// repeated .siodb.AttributeDescription attribute = 4;
+inline int ColumnDescription::_internal_attribute_size() const {
+  return _impl_.attribute_.size();
+}
+inline int ColumnDescription::attribute_size() const {
+  return _internal_attribute_size();
+}
+inline void ColumnDescription::clear_attribute() {
+  _impl_.attribute_.Clear();
+}
+inline ::siodb::AttributeDescription* ColumnDescription::mutable_attribute(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.ColumnDescription.attribute)
+  return _impl_.attribute_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >*
+ColumnDescription::mutable_attribute() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.ColumnDescription.attribute)
+  return &_impl_.attribute_;
+}
+inline const ::siodb::AttributeDescription& ColumnDescription::_internal_attribute(int index) const {
+  return _impl_.attribute_.Get(index);
+}
+inline const ::siodb::AttributeDescription& ColumnDescription::attribute(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.ColumnDescription.attribute)
+  return _internal_attribute(index);
+}
+inline ::siodb::AttributeDescription* ColumnDescription::_internal_add_attribute() {
+  return _impl_.attribute_.Add();
+}
+inline ::siodb::AttributeDescription* ColumnDescription::add_attribute() {
+  ::siodb::AttributeDescription* _add = _internal_add_attribute();
+  // @@protoc_insertion_point(field_add:siodb.ColumnDescription.attribute)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::AttributeDescription >&
+ColumnDescription::attribute() const {
+  // @@protoc_insertion_point(field_list:siodb.ColumnDescription.attribute)
+  return _impl_.attribute_;
+}
+
+// -------------------------------------------------------------------
+
+// TypedValue
+
+// bool null_value = 1;
+inline bool TypedValue::_internal_has_null_value() const {
+  return value_case() == kNullValue;
+}
+inline bool TypedValue::has_null_value() const {
+  return _internal_has_null_value();
+}
+inline void TypedValue::set_has_null_value() {
+  _impl_._oneof_case_[0] = kNullValue;
+}
+inline void TypedValue::clear_null_value() {
+  if (_internal_has_null_value()) {
+    _impl_.value_.null_value_ = false;
+    clear_has_value();
+  }
+}
+inline bool TypedValue::_internal_null_value() const {
+  if (_internal_has_null_value()) {
+    return _impl_.value_.null_value_;
+  }
+  return false;
+}
+inline void TypedValue::_internal_set_null_value(bool value) {
+  if (!_internal_has_null_value()) {
+    clear_value();
+    set_has_null_value();
+  }
+  _impl_.value_.null_value_ = value;
+}
+inline bool TypedValue::null_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.null_value)
+  return _internal_null_value();
+}
+inline void TypedValue::set_null_value(bool value) {
+  _internal_set_null_value(value);
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.null_value)
+}
+
+// bool bool_value = 2;
+inline bool TypedValue::_internal_has_bool_value() const {
+  return value_case() == kBoolValue;
+}
+inline bool TypedValue::has_bool_value() const {
+  return _internal_has_bool_value();
+}
+inline void TypedValue::set_has_bool_value() {
+  _impl_._oneof_case_[0] = kBoolValue;
+}
+inline void TypedValue::clear_bool_value() {
+  if (_internal_has_bool_value()) {
+    _impl_.value_.bool_value_ = false;
+    clear_has_value();
+  }
+}
+inline bool TypedValue::_internal_bool_value() const {
+  if (_internal_has_bool_value()) {
+    return _impl_.value_.bool_value_;
+  }
+  return false;
+}
+inline void TypedValue::_internal_set_bool_value(bool value) {
+  if (!_internal_has_bool_value()) {
+    clear_value();
+    set_has_bool_value();
+  }
+  _impl_.value_.bool_value_ = value;
+}
+inline bool TypedValue::bool_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.bool_value)
+  return _internal_bool_value();
+}
+inline void TypedValue::set_bool_value(bool value) {
+  _internal_set_bool_value(value);
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.bool_value)
+}
+
+// sint64 int_value = 3;
+inline bool TypedValue::_internal_has_int_value() const {
+  return value_case() == kIntValue;
+}
+inline bool TypedValue::has_int_value() const {
+  return _internal_has_int_value();
+}
+inline void TypedValue::set_has_int_value() {
+  _impl_._oneof_case_[0] = kIntValue;
+}
+inline void TypedValue::clear_int_value() {
+  if (_internal_has_int_value()) {
+    _impl_.value_.int_value_ = int64_t{0};
+    clear_has_value();
+  }
+}
+inline int64_t TypedValue::_internal_int_value() const {
+  if (_internal_has_int_value()) {
+    return _impl_.value_.int_value_;
+  }
+  return int64_t{0};
+}
+inline void TypedValue::_internal_set_int_value(int64_t value) {
+  if (!_internal_has_int_value()) {
+    clear_value();
+    set_has_int_value();
+  }
+  _impl_.value_.int_value_ = value;
+}
+inline int64_t TypedValue::int_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.int_value)
+  return _internal_int_value();
+}
+inline void TypedValue::set_int_value(int64_t value) {
+  _internal_set_int_value(value);
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.int_value)
+}
+
+// uint64 uint_value = 4;
+inline bool TypedValue::_internal_has_uint_value() const {
+  return value_case() == kUintValue;
+}
+inline bool TypedValue::has_uint_value() const {
+  return _internal_has_uint_value();
+}
+inline void TypedValue::set_has_uint_value() {
+  _impl_._oneof_case_[0] = kUintValue;
+}
+inline void TypedValue::clear_uint_value() {
+  if (_internal_has_uint_value()) {
+    _impl_.value_.uint_value_ = uint64_t{0u};
+    clear_has_value();
+  }
+}
+inline uint64_t TypedValue::_internal_uint_value() const {
+  if (_internal_has_uint_value()) {
+    return _impl_.value_.uint_value_;
+  }
+  return uint64_t{0u};
+}
+inline void TypedValue::_internal_set_uint_value(uint64_t value) {
+  if (!_internal_has_uint_value()) {
+    clear_value();
+    set_has_uint_value();
+  }
+  _impl_.value_.uint_value_ = value;
+}
+inline uint64_t TypedValue::uint_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.uint_value)
+  return _internal_uint_value();
+}
+inline void TypedValue::set_uint_value(uint64_t value) {
+  _internal_set_uint_value(value);
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.uint_value)
+}
+
+// float float_value = 5;
+inline bool TypedValue::_internal_has_float_value() const {
+  return value_case() == kFloatValue;
+}
+inline bool TypedValue::has_float_value() const {
+  return _internal_has_float_value();
+}
+inline void TypedValue::set_has_float_value() {
+  _impl_._oneof_case_[0] = kFloatValue;
+}
+inline void TypedValue::clear_float_value() {
+  if (_internal_has_float_value()) {
+    _impl_.value_.float_value_ = 0;
+    clear_has_value();
+  }
+}
+inline float TypedValue::_internal_float_value() const {
+  if (_internal_has_float_value()) {
+    return _impl_.value_.float_value_;
+  }
+  return 0;
+}
+inline void TypedValue::_internal_set_float_value(float value) {
+  if (!_internal_has_float_value()) {
+    clear_value();
+    set_has_float_value();
+  }
+  _impl_.value_.float_value_ = value;
+}
+inline float TypedValue::float_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.float_value)
+  return _internal_float_value();
+}
+inline void TypedValue::set_float_value(float value) {
+  _internal_set_float_value(value);
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.float_value)
+}
+
+// double double_value = 6;
+inline bool TypedValue::_internal_has_double_value() const {
+  return value_case() == kDoubleValue;
+}
+inline bool TypedValue::has_double_value() const {
+  return _internal_has_double_value();
+}
+inline void TypedValue::set_has_double_value() {
+  _impl_._oneof_case_[0] = kDoubleValue;
+}
+inline void TypedValue::clear_double_value() {
+  if (_internal_has_double_value()) {
+    _impl_.value_.double_value_ = 0;
+    clear_has_value();
+  }
+}
+inline double TypedValue::_internal_double_value() const {
+  if (_internal_has_double_value()) {
+    return _impl_.value_.double_value_;
+  }
+  return 0;
+}
+inline void TypedValue::_internal_set_double_value(double value) {
+  if (!_internal_has_double_value()) {
+    clear_value();
+    set_has_double_value();
+  }
+  _impl_.value_.double_value_ = value;
+}
+inline double TypedValue::double_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.double_value)
+  return _internal_double_value();
+}
+inline void TypedValue::set_double_value(double value) {
+  _internal_set_double_value(value);
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.double_value)
+}
+
+// string string_value = 7;
+inline bool TypedValue::_internal_has_string_value() const {
+  return value_case() == kStringValue;
+}
+inline bool TypedValue::has_string_value() const {
+  return _internal_has_string_value();
+}
+inline void TypedValue::set_has_string_value() {
+  _impl_._oneof_case_[0] = kStringValue;
+}
+inline void TypedValue::clear_string_value() {
+  if (_internal_has_string_value()) {
+    _impl_.value_.string_value_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& TypedValue::string_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.string_value)
+  return _internal_string_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline void TypedValue::set_string_value(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  _impl_.value_.string_value_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.string_value)
+}
+inline std::string* TypedValue::mutable_string_value() {
+  std::string* _s = _internal_mutable_string_value();
+  // @@protoc_insertion_point(field_mutable:siodb.TypedValue.string_value)
+  return _s;
+}
+inline const std::string& TypedValue::_internal_string_value() const {
+  if (_internal_has_string_value()) {
+    return _impl_.value_.string_value_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void TypedValue::_internal_set_string_value(const std::string& value) {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  _impl_.value_.string_value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TypedValue::_internal_mutable_string_value() {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  return _impl_.value_.string_value_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* TypedValue::release_string_value() {
+  // @@protoc_insertion_point(field_release:siodb.TypedValue.string_value)
+  if (_internal_has_string_value()) {
+    clear_has_value();
+    return _impl_.value_.string_value_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void TypedValue::set_allocated_string_value(std::string* string_value) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (string_value != nullptr) {
+    set_has_string_value();
+    _impl_.value_.string_value_.InitAllocated(string_value, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:siodb.TypedValue.string_value)
+}
+
+// bytes binary_value = 8;
+inline bool TypedValue::_internal_has_binary_value() const {
+  return value_case() == kBinaryValue;
+}
+inline bool TypedValue::has_binary_value() const {
+  return _internal_has_binary_value();
+}
+inline void TypedValue::set_has_binary_value() {
+  _impl_._oneof_case_[0] = kBinaryValue;
+}
+inline void TypedValue::clear_binary_value() {
+  if (_internal_has_binary_value()) {
+    _impl_.value_.binary_value_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& TypedValue::binary_value() const {
+  // @@protoc_insertion_point(field_get:siodb.TypedValue.binary_value)
+  return _internal_binary_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline void TypedValue::set_binary_value(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_binary_value()) {
+    clear_value();
+    set_has_binary_value();
+    _impl_.value_.binary_value_.InitDefault();
+  }
+  _impl_.value_.binary_value_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.TypedValue.binary_value)
+}
+inline std::string* TypedValue::mutable_binary_value() {
+  std::string* _s = _internal_mutable_binary_value();
+  // @@protoc_insertion_point(field_mutable:siodb.TypedValue.binary_value)
+  return _s;
+}
+inline const std::string& TypedValue::_internal_binary_value() const {
+  if (_internal_has_binary_value()) {
+    return _impl_.value_.binary_value_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void TypedValue::_internal_set_binary_value(const std::string& value) {
+  if (!_internal_has_binary_value()) {
+    clear_value();
+    set_has_binary_value();
+    _impl_.value_.binary_value_.InitDefault();
+  }
+  _impl_.value_.binary_value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TypedValue::_internal_mutable_binary_value() {
+  if (!_internal_has_binary_value()) {
+    clear_value();
+    set_has_binary_value();
+    _impl_.value_.binary_value_.InitDefault();
+  }
+  return _impl_.value_.binary_value_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* TypedValue::release_binary_value() {
+  // @@protoc_insertion_point(field_release:siodb.TypedValue.binary_value)
+  if (_internal_has_binary_value()) {
+    clear_has_value();
+    return _impl_.value_.binary_value_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void TypedValue::set_allocated_binary_value(std::string* binary_value) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (binary_value != nullptr) {
+    set_has_binary_value();
+    _impl_.value_.binary_value_.InitAllocated(binary_value, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:siodb.TypedValue.binary_value)
+}
+
+inline bool TypedValue::has_value() const {
+  return value_case() != VALUE_NOT_SET;
+}
+inline void TypedValue::clear_has_value() {
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+inline TypedValue::ValueCase TypedValue::value_case() const {
+  return TypedValue::ValueCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace siodb
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_CommonTypes_2eproto
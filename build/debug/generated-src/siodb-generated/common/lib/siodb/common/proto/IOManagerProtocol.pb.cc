@@ -0,0 +1,2731 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: IOManagerProtocol.proto
+
+#include "IOManagerProtocol.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace siodb {
+namespace iomgr_protocol {
+PROTOBUF_CONSTEXPR DatabaseEngineRequest::DatabaseEngineRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parameter_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.statement_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.prepare_)*/false
+  , /*decltype(_impl_.close_statement_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DatabaseEngineRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatabaseEngineRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatabaseEngineRequestDefaultTypeInternal() {}
+  union {
+    DatabaseEngineRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatabaseEngineRequestDefaultTypeInternal _DatabaseEngineRequest_default_instance_;
+PROTOBUF_CONSTEXPR Tag::Tag(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct TagDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TagDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TagDefaultTypeInternal() {}
+  union {
+    Tag _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TagDefaultTypeInternal _Tag_default_instance_;
+PROTOBUF_CONSTEXPR DatabaseEngineResponse::DatabaseEngineResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{}
+  , /*decltype(_impl_.freetext_message_)*/{}
+  , /*decltype(_impl_.column_description_)*/{}
+  , /*decltype(_impl_.tag_)*/{}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.response_id_)*/0u
+  , /*decltype(_impl_.response_count_)*/0u
+  , /*decltype(_impl_.affected_row_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.has_affected_row_count_)*/false
+  , /*decltype(_impl_.parameter_count_)*/0u
+  , /*decltype(_impl_.statement_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DatabaseEngineResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatabaseEngineResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatabaseEngineResponseDefaultTypeInternal() {}
+  union {
+    DatabaseEngineResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatabaseEngineResponseDefaultTypeInternal _DatabaseEngineResponse_default_instance_;
+PROTOBUF_CONSTEXPR BeginAuthenticateUserRequest::BeginAuthenticateUserRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.user_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BeginAuthenticateUserRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeginAuthenticateUserRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeginAuthenticateUserRequestDefaultTypeInternal() {}
+  union {
+    BeginAuthenticateUserRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeginAuthenticateUserRequestDefaultTypeInternal _BeginAuthenticateUserRequest_default_instance_;
+PROTOBUF_CONSTEXPR BeginAuthenticateUserResponse::BeginAuthenticateUserResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.session_started_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BeginAuthenticateUserResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BeginAuthenticateUserResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BeginAuthenticateUserResponseDefaultTypeInternal() {}
+  union {
+    BeginAuthenticateUserResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BeginAuthenticateUserResponseDefaultTypeInternal _BeginAuthenticateUserResponse_default_instance_;
+PROTOBUF_CONSTEXPR AuthenticateUserRequest::AuthenticateUserRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.challenge_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.signature_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AuthenticateUserRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AuthenticateUserRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AuthenticateUserRequestDefaultTypeInternal() {}
+  union {
+    AuthenticateUserRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AuthenticateUserRequestDefaultTypeInternal _AuthenticateUserRequest_default_instance_;
+PROTOBUF_CONSTEXPR AuthenticateUserResponse::AuthenticateUserResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.authenticated_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AuthenticateUserResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AuthenticateUserResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AuthenticateUserResponseDefaultTypeInternal() {}
+  union {
+    AuthenticateUserResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AuthenticateUserResponseDefaultTypeInternal _AuthenticateUserResponse_default_instance_;
+PROTOBUF_CONSTEXPR SessionFrameHeader::SessionFrameHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.data_length_)*/0u
+  , /*decltype(_impl_.window_increment_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionFrameHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionFrameHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionFrameHeaderDefaultTypeInternal() {}
+  union {
+    SessionFrameHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionFrameHeaderDefaultTypeInternal _SessionFrameHeader_default_instance_;
+}  // namespace iomgr_protocol
+}  // namespace siodb
+static ::_pb::Metadata file_level_metadata_IOManagerProtocol_2eproto[8];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_IOManagerProtocol_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_IOManagerProtocol_2eproto = nullptr;
+
+const uint32_t TableStruct_IOManagerProtocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _impl_.prepare_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _impl_.statement_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _impl_.parameter_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineRequest, _impl_.close_statement_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::Tag, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::Tag, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::Tag, _impl_.name_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::Tag, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.freetext_message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.column_description_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.response_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.response_count_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.has_affected_row_count_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.affected_row_count_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.tag_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.statement_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::DatabaseEngineResponse, _impl_.parameter_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::BeginAuthenticateUserRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::BeginAuthenticateUserRequest, _impl_.user_name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::BeginAuthenticateUserResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::BeginAuthenticateUserResponse, _impl_.session_started_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::BeginAuthenticateUserResponse, _impl_.message_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserRequest, _impl_.challenge_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserRequest, _impl_.signature_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserResponse, _impl_.authenticated_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserResponse, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::AuthenticateUserResponse, _impl_.session_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::SessionFrameHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::SessionFrameHeader, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::SessionFrameHeader, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::SessionFrameHeader, _impl_.data_length_),
+  PROTOBUF_FIELD_OFFSET(::siodb::iomgr_protocol::SessionFrameHeader, _impl_.window_increment_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::siodb::iomgr_protocol::DatabaseEngineRequest)},
+  { 12, -1, -1, sizeof(::siodb::iomgr_protocol::Tag)},
+  { 22, -1, -1, sizeof(::siodb::iomgr_protocol::DatabaseEngineResponse)},
+  { 39, -1, -1, sizeof(::siodb::iomgr_protocol::BeginAuthenticateUserRequest)},
+  { 46, -1, -1, sizeof(::siodb::iomgr_protocol::BeginAuthenticateUserResponse)},
+  { 54, -1, -1, sizeof(::siodb::iomgr_protocol::AuthenticateUserRequest)},
+  { 62, -1, -1, sizeof(::siodb::iomgr_protocol::AuthenticateUserResponse)},
+  { 71, -1, -1, sizeof(::siodb::iomgr_protocol::SessionFrameHeader)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::siodb::iomgr_protocol::_DatabaseEngineRequest_default_instance_._instance,
+  &::siodb::iomgr_protocol::_Tag_default_instance_._instance,
+  &::siodb::iomgr_protocol::_DatabaseEngineResponse_default_instance_._instance,
+  &::siodb::iomgr_protocol::_BeginAuthenticateUserRequest_default_instance_._instance,
+  &::siodb::iomgr_protocol::_BeginAuthenticateUserResponse_default_instance_._instance,
+  &::siodb::iomgr_protocol::_AuthenticateUserRequest_default_instance_._instance,
+  &::siodb::iomgr_protocol::_AuthenticateUserResponse_default_instance_._instance,
+  &::siodb::iomgr_protocol::_SessionFrameHeader_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_IOManagerProtocol_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027IOManagerProtocol.proto\022\024siodb.iomgr_p"
+  "rotocol\032\021CommonTypes.proto\"\237\001\n\025DatabaseE"
+  "ngineRequest\022\022\n\nrequest_id\030\001 \001(\004\022\014\n\004text"
+  "\030\002 \001(\t\022\017\n\007prepare\030\003 \001(\010\022\024\n\014statement_id\030"
+  "\004 \001(\004\022$\n\tparameter\030\005 \003(\0132\021.siodb.TypedVa"
+  "lue\022\027\n\017close_statement\030\006 \001(\010\"J\n\003Tag\022\014\n\004n"
+  "ame\030\001 \001(\t\022\024\n\nbool_value\030\002 \001(\010H\000\022\026\n\014strin"
+  "g_value\030\003 \001(\tH\000B\007\n\005value\"\343\002\n\026DatabaseEng"
+  "ineResponse\022\022\n\nrequest_id\030\001 \001(\004\022%\n\007messa"
+  "ge\030\002 \003(\0132\024.siodb.StatusMessage\022\030\n\020freete"
+  "xt_message\030\003 \003(\t\0224\n\022column_description\030\004"
+  " \003(\0132\030.siodb.ColumnDescription\022\023\n\013respon"
+  "se_id\030\005 \001(\r\022\026\n\016response_count\030\006 \001(\r\022\036\n\026h"
+  "as_affected_row_count\030\007 \001(\010\022\032\n\022affected_"
+  "row_count\030\010 \001(\004\022&\n\003tag\030\t \003(\0132\031.siodb.iom"
+  "gr_protocol.Tag\022\024\n\014statement_id\030\n \001(\004\022\027\n"
+  "\017parameter_count\030\013 \001(\r\"1\n\034BeginAuthentic"
+  "ateUserRequest\022\021\n\tuser_name\030\001 \001(\t\"_\n\035Beg"
+  "inAuthenticateUserResponse\022\027\n\017session_st"
+  "arted\030\001 \001(\010\022%\n\007message\030\002 \001(\0132\024.siodb.Sta"
+  "tusMessage\"\?\n\027AuthenticateUserRequest\022\021\n"
+  "\tchallenge\030\001 \001(\014\022\021\n\tsignature\030\002 \001(\014\"l\n\030A"
+  "uthenticateUserResponse\022\025\n\rauthenticated"
+  "\030\001 \001(\010\022%\n\007message\030\002 \001(\0132\024.siodb.StatusMe"
+  "ssage\022\022\n\nsession_id\030\003 \001(\t\"\215\001\n\022SessionFra"
+  "meHeader\022\022\n\nsession_id\030\001 \001(\004\0224\n\004type\030\002 \001"
+  "(\0162&.siodb.iomgr_protocol.SessionFrameTy"
+  "pe\022\023\n\013data_length\030\003 \001(\r\022\030\n\020window_increm"
+  "ent\030\004 \001(\r*d\n\020SessionFrameType\022\020\n\014SESSION"
+  "_DATA\020\000\022\020\n\014SESSION_OPEN\020\001\022\021\n\rSESSION_CLO"
+  "SE\020\002\022\031\n\025SESSION_WINDOW_UPDATE\020\003B\002H\001b\006pro"
+  "to3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_IOManagerProtocol_2eproto_deps[1] = {
+  &::descriptor_table_CommonTypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_IOManagerProtocol_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_IOManagerProtocol_2eproto = {
+    false, false, 1243, descriptor_table_protodef_IOManagerProtocol_2eproto,
+    "IOManagerProtocol.proto",
+    &descriptor_table_IOManagerProtocol_2eproto_once, descriptor_table_IOManagerProtocol_2eproto_deps, 1, 8,
+    schemas, file_default_instances, TableStruct_IOManagerProtocol_2eproto::offsets,
+    file_level_metadata_IOManagerProtocol_2eproto, file_level_enum_descriptors_IOManagerProtocol_2eproto,
+    file_level_service_descriptors_IOManagerProtocol_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_IOManagerProtocol_2eproto_getter() {
+  return &descriptor_table_IOManagerProtocol_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_IOManagerProtocol_2eproto(&descriptor_table_IOManagerProtocol_2eproto);
+namespace siodb {
+namespace iomgr_protocol {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SessionFrameType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_IOManagerProtocol_2eproto);
+  return file_level_enum_descriptors_IOManagerProtocol_2eproto[0];
+}
+bool SessionFrameType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class DatabaseEngineRequest::_Internal {
+ public:
+};
+
+void DatabaseEngineRequest::clear_parameter() {
+  _impl_.parameter_.Clear();
+}
+DatabaseEngineRequest::DatabaseEngineRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.DatabaseEngineRequest)
+}
+DatabaseEngineRequest::DatabaseEngineRequest(const DatabaseEngineRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DatabaseEngineRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parameter_){from._impl_.parameter_}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.statement_id_){}
+    , decltype(_impl_.prepare_){}
+    , decltype(_impl_.close_statement_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.close_statement_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.close_statement_));
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.DatabaseEngineRequest)
+}
+
+inline void DatabaseEngineRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parameter_){arena}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.statement_id_){uint64_t{0u}}
+    , decltype(_impl_.prepare_){false}
+    , decltype(_impl_.close_statement_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DatabaseEngineRequest::~DatabaseEngineRequest() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.DatabaseEngineRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DatabaseEngineRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parameter_.~RepeatedPtrField();
+  _impl_.text_.Destroy();
+}
+
+void DatabaseEngineRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DatabaseEngineRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.DatabaseEngineRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parameter_.Clear();
+  _impl_.text_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.close_statement_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.close_statement_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DatabaseEngineRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 request_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.iomgr_protocol.DatabaseEngineRequest.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool prepare = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prepare_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 statement_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.statement_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.TypedValue parameter = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_parameter(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool close_statement = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.close_statement_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DatabaseEngineRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.DatabaseEngineRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_request_id(), target);
+  }
+
+  // string text = 2;
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.iomgr_protocol.DatabaseEngineRequest.text");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_text(), target);
+  }
+
+  // bool prepare = 3;
+  if (this->_internal_prepare() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_prepare(), target);
+  }
+
+  // uint64 statement_id = 4;
+  if (this->_internal_statement_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_statement_id(), target);
+  }
+
+  // repeated .siodb.TypedValue parameter = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_parameter_size()); i < n; i++) {
+    const auto& repfield = this->_internal_parameter(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool close_statement = 6;
+  if (this->_internal_close_statement() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_close_statement(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.DatabaseEngineRequest)
+  return target;
+}
+
+size_t DatabaseEngineRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.DatabaseEngineRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.TypedValue parameter = 5;
+  total_size += 1UL * this->_internal_parameter_size();
+  for (const auto& msg : this->_impl_.parameter_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string text = 2;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint64 statement_id = 4;
+  if (this->_internal_statement_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_statement_id());
+  }
+
+  // bool prepare = 3;
+  if (this->_internal_prepare() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool close_statement = 6;
+  if (this->_internal_close_statement() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DatabaseEngineRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DatabaseEngineRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DatabaseEngineRequest::GetClassData() const { return &_class_data_; }
+
+
+void DatabaseEngineRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DatabaseEngineRequest*>(&to_msg);
+  auto& from = static_cast<const DatabaseEngineRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.DatabaseEngineRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.parameter_.MergeFrom(from._impl_.parameter_);
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_statement_id() != 0) {
+    _this->_internal_set_statement_id(from._internal_statement_id());
+  }
+  if (from._internal_prepare() != 0) {
+    _this->_internal_set_prepare(from._internal_prepare());
+  }
+  if (from._internal_close_statement() != 0) {
+    _this->_internal_set_close_statement(from._internal_close_statement());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DatabaseEngineRequest::CopyFrom(const DatabaseEngineRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.DatabaseEngineRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DatabaseEngineRequest::IsInitialized() const {
+  return true;
+}
+
+void DatabaseEngineRequest::InternalSwap(DatabaseEngineRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.parameter_.InternalSwap(&other->_impl_.parameter_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DatabaseEngineRequest, _impl_.close_statement_)
+      + sizeof(DatabaseEngineRequest::_impl_.close_statement_)
+      - PROTOBUF_FIELD_OFFSET(DatabaseEngineRequest, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DatabaseEngineRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[0]);
+}
+
+// ===================================================================
+
+class Tag::_Internal {
+ public:
+};
+
+Tag::Tag(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.Tag)
+}
+Tag::Tag(const Tag& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Tag* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  clear_has_value();
+  switch (from.value_case()) {
+    case kBoolValue: {
+      _this->_internal_set_bool_value(from._internal_bool_value());
+      break;
+    }
+    case kStringValue: {
+      _this->_internal_set_string_value(from._internal_string_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.Tag)
+}
+
+inline void Tag::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_value();
+}
+
+Tag::~Tag() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.Tag)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Tag::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void Tag::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Tag::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:siodb.iomgr_protocol.Tag)
+  switch (value_case()) {
+    case kBoolValue: {
+      // No need to clear
+      break;
+    }
+    case kStringValue: {
+      _impl_.value_.string_value_.Destroy();
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void Tag::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.Tag)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  clear_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Tag::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.iomgr_protocol.Tag.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool bool_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _internal_set_bool_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string string_value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_string_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.iomgr_protocol.Tag.string_value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Tag::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.Tag)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.iomgr_protocol.Tag.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // bool bool_value = 2;
+  if (_internal_has_bool_value()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_bool_value(), target);
+  }
+
+  // string string_value = 3;
+  if (_internal_has_string_value()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_string_value().data(), static_cast<int>(this->_internal_string_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.iomgr_protocol.Tag.string_value");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_string_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.Tag)
+  return target;
+}
+
+size_t Tag::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.Tag)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  switch (value_case()) {
+    // bool bool_value = 2;
+    case kBoolValue: {
+      total_size += 1 + 1;
+      break;
+    }
+    // string string_value = 3;
+    case kStringValue: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_string_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Tag::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Tag::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Tag::GetClassData() const { return &_class_data_; }
+
+
+void Tag::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Tag*>(&to_msg);
+  auto& from = static_cast<const Tag&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.Tag)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  switch (from.value_case()) {
+    case kBoolValue: {
+      _this->_internal_set_bool_value(from._internal_bool_value());
+      break;
+    }
+    case kStringValue: {
+      _this->_internal_set_string_value(from._internal_string_value());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Tag::CopyFrom(const Tag& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.Tag)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Tag::IsInitialized() const {
+  return true;
+}
+
+void Tag::InternalSwap(Tag* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Tag::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[1]);
+}
+
+// ===================================================================
+
+class DatabaseEngineResponse::_Internal {
+ public:
+};
+
+void DatabaseEngineResponse::clear_message() {
+  _impl_.message_.Clear();
+}
+void DatabaseEngineResponse::clear_column_description() {
+  _impl_.column_description_.Clear();
+}
+DatabaseEngineResponse::DatabaseEngineResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.DatabaseEngineResponse)
+}
+DatabaseEngineResponse::DatabaseEngineResponse(const DatabaseEngineResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DatabaseEngineResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){from._impl_.message_}
+    , decltype(_impl_.freetext_message_){from._impl_.freetext_message_}
+    , decltype(_impl_.column_description_){from._impl_.column_description_}
+    , decltype(_impl_.tag_){from._impl_.tag_}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.response_id_){}
+    , decltype(_impl_.response_count_){}
+    , decltype(_impl_.affected_row_count_){}
+    , decltype(_impl_.has_affected_row_count_){}
+    , decltype(_impl_.parameter_count_){}
+    , decltype(_impl_.statement_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.statement_id_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.statement_id_));
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.DatabaseEngineResponse)
+}
+
+inline void DatabaseEngineResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){arena}
+    , decltype(_impl_.freetext_message_){arena}
+    , decltype(_impl_.column_description_){arena}
+    , decltype(_impl_.tag_){arena}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.response_id_){0u}
+    , decltype(_impl_.response_count_){0u}
+    , decltype(_impl_.affected_row_count_){uint64_t{0u}}
+    , decltype(_impl_.has_affected_row_count_){false}
+    , decltype(_impl_.parameter_count_){0u}
+    , decltype(_impl_.statement_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DatabaseEngineResponse::~DatabaseEngineResponse() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.DatabaseEngineResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DatabaseEngineResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.~RepeatedPtrField();
+  _impl_.freetext_message_.~RepeatedPtrField();
+  _impl_.column_description_.~RepeatedPtrField();
+  _impl_.tag_.~RepeatedPtrField();
+}
+
+void DatabaseEngineResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DatabaseEngineResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.DatabaseEngineResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.Clear();
+  _impl_.freetext_message_.Clear();
+  _impl_.column_description_.Clear();
+  _impl_.tag_.Clear();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.statement_id_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.statement_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DatabaseEngineResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 request_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.StatusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_message(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string freetext_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_freetext_message();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.ColumnDescription column_description = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_column_description(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 response_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.response_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 response_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.response_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool has_affected_row_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.has_affected_row_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 affected_row_count = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.affected_row_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.iomgr_protocol.Tag tag = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tag(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 statement_id = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.statement_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 parameter_count = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.parameter_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DatabaseEngineResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.DatabaseEngineResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_request_id(), target);
+  }
+
+  // repeated .siodb.StatusMessage message = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_message_size()); i < n; i++) {
+    const auto& repfield = this->_internal_message(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string freetext_message = 3;
+  for (int i = 0, n = this->_internal_freetext_message_size(); i < n; i++) {
+    const auto& s = this->_internal_freetext_message(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated .siodb.ColumnDescription column_description = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_column_description_size()); i < n; i++) {
+    const auto& repfield = this->_internal_column_description(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 response_id = 5;
+  if (this->_internal_response_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_response_id(), target);
+  }
+
+  // uint32 response_count = 6;
+  if (this->_internal_response_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_response_count(), target);
+  }
+
+  // bool has_affected_row_count = 7;
+  if (this->_internal_has_affected_row_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_has_affected_row_count(), target);
+  }
+
+  // uint64 affected_row_count = 8;
+  if (this->_internal_affected_row_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_affected_row_count(), target);
+  }
+
+  // repeated .siodb.iomgr_protocol.Tag tag = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tag_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tag(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 statement_id = 10;
+  if (this->_internal_statement_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_statement_id(), target);
+  }
+
+  // uint32 parameter_count = 11;
+  if (this->_internal_parameter_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_parameter_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.DatabaseEngineResponse)
+  return target;
+}
+
+size_t DatabaseEngineResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.DatabaseEngineResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.StatusMessage message = 2;
+  total_size += 1UL * this->_internal_message_size();
+  for (const auto& msg : this->_impl_.message_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string freetext_message = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.freetext_message_.size());
+  for (int i = 0, n = _impl_.freetext_message_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.freetext_message_.Get(i));
+  }
+
+  // repeated .siodb.ColumnDescription column_description = 4;
+  total_size += 1UL * this->_internal_column_description_size();
+  for (const auto& msg : this->_impl_.column_description_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .siodb.iomgr_protocol.Tag tag = 9;
+  total_size += 1UL * this->_internal_tag_size();
+  for (const auto& msg : this->_impl_.tag_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint32 response_id = 5;
+  if (this->_internal_response_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_response_id());
+  }
+
+  // uint32 response_count = 6;
+  if (this->_internal_response_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_response_count());
+  }
+
+  // uint64 affected_row_count = 8;
+  if (this->_internal_affected_row_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_affected_row_count());
+  }
+
+  // bool has_affected_row_count = 7;
+  if (this->_internal_has_affected_row_count() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 parameter_count = 11;
+  if (this->_internal_parameter_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parameter_count());
+  }
+
+  // uint64 statement_id = 10;
+  if (this->_internal_statement_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_statement_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DatabaseEngineResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DatabaseEngineResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DatabaseEngineResponse::GetClassData() const { return &_class_data_; }
+
+
+void DatabaseEngineResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DatabaseEngineResponse*>(&to_msg);
+  auto& from = static_cast<const DatabaseEngineResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.DatabaseEngineResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.message_.MergeFrom(from._impl_.message_);
+  _this->_impl_.freetext_message_.MergeFrom(from._impl_.freetext_message_);
+  _this->_impl_.column_description_.MergeFrom(from._impl_.column_description_);
+  _this->_impl_.tag_.MergeFrom(from._impl_.tag_);
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_response_id() != 0) {
+    _this->_internal_set_response_id(from._internal_response_id());
+  }
+  if (from._internal_response_count() != 0) {
+    _this->_internal_set_response_count(from._internal_response_count());
+  }
+  if (from._internal_affected_row_count() != 0) {
+    _this->_internal_set_affected_row_count(from._internal_affected_row_count());
+  }
+  if (from._internal_has_affected_row_count() != 0) {
+    _this->_internal_set_has_affected_row_count(from._internal_has_affected_row_count());
+  }
+  if (from._internal_parameter_count() != 0) {
+    _this->_internal_set_parameter_count(from._internal_parameter_count());
+  }
+  if (from._internal_statement_id() != 0) {
+    _this->_internal_set_statement_id(from._internal_statement_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DatabaseEngineResponse::CopyFrom(const DatabaseEngineResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.DatabaseEngineResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DatabaseEngineResponse::IsInitialized() const {
+  return true;
+}
+
+void DatabaseEngineResponse::InternalSwap(DatabaseEngineResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.message_.InternalSwap(&other->_impl_.message_);
+  _impl_.freetext_message_.InternalSwap(&other->_impl_.freetext_message_);
+  _impl_.column_description_.InternalSwap(&other->_impl_.column_description_);
+  _impl_.tag_.InternalSwap(&other->_impl_.tag_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DatabaseEngineResponse, _impl_.statement_id_)
+      + sizeof(DatabaseEngineResponse::_impl_.statement_id_)
+      - PROTOBUF_FIELD_OFFSET(DatabaseEngineResponse, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DatabaseEngineResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[2]);
+}
+
+// ===================================================================
+
+class BeginAuthenticateUserRequest::_Internal {
+ public:
+};
+
+BeginAuthenticateUserRequest::BeginAuthenticateUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+}
+BeginAuthenticateUserRequest::BeginAuthenticateUserRequest(const BeginAuthenticateUserRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BeginAuthenticateUserRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.user_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_user_name().empty()) {
+    _this->_impl_.user_name_.Set(from._internal_user_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+}
+
+inline void BeginAuthenticateUserRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.user_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BeginAuthenticateUserRequest::~BeginAuthenticateUserRequest() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BeginAuthenticateUserRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.user_name_.Destroy();
+}
+
+void BeginAuthenticateUserRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BeginAuthenticateUserRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.user_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BeginAuthenticateUserRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string user_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_user_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BeginAuthenticateUserRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string user_name = 1;
+  if (!this->_internal_user_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_name().data(), static_cast<int>(this->_internal_user_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_user_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  return target;
+}
+
+size_t BeginAuthenticateUserRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string user_name = 1;
+  if (!this->_internal_user_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_user_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeginAuthenticateUserRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BeginAuthenticateUserRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeginAuthenticateUserRequest::GetClassData() const { return &_class_data_; }
+
+
+void BeginAuthenticateUserRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BeginAuthenticateUserRequest*>(&to_msg);
+  auto& from = static_cast<const BeginAuthenticateUserRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_user_name().empty()) {
+    _this->_internal_set_user_name(from._internal_user_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BeginAuthenticateUserRequest::CopyFrom(const BeginAuthenticateUserRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BeginAuthenticateUserRequest::IsInitialized() const {
+  return true;
+}
+
+void BeginAuthenticateUserRequest::InternalSwap(BeginAuthenticateUserRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_name_, lhs_arena,
+      &other->_impl_.user_name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BeginAuthenticateUserRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[3]);
+}
+
+// ===================================================================
+
+class BeginAuthenticateUserResponse::_Internal {
+ public:
+  static const ::siodb::StatusMessage& message(const BeginAuthenticateUserResponse* msg);
+};
+
+const ::siodb::StatusMessage&
+BeginAuthenticateUserResponse::_Internal::message(const BeginAuthenticateUserResponse* msg) {
+  return *msg->_impl_.message_;
+}
+void BeginAuthenticateUserResponse::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+BeginAuthenticateUserResponse::BeginAuthenticateUserResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+}
+BeginAuthenticateUserResponse::BeginAuthenticateUserResponse(const BeginAuthenticateUserResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BeginAuthenticateUserResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.session_started_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::siodb::StatusMessage(*from._impl_.message_);
+  }
+  _this->_impl_.session_started_ = from._impl_.session_started_;
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+}
+
+inline void BeginAuthenticateUserResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.session_started_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BeginAuthenticateUserResponse::~BeginAuthenticateUserResponse() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BeginAuthenticateUserResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void BeginAuthenticateUserResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BeginAuthenticateUserResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  _impl_.session_started_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BeginAuthenticateUserResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool session_started = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.session_started_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.StatusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BeginAuthenticateUserResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool session_started = 1;
+  if (this->_internal_session_started() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_session_started(), target);
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  return target;
+}
+
+size_t BeginAuthenticateUserResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  // bool session_started = 1;
+  if (this->_internal_session_started() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BeginAuthenticateUserResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BeginAuthenticateUserResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BeginAuthenticateUserResponse::GetClassData() const { return &_class_data_; }
+
+
+void BeginAuthenticateUserResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BeginAuthenticateUserResponse*>(&to_msg);
+  auto& from = static_cast<const BeginAuthenticateUserResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::siodb::StatusMessage::MergeFrom(
+        from._internal_message());
+  }
+  if (from._internal_session_started() != 0) {
+    _this->_internal_set_session_started(from._internal_session_started());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BeginAuthenticateUserResponse::CopyFrom(const BeginAuthenticateUserResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BeginAuthenticateUserResponse::IsInitialized() const {
+  return true;
+}
+
+void BeginAuthenticateUserResponse::InternalSwap(BeginAuthenticateUserResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BeginAuthenticateUserResponse, _impl_.session_started_)
+      + sizeof(BeginAuthenticateUserResponse::_impl_.session_started_)
+      - PROTOBUF_FIELD_OFFSET(BeginAuthenticateUserResponse, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BeginAuthenticateUserResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[4]);
+}
+
+// ===================================================================
+
+class AuthenticateUserRequest::_Internal {
+ public:
+};
+
+AuthenticateUserRequest::AuthenticateUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.AuthenticateUserRequest)
+}
+AuthenticateUserRequest::AuthenticateUserRequest(const AuthenticateUserRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AuthenticateUserRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.challenge_){}
+    , decltype(_impl_.signature_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.challenge_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.challenge_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_challenge().empty()) {
+    _this->_impl_.challenge_.Set(from._internal_challenge(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_signature().empty()) {
+    _this->_impl_.signature_.Set(from._internal_signature(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.AuthenticateUserRequest)
+}
+
+inline void AuthenticateUserRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.challenge_){}
+    , decltype(_impl_.signature_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.challenge_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.challenge_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.signature_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.signature_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AuthenticateUserRequest::~AuthenticateUserRequest() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.AuthenticateUserRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AuthenticateUserRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.challenge_.Destroy();
+  _impl_.signature_.Destroy();
+}
+
+void AuthenticateUserRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AuthenticateUserRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.AuthenticateUserRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.challenge_.ClearToEmpty();
+  _impl_.signature_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AuthenticateUserRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes challenge = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_challenge();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes signature = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_signature();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AuthenticateUserRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.AuthenticateUserRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes challenge = 1;
+  if (!this->_internal_challenge().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_challenge(), target);
+  }
+
+  // bytes signature = 2;
+  if (!this->_internal_signature().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_signature(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.AuthenticateUserRequest)
+  return target;
+}
+
+size_t AuthenticateUserRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.AuthenticateUserRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes challenge = 1;
+  if (!this->_internal_challenge().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_challenge());
+  }
+
+  // bytes signature = 2;
+  if (!this->_internal_signature().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_signature());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AuthenticateUserRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AuthenticateUserRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AuthenticateUserRequest::GetClassData() const { return &_class_data_; }
+
+
+void AuthenticateUserRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AuthenticateUserRequest*>(&to_msg);
+  auto& from = static_cast<const AuthenticateUserRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.AuthenticateUserRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_challenge().empty()) {
+    _this->_internal_set_challenge(from._internal_challenge());
+  }
+  if (!from._internal_signature().empty()) {
+    _this->_internal_set_signature(from._internal_signature());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AuthenticateUserRequest::CopyFrom(const AuthenticateUserRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.AuthenticateUserRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AuthenticateUserRequest::IsInitialized() const {
+  return true;
+}
+
+void AuthenticateUserRequest::InternalSwap(AuthenticateUserRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.challenge_, lhs_arena,
+      &other->_impl_.challenge_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.signature_, lhs_arena,
+      &other->_impl_.signature_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AuthenticateUserRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[5]);
+}
+
+// ===================================================================
+
+class AuthenticateUserResponse::_Internal {
+ public:
+  static const ::siodb::StatusMessage& message(const AuthenticateUserResponse* msg);
+};
+
+const ::siodb::StatusMessage&
+AuthenticateUserResponse::_Internal::message(const AuthenticateUserResponse* msg) {
+  return *msg->_impl_.message_;
+}
+void AuthenticateUserResponse::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+AuthenticateUserResponse::AuthenticateUserResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.AuthenticateUserResponse)
+}
+AuthenticateUserResponse::AuthenticateUserResponse(const AuthenticateUserResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AuthenticateUserResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.authenticated_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::siodb::StatusMessage(*from._impl_.message_);
+  }
+  _this->_impl_.authenticated_ = from._impl_.authenticated_;
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.AuthenticateUserResponse)
+}
+
+inline void AuthenticateUserResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.authenticated_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AuthenticateUserResponse::~AuthenticateUserResponse() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.AuthenticateUserResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AuthenticateUserResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void AuthenticateUserResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AuthenticateUserResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.AuthenticateUserResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  _impl_.authenticated_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AuthenticateUserResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool authenticated = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.authenticated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.StatusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.iomgr_protocol.AuthenticateUserResponse.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AuthenticateUserResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.AuthenticateUserResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool authenticated = 1;
+  if (this->_internal_authenticated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_authenticated(), target);
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 3;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.iomgr_protocol.AuthenticateUserResponse.session_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_session_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.AuthenticateUserResponse)
+  return target;
+}
+
+size_t AuthenticateUserResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.AuthenticateUserResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 3;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // .siodb.StatusMessage message = 2;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  // bool authenticated = 1;
+  if (this->_internal_authenticated() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AuthenticateUserResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AuthenticateUserResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AuthenticateUserResponse::GetClassData() const { return &_class_data_; }
+
+
+void AuthenticateUserResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AuthenticateUserResponse*>(&to_msg);
+  auto& from = static_cast<const AuthenticateUserResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.AuthenticateUserResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::siodb::StatusMessage::MergeFrom(
+        from._internal_message());
+  }
+  if (from._internal_authenticated() != 0) {
+    _this->_internal_set_authenticated(from._internal_authenticated());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AuthenticateUserResponse::CopyFrom(const AuthenticateUserResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.AuthenticateUserResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AuthenticateUserResponse::IsInitialized() const {
+  return true;
+}
+
+void AuthenticateUserResponse::InternalSwap(AuthenticateUserResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AuthenticateUserResponse, _impl_.authenticated_)
+      + sizeof(AuthenticateUserResponse::_impl_.authenticated_)
+      - PROTOBUF_FIELD_OFFSET(AuthenticateUserResponse, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AuthenticateUserResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[6]);
+}
+
+// ===================================================================
+
+class SessionFrameHeader::_Internal {
+ public:
+};
+
+SessionFrameHeader::SessionFrameHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.iomgr_protocol.SessionFrameHeader)
+}
+SessionFrameHeader::SessionFrameHeader(const SessionFrameHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionFrameHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.data_length_){}
+    , decltype(_impl_.window_increment_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.session_id_, &from._impl_.session_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.window_increment_) -
+    reinterpret_cast<char*>(&_impl_.session_id_)) + sizeof(_impl_.window_increment_));
+  // @@protoc_insertion_point(copy_constructor:siodb.iomgr_protocol.SessionFrameHeader)
+}
+
+inline void SessionFrameHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.data_length_){0u}
+    , decltype(_impl_.window_increment_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SessionFrameHeader::~SessionFrameHeader() {
+  // @@protoc_insertion_point(destructor:siodb.iomgr_protocol.SessionFrameHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionFrameHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SessionFrameHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionFrameHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.iomgr_protocol.SessionFrameHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.session_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.window_increment_) -
+      reinterpret_cast<char*>(&_impl_.session_id_)) + sizeof(_impl_.window_increment_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionFrameHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 session_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.session_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.iomgr_protocol.SessionFrameType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::siodb::iomgr_protocol::SessionFrameType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 data_length = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.data_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 window_increment = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.window_increment_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionFrameHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.iomgr_protocol.SessionFrameHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 session_id = 1;
+  if (this->_internal_session_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_session_id(), target);
+  }
+
+  // .siodb.iomgr_protocol.SessionFrameType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  // uint32 data_length = 3;
+  if (this->_internal_data_length() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_data_length(), target);
+  }
+
+  // uint32 window_increment = 4;
+  if (this->_internal_window_increment() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_window_increment(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.iomgr_protocol.SessionFrameHeader)
+  return target;
+}
+
+size_t SessionFrameHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.iomgr_protocol.SessionFrameHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 session_id = 1;
+  if (this->_internal_session_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_session_id());
+  }
+
+  // .siodb.iomgr_protocol.SessionFrameType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // uint32 data_length = 3;
+  if (this->_internal_data_length() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_data_length());
+  }
+
+  // uint32 window_increment = 4;
+  if (this->_internal_window_increment() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window_increment());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionFrameHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionFrameHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionFrameHeader::GetClassData() const { return &_class_data_; }
+
+
+void SessionFrameHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionFrameHeader*>(&to_msg);
+  auto& from = static_cast<const SessionFrameHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.iomgr_protocol.SessionFrameHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_session_id() != 0) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_data_length() != 0) {
+    _this->_internal_set_data_length(from._internal_data_length());
+  }
+  if (from._internal_window_increment() != 0) {
+    _this->_internal_set_window_increment(from._internal_window_increment());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionFrameHeader::CopyFrom(const SessionFrameHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.iomgr_protocol.SessionFrameHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionFrameHeader::IsInitialized() const {
+  return true;
+}
+
+void SessionFrameHeader::InternalSwap(SessionFrameHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionFrameHeader, _impl_.window_increment_)
+      + sizeof(SessionFrameHeader::_impl_.window_increment_)
+      - PROTOBUF_FIELD_OFFSET(SessionFrameHeader, _impl_.session_id_)>(
+          reinterpret_cast<char*>(&_impl_.session_id_),
+          reinterpret_cast<char*>(&other->_impl_.session_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionFrameHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_IOManagerProtocol_2eproto_getter, &descriptor_table_IOManagerProtocol_2eproto_once,
+      file_level_metadata_IOManagerProtocol_2eproto[7]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace iomgr_protocol
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::DatabaseEngineRequest*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::DatabaseEngineRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::DatabaseEngineRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::Tag*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::Tag >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::Tag >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::DatabaseEngineResponse*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::DatabaseEngineResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::DatabaseEngineResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::BeginAuthenticateUserRequest*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::BeginAuthenticateUserRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::BeginAuthenticateUserRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::BeginAuthenticateUserResponse*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::BeginAuthenticateUserResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::BeginAuthenticateUserResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::AuthenticateUserRequest*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::AuthenticateUserRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::AuthenticateUserRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::AuthenticateUserResponse*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::AuthenticateUserResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::AuthenticateUserResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::iomgr_protocol::SessionFrameHeader*
+Arena::CreateMaybeMessage< ::siodb::iomgr_protocol::SessionFrameHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::iomgr_protocol::SessionFrameHeader >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
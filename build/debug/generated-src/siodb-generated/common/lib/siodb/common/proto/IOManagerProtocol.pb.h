@@ -0,0 +1,2931 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: IOManagerProtocol.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_IOManagerProtocol_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_IOManagerProtocol_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "CommonTypes.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_IOManagerProtocol_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_IOManagerProtocol_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_IOManagerProtocol_2eproto;
+namespace siodb {
+namespace iomgr_protocol {
+class AuthenticateUserRequest;
+struct AuthenticateUserRequestDefaultTypeInternal;
+extern AuthenticateUserRequestDefaultTypeInternal _AuthenticateUserRequest_default_instance_;
+class AuthenticateUserResponse;
+struct AuthenticateUserResponseDefaultTypeInternal;
+extern AuthenticateUserResponseDefaultTypeInternal _AuthenticateUserResponse_default_instance_;
+class BeginAuthenticateUserRequest;
+struct BeginAuthenticateUserRequestDefaultTypeInternal;
+extern BeginAuthenticateUserRequestDefaultTypeInternal _BeginAuthenticateUserRequest_default_instance_;
+class BeginAuthenticateUserResponse;
+struct BeginAuthenticateUserResponseDefaultTypeInternal;
+extern BeginAuthenticateUserResponseDefaultTypeInternal _BeginAuthenticateUserResponse_default_instance_;
+class DatabaseEngineRequest;
+struct DatabaseEngineRequestDefaultTypeInternal;
+extern DatabaseEngineRequestDefaultTypeInternal _DatabaseEngineRequest_default_instance_;
+class DatabaseEngineResponse;
+struct DatabaseEngineResponseDefaultTypeInternal;
+extern DatabaseEngineResponseDefaultTypeInternal _DatabaseEngineResponse_default_instance_;
+class SessionFrameHeader;
+struct SessionFrameHeaderDefaultTypeInternal;
+extern SessionFrameHeaderDefaultTypeInternal _SessionFrameHeader_default_instance_;
+class Tag;
+struct TagDefaultTypeInternal;
+extern TagDefaultTypeInternal _Tag_default_instance_;
+}  // namespace iomgr_protocol
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::siodb::iomgr_protocol::AuthenticateUserRequest* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::AuthenticateUserRequest>(Arena*);
+template<> ::siodb::iomgr_protocol::AuthenticateUserResponse* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::AuthenticateUserResponse>(Arena*);
+template<> ::siodb::iomgr_protocol::BeginAuthenticateUserRequest* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::BeginAuthenticateUserRequest>(Arena*);
+template<> ::siodb::iomgr_protocol::BeginAuthenticateUserResponse* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::BeginAuthenticateUserResponse>(Arena*);
+template<> ::siodb::iomgr_protocol::DatabaseEngineRequest* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::DatabaseEngineRequest>(Arena*);
+template<> ::siodb::iomgr_protocol::DatabaseEngineResponse* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::DatabaseEngineResponse>(Arena*);
+template<> ::siodb::iomgr_protocol::SessionFrameHeader* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::SessionFrameHeader>(Arena*);
+template<> ::siodb::iomgr_protocol::Tag* Arena::CreateMaybeMessage<::siodb::iomgr_protocol::Tag>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace siodb {
+namespace iomgr_protocol {
+
+enum SessionFrameType : int {
+  SESSION_DATA = 0,
+  SESSION_OPEN = 1,
+  SESSION_CLOSE = 2,
+  SESSION_WINDOW_UPDATE = 3,
+  SessionFrameType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SessionFrameType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool SessionFrameType_IsValid(int value);
+constexpr SessionFrameType SessionFrameType_MIN = SESSION_DATA;
+constexpr SessionFrameType SessionFrameType_MAX = SESSION_WINDOW_UPDATE;
+constexpr int SessionFrameType_ARRAYSIZE = SessionFrameType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SessionFrameType_descriptor();
+template<typename T>
+inline const std::string& SessionFrameType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SessionFrameType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SessionFrameType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SessionFrameType_descriptor(), enum_t_value);
+}
+inline bool SessionFrameType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SessionFrameType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SessionFrameType>(
+    SessionFrameType_descriptor(), name, value);
+}
+// ===================================================================
+
+class DatabaseEngineRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.DatabaseEngineRequest) */ {
+ public:
+  inline DatabaseEngineRequest() : DatabaseEngineRequest(nullptr) {}
+  ~DatabaseEngineRequest() override;
+  explicit PROTOBUF_CONSTEXPR DatabaseEngineRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DatabaseEngineRequest(const DatabaseEngineRequest& from);
+  DatabaseEngineRequest(DatabaseEngineRequest&& from) noexcept
+    : DatabaseEngineRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DatabaseEngineRequest& operator=(const DatabaseEngineRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DatabaseEngineRequest& operator=(DatabaseEngineRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DatabaseEngineRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DatabaseEngineRequest* internal_default_instance() {
+    return reinterpret_cast<const DatabaseEngineRequest*>(
+               &_DatabaseEngineRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(DatabaseEngineRequest& a, DatabaseEngineRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DatabaseEngineRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DatabaseEngineRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DatabaseEngineRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DatabaseEngineRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DatabaseEngineRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DatabaseEngineRequest& from) {
+    DatabaseEngineRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DatabaseEngineRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.DatabaseEngineRequest";
+  }
+  protected:
+  explicit DatabaseEngineRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParameterFieldNumber = 5,
+    kTextFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+    kStatementIdFieldNumber = 4,
+    kPrepareFieldNumber = 3,
+    kCloseStatementFieldNumber = 6,
+  };
+  // repeated .siodb.TypedValue parameter = 5;
+  int parameter_size() const;
+  private:
+  int _internal_parameter_size() const;
+  public:
+  void clear_parameter();
+  ::siodb::TypedValue* mutable_parameter(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >*
+      mutable_parameter();
+  private:
+  const ::siodb::TypedValue& _internal_parameter(int index) const;
+  ::siodb::TypedValue* _internal_add_parameter();
+  public:
+  const ::siodb::TypedValue& parameter(int index) const;
+  ::siodb::TypedValue* add_parameter();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >&
+      parameter() const;
+
+  // string text = 2;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 statement_id = 4;
+  void clear_statement_id();
+  uint64_t statement_id() const;
+  void set_statement_id(uint64_t value);
+  private:
+  uint64_t _internal_statement_id() const;
+  void _internal_set_statement_id(uint64_t value);
+  public:
+
+  // bool prepare = 3;
+  void clear_prepare();
+  bool prepare() const;
+  void set_prepare(bool value);
+  private:
+  bool _internal_prepare() const;
+  void _internal_set_prepare(bool value);
+  public:
+
+  // bool close_statement = 6;
+  void clear_close_statement();
+  bool close_statement() const;
+  void set_close_statement(bool value);
+  private:
+  bool _internal_close_statement() const;
+  void _internal_set_close_statement(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.DatabaseEngineRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue > parameter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    uint64_t request_id_;
+    uint64_t statement_id_;
+    bool prepare_;
+    bool close_statement_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Tag final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.Tag) */ {
+ public:
+  inline Tag() : Tag(nullptr) {}
+  ~Tag() override;
+  explicit PROTOBUF_CONSTEXPR Tag(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Tag(const Tag& from);
+  Tag(Tag&& from) noexcept
+    : Tag() {
+    *this = ::std::move(from);
+  }
+
+  inline Tag& operator=(const Tag& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Tag& operator=(Tag&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Tag& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ValueCase {
+    kBoolValue = 2,
+    kStringValue = 3,
+    VALUE_NOT_SET = 0,
+  };
+
+  static inline const Tag* internal_default_instance() {
+    return reinterpret_cast<const Tag*>(
+               &_Tag_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Tag& a, Tag& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Tag* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Tag* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Tag* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Tag>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Tag& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Tag& from) {
+    Tag::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Tag* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.Tag";
+  }
+  protected:
+  explicit Tag(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kBoolValueFieldNumber = 2,
+    kStringValueFieldNumber = 3,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // bool bool_value = 2;
+  bool has_bool_value() const;
+  private:
+  bool _internal_has_bool_value() const;
+  public:
+  void clear_bool_value();
+  bool bool_value() const;
+  void set_bool_value(bool value);
+  private:
+  bool _internal_bool_value() const;
+  void _internal_set_bool_value(bool value);
+  public:
+
+  // string string_value = 3;
+  bool has_string_value() const;
+  private:
+  bool _internal_has_string_value() const;
+  public:
+  void clear_string_value();
+  const std::string& string_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_value();
+  PROTOBUF_NODISCARD std::string* release_string_value();
+  void set_allocated_string_value(std::string* string_value);
+  private:
+  const std::string& _internal_string_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(const std::string& value);
+  std::string* _internal_mutable_string_value();
+  public:
+
+  void clear_value();
+  ValueCase value_case() const;
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.Tag)
+ private:
+  class _Internal;
+  void set_has_bool_value();
+  void set_has_string_value();
+
+  inline bool has_value() const;
+  inline void clear_has_value();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      bool bool_value_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_value_;
+    } value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DatabaseEngineResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.DatabaseEngineResponse) */ {
+ public:
+  inline DatabaseEngineResponse() : DatabaseEngineResponse(nullptr) {}
+  ~DatabaseEngineResponse() override;
+  explicit PROTOBUF_CONSTEXPR DatabaseEngineResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DatabaseEngineResponse(const DatabaseEngineResponse& from);
+  DatabaseEngineResponse(DatabaseEngineResponse&& from) noexcept
+    : DatabaseEngineResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DatabaseEngineResponse& operator=(const DatabaseEngineResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DatabaseEngineResponse& operator=(DatabaseEngineResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DatabaseEngineResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DatabaseEngineResponse* internal_default_instance() {
+    return reinterpret_cast<const DatabaseEngineResponse*>(
+               &_DatabaseEngineResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(DatabaseEngineResponse& a, DatabaseEngineResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DatabaseEngineResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DatabaseEngineResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DatabaseEngineResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DatabaseEngineResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DatabaseEngineResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DatabaseEngineResponse& from) {
+    DatabaseEngineResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DatabaseEngineResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.DatabaseEngineResponse";
+  }
+  protected:
+  explicit DatabaseEngineResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 2,
+    kFreetextMessageFieldNumber = 3,
+    kColumnDescriptionFieldNumber = 4,
+    kTagFieldNumber = 9,
+    kRequestIdFieldNumber = 1,
+    kResponseIdFieldNumber = 5,
+    kResponseCountFieldNumber = 6,
+    kAffectedRowCountFieldNumber = 8,
+    kHasAffectedRowCountFieldNumber = 7,
+    kParameterCountFieldNumber = 11,
+    kStatementIdFieldNumber = 10,
+  };
+  // repeated .siodb.StatusMessage message = 2;
+  int message_size() const;
+  private:
+  int _internal_message_size() const;
+  public:
+  void clear_message();
+  ::siodb::StatusMessage* mutable_message(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >*
+      mutable_message();
+  private:
+  const ::siodb::StatusMessage& _internal_message(int index) const;
+  ::siodb::StatusMessage* _internal_add_message();
+  public:
+  const ::siodb::StatusMessage& message(int index) const;
+  ::siodb::StatusMessage* add_message();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >&
+      message() const;
+
+  // repeated string freetext_message = 3;
+  int freetext_message_size() const;
+  private:
+  int _internal_freetext_message_size() const;
+  public:
+  void clear_freetext_message();
+  const std::string& freetext_message(int index) const;
+  std::string* mutable_freetext_message(int index);
+  void set_freetext_message(int index, const std::string& value);
+  void set_freetext_message(int index, std::string&& value);
+  void set_freetext_message(int index, const char* value);
+  void set_freetext_message(int index, const char* value, size_t size);
+  std::string* add_freetext_message();
+  void add_freetext_message(const std::string& value);
+  void add_freetext_message(std::string&& value);
+  void add_freetext_message(const char* value);
+  void add_freetext_message(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& freetext_message() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_freetext_message();
+  private:
+  const std::string& _internal_freetext_message(int index) const;
+  std::string* _internal_add_freetext_message();
+  public:
+
+  // repeated .siodb.ColumnDescription column_description = 4;
+  int column_description_size() const;
+  private:
+  int _internal_column_description_size() const;
+  public:
+  void clear_column_description();
+  ::siodb::ColumnDescription* mutable_column_description(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >*
+      mutable_column_description();
+  private:
+  const ::siodb::ColumnDescription& _internal_column_description(int index) const;
+  ::siodb::ColumnDescription* _internal_add_column_description();
+  public:
+  const ::siodb::ColumnDescription& column_description(int index) const;
+  ::siodb::ColumnDescription* add_column_description();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >&
+      column_description() const;
+
+  // repeated .siodb.iomgr_protocol.Tag tag = 9;
+  int tag_size() const;
+  private:
+  int _internal_tag_size() const;
+  public:
+  void clear_tag();
+  ::siodb::iomgr_protocol::Tag* mutable_tag(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::iomgr_protocol::Tag >*
+      mutable_tag();
+  private:
+  const ::siodb::iomgr_protocol::Tag& _internal_tag(int index) const;
+  ::siodb::iomgr_protocol::Tag* _internal_add_tag();
+  public:
+  const ::siodb::iomgr_protocol::Tag& tag(int index) const;
+  ::siodb::iomgr_protocol::Tag* add_tag();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::iomgr_protocol::Tag >&
+      tag() const;
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint32 response_id = 5;
+  void clear_response_id();
+  uint32_t response_id() const;
+  void set_response_id(uint32_t value);
+  private:
+  uint32_t _internal_response_id() const;
+  void _internal_set_response_id(uint32_t value);
+  public:
+
+  // uint32 response_count = 6;
+  void clear_response_count();
+  uint32_t response_count() const;
+  void set_response_count(uint32_t value);
+  private:
+  uint32_t _internal_response_count() const;
+  void _internal_set_response_count(uint32_t value);
+  public:
+
+  // uint64 affected_row_count = 8;
+  void clear_affected_row_count();
+  uint64_t affected_row_count() const;
+  void set_affected_row_count(uint64_t value);
+  private:
+  uint64_t _internal_affected_row_count() const;
+  void _internal_set_affected_row_count(uint64_t value);
+  public:
+
+  // bool has_affected_row_count = 7;
+  void clear_has_affected_row_count();
+  bool has_affected_row_count() const;
+  void set_has_affected_row_count(bool value);
+  private:
+  bool _internal_has_affected_row_count() const;
+  void _internal_set_has_affected_row_count(bool value);
+  public:
+
+  // uint32 parameter_count = 11;
+  void clear_parameter_count();
+  uint32_t parameter_count() const;
+  void set_parameter_count(uint32_t value);
+  private:
+  uint32_t _internal_parameter_count() const;
+  void _internal_set_parameter_count(uint32_t value);
+  public:
+
+  // uint64 statement_id = 10;
+  void clear_statement_id();
+  uint64_t statement_id() const;
+  void set_statement_id(uint64_t value);
+  private:
+  uint64_t _internal_statement_id() const;
+  void _internal_set_statement_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.DatabaseEngineResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage > message_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> freetext_message_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription > column_description_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::iomgr_protocol::Tag > tag_;
+    uint64_t request_id_;
+    uint32_t response_id_;
+    uint32_t response_count_;
+    uint64_t affected_row_count_;
+    bool has_affected_row_count_;
+    uint32_t parameter_count_;
+    uint64_t statement_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BeginAuthenticateUserRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.BeginAuthenticateUserRequest) */ {
+ public:
+  inline BeginAuthenticateUserRequest() : BeginAuthenticateUserRequest(nullptr) {}
+  ~BeginAuthenticateUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR BeginAuthenticateUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BeginAuthenticateUserRequest(const BeginAuthenticateUserRequest& from);
+  BeginAuthenticateUserRequest(BeginAuthenticateUserRequest&& from) noexcept
+    : BeginAuthenticateUserRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BeginAuthenticateUserRequest& operator=(const BeginAuthenticateUserRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BeginAuthenticateUserRequest& operator=(BeginAuthenticateUserRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BeginAuthenticateUserRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BeginAuthenticateUserRequest* internal_default_instance() {
+    return reinterpret_cast<const BeginAuthenticateUserRequest*>(
+               &_BeginAuthenticateUserRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(BeginAuthenticateUserRequest& a, BeginAuthenticateUserRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BeginAuthenticateUserRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BeginAuthenticateUserRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BeginAuthenticateUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BeginAuthenticateUserRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BeginAuthenticateUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BeginAuthenticateUserRequest& from) {
+    BeginAuthenticateUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BeginAuthenticateUserRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.BeginAuthenticateUserRequest";
+  }
+  protected:
+  explicit BeginAuthenticateUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserNameFieldNumber = 1,
+  };
+  // string user_name = 1;
+  void clear_user_name();
+  const std::string& user_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_name();
+  PROTOBUF_NODISCARD std::string* release_user_name();
+  void set_allocated_user_name(std::string* user_name);
+  private:
+  const std::string& _internal_user_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_name(const std::string& value);
+  std::string* _internal_mutable_user_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.BeginAuthenticateUserRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BeginAuthenticateUserResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.BeginAuthenticateUserResponse) */ {
+ public:
+  inline BeginAuthenticateUserResponse() : BeginAuthenticateUserResponse(nullptr) {}
+  ~BeginAuthenticateUserResponse() override;
+  explicit PROTOBUF_CONSTEXPR BeginAuthenticateUserResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BeginAuthenticateUserResponse(const BeginAuthenticateUserResponse& from);
+  BeginAuthenticateUserResponse(BeginAuthenticateUserResponse&& from) noexcept
+    : BeginAuthenticateUserResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BeginAuthenticateUserResponse& operator=(const BeginAuthenticateUserResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BeginAuthenticateUserResponse& operator=(BeginAuthenticateUserResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BeginAuthenticateUserResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BeginAuthenticateUserResponse* internal_default_instance() {
+    return reinterpret_cast<const BeginAuthenticateUserResponse*>(
+               &_BeginAuthenticateUserResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(BeginAuthenticateUserResponse& a, BeginAuthenticateUserResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BeginAuthenticateUserResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BeginAuthenticateUserResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BeginAuthenticateUserResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BeginAuthenticateUserResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BeginAuthenticateUserResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BeginAuthenticateUserResponse& from) {
+    BeginAuthenticateUserResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BeginAuthenticateUserResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.BeginAuthenticateUserResponse";
+  }
+  protected:
+  explicit BeginAuthenticateUserResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 2,
+    kSessionStartedFieldNumber = 1,
+  };
+  // .siodb.StatusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::siodb::StatusMessage& message() const;
+  PROTOBUF_NODISCARD ::siodb::StatusMessage* release_message();
+  ::siodb::StatusMessage* mutable_message();
+  void set_allocated_message(::siodb::StatusMessage* message);
+  private:
+  const ::siodb::StatusMessage& _internal_message() const;
+  ::siodb::StatusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::siodb::StatusMessage* message);
+  ::siodb::StatusMessage* unsafe_arena_release_message();
+
+  // bool session_started = 1;
+  void clear_session_started();
+  bool session_started() const;
+  void set_session_started(bool value);
+  private:
+  bool _internal_session_started() const;
+  void _internal_set_session_started(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.BeginAuthenticateUserResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::siodb::StatusMessage* message_;
+    bool session_started_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthenticateUserRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.AuthenticateUserRequest) */ {
+ public:
+  inline AuthenticateUserRequest() : AuthenticateUserRequest(nullptr) {}
+  ~AuthenticateUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR AuthenticateUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AuthenticateUserRequest(const AuthenticateUserRequest& from);
+  AuthenticateUserRequest(AuthenticateUserRequest&& from) noexcept
+    : AuthenticateUserRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline AuthenticateUserRequest& operator=(const AuthenticateUserRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthenticateUserRequest& operator=(AuthenticateUserRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AuthenticateUserRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthenticateUserRequest* internal_default_instance() {
+    return reinterpret_cast<const AuthenticateUserRequest*>(
+               &_AuthenticateUserRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(AuthenticateUserRequest& a, AuthenticateUserRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AuthenticateUserRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthenticateUserRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AuthenticateUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthenticateUserRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AuthenticateUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AuthenticateUserRequest& from) {
+    AuthenticateUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AuthenticateUserRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.AuthenticateUserRequest";
+  }
+  protected:
+  explicit AuthenticateUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChallengeFieldNumber = 1,
+    kSignatureFieldNumber = 2,
+  };
+  // bytes challenge = 1;
+  void clear_challenge();
+  const std::string& challenge() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_challenge(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_challenge();
+  PROTOBUF_NODISCARD std::string* release_challenge();
+  void set_allocated_challenge(std::string* challenge);
+  private:
+  const std::string& _internal_challenge() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_challenge(const std::string& value);
+  std::string* _internal_mutable_challenge();
+  public:
+
+  // bytes signature = 2;
+  void clear_signature();
+  const std::string& signature() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_signature(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_signature();
+  PROTOBUF_NODISCARD std::string* release_signature();
+  void set_allocated_signature(std::string* signature);
+  private:
+  const std::string& _internal_signature() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_signature(const std::string& value);
+  std::string* _internal_mutable_signature();
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.AuthenticateUserRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr challenge_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr signature_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthenticateUserResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.AuthenticateUserResponse) */ {
+ public:
+  inline AuthenticateUserResponse() : AuthenticateUserResponse(nullptr) {}
+  ~AuthenticateUserResponse() override;
+  explicit PROTOBUF_CONSTEXPR AuthenticateUserResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AuthenticateUserResponse(const AuthenticateUserResponse& from);
+  AuthenticateUserResponse(AuthenticateUserResponse&& from) noexcept
+    : AuthenticateUserResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AuthenticateUserResponse& operator=(const AuthenticateUserResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthenticateUserResponse& operator=(AuthenticateUserResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AuthenticateUserResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthenticateUserResponse* internal_default_instance() {
+    return reinterpret_cast<const AuthenticateUserResponse*>(
+               &_AuthenticateUserResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(AuthenticateUserResponse& a, AuthenticateUserResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AuthenticateUserResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthenticateUserResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AuthenticateUserResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthenticateUserResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AuthenticateUserResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AuthenticateUserResponse& from) {
+    AuthenticateUserResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AuthenticateUserResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.AuthenticateUserResponse";
+  }
+  protected:
+  explicit AuthenticateUserResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 3,
+    kMessageFieldNumber = 2,
+    kAuthenticatedFieldNumber = 1,
+  };
+  // string session_id = 3;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // .siodb.StatusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::siodb::StatusMessage& message() const;
+  PROTOBUF_NODISCARD ::siodb::StatusMessage* release_message();
+  ::siodb::StatusMessage* mutable_message();
+  void set_allocated_message(::siodb::StatusMessage* message);
+  private:
+  const ::siodb::StatusMessage& _internal_message() const;
+  ::siodb::StatusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::siodb::StatusMessage* message);
+  ::siodb::StatusMessage* unsafe_arena_release_message();
+
+  // bool authenticated = 1;
+  void clear_authenticated();
+  bool authenticated() const;
+  void set_authenticated(bool value);
+  private:
+  bool _internal_authenticated() const;
+  void _internal_set_authenticated(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.AuthenticateUserResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::siodb::StatusMessage* message_;
+    bool authenticated_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionFrameHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.iomgr_protocol.SessionFrameHeader) */ {
+ public:
+  inline SessionFrameHeader() : SessionFrameHeader(nullptr) {}
+  ~SessionFrameHeader() override;
+  explicit PROTOBUF_CONSTEXPR SessionFrameHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionFrameHeader(const SessionFrameHeader& from);
+  SessionFrameHeader(SessionFrameHeader&& from) noexcept
+    : SessionFrameHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionFrameHeader& operator=(const SessionFrameHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionFrameHeader& operator=(SessionFrameHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionFrameHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionFrameHeader* internal_default_instance() {
+    return reinterpret_cast<const SessionFrameHeader*>(
+               &_SessionFrameHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(SessionFrameHeader& a, SessionFrameHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionFrameHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionFrameHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionFrameHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionFrameHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionFrameHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionFrameHeader& from) {
+    SessionFrameHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionFrameHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.iomgr_protocol.SessionFrameHeader";
+  }
+  protected:
+  explicit SessionFrameHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kDataLengthFieldNumber = 3,
+    kWindowIncrementFieldNumber = 4,
+  };
+  // uint64 session_id = 1;
+  void clear_session_id();
+  uint64_t session_id() const;
+  void set_session_id(uint64_t value);
+  private:
+  uint64_t _internal_session_id() const;
+  void _internal_set_session_id(uint64_t value);
+  public:
+
+  // .siodb.iomgr_protocol.SessionFrameType type = 2;
+  void clear_type();
+  ::siodb::iomgr_protocol::SessionFrameType type() const;
+  void set_type(::siodb::iomgr_protocol::SessionFrameType value);
+  private:
+  ::siodb::iomgr_protocol::SessionFrameType _internal_type() const;
+  void _internal_set_type(::siodb::iomgr_protocol::SessionFrameType value);
+  public:
+
+  // uint32 data_length = 3;
+  void clear_data_length();
+  uint32_t data_length() const;
+  void set_data_length(uint32_t value);
+  private:
+  uint32_t _internal_data_length() const;
+  void _internal_set_data_length(uint32_t value);
+  public:
+
+  // uint32 window_increment = 4;
+  void clear_window_increment();
+  uint32_t window_increment() const;
+  void set_window_increment(uint32_t value);
+  private:
+  uint32_t _internal_window_increment() const;
+  void _internal_set_window_increment(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.iomgr_protocol.SessionFrameHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t session_id_;
+    int type_;
+    uint32_t data_length_;
+    uint32_t window_increment_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_IOManagerProtocol_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// DatabaseEngineRequest
+
+// uint64 request_id = 1;
+inline void DatabaseEngineRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t DatabaseEngineRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t DatabaseEngineRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineRequest.request_id)
+  return _internal_request_id();
+}
+inline void DatabaseEngineRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void DatabaseEngineRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineRequest.request_id)
+}
+
+// string text = 2;
+inline void DatabaseEngineRequest::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& DatabaseEngineRequest::text() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineRequest.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DatabaseEngineRequest::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineRequest.text)
+}
+inline std::string* DatabaseEngineRequest::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.DatabaseEngineRequest.text)
+  return _s;
+}
+inline const std::string& DatabaseEngineRequest::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void DatabaseEngineRequest::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DatabaseEngineRequest::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DatabaseEngineRequest::release_text() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.DatabaseEngineRequest.text)
+  return _impl_.text_.Release();
+}
+inline void DatabaseEngineRequest::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.DatabaseEngineRequest.text)
+}
+
+// bool prepare = 3;
+inline void DatabaseEngineRequest::clear_prepare() {
+  _impl_.prepare_ = false;
+}
+inline bool DatabaseEngineRequest::_internal_prepare() const {
+  return _impl_.prepare_;
+}
+inline bool DatabaseEngineRequest::prepare() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineRequest.prepare)
+  return _internal_prepare();
+}
+inline void DatabaseEngineRequest::_internal_set_prepare(bool value) {
+  
+  _impl_.prepare_ = value;
+}
+inline void DatabaseEngineRequest::set_prepare(bool value) {
+  _internal_set_prepare(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineRequest.prepare)
+}
+
+// uint64 statement_id = 4;
+inline void DatabaseEngineRequest::clear_statement_id() {
+  _impl_.statement_id_ = uint64_t{0u};
+}
+inline uint64_t DatabaseEngineRequest::_internal_statement_id() const {
+  return _impl_.statement_id_;
+}
+inline uint64_t DatabaseEngineRequest::statement_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineRequest.statement_id)
+  return _internal_statement_id();
+}
+inline void DatabaseEngineRequest::_internal_set_statement_id(uint64_t value) {
+  
+  _impl_.statement_id_ = value;
+}
+inline void DatabaseEngineRequest::set_statement_id(uint64_t value) {
+  _internal_set_statement_id(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineRequest.statement_id)
+}
+
+// repeated .siodb.TypedValue parameter = 5;
+inline int DatabaseEngineRequest::_internal_parameter_size() const {
+  return _impl_.parameter_.size();
+}
+inline int DatabaseEngineRequest::parameter_size() const {
+  return _internal_parameter_size();
+}
+inline ::siodb::TypedValue* DatabaseEngineRequest::mutable_parameter(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.DatabaseEngineRequest.parameter)
+  return _impl_.parameter_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >*
+DatabaseEngineRequest::mutable_parameter() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.iomgr_protocol.DatabaseEngineRequest.parameter)
+  return &_impl_.parameter_;
+}
+inline const ::siodb::TypedValue& DatabaseEngineRequest::_internal_parameter(int index) const {
+  return _impl_.parameter_.Get(index);
+}
+inline const ::siodb::TypedValue& DatabaseEngineRequest::parameter(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineRequest.parameter)
+  return _internal_parameter(index);
+}
+inline ::siodb::TypedValue* DatabaseEngineRequest::_internal_add_parameter() {
+  return _impl_.parameter_.Add();
+}
+inline ::siodb::TypedValue* DatabaseEngineRequest::add_parameter() {
+  ::siodb::TypedValue* _add = _internal_add_parameter();
+  // @@protoc_insertion_point(field_add:siodb.iomgr_protocol.DatabaseEngineRequest.parameter)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::TypedValue >&
+DatabaseEngineRequest::parameter() const {
+  // @@protoc_insertion_point(field_list:siodb.iomgr_protocol.DatabaseEngineRequest.parameter)
+  return _impl_.parameter_;
+}
+
+// bool close_statement = 6;
+inline void DatabaseEngineRequest::clear_close_statement() {
+  _impl_.close_statement_ = false;
+}
+inline bool DatabaseEngineRequest::_internal_close_statement() const {
+  return _impl_.close_statement_;
+}
+inline bool DatabaseEngineRequest::close_statement() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineRequest.close_statement)
+  return _internal_close_statement();
+}
+inline void DatabaseEngineRequest::_internal_set_close_statement(bool value) {
+  
+  _impl_.close_statement_ = value;
+}
+inline void DatabaseEngineRequest::set_close_statement(bool value) {
+  _internal_set_close_statement(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineRequest.close_statement)
+}
+
+// -------------------------------------------------------------------
+
+// Tag
+
+// string name = 1;
+inline void Tag::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Tag::name() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.Tag.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Tag::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.Tag.name)
+}
+inline std::string* Tag::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.Tag.name)
+  return _s;
+}
+inline const std::string& Tag::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Tag::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Tag::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Tag::release_name() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.Tag.name)
+  return _impl_.name_.Release();
+}
+inline void Tag::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.Tag.name)
+}
+
+// bool bool_value = 2;
+inline bool Tag::_internal_has_bool_value() const {
+  return value_case() == kBoolValue;
+}
+inline bool Tag::has_bool_value() const {
+  return _internal_has_bool_value();
+}
+inline void Tag::set_has_bool_value() {
+  _impl_._oneof_case_[0] = kBoolValue;
+}
+inline void Tag::clear_bool_value() {
+  if (_internal_has_bool_value()) {
+    _impl_.value_.bool_value_ = false;
+    clear_has_value();
+  }
+}
+inline bool Tag::_internal_bool_value() const {
+  if (_internal_has_bool_value()) {
+    return _impl_.value_.bool_value_;
+  }
+  return false;
+}
+inline void Tag::_internal_set_bool_value(bool value) {
+  if (!_internal_has_bool_value()) {
+    clear_value();
+    set_has_bool_value();
+  }
+  _impl_.value_.bool_value_ = value;
+}
+inline bool Tag::bool_value() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.Tag.bool_value)
+  return _internal_bool_value();
+}
+inline void Tag::set_bool_value(bool value) {
+  _internal_set_bool_value(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.Tag.bool_value)
+}
+
+// string string_value = 3;
+inline bool Tag::_internal_has_string_value() const {
+  return value_case() == kStringValue;
+}
+inline bool Tag::has_string_value() const {
+  return _internal_has_string_value();
+}
+inline void Tag::set_has_string_value() {
+  _impl_._oneof_case_[0] = kStringValue;
+}
+inline void Tag::clear_string_value() {
+  if (_internal_has_string_value()) {
+    _impl_.value_.string_value_.Destroy();
+    clear_has_value();
+  }
+}
+inline const std::string& Tag::string_value() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.Tag.string_value)
+  return _internal_string_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Tag::set_string_value(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  _impl_.value_.string_value_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.Tag.string_value)
+}
+inline std::string* Tag::mutable_string_value() {
+  std::string* _s = _internal_mutable_string_value();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.Tag.string_value)
+  return _s;
+}
+inline const std::string& Tag::_internal_string_value() const {
+  if (_internal_has_string_value()) {
+    return _impl_.value_.string_value_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Tag::_internal_set_string_value(const std::string& value) {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  _impl_.value_.string_value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Tag::_internal_mutable_string_value() {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  return _impl_.value_.string_value_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Tag::release_string_value() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.Tag.string_value)
+  if (_internal_has_string_value()) {
+    clear_has_value();
+    return _impl_.value_.string_value_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Tag::set_allocated_string_value(std::string* string_value) {
+  if (has_value()) {
+    clear_value();
+  }
+  if (string_value != nullptr) {
+    set_has_string_value();
+    _impl_.value_.string_value_.InitAllocated(string_value, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.Tag.string_value)
+}
+
+inline bool Tag::has_value() const {
+  return value_case() != VALUE_NOT_SET;
+}
+inline void Tag::clear_has_value() {
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+inline Tag::ValueCase Tag::value_case() const {
+  return Tag::ValueCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// DatabaseEngineResponse
+
+// uint64 request_id = 1;
+inline void DatabaseEngineResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t DatabaseEngineResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t DatabaseEngineResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.request_id)
+  return _internal_request_id();
+}
+inline void DatabaseEngineResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void DatabaseEngineResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.request_id)
+}
+
+// repeated .siodb.StatusMessage message = 2;
+inline int DatabaseEngineResponse::_internal_message_size() const {
+  return _impl_.message_.size();
+}
+inline int DatabaseEngineResponse::message_size() const {
+  return _internal_message_size();
+}
+inline ::siodb::StatusMessage* DatabaseEngineResponse::mutable_message(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.DatabaseEngineResponse.message)
+  return _impl_.message_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >*
+DatabaseEngineResponse::mutable_message() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.iomgr_protocol.DatabaseEngineResponse.message)
+  return &_impl_.message_;
+}
+inline const ::siodb::StatusMessage& DatabaseEngineResponse::_internal_message(int index) const {
+  return _impl_.message_.Get(index);
+}
+inline const ::siodb::StatusMessage& DatabaseEngineResponse::message(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.message)
+  return _internal_message(index);
+}
+inline ::siodb::StatusMessage* DatabaseEngineResponse::_internal_add_message() {
+  return _impl_.message_.Add();
+}
+inline ::siodb::StatusMessage* DatabaseEngineResponse::add_message() {
+  ::siodb::StatusMessage* _add = _internal_add_message();
+  // @@protoc_insertion_point(field_add:siodb.iomgr_protocol.DatabaseEngineResponse.message)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::StatusMessage >&
+DatabaseEngineResponse::message() const {
+  // @@protoc_insertion_point(field_list:siodb.iomgr_protocol.DatabaseEngineResponse.message)
+  return _impl_.message_;
+}
+
+// repeated string freetext_message = 3;
+inline int DatabaseEngineResponse::_internal_freetext_message_size() const {
+  return _impl_.freetext_message_.size();
+}
+inline int DatabaseEngineResponse::freetext_message_size() const {
+  return _internal_freetext_message_size();
+}
+inline void DatabaseEngineResponse::clear_freetext_message() {
+  _impl_.freetext_message_.Clear();
+}
+inline std::string* DatabaseEngineResponse::add_freetext_message() {
+  std::string* _s = _internal_add_freetext_message();
+  // @@protoc_insertion_point(field_add_mutable:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+  return _s;
+}
+inline const std::string& DatabaseEngineResponse::_internal_freetext_message(int index) const {
+  return _impl_.freetext_message_.Get(index);
+}
+inline const std::string& DatabaseEngineResponse::freetext_message(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+  return _internal_freetext_message(index);
+}
+inline std::string* DatabaseEngineResponse::mutable_freetext_message(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+  return _impl_.freetext_message_.Mutable(index);
+}
+inline void DatabaseEngineResponse::set_freetext_message(int index, const std::string& value) {
+  _impl_.freetext_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline void DatabaseEngineResponse::set_freetext_message(int index, std::string&& value) {
+  _impl_.freetext_message_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline void DatabaseEngineResponse::set_freetext_message(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.freetext_message_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline void DatabaseEngineResponse::set_freetext_message(int index, const char* value, size_t size) {
+  _impl_.freetext_message_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline std::string* DatabaseEngineResponse::_internal_add_freetext_message() {
+  return _impl_.freetext_message_.Add();
+}
+inline void DatabaseEngineResponse::add_freetext_message(const std::string& value) {
+  _impl_.freetext_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline void DatabaseEngineResponse::add_freetext_message(std::string&& value) {
+  _impl_.freetext_message_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline void DatabaseEngineResponse::add_freetext_message(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.freetext_message_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline void DatabaseEngineResponse::add_freetext_message(const char* value, size_t size) {
+  _impl_.freetext_message_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+DatabaseEngineResponse::freetext_message() const {
+  // @@protoc_insertion_point(field_list:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+  return _impl_.freetext_message_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+DatabaseEngineResponse::mutable_freetext_message() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.iomgr_protocol.DatabaseEngineResponse.freetext_message)
+  return &_impl_.freetext_message_;
+}
+
+// repeated .siodb.ColumnDescription column_description = 4;
+inline int DatabaseEngineResponse::_internal_column_description_size() const {
+  return _impl_.column_description_.size();
+}
+inline int DatabaseEngineResponse::column_description_size() const {
+  return _internal_column_description_size();
+}
+inline ::siodb::ColumnDescription* DatabaseEngineResponse::mutable_column_description(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.DatabaseEngineResponse.column_description)
+  return _impl_.column_description_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >*
+DatabaseEngineResponse::mutable_column_description() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.iomgr_protocol.DatabaseEngineResponse.column_description)
+  return &_impl_.column_description_;
+}
+inline const ::siodb::ColumnDescription& DatabaseEngineResponse::_internal_column_description(int index) const {
+  return _impl_.column_description_.Get(index);
+}
+inline const ::siodb::ColumnDescription& DatabaseEngineResponse::column_description(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.column_description)
+  return _internal_column_description(index);
+}
+inline ::siodb::ColumnDescription* DatabaseEngineResponse::_internal_add_column_description() {
+  return _impl_.column_description_.Add();
+}
+inline ::siodb::ColumnDescription* DatabaseEngineResponse::add_column_description() {
+  ::siodb::ColumnDescription* _add = _internal_add_column_description();
+  // @@protoc_insertion_point(field_add:siodb.iomgr_protocol.DatabaseEngineResponse.column_description)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::ColumnDescription >&
+DatabaseEngineResponse::column_description() const {
+  // @@protoc_insertion_point(field_list:siodb.iomgr_protocol.DatabaseEngineResponse.column_description)
+  return _impl_.column_description_;
+}
+
+// uint32 response_id = 5;
+inline void DatabaseEngineResponse::clear_response_id() {
+  _impl_.response_id_ = 0u;
+}
+inline uint32_t DatabaseEngineResponse::_internal_response_id() const {
+  return _impl_.response_id_;
+}
+inline uint32_t DatabaseEngineResponse::response_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.response_id)
+  return _internal_response_id();
+}
+inline void DatabaseEngineResponse::_internal_set_response_id(uint32_t value) {
+  
+  _impl_.response_id_ = value;
+}
+inline void DatabaseEngineResponse::set_response_id(uint32_t value) {
+  _internal_set_response_id(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.response_id)
+}
+
+// uint32 response_count = 6;
+inline void DatabaseEngineResponse::clear_response_count() {
+  _impl_.response_count_ = 0u;
+}
+inline uint32_t DatabaseEngineResponse::_internal_response_count() const {
+  return _impl_.response_count_;
+}
+inline uint32_t DatabaseEngineResponse::response_count() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.response_count)
+  return _internal_response_count();
+}
+inline void DatabaseEngineResponse::_internal_set_response_count(uint32_t value) {
+  
+  _impl_.response_count_ = value;
+}
+inline void DatabaseEngineResponse::set_response_count(uint32_t value) {
+  _internal_set_response_count(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.response_count)
+}
+
+// bool has_affected_row_count = 7;
+inline void DatabaseEngineResponse::clear_has_affected_row_count() {
+  _impl_.has_affected_row_count_ = false;
+}
+inline bool DatabaseEngineResponse::_internal_has_affected_row_count() const {
+  return _impl_.has_affected_row_count_;
+}
+inline bool DatabaseEngineResponse::has_affected_row_count() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.has_affected_row_count)
+  return _internal_has_affected_row_count();
+}
+inline void DatabaseEngineResponse::_internal_set_has_affected_row_count(bool value) {
+  
+  _impl_.has_affected_row_count_ = value;
+}
+inline void DatabaseEngineResponse::set_has_affected_row_count(bool value) {
+  _internal_set_has_affected_row_count(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.has_affected_row_count)
+}
+
+// uint64 affected_row_count = 8;
+inline void DatabaseEngineResponse::clear_affected_row_count() {
+  _impl_.affected_row_count_ = uint64_t{0u};
+}
+inline uint64_t DatabaseEngineResponse::_internal_affected_row_count() const {
+  return _impl_.affected_row_count_;
+}
+inline uint64_t DatabaseEngineResponse::affected_row_count() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.affected_row_count)
+  return _internal_affected_row_count();
+}
+inline void DatabaseEngineResponse::_internal_set_affected_row_count(uint64_t value) {
+  
+  _impl_.affected_row_count_ = value;
+}
+inline void DatabaseEngineResponse::set_affected_row_count(uint64_t value) {
+  _internal_set_affected_row_count(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.affected_row_count)
+}
+
+// repeated .siodb.iomgr_protocol.Tag tag = 9;
+inline int DatabaseEngineResponse::_internal_tag_size() const {
+  return _impl_.tag_.size();
+}
+inline int DatabaseEngineResponse::tag_size() const {
+  return _internal_tag_size();
+}
+inline void DatabaseEngineResponse::clear_tag() {
+  _impl_.tag_.Clear();
+}
+inline ::siodb::iomgr_protocol::Tag* DatabaseEngineResponse::mutable_tag(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.DatabaseEngineResponse.tag)
+  return _impl_.tag_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::iomgr_protocol::Tag >*
+DatabaseEngineResponse::mutable_tag() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.iomgr_protocol.DatabaseEngineResponse.tag)
+  return &_impl_.tag_;
+}
+inline const ::siodb::iomgr_protocol::Tag& DatabaseEngineResponse::_internal_tag(int index) const {
+  return _impl_.tag_.Get(index);
+}
+inline const ::siodb::iomgr_protocol::Tag& DatabaseEngineResponse::tag(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.tag)
+  return _internal_tag(index);
+}
+inline ::siodb::iomgr_protocol::Tag* DatabaseEngineResponse::_internal_add_tag() {
+  return _impl_.tag_.Add();
+}
+inline ::siodb::iomgr_protocol::Tag* DatabaseEngineResponse::add_tag() {
+  ::siodb::iomgr_protocol::Tag* _add = _internal_add_tag();
+  // @@protoc_insertion_point(field_add:siodb.iomgr_protocol.DatabaseEngineResponse.tag)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::iomgr_protocol::Tag >&
+DatabaseEngineResponse::tag() const {
+  // @@protoc_insertion_point(field_list:siodb.iomgr_protocol.DatabaseEngineResponse.tag)
+  return _impl_.tag_;
+}
+
+// uint64 statement_id = 10;
+inline void DatabaseEngineResponse::clear_statement_id() {
+  _impl_.statement_id_ = uint64_t{0u};
+}
+inline uint64_t DatabaseEngineResponse::_internal_statement_id() const {
+  return _impl_.statement_id_;
+}
+inline uint64_t DatabaseEngineResponse::statement_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.statement_id)
+  return _internal_statement_id();
+}
+inline void DatabaseEngineResponse::_internal_set_statement_id(uint64_t value) {
+  
+  _impl_.statement_id_ = value;
+}
+inline void DatabaseEngineResponse::set_statement_id(uint64_t value) {
+  _internal_set_statement_id(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.statement_id)
+}
+
+// uint32 parameter_count = 11;
+inline void DatabaseEngineResponse::clear_parameter_count() {
+  _impl_.parameter_count_ = 0u;
+}
+inline uint32_t DatabaseEngineResponse::_internal_parameter_count() const {
+  return _impl_.parameter_count_;
+}
+inline uint32_t DatabaseEngineResponse::parameter_count() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.DatabaseEngineResponse.parameter_count)
+  return _internal_parameter_count();
+}
+inline void DatabaseEngineResponse::_internal_set_parameter_count(uint32_t value) {
+  
+  _impl_.parameter_count_ = value;
+}
+inline void DatabaseEngineResponse::set_parameter_count(uint32_t value) {
+  _internal_set_parameter_count(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.DatabaseEngineResponse.parameter_count)
+}
+
+// -------------------------------------------------------------------
+
+// BeginAuthenticateUserRequest
+
+// string user_name = 1;
+inline void BeginAuthenticateUserRequest::clear_user_name() {
+  _impl_.user_name_.ClearToEmpty();
+}
+inline const std::string& BeginAuthenticateUserRequest::user_name() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name)
+  return _internal_user_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BeginAuthenticateUserRequest::set_user_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.user_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name)
+}
+inline std::string* BeginAuthenticateUserRequest::mutable_user_name() {
+  std::string* _s = _internal_mutable_user_name();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name)
+  return _s;
+}
+inline const std::string& BeginAuthenticateUserRequest::_internal_user_name() const {
+  return _impl_.user_name_.Get();
+}
+inline void BeginAuthenticateUserRequest::_internal_set_user_name(const std::string& value) {
+  
+  _impl_.user_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BeginAuthenticateUserRequest::_internal_mutable_user_name() {
+  
+  return _impl_.user_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BeginAuthenticateUserRequest::release_user_name() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name)
+  return _impl_.user_name_.Release();
+}
+inline void BeginAuthenticateUserRequest::set_allocated_user_name(std::string* user_name) {
+  if (user_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.user_name_.SetAllocated(user_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_name_.IsDefault()) {
+    _impl_.user_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.BeginAuthenticateUserRequest.user_name)
+}
+
+// -------------------------------------------------------------------
+
+// BeginAuthenticateUserResponse
+
+// bool session_started = 1;
+inline void BeginAuthenticateUserResponse::clear_session_started() {
+  _impl_.session_started_ = false;
+}
+inline bool BeginAuthenticateUserResponse::_internal_session_started() const {
+  return _impl_.session_started_;
+}
+inline bool BeginAuthenticateUserResponse::session_started() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.BeginAuthenticateUserResponse.session_started)
+  return _internal_session_started();
+}
+inline void BeginAuthenticateUserResponse::_internal_set_session_started(bool value) {
+  
+  _impl_.session_started_ = value;
+}
+inline void BeginAuthenticateUserResponse::set_session_started(bool value) {
+  _internal_set_session_started(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.BeginAuthenticateUserResponse.session_started)
+}
+
+// .siodb.StatusMessage message = 2;
+inline bool BeginAuthenticateUserResponse::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool BeginAuthenticateUserResponse::has_message() const {
+  return _internal_has_message();
+}
+inline const ::siodb::StatusMessage& BeginAuthenticateUserResponse::_internal_message() const {
+  const ::siodb::StatusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::siodb::StatusMessage&>(
+      ::siodb::_StatusMessage_default_instance_);
+}
+inline const ::siodb::StatusMessage& BeginAuthenticateUserResponse::message() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.BeginAuthenticateUserResponse.message)
+  return _internal_message();
+}
+inline void BeginAuthenticateUserResponse::unsafe_arena_set_allocated_message(
+    ::siodb::StatusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:siodb.iomgr_protocol.BeginAuthenticateUserResponse.message)
+}
+inline ::siodb::StatusMessage* BeginAuthenticateUserResponse::release_message() {
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::siodb::StatusMessage* BeginAuthenticateUserResponse::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.BeginAuthenticateUserResponse.message)
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::siodb::StatusMessage* BeginAuthenticateUserResponse::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::siodb::StatusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::siodb::StatusMessage* BeginAuthenticateUserResponse::mutable_message() {
+  ::siodb::StatusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.BeginAuthenticateUserResponse.message)
+  return _msg;
+}
+inline void BeginAuthenticateUserResponse::set_allocated_message(::siodb::StatusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.BeginAuthenticateUserResponse.message)
+}
+
+// -------------------------------------------------------------------
+
+// AuthenticateUserRequest
+
+// bytes challenge = 1;
+inline void AuthenticateUserRequest::clear_challenge() {
+  _impl_.challenge_.ClearToEmpty();
+}
+inline const std::string& AuthenticateUserRequest::challenge() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.AuthenticateUserRequest.challenge)
+  return _internal_challenge();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthenticateUserRequest::set_challenge(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.challenge_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.AuthenticateUserRequest.challenge)
+}
+inline std::string* AuthenticateUserRequest::mutable_challenge() {
+  std::string* _s = _internal_mutable_challenge();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.AuthenticateUserRequest.challenge)
+  return _s;
+}
+inline const std::string& AuthenticateUserRequest::_internal_challenge() const {
+  return _impl_.challenge_.Get();
+}
+inline void AuthenticateUserRequest::_internal_set_challenge(const std::string& value) {
+  
+  _impl_.challenge_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthenticateUserRequest::_internal_mutable_challenge() {
+  
+  return _impl_.challenge_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthenticateUserRequest::release_challenge() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.AuthenticateUserRequest.challenge)
+  return _impl_.challenge_.Release();
+}
+inline void AuthenticateUserRequest::set_allocated_challenge(std::string* challenge) {
+  if (challenge != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.challenge_.SetAllocated(challenge, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.challenge_.IsDefault()) {
+    _impl_.challenge_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.AuthenticateUserRequest.challenge)
+}
+
+// bytes signature = 2;
+inline void AuthenticateUserRequest::clear_signature() {
+  _impl_.signature_.ClearToEmpty();
+}
+inline const std::string& AuthenticateUserRequest::signature() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.AuthenticateUserRequest.signature)
+  return _internal_signature();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthenticateUserRequest::set_signature(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.signature_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.AuthenticateUserRequest.signature)
+}
+inline std::string* AuthenticateUserRequest::mutable_signature() {
+  std::string* _s = _internal_mutable_signature();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.AuthenticateUserRequest.signature)
+  return _s;
+}
+inline const std::string& AuthenticateUserRequest::_internal_signature() const {
+  return _impl_.signature_.Get();
+}
+inline void AuthenticateUserRequest::_internal_set_signature(const std::string& value) {
+  
+  _impl_.signature_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthenticateUserRequest::_internal_mutable_signature() {
+  
+  return _impl_.signature_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthenticateUserRequest::release_signature() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.AuthenticateUserRequest.signature)
+  return _impl_.signature_.Release();
+}
+inline void AuthenticateUserRequest::set_allocated_signature(std::string* signature) {
+  if (signature != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.signature_.SetAllocated(signature, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.signature_.IsDefault()) {
+    _impl_.signature_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.AuthenticateUserRequest.signature)
+}
+
+// -------------------------------------------------------------------
+
+// AuthenticateUserResponse
+
+// bool authenticated = 1;
+inline void AuthenticateUserResponse::clear_authenticated() {
+  _impl_.authenticated_ = false;
+}
+inline bool AuthenticateUserResponse::_internal_authenticated() const {
+  return _impl_.authenticated_;
+}
+inline bool AuthenticateUserResponse::authenticated() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.AuthenticateUserResponse.authenticated)
+  return _internal_authenticated();
+}
+inline void AuthenticateUserResponse::_internal_set_authenticated(bool value) {
+  
+  _impl_.authenticated_ = value;
+}
+inline void AuthenticateUserResponse::set_authenticated(bool value) {
+  _internal_set_authenticated(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.AuthenticateUserResponse.authenticated)
+}
+
+// .siodb.StatusMessage message = 2;
+inline bool AuthenticateUserResponse::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool AuthenticateUserResponse::has_message() const {
+  return _internal_has_message();
+}
+inline const ::siodb::StatusMessage& AuthenticateUserResponse::_internal_message() const {
+  const ::siodb::StatusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::siodb::StatusMessage&>(
+      ::siodb::_StatusMessage_default_instance_);
+}
+inline const ::siodb::StatusMessage& AuthenticateUserResponse::message() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.AuthenticateUserResponse.message)
+  return _internal_message();
+}
+inline void AuthenticateUserResponse::unsafe_arena_set_allocated_message(
+    ::siodb::StatusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:siodb.iomgr_protocol.AuthenticateUserResponse.message)
+}
+inline ::siodb::StatusMessage* AuthenticateUserResponse::release_message() {
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::siodb::StatusMessage* AuthenticateUserResponse::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.AuthenticateUserResponse.message)
+  
+  ::siodb::StatusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::siodb::StatusMessage* AuthenticateUserResponse::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::siodb::StatusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::siodb::StatusMessage* AuthenticateUserResponse::mutable_message() {
+  ::siodb::StatusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.AuthenticateUserResponse.message)
+  return _msg;
+}
+inline void AuthenticateUserResponse::set_allocated_message(::siodb::StatusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.AuthenticateUserResponse.message)
+}
+
+// string session_id = 3;
+inline void AuthenticateUserResponse::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& AuthenticateUserResponse::session_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.AuthenticateUserResponse.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AuthenticateUserResponse::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.AuthenticateUserResponse.session_id)
+}
+inline std::string* AuthenticateUserResponse::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:siodb.iomgr_protocol.AuthenticateUserResponse.session_id)
+  return _s;
+}
+inline const std::string& AuthenticateUserResponse::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void AuthenticateUserResponse::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AuthenticateUserResponse::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AuthenticateUserResponse::release_session_id() {
+  // @@protoc_insertion_point(field_release:siodb.iomgr_protocol.AuthenticateUserResponse.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void AuthenticateUserResponse::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.iomgr_protocol.AuthenticateUserResponse.session_id)
+}
+
+// -------------------------------------------------------------------
+
+// SessionFrameHeader
+
+// uint64 session_id = 1;
+inline void SessionFrameHeader::clear_session_id() {
+  _impl_.session_id_ = uint64_t{0u};
+}
+inline uint64_t SessionFrameHeader::_internal_session_id() const {
+  return _impl_.session_id_;
+}
+inline uint64_t SessionFrameHeader::session_id() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.SessionFrameHeader.session_id)
+  return _internal_session_id();
+}
+inline void SessionFrameHeader::_internal_set_session_id(uint64_t value) {
+  
+  _impl_.session_id_ = value;
+}
+inline void SessionFrameHeader::set_session_id(uint64_t value) {
+  _internal_set_session_id(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.SessionFrameHeader.session_id)
+}
+
+// .siodb.iomgr_protocol.SessionFrameType type = 2;
+inline void SessionFrameHeader::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::siodb::iomgr_protocol::SessionFrameType SessionFrameHeader::_internal_type() const {
+  return static_cast< ::siodb::iomgr_protocol::SessionFrameType >(_impl_.type_);
+}
+inline ::siodb::iomgr_protocol::SessionFrameType SessionFrameHeader::type() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.SessionFrameHeader.type)
+  return _internal_type();
+}
+inline void SessionFrameHeader::_internal_set_type(::siodb::iomgr_protocol::SessionFrameType value) {
+  
+  _impl_.type_ = value;
+}
+inline void SessionFrameHeader::set_type(::siodb::iomgr_protocol::SessionFrameType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.SessionFrameHeader.type)
+}
+
+// uint32 data_length = 3;
+inline void SessionFrameHeader::clear_data_length() {
+  _impl_.data_length_ = 0u;
+}
+inline uint32_t SessionFrameHeader::_internal_data_length() const {
+  return _impl_.data_length_;
+}
+inline uint32_t SessionFrameHeader::data_length() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.SessionFrameHeader.data_length)
+  return _internal_data_length();
+}
+inline void SessionFrameHeader::_internal_set_data_length(uint32_t value) {
+  
+  _impl_.data_length_ = value;
+}
+inline void SessionFrameHeader::set_data_length(uint32_t value) {
+  _internal_set_data_length(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.SessionFrameHeader.data_length)
+}
+
+// uint32 window_increment = 4;
+inline void SessionFrameHeader::clear_window_increment() {
+  _impl_.window_increment_ = 0u;
+}
+inline uint32_t SessionFrameHeader::_internal_window_increment() const {
+  return _impl_.window_increment_;
+}
+inline uint32_t SessionFrameHeader::window_increment() const {
+  // @@protoc_insertion_point(field_get:siodb.iomgr_protocol.SessionFrameHeader.window_increment)
+  return _internal_window_increment();
+}
+inline void SessionFrameHeader::_internal_set_window_increment(uint32_t value) {
+  
+  _impl_.window_increment_ = value;
+}
+inline void SessionFrameHeader::set_window_increment(uint32_t value) {
+  _internal_set_window_increment(value);
+  // @@protoc_insertion_point(field_set:siodb.iomgr_protocol.SessionFrameHeader.window_increment)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace iomgr_protocol
+}  // namespace siodb
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::siodb::iomgr_protocol::SessionFrameType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::siodb::iomgr_protocol::SessionFrameType>() {
+  return ::siodb::iomgr_protocol::SessionFrameType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_IOManagerProtocol_2eproto
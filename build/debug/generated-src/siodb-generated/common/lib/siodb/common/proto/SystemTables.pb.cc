@@ -0,0 +1,2090 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SystemTables.proto
+
+#include "SystemTables.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace siodb {
+namespace database_info {
+PROTOBUF_CONSTEXPR SystemObjectList::SystemObjectList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.constraint_definition_)*/{}
+  , /*decltype(_impl_.table_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemObjectListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemObjectListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemObjectListDefaultTypeInternal() {}
+  union {
+    SystemObjectList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemObjectListDefaultTypeInternal _SystemObjectList_default_instance_;
+PROTOBUF_CONSTEXPR SystemTableColumnConstraintDefinition::SystemTableColumnConstraintDefinition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.expr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemTableColumnConstraintDefinitionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemTableColumnConstraintDefinitionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemTableColumnConstraintDefinitionDefaultTypeInternal() {}
+  union {
+    SystemTableColumnConstraintDefinition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemTableColumnConstraintDefinitionDefaultTypeInternal _SystemTableColumnConstraintDefinition_default_instance_;
+PROTOBUF_CONSTEXPR SystemTable::SystemTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.column_set_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemTableDefaultTypeInternal() {}
+  union {
+    SystemTable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemTableDefaultTypeInternal _SystemTable_default_instance_;
+PROTOBUF_CONSTEXPR SystemTableColumnSet::SystemTableColumnSet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.column_)*/{}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemTableColumnSetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemTableColumnSetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemTableColumnSetDefaultTypeInternal() {}
+  union {
+    SystemTableColumnSet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemTableColumnSetDefaultTypeInternal _SystemTableColumnSet_default_instance_;
+PROTOBUF_CONSTEXPR SystemTableColumnSetColumn::SystemTableColumnSetColumn(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.column_)*/{}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemTableColumnSetColumnDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemTableColumnSetColumnDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemTableColumnSetColumnDefaultTypeInternal() {}
+  union {
+    SystemTableColumnSetColumn _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemTableColumnSetColumnDefaultTypeInternal _SystemTableColumnSetColumn_default_instance_;
+PROTOBUF_CONSTEXPR SystemTableColumn::SystemTableColumn(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.constraint_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.definition_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemTableColumnDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemTableColumnDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemTableColumnDefaultTypeInternal() {}
+  union {
+    SystemTableColumn _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemTableColumnDefaultTypeInternal _SystemTableColumn_default_instance_;
+PROTOBUF_CONSTEXPR SystemTableColumnConstraint::SystemTableColumnConstraint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.association_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.definition_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SystemTableColumnConstraintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SystemTableColumnConstraintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SystemTableColumnConstraintDefaultTypeInternal() {}
+  union {
+    SystemTableColumnConstraint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SystemTableColumnConstraintDefaultTypeInternal _SystemTableColumnConstraint_default_instance_;
+}  // namespace database_info
+}  // namespace siodb
+static ::_pb::Metadata file_level_metadata_SystemTables_2eproto[7];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_SystemTables_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SystemTables_2eproto = nullptr;
+
+const uint32_t TableStruct_SystemTables_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemObjectList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemObjectList, _impl_.constraint_definition_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemObjectList, _impl_.table_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraintDefinition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraintDefinition, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraintDefinition, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraintDefinition, _impl_.expr_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTable, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTable, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTable, _impl_.column_set_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnSet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnSet, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnSet, _impl_.column_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnSetColumn, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnSetColumn, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnSetColumn, _impl_.column_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumn, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumn, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumn, _impl_.definition_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumn, _impl_.data_type_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumn, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumn, _impl_.constraint_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraint, _impl_.association_id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraint, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraint, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::siodb::database_info::SystemTableColumnConstraint, _impl_.definition_id_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::siodb::database_info::SystemObjectList)},
+  { 8, -1, -1, sizeof(::siodb::database_info::SystemTableColumnConstraintDefinition)},
+  { 17, -1, -1, sizeof(::siodb::database_info::SystemTable)},
+  { 26, -1, -1, sizeof(::siodb::database_info::SystemTableColumnSet)},
+  { 34, -1, -1, sizeof(::siodb::database_info::SystemTableColumnSetColumn)},
+  { 42, -1, -1, sizeof(::siodb::database_info::SystemTableColumn)},
+  { 53, -1, -1, sizeof(::siodb::database_info::SystemTableColumnConstraint)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::siodb::database_info::_SystemObjectList_default_instance_._instance,
+  &::siodb::database_info::_SystemTableColumnConstraintDefinition_default_instance_._instance,
+  &::siodb::database_info::_SystemTable_default_instance_._instance,
+  &::siodb::database_info::_SystemTableColumnSet_default_instance_._instance,
+  &::siodb::database_info::_SystemTableColumnSetColumn_default_instance_._instance,
+  &::siodb::database_info::_SystemTableColumn_default_instance_._instance,
+  &::siodb::database_info::_SystemTableColumnConstraint_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_SystemTables_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022SystemTables.proto\022\023siodb.database_inf"
+  "o\032\024ColumnDataType.proto\"\236\001\n\020SystemObject"
+  "List\022Y\n\025constraint_definition\030\001 \003(\0132:.si"
+  "odb.database_info.SystemTableColumnConst"
+  "raintDefinition\022/\n\005table\030\002 \003(\0132 .siodb.d"
+  "atabase_info.SystemTable\"O\n%SystemTableC"
+  "olumnConstraintDefinition\022\n\n\002id\030\001 \001(\004\022\014\n"
+  "\004type\030\002 \001(\005\022\014\n\004expr\030\003 \001(\014\"f\n\013SystemTable"
+  "\022\n\n\002id\030\001 \001(\r\022\014\n\004name\030\002 \001(\t\022=\n\ncolumn_set"
+  "\030\003 \001(\0132).siodb.database_info.SystemTable"
+  "ColumnSet\"c\n\024SystemTableColumnSet\022\n\n\002id\030"
+  "\001 \001(\004\022\?\n\006column\030\002 \003(\0132/.siodb.database_i"
+  "nfo.SystemTableColumnSetColumn\"`\n\032System"
+  "TableColumnSetColumn\022\n\n\002id\030\001 \001(\004\0226\n\006colu"
+  "mn\030\002 \003(\0132&.siodb.database_info.SystemTab"
+  "leColumn\"\264\001\n\021SystemTableColumn\022\n\n\002id\030\001 \001"
+  "(\004\022\025\n\rdefinition_id\030\002 \001(\004\022(\n\tdata_type\030\003"
+  " \001(\0162\025.siodb.ColumnDataType\022\014\n\004name\030\004 \001("
+  "\t\022D\n\nconstraint\030\005 \003(\01320.siodb.database_i"
+  "nfo.SystemTableColumnConstraint\"f\n\033Syste"
+  "mTableColumnConstraint\022\026\n\016association_id"
+  "\030\001 \001(\004\022\n\n\002id\030\002 \001(\004\022\014\n\004name\030\003 \001(\t\022\025\n\rdefi"
+  "nition_id\030\004 \001(\004B\002H\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_SystemTables_2eproto_deps[1] = {
+  &::descriptor_table_ColumnDataType_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_SystemTables_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_SystemTables_2eproto = {
+    false, false, 907, descriptor_table_protodef_SystemTables_2eproto,
+    "SystemTables.proto",
+    &descriptor_table_SystemTables_2eproto_once, descriptor_table_SystemTables_2eproto_deps, 1, 7,
+    schemas, file_default_instances, TableStruct_SystemTables_2eproto::offsets,
+    file_level_metadata_SystemTables_2eproto, file_level_enum_descriptors_SystemTables_2eproto,
+    file_level_service_descriptors_SystemTables_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_SystemTables_2eproto_getter() {
+  return &descriptor_table_SystemTables_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_SystemTables_2eproto(&descriptor_table_SystemTables_2eproto);
+namespace siodb {
+namespace database_info {
+
+// ===================================================================
+
+class SystemObjectList::_Internal {
+ public:
+};
+
+SystemObjectList::SystemObjectList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemObjectList)
+}
+SystemObjectList::SystemObjectList(const SystemObjectList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemObjectList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.constraint_definition_){from._impl_.constraint_definition_}
+    , decltype(_impl_.table_){from._impl_.table_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemObjectList)
+}
+
+inline void SystemObjectList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.constraint_definition_){arena}
+    , decltype(_impl_.table_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SystemObjectList::~SystemObjectList() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemObjectList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemObjectList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.constraint_definition_.~RepeatedPtrField();
+  _impl_.table_.~RepeatedPtrField();
+}
+
+void SystemObjectList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemObjectList::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemObjectList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.constraint_definition_.Clear();
+  _impl_.table_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemObjectList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .siodb.database_info.SystemTableColumnConstraintDefinition constraint_definition = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_constraint_definition(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.database_info.SystemTable table = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_table(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemObjectList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemObjectList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .siodb.database_info.SystemTableColumnConstraintDefinition constraint_definition = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_constraint_definition_size()); i < n; i++) {
+    const auto& repfield = this->_internal_constraint_definition(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .siodb.database_info.SystemTable table = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_table_size()); i < n; i++) {
+    const auto& repfield = this->_internal_table(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemObjectList)
+  return target;
+}
+
+size_t SystemObjectList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemObjectList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.database_info.SystemTableColumnConstraintDefinition constraint_definition = 1;
+  total_size += 1UL * this->_internal_constraint_definition_size();
+  for (const auto& msg : this->_impl_.constraint_definition_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .siodb.database_info.SystemTable table = 2;
+  total_size += 1UL * this->_internal_table_size();
+  for (const auto& msg : this->_impl_.table_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemObjectList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemObjectList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemObjectList::GetClassData() const { return &_class_data_; }
+
+
+void SystemObjectList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemObjectList*>(&to_msg);
+  auto& from = static_cast<const SystemObjectList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemObjectList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.constraint_definition_.MergeFrom(from._impl_.constraint_definition_);
+  _this->_impl_.table_.MergeFrom(from._impl_.table_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemObjectList::CopyFrom(const SystemObjectList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemObjectList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemObjectList::IsInitialized() const {
+  return true;
+}
+
+void SystemObjectList::InternalSwap(SystemObjectList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.constraint_definition_.InternalSwap(&other->_impl_.constraint_definition_);
+  _impl_.table_.InternalSwap(&other->_impl_.table_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemObjectList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[0]);
+}
+
+// ===================================================================
+
+class SystemTableColumnConstraintDefinition::_Internal {
+ public:
+};
+
+SystemTableColumnConstraintDefinition::SystemTableColumnConstraintDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemTableColumnConstraintDefinition)
+}
+SystemTableColumnConstraintDefinition::SystemTableColumnConstraintDefinition(const SystemTableColumnConstraintDefinition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemTableColumnConstraintDefinition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.expr_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.expr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_expr().empty()) {
+    _this->_impl_.expr_.Set(from._internal_expr(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemTableColumnConstraintDefinition)
+}
+
+inline void SystemTableColumnConstraintDefinition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.expr_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.expr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SystemTableColumnConstraintDefinition::~SystemTableColumnConstraintDefinition() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemTableColumnConstraintDefinition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemTableColumnConstraintDefinition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.expr_.Destroy();
+}
+
+void SystemTableColumnConstraintDefinition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemTableColumnConstraintDefinition::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemTableColumnConstraintDefinition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.expr_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemTableColumnConstraintDefinition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes expr = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_expr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemTableColumnConstraintDefinition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemTableColumnConstraintDefinition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // int32 type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_type(), target);
+  }
+
+  // bytes expr = 3;
+  if (!this->_internal_expr().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_expr(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemTableColumnConstraintDefinition)
+  return target;
+}
+
+size_t SystemTableColumnConstraintDefinition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemTableColumnConstraintDefinition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes expr = 3;
+  if (!this->_internal_expr().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_expr());
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // int32 type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemTableColumnConstraintDefinition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemTableColumnConstraintDefinition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemTableColumnConstraintDefinition::GetClassData() const { return &_class_data_; }
+
+
+void SystemTableColumnConstraintDefinition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemTableColumnConstraintDefinition*>(&to_msg);
+  auto& from = static_cast<const SystemTableColumnConstraintDefinition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemTableColumnConstraintDefinition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_expr().empty()) {
+    _this->_internal_set_expr(from._internal_expr());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemTableColumnConstraintDefinition::CopyFrom(const SystemTableColumnConstraintDefinition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemTableColumnConstraintDefinition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemTableColumnConstraintDefinition::IsInitialized() const {
+  return true;
+}
+
+void SystemTableColumnConstraintDefinition::InternalSwap(SystemTableColumnConstraintDefinition* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.expr_, lhs_arena,
+      &other->_impl_.expr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SystemTableColumnConstraintDefinition, _impl_.type_)
+      + sizeof(SystemTableColumnConstraintDefinition::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(SystemTableColumnConstraintDefinition, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemTableColumnConstraintDefinition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[1]);
+}
+
+// ===================================================================
+
+class SystemTable::_Internal {
+ public:
+  static const ::siodb::database_info::SystemTableColumnSet& column_set(const SystemTable* msg);
+};
+
+const ::siodb::database_info::SystemTableColumnSet&
+SystemTable::_Internal::column_set(const SystemTable* msg) {
+  return *msg->_impl_.column_set_;
+}
+SystemTable::SystemTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemTable)
+}
+SystemTable::SystemTable(const SystemTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.column_set_){nullptr}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_column_set()) {
+    _this->_impl_.column_set_ = new ::siodb::database_info::SystemTableColumnSet(*from._impl_.column_set_);
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemTable)
+}
+
+inline void SystemTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.column_set_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SystemTable::~SystemTable() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.column_set_;
+}
+
+void SystemTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.column_set_ != nullptr) {
+    delete _impl_.column_set_;
+  }
+  _impl_.column_set_ = nullptr;
+  _impl_.id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.database_info.SystemTable.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.database_info.SystemTableColumnSet column_set = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_column_set(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.database_info.SystemTable.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // .siodb.database_info.SystemTableColumnSet column_set = 3;
+  if (this->_internal_has_column_set()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::column_set(this),
+        _Internal::column_set(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemTable)
+  return target;
+}
+
+size_t SystemTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemTable)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .siodb.database_info.SystemTableColumnSet column_set = 3;
+  if (this->_internal_has_column_set()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.column_set_);
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemTable::GetClassData() const { return &_class_data_; }
+
+
+void SystemTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemTable*>(&to_msg);
+  auto& from = static_cast<const SystemTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_column_set()) {
+    _this->_internal_mutable_column_set()->::siodb::database_info::SystemTableColumnSet::MergeFrom(
+        from._internal_column_set());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemTable::CopyFrom(const SystemTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemTable::IsInitialized() const {
+  return true;
+}
+
+void SystemTable::InternalSwap(SystemTable* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SystemTable, _impl_.id_)
+      + sizeof(SystemTable::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(SystemTable, _impl_.column_set_)>(
+          reinterpret_cast<char*>(&_impl_.column_set_),
+          reinterpret_cast<char*>(&other->_impl_.column_set_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[2]);
+}
+
+// ===================================================================
+
+class SystemTableColumnSet::_Internal {
+ public:
+};
+
+SystemTableColumnSet::SystemTableColumnSet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemTableColumnSet)
+}
+SystemTableColumnSet::SystemTableColumnSet(const SystemTableColumnSet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemTableColumnSet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.column_){from._impl_.column_}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemTableColumnSet)
+}
+
+inline void SystemTableColumnSet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.column_){arena}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SystemTableColumnSet::~SystemTableColumnSet() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemTableColumnSet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemTableColumnSet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.column_.~RepeatedPtrField();
+}
+
+void SystemTableColumnSet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemTableColumnSet::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemTableColumnSet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.column_.Clear();
+  _impl_.id_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemTableColumnSet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.database_info.SystemTableColumnSetColumn column = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_column(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemTableColumnSet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemTableColumnSet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // repeated .siodb.database_info.SystemTableColumnSetColumn column = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_column_size()); i < n; i++) {
+    const auto& repfield = this->_internal_column(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemTableColumnSet)
+  return target;
+}
+
+size_t SystemTableColumnSet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemTableColumnSet)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.database_info.SystemTableColumnSetColumn column = 2;
+  total_size += 1UL * this->_internal_column_size();
+  for (const auto& msg : this->_impl_.column_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemTableColumnSet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemTableColumnSet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemTableColumnSet::GetClassData() const { return &_class_data_; }
+
+
+void SystemTableColumnSet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemTableColumnSet*>(&to_msg);
+  auto& from = static_cast<const SystemTableColumnSet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemTableColumnSet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.column_.MergeFrom(from._impl_.column_);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemTableColumnSet::CopyFrom(const SystemTableColumnSet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemTableColumnSet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemTableColumnSet::IsInitialized() const {
+  return true;
+}
+
+void SystemTableColumnSet::InternalSwap(SystemTableColumnSet* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.column_.InternalSwap(&other->_impl_.column_);
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemTableColumnSet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[3]);
+}
+
+// ===================================================================
+
+class SystemTableColumnSetColumn::_Internal {
+ public:
+};
+
+SystemTableColumnSetColumn::SystemTableColumnSetColumn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemTableColumnSetColumn)
+}
+SystemTableColumnSetColumn::SystemTableColumnSetColumn(const SystemTableColumnSetColumn& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemTableColumnSetColumn* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.column_){from._impl_.column_}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemTableColumnSetColumn)
+}
+
+inline void SystemTableColumnSetColumn::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.column_){arena}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SystemTableColumnSetColumn::~SystemTableColumnSetColumn() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemTableColumnSetColumn)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemTableColumnSetColumn::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.column_.~RepeatedPtrField();
+}
+
+void SystemTableColumnSetColumn::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemTableColumnSetColumn::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemTableColumnSetColumn)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.column_.Clear();
+  _impl_.id_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemTableColumnSetColumn::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.database_info.SystemTableColumn column = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_column(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemTableColumnSetColumn::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemTableColumnSetColumn)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // repeated .siodb.database_info.SystemTableColumn column = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_column_size()); i < n; i++) {
+    const auto& repfield = this->_internal_column(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemTableColumnSetColumn)
+  return target;
+}
+
+size_t SystemTableColumnSetColumn::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemTableColumnSetColumn)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.database_info.SystemTableColumn column = 2;
+  total_size += 1UL * this->_internal_column_size();
+  for (const auto& msg : this->_impl_.column_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemTableColumnSetColumn::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemTableColumnSetColumn::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemTableColumnSetColumn::GetClassData() const { return &_class_data_; }
+
+
+void SystemTableColumnSetColumn::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemTableColumnSetColumn*>(&to_msg);
+  auto& from = static_cast<const SystemTableColumnSetColumn&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemTableColumnSetColumn)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.column_.MergeFrom(from._impl_.column_);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemTableColumnSetColumn::CopyFrom(const SystemTableColumnSetColumn& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemTableColumnSetColumn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemTableColumnSetColumn::IsInitialized() const {
+  return true;
+}
+
+void SystemTableColumnSetColumn::InternalSwap(SystemTableColumnSetColumn* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.column_.InternalSwap(&other->_impl_.column_);
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemTableColumnSetColumn::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[4]);
+}
+
+// ===================================================================
+
+class SystemTableColumn::_Internal {
+ public:
+};
+
+SystemTableColumn::SystemTableColumn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemTableColumn)
+}
+SystemTableColumn::SystemTableColumn(const SystemTableColumn& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemTableColumn* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.constraint_){from._impl_.constraint_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.definition_id_){}
+    , decltype(_impl_.data_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_type_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.data_type_));
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemTableColumn)
+}
+
+inline void SystemTableColumn::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.constraint_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.definition_id_){uint64_t{0u}}
+    , decltype(_impl_.data_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SystemTableColumn::~SystemTableColumn() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemTableColumn)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemTableColumn::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.constraint_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void SystemTableColumn::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemTableColumn::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemTableColumn)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.constraint_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.data_type_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.data_type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemTableColumn::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 definition_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.definition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .siodb.ColumnDataType data_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_data_type(static_cast<::siodb::ColumnDataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.database_info.SystemTableColumn.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .siodb.database_info.SystemTableColumnConstraint constraint = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_constraint(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemTableColumn::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemTableColumn)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // uint64 definition_id = 2;
+  if (this->_internal_definition_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_definition_id(), target);
+  }
+
+  // .siodb.ColumnDataType data_type = 3;
+  if (this->_internal_data_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_data_type(), target);
+  }
+
+  // string name = 4;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.database_info.SystemTableColumn.name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name(), target);
+  }
+
+  // repeated .siodb.database_info.SystemTableColumnConstraint constraint = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_constraint_size()); i < n; i++) {
+    const auto& repfield = this->_internal_constraint(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemTableColumn)
+  return target;
+}
+
+size_t SystemTableColumn::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemTableColumn)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .siodb.database_info.SystemTableColumnConstraint constraint = 5;
+  total_size += 1UL * this->_internal_constraint_size();
+  for (const auto& msg : this->_impl_.constraint_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 4;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // uint64 definition_id = 2;
+  if (this->_internal_definition_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_definition_id());
+  }
+
+  // .siodb.ColumnDataType data_type = 3;
+  if (this->_internal_data_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_data_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemTableColumn::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemTableColumn::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemTableColumn::GetClassData() const { return &_class_data_; }
+
+
+void SystemTableColumn::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemTableColumn*>(&to_msg);
+  auto& from = static_cast<const SystemTableColumn&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemTableColumn)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.constraint_.MergeFrom(from._impl_.constraint_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_definition_id() != 0) {
+    _this->_internal_set_definition_id(from._internal_definition_id());
+  }
+  if (from._internal_data_type() != 0) {
+    _this->_internal_set_data_type(from._internal_data_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemTableColumn::CopyFrom(const SystemTableColumn& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemTableColumn)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemTableColumn::IsInitialized() const {
+  return true;
+}
+
+void SystemTableColumn::InternalSwap(SystemTableColumn* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.constraint_.InternalSwap(&other->_impl_.constraint_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SystemTableColumn, _impl_.data_type_)
+      + sizeof(SystemTableColumn::_impl_.data_type_)
+      - PROTOBUF_FIELD_OFFSET(SystemTableColumn, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemTableColumn::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[5]);
+}
+
+// ===================================================================
+
+class SystemTableColumnConstraint::_Internal {
+ public:
+};
+
+SystemTableColumnConstraint::SystemTableColumnConstraint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:siodb.database_info.SystemTableColumnConstraint)
+}
+SystemTableColumnConstraint::SystemTableColumnConstraint(const SystemTableColumnConstraint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SystemTableColumnConstraint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.association_id_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.definition_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.association_id_, &from._impl_.association_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.definition_id_) -
+    reinterpret_cast<char*>(&_impl_.association_id_)) + sizeof(_impl_.definition_id_));
+  // @@protoc_insertion_point(copy_constructor:siodb.database_info.SystemTableColumnConstraint)
+}
+
+inline void SystemTableColumnConstraint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.association_id_){uint64_t{0u}}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.definition_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SystemTableColumnConstraint::~SystemTableColumnConstraint() {
+  // @@protoc_insertion_point(destructor:siodb.database_info.SystemTableColumnConstraint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SystemTableColumnConstraint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void SystemTableColumnConstraint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SystemTableColumnConstraint::Clear() {
+// @@protoc_insertion_point(message_clear_start:siodb.database_info.SystemTableColumnConstraint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.association_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.definition_id_) -
+      reinterpret_cast<char*>(&_impl_.association_id_)) + sizeof(_impl_.definition_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SystemTableColumnConstraint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 association_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.association_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "siodb.database_info.SystemTableColumnConstraint.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 definition_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.definition_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SystemTableColumnConstraint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:siodb.database_info.SystemTableColumnConstraint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 association_id = 1;
+  if (this->_internal_association_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_association_id(), target);
+  }
+
+  // uint64 id = 2;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_id(), target);
+  }
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "siodb.database_info.SystemTableColumnConstraint.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  // uint64 definition_id = 4;
+  if (this->_internal_definition_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_definition_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:siodb.database_info.SystemTableColumnConstraint)
+  return target;
+}
+
+size_t SystemTableColumnConstraint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:siodb.database_info.SystemTableColumnConstraint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 association_id = 1;
+  if (this->_internal_association_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_association_id());
+  }
+
+  // uint64 id = 2;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // uint64 definition_id = 4;
+  if (this->_internal_definition_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_definition_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SystemTableColumnConstraint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SystemTableColumnConstraint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SystemTableColumnConstraint::GetClassData() const { return &_class_data_; }
+
+
+void SystemTableColumnConstraint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SystemTableColumnConstraint*>(&to_msg);
+  auto& from = static_cast<const SystemTableColumnConstraint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:siodb.database_info.SystemTableColumnConstraint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_association_id() != 0) {
+    _this->_internal_set_association_id(from._internal_association_id());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_definition_id() != 0) {
+    _this->_internal_set_definition_id(from._internal_definition_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SystemTableColumnConstraint::CopyFrom(const SystemTableColumnConstraint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:siodb.database_info.SystemTableColumnConstraint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SystemTableColumnConstraint::IsInitialized() const {
+  return true;
+}
+
+void SystemTableColumnConstraint::InternalSwap(SystemTableColumnConstraint* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SystemTableColumnConstraint, _impl_.definition_id_)
+      + sizeof(SystemTableColumnConstraint::_impl_.definition_id_)
+      - PROTOBUF_FIELD_OFFSET(SystemTableColumnConstraint, _impl_.association_id_)>(
+          reinterpret_cast<char*>(&_impl_.association_id_),
+          reinterpret_cast<char*>(&other->_impl_.association_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SystemTableColumnConstraint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SystemTables_2eproto_getter, &descriptor_table_SystemTables_2eproto_once,
+      file_level_metadata_SystemTables_2eproto[6]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace database_info
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemObjectList*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemObjectList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemObjectList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemTableColumnConstraintDefinition*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemTableColumnConstraintDefinition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemTableColumnConstraintDefinition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemTable*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemTableColumnSet*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemTableColumnSet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemTableColumnSet >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemTableColumnSetColumn*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemTableColumnSetColumn >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemTableColumnSetColumn >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemTableColumn*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemTableColumn >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemTableColumn >(arena);
+}
+template<> PROTOBUF_NOINLINE ::siodb::database_info::SystemTableColumnConstraint*
+Arena::CreateMaybeMessage< ::siodb::database_info::SystemTableColumnConstraint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::siodb::database_info::SystemTableColumnConstraint >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
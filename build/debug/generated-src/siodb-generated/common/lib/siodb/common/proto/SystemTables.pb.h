@@ -0,0 +1,2118 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SystemTables.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_SystemTables_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_SystemTables_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "ColumnDataType.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_SystemTables_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_SystemTables_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_SystemTables_2eproto;
+namespace siodb {
+namespace database_info {
+class SystemObjectList;
+struct SystemObjectListDefaultTypeInternal;
+extern SystemObjectListDefaultTypeInternal _SystemObjectList_default_instance_;
+class SystemTable;
+struct SystemTableDefaultTypeInternal;
+extern SystemTableDefaultTypeInternal _SystemTable_default_instance_;
+class SystemTableColumn;
+struct SystemTableColumnDefaultTypeInternal;
+extern SystemTableColumnDefaultTypeInternal _SystemTableColumn_default_instance_;
+class SystemTableColumnConstraint;
+struct SystemTableColumnConstraintDefaultTypeInternal;
+extern SystemTableColumnConstraintDefaultTypeInternal _SystemTableColumnConstraint_default_instance_;
+class SystemTableColumnConstraintDefinition;
+struct SystemTableColumnConstraintDefinitionDefaultTypeInternal;
+extern SystemTableColumnConstraintDefinitionDefaultTypeInternal _SystemTableColumnConstraintDefinition_default_instance_;
+class SystemTableColumnSet;
+struct SystemTableColumnSetDefaultTypeInternal;
+extern SystemTableColumnSetDefaultTypeInternal _SystemTableColumnSet_default_instance_;
+class SystemTableColumnSetColumn;
+struct SystemTableColumnSetColumnDefaultTypeInternal;
+extern SystemTableColumnSetColumnDefaultTypeInternal _SystemTableColumnSetColumn_default_instance_;
+}  // namespace database_info
+}  // namespace siodb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::siodb::database_info::SystemObjectList* Arena::CreateMaybeMessage<::siodb::database_info::SystemObjectList>(Arena*);
+template<> ::siodb::database_info::SystemTable* Arena::CreateMaybeMessage<::siodb::database_info::SystemTable>(Arena*);
+template<> ::siodb::database_info::SystemTableColumn* Arena::CreateMaybeMessage<::siodb::database_info::SystemTableColumn>(Arena*);
+template<> ::siodb::database_info::SystemTableColumnConstraint* Arena::CreateMaybeMessage<::siodb::database_info::SystemTableColumnConstraint>(Arena*);
+template<> ::siodb::database_info::SystemTableColumnConstraintDefinition* Arena::CreateMaybeMessage<::siodb::database_info::SystemTableColumnConstraintDefinition>(Arena*);
+template<> ::siodb::database_info::SystemTableColumnSet* Arena::CreateMaybeMessage<::siodb::database_info::SystemTableColumnSet>(Arena*);
+template<> ::siodb::database_info::SystemTableColumnSetColumn* Arena::CreateMaybeMessage<::siodb::database_info::SystemTableColumnSetColumn>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace siodb {
+namespace database_info {
+
+// ===================================================================
+
+class SystemObjectList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemObjectList) */ {
+ public:
+  inline SystemObjectList() : SystemObjectList(nullptr) {}
+  ~SystemObjectList() override;
+  explicit PROTOBUF_CONSTEXPR SystemObjectList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemObjectList(const SystemObjectList& from);
+  SystemObjectList(SystemObjectList&& from) noexcept
+    : SystemObjectList() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemObjectList& operator=(const SystemObjectList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemObjectList& operator=(SystemObjectList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemObjectList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemObjectList* internal_default_instance() {
+    return reinterpret_cast<const SystemObjectList*>(
+               &_SystemObjectList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SystemObjectList& a, SystemObjectList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemObjectList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemObjectList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemObjectList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemObjectList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemObjectList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemObjectList& from) {
+    SystemObjectList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemObjectList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemObjectList";
+  }
+  protected:
+  explicit SystemObjectList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConstraintDefinitionFieldNumber = 1,
+    kTableFieldNumber = 2,
+  };
+  // repeated .siodb.database_info.SystemTableColumnConstraintDefinition constraint_definition = 1;
+  int constraint_definition_size() const;
+  private:
+  int _internal_constraint_definition_size() const;
+  public:
+  void clear_constraint_definition();
+  ::siodb::database_info::SystemTableColumnConstraintDefinition* mutable_constraint_definition(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraintDefinition >*
+      mutable_constraint_definition();
+  private:
+  const ::siodb::database_info::SystemTableColumnConstraintDefinition& _internal_constraint_definition(int index) const;
+  ::siodb::database_info::SystemTableColumnConstraintDefinition* _internal_add_constraint_definition();
+  public:
+  const ::siodb::database_info::SystemTableColumnConstraintDefinition& constraint_definition(int index) const;
+  ::siodb::database_info::SystemTableColumnConstraintDefinition* add_constraint_definition();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraintDefinition >&
+      constraint_definition() const;
+
+  // repeated .siodb.database_info.SystemTable table = 2;
+  int table_size() const;
+  private:
+  int _internal_table_size() const;
+  public:
+  void clear_table();
+  ::siodb::database_info::SystemTable* mutable_table(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTable >*
+      mutable_table();
+  private:
+  const ::siodb::database_info::SystemTable& _internal_table(int index) const;
+  ::siodb::database_info::SystemTable* _internal_add_table();
+  public:
+  const ::siodb::database_info::SystemTable& table(int index) const;
+  ::siodb::database_info::SystemTable* add_table();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTable >&
+      table() const;
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemObjectList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraintDefinition > constraint_definition_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTable > table_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SystemTableColumnConstraintDefinition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemTableColumnConstraintDefinition) */ {
+ public:
+  inline SystemTableColumnConstraintDefinition() : SystemTableColumnConstraintDefinition(nullptr) {}
+  ~SystemTableColumnConstraintDefinition() override;
+  explicit PROTOBUF_CONSTEXPR SystemTableColumnConstraintDefinition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemTableColumnConstraintDefinition(const SystemTableColumnConstraintDefinition& from);
+  SystemTableColumnConstraintDefinition(SystemTableColumnConstraintDefinition&& from) noexcept
+    : SystemTableColumnConstraintDefinition() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemTableColumnConstraintDefinition& operator=(const SystemTableColumnConstraintDefinition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemTableColumnConstraintDefinition& operator=(SystemTableColumnConstraintDefinition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemTableColumnConstraintDefinition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemTableColumnConstraintDefinition* internal_default_instance() {
+    return reinterpret_cast<const SystemTableColumnConstraintDefinition*>(
+               &_SystemTableColumnConstraintDefinition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SystemTableColumnConstraintDefinition& a, SystemTableColumnConstraintDefinition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemTableColumnConstraintDefinition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemTableColumnConstraintDefinition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemTableColumnConstraintDefinition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemTableColumnConstraintDefinition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemTableColumnConstraintDefinition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemTableColumnConstraintDefinition& from) {
+    SystemTableColumnConstraintDefinition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemTableColumnConstraintDefinition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemTableColumnConstraintDefinition";
+  }
+  protected:
+  explicit SystemTableColumnConstraintDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExprFieldNumber = 3,
+    kIdFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // bytes expr = 3;
+  void clear_expr();
+  const std::string& expr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_expr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_expr();
+  PROTOBUF_NODISCARD std::string* release_expr();
+  void set_allocated_expr(std::string* expr);
+  private:
+  const std::string& _internal_expr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_expr(const std::string& value);
+  std::string* _internal_mutable_expr();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // int32 type = 2;
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemTableColumnConstraintDefinition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr expr_;
+    uint64_t id_;
+    int32_t type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SystemTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemTable) */ {
+ public:
+  inline SystemTable() : SystemTable(nullptr) {}
+  ~SystemTable() override;
+  explicit PROTOBUF_CONSTEXPR SystemTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemTable(const SystemTable& from);
+  SystemTable(SystemTable&& from) noexcept
+    : SystemTable() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemTable& operator=(const SystemTable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemTable& operator=(SystemTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemTable* internal_default_instance() {
+    return reinterpret_cast<const SystemTable*>(
+               &_SystemTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SystemTable& a, SystemTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemTable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemTable& from) {
+    SystemTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemTable";
+  }
+  protected:
+  explicit SystemTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kColumnSetFieldNumber = 3,
+    kIdFieldNumber = 1,
+  };
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .siodb.database_info.SystemTableColumnSet column_set = 3;
+  bool has_column_set() const;
+  private:
+  bool _internal_has_column_set() const;
+  public:
+  void clear_column_set();
+  const ::siodb::database_info::SystemTableColumnSet& column_set() const;
+  PROTOBUF_NODISCARD ::siodb::database_info::SystemTableColumnSet* release_column_set();
+  ::siodb::database_info::SystemTableColumnSet* mutable_column_set();
+  void set_allocated_column_set(::siodb::database_info::SystemTableColumnSet* column_set);
+  private:
+  const ::siodb::database_info::SystemTableColumnSet& _internal_column_set() const;
+  ::siodb::database_info::SystemTableColumnSet* _internal_mutable_column_set();
+  public:
+  void unsafe_arena_set_allocated_column_set(
+      ::siodb::database_info::SystemTableColumnSet* column_set);
+  ::siodb::database_info::SystemTableColumnSet* unsafe_arena_release_column_set();
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemTable)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::siodb::database_info::SystemTableColumnSet* column_set_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SystemTableColumnSet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemTableColumnSet) */ {
+ public:
+  inline SystemTableColumnSet() : SystemTableColumnSet(nullptr) {}
+  ~SystemTableColumnSet() override;
+  explicit PROTOBUF_CONSTEXPR SystemTableColumnSet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemTableColumnSet(const SystemTableColumnSet& from);
+  SystemTableColumnSet(SystemTableColumnSet&& from) noexcept
+    : SystemTableColumnSet() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemTableColumnSet& operator=(const SystemTableColumnSet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemTableColumnSet& operator=(SystemTableColumnSet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemTableColumnSet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemTableColumnSet* internal_default_instance() {
+    return reinterpret_cast<const SystemTableColumnSet*>(
+               &_SystemTableColumnSet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SystemTableColumnSet& a, SystemTableColumnSet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemTableColumnSet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemTableColumnSet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemTableColumnSet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemTableColumnSet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemTableColumnSet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemTableColumnSet& from) {
+    SystemTableColumnSet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemTableColumnSet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemTableColumnSet";
+  }
+  protected:
+  explicit SystemTableColumnSet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kColumnFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // repeated .siodb.database_info.SystemTableColumnSetColumn column = 2;
+  int column_size() const;
+  private:
+  int _internal_column_size() const;
+  public:
+  void clear_column();
+  ::siodb::database_info::SystemTableColumnSetColumn* mutable_column(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnSetColumn >*
+      mutable_column();
+  private:
+  const ::siodb::database_info::SystemTableColumnSetColumn& _internal_column(int index) const;
+  ::siodb::database_info::SystemTableColumnSetColumn* _internal_add_column();
+  public:
+  const ::siodb::database_info::SystemTableColumnSetColumn& column(int index) const;
+  ::siodb::database_info::SystemTableColumnSetColumn* add_column();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnSetColumn >&
+      column() const;
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemTableColumnSet)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnSetColumn > column_;
+    uint64_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SystemTableColumnSetColumn final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemTableColumnSetColumn) */ {
+ public:
+  inline SystemTableColumnSetColumn() : SystemTableColumnSetColumn(nullptr) {}
+  ~SystemTableColumnSetColumn() override;
+  explicit PROTOBUF_CONSTEXPR SystemTableColumnSetColumn(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemTableColumnSetColumn(const SystemTableColumnSetColumn& from);
+  SystemTableColumnSetColumn(SystemTableColumnSetColumn&& from) noexcept
+    : SystemTableColumnSetColumn() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemTableColumnSetColumn& operator=(const SystemTableColumnSetColumn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemTableColumnSetColumn& operator=(SystemTableColumnSetColumn&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemTableColumnSetColumn& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemTableColumnSetColumn* internal_default_instance() {
+    return reinterpret_cast<const SystemTableColumnSetColumn*>(
+               &_SystemTableColumnSetColumn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SystemTableColumnSetColumn& a, SystemTableColumnSetColumn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemTableColumnSetColumn* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemTableColumnSetColumn* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemTableColumnSetColumn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemTableColumnSetColumn>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemTableColumnSetColumn& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemTableColumnSetColumn& from) {
+    SystemTableColumnSetColumn::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemTableColumnSetColumn* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemTableColumnSetColumn";
+  }
+  protected:
+  explicit SystemTableColumnSetColumn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kColumnFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // repeated .siodb.database_info.SystemTableColumn column = 2;
+  int column_size() const;
+  private:
+  int _internal_column_size() const;
+  public:
+  void clear_column();
+  ::siodb::database_info::SystemTableColumn* mutable_column(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumn >*
+      mutable_column();
+  private:
+  const ::siodb::database_info::SystemTableColumn& _internal_column(int index) const;
+  ::siodb::database_info::SystemTableColumn* _internal_add_column();
+  public:
+  const ::siodb::database_info::SystemTableColumn& column(int index) const;
+  ::siodb::database_info::SystemTableColumn* add_column();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumn >&
+      column() const;
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemTableColumnSetColumn)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumn > column_;
+    uint64_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SystemTableColumn final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemTableColumn) */ {
+ public:
+  inline SystemTableColumn() : SystemTableColumn(nullptr) {}
+  ~SystemTableColumn() override;
+  explicit PROTOBUF_CONSTEXPR SystemTableColumn(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemTableColumn(const SystemTableColumn& from);
+  SystemTableColumn(SystemTableColumn&& from) noexcept
+    : SystemTableColumn() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemTableColumn& operator=(const SystemTableColumn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemTableColumn& operator=(SystemTableColumn&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemTableColumn& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemTableColumn* internal_default_instance() {
+    return reinterpret_cast<const SystemTableColumn*>(
+               &_SystemTableColumn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SystemTableColumn& a, SystemTableColumn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemTableColumn* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemTableColumn* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemTableColumn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemTableColumn>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemTableColumn& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemTableColumn& from) {
+    SystemTableColumn::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemTableColumn* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemTableColumn";
+  }
+  protected:
+  explicit SystemTableColumn(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConstraintFieldNumber = 5,
+    kNameFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kDefinitionIdFieldNumber = 2,
+    kDataTypeFieldNumber = 3,
+  };
+  // repeated .siodb.database_info.SystemTableColumnConstraint constraint = 5;
+  int constraint_size() const;
+  private:
+  int _internal_constraint_size() const;
+  public:
+  void clear_constraint();
+  ::siodb::database_info::SystemTableColumnConstraint* mutable_constraint(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraint >*
+      mutable_constraint();
+  private:
+  const ::siodb::database_info::SystemTableColumnConstraint& _internal_constraint(int index) const;
+  ::siodb::database_info::SystemTableColumnConstraint* _internal_add_constraint();
+  public:
+  const ::siodb::database_info::SystemTableColumnConstraint& constraint(int index) const;
+  ::siodb::database_info::SystemTableColumnConstraint* add_constraint();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraint >&
+      constraint() const;
+
+  // string name = 4;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint64 definition_id = 2;
+  void clear_definition_id();
+  uint64_t definition_id() const;
+  void set_definition_id(uint64_t value);
+  private:
+  uint64_t _internal_definition_id() const;
+  void _internal_set_definition_id(uint64_t value);
+  public:
+
+  // .siodb.ColumnDataType data_type = 3;
+  void clear_data_type();
+  ::siodb::ColumnDataType data_type() const;
+  void set_data_type(::siodb::ColumnDataType value);
+  private:
+  ::siodb::ColumnDataType _internal_data_type() const;
+  void _internal_set_data_type(::siodb::ColumnDataType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemTableColumn)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraint > constraint_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t id_;
+    uint64_t definition_id_;
+    int data_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SystemTableColumnConstraint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:siodb.database_info.SystemTableColumnConstraint) */ {
+ public:
+  inline SystemTableColumnConstraint() : SystemTableColumnConstraint(nullptr) {}
+  ~SystemTableColumnConstraint() override;
+  explicit PROTOBUF_CONSTEXPR SystemTableColumnConstraint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SystemTableColumnConstraint(const SystemTableColumnConstraint& from);
+  SystemTableColumnConstraint(SystemTableColumnConstraint&& from) noexcept
+    : SystemTableColumnConstraint() {
+    *this = ::std::move(from);
+  }
+
+  inline SystemTableColumnConstraint& operator=(const SystemTableColumnConstraint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SystemTableColumnConstraint& operator=(SystemTableColumnConstraint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SystemTableColumnConstraint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SystemTableColumnConstraint* internal_default_instance() {
+    return reinterpret_cast<const SystemTableColumnConstraint*>(
+               &_SystemTableColumnConstraint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SystemTableColumnConstraint& a, SystemTableColumnConstraint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SystemTableColumnConstraint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SystemTableColumnConstraint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SystemTableColumnConstraint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SystemTableColumnConstraint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SystemTableColumnConstraint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SystemTableColumnConstraint& from) {
+    SystemTableColumnConstraint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SystemTableColumnConstraint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "siodb.database_info.SystemTableColumnConstraint";
+  }
+  protected:
+  explicit SystemTableColumnConstraint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kAssociationIdFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kDefinitionIdFieldNumber = 4,
+  };
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 association_id = 1;
+  void clear_association_id();
+  uint64_t association_id() const;
+  void set_association_id(uint64_t value);
+  private:
+  uint64_t _internal_association_id() const;
+  void _internal_set_association_id(uint64_t value);
+  public:
+
+  // uint64 id = 2;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint64 definition_id = 4;
+  void clear_definition_id();
+  uint64_t definition_id() const;
+  void set_definition_id(uint64_t value);
+  private:
+  uint64_t _internal_definition_id() const;
+  void _internal_set_definition_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:siodb.database_info.SystemTableColumnConstraint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t association_id_;
+    uint64_t id_;
+    uint64_t definition_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SystemTables_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SystemObjectList
+
+// repeated .siodb.database_info.SystemTableColumnConstraintDefinition constraint_definition = 1;
+inline int SystemObjectList::_internal_constraint_definition_size() const {
+  return _impl_.constraint_definition_.size();
+}
+inline int SystemObjectList::constraint_definition_size() const {
+  return _internal_constraint_definition_size();
+}
+inline void SystemObjectList::clear_constraint_definition() {
+  _impl_.constraint_definition_.Clear();
+}
+inline ::siodb::database_info::SystemTableColumnConstraintDefinition* SystemObjectList::mutable_constraint_definition(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemObjectList.constraint_definition)
+  return _impl_.constraint_definition_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraintDefinition >*
+SystemObjectList::mutable_constraint_definition() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.database_info.SystemObjectList.constraint_definition)
+  return &_impl_.constraint_definition_;
+}
+inline const ::siodb::database_info::SystemTableColumnConstraintDefinition& SystemObjectList::_internal_constraint_definition(int index) const {
+  return _impl_.constraint_definition_.Get(index);
+}
+inline const ::siodb::database_info::SystemTableColumnConstraintDefinition& SystemObjectList::constraint_definition(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemObjectList.constraint_definition)
+  return _internal_constraint_definition(index);
+}
+inline ::siodb::database_info::SystemTableColumnConstraintDefinition* SystemObjectList::_internal_add_constraint_definition() {
+  return _impl_.constraint_definition_.Add();
+}
+inline ::siodb::database_info::SystemTableColumnConstraintDefinition* SystemObjectList::add_constraint_definition() {
+  ::siodb::database_info::SystemTableColumnConstraintDefinition* _add = _internal_add_constraint_definition();
+  // @@protoc_insertion_point(field_add:siodb.database_info.SystemObjectList.constraint_definition)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraintDefinition >&
+SystemObjectList::constraint_definition() const {
+  // @@protoc_insertion_point(field_list:siodb.database_info.SystemObjectList.constraint_definition)
+  return _impl_.constraint_definition_;
+}
+
+// repeated .siodb.database_info.SystemTable table = 2;
+inline int SystemObjectList::_internal_table_size() const {
+  return _impl_.table_.size();
+}
+inline int SystemObjectList::table_size() const {
+  return _internal_table_size();
+}
+inline void SystemObjectList::clear_table() {
+  _impl_.table_.Clear();
+}
+inline ::siodb::database_info::SystemTable* SystemObjectList::mutable_table(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemObjectList.table)
+  return _impl_.table_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTable >*
+SystemObjectList::mutable_table() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.database_info.SystemObjectList.table)
+  return &_impl_.table_;
+}
+inline const ::siodb::database_info::SystemTable& SystemObjectList::_internal_table(int index) const {
+  return _impl_.table_.Get(index);
+}
+inline const ::siodb::database_info::SystemTable& SystemObjectList::table(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemObjectList.table)
+  return _internal_table(index);
+}
+inline ::siodb::database_info::SystemTable* SystemObjectList::_internal_add_table() {
+  return _impl_.table_.Add();
+}
+inline ::siodb::database_info::SystemTable* SystemObjectList::add_table() {
+  ::siodb::database_info::SystemTable* _add = _internal_add_table();
+  // @@protoc_insertion_point(field_add:siodb.database_info.SystemObjectList.table)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTable >&
+SystemObjectList::table() const {
+  // @@protoc_insertion_point(field_list:siodb.database_info.SystemObjectList.table)
+  return _impl_.table_;
+}
+
+// -------------------------------------------------------------------
+
+// SystemTableColumnConstraintDefinition
+
+// uint64 id = 1;
+inline void SystemTableColumnConstraintDefinition::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumnConstraintDefinition::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SystemTableColumnConstraintDefinition::id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraintDefinition.id)
+  return _internal_id();
+}
+inline void SystemTableColumnConstraintDefinition::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SystemTableColumnConstraintDefinition::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraintDefinition.id)
+}
+
+// int32 type = 2;
+inline void SystemTableColumnConstraintDefinition::clear_type() {
+  _impl_.type_ = 0;
+}
+inline int32_t SystemTableColumnConstraintDefinition::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t SystemTableColumnConstraintDefinition::type() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraintDefinition.type)
+  return _internal_type();
+}
+inline void SystemTableColumnConstraintDefinition::_internal_set_type(int32_t value) {
+  
+  _impl_.type_ = value;
+}
+inline void SystemTableColumnConstraintDefinition::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraintDefinition.type)
+}
+
+// bytes expr = 3;
+inline void SystemTableColumnConstraintDefinition::clear_expr() {
+  _impl_.expr_.ClearToEmpty();
+}
+inline const std::string& SystemTableColumnConstraintDefinition::expr() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraintDefinition.expr)
+  return _internal_expr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SystemTableColumnConstraintDefinition::set_expr(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.expr_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraintDefinition.expr)
+}
+inline std::string* SystemTableColumnConstraintDefinition::mutable_expr() {
+  std::string* _s = _internal_mutable_expr();
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTableColumnConstraintDefinition.expr)
+  return _s;
+}
+inline const std::string& SystemTableColumnConstraintDefinition::_internal_expr() const {
+  return _impl_.expr_.Get();
+}
+inline void SystemTableColumnConstraintDefinition::_internal_set_expr(const std::string& value) {
+  
+  _impl_.expr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SystemTableColumnConstraintDefinition::_internal_mutable_expr() {
+  
+  return _impl_.expr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SystemTableColumnConstraintDefinition::release_expr() {
+  // @@protoc_insertion_point(field_release:siodb.database_info.SystemTableColumnConstraintDefinition.expr)
+  return _impl_.expr_.Release();
+}
+inline void SystemTableColumnConstraintDefinition::set_allocated_expr(std::string* expr) {
+  if (expr != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.expr_.SetAllocated(expr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expr_.IsDefault()) {
+    _impl_.expr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.database_info.SystemTableColumnConstraintDefinition.expr)
+}
+
+// -------------------------------------------------------------------
+
+// SystemTable
+
+// uint32 id = 1;
+inline void SystemTable::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t SystemTable::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t SystemTable::id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTable.id)
+  return _internal_id();
+}
+inline void SystemTable::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SystemTable::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTable.id)
+}
+
+// string name = 2;
+inline void SystemTable::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SystemTable::name() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTable.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SystemTable::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTable.name)
+}
+inline std::string* SystemTable::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTable.name)
+  return _s;
+}
+inline const std::string& SystemTable::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SystemTable::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SystemTable::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SystemTable::release_name() {
+  // @@protoc_insertion_point(field_release:siodb.database_info.SystemTable.name)
+  return _impl_.name_.Release();
+}
+inline void SystemTable::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.database_info.SystemTable.name)
+}
+
+// .siodb.database_info.SystemTableColumnSet column_set = 3;
+inline bool SystemTable::_internal_has_column_set() const {
+  return this != internal_default_instance() && _impl_.column_set_ != nullptr;
+}
+inline bool SystemTable::has_column_set() const {
+  return _internal_has_column_set();
+}
+inline void SystemTable::clear_column_set() {
+  if (GetArenaForAllocation() == nullptr && _impl_.column_set_ != nullptr) {
+    delete _impl_.column_set_;
+  }
+  _impl_.column_set_ = nullptr;
+}
+inline const ::siodb::database_info::SystemTableColumnSet& SystemTable::_internal_column_set() const {
+  const ::siodb::database_info::SystemTableColumnSet* p = _impl_.column_set_;
+  return p != nullptr ? *p : reinterpret_cast<const ::siodb::database_info::SystemTableColumnSet&>(
+      ::siodb::database_info::_SystemTableColumnSet_default_instance_);
+}
+inline const ::siodb::database_info::SystemTableColumnSet& SystemTable::column_set() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTable.column_set)
+  return _internal_column_set();
+}
+inline void SystemTable::unsafe_arena_set_allocated_column_set(
+    ::siodb::database_info::SystemTableColumnSet* column_set) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.column_set_);
+  }
+  _impl_.column_set_ = column_set;
+  if (column_set) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:siodb.database_info.SystemTable.column_set)
+}
+inline ::siodb::database_info::SystemTableColumnSet* SystemTable::release_column_set() {
+  
+  ::siodb::database_info::SystemTableColumnSet* temp = _impl_.column_set_;
+  _impl_.column_set_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::siodb::database_info::SystemTableColumnSet* SystemTable::unsafe_arena_release_column_set() {
+  // @@protoc_insertion_point(field_release:siodb.database_info.SystemTable.column_set)
+  
+  ::siodb::database_info::SystemTableColumnSet* temp = _impl_.column_set_;
+  _impl_.column_set_ = nullptr;
+  return temp;
+}
+inline ::siodb::database_info::SystemTableColumnSet* SystemTable::_internal_mutable_column_set() {
+  
+  if (_impl_.column_set_ == nullptr) {
+    auto* p = CreateMaybeMessage<::siodb::database_info::SystemTableColumnSet>(GetArenaForAllocation());
+    _impl_.column_set_ = p;
+  }
+  return _impl_.column_set_;
+}
+inline ::siodb::database_info::SystemTableColumnSet* SystemTable::mutable_column_set() {
+  ::siodb::database_info::SystemTableColumnSet* _msg = _internal_mutable_column_set();
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTable.column_set)
+  return _msg;
+}
+inline void SystemTable::set_allocated_column_set(::siodb::database_info::SystemTableColumnSet* column_set) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.column_set_;
+  }
+  if (column_set) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(column_set);
+    if (message_arena != submessage_arena) {
+      column_set = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, column_set, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.column_set_ = column_set;
+  // @@protoc_insertion_point(field_set_allocated:siodb.database_info.SystemTable.column_set)
+}
+
+// -------------------------------------------------------------------
+
+// SystemTableColumnSet
+
+// uint64 id = 1;
+inline void SystemTableColumnSet::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumnSet::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SystemTableColumnSet::id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnSet.id)
+  return _internal_id();
+}
+inline void SystemTableColumnSet::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SystemTableColumnSet::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnSet.id)
+}
+
+// repeated .siodb.database_info.SystemTableColumnSetColumn column = 2;
+inline int SystemTableColumnSet::_internal_column_size() const {
+  return _impl_.column_.size();
+}
+inline int SystemTableColumnSet::column_size() const {
+  return _internal_column_size();
+}
+inline void SystemTableColumnSet::clear_column() {
+  _impl_.column_.Clear();
+}
+inline ::siodb::database_info::SystemTableColumnSetColumn* SystemTableColumnSet::mutable_column(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTableColumnSet.column)
+  return _impl_.column_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnSetColumn >*
+SystemTableColumnSet::mutable_column() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.database_info.SystemTableColumnSet.column)
+  return &_impl_.column_;
+}
+inline const ::siodb::database_info::SystemTableColumnSetColumn& SystemTableColumnSet::_internal_column(int index) const {
+  return _impl_.column_.Get(index);
+}
+inline const ::siodb::database_info::SystemTableColumnSetColumn& SystemTableColumnSet::column(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnSet.column)
+  return _internal_column(index);
+}
+inline ::siodb::database_info::SystemTableColumnSetColumn* SystemTableColumnSet::_internal_add_column() {
+  return _impl_.column_.Add();
+}
+inline ::siodb::database_info::SystemTableColumnSetColumn* SystemTableColumnSet::add_column() {
+  ::siodb::database_info::SystemTableColumnSetColumn* _add = _internal_add_column();
+  // @@protoc_insertion_point(field_add:siodb.database_info.SystemTableColumnSet.column)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnSetColumn >&
+SystemTableColumnSet::column() const {
+  // @@protoc_insertion_point(field_list:siodb.database_info.SystemTableColumnSet.column)
+  return _impl_.column_;
+}
+
+// -------------------------------------------------------------------
+
+// SystemTableColumnSetColumn
+
+// uint64 id = 1;
+inline void SystemTableColumnSetColumn::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumnSetColumn::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SystemTableColumnSetColumn::id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnSetColumn.id)
+  return _internal_id();
+}
+inline void SystemTableColumnSetColumn::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SystemTableColumnSetColumn::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnSetColumn.id)
+}
+
+// repeated .siodb.database_info.SystemTableColumn column = 2;
+inline int SystemTableColumnSetColumn::_internal_column_size() const {
+  return _impl_.column_.size();
+}
+inline int SystemTableColumnSetColumn::column_size() const {
+  return _internal_column_size();
+}
+inline void SystemTableColumnSetColumn::clear_column() {
+  _impl_.column_.Clear();
+}
+inline ::siodb::database_info::SystemTableColumn* SystemTableColumnSetColumn::mutable_column(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTableColumnSetColumn.column)
+  return _impl_.column_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumn >*
+SystemTableColumnSetColumn::mutable_column() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.database_info.SystemTableColumnSetColumn.column)
+  return &_impl_.column_;
+}
+inline const ::siodb::database_info::SystemTableColumn& SystemTableColumnSetColumn::_internal_column(int index) const {
+  return _impl_.column_.Get(index);
+}
+inline const ::siodb::database_info::SystemTableColumn& SystemTableColumnSetColumn::column(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnSetColumn.column)
+  return _internal_column(index);
+}
+inline ::siodb::database_info::SystemTableColumn* SystemTableColumnSetColumn::_internal_add_column() {
+  return _impl_.column_.Add();
+}
+inline ::siodb::database_info::SystemTableColumn* SystemTableColumnSetColumn::add_column() {
+  ::siodb::database_info::SystemTableColumn* _add = _internal_add_column();
+  // @@protoc_insertion_point(field_add:siodb.database_info.SystemTableColumnSetColumn.column)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumn >&
+SystemTableColumnSetColumn::column() const {
+  // @@protoc_insertion_point(field_list:siodb.database_info.SystemTableColumnSetColumn.column)
+  return _impl_.column_;
+}
+
+// -------------------------------------------------------------------
+
+// SystemTableColumn
+
+// uint64 id = 1;
+inline void SystemTableColumn::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumn::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SystemTableColumn::id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumn.id)
+  return _internal_id();
+}
+inline void SystemTableColumn::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SystemTableColumn::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumn.id)
+}
+
+// uint64 definition_id = 2;
+inline void SystemTableColumn::clear_definition_id() {
+  _impl_.definition_id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumn::_internal_definition_id() const {
+  return _impl_.definition_id_;
+}
+inline uint64_t SystemTableColumn::definition_id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumn.definition_id)
+  return _internal_definition_id();
+}
+inline void SystemTableColumn::_internal_set_definition_id(uint64_t value) {
+  
+  _impl_.definition_id_ = value;
+}
+inline void SystemTableColumn::set_definition_id(uint64_t value) {
+  _internal_set_definition_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumn.definition_id)
+}
+
+// .siodb.ColumnDataType data_type = 3;
+inline void SystemTableColumn::clear_data_type() {
+  _impl_.data_type_ = 0;
+}
+inline ::siodb::ColumnDataType SystemTableColumn::_internal_data_type() const {
+  return static_cast< ::siodb::ColumnDataType >(_impl_.data_type_);
+}
+inline ::siodb::ColumnDataType SystemTableColumn::data_type() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumn.data_type)
+  return _internal_data_type();
+}
+inline void SystemTableColumn::_internal_set_data_type(::siodb::ColumnDataType value) {
+  
+  _impl_.data_type_ = value;
+}
+inline void SystemTableColumn::set_data_type(::siodb::ColumnDataType value) {
+  _internal_set_data_type(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumn.data_type)
+}
+
+// string name = 4;
+inline void SystemTableColumn::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SystemTableColumn::name() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumn.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SystemTableColumn::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumn.name)
+}
+inline std::string* SystemTableColumn::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTableColumn.name)
+  return _s;
+}
+inline const std::string& SystemTableColumn::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SystemTableColumn::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SystemTableColumn::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SystemTableColumn::release_name() {
+  // @@protoc_insertion_point(field_release:siodb.database_info.SystemTableColumn.name)
+  return _impl_.name_.Release();
+}
+inline void SystemTableColumn::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.database_info.SystemTableColumn.name)
+}
+
+// repeated .siodb.database_info.SystemTableColumnConstraint constraint = 5;
+inline int SystemTableColumn::_internal_constraint_size() const {
+  return _impl_.constraint_.size();
+}
+inline int SystemTableColumn::constraint_size() const {
+  return _internal_constraint_size();
+}
+inline void SystemTableColumn::clear_constraint() {
+  _impl_.constraint_.Clear();
+}
+inline ::siodb::database_info::SystemTableColumnConstraint* SystemTableColumn::mutable_constraint(int index) {
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTableColumn.constraint)
+  return _impl_.constraint_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraint >*
+SystemTableColumn::mutable_constraint() {
+  // @@protoc_insertion_point(field_mutable_list:siodb.database_info.SystemTableColumn.constraint)
+  return &_impl_.constraint_;
+}
+inline const ::siodb::database_info::SystemTableColumnConstraint& SystemTableColumn::_internal_constraint(int index) const {
+  return _impl_.constraint_.Get(index);
+}
+inline const ::siodb::database_info::SystemTableColumnConstraint& SystemTableColumn::constraint(int index) const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumn.constraint)
+  return _internal_constraint(index);
+}
+inline ::siodb::database_info::SystemTableColumnConstraint* SystemTableColumn::_internal_add_constraint() {
+  return _impl_.constraint_.Add();
+}
+inline ::siodb::database_info::SystemTableColumnConstraint* SystemTableColumn::add_constraint() {
+  ::siodb::database_info::SystemTableColumnConstraint* _add = _internal_add_constraint();
+  // @@protoc_insertion_point(field_add:siodb.database_info.SystemTableColumn.constraint)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::siodb::database_info::SystemTableColumnConstraint >&
+SystemTableColumn::constraint() const {
+  // @@protoc_insertion_point(field_list:siodb.database_info.SystemTableColumn.constraint)
+  return _impl_.constraint_;
+}
+
+// -------------------------------------------------------------------
+
+// SystemTableColumnConstraint
+
+// uint64 association_id = 1;
+inline void SystemTableColumnConstraint::clear_association_id() {
+  _impl_.association_id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumnConstraint::_internal_association_id() const {
+  return _impl_.association_id_;
+}
+inline uint64_t SystemTableColumnConstraint::association_id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraint.association_id)
+  return _internal_association_id();
+}
+inline void SystemTableColumnConstraint::_internal_set_association_id(uint64_t value) {
+  
+  _impl_.association_id_ = value;
+}
+inline void SystemTableColumnConstraint::set_association_id(uint64_t value) {
+  _internal_set_association_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraint.association_id)
+}
+
+// uint64 id = 2;
+inline void SystemTableColumnConstraint::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumnConstraint::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SystemTableColumnConstraint::id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraint.id)
+  return _internal_id();
+}
+inline void SystemTableColumnConstraint::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SystemTableColumnConstraint::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraint.id)
+}
+
+// string name = 3;
+inline void SystemTableColumnConstraint::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SystemTableColumnConstraint::name() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraint.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SystemTableColumnConstraint::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraint.name)
+}
+inline std::string* SystemTableColumnConstraint::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:siodb.database_info.SystemTableColumnConstraint.name)
+  return _s;
+}
+inline const std::string& SystemTableColumnConstraint::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SystemTableColumnConstraint::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SystemTableColumnConstraint::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SystemTableColumnConstraint::release_name() {
+  // @@protoc_insertion_point(field_release:siodb.database_info.SystemTableColumnConstraint.name)
+  return _impl_.name_.Release();
+}
+inline void SystemTableColumnConstraint::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:siodb.database_info.SystemTableColumnConstraint.name)
+}
+
+// uint64 definition_id = 4;
+inline void SystemTableColumnConstraint::clear_definition_id() {
+  _impl_.definition_id_ = uint64_t{0u};
+}
+inline uint64_t SystemTableColumnConstraint::_internal_definition_id() const {
+  return _impl_.definition_id_;
+}
+inline uint64_t SystemTableColumnConstraint::definition_id() const {
+  // @@protoc_insertion_point(field_get:siodb.database_info.SystemTableColumnConstraint.definition_id)
+  return _internal_definition_id();
+}
+inline void SystemTableColumnConstraint::_internal_set_definition_id(uint64_t value) {
+  
+  _impl_.definition_id_ = value;
+}
+inline void SystemTableColumnConstraint::set_definition_id(uint64_t value) {
+  _internal_set_definition_id(value);
+  // @@protoc_insertion_point(field_set:siodb.database_info.SystemTableColumnConstraint.definition_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace database_info
+}  // namespace siodb
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_SystemTables_2eproto
@@ -0,0 +1,90 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "FileDescriptorPassing.h"
+
+// Project headers
+#include "../utils/SystemError.h"
+
+// CRT headers
+#include <cstring>
+
+// System headers
+#include <sys/socket.h>
+#include <sys/types.h>
+
+namespace siodb::net {
+
+namespace {
+
+/** Control message buffer for single file descriptor */
+union FileDescriptorControlMessage {
+    char m_buffer[CMSG_SPACE(sizeof(int))];
+    struct cmsghdr m_align;
+};
+
+}  // namespace
+
+void sendFileDescriptor(int socketFd, int fd)
+{
+    // At least one byte of the regular data must be sent along with the ancillary data
+    char data = 0;
+    struct iovec iov;
+    iov.iov_base = &data;
+    iov.iov_len = sizeof(data);
+
+    FileDescriptorControlMessage control;
+    std::memset(&control, 0, sizeof(control));
+
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.m_buffer;
+    msg.msg_controllen = sizeof(control.m_buffer);
+
+    auto cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+    while (::sendmsg(socketFd, &msg, MSG_NOSIGNAL) < 0) {
+        if (errno != EINTR) utils::throwSystemError("Can't send file descriptor");
+    }
+}
+
+int receiveFileDescriptor(int socketFd)
+{
+    char data = 0;
+    struct iovec iov;
+    iov.iov_base = &data;
+    iov.iov_len = sizeof(data);
+
+    FileDescriptorControlMessage control;
+    std::memset(&control, 0, sizeof(control));
+
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.m_buffer;
+    msg.msg_controllen = sizeof(control.m_buffer);
+
+    const auto n = ::recvmsg(socketFd, &msg, MSG_CMSG_CLOEXEC);
+    if (n < 0) utils::throwSystemError("Can't receive file descriptor");
+    if (n == 0) return -1;
+
+    const auto cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS
+            || cmsg->cmsg_len != CMSG_LEN(sizeof(int))) {
+        utils::throwSystemError(EBADMSG, "File descriptor was not received");
+    }
+
+    int fd = -1;
+    std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    return fd;
+}
+
+}  // namespace siodb::net
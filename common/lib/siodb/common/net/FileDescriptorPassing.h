@@ -0,0 +1,26 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+namespace siodb::net {
+
+/**
+ * Sends file descriptor over UNIX socket as SCM_RIGHTS ancillary data.
+ * @param socketFd UNIX socket file descriptor.
+ * @param fd File descriptor to send.
+ * @throw std::system_error if sending fails.
+ */
+void sendFileDescriptor(int socketFd, int fd);
+
+/**
+ * Receives file descriptor sent over UNIX socket with @ref sendFileDescriptor.
+ * Received file descriptor has FD_CLOEXEC flag set.
+ * @param socketFd UNIX socket file descriptor.
+ * @return Received file descriptor or -1 if other side has closed connection.
+ * @throw std::system_error if receiving fails or no file descriptor was received.
+ */
+int receiveFileDescriptor(int socketFd);
+
+}  // namespace siodb::net
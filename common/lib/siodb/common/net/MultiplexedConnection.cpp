@@ -0,0 +1,468 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "MultiplexedConnection.h"
+
+// Project headers
+#include "ConnectionError.h"
+#include "MultiplexedSessionIo.h"
+#include "../protobuf/SiodbProtocolError.h"
+#include "../protobuf/SiodbProtocolMessageType.h"
+#include "../stl_ext/utility_ext.h"
+
+// STL headers
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <system_error>
+
+// System headers
+#include <sys/socket.h>
+
+// Protobuf headers
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace siodb::net {
+
+MultiplexedConnection::MultiplexedConnection(FileDescriptorGuard&& fd,
+        SessionOpenHandler sessionOpenHandler, SessionEventHandler sessionEventHandler,
+        const MultiplexedConnectionSettings& settings)
+    : m_fd(std::move(fd))
+    , m_sessionOpenHandler(std::move(sessionOpenHandler))
+    , m_sessionEventHandler(std::move(sessionEventHandler))
+    , m_settings(settings)
+    , m_connected(m_fd.isValidFd())
+    , m_lastSessionId(0)
+    , m_receiveBuffer(kReceiveBlockSize)
+    , m_receivedSize(0)
+{
+}
+
+MultiplexedConnection::~MultiplexedConnection()
+{
+    close();
+}
+
+std::unique_ptr<MultiplexedSessionIo> MultiplexedConnection::openSession()
+{
+    std::shared_ptr<Session> session;
+    {
+        std::lock_guard lock(m_sessionsMutex);
+        if (!m_connected) throw ConnectionError("Multiplexed connection is closed");
+        session = std::make_shared<Session>(++m_lastSessionId);
+        m_sessions.emplace(session->m_id, session);
+    }
+
+    try {
+        sendFrame(session->m_id, iomgr_protocol::SESSION_OPEN, nullptr, 0, 0);
+    } catch (...) {
+        removeSession(session->m_id);
+        throw;
+    }
+    return std::make_unique<MultiplexedSessionIo>(shared_from_this(), session);
+}
+
+bool MultiplexedConnection::receive()
+{
+    if (m_receiveBuffer.size() - m_receivedSize < kReceiveBlockSize)
+        m_receiveBuffer.resize(m_receivedSize + kReceiveBlockSize);
+
+    const auto n = ::recv(m_fd.getFd(), m_receiveBuffer.data() + m_receivedSize,
+            m_receiveBuffer.size() - m_receivedSize, 0);
+    if (n <= 0) {
+        const int errorCode = errno;
+        if (n < 0 && errorCode == EINTR && m_connected) return true;
+        close();
+        if (n == 0) return false;
+        throw std::system_error(errorCode, std::generic_category(), "recv() failed");
+    }
+    m_receivedSize += n;
+
+    try {
+        const auto dispatchedSize = dispatchReceivedFrames();
+        m_receivedSize -= dispatchedSize;
+        if (m_receivedSize > 0 && dispatchedSize > 0) {
+            std::memmove(m_receiveBuffer.data(), m_receiveBuffer.data() + dispatchedSize,
+                    m_receivedSize);
+        }
+        if (m_receivedSize > kMaxFrameDataLength + kMaxFrameOverhead)
+            throw SiodbProtocolError("Protocol error: Session frame is too long");
+    } catch (...) {
+        close();
+        throw;
+    }
+    return true;
+}
+
+void MultiplexedConnection::close() noexcept
+{
+    std::unordered_map<std::uint64_t, std::shared_ptr<Session>> sessions;
+    {
+        std::lock_guard lock(m_sessionsMutex);
+        if (!m_connected) return;
+        m_connected = false;
+        sessions.swap(m_sessions);
+    }
+
+    // Wakes up thread blocked in the receive()
+    ::shutdown(m_fd.getFd(), SHUT_RDWR);
+
+    for (const auto& session : sessions) {
+        {
+            std::lock_guard lock(session.second->m_mutex);
+            session.second->m_closed = true;
+        }
+        session.second->m_condition.notify_all();
+    }
+
+    for (const auto& session : sessions) {
+        try {
+            notifySessionEvent(session.first);
+        } catch (...) {
+            // Nothing can be done here, session is closed anyway
+        }
+    }
+}
+
+bool MultiplexedConnection::hasReadableData(std::uint64_t sessionId) const
+{
+    // Removed session is closed
+    const auto session = findSession(sessionId);
+    if (!session) return true;
+    std::lock_guard lock(session->m_mutex);
+    return session->m_readPosition < session->m_receivedData.size() || session->m_closed;
+}
+
+bool MultiplexedConnection::hasReadableMessage(std::uint64_t sessionId) const
+{
+    const auto session = findSession(sessionId);
+    if (!session) return true;
+    std::lock_guard lock(session->m_mutex);
+    if (session->m_closed) return true;
+    const auto unreadSize = session->m_receivedData.size() - session->m_readPosition;
+    try {
+        const auto messageLength = decodeMessageLength(
+                session->m_receivedData.data() + session->m_readPosition, unreadSize);
+        return messageLength > 0 && messageLength <= unreadSize;
+    } catch (SiodbProtocolError&) {
+        // Reader gets the same error without blocking
+        return true;
+    }
+}
+
+bool MultiplexedConnection::hasPendingSendData(std::uint64_t sessionId) const
+{
+    const auto session = findSession(sessionId);
+    if (!session) return false;
+    std::lock_guard lock(session->m_mutex);
+    return !session->m_closed
+           && session->m_pendingSendPosition < session->m_pendingSendData.size();
+}
+
+std::size_t MultiplexedConnection::dispatchReceivedFrames()
+{
+    std::size_t offset = 0;
+    while (offset < m_receivedSize) {
+        const auto frame = m_receiveBuffer.data() + offset;
+        const auto availableSize = m_receivedSize - offset;
+        google::protobuf::io::CodedInputStream codedInput(frame, availableSize);
+
+        // Incomplete frame is dispatched when the rest of it is received
+        std::uint32_t messageTypeId = 0;
+        if (!codedInput.ReadVarint32(&messageTypeId)) break;
+        if (messageTypeId
+                != stdext::underlying_value(protobuf::ProtocolMessageType::kSessionFrameHeader)) {
+            std::ostringstream err;
+            err << "Protocol error: Unexpected message type " << messageTypeId
+                << " while waiting for session frame";
+            throw SiodbProtocolError(err.str());
+        }
+
+        std::uint32_t headerLength = 0;
+        if (!codedInput.ReadVarint32(&headerLength)) break;
+        if (headerLength > kMaxFrameOverhead)
+            throw SiodbProtocolError("Protocol error: Session frame header is too long");
+
+        const std::size_t headerOffset = codedInput.CurrentPosition();
+        if (availableSize - headerOffset < headerLength) break;
+
+        iomgr_protocol::SessionFrameHeader header;
+        if (!header.ParseFromArray(frame + headerOffset, headerLength))
+            throw SiodbProtocolError("Protocol error: Invalid session frame header");
+        if (header.data_length() > kMaxFrameDataLength)
+            throw SiodbProtocolError("Protocol error: Session frame data is too long");
+
+        const auto dataOffset = headerOffset + headerLength;
+        if (availableSize - dataOffset < header.data_length()) break;
+
+        handleFrame(header, frame + dataOffset);
+        offset += dataOffset + header.data_length();
+    }
+    return offset;
+}
+
+void MultiplexedConnection::handleFrame(
+        const iomgr_protocol::SessionFrameHeader& header, const std::uint8_t* data)
+{
+    const auto sessionId = header.session_id();
+    switch (header.type()) {
+        case iomgr_protocol::SESSION_OPEN: {
+            if (!m_sessionOpenHandler)
+                throw SiodbProtocolError("Protocol error: Session can't be opened by other side");
+            auto session = std::make_shared<Session>(sessionId);
+            {
+                std::lock_guard lock(m_sessionsMutex);
+                if (!m_sessions.emplace(sessionId, session).second)
+                    throw SiodbProtocolError("Protocol error: Duplicate session ID");
+            }
+            m_sessionOpenHandler(std::make_unique<MultiplexedSessionIo>(
+                    shared_from_this(), std::move(session)));
+            break;
+        }
+
+        case iomgr_protocol::SESSION_DATA: {
+            // Data may arrive after session has been closed by this side
+            const auto session = findSession(sessionId);
+            if (!session) break;
+            std::size_t windowIncrement = 0;
+            bool messageTooLong = false;
+            {
+                std::lock_guard lock(session->m_mutex);
+                if (session->m_closed) break;
+                auto& receivedData = session->m_receivedData;
+                const auto unacknowledgedSize = receivedData.size() - session->m_readPosition
+                                                + session->m_consumedSize
+                                                - session->m_prereportedSize;
+                if (unacknowledgedSize + header.data_length() > kSessionWindowSize)
+                    throw SiodbProtocolError("Protocol error: Session window is exceeded");
+                if (session->m_readPosition > 0) {
+                    receivedData.erase(receivedData.begin(),
+                            receivedData.begin() + session->m_readPosition);
+                    session->m_readPosition = 0;
+                }
+                receivedData.insert(receivedData.end(), data, data + header.data_length());
+                if (m_settings.m_messageInput) {
+                    try {
+                        windowIncrement = extendWindowForIncompleteMessageUnlocked(*session);
+                    } catch (SiodbProtocolError&) {
+                        messageTooLong = true;
+                    }
+                }
+            }
+            // Only this session is broken, other sessions of the connection go on
+            if (messageTooLong)
+                closeSession(*session);
+            else if (windowIncrement > 0)
+                sendWindowUpdate(sessionId, windowIncrement);
+            session->m_condition.notify_all();
+            notifySessionEvent(sessionId);
+            break;
+        }
+
+        case iomgr_protocol::SESSION_CLOSE: {
+            const auto session = removeSession(sessionId);
+            if (!session) break;
+            {
+                std::lock_guard lock(session->m_mutex);
+                session->m_closed = true;
+            }
+            session->m_condition.notify_all();
+            notifySessionEvent(sessionId);
+            break;
+        }
+
+        case iomgr_protocol::SESSION_WINDOW_UPDATE: {
+            const auto session = findSession(sessionId);
+            if (!session) break;
+            bool hasPendingData = false;
+            {
+                std::lock_guard lock(session->m_mutex);
+                session->m_sendWindow = std::min(
+                        session->m_sendWindow + header.window_increment(), kSessionWindowSize);
+                hasPendingData = session->m_pendingSendPosition < session->m_pendingSendData.size();
+            }
+            session->m_condition.notify_all();
+
+            // Session waiting for its pending data to be sent is resumed
+            if (hasPendingData) {
+                try {
+                    if (sendPendingData(*session)) notifySessionEvent(sessionId);
+                } catch (std::system_error&) {
+                    // Broken connection is detected by the receive()
+                }
+            }
+            break;
+        }
+
+        default: {
+            std::ostringstream err;
+            err << "Protocol error: Unsupported session frame type " << header.type();
+            throw SiodbProtocolError(err.str());
+        }
+    }
+}
+
+void MultiplexedConnection::sendFrame(std::uint64_t sessionId,
+        iomgr_protocol::SessionFrameType type, const void* data, std::size_t dataLength,
+        std::size_t windowIncrement)
+{
+    iomgr_protocol::SessionFrameHeader header;
+    header.set_session_id(sessionId);
+    header.set_type(type);
+    header.set_data_length(dataLength);
+    header.set_window_increment(windowIncrement);
+
+    // Whole frame is sent by the single call
+    std::string frame;
+    {
+        google::protobuf::io::StringOutputStream output(&frame);
+        google::protobuf::io::CodedOutputStream codedOutput(&output);
+        codedOutput.WriteVarint32(
+                stdext::underlying_value(protobuf::ProtocolMessageType::kSessionFrameHeader));
+        codedOutput.WriteVarint32(static_cast<std::uint32_t>(header.ByteSizeLong()));
+        header.SerializeWithCachedSizes(&codedOutput);
+    }
+    if (dataLength > 0) frame.append(static_cast<const char*>(data), dataLength);
+
+    std::lock_guard lock(m_sendMutex);
+    std::size_t sentSize = 0;
+    while (sentSize < frame.size()) {
+        const auto n = ::send(m_fd.getFd(), frame.data() + sentSize, frame.size() - sentSize,
+                MSG_NOSIGNAL);
+        if (n < 0) {
+            const int errorCode = errno;
+            if (errorCode == EINTR) continue;
+            // Rest of the frame can't be sent, so connection is unusable
+            ::shutdown(m_fd.getFd(), SHUT_RDWR);
+            throw std::system_error(errorCode, std::generic_category(), "send() failed");
+        }
+        sentSize += n;
+    }
+}
+
+bool MultiplexedConnection::sendPendingData(Session& session)
+{
+    // Frames of the session go in order, so pending data is sent by one thread at a time
+    std::lock_guard sendLock(session.m_sendMutex);
+    std::vector<std::uint8_t> frameData;
+    while (true) {
+        {
+            std::lock_guard lock(session.m_mutex);
+            auto& pendingData = session.m_pendingSendData;
+            if (session.m_closed) {
+                pendingData.clear();
+                session.m_pendingSendPosition = 0;
+                return true;
+            }
+            const auto frameDataLength =
+                    std::min({pendingData.size() - session.m_pendingSendPosition,
+                            session.m_sendWindow, kMaxFrameDataLength});
+            if (frameDataLength == 0) return session.m_pendingSendPosition == pendingData.size();
+            const auto frameBegin = pendingData.cbegin() + session.m_pendingSendPosition;
+            frameData.assign(frameBegin, frameBegin + frameDataLength);
+            session.m_pendingSendPosition += frameDataLength;
+            if (session.m_pendingSendPosition == pendingData.size()) {
+                pendingData.clear();
+                session.m_pendingSendPosition = 0;
+            }
+            session.m_sendWindow -= frameDataLength;
+        }
+        // Writers may wait for the pending data to shrink
+        session.m_condition.notify_all();
+        sendFrame(session.m_id, iomgr_protocol::SESSION_DATA, frameData.data(), frameData.size(),
+                0);
+    }
+}
+
+std::size_t MultiplexedConnection::extendWindowForIncompleteMessageUnlocked(Session& session) const
+{
+    const auto& receivedData = session.m_receivedData;
+    const auto unreadSize = receivedData.size() - session.m_readPosition;
+    const auto messageLength =
+            decodeMessageLength(receivedData.data() + session.m_readPosition, unreadSize);
+    // Complete message is consumed by the reader, which reports it
+    if (messageLength > 0 && messageLength <= unreadSize) return 0;
+
+    const auto unreportedSize = unreadSize - session.m_prereportedSize;
+    if (unreportedSize + session.m_consumedSize < kSessionWindowSize / 2) return 0;
+    const auto windowIncrement = unreportedSize + session.m_consumedSize;
+    session.m_prereportedSize += unreportedSize;
+    session.m_consumedSize = 0;
+    return windowIncrement;
+}
+
+std::size_t MultiplexedConnection::decodeMessageLength(const std::uint8_t* data, std::size_t size)
+{
+    // Message type and message length, both are varints
+    constexpr std::size_t kMaxMessagePrefixLength = 10;
+
+    google::protobuf::io::CodedInputStream codedInput(
+            data, static_cast<int>(std::min(size, kMaxMessagePrefixLength)));
+    std::uint32_t messageTypeId = 0;
+    std::uint32_t messageLength = 0;
+    if (!codedInput.ReadVarint32(&messageTypeId) || !codedInput.ReadVarint32(&messageLength)) {
+        if (size >= kMaxMessagePrefixLength)
+            throw SiodbProtocolError("Protocol error: Invalid session message prefix");
+        return 0;
+    }
+    if (messageLength > kMaxMessageLength)
+        throw SiodbProtocolError("Protocol error: Session message is too long");
+    return codedInput.CurrentPosition() + messageLength;
+}
+
+void MultiplexedConnection::sendWindowUpdate(
+        std::uint64_t sessionId, std::size_t windowIncrement) noexcept
+{
+    try {
+        sendFrame(sessionId, iomgr_protocol::SESSION_WINDOW_UPDATE, nullptr, 0, windowIncrement);
+    } catch (...) {
+        // Broken connection is detected by the receive()
+    }
+}
+
+void MultiplexedConnection::closeSession(Session& session) noexcept
+{
+    removeSession(session.m_id);
+    bool closedByOtherSide = false;
+    {
+        std::lock_guard lock(session.m_mutex);
+        closedByOtherSide = session.m_closed;
+        session.m_closed = true;
+    }
+    session.m_condition.notify_all();
+
+    if (closedByOtherSide || !m_connected) return;
+    try {
+        sendFrame(session.m_id, iomgr_protocol::SESSION_CLOSE, nullptr, 0, 0);
+    } catch (...) {
+        // Broken connection is detected by the receive()
+    }
+}
+
+std::shared_ptr<MultiplexedConnection::Session> MultiplexedConnection::findSession(
+        std::uint64_t sessionId) const
+{
+    std::lock_guard lock(m_sessionsMutex);
+    const auto it = m_sessions.find(sessionId);
+    return it == m_sessions.end() ? nullptr : it->second;
+}
+
+std::shared_ptr<MultiplexedConnection::Session> MultiplexedConnection::removeSession(
+        std::uint64_t sessionId)
+{
+    std::lock_guard lock(m_sessionsMutex);
+    const auto it = m_sessions.find(sessionId);
+    if (it == m_sessions.end()) return nullptr;
+    auto session = std::move(it->second);
+    m_sessions.erase(it);
+    return session;
+}
+
+void MultiplexedConnection::notifySessionEvent(std::uint64_t sessionId) const
+{
+    if (m_sessionEventHandler) m_sessionEventHandler(sessionId);
+}
+
+}  // namespace siodb::net
@@ -0,0 +1,338 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Common project headers
+#include "../utils/FileDescriptorGuard.h"
+#include "../utils/HelperMacros.h"
+
+// STL headers
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Protobuf message headers
+#include <siodb/common/proto/IOManagerProtocol.pb.h>
+
+namespace siodb::net {
+
+class MultiplexedSessionIo;
+
+/** Multiplexed connection settings */
+struct MultiplexedConnectionSettings {
+    /**
+     * Indication that received session data consists of messages written
+     * by the protobuf::writeMessage(), which are read whole by the
+     * MultiplexedSessionIo::readMessage(). Window is extended for the incomplete
+     * message, so that message larger than window is received without reader.
+     */
+    bool m_messageInput = false;
+
+    /**
+     * Maximum size of the session data waiting for the send window. Writes queue data
+     * without blocking until this size is reached. Zero means that writes block
+     * while send window is exhausted.
+     */
+    std::size_t m_maxPendingSendSize = 0;
+};
+
+/**
+ * Connection which carries many logical sessions, each of them is an independent byte stream.
+ * Session data is sent in frames tagged with the session ID. Each session has its own
+ * send window: no more than window size of data which is not consumed by the receiver yet
+ * can be sent, so that slow session never blocks other sessions of the connection,
+ * and receiver never blocks while dispatching frames.
+ * Connection doesn't own a thread: owner calls receive() when data is available.
+ */
+class MultiplexedConnection final : public std::enable_shared_from_this<MultiplexedConnection> {
+public:
+    /** Session state shared between connection and session IO */
+    struct Session {
+        /**
+         * Initializes object of class Session.
+         * @param id Session ID.
+         */
+        explicit Session(std::uint64_t id) noexcept
+            : m_id(id)
+            , m_readPosition(0)
+            , m_sendWindow(kSessionWindowSize)
+            , m_consumedSize(0)
+            , m_prereportedSize(0)
+            , m_pendingSendPosition(0)
+            , m_closed(false)
+        {
+        }
+
+        /** Session ID */
+        const std::uint64_t m_id;
+
+        /** State access synchronization object */
+        std::mutex m_mutex;
+
+        /** Signaled when data is received, send window is updated or session is closed */
+        std::condition_variable m_condition;
+
+        /** Received data */
+        std::vector<std::uint8_t> m_receivedData;
+
+        /** Position of the first unread byte of the received data */
+        std::size_t m_readPosition;
+
+        /** Number of bytes which can be sent before receiver consumes them */
+        std::size_t m_sendWindow;
+
+        /** Number of consumed bytes not reported to the sender yet */
+        std::size_t m_consumedSize;
+
+        /** Number of received bytes reported to the sender before they are consumed */
+        std::size_t m_prereportedSize;
+
+        /** Data waiting for the send window */
+        std::vector<std::uint8_t> m_pendingSendData;
+
+        /** Position of the first unsent byte of the pending data */
+        std::size_t m_pendingSendPosition;
+
+        /** Sending of the pending data synchronization object, keeps frames in order */
+        std::mutex m_sendMutex;
+
+        /** Indication that session is closed by either side or connection is lost */
+        bool m_closed;
+    };
+
+    /** Handler of the session opened by the other side */
+    using SessionOpenHandler = std::function<void(std::unique_ptr<MultiplexedSessionIo>&& session)>;
+
+    /** Handler of the session data arrival or session closing */
+    using SessionEventHandler = std::function<void(std::uint64_t sessionId)>;
+
+    /**
+     * Initializes object of class MultiplexedConnection.
+     * @param fd Connected socket file descriptor.
+     * @param sessionOpenHandler Handler of the sessions opened by the other side,
+     *                           if empty, other side is not allowed to open sessions.
+     * @param sessionEventHandler Handler of the session events, may be empty.
+     *                            Called from receive() and close().
+     * @param settings Connection settings.
+     */
+    explicit MultiplexedConnection(FileDescriptorGuard&& fd,
+            SessionOpenHandler sessionOpenHandler = nullptr,
+            SessionEventHandler sessionEventHandler = nullptr,
+            const MultiplexedConnectionSettings& settings = {});
+
+    /** De-initializes object of class MultiplexedConnection. */
+    ~MultiplexedConnection();
+
+    DECLARE_NONCOPYABLE(MultiplexedConnection);
+
+    /**
+     * Returns connection socket file descriptor.
+     * @return Connection socket file descriptor.
+     */
+    int getFd() const noexcept
+    {
+        return m_fd.getFd();
+    }
+
+    /**
+     * Returns indication that connection is not closed.
+     * @return true if connection is not closed, false otherwise.
+     */
+    bool isConnected() const noexcept
+    {
+        return m_connected;
+    }
+
+    /**
+     * Opens new session. Object must be owned by std::shared_ptr.
+     * @return Session IO.
+     * @throw ConnectionError if connection is closed.
+     * @throw std::system_error if sending fails.
+     */
+    std::unique_ptr<MultiplexedSessionIo> openSession();
+
+    /**
+     * Reads available data from the socket and dispatches all complete frames.
+     * Blocks if no data is available. Must not be called concurrently.
+     * Connection is closed when this function returns false or throws exception.
+     * @return true if connection is still open, false if other side closed it.
+     * @throw std::system_error if reading fails.
+     * @throw SiodbProtocolError if invalid frame is received.
+     */
+    bool receive();
+
+    /**
+     * Returns indication that reading session doesn't block:
+     * session has unread data or it is closed.
+     * @param sessionId Session ID.
+     * @return true if reading session doesn't block, false otherwise.
+     */
+    bool hasReadableData(std::uint64_t sessionId) const;
+
+    /**
+     * Returns indication that reading session message doesn't block:
+     * session has complete message in the received data or it is closed.
+     * @param sessionId Session ID.
+     * @return true if reading session message doesn't block, false otherwise.
+     */
+    bool hasReadableMessage(std::uint64_t sessionId) const;
+
+    /**
+     * Returns indication that session has data waiting for the send window.
+     * @param sessionId Session ID.
+     * @return true if session has pending data, false otherwise.
+     */
+    bool hasPendingSendData(std::uint64_t sessionId) const;
+
+    /** Closes connection and all its sessions. */
+    void close() noexcept;
+
+    /** Maximum amount of the session data sent but not consumed by the receiver */
+    static constexpr std::size_t kSessionWindowSize = 256 * 1024;
+
+    /** Maximum length of data in the single frame */
+    static constexpr std::size_t kMaxFrameDataLength = 64 * 1024;
+
+    /** Maximum length of the message read by MultiplexedSessionIo::readMessage() */
+    static constexpr std::size_t kMaxMessageLength = 64 * 1024 * 1024;
+
+private:
+    /**
+     * Dispatches all complete frames in the receive buffer.
+     * @return Number of bytes of the dispatched frames.
+     * @throw SiodbProtocolError if invalid frame is received.
+     */
+    std::size_t dispatchReceivedFrames();
+
+    /**
+     * Handles received frame.
+     * @param header Frame header.
+     * @param data Frame data.
+     * @throw SiodbProtocolError if frame is not valid.
+     */
+    void handleFrame(const iomgr_protocol::SessionFrameHeader& header, const std::uint8_t* data);
+
+    /**
+     * Sends frame.
+     * @param sessionId Session ID.
+     * @param type Frame type.
+     * @param data Frame data.
+     * @param dataLength Length of the frame data.
+     * @param windowIncrement Number of consumed bytes for the window update frame.
+     * @throw std::system_error if sending fails.
+     */
+    void sendFrame(std::uint64_t sessionId, iomgr_protocol::SessionFrameType type, const void* data,
+            std::size_t dataLength, std::size_t windowIncrement);
+
+    /**
+     * Sends pending session data as far as send window allows.
+     * @param session Session.
+     * @return true if all pending data is sent, false otherwise.
+     * @throw std::system_error if sending fails.
+     */
+    bool sendPendingData(Session& session);
+
+    /**
+     * Extends send window of the other side for the incomplete message,
+     * if received data of this message fills half of the window.
+     * Session must be locked.
+     * @param session Session.
+     * @return Window increment to report or zero.
+     * @throw SiodbProtocolError if message is too long.
+     */
+    std::size_t extendWindowForIncompleteMessageUnlocked(Session& session) const;
+
+    /**
+     * Decodes length of the message written by the protobuf::writeMessage().
+     * @param data Message data.
+     * @param size Size of available data.
+     * @return Length of the message including its type and length prefix,
+     *         or zero if prefix is incomplete.
+     * @throw SiodbProtocolError if message is too long.
+     */
+    static std::size_t decodeMessageLength(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * Reports consumed session data to the other side. Errors are ignored,
+     * broken connection is detected by the receive().
+     * @param sessionId Session ID.
+     * @param windowIncrement Number of consumed bytes.
+     */
+    void sendWindowUpdate(std::uint64_t sessionId, std::size_t windowIncrement) noexcept;
+
+    /**
+     * Closes session and notifies other side about that.
+     * @param session Session.
+     */
+    void closeSession(Session& session) noexcept;
+
+    /**
+     * Finds session.
+     * @param sessionId Session ID.
+     * @return Session or nullptr if it doesn't exist.
+     */
+    std::shared_ptr<Session> findSession(std::uint64_t sessionId) const;
+
+    /**
+     * Removes session.
+     * @param sessionId Session ID.
+     * @return Removed session or nullptr if it doesn't exist.
+     */
+    std::shared_ptr<Session> removeSession(std::uint64_t sessionId);
+
+    /**
+     * Calls session event handler if it exists.
+     * @param sessionId Session ID.
+     */
+    void notifySessionEvent(std::uint64_t sessionId) const;
+
+    friend class MultiplexedSessionIo;
+
+private:
+    /** Connection socket file descriptor */
+    const FileDescriptorGuard m_fd;
+
+    /** Handler of the sessions opened by the other side */
+    const SessionOpenHandler m_sessionOpenHandler;
+
+    /** Handler of the session events */
+    const SessionEventHandler m_sessionEventHandler;
+
+    /** Connection settings */
+    const MultiplexedConnectionSettings m_settings;
+
+    /** Connection status */
+    std::atomic<bool> m_connected;
+
+    /** Sessions access synchronization object */
+    mutable std::mutex m_sessionsMutex;
+
+    /** Open sessions by ID */
+    std::unordered_map<std::uint64_t, std::shared_ptr<Session>> m_sessions;
+
+    /** Last session ID */
+    std::uint64_t m_lastSessionId;
+
+    /** Frame sending synchronization object, frames are never interleaved */
+    std::mutex m_sendMutex;
+
+    /** Receive buffer, accessed only by receive() */
+    std::vector<std::uint8_t> m_receiveBuffer;
+
+    /** Number of bytes received into the receive buffer */
+    std::size_t m_receivedSize;
+
+    /** Minimum free space in the receive buffer when reading socket */
+    static constexpr std::size_t kReceiveBlockSize = 64 * 1024;
+
+    /** Maximum frame length in addition to data: two varints and header */
+    static constexpr std::size_t kMaxFrameOverhead = 64;
+};
+
+}  // namespace siodb::net
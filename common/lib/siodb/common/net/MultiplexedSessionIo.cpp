@@ -0,0 +1,255 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "MultiplexedSessionIo.h"
+
+// Project headers
+#include "../utils/SignalHandlers.h"
+
+// STL headers
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+namespace siodb::net {
+
+MultiplexedSessionIo::MultiplexedSessionIo(std::shared_ptr<MultiplexedConnection> connection,
+        std::shared_ptr<MultiplexedConnection::Session> session) noexcept
+    : m_connection(std::move(connection))
+    , m_session(std::move(session))
+    , m_closed(false)
+{
+}
+
+MultiplexedSessionIo::~MultiplexedSessionIo()
+{
+    if (isValid()) close();
+}
+
+std::size_t MultiplexedSessionIo::read(void* buffer, std::size_t size)
+{
+    if (m_closed) {
+        errno = EBADF;
+        return -1;
+    }
+
+    // Session and connection are held locally, so that IO can be destroyed
+    // by another thread while this one waits
+    const auto connection = m_connection;
+    const auto session = m_session;
+
+    std::size_t readSize = 0;
+    std::size_t windowIncrement = 0;
+    {
+        std::unique_lock lock(session->m_mutex);
+        auto& receivedData = session->m_receivedData;
+        while (session->m_readPosition == receivedData.size()) {
+            if (session->m_closed) {
+                // Same as closed socket
+                errno = 0;
+                return 0;
+            }
+            if (session->m_condition.wait_for(lock, kExitSignalCheckPeriod)
+                            == std::cv_status::timeout
+                    && utils::isExitEventSignaled()) {
+                errno = EINTR;
+                return -1;
+            }
+        }
+
+        readSize = std::min(size, receivedData.size() - session->m_readPosition);
+        std::memcpy(buffer, receivedData.data() + session->m_readPosition, readSize);
+        session->m_readPosition += readSize;
+        if (session->m_readPosition == receivedData.size()) {
+            receivedData.clear();
+            session->m_readPosition = 0;
+        }
+
+        windowIncrement = consumeReceivedDataUnlocked(*session, readSize);
+    }
+
+    if (windowIncrement > 0) connection->sendWindowUpdate(session->m_id, windowIncrement);
+    return readSize;
+}
+
+bool MultiplexedSessionIo::readMessage(std::vector<std::uint8_t>& message)
+{
+    if (m_closed) return false;
+
+    std::size_t windowIncrement = 0;
+    {
+        std::lock_guard lock(m_session->m_mutex);
+        if (m_session->m_closed) return false;
+        auto& receivedData = m_session->m_receivedData;
+        const auto unreadSize = receivedData.size() - m_session->m_readPosition;
+        const auto messageData = receivedData.data() + m_session->m_readPosition;
+        const auto messageLength =
+                MultiplexedConnection::decodeMessageLength(messageData, unreadSize);
+        if (messageLength == 0 || messageLength > unreadSize) return false;
+
+        message.assign(messageData, messageData + messageLength);
+        m_session->m_readPosition += messageLength;
+        if (m_session->m_readPosition == receivedData.size()) {
+            receivedData.clear();
+            m_session->m_readPosition = 0;
+        }
+        windowIncrement = consumeReceivedDataUnlocked(*m_session, messageLength);
+        // Next message may be incomplete and wait for the window
+        windowIncrement += m_connection->extendWindowForIncompleteMessageUnlocked(*m_session);
+    }
+
+    if (windowIncrement > 0) m_connection->sendWindowUpdate(m_session->m_id, windowIncrement);
+    return true;
+}
+
+std::size_t MultiplexedSessionIo::write(const void* buffer, std::size_t size)
+{
+    if (m_closed) {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (m_connection->m_settings.m_maxPendingSendSize > 0) return writePending(buffer, size);
+
+    const auto connection = m_connection;
+    const auto session = m_session;
+
+    auto data = static_cast<const std::uint8_t*>(buffer);
+    std::size_t remainingSize = size;
+    while (remainingSize > 0) {
+        std::size_t frameDataLength = 0;
+        {
+            std::unique_lock lock(session->m_mutex);
+            while (session->m_sendWindow == 0 && !session->m_closed) {
+                // Partially written data can't be taken back, so no interruption after it
+                if (session->m_condition.wait_for(lock, kExitSignalCheckPeriod)
+                                == std::cv_status::timeout
+                        && remainingSize == size && utils::isExitEventSignaled()) {
+                    errno = EINTR;
+                    return -1;
+                }
+            }
+
+            if (session->m_closed) {
+                errno = EPIPE;
+                return -1;
+            }
+
+            frameDataLength = std::min({remainingSize, session->m_sendWindow,
+                    MultiplexedConnection::kMaxFrameDataLength});
+            session->m_sendWindow -= frameDataLength;
+        }
+
+        try {
+            connection->sendFrame(
+                    session->m_id, iomgr_protocol::SESSION_DATA, data, frameDataLength, 0);
+        } catch (std::system_error& ex) {
+            errno = ex.code().value();
+            return -1;
+        }
+        data += frameDataLength;
+        remainingSize -= frameDataLength;
+    }
+    return size;
+}
+
+std::size_t MultiplexedSessionIo::consumeReceivedDataUnlocked(
+        MultiplexedConnection::Session& session, std::size_t size)
+{
+    // Data reported before it was consumed is not reported again
+    const auto prereportedSize = std::min(size, session.m_prereportedSize);
+    session.m_prereportedSize -= prereportedSize;
+    session.m_consumedSize += size - prereportedSize;
+
+    // Sender is notified when half of the window is consumed
+    if (session.m_closed || session.m_consumedSize < MultiplexedConnection::kSessionWindowSize / 2)
+        return 0;
+    const auto windowIncrement = session.m_consumedSize;
+    session.m_consumedSize = 0;
+    return windowIncrement;
+}
+
+std::size_t MultiplexedSessionIo::writePending(const void* buffer, std::size_t size)
+{
+    const auto connection = m_connection;
+    const auto session = m_session;
+    const auto maxPendingSendSize = connection->m_settings.m_maxPendingSendSize;
+
+    bool stalled = false;
+    {
+        std::unique_lock lock(session->m_mutex);
+        auto& pendingData = session->m_pendingSendData;
+        auto pendingSize = pendingData.size() - session->m_pendingSendPosition;
+        auto lastProgressTime = std::chrono::steady_clock::now();
+        // Data larger than limit is queued when nothing else is pending
+        while (pendingSize > 0 && pendingSize + size > maxPendingSendSize && !session->m_closed) {
+            if (session->m_condition.wait_for(lock, kExitSignalCheckPeriod)
+                            == std::cv_status::timeout
+                    && utils::isExitEventSignaled()) {
+                errno = EINTR;
+                return -1;
+            }
+            const auto newPendingSize = pendingData.size() - session->m_pendingSendPosition;
+            const auto now = std::chrono::steady_clock::now();
+            if (newPendingSize < pendingSize)
+                lastProgressTime = now;
+            else if (now - lastProgressTime >= kSendStallTimeout) {
+                stalled = true;
+                break;
+            }
+            pendingSize = newPendingSize;
+        }
+
+        if (!stalled) {
+            if (session->m_closed) {
+                errno = EPIPE;
+                return -1;
+            }
+            // Sent data is dropped when it takes most of the buffer
+            if (session->m_pendingSendPosition > pendingData.size() / 2) {
+                pendingData.erase(
+                        pendingData.begin(), pendingData.begin() + session->m_pendingSendPosition);
+                session->m_pendingSendPosition = 0;
+            }
+            const auto data = static_cast<const std::uint8_t*>(buffer);
+            pendingData.insert(pendingData.end(), data, data + size);
+        }
+    }
+
+    // Reader which doesn't consume data can't hold the writer forever
+    if (stalled) {
+        if (!m_closed.exchange(true)) connection->closeSession(*session);
+        errno = ETIMEDOUT;
+        return -1;
+    }
+
+    try {
+        connection->sendPendingData(*session);
+    } catch (std::system_error& ex) {
+        errno = ex.code().value();
+        return -1;
+    }
+    return size;
+}
+
+off_t MultiplexedSessionIo::skip([[maybe_unused]] std::size_t size)
+{
+    errno = ESPIPE;
+    return -1;
+}
+
+int MultiplexedSessionIo::close()
+{
+    if (m_closed.exchange(true)) throw std::runtime_error("Session is already closed");
+    m_connection->closeSession(*m_session);
+    return 0;
+}
+
+bool MultiplexedSessionIo::isValid() const
+{
+    return !m_closed;
+}
+
+}  // namespace siodb::net
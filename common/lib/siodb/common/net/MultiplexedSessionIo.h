@@ -0,0 +1,131 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "MultiplexedConnection.h"
+#include "../io/IoBase.h"
+
+// STL headers
+#include <atomic>
+#include <chrono>
+
+namespace siodb::net {
+
+/**
+ * IO of the single session of the multiplexed connection. Behaves like connected
+ * socket: reads block until session data is available and return 0 when session
+ * is closed, writes block while session send window is exhausted, unless connection
+ * allows pending send data.
+ */
+class MultiplexedSessionIo final : public io::IoBase {
+public:
+    /**
+     * Initializes object of class MultiplexedSessionIo.
+     * @param connection Multiplexed connection.
+     * @param session Session state.
+     */
+    MultiplexedSessionIo(std::shared_ptr<MultiplexedConnection> connection,
+            std::shared_ptr<MultiplexedConnection::Session> session) noexcept;
+
+    /** De-initializes object of class MultiplexedSessionIo. Closes session. */
+    ~MultiplexedSessionIo();
+
+    DECLARE_NONCOPYABLE(MultiplexedSessionIo);
+
+    /**
+     * Returns session ID.
+     * @return Session ID.
+     */
+    std::uint64_t getSessionId() const noexcept
+    {
+        return m_session->m_id;
+    }
+
+    /**
+     * Reads session data.
+     * @param buffer Data buffer.
+     * @param size Buffer size in bytes.
+     * @return Count of read bytes, 0 if session is closed.
+     */
+    std::size_t read(void* buffer, std::size_t size) override;
+
+    /**
+     * Takes next complete message written by the protobuf::writeMessage() from the received
+     * session data. Doesn't block. Connection must be created with message input setting.
+     * @param message Buffer for the message including its type and length prefix.
+     * @return true if message is taken, false if there is no complete message
+     *         or session is closed.
+     * @throw SiodbProtocolError if message is invalid.
+     */
+    bool readMessage(std::vector<std::uint8_t>& message);
+
+    /**
+     * Writes session data. If connection allows pending send data, data is queued
+     * and sent when window allows, writer waits only while pending data limit is reached.
+     * Session is closed if it makes no progress during this wait for the send stall timeout.
+     * @param buffer Data buffer.
+     * @param size Size of data in bytes.
+     * @return Count of written bytes.
+     */
+    std::size_t write(const void* buffer, std::size_t size) override;
+
+    /**
+     * Skipping is not supported by the session.
+     * @param size Count of bytes to skip.
+     * @return Always -1.
+     */
+    off_t skip(std::size_t size) override;
+
+    /**
+     * Closes session.
+     * @return 0 in case of success.
+     */
+    int close() override;
+
+    /**
+     * Returns indication that session is not closed by this side.
+     * @return true means valid IO, false otherwise.
+     */
+    bool isValid() const override;
+
+private:
+    /**
+     * Accounts data taken from the received session data.
+     * Session must be locked.
+     * @param session Session state.
+     * @param size Size of consumed data.
+     * @return Window increment to report or zero.
+     */
+    static std::size_t consumeReceivedDataUnlocked(
+            MultiplexedConnection::Session& session, std::size_t size);
+
+    /**
+     * Queues data to be sent when window allows.
+     * @param buffer Data buffer.
+     * @param size Size of data in bytes.
+     * @return Count of written bytes.
+     */
+    std::size_t writePending(const void* buffer, std::size_t size);
+
+private:
+    /** Multiplexed connection */
+    const std::shared_ptr<MultiplexedConnection> m_connection;
+
+    /** Session state */
+    const std::shared_ptr<MultiplexedConnection::Session> m_session;
+
+    /** Indication that session is closed by this side */
+    std::atomic<bool> m_closed;
+
+    /** Period of checking exit signal while waiting */
+    static constexpr std::chrono::milliseconds kExitSignalCheckPeriod =
+            std::chrono::milliseconds(100);
+
+    /** Time after which the writer stops waiting for the reader which doesn't consume data */
+    static constexpr std::chrono::seconds kSendStallTimeout = std::chrono::seconds(60);
+};
+
+}  // namespace siodb::net
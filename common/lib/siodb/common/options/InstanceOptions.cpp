@@ -16,7 +16,9 @@
 #include <cstring>
 
 // STL headers
+#include <algorithm>
 #include <array>
+#include <thread>
 #include <unordered_set>
 
 // Boost headers
@@ -135,6 +137,31 @@ void InstanceOptions::load(const std::string& instanceName)
     }
     tmpOptions.m_generalOptions.m_maxUserConnections = maxUserConnections;
 
+    // Parse connection worker pool size
+    const auto connectionWorkerPoolSize =
+            config.get<unsigned>(constructOptionPath(kGeneralOptionConnectionWorkerPoolSize),
+                    kDefaultConnectionWorkerPoolSize);
+    if (connectionWorkerPoolSize > kMaxConnectionWorkerPoolSize) {
+        throw InvalidConfigurationOptionError("Connection worker pool size is out of range");
+    }
+    tmpOptions.m_generalOptions.m_connectionWorkerPoolSize = connectionWorkerPoolSize;
+
+    // Parse max number of clients per connection worker
+    const auto maxClientsPerConnectionWorker =
+            config.get<unsigned>(constructOptionPath(kGeneralOptionMaxClientsPerConnectionWorker),
+                    kDefaultMaxClientsPerConnectionWorker);
+    if (maxClientsPerConnectionWorker < 1
+            || maxClientsPerConnectionWorker > kMaxMaxClientsPerConnectionWorker) {
+        throw InvalidConfigurationOptionError(
+                "Max. number of clients per connection worker is out of range");
+    }
+    tmpOptions.m_generalOptions.m_maxClientsPerConnectionWorker = maxClientsPerConnectionWorker;
+
+    // Parse max number of clients served by connection worker during its lifetime
+    tmpOptions.m_generalOptions.m_maxConnectionWorkerLifetimeClients = config.get<unsigned>(
+            constructOptionPath(kGeneralOptionMaxConnectionWorkerLifetimeClients),
+            kDefaultMaxConnectionWorkerLifetimeClients);
+
     // Log options
 
     {
@@ -349,9 +376,11 @@ void InstanceOptions::load(const std::string& instanceName)
         tmpOptions.m_ioManagerOptions.m_workerThreadNumber =
                 config.get<unsigned>(constructOptionPath(kIOManagerOptionWorkerThreadNumber),
                         kDefaultIOManagerWorkerThreadNumber);
-        if (tmpOptions.m_ioManagerOptions.m_workerThreadNumber < 1) {
-            throw InvalidConfigurationOptionError(
-                    "Number of IO Manager worker threads is out of range");
+        // Requests run database operations which wait for disk, so threads outnumber CPUs
+        if (tmpOptions.m_ioManagerOptions.m_workerThreadNumber == 0) {
+            tmpOptions.m_ioManagerOptions.m_workerThreadNumber =
+                    std::max(kMinAutoIOManagerWorkerThreadNumber,
+                            2 * std::thread::hardware_concurrency());
         }
     }
 
@@ -414,6 +443,22 @@ void InstanceOptions::load(const std::string& instanceName)
         }
     }
 
+    // Parse statement cache capacity
+    tmpOptions.m_ioManagerOptions.m_statementCacheCapacity =
+            config.get<unsigned>(constructOptionPath(kIOManagerOptionStatementCacheCapacity),
+                    kDefaultIOManagerStatementCacheCapacity);
+
+    // Parse GROUP BY memory limit
+    {
+        tmpOptions.m_ioManagerOptions.m_groupByMemoryLimit =
+                config.get<unsigned>(constructOptionPath(kIOManagerOptionGroupByMemoryLimit),
+                        kDefaultIOManagerGroupByMemoryLimit);
+        if (tmpOptions.m_ioManagerOptions.m_groupByMemoryLimit
+                < kMinIOManagerGroupByMemoryLimit) {
+            throw InvalidConfigurationOptionError("IO Manager GROUP BY memory limit is too small");
+        }
+    }
+
     // Parse user cache capacity
     {
         tmpOptions.m_ioManagerOptions.m_userCacheCapacity =
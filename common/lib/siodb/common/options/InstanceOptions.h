@@ -32,6 +32,11 @@ constexpr const char* kGeneralOptionMaxAdminConnections = "max_admin_connections
 constexpr const char* kGeneralOptionUserConnectionListenerBacklog =
         "user_connection_listener_backlog";
 constexpr const char* kGeneralOptionMaxUserConnections = "max_user_connections";
+constexpr const char* kGeneralOptionConnectionWorkerPoolSize = "connection_worker_pool_size";
+constexpr const char* kGeneralOptionMaxClientsPerConnectionWorker =
+        "max_clients_per_connection_worker";
+constexpr const char* kGeneralOptionMaxConnectionWorkerLifetimeClients =
+        "max_connection_worker_lifetime_clients";
 
 // IO Manager options
 constexpr const char* kIOManagerOptionIpv4Port = "iomgr.ipv4_port";
@@ -42,6 +47,8 @@ constexpr const char* kIOManagerOptionUserCacheCapacity = "iomgr.user_cache_capa
 constexpr const char* kIOManagerOptionDatabaseCacheCapacity = "iomgr.database_cache_capacity";
 constexpr const char* kIOManagerOptionTableCacheCapacity = "iomgr.table_cache_capacity";
 constexpr const char* kIOManagerOptionBlockCacheCapacity = "iomgr.block_cache_capacity";
+constexpr const char* kIOManagerOptionStatementCacheCapacity = "iomgr.statement_cache_capacity";
+constexpr const char* kIOManagerOptionGroupByMemoryLimit = "iomgr.group_by_memory_limit";
 
 // Encryption options
 constexpr const char* kEncryptionOptionDefaultCipherId = "encryption.default_cipher_id";
@@ -83,8 +90,21 @@ constexpr int kMaxUserConnectionListenerBacklog = 32768;
 constexpr unsigned kDefaultMaxUserConnections = 10;
 constexpr unsigned kMaxMaxUserConnections = 32768;
 
-// Default number of IO Manager worker threads
-constexpr const unsigned kDefaultIOManagerWorkerThreadNumber = 2;
+// Number of pre-started connection workers per listener
+constexpr unsigned kDefaultConnectionWorkerPoolSize = 2;
+constexpr unsigned kMaxConnectionWorkerPoolSize = 256;
+
+// Max. number of clients served by connection worker simultaneously
+constexpr unsigned kDefaultMaxClientsPerConnectionWorker = 16;
+constexpr unsigned kMaxMaxClientsPerConnectionWorker = 1024;
+
+// Max. number of clients served by connection worker before it is replaced
+constexpr unsigned kDefaultMaxConnectionWorkerLifetimeClients = 1000;
+
+// Default number of IO Manager worker threads, 0 means twice the number of CPUs,
+// but at least kMinAutoIOManagerWorkerThreadNumber
+constexpr const unsigned kDefaultIOManagerWorkerThreadNumber = 0;
+constexpr const unsigned kMinAutoIOManagerWorkerThreadNumber = 4;
 constexpr const unsigned kDefaultIOManagerWriterThreadNumber = 2;
 
 // Default IOManager ports
@@ -108,6 +128,13 @@ constexpr std::size_t kDefaultIOManagerTableCacheCapacity = 100;
 constexpr std::size_t kMinIOManagerBlockCacheCapacity = 50;
 constexpr std::size_t kDefaultIOManagerBlockCacheCapacity = 103;
 
+// IOManager statement cache capacity
+constexpr std::size_t kDefaultIOManagerStatementCacheCapacity = 1000;
+
+// IOManager memory limit of the single GROUP BY (in MiB)
+constexpr std::size_t kMinIOManagerGroupByMemoryLimit = 1;
+constexpr std::size_t kDefaultIOManagerGroupByMemoryLimit = 256;
+
 /** Default cipher */
 constexpr const char* kDefaultCipherId = "aes128";
 
@@ -146,6 +173,18 @@ struct GeneralOptions {
     /** Maximum number of user connections */
     unsigned m_maxUserConnections = kDefaultMaxUserConnections;
 
+    /** Number of pre-started connection workers per listener, 0 disables worker pool */
+    unsigned m_connectionWorkerPoolSize = kDefaultConnectionWorkerPoolSize;
+
+    /** Maximum number of clients served by pooled connection worker simultaneously */
+    unsigned m_maxClientsPerConnectionWorker = kDefaultMaxClientsPerConnectionWorker;
+
+    /**
+     * Maximum number of clients served by pooled connection worker before it is replaced,
+     * 0 means unlimited.
+     */
+    unsigned m_maxConnectionWorkerLifetimeClients = kDefaultMaxConnectionWorkerLifetimeClients;
+
     /**
      * Explicit superuser's initial access key. Needed only when creating new instance.
      * Use this one only for unit tests.
@@ -161,8 +200,8 @@ struct GeneralOptions {
 
 /** IO Manager options */
 struct IOManagerOptions {
-    /** Worker thread number */
-    std::size_t m_workerThreadNumber = kDefaultIOManagerWorkerThreadNumber;
+    /** Worker thread number, automatic number is resolved when options are read */
+    std::size_t m_workerThreadNumber = kMinAutoIOManagerWorkerThreadNumber;
 
     /** Writer thread number */
     std::size_t m_writerThreadNumber = kDefaultIOManagerWriterThreadNumber;
@@ -184,6 +223,12 @@ struct IOManagerOptions {
 
     /** Block cache capacity */
     std::size_t m_blockCacheCapacity = kDefaultIOManagerBlockCacheCapacity;
+
+    /** Statement cache capacity, zero disables cache */
+    std::size_t m_statementCacheCapacity = kDefaultIOManagerStatementCacheCapacity;
+
+    /** Memory limit of the single GROUP BY (in MiB) */
+    std::size_t m_groupByMemoryLimit = kDefaultIOManagerGroupByMemoryLimit;
 };
 
 /** Extenal cipher options */
@@ -17,6 +17,31 @@
 
 namespace siodb::protobuf {
 
+namespace {
+
+/**
+ * Checks that message type is expected one.
+ * @param messageTypeId Received message type identifier.
+ * @param messageType Expected message type identifier.
+ * @throw SiodbProtocolError if message type is not expected one.
+ */
+void checkMessageType(std::uint32_t messageTypeId, ProtocolMessageType messageType)
+{
+    if (messageTypeId >= stdext::underlying_value(ProtocolMessageType::kMax)) {
+        std::ostringstream err;
+        err << "Protocol error: Unsupported message type " << messageTypeId;
+        throw SiodbProtocolError(err.str());
+    }
+    if (messageTypeId != stdext::underlying_value(messageType)) {
+        std::ostringstream err;
+        err << "Protocol error: Unexpected message type " << messageTypeId
+            << " while waiting for " << stdext::underlying_value(messageType);
+        throw SiodbProtocolError(err.str());
+    }
+}
+
+}  // namespace
+
 void readMessage(ProtocolMessageType messageType, google::protobuf::MessageLite& message,
         io::IoBase& io, const utils::ErrorCodeChecker& errorCodeChecker)
 {
@@ -37,17 +62,7 @@ void readMessage(ProtocolMessageType messageType, google::protobuf::MessageLite&
         if (!codedInput.ReadVarint32(&messageTypeId)) {
             checkInputStreamError(inputStream);
         }
-        if (messageTypeId >= stdext::underlying_value(ProtocolMessageType::kMax)) {
-            std::ostringstream err;
-            err << "Protocol error: Unsupported message type " << messageTypeId;
-            throw SiodbProtocolError(err.str());
-        }
-        if (messageTypeId != stdext::underlying_value(messageType)) {
-            std::ostringstream err;
-            err << "Protocol error: Unexpected message type " << messageTypeId
-                << " while waiting for " << stdext::underlying_value(messageType);
-            throw SiodbProtocolError(err.str());
-        }
+        checkMessageType(messageTypeId, messageType);
     }
 
     // Read message
@@ -63,6 +78,25 @@ void readMessage(ProtocolMessageType messageType, google::protobuf::MessageLite&
     }
 }
 
+void parseMessage(ProtocolMessageType messageType, google::protobuf::MessageLite& message,
+        const void* data, std::size_t size)
+{
+    google::protobuf::io::CodedInputStream codedInput(
+            static_cast<const std::uint8_t*>(data), static_cast<int>(size));
+
+    std::uint32_t messageTypeId = 0;
+    if (!codedInput.ReadVarint32(&messageTypeId))
+        throw SiodbProtocolError("Protocol error: can't read message type");
+    checkMessageType(messageTypeId, messageType);
+
+    std::uint32_t messageSize = 0;
+    if (!codedInput.ReadVarint32(&messageSize))
+        throw SiodbProtocolError("Protocol error: can't read message size");
+    codedInput.PushLimit(static_cast<int>(messageSize));
+    if (!message.ParseFromCodedStream(&codedInput) || !codedInput.ConsumedEntireMessage())
+        throw SiodbProtocolError("Protocol error: invalid message");
+}
+
 void writeMessage(ProtocolMessageType messageType, const google::protobuf::MessageLite& message,
         io::IoBase& io, const utils::ErrorCodeChecker& errorCodeChecker)
 {
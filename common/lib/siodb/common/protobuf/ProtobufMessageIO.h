@@ -45,6 +45,17 @@ void readMessage(ProtocolMessageType messageType, google::protobuf::MessageLite&
 void readMessage(ProtocolMessageType messageType, google::protobuf::MessageLite& message,
         CustomProtobufInputStream& inputStream);
 
+/**
+ * Parses protobuf message written by writeMessage() from a memory buffer.
+ * @param messageType message type identifier
+ * @param message a message
+ * @param data Message data including message type and length.
+ * @param size Size of message data.
+ * @throw SiodbProtocolError when protocol error happens.
+ */
+void parseMessage(ProtocolMessageType messageType, google::protobuf::MessageLite& message,
+        const void* data, std::size_t size);
+
 /**
  * Writes protobuf message to an IO stream.
  * @param messageType message type identifier.
@@ -22,6 +22,7 @@ enum class ProtocolMessageType : unsigned {
     kBeginAuthenticateUserResponse,  // message BeginAuthenticateUserResponse
     kAuthenticateUserRequest,  // message AuthenticateUserRequest
     kAuthenticateUserResponse,  // message AuthenticateUserResponse
+    kSessionFrameHeader,  // message SessionFrameHeader
 
     kMax  // message type limit
 };
@@ -5,7 +5,7 @@
 #pragma once
 
 // Project headers
-#include "HelperMacros.h>
+#include "HelperMacros.h"
 #include "WaitInterruptedException.h"
 
 // STL headers
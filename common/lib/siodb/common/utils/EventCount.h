@@ -0,0 +1,98 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "HelperMacros.h"
+
+// STL headers
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+// System headers
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace siodb::utils {
+
+/**
+ * Event count: lets threads park on the futex until some lock-free condition changes,
+ * without taking any lock on the fast path. Waiter protocol:
+ *   1. key = prepareWait();
+ *   2. Check condition again, if it is satisfied, call cancelWait() and proceed;
+ *   3. Otherwise call wait(key).
+ * Notifier changes condition, then calls notify(). If no thread is waiting, notify() costs
+ * one fence and one load. Otherwise every notify() advances the sequence number and wakes
+ * a thread, so that N notifications wake N parked threads.
+ */
+class EventCount final {
+public:
+    /** Initializes object of class EventCount. */
+    EventCount() noexcept
+        : m_sequence(0)
+        , m_waiterCount(0)
+    {
+    }
+
+    DECLARE_NONCOPYABLE(EventCount);
+
+    /**
+     * Registers calling thread as a waiter.
+     * @return Key to pass into wait().
+     */
+    std::uint32_t prepareWait() noexcept
+    {
+        m_waiterCount.fetch_add(1, std::memory_order_seq_cst);
+        return m_sequence.load(std::memory_order_acquire);
+    }
+
+    /** Unregisters calling thread as a waiter, when condition got satisfied. */
+    void cancelWait() noexcept
+    {
+        m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Parks calling thread until notify() is called after prepareWait().
+     * @param key Key returned by prepareWait().
+     */
+    void wait(std::uint32_t key) noexcept
+    {
+        while (m_sequence.load(std::memory_order_acquire) == key) {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&m_sequence),
+                    FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+        }
+        m_waiterCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Wakes up waiting threads, if there are any.
+     * @param all Indication that all waiting threads should be woken up, otherwise one.
+     */
+    void notify(bool all = false) noexcept
+    {
+        // Pairs with the increment of the waiter count in the prepareWait()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiterCount.load(std::memory_order_relaxed) == 0) return;
+        // Thread which has not parked yet sees new sequence number and doesn't park
+        m_sequence.fetch_add(1, std::memory_order_acq_rel);
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&m_sequence), FUTEX_WAKE_PRIVATE,
+                all ? INT_MAX : 1, nullptr, nullptr, 0);
+    }
+
+private:
+    /** Futex word: notification sequence number */
+    std::atomic<std::uint32_t> m_sequence;
+
+    /** Number of the registered waiters */
+    std::atomic<std::uint32_t> m_waiterCount;
+
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+            "Futex word must be 32 bit");
+};
+
+}  // namespace siodb::utils
@@ -0,0 +1,352 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "EventCount.h"
+#include "HelperMacros.h"
+#include "WaitInterruptedException.h"
+
+// STL headers
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+namespace siodb::utils {
+
+/**
+ * Bounded lock-free multi-producer multi-consumer queue, based on the ring buffer
+ * design of Dmitry Vyukov: each cell carries a sequence number, which tells
+ * producers and consumers whether the cell is free or filled for the current lap,
+ * so push and pop take a single CAS on the uncontended path.
+ * Blocking operations park the calling thread on the futex only when the queue
+ * is empty (pop) or full (push).
+ * @tparam T Element type, must be nothrow move constructible.
+ */
+template<typename T>
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+            "MpmcQueue element must be nothrow move constructible");
+
+public:
+    /**
+     * Initializes object of class MpmcQueue.
+     * @param capacity Maximum number of elements, must be power of 2 and at least 2.
+     * @throw std::invalid_argument if capacity is invalid.
+     */
+    explicit MpmcQueue(std::size_t capacity)
+        : m_capacity(checkCapacity(capacity))
+        , m_cells(new Cell[capacity])
+        , m_interruptRequested(false)
+        , m_enqueuePos(0)
+        , m_dequeuePos(0)
+    {
+        for (std::size_t i = 0; i < capacity; ++i)
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /** De-initializes object of class MpmcQueue. Destroys remaining elements. */
+    ~MpmcQueue()
+    {
+        alignas(T) unsigned char buffer[sizeof(T)];
+        while (tryPopInto(buffer))
+            reinterpret_cast<T*>(buffer)->~T();
+    }
+
+    DECLARE_NONCOPYABLE(MpmcQueue);
+
+    /**
+     * Returns maximum number of elements.
+     * @return Queue capacity.
+     */
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Returns approximate number of elements, exact when there are no concurrent operations.
+     * @return Number of elements.
+     */
+    std::size_t size() const noexcept
+    {
+        const auto dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+        const auto enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    /**
+     * Returns indication that queue is empty, exact when there are no concurrent operations.
+     * @return true if queue is empty, false otherwise.
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Pushes element to the queue, if there is free space.
+     * @param e An element.
+     * @return true if element was pushed, false if queue is full.
+     */
+    bool try_push(const T& e)
+    {
+        return tryEmplace(e);
+    }
+
+    /**
+     * Pushes element to the queue, if there is free space.
+     * @param e An element. Not moved from, if queue is full.
+     * @return true if element was pushed, false if queue is full.
+     */
+    bool try_push(T&& e)
+    {
+        return tryEmplace(std::move(e));
+    }
+
+    /**
+     * Pushes element to the queue. If queue is full, waits for free space.
+     * Wait can be interrupted by calling request_interrupt().
+     * @param e An element.
+     * @throw WaitInterruptedException if operation was interrupted.
+     */
+    void push(const T& e)
+    {
+        waitAndEmplace(e);
+    }
+
+    /**
+     * Pushes element to the queue. If queue is full, waits for free space.
+     * Wait can be interrupted by calling request_interrupt().
+     * @param e An element. Not moved from, if operation was interrupted.
+     * @throw WaitInterruptedException if operation was interrupted.
+     */
+    void push(T&& e)
+    {
+        waitAndEmplace(std::move(e));
+    }
+
+    /**
+     * Pops element from the queue, if there is any.
+     * @param[out] e Popped element.
+     * @return true if element was popped, false if queue is empty.
+     */
+    bool try_pop(T& e)
+    {
+        alignas(T) unsigned char buffer[sizeof(T)];
+        if (!tryPopInto(buffer)) return false;
+        auto& poppedElement = *reinterpret_cast<T*>(buffer);
+        e = std::move(poppedElement);
+        poppedElement.~T();
+        return true;
+    }
+
+    /**
+     * Pops element from the queue. If no elements available, waits for an element to appear.
+     * Wait can be interrupted by calling request_interrupt().
+     * @return Popped element.
+     * @throw WaitInterruptedException if operation was interrupted.
+     */
+    T pop()
+    {
+        alignas(T) unsigned char buffer[sizeof(T)];
+        while (true) {
+            checkInterrupt("MpmcQueue::pop(): wait interrupted");
+            if (tryPopInto(buffer)) break;
+            const auto key = m_notEmptyEvent.prepareWait();
+            if (m_interruptRequested.load(std::memory_order_acquire)) {
+                m_notEmptyEvent.cancelWait();
+                continue;
+            }
+            if (tryPopInto(buffer)) {
+                m_notEmptyEvent.cancelWait();
+                break;
+            }
+            m_notEmptyEvent.wait(key);
+        }
+        auto& poppedElement = *reinterpret_cast<T*>(buffer);
+        T e(std::move(poppedElement));
+        poppedElement.~T();
+        return e;
+    }
+
+    /** Requests interrupt of waiting in the pop() and push(). */
+    void request_interrupt()
+    {
+        m_interruptRequested.store(true, std::memory_order_release);
+        m_notEmptyEvent.notify(true);
+        m_notFullEvent.notify(true);
+    }
+
+    /** Cancels interrupt request. */
+    void cancel_interrupt()
+    {
+        m_interruptRequested.store(false, std::memory_order_release);
+    }
+
+private:
+    /** Ring buffer cell */
+    struct Cell {
+        /** Sequence number: position for which cell is free or filled */
+        std::atomic<std::size_t> m_sequence;
+
+        /** Element storage */
+        alignas(T) unsigned char m_storage[sizeof(T)];
+    };
+
+    /**
+     * Validates capacity.
+     * @param capacity Capacity.
+     * @return Capacity.
+     * @throw std::invalid_argument if capacity is not power of 2 or is less than 2.
+     */
+    static std::size_t checkCapacity(std::size_t capacity)
+    {
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+            throw std::invalid_argument("MpmcQueue capacity must be power of 2");
+        return capacity;
+    }
+
+    /**
+     * Throws WaitInterruptedException if interrupt is requested.
+     * @param message Exception message.
+     * @throw WaitInterruptedException if interrupt is requested.
+     */
+    void checkInterrupt(const char* message) const
+    {
+        if (m_interruptRequested.load(std::memory_order_acquire))
+            throw WaitInterruptedException(message);
+    }
+
+    /**
+     * Reserves cell for pushing.
+     * @param[out] pos Position of the reserved cell.
+     * @return Reserved cell or nullptr if queue is full.
+     */
+    Cell* tryReservePushCell(std::size_t& pos) noexcept
+    {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[pos & (m_capacity - 1)];
+            const auto sequence = cell.m_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return &cell;
+            } else if (diff < 0)
+                return nullptr;
+            else
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Pushes element, if there is free space.
+     * @param e An element.
+     * @return true if element was pushed, false if queue is full.
+     */
+    template<class U>
+    bool tryEmplace(U&& e)
+    {
+        // Construct a copy before reserving cell, so that throwing copy constructor
+        // doesn't leave reserved cell which is never filled
+        if constexpr (!std::is_nothrow_constructible_v<T, U&&>) {
+            T copy(std::forward<U>(e));
+            return tryEmplace(std::move(copy));
+        } else {
+            std::size_t pos = 0;
+            const auto cell = tryReservePushCell(pos);
+            if (!cell) return false;
+            new (cell->m_storage) T(std::forward<U>(e));
+            cell->m_sequence.store(pos + 1, std::memory_order_release);
+            m_notEmptyEvent.notify();
+            return true;
+        }
+    }
+
+    /**
+     * Pushes element, waits for free space if queue is full.
+     * Interrupt request affects only waiting, like in the ConcurrentQueue.
+     * @param e An element.
+     * @throw WaitInterruptedException if operation was interrupted.
+     */
+    template<class U>
+    void waitAndEmplace(U&& e)
+    {
+        while (true) {
+            if (tryEmplace(std::forward<U>(e))) return;
+            checkInterrupt("MpmcQueue::push(): wait interrupted");
+            const auto key = m_notFullEvent.prepareWait();
+            if (m_interruptRequested.load(std::memory_order_acquire)) {
+                m_notFullEvent.cancelWait();
+                continue;
+            }
+            if (tryEmplace(std::forward<U>(e))) {
+                m_notFullEvent.cancelWait();
+                return;
+            }
+            m_notFullEvent.wait(key);
+        }
+    }
+
+    /**
+     * Pops element into the raw storage, if there is any.
+     * @param buffer Storage for the element, must be suitably aligned.
+     * @return true if element was popped, false if queue is empty.
+     */
+    bool tryPopInto(unsigned char* buffer) noexcept
+    {
+        auto pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true) {
+            cell = &m_cells[pos & (m_capacity - 1)];
+            const auto sequence = cell->m_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0)
+                return false;
+            else
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+        }
+        auto& element = *reinterpret_cast<T*>(cell->m_storage);
+        new (buffer) T(std::move(element));
+        element.~T();
+        cell->m_sequence.store(pos + m_capacity, std::memory_order_release);
+        m_notFullEvent.notify();
+        return true;
+    }
+
+private:
+    /** Size of the cache line, used to keep producer and consumer positions apart */
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    /** Maximum number of elements */
+    const std::size_t m_capacity;
+
+    /** Ring buffer */
+    const std::unique_ptr<Cell[]> m_cells;
+
+    /** Indicates that pop() and push() operations must be interrupted */
+    std::atomic<bool> m_interruptRequested;
+
+    /** Waiters for an element */
+    EventCount m_notEmptyEvent;
+
+    /** Waiters for free space */
+    EventCount m_notFullEvent;
+
+    /** Next position to push */
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_enqueuePos;
+
+    /** Next position to pop */
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_dequeuePos;
+};
+
+}  // namespace siodb::utils
@@ -0,0 +1,170 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "HelperMacros.h"
+
+// STL headers
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace siodb::utils {
+
+/**
+ * Bounded lock-free work-stealing deque (Chase-Lev, with the memory orderings
+ * from Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+ * Owner thread pushes and pops at the bottom end, in LIFO order, which keeps
+ * the recently produced work in cache. Any other thread steals from the top end,
+ * taking the oldest work first.
+ * @tparam T Element type. Must be trivially copyable, because thief may read
+ *           element which is concurrently taken by another thread; usually a pointer.
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>,
+            "WorkStealingDeque element must be trivially copyable");
+
+public:
+    /**
+     * Initializes object of class WorkStealingDeque.
+     * @param capacity Maximum number of elements, must be power of 2 and at least 2.
+     * @throw std::invalid_argument if capacity is invalid.
+     */
+    explicit WorkStealingDeque(std::size_t capacity)
+        : m_capacity(checkCapacity(capacity))
+        , m_elements(new std::atomic<T>[capacity])
+        , m_top(0)
+        , m_bottom(0)
+    {
+    }
+
+    DECLARE_NONCOPYABLE(WorkStealingDeque);
+
+    /**
+     * Returns maximum number of elements.
+     * @return Deque capacity.
+     */
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /**
+     * Returns approximate number of elements, exact when there are no concurrent operations.
+     * @return Number of elements.
+     */
+    std::size_t size() const noexcept
+    {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed);
+        const auto top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    /**
+     * Returns indication that deque is empty, exact when there are no concurrent operations.
+     * @return true if deque is empty, false otherwise.
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Pushes element to the bottom. Must be called only by the owner thread.
+     * @param e An element.
+     * @return true if element was pushed, false if deque is full.
+     */
+    bool push(T e) noexcept
+    {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed);
+        const auto top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<std::int64_t>(m_capacity)) return false;
+        m_elements[bottom & (m_capacity - 1)].store(e, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Pops element from the bottom. Must be called only by the owner thread.
+     * @return Element or nothing if deque is empty.
+     */
+    std::optional<T> pop() noexcept
+    {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = m_top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            // Deque is empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        const auto e = m_elements[bottom & (m_capacity - 1)].load(std::memory_order_relaxed);
+        if (top < bottom) return e;
+
+        // Last element, race with thieves
+        const bool won = m_top.compare_exchange_strong(
+                top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won ? std::optional<T>(e) : std::nullopt;
+    }
+
+    /**
+     * Steals element from the top. Can be called by any thread.
+     * @return Element or nothing if deque is empty or another thread won the race.
+     */
+    std::optional<T> steal() noexcept
+    {
+        auto top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom) return std::nullopt;
+
+        const auto e = m_elements[top & (m_capacity - 1)].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return std::nullopt;
+        return e;
+    }
+
+private:
+    /**
+     * Validates capacity.
+     * @param capacity Capacity.
+     * @return Capacity.
+     * @throw std::invalid_argument if capacity is not power of 2 or is less than 2.
+     */
+    static std::size_t checkCapacity(std::size_t capacity)
+    {
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+            throw std::invalid_argument("WorkStealingDeque capacity must be power of 2");
+        return capacity;
+    }
+
+private:
+    /** Size of the cache line, used to keep owner and thief positions apart */
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    /** Maximum number of elements */
+    const std::size_t m_capacity;
+
+    /** Ring buffer */
+    const std::unique_ptr<std::atomic<T>[]> m_elements;
+
+    /** Top position, where thieves steal */
+    alignas(kCacheLineSize) std::atomic<std::int64_t> m_top;
+
+    /** Bottom position, where owner pushes and pops */
+    alignas(kCacheLineSize) std::atomic<std::int64_t> m_bottom;
+};
+
+}  // namespace siodb::utils
@@ -0,0 +1,51 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+// Common project headers
+#include <siodb/common/net/FileDescriptorPassing.h>
+#include <siodb/common/utils/FileDescriptorGuard.h>
+
+// System headers
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Google Test
+#include <gtest/gtest.h>
+
+using namespace siodb;
+
+TEST(FileDescriptorPassingTest, PassPipe)
+{
+    int sockets[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets), 0);
+    FileDescriptorGuard sender(sockets[0]), receiver(sockets[1]);
+
+    int pipeFds[2];
+    ASSERT_EQ(::pipe(pipeFds), 0);
+    FileDescriptorGuard pipeRead(pipeFds[0]), pipeWrite(pipeFds[1]);
+
+    net::sendFileDescriptor(sender.getFd(), pipeWrite.getFd());
+    pipeWrite.reset();
+    FileDescriptorGuard receivedFd(net::receiveFileDescriptor(receiver.getFd()));
+    ASSERT_TRUE(receivedFd.isValidFd());
+    EXPECT_NE(::fcntl(receivedFd.getFd(), F_GETFD) & FD_CLOEXEC, 0);
+
+    // Received descriptor refers to the same pipe
+    const char data = 'x';
+    ASSERT_EQ(::write(receivedFd.getFd(), &data, 1), 1);
+    char readData = 0;
+    ASSERT_EQ(::read(pipeRead.getFd(), &readData, 1), 1);
+    EXPECT_EQ(readData, data);
+}
+
+TEST(FileDescriptorPassingTest, PeerClosed)
+{
+    int sockets[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets), 0);
+    FileDescriptorGuard sender(sockets[0]), receiver(sockets[1]);
+    sender.reset();
+    EXPECT_EQ(net::receiveFileDescriptor(receiver.getFd()), -1);
+    EXPECT_THROW(net::sendFileDescriptor(receiver.getFd(), STDIN_FILENO), std::system_error);
+}
@@ -0,0 +1,270 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+// Common project headers
+#include <siodb/common/net/ConnectionError.h>
+#include <siodb/common/net/MultiplexedConnection.h>
+#include <siodb/common/net/MultiplexedSessionIo.h>
+#include <siodb/common/protobuf/ProtobufMessageIO.h>
+#include <siodb-generated/common/lib/siodb/common/proto/ClientProtocol.pb.h>
+
+// STL headers
+#include <condition_variable>
+#include <numeric>
+#include <thread>
+
+// System headers
+#include <sys/socket.h>
+
+// Google Test
+#include <gtest/gtest.h>
+
+using namespace siodb;
+
+namespace {
+
+/** Pair of connected multiplexed connections, each served by a receiver thread */
+class ConnectionPair {
+public:
+    explicit ConnectionPair(const net::MultiplexedConnectionSettings& serverSettings = {})
+    {
+        int sockets[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) < 0)
+            throw std::system_error(errno, std::generic_category(), "socketpair() failed");
+        m_client = std::make_shared<net::MultiplexedConnection>(FileDescriptorGuard(sockets[0]));
+        m_server = std::make_shared<net::MultiplexedConnection>(FileDescriptorGuard(sockets[1]),
+                [this](std::unique_ptr<net::MultiplexedSessionIo>&& session) {
+                    std::lock_guard lock(m_mutex);
+                    m_acceptedSessions.push_back(std::move(session));
+                    m_condition.notify_all();
+                },
+                [this]([[maybe_unused]] std::uint64_t sessionId) {
+                    std::lock_guard lock(m_mutex);
+                    ++m_serverSessionEventCount;
+                    m_condition.notify_all();
+                },
+                serverSettings);
+        m_clientThread = std::thread(&ConnectionPair::receiverThreadMain, m_client);
+        m_serverThread = std::thread(&ConnectionPair::receiverThreadMain, m_server);
+    }
+
+    ~ConnectionPair()
+    {
+        m_client->close();
+        m_server->close();
+        m_clientThread.join();
+        m_serverThread.join();
+    }
+
+    std::unique_ptr<net::MultiplexedSessionIo> acceptSession()
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition.wait(lock, [this] { return !m_acceptedSessions.empty(); });
+        auto session = std::move(m_acceptedSessions.front());
+        m_acceptedSessions.erase(m_acceptedSessions.begin());
+        return session;
+    }
+
+    /**
+     * Waits until predicate becomes true, checking it on each server session event.
+     * @param predicate Predicate, receives number of server session events.
+     */
+    template<class Predicate>
+    void waitForServerSessionEvent(Predicate predicate)
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition.wait(lock, [&] { return predicate(m_serverSessionEventCount); });
+    }
+
+    std::size_t getServerSessionEventCount()
+    {
+        std::lock_guard lock(m_mutex);
+        return m_serverSessionEventCount;
+    }
+
+    static void receiverThreadMain(std::shared_ptr<net::MultiplexedConnection> connection)
+    {
+        while (connection->receive()) {
+        }
+    }
+
+    std::shared_ptr<net::MultiplexedConnection> m_client;
+    std::shared_ptr<net::MultiplexedConnection> m_server;
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<std::unique_ptr<net::MultiplexedSessionIo>> m_acceptedSessions;
+    std::size_t m_serverSessionEventCount = 0;
+    std::thread m_clientThread;
+    std::thread m_serverThread;
+};
+
+void readExact(io::IoBase& io, void* buffer, std::size_t size)
+{
+    auto data = static_cast<std::uint8_t*>(buffer);
+    while (size > 0) {
+        const auto n = io.read(data, size);
+        ASSERT_GT(n, 0U);
+        ASSERT_LE(n, size);
+        data += n;
+        size -= n;
+    }
+}
+
+}  // namespace
+
+TEST(MultiplexedConnectionTest, ExchangeData)
+{
+    ConnectionPair connections;
+    auto clientSession1 = connections.m_client->openSession();
+    auto serverSession1 = connections.acceptSession();
+    auto clientSession2 = connections.m_client->openSession();
+    auto serverSession2 = connections.acceptSession();
+    EXPECT_EQ(serverSession1->getSessionId(), clientSession1->getSessionId());
+    EXPECT_EQ(serverSession2->getSessionId(), clientSession2->getSessionId());
+
+    const auto sessionId1 = serverSession1->getSessionId();
+    EXPECT_FALSE(connections.m_server->hasReadableData(sessionId1));
+
+    ASSERT_EQ(clientSession2->write("second", 6), 6U);
+    ASSERT_EQ(clientSession1->write("first", 5), 5U);
+
+    char buffer[16];
+    readExact(*serverSession1, buffer, 5);
+    EXPECT_EQ(std::string(buffer, 5), "first");
+    EXPECT_FALSE(connections.m_server->hasReadableData(sessionId1));
+    readExact(*serverSession2, buffer, 6);
+    EXPECT_EQ(std::string(buffer, 6), "second");
+
+    ASSERT_EQ(serverSession1->write("reply", 5), 5U);
+    readExact(*clientSession1, buffer, 5);
+    EXPECT_EQ(std::string(buffer, 5), "reply");
+}
+
+TEST(MultiplexedConnectionTest, FlowControl)
+{
+    ConnectionPair connections;
+    auto clientSession1 = connections.m_client->openSession();
+    auto serverSession1 = connections.acceptSession();
+    auto clientSession2 = connections.m_client->openSession();
+    auto serverSession2 = connections.acceptSession();
+
+    // Data much larger than window is blocked until receiver reads it
+    std::vector<std::uint8_t> data(net::MultiplexedConnection::kSessionWindowSize * 4);
+    std::iota(data.begin(), data.end(), 0);
+    std::thread writer([&clientSession1, &data] {
+        EXPECT_EQ(clientSession1->write(data.data(), data.size()), data.size());
+    });
+
+    // Other session is not affected by the exhausted window
+    ASSERT_EQ(clientSession2->write("ping", 4), 4U);
+    char buffer[4];
+    readExact(*serverSession2, buffer, sizeof(buffer));
+    EXPECT_EQ(std::string(buffer, sizeof(buffer)), "ping");
+
+    std::vector<std::uint8_t> receivedData(data.size());
+    readExact(*serverSession1, receivedData.data(), receivedData.size());
+    writer.join();
+    EXPECT_EQ(receivedData, data);
+}
+
+TEST(MultiplexedConnectionTest, CloseSession)
+{
+    ConnectionPair connections;
+    auto clientSession = connections.m_client->openSession();
+    auto serverSession = connections.acceptSession();
+
+    ASSERT_EQ(clientSession->write("data", 4), 4U);
+    clientSession->close();
+    EXPECT_FALSE(clientSession->isValid());
+
+    // Data sent before closing is still received
+    char buffer[4];
+    readExact(*serverSession, buffer, sizeof(buffer));
+    errno = -1;
+    EXPECT_EQ(serverSession->read(buffer, sizeof(buffer)), 0U);
+    EXPECT_EQ(errno, 0);
+    EXPECT_TRUE(connections.m_server->hasReadableData(serverSession->getSessionId()));
+    EXPECT_EQ(serverSession->write("data", 4), static_cast<std::size_t>(-1));
+    EXPECT_EQ(errno, EPIPE);
+}
+
+TEST(MultiplexedConnectionTest, CloseConnection)
+{
+    ConnectionPair connections;
+    auto clientSession = connections.m_client->openSession();
+    auto serverSession = connections.acceptSession();
+
+    connections.m_server->close();
+    char buffer[4];
+    EXPECT_EQ(clientSession->read(buffer, sizeof(buffer)), 0U);
+    EXPECT_EQ(serverSession->read(buffer, sizeof(buffer)), 0U);
+    EXPECT_THROW(connections.m_client->openSession(), net::ConnectionError);
+}
+
+TEST(MultiplexedConnectionTest, ReceiveMessageLargerThanWindow)
+{
+    net::MultiplexedConnectionSettings serverSettings;
+    serverSettings.m_messageInput = true;
+    ConnectionPair connections(serverSettings);
+    auto clientSession = connections.m_client->openSession();
+    auto serverSession = connections.acceptSession();
+    const auto sessionId = serverSession->getSessionId();
+    EXPECT_FALSE(connections.m_server->hasReadableMessage(sessionId));
+
+    // Whole message is received without reader, so worker doesn't wait for its rest
+    client_protocol::Command command;
+    command.set_request_id(1);
+    command.set_text(std::string(net::MultiplexedConnection::kSessionWindowSize * 4, 'x'));
+    protobuf::writeMessage(protobuf::ProtocolMessageType::kCommand, command, *clientSession);
+    connections.waitForServerSessionEvent([&](std::size_t) {
+        return connections.m_server->hasReadableMessage(sessionId);
+    });
+
+    std::vector<std::uint8_t> message;
+    ASSERT_TRUE(serverSession->readMessage(message));
+    client_protocol::Command receivedCommand;
+    protobuf::parseMessage(protobuf::ProtocolMessageType::kCommand, receivedCommand,
+            message.data(), message.size());
+    EXPECT_EQ(receivedCommand.request_id(), command.request_id());
+    EXPECT_EQ(receivedCommand.text(), command.text());
+    EXPECT_FALSE(serverSession->readMessage(message));
+    EXPECT_FALSE(connections.m_server->hasReadableMessage(sessionId));
+}
+
+TEST(MultiplexedConnectionTest, ClientNotReading)
+{
+    net::MultiplexedConnectionSettings serverSettings;
+    serverSettings.m_messageInput = true;
+    serverSettings.m_maxPendingSendSize = net::MultiplexedConnection::kSessionWindowSize * 8;
+    ConnectionPair connections(serverSettings);
+    auto clientSession1 = connections.m_client->openSession();
+    auto serverSession1 = connections.acceptSession();
+    auto clientSession2 = connections.m_client->openSession();
+    auto serverSession2 = connections.acceptSession();
+    const auto sessionId1 = serverSession1->getSessionId();
+
+    // Response larger than window is queued while client doesn't read it
+    std::vector<std::uint8_t> data(net::MultiplexedConnection::kSessionWindowSize * 4);
+    std::iota(data.begin(), data.end(), 0);
+    ASSERT_EQ(serverSession1->write(data.data(), data.size()), data.size());
+    EXPECT_TRUE(connections.m_server->hasPendingSendData(sessionId1));
+
+    // Other session is not affected by the queued response
+    ASSERT_EQ(serverSession2->write("pong", 4), 4U);
+    char buffer[4];
+    readExact(*clientSession2, buffer, sizeof(buffer));
+    EXPECT_EQ(std::string(buffer, sizeof(buffer)), "pong");
+
+    // Queued response is sent when client reads, then session is reported
+    const auto eventCount = connections.getServerSessionEventCount();
+    std::vector<std::uint8_t> receivedData(data.size());
+    readExact(*clientSession1, receivedData.data(), receivedData.size());
+    EXPECT_EQ(receivedData, data);
+    connections.waitForServerSessionEvent([&](std::size_t currentEventCount) {
+        return currentEventCount > eventCount
+               && !connections.m_server->hasPendingSendData(sessionId1);
+    });
+}
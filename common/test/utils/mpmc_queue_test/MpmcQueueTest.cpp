@@ -0,0 +1,250 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+// Common project headers
+#include <siodb/common/utils/MpmcQueue.h>
+#include <siodb/common/utils/WorkStealingDeque.h>
+
+// STL headers
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Google Test
+#include <gtest/gtest.h>
+
+TEST(MpmcQueue, InvalidCapacity)
+{
+    using Queue = siodb::utils::MpmcQueue<int>;
+    EXPECT_THROW(Queue(0), std::invalid_argument);
+    EXPECT_THROW(Queue(1), std::invalid_argument);
+    EXPECT_THROW(Queue(12), std::invalid_argument);
+}
+
+TEST(MpmcQueue, PushPopSingleThread)
+{
+    siodb::utils::MpmcQueue<int> queue(4);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.capacity(), 4U);
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(4));
+    EXPECT_EQ(queue.size(), 4U);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.empty());
+
+    // Wrap around the ring buffer several times
+    for (int i = 0; i < 10; ++i) {
+        queue.push(i);
+        EXPECT_EQ(queue.pop(), i);
+    }
+}
+
+TEST(MpmcQueue, MoveOnlyElements)
+{
+    siodb::utils::MpmcQueue<std::unique_ptr<int>> queue(2);
+    queue.push(std::make_unique<int>(1));
+    auto e = std::make_unique<int>(2);
+    EXPECT_TRUE(queue.try_push(std::move(e)));
+    e = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.try_push(std::move(e)));
+    // Element is not moved from when queue is full
+    ASSERT_TRUE(e);
+    EXPECT_EQ(*e, 3);
+    EXPECT_EQ(*queue.pop(), 1);
+    EXPECT_EQ(*queue.pop(), 2);
+
+    // Remaining elements are destroyed with the queue
+    queue.push(std::make_unique<int>(4));
+}
+
+TEST(MpmcQueue, InterruptPop)
+{
+    siodb::utils::MpmcQueue<int> queue(2);
+    std::thread consumer([&queue] {
+        EXPECT_THROW(queue.pop(), siodb::utils::WaitInterruptedException);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue.request_interrupt();
+    consumer.join();
+
+    // Interrupt is sticky until canceled
+    queue.push(1);
+    EXPECT_THROW(queue.pop(), siodb::utils::WaitInterruptedException);
+    queue.cancel_interrupt();
+    EXPECT_EQ(queue.pop(), 1);
+}
+
+TEST(MpmcQueue, InterruptPush)
+{
+    siodb::utils::MpmcQueue<int> queue(2);
+    queue.push(1);
+    queue.push(2);
+    std::thread producer([&queue] {
+        EXPECT_THROW(queue.push(3), siodb::utils::WaitInterruptedException);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue.request_interrupt();
+    producer.join();
+    EXPECT_EQ(queue.size(), 2U);
+}
+
+TEST(MpmcQueue, BlockingPushPop)
+{
+    siodb::utils::MpmcQueue<int> queue(2);
+    constexpr int kCount = 1000;
+    std::thread producer([&queue] {
+        for (int i = 0; i < kCount; ++i)
+            queue.push(i);
+    });
+    for (int i = 0; i < kCount; ++i)
+        EXPECT_EQ(queue.pop(), i);
+    producer.join();
+}
+
+TEST(MpmcQueue, WakeUpAllParkedConsumers)
+{
+    constexpr std::size_t kConsumerCount = 8;
+    constexpr int kRoundCount = 20;
+    siodb::utils::MpmcQueue<int> queue(16);
+
+    for (int round = 0; round < kRoundCount; ++round) {
+        std::atomic<std::size_t> poppedCount(0);
+        std::vector<std::thread> consumers;
+        for (std::size_t i = 0; i < kConsumerCount; ++i) {
+            consumers.emplace_back([&queue, &poppedCount] {
+                try {
+                    queue.pop();
+                    ++poppedCount;
+                } catch (siodb::utils::WaitInterruptedException&) {
+                    // Wakeup was lost
+                }
+            });
+        }
+
+        // Let consumers park, then push one element per consumer back to back
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        for (std::size_t i = 0; i < kConsumerCount; ++i)
+            queue.push(static_cast<int>(i));
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (poppedCount < kConsumerCount && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        EXPECT_EQ(poppedCount, kConsumerCount);
+
+        queue.request_interrupt();
+        for (auto& consumer : consumers)
+            consumer.join();
+        queue.cancel_interrupt();
+        ASSERT_TRUE(queue.empty());
+    }
+}
+
+TEST(MpmcQueue, MultipleProducersAndConsumers)
+{
+    constexpr std::size_t kThreadCount = 4;
+    constexpr std::uint64_t kCountPerProducer = 100000;
+    siodb::utils::MpmcQueue<std::uint64_t> queue(64);
+    std::atomic<std::uint64_t> sum(0);
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([&queue] {
+            for (std::uint64_t value = 1; value <= kCountPerProducer; ++value)
+                queue.push(value);
+        });
+        threads.emplace_back([&queue, &sum] {
+            std::uint64_t localSum = 0;
+            for (std::uint64_t j = 0; j < kCountPerProducer; ++j)
+                localSum += queue.pop();
+            sum += localSum;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(sum, kThreadCount * kCountPerProducer * (kCountPerProducer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(WorkStealingDeque, OwnerOperations)
+{
+    siodb::utils::WorkStealingDeque<int> deque(4);
+    EXPECT_FALSE(deque.pop().has_value());
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(deque.push(i));
+    EXPECT_FALSE(deque.push(4));
+    EXPECT_EQ(deque.size(), 4U);
+
+    // Owner takes newest element, thief takes oldest one
+    EXPECT_EQ(deque.pop(), 3);
+    EXPECT_EQ(deque.steal(), 0);
+    EXPECT_EQ(deque.pop(), 2);
+    EXPECT_EQ(deque.pop(), 1);
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDeque, ConcurrentSteal)
+{
+    constexpr std::size_t kThiefCount = 3;
+    constexpr std::uint64_t kCount = 200000;
+    siodb::utils::WorkStealingDeque<std::uint64_t> deque(256);
+    std::atomic<bool> done(false);
+    std::atomic<std::uint64_t> stolenSum(0);
+    std::atomic<std::uint64_t> stolenCount(0);
+
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i < kThiefCount; ++i) {
+        thieves.emplace_back([&] {
+            std::uint64_t localSum = 0, localCount = 0;
+            while (!done || !deque.empty()) {
+                if (const auto e = deque.steal()) {
+                    localSum += *e;
+                    ++localCount;
+                }
+            }
+            stolenSum += localSum;
+            stolenCount += localCount;
+        });
+    }
+
+    // Owner pushes values and pops some of them back
+    std::uint64_t ownSum = 0, ownCount = 0;
+    for (std::uint64_t value = 1; value <= kCount; ++value) {
+        while (!deque.push(value)) {
+            if (const auto e = deque.pop()) {
+                ownSum += *e;
+                ++ownCount;
+            }
+        }
+        if (value % 3 == 0) {
+            if (const auto e = deque.pop()) {
+                ownSum += *e;
+                ++ownCount;
+            }
+        }
+    }
+    while (const auto e = deque.pop()) {
+        ownSum += *e;
+        ++ownCount;
+    }
+    done = true;
+    for (auto& thief : thieves)
+        thief.join();
+
+    // Each value is taken exactly once
+    EXPECT_EQ(ownCount + stolenCount, kCount);
+    EXPECT_EQ(ownSum + stolenSum, kCount * (kCount + 1) / 2);
+}
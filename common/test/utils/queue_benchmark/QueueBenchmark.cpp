@@ -0,0 +1,116 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+// Microbenchmark of the concurrent queues: each producer pushes N elements,
+// consumers pop them, throughput is reported for several thread counts.
+// Usage: queue_benchmark [element count per producer]
+
+// Common project headers
+#include <siodb/common/utils/ConcurrentQueue.h>
+#include <siodb/common/utils/MpmcQueue.h>
+
+// CRT headers
+#include <cstdlib>
+
+// STL headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/** Ring buffer capacity of the bounded queue */
+constexpr std::size_t kMpmcQueueCapacity = 1024;
+
+/** Default number of elements pushed by each producer */
+constexpr std::uint64_t kDefaultElementCount = 1000000;
+
+/**
+ * Runs producers and consumers on the queue.
+ * @param queue A queue.
+ * @param threadCount Number of producers, same as number of consumers.
+ * @param elementCount Number of elements pushed by each producer.
+ * @return Elapsed time in seconds.
+ */
+template<class Queue>
+double runBenchmark(Queue& queue, std::size_t threadCount, std::uint64_t elementCount)
+{
+    std::atomic<std::uint64_t> checksum(0);
+    const auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&queue, elementCount] {
+            for (std::uint64_t value = 1; value <= elementCount; ++value)
+                queue.push(value);
+        });
+        threads.emplace_back([&queue, &checksum, elementCount] {
+            std::uint64_t sum = 0;
+            for (std::uint64_t j = 0; j < elementCount; ++j)
+                sum += queue.pop();
+            checksum += sum;
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto elapsedTime = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime)
+                                     .count();
+    if (checksum != threadCount * elementCount * (elementCount + 1) / 2) {
+        std::cerr << "Checksum mismatch" << std::endl;
+        std::exit(1);
+    }
+    return elapsedTime;
+}
+
+/**
+ * Prints benchmark result.
+ * @param queueName Queue name.
+ * @param threadCount Number of producers.
+ * @param elementCount Number of elements pushed by each producer.
+ * @param elapsedTime Elapsed time in seconds.
+ */
+void printResult(const char* queueName, std::size_t threadCount, std::uint64_t elementCount,
+        double elapsedTime)
+{
+    const auto totalCount = static_cast<double>(threadCount * elementCount);
+    std::cout << std::left << std::setw(16) << queueName << std::right << std::setw(4)
+              << threadCount << " x " << std::setw(4) << threadCount << std::setw(12)
+              << std::fixed << std::setprecision(3) << elapsedTime << " s" << std::setw(12)
+              << std::setprecision(2) << totalCount / elapsedTime / 1e6 << " Mops/s"
+              << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const std::uint64_t elementCount =
+            argc > 1 ? std::strtoull(argv[1], nullptr, 10) : kDefaultElementCount;
+    if (elementCount == 0) {
+        std::cerr << "Usage: " << argv[0] << " [element count per producer]" << std::endl;
+        return 1;
+    }
+
+    const auto maxThreadCount = std::max(std::thread::hardware_concurrency() / 2, 1U);
+    std::cout << "Queue           prod x cons        time    throughput" << std::endl;
+    for (std::size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2) {
+        {
+            siodb::utils::ConcurrentQueue<std::uint64_t> queue;
+            printResult("ConcurrentQueue", threadCount, elementCount,
+                    runBenchmark(queue, threadCount, elementCount));
+        }
+        {
+            siodb::utils::MpmcQueue<std::uint64_t> queue(kMpmcQueueCapacity);
+            printResult("MpmcQueue", threadCount, elementCount,
+                    runBenchmark(queue, threadCount, elementCount));
+        }
+    }
+    return 0;
+}
@@ -6,6 +6,7 @@
 
 // Project headers
 #include "ConnWorkerConnectionHandler.h"
+#include "PooledConnWorker.h"
 
 // Common project headers
 #include <siodb/common/config/SiodbVersion.h>
@@ -34,6 +35,7 @@
 namespace {
 
 std::unique_ptr<siodb::conn_worker::ConnWorkerConnectionHandler> g_connectionHandler;
+std::unique_ptr<siodb::conn_worker::PooledConnWorker> g_pooledWorker;
 
 int run(int argc, char** argv);
 
@@ -56,6 +58,7 @@ int run(int argc, char** argv)
     auto instanceOptions = std::make_shared<siodb::config::InstanceOptions>();
     std::string instanceName;
     siodb::FileDescriptorGuard client;
+    siodb::FileDescriptorGuard workerChannel;
     bool adminMode = false;
 
     // Parse and validate command-line options
@@ -69,6 +72,8 @@ int run(int argc, char** argv)
                 "Instance name");
         desc.add_options()("client-fd", boost::program_options::value<int>()->default_value(-1),
                 "Client file descriptor number");
+        desc.add_options()("worker-fd", boost::program_options::value<int>()->default_value(-1),
+                "Connection manager channel file descriptor number, for pre-started worker");
         desc.add_options()("help,h", "Produce help message");
 
         boost::program_options::variables_map vm;
@@ -96,10 +101,16 @@ int run(int argc, char** argv)
         }
         instanceOptions->m_generalOptions.m_executablePath = executableFullPath.data();
 
-        const auto fd = vm["client-fd"].as<int>();
-        if (fd < 3) throw std::runtime_error("Invalid client file descriptor");
-
-        client.reset(fd);
+        // Pre-started worker receives clients from the connection manager
+        const auto workerFd = vm["worker-fd"].as<int>();
+        if (workerFd >= 0) {
+            if (workerFd < 3) throw std::runtime_error("Invalid channel file descriptor");
+            workerChannel.reset(workerFd);
+        } else {
+            const auto fd = vm["client-fd"].as<int>();
+            if (fd < 3) throw std::runtime_error("Invalid client file descriptor");
+            client.reset(fd);
+        }
 
         adminMode = vm.count("admin") > 0;
     } catch (std::exception& ex) {
@@ -126,9 +137,18 @@ int run(int argc, char** argv)
                  << " Siodb GmbH. All rights reserved.";
 
         try {
-            g_connectionHandler = std::make_unique<siodb::conn_worker::ConnWorkerConnectionHandler>(
-                    std::move(client), instanceOptions, adminMode);
-            g_connectionHandler->run();
+            if (workerChannel.isValidFd()) {
+                g_pooledWorker = std::make_unique<siodb::conn_worker::PooledConnWorker>(
+                        std::move(workerChannel), instanceOptions, adminMode);
+                g_pooledWorker->run();
+                g_pooledWorker.reset();
+            } else {
+                siodb::conn_worker::IOMgrConnection ioMgrConnection(instanceOptions);
+                g_connectionHandler =
+                        std::make_unique<siodb::conn_worker::ConnWorkerConnectionHandler>(
+                                std::move(client), ioMgrConnection, instanceOptions, adminMode);
+                g_connectionHandler->run();
+            }
         } catch (std::exception& ex) {
             LOG_ERROR << "Error: " << ex.what() << '.' << std::endl;
             return 2;
@@ -144,6 +164,10 @@ void terminationSignalHandler([[maybe_unused]] int signal)
         g_connectionHandler->closeConnection();
         DEBUG_TRACE("ConnWorker: Closed connection.");
     }
+    if (g_pooledWorker) {
+        g_pooledWorker->stop();
+        DEBUG_TRACE("ConnWorker: Stopped pooled worker.");
+    }
 }
 
 }  // anonymous namespace
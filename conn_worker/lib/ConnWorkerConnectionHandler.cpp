@@ -10,7 +10,6 @@
 #include <siodb/common/log/Log.h>
 #include <siodb/common/net/ConnectionError.h>
 #include <siodb/common/net/EpollHelpers.h>
-#include <siodb/common/net/TcpConnection.h>
 #include <siodb/common/protobuf/ProtobufMessageIO.h>
 #include <siodb/common/protobuf/SiodbProtocolTag.h>
 #include <siodb/common/utils/ErrorCodeChecker.h>
@@ -50,14 +49,17 @@ std::string createChallenge()
 }  // namespace
 
 ConnWorkerConnectionHandler::ConnWorkerConnectionHandler(FileDescriptorGuard&& client,
-        const config::ConstInstaceOptionsPtr& instanceOptions, bool adminMode)
+        IOMgrConnection& ioMgrConnection, const config::ConstInstaceOptionsPtr& instanceOptions,
+        bool adminMode, const std::shared_ptr<crypto::TlsServer>& tlsServer)
     : m_dbOptions(instanceOptions)
     , m_adminMode(adminMode)
+    , m_ioMgrConnection(ioMgrConnection)
+    , m_tlsServer(tlsServer)
 {
     m_clientEpollFd.reset(net::createEpollFd(client.getFd(), EPOLLIN));
     if (!m_adminMode && m_dbOptions->m_clientOptions.m_enableEncryption) {
         LOG_DEBUG << kLogContext << "Established secure connection with client";
-        m_tlsServer = createTlsServer(m_dbOptions->m_clientOptions);
+        if (!m_tlsServer) m_tlsServer = createTlsServer(m_dbOptions->m_clientOptions);
         m_clientIo = std::move(m_tlsServer->acceptConnection(client.release(), true));
     } else {
         LOG_DEBUG << kLogContext << " established non-secure connection with client";
@@ -66,15 +68,7 @@ ConnWorkerConnectionHandler::ConnWorkerConnectionHandler(FileDescriptorGuard&& c
 
     if (!m_clientIo->isValid()) throw std::invalid_argument("Invalid client communication channel");
 
-    int port = m_dbOptions->m_ioManagerOptions.m_ipv4port != 0
-                       ? m_dbOptions->m_ioManagerOptions.m_ipv4port
-                       : m_dbOptions->m_ioManagerOptions.m_ipv6port;
-
-    FileDescriptorGuard fdGuard(net::openTcpConnection("localhost", port, true));
-    auto iomgrIo = std::make_unique<io::FdIo>(fdGuard.getFd(), false);
-    fdGuard.release();
-    iomgrIo->setAutoClose(true);
-    m_ioMgrIo = std::move(iomgrIo);
+    m_ioMgrIo = m_ioMgrConnection.openSession();
 }
 
 void ConnWorkerConnectionHandler::run()
@@ -120,6 +114,10 @@ void ConnWorkerConnectionHandler::run()
                     iomgr_protocol::DatabaseEngineRequest dbeRequest;
                     dbeRequest.set_text(command.text());
                     dbeRequest.set_request_id(command.request_id());
+                    dbeRequest.set_prepare(command.prepare());
+                    dbeRequest.set_statement_id(command.statement_id());
+                    dbeRequest.mutable_parameter()->CopyFrom(command.parameter());
+                    dbeRequest.set_close_statement(command.close_statement());
 
                     // Connect to server
                     protobuf::writeMessage(protobuf::ProtocolMessageType::kDatabaseEngineRequest,
@@ -127,16 +125,7 @@ void ConnWorkerConnectionHandler::run()
                 } catch (const SiodbProtocolError& ex) {
                     LOG_ERROR << kLogContext << ex.what();
                     m_ioMgrIo->close();
-
-                    int port = m_dbOptions->m_ioManagerOptions.m_ipv4port != 0
-                                       ? m_dbOptions->m_ioManagerOptions.m_ipv4port
-                                       : m_dbOptions->m_ioManagerOptions.m_ipv6port;
-
-                    FileDescriptorGuard fdGuard(net::openTcpConnection("localhost", port, true));
-                    auto iomgrIo = std::make_unique<io::FdIo>(fdGuard.getFd(), false);
-                    fdGuard.release();
-                    iomgrIo->setAutoClose(true);
-                    m_ioMgrIo = std::move(iomgrIo);
+                    m_ioMgrIo = m_ioMgrConnection.openSession();
 
                     ioMgrInputStream = std::make_unique<protobuf::CustomProtobufInputStream>(
                             *m_ioMgrIo, errorCodeChecker);
@@ -171,6 +160,8 @@ void ConnWorkerConnectionHandler::run()
                             dbeResponse.mutable_freetext_message());
                     response.set_affected_row_count(dbeResponse.affected_row_count());
                     response.set_has_affected_row_count(dbeResponse.has_affected_row_count());
+                    response.set_statement_id(dbeResponse.statement_id());
+                    response.set_parameter_count(dbeResponse.parameter_count());
 
                     // Send response
                     protobuf::writeMessage(
@@ -412,10 +403,10 @@ void ConnWorkerConnectionHandler::authenticateUser(
     }
 }
 
-std::unique_ptr<siodb::crypto::TlsServer> ConnWorkerConnectionHandler::createTlsServer(
-        const config::ClientOptions& clientOptions) const
+std::shared_ptr<crypto::TlsServer> ConnWorkerConnectionHandler::createTlsServer(
+        const config::ClientOptions& clientOptions)
 {
-    auto tlsServer = std::make_unique<siodb::crypto::TlsServer>();
+    auto tlsServer = std::make_shared<crypto::TlsServer>();
 
     if (!clientOptions.m_tlsCertificateChain.empty())
         tlsServer->useCertificateChain(clientOptions.m_tlsCertificateChain.c_str());
@@ -4,6 +4,9 @@
 
 #pragma once
 
+// Project headers
+#include "IOMgrConnection.h"
+
 // Common project headers
 #include <siodb/common/crypto/TlsConnection.h>
 #include <siodb/common/crypto/TlsServer.h>
@@ -26,11 +29,15 @@ public:
     /**
      * Initializes object of class AdminConnWorkerConnectionHandler.
      * @param client Client file descriptor.
+     * @param ioMgrConnection Connection to the IO manager, client uses its own session.
      * @param instanceOptions Database instance options.
      * @param adminMode Database administrator mode.
+     * @param tlsServer TLS server shared between connections, if nullptr and encryption
+     *                  is required, new one is created.
      */
-    ConnWorkerConnectionHandler(FileDescriptorGuard&& client,
-            const config::ConstInstaceOptionsPtr& instanceOptions, bool adminMode);
+    ConnWorkerConnectionHandler(FileDescriptorGuard&& client, IOMgrConnection& ioMgrConnection,
+            const config::ConstInstaceOptionsPtr& instanceOptions, bool adminMode,
+            const std::shared_ptr<crypto::TlsServer>& tlsServer = nullptr);
 
     DECLARE_NONCOPYABLE(ConnWorkerConnectionHandler);
 
@@ -40,6 +47,14 @@ public:
     /** Forcibly closes connection */
     void closeConnection();
 
+    /**
+     * Creates TLS server.
+     * @param clientOptions Client options.
+     * @return TLS server.
+     */
+    static std::shared_ptr<crypto::TlsServer> createTlsServer(
+            const config::ClientOptions& clientOptions);
+
 private:
     /**
      * Response to client with error code
@@ -89,14 +104,6 @@ private:
      */
     void authenticateUser(protobuf::CustomProtobufInputStream& ioMgrInputStream);
 
-    /**
-     * Creates TLS server.
-     * @param clientOptions Client options.
-     * @return TLS server.
-     */
-    std::unique_ptr<siodb::crypto::TlsServer> createTlsServer(
-            const config::ClientOptions& clientOptions) const;
-
 private:
     /** Database options */
     const config::ConstInstaceOptionsPtr m_dbOptions;
@@ -107,11 +114,14 @@ private:
     /** IO for connection with Siodb client */
     std::unique_ptr<io::IoBase> m_clientIo;
 
-    /** IO for connection with IO manager */
+    /** Connection to the IO manager */
+    IOMgrConnection& m_ioMgrConnection;
+
+    /** IO of the session with IO manager */
     std::unique_ptr<io::IoBase> m_ioMgrIo;
 
     /** TLS server for handling secure connnection */
-    std::unique_ptr<crypto::TlsServer> m_tlsServer;
+    std::shared_ptr<crypto::TlsServer> m_tlsServer;
 
     /** Last used database */
     std::string m_lastUsedDatabase;
@@ -0,0 +1,70 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "IOMgrConnection.h"
+
+// Common project headers
+#include <siodb/common/log/Log.h>
+#include <siodb/common/net/MultiplexedSessionIo.h>
+#include <siodb/common/net/TcpConnection.h>
+
+// System headers
+#include <signal.h>
+
+namespace siodb::conn_worker {
+
+IOMgrConnection::IOMgrConnection(const config::ConstInstaceOptionsPtr& instanceOptions)
+    : m_dbOptions(instanceOptions)
+{
+}
+
+IOMgrConnection::~IOMgrConnection()
+{
+    if (m_connection) m_connection->close();
+    if (m_receiverThread.joinable()) m_receiverThread.join();
+}
+
+std::unique_ptr<io::IoBase> IOMgrConnection::openSession()
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_connection || !m_connection->isConnected()) {
+        // Sessions of the lost connection are already closed
+        if (m_receiverThread.joinable()) {
+            m_connection->close();
+            m_receiverThread.join();
+        }
+        m_connection.reset();
+
+        const int port = m_dbOptions->m_ioManagerOptions.m_ipv4port != 0
+                                 ? m_dbOptions->m_ioManagerOptions.m_ipv4port
+                                 : m_dbOptions->m_ioManagerOptions.m_ipv6port;
+        auto connection = std::make_shared<net::MultiplexedConnection>(
+                FileDescriptorGuard(net::openTcpConnection("localhost", port, true)));
+        m_receiverThread = std::thread(&IOMgrConnection::receiverThreadMain, connection);
+        m_connection = std::move(connection);
+        LOG_INFO << kLogContext << "Connected to IO manager.";
+    }
+    return m_connection->openSession();
+}
+
+void IOMgrConnection::receiverThreadMain(std::shared_ptr<net::MultiplexedConnection> connection)
+{
+    // Termination signals must interrupt client threads, not this one
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGHUP);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    ::pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    try {
+        while (connection->receive()) {
+        }
+        LOG_INFO << kLogContext << "Connection to IO manager closed.";
+    } catch (std::exception& ex) {
+        LOG_ERROR << kLogContext << "Connection to IO manager failed: " << ex.what() << '.';
+    }
+}
+
+}  // namespace siodb::conn_worker
@@ -0,0 +1,69 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Common project headers
+#include <siodb/common/io/IoBase.h>
+#include <siodb/common/net/MultiplexedConnection.h>
+#include <siodb/common/options/InstanceOptions.h>
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <mutex>
+#include <thread>
+
+namespace siodb::conn_worker {
+
+/**
+ * Persistent multiplexed connection to the IO manager, shared by all clients
+ * of the connection worker. Each client uses its own session of the connection.
+ * Connection is established on first use and re-established after it is lost.
+ */
+class IOMgrConnection {
+public:
+    /**
+     * Initializes object of class IOMgrConnection.
+     * @param instanceOptions Database instance options.
+     */
+    explicit IOMgrConnection(const config::ConstInstaceOptionsPtr& instanceOptions);
+
+    /** De-initializes object of class IOMgrConnection. */
+    ~IOMgrConnection();
+
+    DECLARE_NONCOPYABLE(IOMgrConnection);
+
+    /**
+     * Opens new session to the IO manager.
+     * @return Session IO.
+     * @throw std::system_error if connection can't be established.
+     * @throw ConnectionError if connection is lost while opening session.
+     */
+    std::unique_ptr<io::IoBase> openSession();
+
+private:
+    /**
+     * Receiver thread entry point, dispatches incoming data to the sessions.
+     * @param connection Connection.
+     */
+    static void receiverThreadMain(std::shared_ptr<net::MultiplexedConnection> connection);
+
+private:
+    /** Database options */
+    const config::ConstInstaceOptionsPtr m_dbOptions;
+
+    /** Connection access synchronization object */
+    std::mutex m_mutex;
+
+    /** Current connection */
+    std::shared_ptr<net::MultiplexedConnection> m_connection;
+
+    /** Receiver thread of the current connection */
+    std::thread m_receiverThread;
+
+    /** Log context name */
+    static constexpr const char* kLogContext = "IOMgrConnection: ";
+};
+
+}  // namespace siodb::conn_worker
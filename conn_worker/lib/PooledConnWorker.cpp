@@ -0,0 +1,174 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "PooledConnWorker.h"
+
+// Project headers
+#include "ConnWorkerConnectionHandler.h"
+
+// Common project headers
+#include <siodb/common/log/Log.h>
+#include <siodb/common/net/FileDescriptorPassing.h>
+#include <siodb/common/utils/SignalHandlers.h>
+
+// System headers
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+
+namespace siodb::conn_worker {
+
+namespace {
+
+/**
+ * Notifies connection manager that client is disconnected.
+ * @param channelFd Channel file descriptor.
+ */
+void notifyClientFinished(int channelFd) noexcept
+{
+    // Channel may be already closed by the connection manager, this is not an error
+    const char data = 0;
+    ::send(channelFd, &data, sizeof(data), MSG_NOSIGNAL);
+}
+
+}  // namespace
+
+PooledConnWorker::PooledConnWorker(FileDescriptorGuard&& channel,
+        const config::ConstInstaceOptionsPtr& instanceOptions, bool adminMode)
+    : m_channel(std::move(channel))
+    , m_dbOptions(instanceOptions)
+    , m_adminMode(adminMode)
+    , m_tlsServer(!m_adminMode && m_dbOptions->m_clientOptions.m_enableEncryption
+                          ? ConnWorkerConnectionHandler::createTlsServer(
+                                  m_dbOptions->m_clientOptions)
+                          : nullptr)
+    , m_ioMgrConnection(instanceOptions)
+    , m_lastClientId(0)
+{
+}
+
+PooledConnWorker::~PooledConnWorker()
+{
+    shutdownClients();
+    waitForClients();
+}
+
+void PooledConnWorker::run()
+{
+    LOG_INFO << kLogContext << "Waiting for client connections.";
+    while (true) {
+        FileDescriptorGuard client;
+        try {
+            client.reset(net::receiveFileDescriptor(m_channel.getFd()));
+        } catch (std::system_error& ex) {
+            if (ex.code().value() == EINTR && !utils::isExitEventSignaled()) continue;
+            if (!utils::isExitEventSignaled()) LOG_ERROR << kLogContext << ex.what() << '.';
+            break;
+        }
+
+        if (!client.isValidFd()) {
+            LOG_INFO << kLogContext << "Connection manager closed channel.";
+            break;
+        }
+
+        removeFinishedClients();
+
+        FileDescriptorGuard socket(::fcntl(client.getFd(), F_DUPFD_CLOEXEC, 0));
+        if (!socket.isValidFd()) {
+            const int errorCode = errno;
+            LOG_ERROR << kLogContext
+                      << "Can't duplicate client socket: " << std::strerror(errorCode) << '.';
+            client.reset();
+            notifyClientFinished(m_channel.getFd());
+            continue;
+        }
+
+        std::lock_guard lock(m_mutex);
+        const auto clientId = ++m_lastClientId;
+        auto& clientInfo = m_clients[clientId];
+        clientInfo.m_socket = std::move(socket);
+        try {
+            // Thread accesses client information only after this lock is released
+            clientInfo.m_thread = std::thread(
+                    &PooledConnWorker::clientThreadMain, this, clientId, std::move(client));
+        } catch (std::exception& ex) {
+            LOG_ERROR << kLogContext << "Can't start client thread: " << ex.what() << '.';
+            m_clients.erase(clientId);
+            notifyClientFinished(m_channel.getFd());
+            continue;
+        }
+        LOG_INFO << kLogContext << "Accepted client #" << clientId << ", " << m_clients.size()
+                 << " clients active.";
+    }
+
+    // Remaining clients are served until they disconnect, unless exit is requested
+    if (utils::isExitEventSignaled()) shutdownClients();
+    waitForClients();
+}
+
+void PooledConnWorker::stop() noexcept
+{
+    ::shutdown(m_channel.getFd(), SHUT_RDWR);
+}
+
+void PooledConnWorker::clientThreadMain(std::uint64_t clientId, FileDescriptorGuard client)
+{
+    try {
+        ConnWorkerConnectionHandler handler(
+                std::move(client), m_ioMgrConnection, m_dbOptions, m_adminMode, m_tlsServer);
+        handler.run();
+    } catch (std::exception& ex) {
+        LOG_ERROR << kLogContext << "Client #" << clientId << ": " << ex.what() << '.';
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        auto& clientInfo = m_clients.at(clientId);
+        clientInfo.m_socket.reset();
+        clientInfo.m_finished = true;
+    }
+    LOG_INFO << kLogContext << "Client #" << clientId << " disconnected.";
+    notifyClientFinished(m_channel.getFd());
+}
+
+void PooledConnWorker::removeFinishedClients()
+{
+    std::lock_guard lock(m_mutex);
+    for (auto it = m_clients.begin(); it != m_clients.end();) {
+        if (it->second.m_finished) {
+            it->second.m_thread.join();
+            it = m_clients.erase(it);
+        } else
+            ++it;
+    }
+}
+
+void PooledConnWorker::shutdownClients()
+{
+    std::lock_guard lock(m_mutex);
+    for (auto& client : m_clients) {
+        if (client.second.m_finished) continue;
+        // Wake up client thread both from client and IO manager I/O
+        ::shutdown(client.second.m_socket.getFd(), SHUT_RDWR);
+        ::pthread_kill(client.second.m_thread.native_handle(), SIGUSR1);
+    }
+}
+
+void PooledConnWorker::waitForClients()
+{
+    // Lock is released while joining, this is safe because only this thread
+    // adds and removes clients
+    std::unique_lock lock(m_mutex);
+    for (auto& client : m_clients) {
+        auto& thread = client.second.m_thread;
+        if (!thread.joinable()) continue;
+        lock.unlock();
+        thread.join();
+        lock.lock();
+    }
+    m_clients.clear();
+}
+
+}  // namespace siodb::conn_worker
@@ -0,0 +1,111 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "IOMgrConnection.h"
+
+// Common project headers
+#include <siodb/common/crypto/TlsServer.h>
+#include <siodb/common/options/InstanceOptions.h>
+#include <siodb/common/utils/FileDescriptorGuard.h>
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace siodb::conn_worker {
+
+/**
+ * Connection worker pre-started by the connection manager. Receives client connections
+ * via UNIX socket channel and handles each of them in a separate thread.
+ * All clients share single connection to the IO manager, each using its own session.
+ * After each client is disconnected, sends one byte notification back to the channel,
+ * so that connection manager knows current worker load. Stops receiving new clients
+ * when connection manager closes channel, and exits when all clients are disconnected.
+ */
+class PooledConnWorker {
+public:
+    /**
+     * Initializes object of class PooledConnWorker.
+     * @param channel Channel to the connection manager.
+     * @param instanceOptions Database instance options.
+     * @param adminMode Database administrator mode.
+     */
+    PooledConnWorker(FileDescriptorGuard&& channel,
+            const config::ConstInstaceOptionsPtr& instanceOptions, bool adminMode);
+
+    /** De-initializes object of class PooledConnWorker. */
+    ~PooledConnWorker();
+
+    DECLARE_NONCOPYABLE(PooledConnWorker);
+
+    /** Receives and handles client connections until channel is closed or exit requested */
+    void run();
+
+    /** Stops receiving client connections. Can be called from a signal handler. */
+    void stop() noexcept;
+
+private:
+    /** Client connection information */
+    struct Client {
+        /** Client handler thread */
+        std::thread m_thread;
+
+        /** Duplicate of the client socket, used to shut down connection */
+        FileDescriptorGuard m_socket;
+
+        /** Indication that client is disconnected */
+        bool m_finished = false;
+    };
+
+    /**
+     * Client handler thread entry point.
+     * @param clientId Client ID.
+     * @param client Client connection file descriptor.
+     */
+    void clientThreadMain(std::uint64_t clientId, FileDescriptorGuard client);
+
+    /** Joins threads of the disconnected clients. */
+    void removeFinishedClients();
+
+    /** Shuts down all client connections. */
+    void shutdownClients();
+
+    /** Waits until all clients are disconnected. */
+    void waitForClients();
+
+private:
+    /** Channel to the connection manager */
+    FileDescriptorGuard m_channel;
+
+    /** Database options */
+    const config::ConstInstaceOptionsPtr m_dbOptions;
+
+    /** Database administrator mode flag */
+    const bool m_adminMode;
+
+    /** TLS server shared between client connections */
+    std::shared_ptr<crypto::TlsServer> m_tlsServer;
+
+    /** Connection to the IO manager shared between client connections */
+    IOMgrConnection m_ioMgrConnection;
+
+    /** Clients access synchronization object */
+    std::mutex m_mutex;
+
+    /** Clients by ID */
+    std::unordered_map<std::uint64_t, Client> m_clients;
+
+    /** Last client ID */
+    std::uint64_t m_lastClientId;
+
+    /** Log context name */
+    static constexpr const char* kLogContext = "PooledConnWorker: ";
+};
+
+}  // namespace siodb::conn_worker
@@ -0,0 +1,461 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "BulkDataExporter.h"
+
+// Project headers
+#include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "Column.h"
+#include "ThrowDatabaseError.h"
+
+// Common project headers
+#include <siodb/common/config/SiodbDefs.h>
+#include <siodb/common/io/FileIO.h>
+#include <siodb/common/utils/Bitmask.h>
+#include <siodb/common/utils/FileDescriptorGuard.h>
+
+// CRT headers
+#include <cstdio>
+#include <cstring>
+
+// STL headers
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <thread>
+
+// Boost headers
+#include <boost/algorithm/hex.hpp>
+#include <boost/endian/conversion.hpp>
+
+// Protobuf headers
+#include <google/protobuf/io/coded_stream.h>
+
+namespace siodb::iomgr::dbengine {
+
+namespace {
+
+/**
+ * Appends varint to the buffer.
+ * @param value A value.
+ * @param[out] buffer Output buffer.
+ */
+void appendVarint(std::uint64_t value, std::string& buffer)
+{
+    std::uint8_t data[10];
+    const auto end =
+            google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(value, data);
+    buffer.append(reinterpret_cast<const char*>(data), end - data);
+}
+
+/**
+ * Appends fixed size little-endian value to the buffer.
+ * @param value A value.
+ * @param[out] buffer Output buffer.
+ */
+template<class T>
+void appendLittleEndian(T value, std::string& buffer)
+{
+    boost::endian::native_to_little_inplace(value);
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Appends integer value as text to the buffer.
+ * @param value A value.
+ * @param[out] buffer Output buffer.
+ */
+template<class T>
+void appendInteger(T value, std::string& buffer)
+{
+    char data[24];
+    const auto result = std::to_chars(data, data + sizeof(data), value);
+    buffer.append(data, result.ptr);
+}
+
+}  // anonymous namespace
+
+BulkDataExporter::BulkDataExporter(const TablePtr& table,
+        const std::vector<std::string>& columnNames, const std::string& filePath,
+        DataFileFormat format, char delimiter, bool header,
+        const TransactionSnapshotPtr& snapshot)
+    : m_table(table)
+    , m_filePath(filePath)
+    , m_format(format)
+    , m_delimiter(delimiter)
+    , m_header(header)
+    , m_snapshot(snapshot)
+    , m_readerThreadCount(std::max(std::thread::hardware_concurrency(), 1U))
+    , m_readFinished(false)
+    , m_stopped(false)
+{
+    if (columnNames.empty()) {
+        m_columns = m_table->getColumnsOrderedByPosition();
+        // TRID is not written by default, so that file can be loaded into the table
+        m_columns.erase(m_columns.begin());
+    } else {
+        m_columns.reserve(columnNames.size());
+        for (const auto& columnName : columnNames)
+            m_columns.push_back(m_table->getColumnChecked(columnName));
+    }
+
+    m_columnPositions.reserve(m_columns.size());
+    for (const auto& column : m_columns)
+        m_columnPositions.push_back(column->getCurrentPosition());
+}
+
+std::uint64_t BulkDataExporter::unload()
+{
+    // Existing file is never overwritten
+    FileDescriptorGuard fd(::open(m_filePath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+            kDataFileCreationMode));
+    if (!fd.isValidFd()) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotCreateCopyFile, m_filePath, errorCode,
+                std::strerror(errorCode));
+    }
+
+    std::thread writerThread(&BulkDataExporter::writeFile, this, fd.getFd());
+    std::uint64_t rowCount = 0;
+    try {
+        // Rows are walked in the index order, missing TRIDs are never probed.
+        // Uncommitted changes of the concurrent transactions are not exported.
+        TableDataSet dataSet(m_table, std::string());
+        dataSet.setSnapshot(m_snapshot);
+        dataSet.resetCursor();
+        std::vector<MasterColumnRecord> mcrs;
+        for (bool hasMoreRows = dataSet.hasCurrentRow(); hasMoreRows;) {
+            hasMoreRows = readMasterColumnRecords(dataSet, mcrs);
+            if (mcrs.empty()) continue;
+            auto batch = readColumnValues(mcrs);
+            std::unique_lock lock(m_mutex);
+            m_cond.wait(
+                    lock, [this] { return m_stopped || m_batches.size() < kMaxPendingBatchCount; });
+            if (m_stopped) break;
+            m_batches.push_back(std::move(batch));
+            m_cond.notify_all();
+            rowCount += mcrs.size();
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_readFinished = true;
+        m_cond.notify_all();
+    } catch (...) {
+        stop(std::current_exception());
+    }
+    writerThread.join();
+
+    if (m_error) {
+        // Incomplete file is useless
+        ::unlink(m_filePath.c_str());
+        std::rethrow_exception(m_error);
+    }
+    return rowCount;
+}
+
+// ----- internals -----
+
+bool BulkDataExporter::readMasterColumnRecords(
+        TableDataSet& dataSet, std::vector<MasterColumnRecord>& mcrs)
+{
+    mcrs.clear();
+    while (mcrs.size() < kBatchRowCount) {
+        mcrs.push_back(dataSet.getCurrentMcr());
+        if (!dataSet.moveToNextRow()) return false;
+    }
+    return true;
+}
+
+BulkDataExporter::ColumnValues BulkDataExporter::readColumnValues(
+        const std::vector<MasterColumnRecord>& mcrs) const
+{
+    // Columns are stored separately, so they can be read concurrently
+    const auto columnCount = m_columns.size();
+    ColumnValues batch(columnCount);
+    std::vector<std::exception_ptr> columnErrors(columnCount);
+    std::atomic<std::size_t> nextColumnIndex(0);
+    std::atomic<bool> failed(false);
+    const auto readColumns = [&]() noexcept {
+        while (!failed) {
+            const auto i = nextColumnIndex++;
+            if (i >= columnCount) break;
+            try {
+                auto& values = batch[i];
+                values.resize(mcrs.size());
+                const auto& column = m_columns[i];
+                const auto position = m_columnPositions[i];
+                if (position == 0) {
+                    for (std::size_t rowIndex = 0; rowIndex < mcrs.size(); ++rowIndex)
+                        values[rowIndex] = mcrs[rowIndex].getTableRowId();
+                    continue;
+                }
+
+                // Updated rows point to later blocks, so records are read in the address
+                // order to read each column block once and sequentially
+                std::vector<std::pair<ColumnDataAddress, std::size_t>> addresses;
+                addresses.reserve(mcrs.size());
+                for (std::size_t rowIndex = 0; rowIndex < mcrs.size(); ++rowIndex) {
+                    addresses.emplace_back(
+                            mcrs[rowIndex].getColumnRecords().at(position - 1).getAddress(),
+                            rowIndex);
+                }
+                std::sort(addresses.begin(), addresses.end(), [](const auto& a, const auto& b) {
+                    return std::make_pair(a.first.getBlockId(), a.first.getOffset())
+                           < std::make_pair(b.first.getBlockId(), b.first.getOffset());
+                });
+
+                for (const auto& [address, rowIndex] : addresses) {
+                    auto& value = values[rowIndex];
+                    column->readRecord(address, value, false);
+                    // LOB streams are read here, so that writer thread doesn't access columns
+                    if (value.isClob())
+                        value = *value.asString();
+                    else if (value.isBlob())
+                        value = *value.asBinary();
+                }
+            } catch (...) {
+                columnErrors[i] = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    // Calling thread is one of the reader threads
+    const auto threadCount = std::min(m_readerThreadCount, columnCount);
+    std::vector<std::thread> readerThreads;
+    try {
+        while (readerThreads.size() + 1 < threadCount)
+            readerThreads.emplace_back(readColumns);
+    } catch (...) {
+        // Remaining columns are read by the already started threads
+    }
+    readColumns();
+    for (auto& thread : readerThreads)
+        thread.join();
+
+    for (const auto& error : columnErrors) {
+        if (error) std::rethrow_exception(error);
+    }
+    return batch;
+}
+
+void BulkDataExporter::writeFile(int fd) noexcept
+{
+    try {
+        std::string buffer;
+        encodeHeader(buffer);
+        if (!buffer.empty()) writeData(fd, buffer);
+
+        ColumnValues batch;
+        while (true) {
+            {
+                std::unique_lock lock(m_mutex);
+                m_cond.wait(lock,
+                        [this] { return m_stopped || m_readFinished || !m_batches.empty(); });
+                if (m_stopped || m_batches.empty()) return;
+                batch = std::move(m_batches.front());
+                m_batches.pop_front();
+                m_cond.notify_all();
+            }
+
+            buffer.clear();
+            if (m_format == DataFileFormat::kCsv)
+                encodeCsvBatch(batch, buffer);
+            else
+                encodeBinaryBatch(batch, buffer);
+            writeData(fd, buffer);
+        }
+    } catch (...) {
+        stop(std::current_exception());
+    }
+}
+
+void BulkDataExporter::writeData(int fd, const std::string& data) const
+{
+    if (::writeExact(fd, data.data(), data.size(), kIgnoreSignals) != data.size()) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteCopyFile, m_filePath, errorCode,
+                std::strerror(errorCode));
+    }
+}
+
+void BulkDataExporter::encodeHeader(std::string& buffer) const
+{
+    if (m_format == DataFileFormat::kCsv) {
+        if (!m_header) return;
+        for (std::size_t i = 0; i < m_columns.size(); ++i) {
+            if (i > 0) buffer.push_back(m_delimiter);
+            appendCsvField(m_columns[i]->getName(), buffer);
+        }
+        buffer.push_back('\n');
+        return;
+    }
+
+    buffer.append(kBinaryDataFileSignature, sizeof(kBinaryDataFileSignature));
+    appendVarint(kBinaryDataFileVersion, buffer);
+    appendVarint(m_columns.size(), buffer);
+    for (const auto& column : m_columns)
+        appendVarint(static_cast<std::uint32_t>(column->getDataType()), buffer);
+}
+
+void BulkDataExporter::encodeCsvBatch(const ColumnValues& batch, std::string& buffer) const
+{
+    const auto rowCount = batch.front().size();
+    std::string text;
+    for (std::size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex) {
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+            if (i > 0) buffer.push_back(m_delimiter);
+            const auto& value = batch[i][rowIndex];
+            switch (value.getValueType()) {
+                // NULL is empty unquoted field
+                case VariantType::kNull: break;
+                case VariantType::kBool: buffer.append(value.getBool() ? "true" : "false"); break;
+                case VariantType::kInt8: appendInteger(value.getInt8(), buffer); break;
+                case VariantType::kUInt8: appendInteger(value.getUInt8(), buffer); break;
+                case VariantType::kInt16: appendInteger(value.getInt16(), buffer); break;
+                case VariantType::kUInt16: appendInteger(value.getUInt16(), buffer); break;
+                case VariantType::kInt32: appendInteger(value.getInt32(), buffer); break;
+                case VariantType::kUInt32: appendInteger(value.getUInt32(), buffer); break;
+                case VariantType::kInt64: appendInteger(value.getInt64(), buffer); break;
+                case VariantType::kUInt64: appendInteger(value.getUInt64(), buffer); break;
+                case VariantType::kFloat:
+                case VariantType::kDouble: {
+                    // Enough digits to read back exactly the same value
+                    char data[32];
+                    const auto n = value.getValueType() == VariantType::kFloat
+                                           ? std::snprintf(data, sizeof(data), "%.9g",
+                                                   static_cast<double>(value.getFloat()))
+                                           : std::snprintf(
+                                                   data, sizeof(data), "%.17g", value.getDouble());
+                    buffer.append(data, n);
+                    break;
+                }
+                case VariantType::kDateTime: {
+                    appendCsvField(*value.asString(), buffer);
+                    break;
+                }
+                case VariantType::kString: {
+                    appendCsvField(value.getString(), buffer);
+                    break;
+                }
+                case VariantType::kBinary: {
+                    const auto& binary = value.getBinary();
+                    text.clear();
+                    boost::algorithm::hex(binary.cbegin(), binary.cend(), std::back_inserter(text));
+                    buffer.append(text);
+                    break;
+                }
+                default: {
+                    throwDatabaseError(IOManagerMessageId::kErrorInvalidValueType,
+                            static_cast<int>(value.getValueType()));
+                }
+            }
+        }
+        buffer.push_back('\n');
+    }
+}
+
+void BulkDataExporter::encodeBinaryBatch(const ColumnValues& batch, std::string& buffer) const
+{
+    const auto rowCount = batch.front().size();
+    const auto columnCount = batch.size();
+    utils::Bitmask nullMask(columnCount, false);
+    std::string row;
+    for (std::size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex) {
+        row.clear();
+        for (std::size_t i = 0; i < columnCount; ++i)
+            nullMask.setBit(i, batch[i][rowIndex].isNull());
+        row.append(reinterpret_cast<const char*>(nullMask.getData()), nullMask.getByteSize());
+
+        // Values are encoded in the same way as in the query result
+        for (std::size_t i = 0; i < columnCount; ++i) {
+            const auto& value = batch[i][rowIndex];
+            switch (value.getValueType()) {
+                case VariantType::kNull: break;
+                case VariantType::kBool: row.push_back(value.getBool() ? 1 : 0); break;
+                case VariantType::kInt8: row.push_back(value.getInt8()); break;
+                case VariantType::kUInt8: row.push_back(value.getUInt8()); break;
+                case VariantType::kInt16: appendLittleEndian(value.getInt16(), row); break;
+                case VariantType::kUInt16: appendLittleEndian(value.getUInt16(), row); break;
+                case VariantType::kInt32: {
+                    appendVarint(static_cast<std::uint32_t>(value.getInt32()), row);
+                    break;
+                }
+                case VariantType::kUInt32: appendVarint(value.getUInt32(), row); break;
+                case VariantType::kInt64: {
+                    appendVarint(static_cast<std::uint64_t>(value.getInt64()), row);
+                    break;
+                }
+                case VariantType::kUInt64: appendVarint(value.getUInt64(), row); break;
+                case VariantType::kFloat: {
+                    std::uint32_t v = 0;
+                    const auto f = value.getFloat();
+                    std::memcpy(&v, &f, sizeof(v));
+                    appendLittleEndian(v, row);
+                    break;
+                }
+                case VariantType::kDouble: {
+                    std::uint64_t v = 0;
+                    const auto d = value.getDouble();
+                    std::memcpy(&v, &d, sizeof(v));
+                    appendLittleEndian(v, row);
+                    break;
+                }
+                case VariantType::kDateTime: {
+                    std::uint8_t data[RawDateTime::kMaxSerializedSize];
+                    const auto end = value.getDateTime().serialize(data);
+                    row.append(reinterpret_cast<const char*>(data), end - data);
+                    break;
+                }
+                case VariantType::kString: {
+                    const auto& s = value.getString();
+                    appendVarint(s.size(), row);
+                    row.append(s);
+                    break;
+                }
+                case VariantType::kBinary: {
+                    const auto& binary = value.getBinary();
+                    appendVarint(binary.size(), row);
+                    row.append(reinterpret_cast<const char*>(binary.data()), binary.size());
+                    break;
+                }
+                default: {
+                    throwDatabaseError(IOManagerMessageId::kErrorInvalidValueType,
+                            static_cast<int>(value.getValueType()));
+                }
+            }
+        }
+
+        appendVarint(row.size(), buffer);
+        buffer.append(row);
+    }
+}
+
+void BulkDataExporter::appendCsvField(const std::string& text, std::string& buffer) const
+{
+    // Empty field is quoted, since empty unquoted field is NULL
+    const auto mustQuote = text.empty()
+                           || text.find_first_of(std::string {m_delimiter, '"', '\r', '\n'})
+                                      != std::string::npos;
+    if (!mustQuote) {
+        buffer.append(text);
+        return;
+    }
+    buffer.push_back('"');
+    for (const auto c : text) {
+        if (c == '"') buffer.push_back('"');
+        buffer.push_back(c);
+    }
+    buffer.push_back('"');
+}
+
+void BulkDataExporter::stop(std::exception_ptr error)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_error) m_error = std::move(error);
+    m_stopped = true;
+    m_cond.notify_all();
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,177 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "DataFileFormat.h"
+#include "MasterColumnRecord.h"
+#include "Table.h"
+#include "TableDataSet.h"
+#include "TransactionSnapshotPtr.h"
+
+// STL headers
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Writes rows of a table into the data file on the server. Calling thread walks rows
+ * visible to the snapshot in batches and reads values of the batch column by column, reading columns
+ * concurrently. Writer thread encodes batches and writes them to the file, so that reading
+ * of the next batch overlaps with writing of the previous one. Binary files are written in the format
+ * accepted by BulkDataLoader.
+ */
+class BulkDataExporter final {
+public:
+    /**
+     * Initializes object of class BulkDataExporter.
+     * @param table Source table.
+     * @param columnNames Column names. If empty, all columns except TRID are written
+     *                    in the order they are in the table.
+     * @param filePath Data file path.
+     * @param format Data file format.
+     * @param delimiter CSV field delimiter.
+     * @param header Indication that CSV file should start with header line.
+     * @param snapshot Snapshot which defines visible rows.
+     * @throw DatabaseError if some column doesn't exist.
+     */
+    BulkDataExporter(const TablePtr& table, const std::vector<std::string>& columnNames,
+            const std::string& filePath, DataFileFormat format, char delimiter, bool header,
+            const TransactionSnapshotPtr& snapshot);
+
+    DECLARE_NONCOPYABLE(BulkDataExporter);
+
+    /**
+     * Writes all rows into the data file. File must not exist.
+     * @return Number of written rows.
+     * @throw DatabaseError if file can't be created or written, or rows can't be read.
+     */
+    std::uint64_t unload();
+
+private:
+    /** Values of each column */
+    using ColumnValues = std::vector<std::vector<Variant>>;
+
+private:
+    /**
+     * Reads master column records of the next batch of rows visible to the snapshot.
+     * @param dataSet Table dataset positioned at the first row of the batch. On return,
+     *                it is positioned at the first row of the next batch.
+     * @param[out] mcrs Master column records.
+     * @return true if there are more rows, false otherwise.
+     */
+    static bool readMasterColumnRecords(
+            TableDataSet& dataSet, std::vector<MasterColumnRecord>& mcrs);
+
+    /**
+     * Reads column values of the rows.
+     * @param mcrs Master column records of the rows.
+     * @return Values of each column.
+     */
+    ColumnValues readColumnValues(const std::vector<MasterColumnRecord>& mcrs) const;
+
+    /**
+     * Encodes batches and writes them to the file. Runs on the writer thread.
+     * @param fd Data file descriptor.
+     */
+    void writeFile(int fd) noexcept;
+
+    /**
+     * Writes data to the file.
+     * @param fd Data file descriptor.
+     * @param data Data.
+     */
+    void writeData(int fd, const std::string& data) const;
+
+    /**
+     * Encodes file header.
+     * @param[out] buffer Output buffer.
+     */
+    void encodeHeader(std::string& buffer) const;
+
+    /**
+     * Encodes batch as CSV records.
+     * @param batch Values of each column.
+     * @param[out] buffer Output buffer.
+     */
+    void encodeCsvBatch(const ColumnValues& batch, std::string& buffer) const;
+
+    /**
+     * Encodes batch as binary rows.
+     * @param batch Values of each column.
+     * @param[out] buffer Output buffer.
+     */
+    void encodeBinaryBatch(const ColumnValues& batch, std::string& buffer) const;
+
+    /**
+     * Appends CSV field, quoting it when necessary.
+     * @param text Field text.
+     * @param[out] buffer Output buffer.
+     */
+    void appendCsvField(const std::string& text, std::string& buffer) const;
+
+    /**
+     * Stops unloading because of error.
+     * @param error Error.
+     */
+    void stop(std::exception_ptr error);
+
+private:
+    /** Source table */
+    const TablePtr m_table;
+
+    /** Source columns in the order of the file values */
+    std::vector<ColumnPtr> m_columns;
+
+    /** Positions of the source columns in the table */
+    std::vector<std::uint32_t> m_columnPositions;
+
+    /** Data file path */
+    const std::string m_filePath;
+
+    /** Data file format */
+    const DataFileFormat m_format;
+
+    /** CSV field delimiter */
+    const char m_delimiter;
+
+    /** Indication that CSV file should start with header line */
+    const bool m_header;
+
+    /** Snapshot which defines visible rows */
+    const TransactionSnapshotPtr m_snapshot;
+
+    /** Number of threads reading columns */
+    const std::size_t m_readerThreadCount;
+
+    /** Pipeline state access synchronization object */
+    std::mutex m_mutex;
+
+    /** Signals pipeline state change */
+    std::condition_variable m_cond;
+
+    /** Read but not written batches */
+    std::deque<ColumnValues> m_batches;
+
+    /** Indication that all rows are read */
+    bool m_readFinished;
+
+    /** Indication that unloading is stopped */
+    bool m_stopped;
+
+    /** First error */
+    std::exception_ptr m_error;
+
+    /** Number of rows in the batch */
+    static constexpr std::size_t kBatchRowCount = 32768;
+
+    /** Maximum number of read but not written batches */
+    static constexpr std::size_t kMaxPendingBatchCount = 2;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,638 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "BulkDataLoader.h"
+
+// Project headers
+#include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "Column.h"
+#include "ThrowDatabaseError.h"
+
+// Common project headers
+#include <siodb/common/io/FileIO.h>
+#include <siodb/common/protobuf/RawDateTimeIO.h>
+#include <siodb/common/utils/Bitmask.h>
+#include <siodb/common/utils/FileDescriptorGuard.h>
+
+// CRT headers
+#include <cstring>
+
+// STL headers
+#include <charconv>
+#include <thread>
+
+// Boost headers
+#include <boost/algorithm/hex.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/endian/conversion.hpp>
+
+// Protobuf headers
+#include <google/protobuf/io/coded_stream.h>
+
+namespace siodb::iomgr::dbengine {
+
+namespace {
+
+/**
+ * Parses integer value.
+ * @param s A string.
+ * @param[out] value Parsed value.
+ * @return true if whole string is valid integer in the range of the value type,
+ *         false otherwise.
+ */
+template<class T>
+bool parseInteger(const std::string& s, T& value) noexcept
+{
+    auto first = s.data();
+    const auto last = first + s.length();
+    if (first != last && *first == '+') ++first;
+    const auto result = std::from_chars(first, last, value);
+    return first != last && result.ec == std::errc() && result.ptr == last;
+}
+
+/**
+ * Reads fixed size little-endian value.
+ * @param input Input stream.
+ * @param[out] value Value.
+ * @return true on success, false if there is not enough data.
+ */
+template<class T>
+bool readLittleEndian(google::protobuf::io::CodedInputStream& input, T& value)
+{
+    if (!input.ReadRaw(&value, sizeof(value))) return false;
+    boost::endian::little_to_native_inplace(value);
+    return true;
+}
+
+}  // anonymous namespace
+
+BulkDataLoader::BulkDataLoader(const TablePtr& table, const std::vector<std::string>& columnNames,
+        const std::string& filePath, DataFileFormat format, char delimiter, bool header)
+    : m_table(table)
+    , m_columnNames(columnNames)
+    , m_filePath(filePath)
+    , m_format(format)
+    , m_delimiter(delimiter)
+    , m_header(header)
+    , m_readFinished(false)
+    , m_parseFinished(false)
+    , m_stopped(false)
+    , m_dataPos(0)
+    , m_recordNumber(0)
+    , m_headerProcessed(false)
+{
+    if (m_columnNames.empty()) {
+        m_columns = m_table->getColumnsOrderedByPosition();
+        // Master column is filled automatically
+        m_columns.erase(m_columns.begin());
+    } else {
+        m_columns.reserve(m_columnNames.size());
+        for (const auto& columnName : m_columnNames)
+            m_columns.push_back(m_table->getColumnChecked(columnName));
+    }
+}
+
+std::uint64_t BulkDataLoader::load(Transaction& transaction)
+{
+    FileDescriptorGuard fd(::open(m_filePath.c_str(), O_RDONLY | O_CLOEXEC));
+    if (!fd.isValidFd()) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotOpenCopyFile, m_filePath, errorCode,
+                std::strerror(errorCode));
+    }
+    ::posix_fadvise(fd.getFd(), 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    std::thread readerThread(&BulkDataLoader::readFile, this, fd.getFd());
+    std::thread parserThread;
+    std::uint64_t rowCount = 0;
+    try {
+        parserThread = std::thread(&BulkDataLoader::parseData, this);
+        ColumnValues batch;
+        while (pop(m_batches, m_parseFinished, batch)) {
+            const auto batchRowCount = batch.front().size();
+            const auto trids = m_table->insertColumnValues(
+                    m_columnNames, batch, transaction.getTransactionParameters());
+            transaction.recordInsertedRows(m_table, trids);
+            rowCount += batchRowCount;
+        }
+    } catch (...) {
+        stop(std::current_exception());
+    }
+    readerThread.join();
+    if (parserThread.joinable()) parserThread.join();
+
+    if (m_error) std::rethrow_exception(m_error);
+    return rowCount;
+}
+
+// ----- internals -----
+
+void BulkDataLoader::readFile(int fd) noexcept
+{
+    try {
+        while (true) {
+            std::string chunk(kChunkSize, '\0');
+            const auto n = ::readExact(fd, chunk.data(), chunk.size(), kIgnoreSignals);
+            if (n < chunk.size()) {
+                const auto errorCode = errno;
+                if (errorCode != 0) {
+                    throwDatabaseError(IOManagerMessageId::kErrorCannotReadCopyFile, m_filePath,
+                            errorCode, std::strerror(errorCode));
+                }
+                chunk.resize(n);
+                if (!chunk.empty()) push(m_chunks, std::move(chunk), kMaxPendingChunkCount);
+                break;
+            }
+            if (!push(m_chunks, std::move(chunk), kMaxPendingChunkCount)) return;
+        }
+        finish(m_readFinished);
+    } catch (...) {
+        stop(std::current_exception());
+    }
+}
+
+void BulkDataLoader::parseData() noexcept
+{
+    try {
+        std::string chunk;
+        while (pop(m_chunks, m_readFinished, chunk)) {
+            if (m_dataPos == m_data.size())
+                m_data.swap(chunk);
+            else {
+                m_data.erase(0, m_dataPos);
+                m_data.append(chunk);
+            }
+            m_dataPos = 0;
+            parseBufferedData(false);
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_stopped) return;
+        }
+
+        parseBufferedData(true);
+        if (m_dataPos != m_data.size()) throwInvalidRecordError("unexpected end of file");
+        if (m_format == DataFileFormat::kBinary && !m_headerProcessed) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidCopyFileHeader, m_filePath,
+                    "unexpected end of file");
+        }
+        flushBatch();
+        finish(m_parseFinished);
+    } catch (...) {
+        stop(std::current_exception());
+    }
+}
+
+void BulkDataLoader::parseBufferedData(bool atEof)
+{
+    const char* const dataStart = m_data.data();
+    const auto dataEnd = dataStart + m_data.size();
+    auto data = dataStart + m_dataPos;
+    if (m_format == DataFileFormat::kCsv) {
+        while (data != dataEnd) {
+            ++m_recordNumber;
+            if (!parseCsvRecord(data, dataEnd, atEof)) {
+                --m_recordNumber;
+                break;
+            }
+        }
+    } else {
+        if (!m_headerProcessed) {
+            if (!parseBinaryHeader(data, dataEnd)) return;
+            m_headerProcessed = true;
+        }
+        while (data != dataEnd) {
+            ++m_recordNumber;
+            if (!parseBinaryRow(data, dataEnd)) {
+                --m_recordNumber;
+                break;
+            }
+        }
+    }
+    m_dataPos = data - dataStart;
+}
+
+bool BulkDataLoader::parseCsvRecord(const char*& data, const char* dataEnd, bool atEof)
+{
+    auto s = data;
+    std::size_t fieldCount = 0;
+    while (true) {
+        if (fieldCount == m_csvFields.size()) m_csvFields.emplace_back();
+        auto& field = m_csvFields[fieldCount++];
+        field.m_text.clear();
+        field.m_quoted = s != dataEnd && *s == '"';
+        if (field.m_quoted) {
+            // Quoted field may contain delimiters, line breaks and doubled quotes
+            ++s;
+            while (true) {
+                const auto quote = static_cast<const char*>(std::memchr(s, '"', dataEnd - s));
+                if (!quote) {
+                    if (atEof) throwInvalidRecordError("unterminated quoted field");
+                    return false;
+                }
+                field.m_text.append(s, quote);
+                s = quote + 1;
+                if (s == dataEnd || *s != '"') break;
+                field.m_text.push_back('"');
+                ++s;
+            }
+        } else {
+            const auto fieldStart = s;
+            while (s != dataEnd && *s != m_delimiter && *s != '\n')
+                ++s;
+            field.m_text.assign(fieldStart, s);
+        }
+
+        if (s != dataEnd && *s == m_delimiter) {
+            ++s;
+            continue;
+        }
+        if (s != dataEnd && *s == '\r' && field.m_quoted) ++s;
+        if (s == dataEnd) {
+            if (!atEof) return false;
+            break;
+        }
+        if (*s != '\n') throwInvalidRecordError("unexpected character after quoted field");
+        ++s;
+        break;
+    }
+    data = s;
+
+    // Line breaks may be CRLF
+    auto& lastField = m_csvFields[fieldCount - 1];
+    if (!lastField.m_quoted && !lastField.m_text.empty() && lastField.m_text.back() == '\r')
+        lastField.m_text.pop_back();
+
+    // Empty lines are skipped
+    if (fieldCount == 1 && !lastField.m_quoted && lastField.m_text.empty()) {
+        --m_recordNumber;
+        return true;
+    }
+
+    if (m_header && m_recordNumber == 1) return true;
+
+    if (fieldCount != m_columns.size()) {
+        throwInvalidRecordError(("expected " + std::to_string(m_columns.size())
+                                        + " values, but got " + std::to_string(fieldCount))
+                                        .c_str());
+    }
+
+    if (m_batch.empty()) {
+        m_batch.resize(m_columns.size());
+        for (auto& values : m_batch)
+            values.reserve(kBatchRowCount);
+    }
+    for (std::size_t i = 0; i < fieldCount; ++i)
+        m_batch[i].push_back(convertCsvField(m_csvFields[i], i));
+    if (m_batch.front().size() == kBatchRowCount) flushBatch();
+    return true;
+}
+
+bool BulkDataLoader::parseBinaryHeader(const char*& data, const char* dataEnd)
+{
+    google::protobuf::io::CodedInputStream input(
+            reinterpret_cast<const std::uint8_t*>(data), dataEnd - data);
+    char signature[sizeof(kBinaryDataFileSignature)];
+    std::uint32_t version = 0, columnCount = 0;
+    if (!input.ReadRaw(signature, sizeof(signature)) || !input.ReadVarint32(&version)
+            || !input.ReadVarint32(&columnCount))
+        return false;
+
+    if (std::memcmp(signature, kBinaryDataFileSignature, sizeof(signature)) != 0) {
+        throwDatabaseError(
+                IOManagerMessageId::kErrorInvalidCopyFileHeader, m_filePath, "invalid signature");
+    }
+    if (version != kBinaryDataFileVersion) {
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidCopyFileHeader, m_filePath,
+                "unsupported version " + std::to_string(version));
+    }
+    if (columnCount != m_columns.size()) {
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidCopyFileHeader, m_filePath,
+                "expected " + std::to_string(m_columns.size()) + " columns, but got "
+                        + std::to_string(columnCount));
+    }
+
+    for (const auto& column : m_columns) {
+        std::uint32_t dataType = 0;
+        if (!input.ReadVarint32(&dataType)) return false;
+        if (dataType != static_cast<std::uint32_t>(column->getDataType())) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidCopyFileHeader, m_filePath,
+                    "data type of the column " + column->getName() + " doesn't match");
+        }
+    }
+
+    data += input.CurrentPosition();
+    return true;
+}
+
+bool BulkDataLoader::parseBinaryRow(const char*& data, const char* dataEnd)
+{
+    // Row is parsed only when it is available completely
+    std::uint64_t rowLength = 0;
+    const auto rowLengthEnd = data + std::min<std::ptrdiff_t>(dataEnd - data, 10);
+    google::protobuf::io::CodedInputStream rowLengthInput(
+            reinterpret_cast<const std::uint8_t*>(data), rowLengthEnd - data);
+    if (!rowLengthInput.ReadVarint64(&rowLength)) {
+        if (rowLengthEnd - data == 10) throwInvalidRecordError("invalid row length");
+        return false;
+    }
+    const auto rowStart = data + rowLengthInput.CurrentPosition();
+    if (rowLength > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+        throwInvalidRecordError("invalid row length");
+    if (static_cast<std::uint64_t>(dataEnd - rowStart) < rowLength) return false;
+
+    google::protobuf::io::CodedInputStream input(
+            reinterpret_cast<const std::uint8_t*>(rowStart), static_cast<int>(rowLength));
+    const auto columnCount = m_columns.size();
+    utils::Bitmask nullMask(columnCount, false);
+    if (!input.ReadRaw(nullMask.getData(), nullMask.getByteSize()))
+        throwInvalidRecordError("row is too short");
+
+    if (m_batch.empty()) {
+        m_batch.resize(columnCount);
+        for (auto& values : m_batch)
+            values.reserve(kBatchRowCount);
+    }
+
+    bool ok = true;
+    for (std::size_t i = 0; i < columnCount && ok; ++i) {
+        auto& value = m_batch[i].emplace_back();
+        if (nullMask.getBit(i)) continue;
+        switch (m_columns[i]->getDataType()) {
+            case COLUMN_DATA_TYPE_BOOL: {
+                std::uint8_t v = 0;
+                ok = input.ReadRaw(&v, sizeof(v));
+                value = v != 0;
+                break;
+            }
+            case COLUMN_DATA_TYPE_INT8: {
+                std::int8_t v = 0;
+                ok = input.ReadRaw(&v, sizeof(v));
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_UINT8: {
+                std::uint8_t v = 0;
+                ok = input.ReadRaw(&v, sizeof(v));
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_INT16: {
+                std::int16_t v = 0;
+                ok = readLittleEndian(input, v);
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_UINT16: {
+                std::uint16_t v = 0;
+                ok = readLittleEndian(input, v);
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_INT32: {
+                std::uint32_t v = 0;
+                ok = input.ReadVarint32(&v);
+                value = static_cast<std::int32_t>(v);
+                break;
+            }
+            case COLUMN_DATA_TYPE_UINT32: {
+                std::uint32_t v = 0;
+                ok = input.ReadVarint32(&v);
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_INT64: {
+                std::uint64_t v = 0;
+                ok = input.ReadVarint64(&v);
+                value = static_cast<std::int64_t>(v);
+                break;
+            }
+            case COLUMN_DATA_TYPE_UINT64: {
+                std::uint64_t v = 0;
+                ok = input.ReadVarint64(&v);
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_FLOAT: {
+                std::uint32_t v = 0;
+                ok = input.ReadLittleEndian32(&v);
+                float f = 0;
+                std::memcpy(&f, &v, sizeof(f));
+                value = f;
+                break;
+            }
+            case COLUMN_DATA_TYPE_DOUBLE: {
+                std::uint64_t v = 0;
+                ok = input.ReadLittleEndian64(&v);
+                double d = 0;
+                std::memcpy(&d, &v, sizeof(d));
+                value = d;
+                break;
+            }
+            case COLUMN_DATA_TYPE_TIMESTAMP: {
+                RawDateTime v;
+                ok = protobuf::readRawDateTime(input, v);
+                value = v;
+                break;
+            }
+            case COLUMN_DATA_TYPE_TEXT: {
+                std::uint32_t length = 0;
+                std::string v;
+                ok = input.ReadVarint32(&length) && length <= rowLength
+                     && input.ReadString(&v, length);
+                value = std::move(v);
+                break;
+            }
+            case COLUMN_DATA_TYPE_BINARY: {
+                std::uint32_t length = 0;
+                ok = input.ReadVarint32(&length) && length <= rowLength;
+                if (ok) {
+                    BinaryValue v(length);
+                    ok = input.ReadRaw(v.data(), length);
+                    value = std::move(v);
+                }
+                break;
+            }
+            default: {
+                throwDatabaseError(IOManagerMessageId::kErrorInvalidCopyFileValue, m_filePath,
+                        m_recordNumber, m_columns[i]->getName());
+            }
+        }
+    }
+    if (!ok || input.CurrentPosition() != static_cast<int>(rowLength))
+        throwInvalidRecordError("row length doesn't match to the row values");
+
+    // Missing values of the failed row are never inserted, since error stops loading
+    data = rowStart + rowLength;
+    if (m_batch.front().size() == kBatchRowCount) flushBatch();
+    return true;
+}
+
+Variant BulkDataLoader::convertCsvField(const CsvField& field, std::size_t columnIndex) const
+{
+    const auto& s = field.m_text;
+    // Empty unquoted field is NULL, while quoted one is empty string
+    if (s.empty() && !field.m_quoted) return Variant();
+
+    bool ok = true;
+    Variant value;
+    switch (m_columns[columnIndex]->getDataType()) {
+        case COLUMN_DATA_TYPE_BOOL: {
+            if (boost::iequals(s, "true") || s == "1")
+                value = true;
+            else if (boost::iequals(s, "false") || s == "0")
+                value = false;
+            else
+                ok = false;
+            break;
+        }
+        case COLUMN_DATA_TYPE_INT8: {
+            std::int8_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_UINT8: {
+            std::uint8_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_INT16: {
+            std::int16_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_UINT16: {
+            std::uint16_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_INT32: {
+            std::int32_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_UINT32: {
+            std::uint32_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_INT64: {
+            std::int64_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_UINT64: {
+            std::uint64_t v = 0;
+            ok = parseInteger(s, v);
+            value = v;
+            break;
+        }
+        case COLUMN_DATA_TYPE_FLOAT: {
+            char* end = nullptr;
+            value = std::strtof(s.c_str(), &end);
+            ok = !s.empty() && end == s.c_str() + s.length();
+            break;
+        }
+        case COLUMN_DATA_TYPE_DOUBLE: {
+            char* end = nullptr;
+            value = std::strtod(s.c_str(), &end);
+            ok = !s.empty() && end == s.c_str() + s.length();
+            break;
+        }
+        case COLUMN_DATA_TYPE_TIMESTAMP: {
+            try {
+                value = Variant(s, Variant::AsDateTime());
+            } catch (std::invalid_argument&) {
+                ok = false;
+            }
+            break;
+        }
+        case COLUMN_DATA_TYPE_TEXT: {
+            value = s;
+            break;
+        }
+        case COLUMN_DATA_TYPE_BINARY: {
+            // Binary values are hex strings
+            ok = s.length() % 2 == 0;
+            if (ok) {
+                BinaryValue v(s.length() / 2);
+                try {
+                    boost::algorithm::unhex(s.cbegin(), s.cend(), v.data());
+                    value = std::move(v);
+                } catch (boost::algorithm::hex_decode_error&) {
+                    ok = false;
+                }
+            }
+            break;
+        }
+        default: ok = false; break;
+    }
+
+    if (!ok) {
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidCopyFileValue, m_filePath,
+                m_recordNumber, m_columns[columnIndex]->getName());
+    }
+    return value;
+}
+
+void BulkDataLoader::flushBatch()
+{
+    if (m_batch.empty() || m_batch.front().empty()) return;
+    push(m_batches, std::move(m_batch), kMaxPendingBatchCount);
+    m_batch.clear();
+}
+
+void BulkDataLoader::throwInvalidRecordError(const char* reason) const
+{
+    throwDatabaseError(
+            IOManagerMessageId::kErrorInvalidCopyFileRecord, m_filePath, m_recordNumber, reason);
+}
+
+template<class T>
+bool BulkDataLoader::push(std::deque<T>& queue, T&& element, std::size_t maxSize)
+{
+    std::unique_lock lock(m_mutex);
+    m_cond.wait(lock, [&] { return m_stopped || queue.size() < maxSize; });
+    if (m_stopped) return false;
+    queue.push_back(std::move(element));
+    m_cond.notify_all();
+    return true;
+}
+
+template<class T>
+bool BulkDataLoader::pop(std::deque<T>& queue, const bool& finished, T& element)
+{
+    std::unique_lock lock(m_mutex);
+    m_cond.wait(lock, [&] { return m_stopped || finished || !queue.empty(); });
+    if (m_stopped || queue.empty()) return false;
+    element = std::move(queue.front());
+    queue.pop_front();
+    m_cond.notify_all();
+    return true;
+}
+
+void BulkDataLoader::finish(bool& finished)
+{
+    std::lock_guard lock(m_mutex);
+    finished = true;
+    m_cond.notify_all();
+}
+
+void BulkDataLoader::stop(std::exception_ptr error)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_error) m_error = std::move(error);
+    m_stopped = true;
+    m_cond.notify_all();
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,236 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "DataFileFormat.h"
+#include "Table.h"
+#include "Transaction.h"
+
+// STL headers
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Loads rows from the data file on the server into a table. File is processed
+ * by the pipeline: reader thread reads file in large chunks, parser thread converts
+ * chunks directly into values of the column data types, and calling thread inserts
+ * parsed rows in batches, writing columns concurrently. Inserted rows are recorded
+ * in the transaction, so that batches inserted before an error can be rolled back.
+ */
+class BulkDataLoader final {
+public:
+    /**
+     * Initializes object of class BulkDataLoader.
+     * @param table Destination table.
+     * @param columnNames Column names. If empty, values correspond to all columns
+     *                    in the order they are in the table.
+     * @param filePath Data file path.
+     * @param format Data file format.
+     * @param delimiter CSV field delimiter.
+     * @param header Indication that CSV file starts with header line.
+     * @throw DatabaseError if some column doesn't exist.
+     */
+    BulkDataLoader(const TablePtr& table, const std::vector<std::string>& columnNames,
+            const std::string& filePath, DataFileFormat format, char delimiter, bool header);
+
+    DECLARE_NONCOPYABLE(BulkDataLoader);
+
+    /**
+     * Loads all rows from the data file.
+     * @param transaction Transaction which inserts rows.
+     * @return Number of loaded rows.
+     * @throw DatabaseError if file can't be read, contains invalid data
+     *                      or rows can't be inserted.
+     */
+    std::uint64_t load(Transaction& transaction);
+
+private:
+    /** Values of each column */
+    using ColumnValues = std::vector<std::vector<Variant>>;
+
+    /** CSV field */
+    struct CsvField {
+        /** Field text, without quotes */
+        std::string m_text;
+
+        /** Indication that field was quoted */
+        bool m_quoted;
+    };
+
+private:
+    /**
+     * Reads data file into chunks. Runs on the reader thread.
+     * @param fd Data file descriptor.
+     */
+    void readFile(int fd) noexcept;
+
+    /** Parses chunks into batches of column values. Runs on the parser thread. */
+    void parseData() noexcept;
+
+    /**
+     * Parses complete records available in the data buffer.
+     * @param atEof Indication that end of file is reached.
+     */
+    void parseBufferedData(bool atEof);
+
+    /**
+     * Parses single CSV record.
+     * @param data Record start, advanced past the record on success.
+     * @param dataEnd Data end.
+     * @param atEof Indication that end of file is reached.
+     * @return true if record was parsed, false if record is incomplete.
+     */
+    bool parseCsvRecord(const char*& data, const char* dataEnd, bool atEof);
+
+    /**
+     * Parses binary file header.
+     * @param data Header start, advanced past the header on success.
+     * @param dataEnd Data end.
+     * @return true if header was parsed, false if header is incomplete.
+     */
+    bool parseBinaryHeader(const char*& data, const char* dataEnd);
+
+    /**
+     * Parses single binary row.
+     * @param data Row start, advanced past the row on success.
+     * @param dataEnd Data end.
+     * @return true if row was parsed, false if row is incomplete.
+     */
+    bool parseBinaryRow(const char*& data, const char* dataEnd);
+
+    /**
+     * Converts CSV field into the value of the column data type.
+     * @param field A field.
+     * @param columnIndex Column index.
+     * @return Value.
+     * @throw DatabaseError if field can't be converted.
+     */
+    Variant convertCsvField(const CsvField& field, std::size_t columnIndex) const;
+
+    /** Passes current batch to the calling thread. */
+    void flushBatch();
+
+    /**
+     * Throws error about invalid record.
+     * @param reason Description of the problem.
+     */
+    [[noreturn]] void throwInvalidRecordError(const char* reason) const;
+
+    /**
+     * Adds element to the queue, waits while queue is full.
+     * @param queue A queue.
+     * @param element An element.
+     * @param maxSize Maximum queue size.
+     * @return true if element was added, false if loading is stopped.
+     */
+    template<class T>
+    bool push(std::deque<T>& queue, T&& element, std::size_t maxSize);
+
+    /**
+     * Removes element from the queue, waits while queue is empty.
+     * @param queue A queue.
+     * @param finished Indication that no more elements will be added.
+     * @param element An element.
+     * @return true if element was removed, false if there are no more elements
+     *         or loading is stopped.
+     */
+    template<class T>
+    bool pop(std::deque<T>& queue, const bool& finished, T& element);
+
+    /**
+     * Marks end of the queue.
+     * @param finished Indication that no more elements will be added.
+     */
+    void finish(bool& finished);
+
+    /**
+     * Stops loading because of error.
+     * @param error Error.
+     */
+    void stop(std::exception_ptr error);
+
+private:
+    /** Destination table */
+    const TablePtr m_table;
+
+    /** Column names */
+    const std::vector<std::string> m_columnNames;
+
+    /** Destination columns in the order of the file values */
+    std::vector<ColumnPtr> m_columns;
+
+    /** Data file path */
+    const std::string m_filePath;
+
+    /** Data file format */
+    const DataFileFormat m_format;
+
+    /** CSV field delimiter */
+    const char m_delimiter;
+
+    /** Indication that CSV file starts with header line */
+    const bool m_header;
+
+    /** Pipeline state access synchronization object */
+    std::mutex m_mutex;
+
+    /** Signals pipeline state change */
+    std::condition_variable m_cond;
+
+    /** Read but not parsed chunks */
+    std::deque<std::string> m_chunks;
+
+    /** Indication that file is read */
+    bool m_readFinished;
+
+    /** Parsed but not inserted batches */
+    std::deque<ColumnValues> m_batches;
+
+    /** Indication that file is parsed */
+    bool m_parseFinished;
+
+    /** Indication that loading is stopped */
+    bool m_stopped;
+
+    /** First error */
+    std::exception_ptr m_error;
+
+    /** Parser data buffer, contains incomplete record at the end */
+    std::string m_data;
+
+    /** Position of the first unparsed byte in the parser data buffer */
+    std::size_t m_dataPos;
+
+    /** Number of the current record in the file, starting from 1 */
+    std::uint64_t m_recordNumber;
+
+    /** Indication that file header is processed */
+    bool m_headerProcessed;
+
+    /** Batch being filled by the parser */
+    ColumnValues m_batch;
+
+    /** Fields of the current CSV record */
+    std::vector<CsvField> m_csvFields;
+
+    /** Chunk size */
+    static constexpr std::size_t kChunkSize = 1024 * 1024;
+
+    /** Maximum number of read but not parsed chunks */
+    static constexpr std::size_t kMaxPendingChunkCount = 4;
+
+    /** Number of rows in the batch */
+    static constexpr std::size_t kBatchRowCount = 32768;
+
+    /** Maximum number of parsed but not inserted batches */
+    static constexpr std::size_t kMaxPendingBatchCount = 2;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -10,6 +10,7 @@
 #include "ColumnDefinitionConstraintList.h"
 #include "DatabaseObjectName.h"
 #include "IndexColumn.h"
+#include "IoStatistics.h"
 #include "LobChunkHeader.h"
 #include "ThrowDatabaseError.h"
 #include "lob/ColumnBlobStream.h"
@@ -63,6 +64,7 @@ const std::unordered_set<std::string> Column::m_wellKnownIgnorableFiles {
         Column::kInitializationFlagFile,
         Column::kMainIndexIdFile,
         Column::kTridCounterFile,
+        Column::kValueCountersFile,
 };
 
 Column::Column(Table& table, const ColumnSpecification& spec, std::uint64_t firstUserTrid)
@@ -73,6 +75,7 @@ Column::Column(Table& table, const ColumnSpecification& spec, std::uint64_t firs
     , m_dataBlockDataAreaSize(spec.m_dataBlockDataAreaSize)
     , m_dataDir(ensureDataDir(true))
     , m_masterColumnData(maybeCreateMasterColumnData(true, firstUserTrid))
+    , m_regularColumnData(maybeCreateRegularColumnData(true))
     , m_columnDefinitionCache(kColumnDefinitionCacheCapacity)
     , m_currentColumnDefinition(createColumnDefinitionUnlocked())
     , m_notNull(false)
@@ -123,6 +126,7 @@ Column::Column(Table& table, const ColumnRecord& columnRecord, std::uint64_t fir
     , m_dataBlockDataAreaSize(columnRecord.m_dataBlockDataAreaSize)
     , m_dataDir(ensureDataDir())
     , m_masterColumnData(maybeCreateMasterColumnData(false, firstUserTrid))
+    , m_regularColumnData(maybeCreateRegularColumnData(false))
     , m_columnDefinitionCache(kColumnDefinitionCacheCapacity)
     , m_currentColumnDefinition(getColumnDefinitionChecked(
               getDatabase().getLatestColumnDefinitionIdForColumn(m_table.getId(), m_id)))
@@ -134,6 +138,64 @@ Column::Column(Table& table, const ColumnRecord& columnRecord, std::uint64_t fir
     checkDataConsistency();
 }
 
+/** Collects consecutive records of the same data block and writes them at once */
+class Column::BlockWriteBuffer {
+public:
+    /**
+     * Initializes object of class BlockWriteBuffer.
+     * @param column Column, which must be locked while buffer is used.
+     */
+    explicit BlockWriteBuffer(Column& column) noexcept
+        : m_column(column)
+    {
+    }
+
+    /**
+     * Allocates space for the record. Buffered records are written to the current block
+     * before the other block is selected, if current block has no room for the record.
+     * @param length Record length.
+     * @return Pair of record address and record buffer, valid until the next call.
+     */
+    std::pair<ColumnDataAddress, std::uint8_t*> allocate(std::uint32_t length)
+    {
+        if (!m_block || m_block->getFreeDataSpace() < m_data.size() + length) {
+            flush();
+            m_block = m_column.selectAvailableBlock(length);
+            if (m_column.m_availableDataBlocks.count(m_block->getId()) == 0) {
+                throwDatabaseError(IOManagerMessageId::kErrorCannotFindAvailableBlockRecord,
+                        m_column.getDatabaseName(), m_column.m_table.getName(), m_column.m_name,
+                        m_block->getId(), m_column.getDatabaseUuid(), m_column.m_table.getId(),
+                        m_column.m_id);
+            }
+        }
+        const auto offset = m_data.size();
+        m_data.resize(offset + length);
+        return std::make_pair(
+                ColumnDataAddress(m_block->getId(), m_block->getNextDataPos() + offset),
+                m_data.data() + offset);
+    }
+
+    /** Writes buffered records to the current block. */
+    void flush()
+    {
+        if (m_data.empty()) return;
+        m_block->writeData(m_data.data(), m_data.size());
+        m_block->incNextDataPos(m_data.size());
+        m_column.updateAvailableBlock(*m_block);
+        m_data.clear();
+    }
+
+private:
+    /** Column */
+    Column& m_column;
+
+    /** Current block */
+    ColumnDataBlockPtr m_block;
+
+    /** Buffered records */
+    std::vector<std::uint8_t> m_data;
+};
+
 std::string Column::getDisplayName() const
 {
     std::ostringstream oss;
@@ -172,7 +234,10 @@ ColumnDataBlockPtr Column::createBlock(std::uint64_t prevBlockId, ColumnDataBloc
 {
     std::lock_guard lock(m_mutex);
     auto block = std::make_shared<ColumnDataBlock>(*this, prevBlockId, state);
-    m_blockCache.emplace(block->getId(), block);
+    {
+        std::lock_guard blockCacheLock(m_blockCacheMutex);
+        m_blockCache.emplace(block->getId(), block);
+    }
     m_blockRegistry.recordBlockAndNextBlock(block->getId(), prevBlockId);
     return block;
 }
@@ -200,7 +265,6 @@ void Column::readRecord(
         return;
     }
 
-    std::lock_guard lock(m_mutex);
     auto block = getExistingBlock(addr.getBlockId());
     std::uint32_t requiredLength = m_minRequiredBlockFreeSpaces[m_dataType];
     if (addr.getOffset() + requiredLength >= m_dataBlockDataAreaSize) {
@@ -355,128 +419,8 @@ std::pair<ColumnDataAddress, ColumnDataAddress> Column::putRecord(Variant&& valu
             return std::make_pair(kNullValueAddress, kNullValueAddress);
     }
 
-    Variant v;
-    std::uint32_t requiredLength = m_minRequiredBlockFreeSpaces[m_dataType];
-
-    try {
-        // Cast value to column data type
-        switch (m_dataType) {
-            case COLUMN_DATA_TYPE_BOOL: {
-                if (value.getValueType() != VariantType::kBool) v = value.asBool();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_INT8: {
-                if (value.getValueType() != VariantType::kInt8) v = value.asInt8();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_UINT8: {
-                if (value.getValueType() != VariantType::kUInt8) v = value.asUInt8();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_INT16: {
-                if (value.getValueType() != VariantType::kInt16) v = value.asInt16();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_UINT16: {
-                if (value.getValueType() != VariantType::kUInt16) v = value.asUInt16();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_INT32: {
-                if (value.getValueType() != VariantType::kInt32) v = value.asInt32();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_UINT32: {
-                if (value.getValueType() != VariantType::kUInt32) v = value.asUInt32();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_INT64: {
-                if (value.getValueType() != VariantType::kInt64) v = value.asInt64();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_UINT64: {
-                if (value.getValueType() != VariantType::kUInt64) v = value.asUInt64();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_FLOAT: {
-                if (value.getValueType() != VariantType::kFloat) v = value.asFloat();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_DOUBLE: {
-                if (value.getValueType() != VariantType::kDouble) v = value.asDouble();
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_TEXT: {
-                switch (value.getValueType()) {
-                    case VariantType::kString:
-                    case VariantType::kClob: break;
-                    case VariantType::kBinary: {
-                        if (value.getBinary().size() <= kMaxStringLength / 2)
-                            v = value.asString().release();
-                        else
-                            v = value.asClob().release();
-                        break;
-                    }
-                    case VariantType::kBlob: {
-                        if (value.getBlob().getRemainingSize() > kMaxClobLength / 2)
-                            throw std::logic_error("BLOB is too long");
-                        v = value.asClob().release();
-                        break;
-                    }
-                    default: {
-                        v = value.asString().release();
-                        break;
-                    }
-                }
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_BINARY: {
-                switch (value.getValueType()) {
-                    case VariantType::kBinary:
-                    case VariantType::kBlob: break;
-                    case VariantType::kClob: {
-                        v = value.asBlob().release();
-                        break;
-                    }
-                    default: {
-                        v = value.asBinary().release();
-                        break;
-                    }
-                }
-                break;
-            }
-
-            case COLUMN_DATA_TYPE_TIMESTAMP: {
-                if (value.getValueType() != VariantType::kDateTime) v = value.asDateTime();
-                requiredLength = 12;
-                break;
-            }
-
-            default: throw std::logic_error("invalid data type");
-        }  // switch
-    } catch (VariantTypeCastError& ex) {
-        throwDatabaseError(IOManagerMessageId::kErrorIncompatibleDataType, getDatabaseName(),
-                m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id,
-                static_cast<int>(ex.getDestValueType()), static_cast<int>(ex.getSourceValueType()));
-    } catch (std::logic_error&) {
-        throwDatabaseError(IOManagerMessageId::kErrorIncompatibleDataType2, getDatabaseName(),
-                m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id,
-                static_cast<int>(m_dataType), static_cast<int>(value.getValueType()));
-    }
-
-    // If no data so far, take value from origin.
-    if (v.isNull()) v.swap(value);
+    auto v = convertValue(value);
+    const auto requiredLength = getRequiredRecordLength();
 
     // Get available block
     auto block = selectAvailableBlock(requiredLength);
@@ -490,84 +434,9 @@ std::pair<ColumnDataAddress, ColumnDataAddress> Column::putRecord(Variant&& valu
     }
 
     const auto pos = block->getNextDataPos();
-    std::uint32_t actualLength = requiredLength;
 
     // Store data
     switch (m_dataType) {
-        case COLUMN_DATA_TYPE_BOOL: {
-            const std::uint8_t value = v.getBool() ? 1 : 0;
-            block->writeData(&value, sizeof(value));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_INT8: {
-            const std::int8_t value = v.getInt8();
-            block->writeData(&value, sizeof(value));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_UINT8: {
-            const std::uint8_t value = v.getUInt8();
-            block->writeData(&value, sizeof(value));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_INT16: {
-            std::uint8_t buffer[2];
-            ::pbeEncodeInt16(v.getInt16(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_UINT16: {
-            std::uint8_t buffer[2];
-            ::pbeEncodeUInt16(v.getUInt16(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_INT32: {
-            std::uint8_t buffer[4];
-            ::pbeEncodeInt32(v.getInt32(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_UINT32: {
-            std::uint8_t buffer[4];
-            ::pbeEncodeUInt32(v.getUInt32(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_INT64: {
-            std::uint8_t buffer[8];
-            ::pbeEncodeInt64(v.getInt64(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_UINT64: {
-            std::uint8_t buffer[8];
-            ::pbeEncodeUInt64(v.getUInt64(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_FLOAT: {
-            std::uint8_t buffer[4];
-            ::pbeEncodeFloat(v.getFloat(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
-        case COLUMN_DATA_TYPE_DOUBLE: {
-            std::uint8_t buffer[8];
-            ::pbeEncodeDouble(v.getDouble(), buffer);
-            block->writeData(&buffer, sizeof(buffer));
-            break;
-        }
-
         case COLUMN_DATA_TYPE_TEXT: {
             if (v.isString()) {
                 const auto& s = v.getString();
@@ -590,20 +459,15 @@ std::pair<ColumnDataAddress, ColumnDataAddress> Column::putRecord(Variant&& valu
             break;
         }
 
-        case COLUMN_DATA_TYPE_TIMESTAMP: {
-            std::uint8_t buffer[RawDateTime::kMaxSerializedSize];
-            block->writeData(&buffer, v.getDateTime().serialize(buffer) - buffer);
-            break;
-        }
-
         default: {
-            // Should never happen, but make compiler happy
-            throw std::logic_error("invalid data type");
+            std::uint8_t buffer[kMaxFixedSizeRecordLength];
+            block->writeData(buffer, serializeFixedSizeValue(v, buffer) - buffer);
+            break;
         }
     }  // switch
 
     // Update block free space
-    block->incNextDataPos(actualLength);
+    block->incNextDataPos(requiredLength);
     itBlock->second = block->getFreeDataSpace();
 
     //DBG_LOG_DEBUG("Column::putRecord(): " << getDisplayName() << " at "
@@ -613,6 +477,53 @@ std::pair<ColumnDataAddress, ColumnDataAddress> Column::putRecord(Variant&& valu
             ColumnDataAddress(block->getId(), block->getNextDataPos()));
 }
 
+std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>> Column::putRecords(
+        std::vector<Variant>& values)
+{
+    std::lock_guard lock(m_mutex);
+
+    std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>> result;
+    result.reserve(values.size());
+
+    // Variable length values are stored in chunks, one by one
+    if (m_dataType == COLUMN_DATA_TYPE_TEXT || m_dataType == COLUMN_DATA_TYPE_BINARY) {
+        try {
+            for (auto& value : values)
+                result.push_back(putRecord(std::move(value)));
+        } catch (...) {
+            rollbackRecords(result);
+            throw;
+        }
+        return result;
+    }
+
+    // Consecutive fixed size values are written into the block at once
+    const auto requiredLength = getRequiredRecordLength();
+    BlockWriteBuffer writeBuffer(*this);
+    try {
+        for (auto& value : values) {
+            if (value.isNull()) {
+                if (m_notNull) {
+                    throwDatabaseError(IOManagerMessageId::kErrorCannotInsertNullValue,
+                            getDatabaseName(), m_table.getName(), m_name);
+                }
+                result.emplace_back(kNullValueAddress, kNullValueAddress);
+                continue;
+            }
+            const auto [address, buffer] = writeBuffer.allocate(requiredLength);
+            serializeFixedSizeValue(convertValue(value), buffer);
+            result.emplace_back(address,
+                    ColumnDataAddress(address.getBlockId(), address.getOffset() + requiredLength));
+        }
+        writeBuffer.flush();
+    } catch (...) {
+        // Values which are not written yet are rolled back too, which is harmless
+        rollbackRecords(result);
+        throw;
+    }
+    return result;
+}
+
 std::pair<ColumnDataAddress, ColumnDataAddress> Column::putMasterColumnRecord(
         const MasterColumnRecord& record)
 {
@@ -686,6 +597,66 @@ std::pair<ColumnDataAddress, ColumnDataAddress> Column::putMasterColumnRecord(
             ColumnDataAddress(block->getId(), block->getNextDataPos()));
 }
 
+void Column::putMasterColumnRecords(const std::vector<MasterColumnRecordPtr>& records)
+{
+    // Check that this is master column
+    if (!isMasterColumn()) {
+        throwDatabaseError(IOManagerMessageId::kErrorNotMasterColumn, getDatabaseName(),
+                m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id);
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    // Records are written first, then main index is updated
+    std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>> addresses;
+    addresses.reserve(records.size());
+    std::size_t indexedRecordCount = 0;
+    std::uint8_t indexKey[8];
+    try {
+        BlockWriteBuffer writeBuffer(*this);
+        for (const auto& record : records) {
+            if (record->getAtomicOperationType() != DmlOperationType::kInsert)
+                throw std::invalid_argument("Master column record is not insert record");
+
+            // Check that MCR fits to the size limit
+            const auto recordSize = record->getSerializedSize();
+            const auto recordSizeWithSizeTag = record->getSerializedSizeWithSizeTag(recordSize);
+            if (recordSizeWithSizeTag > MasterColumnRecord::kMaxSerializedSize) {
+                throwDatabaseError(IOManagerMessageId::kErrorTooManyColumns, getDatabaseName(),
+                        m_table.getName(), getDatabaseUuid(), m_table.getId());
+            }
+
+            const auto [address, buffer] = writeBuffer.allocate(recordSizeWithSizeTag);
+            const auto end = record->serializeUncheckedWithSizeTag(buffer, recordSize);
+            if (SIODB_UNLIKELY(static_cast<std::size_t>(end - buffer) != recordSizeWithSizeTag))
+                throw std::runtime_error("Invalid MCR serialization");
+            addresses.emplace_back(address, ColumnDataAddress(address.getBlockId(),
+                                                    address.getOffset() + recordSizeWithSizeTag));
+        }
+        writeBuffer.flush();
+
+        std::uint8_t indexValue[12];
+        for (; indexedRecordCount < records.size(); ++indexedRecordCount) {
+            const auto& address = addresses[indexedRecordCount].first;
+            ::pbeEncodeUInt64(records[indexedRecordCount]->getTableRowId(), indexKey);
+            ::pbeEncodeUInt64(address.getBlockId(), indexValue);
+            ::pbeEncodeUInt32(address.getOffset(), indexValue + 8);
+            m_masterColumnData->m_mainIndex->insert(indexKey, indexValue, true);
+        }
+    } catch (...) {
+        try {
+            for (std::size_t i = 0; i < indexedRecordCount; ++i) {
+                ::pbeEncodeUInt64(records[i]->getTableRowId(), indexKey);
+                m_masterColumnData->m_mainIndex->erase(indexKey);
+            }
+        } catch (std::exception& ex) {
+            LOG_ERROR << ex.what();
+        }
+        rollbackRecords(addresses);
+        throw;
+    }
+}
+
 void Column::eraseFromMasterColumnRecordMainIndex(std::uint64_t trid)
 {
     // Check that this is master column
@@ -740,23 +711,23 @@ void Column::rollbackToAddress(
     auto currentBlockId = firstAvailableBlockId;
     while (currentBlockId != addr.getBlockId()) {
         // Load block
-        block = loadBlock(currentBlockId);
-        if (!block) {
+        const auto currentBlock = loadBlock(currentBlockId);
+        if (!currentBlock) {
             throwDatabaseError(IOManagerMessageId::kErrorColumnDataBlockDoesNotExist,
                     getDatabaseName(), m_table.getName(), m_name, addr.getBlockId(),
                     getDatabaseUuid(), m_table.getId(), m_id);
         }
 
         // Adjust block metadata
-        block->setNextDataPos(0);
-        block->resetFillTimestamp();
-        block->saveHeader();
+        currentBlock->setNextDataPos(0);
+        currentBlock->resetFillTimestamp();
+        currentBlock->saveHeader();
 
         // Update block free space info
-        updateAvailableBlock(*block);
+        updateAvailableBlock(*currentBlock);
 
         // Move to next block
-        currentBlockId = block->getPrevBlockId();
+        currentBlockId = currentBlock->getPrevBlockId();
         if (currentBlockId == 0) {
             throwDatabaseError(IOManagerMessageId::kErrorUnreachableRollbackDataBlockPosition,
                     getDatabaseName(), m_table.getName(), m_name, addr.getBlockId(),
@@ -774,10 +745,26 @@ void Column::rollbackToAddress(
     updateAvailableBlock(*block);
 }
 
+void Column::rollbackRecords(
+        const std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>>& records,
+        std::size_t firstRecordIndex)
+{
+    const auto isStored = [](const auto& record) noexcept {
+        return !record.first.isNullValueAddress();
+    };
+    const auto first = std::find_if(records.cbegin() + firstRecordIndex, records.cend(), isStored);
+    if (first == records.cend()) return;
+    const auto last = std::find_if(records.crbegin(), records.crend(), isStored);
+    try {
+        rollbackToAddress(first->first, last->second.getBlockId());
+    } catch (std::exception& ex) {
+        LOG_ERROR << ex.what();
+    }
+}
+
 std::uint32_t Column::loadLobChunkHeader(
         std::uint64_t blockId, std::uint32_t offset, LobChunkHeader& header)
 {
-    std::lock_guard lock(m_mutex);
     auto block = getExistingBlock(blockId);
     return loadLobChunkHeaderUnlocked(*block, offset, header);
 }
@@ -785,7 +772,6 @@ std::uint32_t Column::loadLobChunkHeader(
 void Column::readData(
         std::uint64_t blockId, std::uint32_t offset, void* buffer, std::size_t bufferSize)
 {
-    std::lock_guard lock(m_mutex);
     auto block = getExistingBlock(blockId);
     block->readData(buffer, bufferSize, offset);
 }
@@ -798,13 +784,20 @@ std::uint64_t Column::generateNextUserTrid()
                 m_id);
     }
 
-    if (m_masterColumnData->m_tridCounters->m_lastUserTrid
-            == std::numeric_limits<std::uint64_t>::max()) {
-        throwDatabaseError(
-                IOManagerMessageId::kErrorUserTridExhausted, getDatabaseName(), m_table.getName());
-    }
+    // Counter is never incremented past maximum value
+    auto& lastUserTrid = m_masterColumnData->m_lastUserTrid;
+    auto trid = lastUserTrid.load();
+    do {
+        if (trid == std::numeric_limits<std::uint64_t>::max()) {
+            throwDatabaseError(IOManagerMessageId::kErrorUserTridExhausted, getDatabaseName(),
+                    m_table.getName());
+        }
+    } while (!lastUserTrid.compare_exchange_weak(trid, trid + 1));
+    ++trid;
 
-    return ++m_masterColumnData->m_tridCounters->m_lastUserTrid;
+    if (SIODB_UNLIKELY(trid > m_masterColumnData->m_lastReservedUserTrid))
+        reserveUserTrids(trid);
+    return trid;
 }
 
 std::uint64_t Column::generateNextSystemTrid()
@@ -824,6 +817,45 @@ std::uint64_t Column::generateNextSystemTrid()
     return ++m_masterColumnData->m_tridCounters->m_lastSystemTrid;
 }
 
+std::optional<std::uint64_t> Column::getNonNullValueCount() const noexcept
+{
+    if (!m_regularColumnData) return std::nullopt;
+    const std::uint64_t count = m_regularColumnData->m_nonNullValueCount;
+    if (count == ValueCounters::kUnknownCount) return std::nullopt;
+    return count;
+}
+
+void Column::incrementNonNullValueCount() noexcept
+{
+    if (!m_regularColumnData) return;
+    std::lock_guard lock(m_regularColumnData->m_mutex);
+    if (invalidateStoredValueCounters()) ++m_regularColumnData->m_nonNullValueCount;
+}
+
+void Column::decrementNonNullValueCount() noexcept
+{
+    if (!m_regularColumnData) return;
+    std::lock_guard lock(m_regularColumnData->m_mutex);
+    if (invalidateStoredValueCounters() && m_regularColumnData->m_nonNullValueCount > 0)
+        --m_regularColumnData->m_nonNullValueCount;
+}
+
+void Column::storeValueCounters()
+{
+    if (!m_regularColumnData) return;
+    auto& data = *m_regularColumnData;
+    std::lock_guard lock(data.m_mutex);
+    if (data.m_countersStored) return;
+    data.m_valueCounters->m_nonNullValueCount = data.m_nonNullValueCount.load();
+    if (::msync(data.m_file.getMappingAddress(), data.m_file.getMappingLength(), MS_SYNC) < 0) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteColumnCountersFile,
+                getDatabaseName(), m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(),
+                m_id, errorCode, std::strerror(errorCode));
+    }
+    data.m_countersStored = true;
+}
+
 void Column::setLastSystemTrid(std::uint64_t lastSystemTrid)
 {
     if (lastSystemTrid >= m_masterColumnData->m_firstUserTrid) {
@@ -893,6 +925,55 @@ int Column::openTridCountersFile()
     return fd.release();
 }
 
+int Column::createValueCountersFile(std::uint64_t nonNullValueCount)
+{
+    const auto valueCountersFilePath = utils::constructPath(m_dataDir, kValueCountersFile);
+    FileDescriptorGuard fd(::open(valueCountersFilePath.c_str(),
+            O_CREAT | O_RDWR | O_DSYNC | O_CLOEXEC, kDataFileCreationMode));
+    if (!fd.isValidFd()) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotCreateColumnCountersFile,
+                valueCountersFilePath, getDatabaseName(), m_table.getName(), m_name,
+                getDatabaseUuid(), m_table.getId(), m_id, errorCode, std::strerror(errorCode));
+    }
+    ValueCounters data(nonNullValueCount);
+    writeFullValueCounters(fd.getFd(), data);
+    return fd.release();
+}
+
+int Column::openValueCountersFile()
+{
+    const auto valueCountersFilePath = utils::constructPath(m_dataDir, kValueCountersFile);
+
+    // Column may be created before value counters were introduced.
+    // Number of values is not known in such case.
+    if (!fs::exists(valueCountersFilePath))
+        return createValueCountersFile(ValueCounters::kUnknownCount);
+
+    FileDescriptorGuard fd(::open(valueCountersFilePath.c_str(), O_RDWR | O_DSYNC | O_CLOEXEC));
+    if (!fd.isValidFd()) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotOpenColumnCountersFile,
+                valueCountersFilePath, getDatabaseName(), m_table.getName(), m_name,
+                getDatabaseUuid(), m_table.getId(), m_id, errorCode, std::strerror(errorCode));
+    }
+    ValueCounters data(0);
+    if (readExact(fd.getFd(), &data, sizeof(data), kIgnoreSignals) != sizeof(data)) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotReadColumnCountersFile,
+                getDatabaseName(), m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(),
+                m_id, errorCode, std::strerror(errorCode));
+    }
+    if (data.m_marker != ValueCounters::kMarker) {
+        // Counters are used only for optimization, so just invalidate them
+        LOG_WARNING << "Column " << getDisplayName() << ": value counters file is invalid, "
+                    << "resetting counters";
+        ValueCounters unknownData(ValueCounters::kUnknownCount);
+        writeFullValueCounters(fd.getFd(), unknownData);
+    }
+    return fd.release();
+}
+
 void Column::loadMasterColumnMainIndex()
 {
     if (m_masterColumnData->m_mainIndex) {
@@ -1054,15 +1135,62 @@ ColumnDefinitionPtr Column::createColumnDefinitionUnlocked(
 
 ColumnDataBlockPtr Column::loadBlock(std::uint64_t blockId)
 {
-    std::lock_guard lock(m_mutex);
-    auto block = m_blockCache.get(blockId).value_or(nullptr);
-    if (!block) {
-        block = std::make_shared<ColumnDataBlock>(*this, blockId);
-        m_blockCache.emplace(block->getId(), block);
+    auto& ioStatistics = getThreadIoStatistics();
+    {
+        std::lock_guard lock(m_blockCacheMutex);
+        auto block = m_blockCache.get(blockId).value_or(nullptr);
+        if (block) {
+            ++ioStatistics.m_blockCacheHitCount;
+            return block;
+        }
     }
+
+    // Open block without holding cache lock, because opening block needs column lock,
+    // and writer may be already holding column lock and waiting for the cache lock.
+    auto block = std::make_shared<ColumnDataBlock>(*this, blockId);
+    ++ioStatistics.m_blockCacheMissCount;
+    std::lock_guard lock(m_blockCacheMutex);
+    // Other reader could open the same block meanwhile, use single instance
+    auto cachedBlock = m_blockCache.get(blockId).value_or(nullptr);
+    if (cachedBlock) return cachedBlock;
+    m_blockCache.emplace(block->getId(), block);
     return block;
 }
 
+void Column::addUnflushedBlock(std::uint64_t blockId)
+{
+    std::lock_guard lock(m_blockCacheMutex);
+    m_unflushedBlockIds.insert(blockId);
+}
+
+void Column::flushBlocks()
+{
+    std::vector<ColumnDataBlockPtr> blocks;
+    {
+        std::lock_guard lock(m_blockCacheMutex);
+        blocks.reserve(m_unflushedBlockIds.size());
+        for (const auto blockId : m_unflushedBlockIds) {
+            // Evicted block is flushed on destruction
+            auto block = m_blockCache.get(blockId).value_or(nullptr);
+            if (block) blocks.push_back(std::move(block));
+        }
+        m_unflushedBlockIds.clear();
+    }
+
+    // Flush without holding cache lock, because writer takes cache lock
+    // while holding block data latch.
+    try {
+        for (const auto& block : blocks)
+            block->flushData();
+    } catch (...) {
+        // Keep failed blocks registered, so that next flush retries them
+        std::lock_guard lock(m_blockCacheMutex);
+        for (const auto& block : blocks)
+            m_unflushedBlockIds.insert(block->getId());
+        throw;
+    }
+}
+
 ColumnDataBlockPtr Column::selectAvailableBlock(std::size_t requiredLength)
 {
     // If there are no available blocks, just create new one
@@ -1141,7 +1269,11 @@ ColumnDataBlockPtr Column::createOrGetNextBlock(
     if (prevBlockId == 0)
         prevBlockDigest = ColumnDataBlockHeader::kInitialPrevBlockDigest;
     else {
-        auto prevBlock = m_blockCache.get(prevBlockId).value_or(nullptr);
+        ColumnDataBlockPtr prevBlock;
+        {
+            std::lock_guard lock(m_blockCacheMutex);
+            prevBlock = m_blockCache.get(prevBlockId).value_or(nullptr);
+        }
         if (!prevBlock) {
             throwDatabaseError(IOManagerMessageId::kErrorColumnDataBlockNotAvailable,
                     getDatabaseName(), m_table.getName(), m_name, prevBlockId, getDatabaseUuid(),
@@ -1353,6 +1485,167 @@ std::pair<ColumnDataAddress, ColumnDataAddress> Column::storeBuffer(
     return std::make_pair(result, ColumnDataAddress(block->getId(), block->getNextDataPos()));
 }
 
+Variant Column::convertValue(Variant& value) const
+{
+    Variant v;
+    try {
+        // Cast value to column data type
+        switch (m_dataType) {
+            case COLUMN_DATA_TYPE_BOOL: {
+                if (value.getValueType() != VariantType::kBool) v = value.asBool();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_INT8: {
+                if (value.getValueType() != VariantType::kInt8) v = value.asInt8();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_UINT8: {
+                if (value.getValueType() != VariantType::kUInt8) v = value.asUInt8();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_INT16: {
+                if (value.getValueType() != VariantType::kInt16) v = value.asInt16();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_UINT16: {
+                if (value.getValueType() != VariantType::kUInt16) v = value.asUInt16();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_INT32: {
+                if (value.getValueType() != VariantType::kInt32) v = value.asInt32();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_UINT32: {
+                if (value.getValueType() != VariantType::kUInt32) v = value.asUInt32();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_INT64: {
+                if (value.getValueType() != VariantType::kInt64) v = value.asInt64();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_UINT64: {
+                if (value.getValueType() != VariantType::kUInt64) v = value.asUInt64();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_FLOAT: {
+                if (value.getValueType() != VariantType::kFloat) v = value.asFloat();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_DOUBLE: {
+                if (value.getValueType() != VariantType::kDouble) v = value.asDouble();
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_TEXT: {
+                switch (value.getValueType()) {
+                    case VariantType::kString:
+                    case VariantType::kClob: break;
+                    case VariantType::kBinary: {
+                        if (value.getBinary().size() <= kMaxStringLength / 2)
+                            v = value.asString().release();
+                        else
+                            v = value.asClob().release();
+                        break;
+                    }
+                    case VariantType::kBlob: {
+                        if (value.getBlob().getRemainingSize() > kMaxClobLength / 2)
+                            throw std::logic_error("BLOB is too long");
+                        v = value.asClob().release();
+                        break;
+                    }
+                    default: {
+                        v = value.asString().release();
+                        break;
+                    }
+                }
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_BINARY: {
+                switch (value.getValueType()) {
+                    case VariantType::kBinary:
+                    case VariantType::kBlob: break;
+                    case VariantType::kClob: {
+                        v = value.asBlob().release();
+                        break;
+                    }
+                    default: {
+                        v = value.asBinary().release();
+                        break;
+                    }
+                }
+                break;
+            }
+
+            case COLUMN_DATA_TYPE_TIMESTAMP: {
+                if (value.getValueType() != VariantType::kDateTime) v = value.asDateTime();
+                break;
+            }
+
+            default: throw std::logic_error("invalid data type");
+        }  // switch
+    } catch (VariantTypeCastError& ex) {
+        throwDatabaseError(IOManagerMessageId::kErrorIncompatibleDataType, getDatabaseName(),
+                m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id,
+                static_cast<int>(ex.getDestValueType()), static_cast<int>(ex.getSourceValueType()));
+    } catch (std::logic_error&) {
+        throwDatabaseError(IOManagerMessageId::kErrorIncompatibleDataType2, getDatabaseName(),
+                m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id,
+                static_cast<int>(m_dataType), static_cast<int>(value.getValueType()));
+    }
+
+    // If no data so far, take value from origin.
+    if (v.isNull()) v.swap(value);
+    return v;
+}
+
+std::uint32_t Column::getRequiredRecordLength() const noexcept
+{
+    return m_dataType == COLUMN_DATA_TYPE_TIMESTAMP ? kTimestampRecordLength
+                                                     : m_minRequiredBlockFreeSpaces[m_dataType];
+}
+
+std::uint8_t* Column::serializeFixedSizeValue(const Variant& v, std::uint8_t* buffer) const
+{
+    switch (m_dataType) {
+        case COLUMN_DATA_TYPE_BOOL: {
+            *buffer = v.getBool() ? 1 : 0;
+            return buffer + 1;
+        }
+        case COLUMN_DATA_TYPE_INT8: {
+            *buffer = static_cast<std::uint8_t>(v.getInt8());
+            return buffer + 1;
+        }
+        case COLUMN_DATA_TYPE_UINT8: {
+            *buffer = v.getUInt8();
+            return buffer + 1;
+        }
+        case COLUMN_DATA_TYPE_INT16: return ::pbeEncodeInt16(v.getInt16(), buffer);
+        case COLUMN_DATA_TYPE_UINT16: return ::pbeEncodeUInt16(v.getUInt16(), buffer);
+        case COLUMN_DATA_TYPE_INT32: return ::pbeEncodeInt32(v.getInt32(), buffer);
+        case COLUMN_DATA_TYPE_UINT32: return ::pbeEncodeUInt32(v.getUInt32(), buffer);
+        case COLUMN_DATA_TYPE_INT64: return ::pbeEncodeInt64(v.getInt64(), buffer);
+        case COLUMN_DATA_TYPE_UINT64: return ::pbeEncodeUInt64(v.getUInt64(), buffer);
+        case COLUMN_DATA_TYPE_FLOAT: return ::pbeEncodeFloat(v.getFloat(), buffer);
+        case COLUMN_DATA_TYPE_DOUBLE: return ::pbeEncodeDouble(v.getDouble(), buffer);
+        case COLUMN_DATA_TYPE_TIMESTAMP: return v.getDateTime().serialize(buffer);
+        default: {
+            // Should never happen, but make compiler happy
+            throw std::logic_error("invalid data type");
+        }
+    }
+}
+
 void Column::loadText(const ColumnDataAddress& addr, Variant& value, bool lobStreamsMustHoldSource)
 {
     auto block = getExistingBlock(addr.getBlockId());
@@ -1427,7 +1720,8 @@ std::uint32_t Column::loadLobChunkHeaderUnlocked(
                 m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id, block.getId(),
                 offset, "chunk length is greater than available data in the block");
     }
-    if (chunkHeader.m_nextChunkBlockId > m_blockRegistry.getLastBlockId()) {
+    // Block registry is guarded by column lock, use atomic counter of block IDs instead
+    if (chunkHeader.m_nextChunkBlockId > m_lastBlockId.load()) {
         throwDatabaseError(IOManagerMessageId::kErrorInvalidLobChunkHeader, getDatabaseName(),
                 m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id, block.getId(),
                 offset, "invalid next chunk block ID");
@@ -1492,6 +1786,55 @@ void Column::writeFullTridCounters(int fd, const TridCounters& data)
     }
 }
 
+void Column::reserveUserTrids(std::uint64_t trid)
+{
+    auto& data = *m_masterColumnData;
+    std::lock_guard lock(data.m_tridReservationMutex);
+    // Other thread could already reserve range which includes this TRID
+    if (trid <= data.m_lastReservedUserTrid) return;
+    const auto lastReservedUserTrid =
+            trid > std::numeric_limits<std::uint64_t>::max() - kUserTridReservationSize
+                    ? std::numeric_limits<std::uint64_t>::max()
+                    : trid + kUserTridReservationSize - 1;
+    data.m_tridCounters->m_lastUserTrid = lastReservedUserTrid;
+    if (::msync(data.m_file.getMappingAddress(), data.m_file.getMappingLength(), MS_SYNC) < 0) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteTridCounterFile, getDatabaseName(),
+                m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(), m_id, errorCode,
+                std::strerror(errorCode));
+    }
+    // Range can be used only when it is durable
+    data.m_lastReservedUserTrid = lastReservedUserTrid;
+}
+
+bool Column::invalidateStoredValueCounters() noexcept
+{
+    auto& data = *m_regularColumnData;
+    if (data.m_nonNullValueCount == ValueCounters::kUnknownCount) return false;
+    if (!data.m_countersStored) return true;
+    data.m_valueCounters->m_nonNullValueCount = ValueCounters::kUnknownCount;
+    if (::msync(data.m_file.getMappingAddress(), data.m_file.getMappingLength(), MS_SYNC) < 0) {
+        // Counters are used only for optimization, so just stop maintaining them
+        const auto errorCode = errno;
+        LOG_ERROR << "Column " << getDisplayName()
+                  << ": Can't write value counters: " << std::strerror(errorCode);
+        data.m_nonNullValueCount = ValueCounters::kUnknownCount;
+        return false;
+    }
+    data.m_countersStored = false;
+    return true;
+}
+
+void Column::writeFullValueCounters(int fd, const ValueCounters& data)
+{
+    if (::pwriteExact(fd, &data, sizeof(data), 0, kIgnoreSignals) != ValueCounters::kDataSize) {
+        const auto errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteColumnCountersFile,
+                getDatabaseName(), m_table.getName(), m_name, getDatabaseUuid(), m_table.getId(),
+                m_id, errorCode, std::strerror(errorCode));
+    }
+}
+
 std::string Column::composeMasterColumnMainIndexName() const
 {
     std::ostringstream oss;
@@ -1573,6 +1916,12 @@ std::unique_ptr<Column::MasterColumnData> Column::maybeCreateMasterColumnData(
     return std::make_unique<MasterColumnData>(*this, create, firstUserTrid);
 }
 
+std::unique_ptr<Column::RegularColumnData> Column::maybeCreateRegularColumnData(bool create)
+{
+    if (isMasterColumnName()) return nullptr;
+    return std::make_unique<RegularColumnData>(*this, create);
+}
+
 /////////////////// struct Column::MasterColumnData ///////////////////////////////////////////////
 
 Column::MasterColumnData::MasterColumnData(
@@ -1582,7 +1931,41 @@ Column::MasterColumnData::MasterColumnData(
                             : parent.openTridCountersFile(),
               true, PROT_READ | PROT_WRITE, MAP_POPULATE, 0, sizeof(DatabaseMetadata))
     , m_tridCounters(reinterpret_cast<TridCounters*>(m_file.getMappingAddress()))
+    , m_lastUserTrid(m_tridCounters->m_lastUserTrid.load())
+    , m_lastReservedUserTrid(m_lastUserTrid.load())
+{
+}
+
+Column::MasterColumnData::~MasterColumnData()
 {
+    // Unused part of the reserved range is returned on clean shutdown
+    m_tridCounters->m_lastUserTrid = m_lastUserTrid.load();
+    if (::msync(m_file.getMappingAddress(), m_file.getMappingLength(), MS_SYNC) < 0) {
+        const auto errorCode = errno;
+        LOG_ERROR << "Can't write TRID counters: " << std::strerror(errorCode);
+    }
+}
+
+/////////////////// struct Column::RegularColumnData //////////////////////////////////////////////
+
+Column::RegularColumnData::RegularColumnData(Column& parent, bool createCounters)
+    : m_file(createCounters ? parent.createValueCountersFile(0) : parent.openValueCountersFile(),
+              true, PROT_READ | PROT_WRITE, MAP_POPULATE, 0, sizeof(ValueCounters))
+    , m_valueCounters(reinterpret_cast<ValueCounters*>(m_file.getMappingAddress()))
+    , m_nonNullValueCount(m_valueCounters->m_nonNullValueCount.load())
+    , m_countersStored(true)
+{
+}
+
+Column::RegularColumnData::~RegularColumnData()
+{
+    // Column data blocks are already flushed, so current counters are valid on clean shutdown
+    if (m_countersStored) return;
+    m_valueCounters->m_nonNullValueCount = m_nonNullValueCount.load();
+    if (::msync(m_file.getMappingAddress(), m_file.getMappingLength(), MS_SYNC) < 0) {
+        const auto errorCode = errno;
+        LOG_ERROR << "Can't write column value counters: " << std::strerror(errorCode);
+    }
 }
 
 }  // namespace siodb::iomgr::dbengine
@@ -11,6 +11,7 @@
 #include "ColumnPtr.h"
 #include "IndexPtr.h"
 #include "MasterColumnRecord.h"
+#include "MasterColumnRecordPtr.h"
 #include "Table.h"
 
 // Common project headers
@@ -19,7 +20,10 @@
 // STL headers
 #include <array>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace siodb::iomgr::dbengine {
 
@@ -285,7 +289,8 @@ public:
     void updateBlockState(std::uint64_t blockId, ColumnDataBlockState state) const;
 
     /**
-     * Read data from the data file.
+     * Read data from the data file. Doesn't acquire column lock, so that readers
+     * don't wait for the writer, unless they read the block being appended.
      * @param addr Data address.
      * @param value Resulting value.
      * @param lobStreamsMustHoldSource Flag indicates that data source must be hold by any
@@ -295,12 +300,24 @@ public:
             const ColumnDataAddress& addr, Variant& value, bool lobStreamsMustHoldSource = true);
 
     /**
-     * Read master column record from the data file.
+     * Read master column record from the data file. Doesn't acquire column lock.
      * @param addr Data address.
      * @param record Resulting value.
      */
     void readMasterColumnRecord(const ColumnDataAddress& addr, MasterColumnRecord& record);
 
+    /**
+     * Registers data block which has written data not yet flushed to disk.
+     * @param blockId Block ID.
+     */
+    void addUnflushedBlock(std::uint64_t blockId);
+
+    /**
+     * Flushes data of all blocks which have written data not yet flushed to disk.
+     * @throw DatabaseError if flush fails.
+     */
+    void flushBlocks();
+
     /**
      * Adds new data to a column.
      * @param value A value to put. May be altered by this function.
@@ -308,6 +325,15 @@ public:
      */
     std::pair<ColumnDataAddress, ColumnDataAddress> putRecord(Variant&& value);
 
+    /**
+     * Adds new data to a column. Consecutive values are written to the data blocks at once.
+     * If operation fails, all values are rolled back.
+     * @param values Values to put. May be altered by this function.
+     * @return Pairs containing data address and next data address for each value.
+     */
+    std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>> putRecords(
+            std::vector<Variant>& values);
+
     /**
      * Adds new data to a master column.
      * @param record Master column record.
@@ -316,6 +342,14 @@ public:
     std::pair<ColumnDataAddress, ColumnDataAddress> putMasterColumnRecord(
             const MasterColumnRecord& record);
 
+    /**
+     * Adds new master column records of the inserted rows to a master column.
+     * Records are written to the data blocks at once, then main index is updated.
+     * If operation fails, all records are rolled back.
+     * @param records Master column records.
+     */
+    void putMasterColumnRecords(const std::vector<MasterColumnRecordPtr>& records);
+
     /**
      * Erases TRID in the master column record main index
      * @param trid Table row ID
@@ -331,7 +365,16 @@ public:
             const ColumnDataAddress& addr, const std::uint64_t firstAvailableBlockId);
 
     /**
-     * Loads LOB chunk header.
+     * Rolls back records, which were added last. Errors are logged.
+     * @param records Pairs containing data address and next data address of the records.
+     * @param firstRecordIndex Index of the first record to roll back.
+     */
+    void rollbackRecords(
+            const std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>>& records,
+            std::size_t firstRecordIndex = 0);
+
+    /**
+     * Loads LOB chunk header. Doesn't acquire column lock.
      * @param blockId Data block ID.
      * @param offset Offset in the block.
      * @param[out] header Chunk header.
@@ -341,7 +384,7 @@ public:
             std::uint64_t blockId, std::uint32_t offset, LobChunkHeader& header);
 
     /**
-     * Reads data from block.
+     * Reads data from block. Doesn't acquire column lock.
      * @param blockId Block ID.
      * @param offset Offset in block.
      * @param[out] buffer Output buffer.
@@ -396,9 +439,28 @@ public:
      */
     std::uint64_t getLastUserTrid() const noexcept
     {
-        return m_masterColumnData->m_tridCounters->m_lastUserTrid;
+        return m_masterColumnData->m_lastUserTrid;
     }
 
+    /**
+     * Returns number of non-null values in the column.
+     * @return Number of non-null values or std::nullopt if it is not known,
+     *         for example, for the master column.
+     */
+    std::optional<std::uint64_t> getNonNullValueCount() const noexcept;
+
+    /** Increments number of non-null values in the column, if it is known. */
+    void incrementNonNullValueCount() noexcept;
+
+    /** Decrements number of non-null values in the column, if it is known. */
+    void decrementNonNullValueCount() noexcept;
+
+    /**
+     * Stores value counters to disk. Must be called after column data is flushed.
+     * @throw DatabaseError if counters can't be written.
+     */
+    void storeValueCounters();
+
     /**
      * Creates new TRID counter file.
      * @param firstUserTrid First user TRID.
@@ -415,6 +477,20 @@ public:
     /** Loads master column main index */
     void loadMasterColumnMainIndex();
 
+    /**
+     * Creates new value counters file.
+     * @param nonNullValueCount Initial number of non-null values.
+     * @return File descriptor.
+     */
+    int createValueCountersFile(std::uint64_t nonNullValueCount);
+
+    /**
+     * Loads value counters from the existing file. Creates file with unknown counter values,
+     * if column data was created without it.
+     * @return File descriptor.
+     */
+    int openValueCountersFile();
+
 private:
     /** Data of the TRID counters */
     struct TridCounters {
@@ -432,7 +508,11 @@ private:
         /** Endianness marker */
         std::uint64_t m_marker;
 
-        /** User TRID counter */
+        /**
+         * Last reserved user TRID. User TRIDs are reserved in ranges and only end of the range
+         * is persisted, so after crash generation continues after the reserved range
+         * and unused TRIDs of the range are never assigned.
+         */
         std::atomic<std::uint64_t> m_lastUserTrid;
 
         /** System TRID counter */
@@ -455,6 +535,9 @@ private:
          */
         MasterColumnData(Column& parent, bool createCounters, std::uint64_t firstUserTrid);
 
+        /** De-initializes object of class MasterColumnData. */
+        ~MasterColumnData();
+
         /** First user range TRID */
         const std::uint64_t m_firstUserTrid;
 
@@ -466,8 +549,80 @@ private:
 
         /** TRID counters */
         TridCounters* const m_tridCounters;
+
+        /** Last generated user TRID */
+        std::atomic<std::uint64_t> m_lastUserTrid;
+
+        /**
+         * Last user TRID of the range which is reserved on disk. Updated only after
+         * TRID counters are synced, so that TRIDs are never given out of the range
+         * which is not durable yet.
+         */
+        std::atomic<std::uint64_t> m_lastReservedUserTrid;
+
+        /** User TRID range reservation synchronization object */
+        std::mutex m_tridReservationMutex;
+    };
+
+    /** Data of the column value counters */
+    struct ValueCounters {
+        /**
+         * Initializes obejct of class ValueCounters.
+         * @param nonNullValueCount Number of non-null values.
+         */
+        explicit ValueCounters(std::uint64_t nonNullValueCount) noexcept
+            : m_marker(kMarker)
+            , m_nonNullValueCount(nonNullValueCount)
+        {
+        }
+
+        /** Endianness marker */
+        std::uint64_t m_marker;
+
+        /** Number of non-null values */
+        std::atomic<std::uint64_t> m_nonNullValueCount;
+
+        /** Value counters file marker value */
+        static const std::uint64_t kMarker = 0x1234567890abcdef;
+
+        /** Counter value which indicates that actual value is not known */
+        static constexpr std::uint64_t kUnknownCount = std::numeric_limits<std::uint64_t>::max();
+
+        /** Counters data size */
+        static constexpr std::uint64_t kDataSize = 16;
+    };
+
+    /** Regular (non-master) column specific data. */
+    struct RegularColumnData {
+        /**
+         * Initializes object of class RegularColumnData.
+         * @param parent Parent column.
+         * @param createCounters Indicates that counters must be created
+         */
+        RegularColumnData(Column& parent, bool createCounters);
+
+        /** De-initializes object of class RegularColumnData. */
+        ~RegularColumnData();
+
+        /** Memory mapped file that holds counters */
+        MemoryMappedFile m_file;
+
+        /** Value counters stored on disk */
+        ValueCounters* const m_valueCounters;
+
+        /** Current number of non-null values */
+        std::atomic<std::uint64_t> m_nonNullValueCount;
+
+        /** Indicates that stored counters match column data on disk */
+        bool m_countersStored;
+
+        /** Counters synchronization object */
+        std::mutex m_mutex;
     };
 
+    /** Buffer for writing consecutive records to the data block */
+    class BlockWriteBuffer;
+
 private:
     /**
      * Returns indication that column name is master column name.
@@ -538,7 +693,8 @@ private:
     }
 
     /**
-     * Obtains existing column data block.
+     * Obtains existing column data block. Acquires only block cache lock,
+     * column lock is acquired only when block is not cached.
      * @param blockId Block ID.
      * @return Column data block object.
      */
@@ -627,6 +783,29 @@ private:
     std::pair<ColumnDataAddress, ColumnDataAddress> storeBuffer(
             const void* src, std::uint32_t length, ColumnDataBlockPtr block);
 
+    /**
+     * Converts value to the column data type.
+     * @param value A value. May be altered by this function.
+     * @return Converted value.
+     * @throw DatabaseError if value can't be converted.
+     */
+    Variant convertValue(Variant& value) const;
+
+    /**
+     * Returns length of the record, which is reserved in the data block.
+     * For the variable length data types, minimum required length is returned.
+     * @return Record length.
+     */
+    std::uint32_t getRequiredRecordLength() const noexcept;
+
+    /**
+     * Serializes value of the fixed size data type.
+     * @param v A value converted to the column data type.
+     * @param buffer Output buffer, must have at least kMaxFixedSizeRecordLength bytes.
+     * @return Address after the last written byte.
+     */
+    std::uint8_t* serializeFixedSizeValue(const Variant& v, std::uint8_t* buffer) const;
+
     /**
      * Loads TEXT data.
      * @param addr Data address.
@@ -668,6 +847,29 @@ private:
      */
     void writeFullTridCounters(int fd, const TridCounters& data);
 
+    /**
+     * Reserves next range of user TRIDs which includes given TRID
+     * and writes TRID counters to disk.
+     * @param trid User TRID.
+     * @throw DatabaseError if TRID counters can't be written.
+     */
+    void reserveUserTrids(std::uint64_t trid);
+
+    /**
+     * Invalidates stored value counters before the first change after they were stored,
+     * so that counters are valid after crash only if they match column data on disk.
+     * Must be called with counters mutex locked.
+     * @return true if counters can be changed, false if they are not known anymore.
+     */
+    bool invalidateStoredValueCounters() noexcept;
+
+    /**
+     * Writes full content of the value counters file.
+     * @param fd File descriptor.
+     * @param data Value counters data.
+     */
+    void writeFullValueCounters(int fd, const ValueCounters& data);
+
     /**
      * Constructs master column main index name.
      * @return Master column main index name.
@@ -702,6 +904,13 @@ private:
     std::unique_ptr<MasterColumnData> maybeCreateMasterColumnData(
             bool create, std::uint64_t firstUserTrid);
 
+    /**
+     * Creates regular column data if applicable.
+     * @param create Indicates that regular column data must be created.
+     * @return Regular column data if this is not master column, nullptr otherwise.
+     */
+    std::unique_ptr<RegularColumnData> maybeCreateRegularColumnData(bool create);
+
 private:
     /** Table to which this column belongs */
     Table& m_table;
@@ -721,7 +930,10 @@ private:
     /** Data block data size */
     const std::uint32_t m_dataBlockDataAreaSize;
 
-    /** Persistent info access synchronizarion object */
+    /**
+     * Persistent info access synchronizarion object. Serializes writers,
+     * readers of data blocks don't acquire it.
+     */
     mutable std::recursive_mutex m_mutex;
 
     /** Column data directory */
@@ -730,6 +942,9 @@ private:
     /** Master column specific data */
     const std::unique_ptr<MasterColumnData> m_masterColumnData;
 
+    /** Regular column specific data */
+    const std::unique_ptr<RegularColumnData> m_regularColumnData;
+
     /** Column definition cache */
     ColumnDefinitionCache m_columnDefinitionCache;
 
@@ -758,12 +973,24 @@ private:
     /** Last block ID */
     std::atomic<std::uint64_t> m_lastBlockId;
 
+    /** Block cache synchronization object */
+    std::mutex m_blockCacheMutex;
+
     /** Cached blocks */
     ColumnDataBlockCache m_blockCache;
 
+    /** IDs of blocks with unflushed data. Guarded by the block cache mutex. */
+    std::unordered_set<std::uint64_t> m_unflushedBlockIds;
+
     /** Minimum required block free spaces for various column data type */
     static const std::array<std::uint32_t, ColumnDataType_MAX> m_minRequiredBlockFreeSpaces;
 
+    /** Length of the TIMESTAMP record in the data block */
+    static constexpr std::uint32_t kTimestampRecordLength = 12;
+
+    /** Maximum length of the fixed size data type record */
+    static constexpr std::uint32_t kMaxFixedSizeRecordLength = 12;
+
     /** Well known ignorable files during consistency check */
     static const std::unordered_set<std::string> m_wellKnownIgnorableFiles;
 
@@ -782,9 +1009,15 @@ private:
     /** TRID counter file name */
     static constexpr const char* kTridCounterFile = "trid";
 
+    /** Value counters file name */
+    static constexpr const char* kValueCountersFile = "counters";
+
     /** TRID counter migration file extension */
     static constexpr const char* kTridCounterMigrationFileExt = ".mig";
 
+    /** Number of user TRIDs reserved at once */
+    static constexpr std::uint64_t kUserTridReservationSize = 4096;
+
     /** Master column main index key size */
     static constexpr std::size_t kMasterColumnNameMainIndexKeySize = 8;
 
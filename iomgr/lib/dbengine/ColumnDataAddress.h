@@ -59,6 +59,18 @@ public:
         return m_offset;
     }
 
+    /**
+     * Compares this address with other one, block ID first.
+     * @param other Other address.
+     * @return Negative value if this address is less than other one,
+     *         zero if they are equal, positive value otherwise.
+     */
+    int compareTo(const ColumnDataAddress& other) const noexcept
+    {
+        const auto result = utils::compare3way(m_blockId, other.m_blockId);
+        return result == 0 ? utils::compare3way(m_offset, other.m_offset) : result;
+    }
+
     /**
      * Returns indication that address is null value address.
      * @return true if address is null value address, false otherwise.
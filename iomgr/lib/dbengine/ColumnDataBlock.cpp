@@ -6,6 +6,7 @@
 
 // Project headers
 #include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "IoStatistics.h"
 #include "ThrowDatabaseError.h"
 
 // Common project headers
@@ -25,6 +26,7 @@
 
 // STL headers
 #include <sstream>
+#include <utility>
 
 // System headers
 #include <sys/stat.h>
@@ -44,10 +46,12 @@ ColumnDataBlock::ColumnDataBlock(
               m_column.generateNextBlockId(), column.getDataBlockDataAreaSize())
     , m_prevBlockId(prevBlockId)
     , m_dataFilePath(makeDataFilePath())
+    , m_writeThrough(column.getTable().isSystemTable())
     , m_file(createDataFile())
     , m_state(state)
     , m_headerModified(false)
     , m_dataModified(false)
+    , m_sealed(false)
 {
     loadHeader();
 }
@@ -58,12 +62,16 @@ ColumnDataBlock::ColumnDataBlock(Column& column, std::uint64_t id)
               column.getDataBlockDataAreaSize())
     , m_prevBlockId(column.getPrevBlockId(id))
     , m_dataFilePath(makeDataFilePath())
+    , m_writeThrough(column.getTable().isSystemTable())
     , m_file(openDataFile())
     , m_state(ColumnDataBlockState::kCreating)
     , m_headerModified(false)
     , m_dataModified(false)
+    , m_sealed(false)
 {
     loadHeader();
+    // Fill timestamp is set only when block is finalized
+    m_sealed = m_header.m_fillTimestamp != 0;
 }
 
 ColumnDataBlock::~ColumnDataBlock()
@@ -99,12 +107,17 @@ void ColumnDataBlock::readData(void* data, std::size_t length, std::uint32_t pos
                                  << ", " << length);
     }
     const auto readOffset = pos + m_header.m_dataAreaOffset;
+    std::shared_lock lock(m_dataLatch, std::defer_lock);
+    if (!m_sealed.load(std::memory_order_acquire)) lock.lock();
     if (m_file->read(static_cast<std::uint8_t*>(data), length, readOffset) != length) {
         throwDatabaseError(IOManagerMessageId::kErrorCannotReadColumnDataBlockFile,
                 m_column.getDatabaseName(), m_column.getTableName(), m_column.getName(), getId(),
                 m_column.getDatabaseUuid(), m_column.getTableId(), m_column.getId(), readOffset,
                 length, m_file->getLastError(), std::strerror(m_file->getLastError()));
     }
+    auto& ioStatistics = getThreadIoStatistics();
+    ++ioStatistics.m_readCount;
+    ioStatistics.m_readByteCount += length;
 }
 
 void ColumnDataBlock::writeData(const void* data, std::size_t length, std::uint32_t pos)
@@ -116,13 +129,28 @@ void ColumnDataBlock::writeData(const void* data, std::size_t length, std::uint3
                                  << ", " << length);
     }
     const auto writeOffset = pos + m_header.m_dataAreaOffset;
+    std::lock_guard lock(m_dataLatch);
     if (m_file->write(static_cast<const std::uint8_t*>(data), length, writeOffset) != length) {
         throwDatabaseError(IOManagerMessageId::kErrorCannotWriteColumnDataBlockFile,
                 m_column.getDatabaseName(), m_column.getTableName(), m_column.getName(), getId(),
                 m_column.getDatabaseUuid(), m_column.getTableId(), m_column.getId(), writeOffset,
                 length, m_file->getLastError(), std::strerror(m_file->getLastError()));
     }
-    m_dataModified = true;
+    const bool wasModified = std::exchange(m_dataModified, true);
+    if (!wasModified && !m_writeThrough) m_column.addUnflushedBlock(getId());
+}
+
+void ColumnDataBlock::flushData()
+{
+    std::lock_guard lock(m_dataLatch);
+    if (!m_dataModified || m_writeThrough) return;
+    if (!m_file->flush()) {
+        throwDatabaseError(IOManagerMessageId::kErrorCannotFlushColumnDataBlockFile,
+                m_column.getDatabaseName(), m_column.getTableName(), m_column.getName(), getId(),
+                m_column.getDatabaseUuid(), m_column.getTableId(), m_column.getId(),
+                m_file->getLastError(), std::strerror(m_file->getLastError()));
+    }
+    m_dataModified = false;
 }
 
 void ColumnDataBlock::finalize(const ColumnDataBlockHeader::Digest& prevBlockDigest)
@@ -135,6 +163,7 @@ void ColumnDataBlock::finalize(const ColumnDataBlockHeader::Digest& prevBlockDig
     saveHeader();
     m_state = ColumnDataBlockState::kClosed;
     m_column.updateBlockState(getId(), m_state);
+    m_sealed.store(true, std::memory_order_release);
 }
 
 void ColumnDataBlock::computeDigest(const ColumnDataBlockHeader::Digest& prevBlockDigest,
@@ -181,7 +210,7 @@ io::FilePtr ColumnDataBlock::createDataFile() const
     std::string tmpFilePath;
 
     // Create data file as temporary file
-    constexpr int kBaseExtraOpenFlags = O_DSYNC;
+    const int kBaseExtraOpenFlags = m_writeThrough ? O_DSYNC : 0;
     io::FilePtr file;
     try {
         try {
@@ -256,7 +285,7 @@ io::FilePtr ColumnDataBlock::openDataFile() const
 {
     io::FilePtr file;
     try {
-        file = m_column.getDatabase().openFile(m_dataFilePath, O_DSYNC);
+        file = m_column.getDatabase().openFile(m_dataFilePath, m_writeThrough ? O_DSYNC : 0);
     } catch (std::system_error& ex) {
         throwDatabaseError(IOManagerMessageId::kErrorCannotOpenColumnDataBlockFile, m_dataFilePath,
                 m_column.getDatabaseName(), m_column.getTableName(), m_column.getName(), getId(),
@@ -14,6 +14,10 @@
 #include <siodb/common/utils/FileDescriptorGuard.h>
 #include <siodb/common/utils/HelperMacros.h>
 
+// STL headers
+#include <atomic>
+#include <shared_mutex>
+
 namespace siodb::iomgr::dbengine {
 
 /** Column data block */
@@ -170,17 +174,19 @@ public:
         return m_header.m_nextDataOffset;
     }
 
-    /** Resets fill timestemp to zero */
+    /** Resets fill timestemp to zero. Block becomes open for appending again. */
     void resetFillTimestamp() noexcept
     {
         m_header.m_fillTimestamp = 0;
+        m_sealed.store(false, std::memory_order_release);
     }
 
     /** Saves header */
     void saveHeader() const;
 
     /**
-     * Reads data from the data file at a given position.
+     * Reads data from the data file at a given position. Finalized block is read without
+     * latching, otherwise data latch is acquired in shared mode.
      * @param[out] data A data.
      * @param length Data length.
      * @param pos Data position.
@@ -188,7 +194,7 @@ public:
     void readData(void* data, std::size_t length, std::uint32_t pos) const;
 
     /**
-     * Writes data to the data file at a given position.
+     * Writes data to the data file at a given position. Acquires data latch exclusively.
      * @param data A data.
      * @param length Data length.
      * @param pos Data position.
@@ -224,6 +230,13 @@ public:
         writeData(buffer.data(), buffer.size(), m_header.m_nextDataOffset);
     }
 
+    /**
+     * Flushes written data to disk. Blocks of the user tables are written without
+     * synchronous I/O, so that transaction pays for single flush on commit.
+     * @throw DatabaseError if flush fails.
+     */
+    void flushData();
+
     /**
      * Finalizes block - put fill timestamp and adds data digest.
      * @param prevBlockDigest Digest of a previous block.
@@ -278,6 +291,9 @@ private:
     /** Column block data file path */
     const std::string m_dataFilePath;
 
+    /** Indicates that data file is written with synchronous I/O */
+    const bool m_writeThrough;
+
     /** Block file */
     io::FilePtr m_file;
 
@@ -290,6 +306,12 @@ private:
     /** Indicates that data of the block is been modified */
     bool m_dataModified;
 
+    /** Data latch, protects data being appended from concurrent readers */
+    mutable std::shared_mutex m_dataLatch;
+
+    /** Indicates that block is finalized and its data is immutable */
+    std::atomic<bool> m_sealed;
+
     /** Data file header prototype */
     static const BinaryValue m_dataFileHeaderProto;
 };
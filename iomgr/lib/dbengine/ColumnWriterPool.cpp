@@ -0,0 +1,182 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "ColumnWriterPool.h"
+
+// Project headers
+#include "Column.h"
+
+// Common project headers
+#include <siodb/common/log/Log.h>
+
+// STL headers
+#include <algorithm>
+
+namespace siodb::iomgr::dbengine {
+
+class ColumnWriterPool::Completion final {
+public:
+    /**
+     * Initializes object of class Completion.
+     * @param writeCount Number of writes in the group.
+     */
+    explicit Completion(std::size_t writeCount) noexcept
+        : m_remainingWriteCount(writeCount)
+    {
+    }
+
+    /** Marks one write of the group as finished. */
+    void notify()
+    {
+        std::lock_guard lock(m_mutex);
+        if (--m_remainingWriteCount == 0) m_cond.notify_one();
+    }
+
+    /** Waits until all writes of the group are finished. */
+    void wait()
+    {
+        std::unique_lock lock(m_mutex);
+        m_cond.wait(lock, [this] { return m_remainingWriteCount == 0; });
+    }
+
+private:
+    /** Synchronization object */
+    std::mutex m_mutex;
+
+    /** Completion condition */
+    std::condition_variable m_cond;
+
+    /** Number of writes which are not finished yet */
+    std::size_t m_remainingWriteCount;
+};
+
+class ColumnWriterPool::Writer final {
+public:
+    /**
+     * Initializes object of class Writer and starts writer thread.
+     * @param writerId Writer ID.
+     */
+    explicit Writer(std::size_t writerId)
+        : m_writerId(writerId)
+        , m_stop(false)
+        , m_thread(&Writer::threadMain, this)
+    {
+    }
+
+    /** Stops writer thread. */
+    ~Writer()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_one();
+        m_thread.join();
+    }
+
+    DECLARE_NONCOPYABLE(Writer);
+
+    /**
+     * Adds write to the queue.
+     * @param write A write.
+     */
+    void enqueue(const QueuedWrite& write)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_queue.push_back(write);
+        }
+        m_cond.notify_one();
+    }
+
+private:
+    /** Writer thread main function. */
+    void threadMain()
+    {
+        LOG_DEBUG << "Column writer #" << m_writerId << " started";
+        std::vector<QueuedWrite> writes;
+        while (true) {
+            {
+                std::unique_lock lock(m_mutex);
+                m_cond.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty()) break;
+                writes.assign(m_queue.cbegin(), m_queue.cend());
+                m_queue.clear();
+            }
+            for (const auto& write : writes)
+                executeWrite(write);
+            writes.clear();
+        }
+        LOG_DEBUG << "Column writer #" << m_writerId << " finished";
+    }
+
+    /**
+     * Executes single write.
+     * @param write A write.
+     */
+    static void executeWrite(const QueuedWrite& write)
+    {
+        try {
+            write.m_write->m_records = write.m_write->m_column.putRecords(write.m_write->m_values);
+        } catch (...) {
+            write.m_write->m_error = std::current_exception();
+        }
+        write.m_completion->notify();
+    }
+
+private:
+    /** Writer ID */
+    const std::size_t m_writerId;
+
+    /** Queue access synchronization object */
+    std::mutex m_mutex;
+
+    /** Queue state change condition */
+    std::condition_variable m_cond;
+
+    /** Queued writes */
+    std::deque<QueuedWrite> m_queue;
+
+    /** Stop flag */
+    bool m_stop;
+
+    /** Writer thread */
+    std::thread m_thread;
+};
+
+ColumnWriterPool::ColumnWriterPool(std::size_t threadCount)
+{
+    threadCount = std::max(threadCount, static_cast<std::size_t>(1));
+    m_writers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        m_writers.push_back(std::make_unique<Writer>(i + 1));
+}
+
+ColumnWriterPool::~ColumnWriterPool() = default;
+
+void ColumnWriterPool::write(std::vector<ColumnWrite>& writes)
+{
+    if (writes.empty()) return;
+
+    // Columns of the same table have consecutive IDs, so they are spread evenly
+    Completion completion(writes.size());
+    std::size_t queuedWriteCount = 0;
+    try {
+        for (auto& write : writes) {
+            const auto writerIndex = (write.m_column.getTableId() + write.m_column.getId())
+                                     % m_writers.size();
+            m_writers[writerIndex]->enqueue(QueuedWrite {&write, &completion});
+            ++queuedWriteCount;
+        }
+    } catch (...) {
+        // Completion must outlive writes which are already queued
+        for (auto i = queuedWriteCount; i < writes.size(); ++i)
+            completion.notify();
+        completion.wait();
+        throw;
+    }
+    completion.wait();
+}
+
+}  // namespace siodb::iomgr::dbengine
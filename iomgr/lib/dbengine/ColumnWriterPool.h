@@ -0,0 +1,109 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "ColumnDataAddress.h"
+#include "Variant.h"
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace siodb::iomgr::dbengine {
+
+class Column;
+
+/** Values to append to a single column and result of the operation */
+struct ColumnWrite {
+    /**
+     * Initializes object of class ColumnWrite.
+     * @param column A column.
+     * @param values Values to append.
+     */
+    ColumnWrite(Column& column, std::vector<Variant>&& values) noexcept
+        : m_column(column)
+        , m_values(std::move(values))
+    {
+    }
+
+    /** Column */
+    Column& m_column;
+
+    /** Values to append, may be altered by the write */
+    std::vector<Variant> m_values;
+
+    /** Data address and next data address of each value, if write succeeded */
+    std::vector<std::pair<ColumnDataAddress, ColumnDataAddress>> m_records;
+
+    /** Error, if write failed. Failed write leaves no records in the column. */
+    std::exception_ptr m_error;
+};
+
+/**
+ * Pool of the column writer threads. Appends to each column are executed
+ * by the single writer thread which owns the column, so that multi-row inserts
+ * write different columns in parallel. Writes to the same table are serialized
+ * by the table lock, so writes of the different callers are never merged.
+ */
+class ColumnWriterPool final {
+public:
+    /**
+     * Initializes object of class ColumnWriterPool and starts writer threads.
+     * @param threadCount Number of writer threads, at least 1 thread is started.
+     */
+    explicit ColumnWriterPool(std::size_t threadCount);
+
+    /** Stops writer threads. There must be no writes in progress. */
+    ~ColumnWriterPool();
+
+    DECLARE_NONCOPYABLE(ColumnWriterPool);
+
+    /**
+     * Returns number of writer threads.
+     * @return Number of writer threads.
+     */
+    std::size_t getThreadCount() const noexcept
+    {
+        return m_writers.size();
+    }
+
+    /**
+     * Executes writes on the writer threads and waits until all of them are finished.
+     * Results and errors are stored into the write objects.
+     * @param writes Writes, at most one per column.
+     */
+    void write(std::vector<ColumnWrite>& writes);
+
+private:
+    /** Completion of the group of writes */
+    class Completion;
+
+    /** Write queued to the writer thread */
+    struct QueuedWrite {
+        /** Write */
+        ColumnWrite* m_write;
+
+        /** Completion of the write group */
+        Completion* m_completion;
+    };
+
+    /** Writer thread and its queue */
+    class Writer;
+
+private:
+    /** Writer threads */
+    std::vector<std::unique_ptr<Writer>> m_writers;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,31 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// CRT headers
+#include <cstdint>
+
+namespace siodb::iomgr::dbengine {
+
+/** Formats of the table data files */
+enum class DataFileFormat {
+    /** Comma separated values, one row per line */
+    kCsv,
+
+    /**
+     * Binary file. File starts with signature, varint format version, varint column count
+     * and varint data type of each column. Each row is encoded in the same way as rows
+     * of the query result: varint row length, null bitmask and values of non-null columns.
+     */
+    kBinary,
+};
+
+/** Binary data file signature */
+constexpr char kBinaryDataFileSignature[8] = {'S', 'I', 'O', 'D', 'B', 'D', 'A', 'T'};
+
+/** Binary data file format version */
+constexpr std::uint32_t kBinaryDataFileVersion = 1;
+
+}  // namespace siodb::iomgr::dbengine
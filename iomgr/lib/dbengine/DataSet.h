@@ -94,6 +94,20 @@ public:
      */
     virtual bool moveToNextRow() = 0;
 
+    /**
+     * Returns identifier of the current row, which can be used to return to this row later.
+     * @return Current row identifier.
+     * @throw std::runtime_error if row data is not avaliable.
+     */
+    virtual std::uint64_t getCurrentRowId() const = 0;
+
+    /**
+     * Moves dataset to the row with given identifier.
+     * @param rowId Row identifier obtained from getCurrentRowId().
+     * @return true if row data available for reading, false otherwise.
+     */
+    virtual bool moveToRow(std::uint64_t rowId) = 0;
+
     /**
      * Returns current row. Reads current row data if it was not read before.
      * @return Current row.
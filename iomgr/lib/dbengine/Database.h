@@ -16,7 +16,9 @@
 #include "MasterColumnRecordPtr.h"
 #include "OrderingType.h"
 #include "TableCache.h"
+#include "TableStatistics.h"
 #include "TransactionParameters.h"
+#include "TransactionSnapshotPtr.h"
 #include "User.h"
 #include "crypto/ciphers/Cipher.h"
 #include "parser/expr/Expression.h"
@@ -31,9 +33,12 @@
 #include "io/File.h"
 
 // Common project headers
+#include <siodb/common/config/CompilerDefs.h>
 #include <siodb/common/io/MemoryMappedFile.h>
 
 // STL headers
+#include <mutex>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -133,6 +138,18 @@ public:
     static constexpr const char* kSysIndexColumns_ColumnDefinitionId_Column = "COLUMN_DEF_ID";
     static constexpr const char* kSysIndexColumns_SortDesc_Column = "SORT_DESC";
 
+    static constexpr const char* kSysTableStatisticsTable = "SYS_TABLE_STATISTICS";
+    static constexpr const char* kSysTableStatistics_RowCount_Column = "ROW_COUNT";
+    static constexpr const char* kSysTableStatistics_SampleRowCount_Column = "SAMPLE_ROW_COUNT";
+    static constexpr const char* kSysTableStatistics_AnalyzeTime_Column = "ANALYZE_TIME";
+
+    static constexpr const char* kSysColumnStatisticsTable = "SYS_COLUMN_STATISTICS";
+    static constexpr const char* kSysColumnStatistics_TableId_Column = "TABLE_ID";
+    static constexpr const char* kSysColumnStatistics_NullFraction_Column = "NULL_FRACTION";
+    static constexpr const char* kSysColumnStatistics_DistinctCount_Column = "DISTINCT_COUNT";
+    static constexpr const char* kSysColumnStatistics_AverageWidth_Column = "AVG_WIDTH";
+    static constexpr const char* kSysColumnStatistics_Histogram_Column = "HISTOGRAM";
+
     static constexpr const char* kSysUsersTable = "SYS_USERS";
     static constexpr const char* kSysUsers_Name_Column = "NAME";
     static constexpr const char* kSysUsers_RealName_Column = "REAL_NAME";
@@ -191,7 +208,7 @@ protected:
 
 public:
     /** De-initializes object of class Database */
-    virtual ~Database() = default;
+    virtual ~Database();
 
     DECLARE_NONCOPYABLE(Database);
 
@@ -377,6 +394,44 @@ public:
      */
     TablePtr getTableChecked(std::uint32_t tableId);
 
+    /**
+     * Returns names of all user tables.
+     * @return User table names.
+     */
+    std::vector<std::string> getUserTableNames() const;
+
+    /**
+     * Returns statistics of the table collected by the last ANALYZE.
+     * @param tableId Table ID.
+     * @return Table statistics or nullptr if table was never analyzed.
+     */
+    TableStatisticsPtr getTableStatistics(std::uint32_t tableId) const;
+
+    /**
+     * Returns indication that database has system tables for the table statistics.
+     * Databases created by the older versions don't have them.
+     * @return true if table statistics can be recorded, false otherwise.
+     */
+    bool isTableStatisticsSupported() const noexcept
+    {
+        return m_sysTableStatisticsTable && m_sysColumnStatisticsTable;
+    }
+
+    /**
+     * Records table statistics into the appropriate system tables,
+     * replacing previously recorded statistics of the same table.
+     * @param statistics Table statistics.
+     * @param tp Transaction parameters.
+     * @throw DatabaseError if database has no statistics tables or some error has occurred.
+     */
+    void saveTableStatistics(TableStatistics&& statistics, const TransactionParameters& tp);
+
+    /**
+     * Writes data of all cached tables to disk.
+     * @throw DatabaseError if write has failed.
+     */
+    void flushTables();
+
     /**
      * Creates new constraint definition or returns suitable existing one.
      * @param system Indicated that constraint ID must be from the system range.
@@ -569,14 +624,86 @@ public:
     std::uint64_t generateNextIndexColumnId(bool system);
 
     /**
-     * Generates next transaction ID.
+     * Generates next transaction ID. IDs are taken from the range reserved in the metadata,
+     * which is persisted only when range is exhausted. After crash, generation continues
+     * after the reserved range, so unused IDs of the range are skipped.
      * @return New transaction ID.
+     * @throw DatabaseError if new range can't be reserved.
      */
-    std::uint64_t generateNextTransactionId() noexcept
+    std::uint64_t generateNextTransactionId()
     {
-        return m_metadata->generateNextTransactionId();
+        const auto transactionId = ++m_lastTransactionId;
+        if (SIODB_UNLIKELY(transactionId > m_lastReservedTransactionId))
+            reserveTransactionIds(transactionId);
+        return transactionId;
     }
 
+    /**
+     * Begins new transaction, which changes are invisible to the snapshots
+     * created before its end. Transaction ID is written to disk before it is returned,
+     * so that changes of the transaction are rolled back if database is not closed
+     * properly before transaction ends.
+     * @return New transaction ID.
+     * @throw DatabaseError if there are too many active transactions
+     *                      or transaction ID can't be written to disk.
+     */
+    std::uint64_t beginTransaction();
+
+    /**
+     * Ends transaction started with beginTransaction(). Changes of the transaction
+     * must be written to disk before.
+     * @param transactionId Transaction ID.
+     */
+    void endTransaction(std::uint64_t transactionId) noexcept;
+
+    /**
+     * Creates snapshot of the committed transactions. Snapshot is tracked
+     * until last reference to it is released.
+     * @param ownTransactionId ID of the active transaction which reads the snapshot,
+     *                         its changes are visible. Zero if there is no such transaction.
+     * @return Transaction snapshot.
+     */
+    TransactionSnapshotPtr createSnapshot(std::uint64_t ownTransactionId = 0);
+
+    /**
+     * Creates snapshot of the database state in the past. Only committed changes
+     * made by transactions up to the given one and not later than the given
+     * timestamp are visible.
+     * @param maxTransactionId Last visible transaction ID.
+     * @param maxTimestamp Latest visible row version timestamp.
+     * @return Transaction snapshot.
+     */
+    TransactionSnapshotPtr createHistoricalSnapshot(
+            std::uint64_t maxTransactionId, std::uint64_t maxTimestamp) const;
+
+    /**
+     * Returns smallest transaction ID which may be invisible to some existing
+     * or future snapshot. Changes made by earlier transactions are visible to all readers.
+     * @return Transaction ID.
+     */
+    std::uint64_t getMinInvisibleTransactionId() const;
+
+    /**
+     * Returns indication that transaction has started with beginTransaction()
+     * and has not ended yet.
+     * @param transactionId Transaction ID.
+     * @return true if transaction is active, false otherwise.
+     */
+    bool isTransactionActive(std::uint64_t transactionId) const;
+
+    /**
+     * Returns indication that snapshot still sees current state of the tables:
+     * no other transaction was active when snapshot was created, and no transaction
+     * has started since then. Table metadata, like index key count, can be used
+     * instead of reading rows for such snapshot.
+     * @param snapshot Transaction snapshot.
+     * @param ownTransactionId ID of the active transaction which reads the snapshot.
+     *                         Zero if there is no such transaction.
+     * @return true if snapshot is current, false otherwise.
+     */
+    bool isSnapshotCurrent(
+            const TransactionSnapshot& snapshot, std::uint64_t ownTransactionId = 0) const;
+
     /**
      * Generates next atomic operation ID.
      * @return New atomic operation ID.
@@ -781,6 +908,14 @@ protected:
      */
     TablePtr loadSystemTable(const std::string& name);
 
+    /**
+     * Loads system table object, which is missing in the databases created
+     * by the older versions.
+     * @param name System table name.
+     * @return System table object or nullptr if table doesn't exist.
+     */
+    TablePtr loadOptionalSystemTable(const std::string& name);
+
     /**
      * Records table into the appropriate system table.
      * @param table A table to be recorded.
@@ -932,6 +1067,9 @@ private:
     /** Reads all indices from SYS_INDICES. */
     void readAllIndices();
 
+    /** Reads all table statistics from SYS_TABLE_STATISTICS and SYS_COLUMN_STATISTICS */
+    void readAllTableStatistics();
+
     /** Checks data consistency */
     void checkDataConsistency();
 
@@ -947,6 +1085,40 @@ private:
      */
     std::unique_ptr<MemoryMappedFile> openMetadataFile() const;
 
+    /**
+     * Reserves next range of transaction IDs which includes given ID.
+     * @param transactionId Transaction ID.
+     * @throw DatabaseError if reserved range can't be persisted.
+     */
+    void reserveTransactionIds(std::uint64_t transactionId);
+
+    /**
+     * Writes metadata to disk.
+     * @throw DatabaseError if write has failed.
+     */
+    void syncMetadata();
+
+    /**
+     * Opens active transactions file, creates it if it doesn't exist.
+     * @return Active transactions file object.
+     * @throw DatabaseError if file can't be opened.
+     */
+    std::unique_ptr<MemoryMappedFile> openActiveTransactionsFile() const;
+
+    /**
+     * Writes memory page of the active transactions file which contains given slot to disk.
+     * @param slot Active transaction slot index.
+     * @throw DatabaseError if write has failed.
+     */
+    void syncActiveTransactionSlot(std::size_t slot);
+
+    /**
+     * Rolls back transactions which were active when database was closed last time,
+     * and makes all active transaction slots free.
+     * @throw DatabaseError if rollback has failed.
+     */
+    void rollBackInterruptedTransactions();
+
     /**
      * Constructs database metadata file path.
      * @return Database metadata file path.
@@ -1137,6 +1309,21 @@ protected:
     /** Persistent metadata (counters, etc) */
     DatabaseMetadata* m_metadata;
 
+    /** Last generated transaction ID */
+    std::atomic<std::uint64_t> m_lastTransactionId;
+
+    /** Last transaction ID of the reserved range, as persisted in the metadata */
+    std::atomic<std::uint64_t> m_lastReservedTransactionId;
+
+    /** Transaction ID range reservation synchronization object */
+    std::mutex m_transactionIdReservationMutex;
+
+    /** Active transactions file */
+    const std::unique_ptr<MemoryMappedFile> m_activeTransactionsFile;
+
+    /** Persistent active transaction ID slots, zero means free slot */
+    std::uint64_t* m_activeTransactionSlots;
+
     /** First transaction parameters */
     const TransactionParameters m_createTransactionParams;
 
@@ -1209,12 +1396,36 @@ protected:
     /** System table SYS_INDEX_COLUMNS */
     TablePtr m_sysIndexColumnsTable;
 
+    /** System table SYS_TABLE_STATISTICS, nullptr if database has no statistics tables */
+    TablePtr m_sysTableStatisticsTable;
+
+    /** System table SYS_COLUMN_STATISTICS, nullptr if database has no statistics tables */
+    TablePtr m_sysColumnStatisticsTable;
+
+    /** Table statistics by table ID */
+    std::unordered_map<std::uint32_t, TableStatisticsPtr> m_tableStatistics;
+
     /** System constraint definition for the "NOT NULL" constraint */
     ConstraintDefinitionPtr m_systemNotNullConstraintDefinition;
 
     /** System constraint definition for the "DEFAULT 0" constraint */
     ConstraintDefinitionPtr m_systenDefaultZeroConstraintDefinition;
 
+    /** Active transactions and snapshots synchronization object */
+    mutable std::mutex m_transactionMutex;
+
+    /** IDs of the active transactions */
+    std::set<std::uint64_t> m_activeTransactionIds;
+
+    /** Active transaction slot indices by transaction ID */
+    std::unordered_map<std::uint64_t, std::size_t> m_activeTransactionSlotIndices;
+
+    /** Free active transaction slot indices */
+    std::vector<std::size_t> m_freeActiveTransactionSlots;
+
+    /** Smallest invisible transaction IDs of the existing snapshots */
+    std::multiset<std::uint64_t> m_snapshotMinInvisibleTransactionIds;
+
     /** All system table name list */
     static const std::unordered_map<std::string, std::unordered_set<std::string>> m_allSystemTables;
 
@@ -1227,6 +1438,15 @@ protected:
     /** Metadata file name */
     static constexpr const char* kMetadataFileName = "db_metadata";
 
+    /** Number of transaction IDs reserved at once */
+    static constexpr std::uint64_t kTransactionIdReservationSize = 4096;
+
+    /** Active transactions file name */
+    static constexpr const char* kActiveTransactionsFileName = "active_transactions";
+
+    /** Maximum number of simultaneously active transactions */
+    static constexpr std::size_t kMaxActiveTransactionCount = 1024;
+
     /** System tables file name */
     static constexpr const char* kSystemObjectsFileName = "system_objects";
 
@@ -52,12 +52,22 @@ public:
     }
 
     /**
-     * Generates next transaction ID.
-     * @return New unqiue transaction ID.
+     * Returns last reserved transaction ID. Transaction IDs are reserved in ranges,
+     * so IDs up to this one may have been used.
+     * @return Last reserved transaction ID.
+     */
+    std::uint64_t getLastTransactionId() const noexcept
+    {
+        return m_lastTransactionId;
+    }
+
+    /**
+     * Sets last reserved transaction ID.
+     * @param lastTransactionId Last reserved transaction ID.
      */
-    std::uint64_t generateNextTransactionId() noexcept
+    void setLastTransactionId(std::uint64_t lastTransactionId) noexcept
     {
-        return ++m_lastTransactionId;
+        m_lastTransactionId = lastTransactionId;
     }
 
     /**
@@ -80,7 +90,7 @@ private:
     /** Data version. Always little-endian value. Use ::pbeDecodeUInt64() to read it correctly. */
     std::uint64_t m_version;
 
-    /** Last transaction ID */
+    /** Last reserved transaction ID */
     std::atomic<std::uint64_t> m_lastTransactionId;
 
     /** Last atomic operation ID */
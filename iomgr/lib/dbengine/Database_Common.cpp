@@ -18,6 +18,7 @@
 #include "Table.h"
 #include "TableType.h"
 #include "ThrowDatabaseError.h"
+#include "TransactionSnapshot.h"
 #include "io/EncryptedFile.h"
 #include "io/NormalFile.h"
 
@@ -30,6 +31,7 @@
 #include <siodb/common/utils/PlainBinaryEncoding.h>
 
 // STL headers
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 
@@ -40,6 +42,11 @@
 // OpenSSL
 #include <openssl/md5.h>
 
+// System headers
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace siodb::iomgr::dbengine {
 
 bool Database::isSystemDatabase() const noexcept
@@ -68,6 +75,31 @@ TablePtr Database::getTableChecked(std::uint32_t tableId)
     throwDatabaseError(IOManagerMessageId::kErrorTableDoesNotExist, m_name, tableId);
 }
 
+std::vector<std::string> Database::getUserTableNames() const
+{
+    std::lock_guard lock(m_mutex);
+    std::vector<std::string> tableNames;
+    tableNames.reserve(m_tableRegistry.size());
+    for (const auto& tableRecord : m_tableRegistry.byName()) {
+        if (!isSystemTable(tableRecord.m_name)) tableNames.push_back(tableRecord.m_name);
+    }
+    return tableNames;
+}
+
+TableStatisticsPtr Database::getTableStatistics(std::uint32_t tableId) const
+{
+    std::lock_guard lock(m_mutex);
+    const auto it = m_tableStatistics.find(tableId);
+    return it == m_tableStatistics.end() ? nullptr : it->second;
+}
+
+void Database::flushTables()
+{
+    std::lock_guard lock(m_mutex);
+    for (const auto& e : m_tableCache)
+        e.second->flush();
+}
+
 ConstraintDefinitionPtr Database::createConstraintDefinition(bool system,
         ConstraintType constraintType, requests::ConstExpressionPtr&& expression, bool& existing)
 {
@@ -333,6 +365,133 @@ std::uint64_t Database::generateNextIndexColumnId(bool system)
                   : m_sysIndexColumnsTable->generateNextUserTrid();
 }
 
+std::uint64_t Database::beginTransaction()
+{
+    std::uint64_t transactionId = 0;
+    std::size_t slot = 0;
+    {
+        std::lock_guard lock(m_transactionMutex);
+        if (m_freeActiveTransactionSlots.empty()) {
+            throwDatabaseError(IOManagerMessageId::kErrorTooManyActiveTransactions, m_name,
+                    kMaxActiveTransactionCount);
+        }
+        transactionId = generateNextTransactionId();
+        slot = m_freeActiveTransactionSlots.back();
+        m_freeActiveTransactionSlots.pop_back();
+        m_activeTransactionSlots[slot] = transactionId;
+        m_activeTransactionSlotIndices.emplace(transactionId, slot);
+        m_activeTransactionIds.insert(transactionId);
+    }
+
+    // Transaction must be known on disk before it changes any row
+    try {
+        syncActiveTransactionSlot(slot);
+    } catch (...) {
+        endTransaction(transactionId);
+        throw;
+    }
+    return transactionId;
+}
+
+void Database::endTransaction(std::uint64_t transactionId) noexcept
+{
+    std::size_t slot = 0;
+    {
+        std::lock_guard lock(m_transactionMutex);
+        const auto it = m_activeTransactionSlotIndices.find(transactionId);
+        if (it == m_activeTransactionSlotIndices.end()) return;
+        slot = it->second;
+        m_activeTransactionSlots[slot] = 0;
+    }
+
+    // Changes become visible to others only when they can't be rolled back on open anymore
+    try {
+        syncActiveTransactionSlot(slot);
+    } catch (std::exception& ex) {
+        LOG_ERROR << ex.what();
+    }
+
+    std::lock_guard lock(m_transactionMutex);
+    m_activeTransactionSlotIndices.erase(transactionId);
+    m_activeTransactionIds.erase(transactionId);
+    m_freeActiveTransactionSlots.push_back(slot);
+}
+
+TransactionSnapshotPtr Database::createSnapshot(std::uint64_t ownTransactionId)
+{
+    auto database = shared_from_this();
+    std::unique_ptr<TransactionSnapshot> snapshot;
+    std::multiset<std::uint64_t>::iterator it;
+    {
+        std::lock_guard lock(m_transactionMutex);
+        std::vector<std::uint64_t> activeTransactionIds;
+        activeTransactionIds.reserve(m_activeTransactionIds.size());
+        for (const auto transactionId : m_activeTransactionIds) {
+            if (transactionId != ownTransactionId) activeTransactionIds.push_back(transactionId);
+        }
+        snapshot = std::make_unique<TransactionSnapshot>(
+                m_lastTransactionId + 1, std::move(activeTransactionIds));
+        it = m_snapshotMinInvisibleTransactionIds.insert(
+                snapshot->getMinInvisibleTransactionId());
+    }
+
+    // Snapshot is unregistered when last reader releases it
+    return TransactionSnapshotPtr(snapshot.release(),
+            [database = std::move(database), it](const TransactionSnapshot* snapshot) {
+                {
+                    std::lock_guard lock(database->m_transactionMutex);
+                    database->m_snapshotMinInvisibleTransactionIds.erase(it);
+                }
+                delete snapshot;
+            });
+}
+
+TransactionSnapshotPtr Database::createHistoricalSnapshot(
+        std::uint64_t maxTransactionId, std::uint64_t maxTimestamp) const
+{
+    std::lock_guard lock(m_transactionMutex);
+    const auto horizon = std::min(m_lastTransactionId.load(), maxTransactionId) + 1;
+    std::vector<std::uint64_t> activeTransactionIds;
+    for (const auto transactionId : m_activeTransactionIds) {
+        if (transactionId >= horizon) break;
+        activeTransactionIds.push_back(transactionId);
+    }
+    // Historical snapshot doesn't rely on the deleted row log,
+    // so it doesn't hold back pruning and is not registered.
+    return std::make_shared<TransactionSnapshot>(
+            horizon, std::move(activeTransactionIds), true, maxTimestamp);
+}
+
+std::uint64_t Database::getMinInvisibleTransactionId() const
+{
+    std::lock_guard lock(m_transactionMutex);
+    auto result = m_lastTransactionId + 1;
+    if (!m_activeTransactionIds.empty())
+        result = std::min(result, *m_activeTransactionIds.cbegin());
+    if (!m_snapshotMinInvisibleTransactionIds.empty())
+        result = std::min(result, *m_snapshotMinInvisibleTransactionIds.cbegin());
+    return result;
+}
+
+bool Database::isTransactionActive(std::uint64_t transactionId) const
+{
+    std::lock_guard lock(m_transactionMutex);
+    return m_activeTransactionIds.count(transactionId) > 0;
+}
+
+bool Database::isSnapshotCurrent(
+        const TransactionSnapshot& snapshot, std::uint64_t ownTransactionId) const
+{
+    if (snapshot.isHistorical() || snapshot.getMinInvisibleTransactionId() != snapshot.getHorizon())
+        return false;
+    std::lock_guard lock(m_transactionMutex);
+    return m_lastTransactionId + 1 == snapshot.getHorizon()
+           && std::all_of(m_activeTransactionIds.cbegin(), m_activeTransactionIds.cend(),
+                   [ownTransactionId](std::uint64_t transactionId) {
+                       return transactionId == ownTransactionId;
+                   });
+}
+
 void Database::checkConstraintType(const Table& table, const Column* column,
         const std::string& constraintName, const ConstraintDefinition& constraintDefinition,
         ConstraintType expectedType) const
@@ -609,6 +768,12 @@ TablePtr Database::loadSystemTable(const std::string& name)
     throwDatabaseError(IOManagerMessageId::kErrorMissingSystemTable, m_name, name, m_id, 0);
 }
 
+TablePtr Database::loadOptionalSystemTable(const std::string& name)
+{
+    if (SIODB_UNLIKELY(m_tableRegistry.empty())) loadSystemObjectsInfo();
+    return getTableUnlocked(name);
+}
+
 Uuid Database::computeDatabaseUuid(
         const std::string& databaseName, std::time_t createTimestamp) noexcept
 {
@@ -674,6 +839,27 @@ std::unique_ptr<MemoryMappedFile> Database::createMetadataFile() const
             sizeof(DatabaseMetadata));
 }
 
+void Database::reserveTransactionIds(std::uint64_t transactionId)
+{
+    std::lock_guard lock(m_transactionIdReservationMutex);
+    // Other thread could already reserve range which includes this ID
+    if (transactionId <= m_lastReservedTransactionId) return;
+    const auto lastReservedTransactionId = transactionId + kTransactionIdReservationSize - 1;
+    m_metadata->setLastTransactionId(lastReservedTransactionId);
+    syncMetadata();
+    m_lastReservedTransactionId = lastReservedTransactionId;
+}
+
+void Database::syncMetadata()
+{
+    if (::msync(m_metadataFile->getMappingAddress(), m_metadataFile->getMappingLength(), MS_SYNC)
+            < 0) {
+        const int errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteDatabaseMetadataFile, m_name,
+                m_uuid, errorCode, std::strerror(errorCode));
+    }
+}
+
 std::unique_ptr<MemoryMappedFile> Database::openMetadataFile() const
 {
     // Open metadata file
@@ -691,6 +877,85 @@ std::unique_ptr<MemoryMappedFile> Database::openMetadataFile() const
             fd, true, MemoryMappedFile::deduceMemoryProtectionMode(kOpenFlags), MAP_POPULATE, 0, 0);
 }
 
+std::unique_ptr<MemoryMappedFile> Database::openActiveTransactionsFile() const
+{
+    // Databases created before this file was introduced don't have it
+    const auto filePath = utils::constructPath(m_dataDir, kActiveTransactionsFileName);
+    constexpr auto kOpenFlags = O_CREAT | O_RDWR | O_CLOEXEC | O_NOATIME;
+    FileDescriptorGuard fd(::open(filePath.c_str(), kOpenFlags, kDataFileCreationMode));
+    if (!fd.isValidFd()) {
+        const int errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotOpenActiveTransactionsFile, filePath,
+                m_name, m_uuid, errorCode, std::strerror(errorCode));
+    }
+
+    // New file is filled with zeroes, i.e. all slots are free
+    constexpr auto kFileSize = kMaxActiveTransactionCount * sizeof(std::uint64_t);
+    struct stat st;
+    if (::fstat(fd.getFd(), &st) < 0
+            || (st.st_size < static_cast<off_t>(kFileSize)
+                    && ::ftruncate(fd.getFd(), kFileSize) < 0)) {
+        const int errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteActiveTransactionsFile, m_name,
+                m_uuid, errorCode, std::strerror(errorCode));
+    }
+
+    // Create memory mapping
+    return std::make_unique<MemoryMappedFile>(fd.release(), true,
+            MemoryMappedFile::deduceMemoryProtectionMode(kOpenFlags), MAP_POPULATE, 0, kFileSize);
+}
+
+void Database::syncActiveTransactionSlot(std::size_t slot)
+{
+    // Only memory page which contains slot is written
+    static const auto pageSize = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto mappingAddress =
+            reinterpret_cast<std::uintptr_t>(m_activeTransactionsFile->getMappingAddress());
+    const auto mappingEnd = mappingAddress + m_activeTransactionsFile->getMappingLength();
+    const auto pageAddress =
+            reinterpret_cast<std::uintptr_t>(m_activeTransactionSlots + slot) & ~(pageSize - 1);
+    const auto length = std::min(pageSize, mappingEnd - pageAddress);
+    if (::msync(reinterpret_cast<void*>(pageAddress), length, MS_SYNC) < 0) {
+        const int errorCode = errno;
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteActiveTransactionsFile, m_name,
+                m_uuid, errorCode, std::strerror(errorCode));
+    }
+}
+
+void Database::rollBackInterruptedTransactions()
+{
+    std::vector<std::uint64_t> transactionIds;
+    for (std::size_t slot = 0; slot < kMaxActiveTransactionCount; ++slot) {
+        if (m_activeTransactionSlots[slot] != 0)
+            transactionIds.push_back(m_activeTransactionSlots[slot]);
+    }
+
+    if (!transactionIds.empty()) {
+        LOG_WARNING << "Database " << m_name << ": Rolling back " << transactionIds.size()
+                    << " transaction(s) interrupted by unexpected shutdown";
+        std::sort(transactionIds.begin(), transactionIds.end());
+        const TransactionParameters tp(User::kSuperUserId, generateNextTransactionId());
+        std::lock_guard lock(m_mutex);
+        for (const auto& e : m_tableRegistry.byName()) {
+            const auto table = getTableUnlocked(e.m_id);
+            table->rollBackInterruptedTransactions(transactionIds, tp);
+            table->flush();
+        }
+        std::fill_n(m_activeTransactionSlots, kMaxActiveTransactionCount, 0);
+        if (::msync(m_activeTransactionsFile->getMappingAddress(),
+                    m_activeTransactionsFile->getMappingLength(), MS_SYNC)
+                < 0) {
+            const int errorCode = errno;
+            throwDatabaseError(IOManagerMessageId::kErrorCannotWriteActiveTransactionsFile,
+                    m_name, m_uuid, errorCode, std::strerror(errorCode));
+        }
+    }
+
+    // Later slots are taken first
+    m_freeActiveTransactionSlots.resize(kMaxActiveTransactionCount);
+    std::iota(m_freeActiveTransactionSlots.begin(), m_freeActiveTransactionSlots.end(), 0);
+}
+
 std::string Database::getMetadataFilePath() const
 {
     return utils::constructPath(m_dataDir, kMetadataFileName);
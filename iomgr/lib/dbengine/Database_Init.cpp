@@ -13,6 +13,7 @@
 #include "parser/expr/ConstantExpression.h"
 
 // Common project headers
+#include <siodb/common/log/Log.h>
 #include <siodb/common/utils/FsUtils.h>
 
 // STL headers
@@ -133,6 +134,22 @@ const std::unordered_map<std::string, std::unordered_set<std::string>> Database:
                         kSysIndexColumns_ColumnDefinitionId_Column,
                         kSysIndexColumns_SortDesc_Column,
                 }},
+        {kSysTableStatisticsTable,
+                {
+                        kMasterColumnName,
+                        kSysTableStatistics_RowCount_Column,
+                        kSysTableStatistics_SampleRowCount_Column,
+                        kSysTableStatistics_AnalyzeTime_Column,
+                }},
+        {kSysColumnStatisticsTable,
+                {
+                        kMasterColumnName,
+                        kSysColumnStatistics_TableId_Column,
+                        kSysColumnStatistics_NullFraction_Column,
+                        kSysColumnStatistics_DistinctCount_Column,
+                        kSysColumnStatistics_AverageWidth_Column,
+                        kSysColumnStatistics_Histogram_Column,
+                }},
 };
 
 const std::unordered_set<std::string> Database::m_systemDatabaseOnlySystemTables {
@@ -157,6 +174,11 @@ Database::Database(Instance& instance, const std::string& name, const std::strin
     , m_decryptionContext(m_cipher ? m_cipher->createDecryptionContext(m_cipherKey) : nullptr)
     , m_metadataFile(createMetadataFile())
     , m_metadata(static_cast<DatabaseMetadata*>(m_metadataFile->getMappingAddress()))
+    , m_lastTransactionId(m_metadata->getLastTransactionId())
+    , m_lastReservedTransactionId(m_metadata->getLastTransactionId())
+    , m_activeTransactionsFile(openActiveTransactionsFile())
+    , m_activeTransactionSlots(
+              static_cast<std::uint64_t*>(m_activeTransactionsFile->getMappingAddress()))
     , m_createTransactionParams(User::kSuperUserId, generateNextTransactionId())
     , m_tableCache(m_name,
               tableCacheCapacity > 0 ? tableCacheCapacity : instance.getTableCacheCapacity())
@@ -167,6 +189,7 @@ Database::Database(Instance& instance, const std::string& name, const std::strin
     , m_systenDefaultZeroConstraintDefinition(createSystemConstraintDefinitionUnlocked(
               ConstraintType::kDefaultValue, std::make_unique<requests::ConstantExpression>(0)))
 {
+    rollBackInterruptedTransactions();
     createSystemTables();
 }
 
@@ -184,6 +207,11 @@ Database::Database(
     , m_decryptionContext(m_cipher ? m_cipher->createDecryptionContext(m_cipherKey) : nullptr)
     , m_metadataFile(openMetadataFile())
     , m_metadata(static_cast<DatabaseMetadata*>(m_metadataFile->getMappingAddress()))
+    , m_lastTransactionId(m_metadata->getLastTransactionId())
+    , m_lastReservedTransactionId(m_metadata->getLastTransactionId())
+    , m_activeTransactionsFile(openActiveTransactionsFile())
+    , m_activeTransactionSlots(
+              static_cast<std::uint64_t*>(m_activeTransactionsFile->getMappingAddress()))
     , m_tableCache(m_name,
               tableCacheCapacity > 0 ? tableCacheCapacity : instance.getTableCacheCapacity())
     , m_constraintDefinitionCache(*this, kConstraintDefinitionCacheCapacity)
@@ -199,6 +227,8 @@ Database::Database(
     , m_sysColumnDefConstraintsTable(loadSystemTable(kSysColumnDefConstraintsTable))
     , m_sysIndicesTable(loadSystemTable(kSysIndicesTable))
     , m_sysIndexColumnsTable(loadSystemTable(kSysIndexColumnsTable))
+    , m_sysTableStatisticsTable(loadOptionalSystemTable(kSysTableStatisticsTable))
+    , m_sysColumnStatisticsTable(loadOptionalSystemTable(kSysColumnStatisticsTable))
     , m_systemNotNullConstraintDefinition(createSystemConstraintDefinitionUnlocked(
               ConstraintType::kNotNull, std::make_unique<requests::ConstantExpression>(true)))
     , m_systenDefaultZeroConstraintDefinition(createSystemConstraintDefinitionUnlocked(
@@ -213,7 +243,20 @@ Database::Database(
     readAllConstraints();
     readAllColumnDefConstraints();
     readAllIndices();
+    readAllTableStatistics();
     checkDataConsistency();
+    rollBackInterruptedTransactions();
+}
+
+Database::~Database()
+{
+    // Unused part of the reserved range is returned on clean shutdown
+    m_metadata->setLastTransactionId(m_lastTransactionId);
+    try {
+        syncMetadata();
+    } catch (std::exception& ex) {
+        LOG_ERROR << ex.what();
+    }
 }
 
 void Database::createSystemTables()
@@ -316,6 +359,16 @@ void Database::createSystemTables()
     allTables.push_back(m_sysIndexColumnsTable);
     m_sysIndexColumnsTable->setLastSystemTrid(m_tmpTridCounters.m_lastIndexColumnId);
 
+    // Create table SYS_TABLE_STATISTICS
+    m_sysTableStatisticsTable =
+            createTableUnlocked(kSysTableStatisticsTable, TableType::kDisk, kFirstUserTableId);
+    allTables.push_back(m_sysTableStatisticsTable);
+
+    // Create table SYS_COLUMN_STATISTICS
+    m_sysColumnStatisticsTable = createTableUnlocked(
+            kSysColumnStatisticsTable, TableType::kDisk, kFirstUserTableColumnId);
+    allTables.push_back(m_sysColumnStatisticsTable);
+
     // Empty constraint set
     const ColumnConstraintSpecificationList noConstraintsSpec;
 
@@ -532,6 +585,56 @@ void Database::createSystemTables()
                     kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
     allColumns.push_back(column);
 
+    // Create columns of the table SYS_TABLE_STATISTICS
+    column = m_sysTableStatisticsTable->getMasterColumn();
+    allColumns.push_back(column);
+    masterColumns.push_back(column);
+
+    column = m_sysTableStatisticsTable->createColumn(
+            ColumnSpecification(kSysTableStatistics_RowCount_Column, COLUMN_DATA_TYPE_UINT64,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    column = m_sysTableStatisticsTable->createColumn(
+            ColumnSpecification(kSysTableStatistics_SampleRowCount_Column, COLUMN_DATA_TYPE_UINT64,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    column = m_sysTableStatisticsTable->createColumn(
+            ColumnSpecification(kSysTableStatistics_AnalyzeTime_Column, COLUMN_DATA_TYPE_UINT64,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    // Create columns of the table SYS_COLUMN_STATISTICS
+    column = m_sysColumnStatisticsTable->getMasterColumn();
+    allColumns.push_back(column);
+    masterColumns.push_back(column);
+
+    column = m_sysColumnStatisticsTable->createColumn(
+            ColumnSpecification(kSysColumnStatistics_TableId_Column, Column::kMasterColumnDataType,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    column = m_sysColumnStatisticsTable->createColumn(
+            ColumnSpecification(kSysColumnStatistics_NullFraction_Column, COLUMN_DATA_TYPE_DOUBLE,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    column = m_sysColumnStatisticsTable->createColumn(
+            ColumnSpecification(kSysColumnStatistics_DistinctCount_Column, COLUMN_DATA_TYPE_UINT64,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    column = m_sysColumnStatisticsTable->createColumn(
+            ColumnSpecification(kSysColumnStatistics_AverageWidth_Column, COLUMN_DATA_TYPE_DOUBLE,
+                    kSystemTableDataFileDataAreaSize, notNullConstraintSpec));
+    allColumns.push_back(column);
+
+    column = m_sysColumnStatisticsTable->createColumn(
+            ColumnSpecification(kSysColumnStatistics_Histogram_Column, COLUMN_DATA_TYPE_BINARY,
+                    kSystemTableDataFileDataAreaSize, noConstraintsSpec));
+    allColumns.push_back(column);
+
     // Close column sets
     for (const auto& table : allTables)
         table->closeCurrentColumnSet();
@@ -10,6 +10,7 @@
 #include "Constraint.h"
 #include "DatabaseObjectName.h"
 #include "Index.h"
+#include "TableDataSet.h"
 #include "ThrowDatabaseError.h"
 
 // Common project headers
@@ -1358,4 +1359,91 @@ void Database::readAllIndices()
     }
 }
 
+void Database::readAllTableStatistics()
+{
+    if (!isTableStatisticsSupported()) {
+        LOG_WARNING << "Database " << m_name << " has no statistics tables, "
+                    << "table statistics are not available";
+        return;
+    }
+
+    LOG_DEBUG << "Database " << m_name << ": Reading all table statistics.";
+
+    const auto addColumns = [](TableDataSet& dataSet, std::initializer_list<const char*> names) {
+        for (const auto name : names) {
+            dataSet.emplaceColumnInfo(
+                    dataSet.getTable().getColumnChecked(name)->getCurrentPosition(), name,
+                    std::string());
+        }
+    };
+
+    // Read SYS_TABLE_STATISTICS
+    std::unordered_map<std::uint32_t, TableStatistics> tableStatistics;
+    const auto& tablesById = m_tableRegistry.byId();
+    TableDataSet tablesDataSet(m_sysTableStatisticsTable, std::string());
+    addColumns(tablesDataSet,
+            {kMasterColumnName, kSysTableStatistics_RowCount_Column,
+                    kSysTableStatistics_SampleRowCount_Column,
+                    kSysTableStatistics_AnalyzeTime_Column});
+    tablesDataSet.resetCursor();
+    for (bool hasRow = tablesDataSet.hasCurrentRow(); hasRow;
+            hasRow = tablesDataSet.moveToNextRow()) {
+        const auto tableId =
+                static_cast<std::uint32_t>(tablesDataSet.getColumnValue(0).asUInt64());
+        // Statistics of the dropped tables are ignored
+        if (tablesById.find(tableId) == tablesById.end()) continue;
+        auto& statistics = tableStatistics[tableId];
+        statistics.m_tableId = tableId;
+        statistics.m_rowCount = tablesDataSet.getColumnValue(1).asUInt64();
+        statistics.m_sampleRowCount = tablesDataSet.getColumnValue(2).asUInt64();
+        statistics.m_analyzeTime = tablesDataSet.getColumnValue(3).asUInt64();
+    }
+
+    // Read SYS_COLUMN_STATISTICS
+    const auto& columnsById = m_columnRegistry.byId();
+    TableDataSet columnsDataSet(m_sysColumnStatisticsTable, std::string());
+    addColumns(columnsDataSet,
+            {kMasterColumnName, kSysColumnStatistics_TableId_Column,
+                    kSysColumnStatistics_NullFraction_Column,
+                    kSysColumnStatistics_DistinctCount_Column,
+                    kSysColumnStatistics_AverageWidth_Column,
+                    kSysColumnStatistics_Histogram_Column});
+    columnsDataSet.resetCursor();
+    for (bool hasRow = columnsDataSet.hasCurrentRow(); hasRow;
+            hasRow = columnsDataSet.moveToNextRow()) {
+        const auto columnId = columnsDataSet.getColumnValue(0).asUInt64();
+        const auto tableId =
+                static_cast<std::uint32_t>(columnsDataSet.getColumnValue(1).asUInt64());
+        const auto itTable = tableStatistics.find(tableId);
+        const auto itColumn = columnsById.find(columnId);
+        // Statistics of the dropped columns are ignored
+        if (itTable == tableStatistics.end() || itColumn == columnsById.end()) continue;
+
+        ColumnStatistics statistics;
+        statistics.m_columnId = columnId;
+        statistics.m_nullFraction = columnsDataSet.getColumnValue(2).asDouble();
+        statistics.m_distinctCount = columnsDataSet.getColumnValue(3).asUInt64();
+        statistics.m_averageWidth = columnsDataSet.getColumnValue(4).asDouble();
+        const auto& histogram = columnsDataSet.getColumnValue(5);
+        if (!histogram.isNull()) {
+            try {
+                statistics.deserializeHistogram(histogram.getBinary());
+            } catch (std::exception& ex) {
+                LOG_WARNING << "Database " << m_name
+                            << ": Ignoring invalid histogram of the column #" << columnId << ": "
+                            << ex.what();
+            }
+        }
+        itTable->second.m_columns.emplace(itColumn->m_name, std::move(statistics));
+    }
+
+    for (auto& e : tableStatistics) {
+        m_tableStatistics.emplace(
+                e.first, std::make_shared<const TableStatistics>(std::move(e.second)));
+    }
+
+    LOG_DEBUG << "Database " << m_name << ": Read statistics of " << m_tableStatistics.size()
+              << " tables.";
+}
+
 }  // namespace siodb::iomgr::dbengine
@@ -5,15 +5,42 @@
 #include "Database.h"
 
 // Project headers
+#include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
 #include "ColumnDefinitionConstraintList.h"
 #include "ColumnSetColumn.h"
 #include "IndexColumn.h"
+#include "ThrowDatabaseError.h"
 
 // Common project headers
 #include <siodb/common/log/Log.h>
 
+// STL headers
+#include <numeric>
+
 namespace siodb::iomgr::dbengine {
 
+namespace {
+
+/**
+ * Updates row with the given TRID or inserts it, if it doesn't exist yet.
+ * @param table A table.
+ * @param trid Row TRID.
+ * @param values Values of all columns except master column.
+ * @param tp Transaction parameters.
+ */
+void updateOrInsertRow(Table& table, std::uint64_t trid, std::vector<Variant>&& values,
+        const TransactionParameters& tp)
+{
+    std::vector<std::size_t> columnPositions(values.size());
+    std::iota(columnPositions.begin(), columnPositions.end(), 1);
+    // Values are not consumed if row doesn't exist
+    if (!table.updateRow(trid, std::move(values), columnPositions, tp))
+        table.insertRow(values, tp, trid);
+    table.flushIndices();
+}
+
+}  // namespace
+
 void Database::recordTable(const Table& table, const TransactionParameters& tp)
 {
     LOG_DEBUG << "Database " << m_name << ": Recording table #" << table.getId() << ' '
@@ -258,4 +285,39 @@ void Database::recordTableDefinition(const Table& table, const TransactionParame
     recordIndexAndColumns(*table.getMasterColumnMainIndex(), tp);
 }
 
+void Database::saveTableStatistics(TableStatistics&& statistics, const TransactionParameters& tp)
+{
+    if (!isTableStatisticsSupported())
+        throwDatabaseError(IOManagerMessageId::kErrorTableStatisticsNotSupported, m_name);
+
+    std::lock_guard lock(m_mutex);
+    LOG_DEBUG << "Database " << m_name << ": Recording statistics of the table #"
+              << statistics.m_tableId;
+
+    std::vector<Variant> values(m_sysTableStatisticsTable->getColumnCount() - 1);
+    std::size_t i = 0;
+    values.at(i++) = statistics.m_rowCount;
+    values.at(i++) = statistics.m_sampleRowCount;
+    values.at(i++) = statistics.m_analyzeTime;
+    updateOrInsertRow(*m_sysTableStatisticsTable, statistics.m_tableId, std::move(values), tp);
+
+    for (const auto& e : statistics.m_columns) {
+        const auto& columnStatistics = e.second;
+        values.assign(m_sysColumnStatisticsTable->getColumnCount() - 1, Variant());
+        i = 0;
+        values.at(i++) = static_cast<std::uint64_t>(statistics.m_tableId);
+        values.at(i++) = columnStatistics.m_nullFraction;
+        values.at(i++) = columnStatistics.m_distinctCount;
+        values.at(i++) = columnStatistics.m_averageWidth;
+        if (!columnStatistics.m_histogramBounds.empty())
+            values.at(i) = columnStatistics.serializeHistogram();
+        updateOrInsertRow(
+                *m_sysColumnStatisticsTable, columnStatistics.m_columnId, std::move(values), tp);
+    }
+
+    const auto tableId = statistics.m_tableId;
+    m_tableStatistics[tableId] = std::make_shared<const TableStatistics>(std::move(statistics));
+    LOG_DEBUG << "Database " << m_name << ": Recorded statistics of the table #" << tableId;
+}
+
 }  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,176 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "HashAggregator.h"
+
+// Project headers
+#include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "ThrowDatabaseError.h"
+
+// STL headers
+#include <string_view>
+
+namespace siodb::iomgr::dbengine {
+
+HashAggregator::HashAggregator(
+        const std::vector<const requests::AggregateFunction*>& aggregateFunctions,
+        std::size_t memoryLimit)
+    : m_aggregateFunctions(aggregateFunctions)
+    , m_slots(kInitialSlotCount, 0)
+    , m_memoryLimit(memoryLimit)
+    , m_memoryUsage(kInitialSlotCount * sizeof(std::size_t))
+{
+}
+
+std::pair<std::size_t, bool> HashAggregator::findOrAddGroup(std::vector<Variant>&& keys)
+{
+    const auto hash = hashKeys(keys);
+    auto slot = findSlot(keys, hash);
+    if (m_slots[slot] != 0) return std::make_pair(m_slots[slot] - 1, false);
+
+    // Check memory before group is added, so that failed query doesn't grow further
+    addMemoryUsage(sizeof(Group) + getMemoryUsage(keys)
+                   + m_aggregateFunctions.size() * sizeof(requests::AggregateState));
+
+    // Keep load factor not greater than 1/2
+    if ((m_groups.size() + 1) * 2 > m_slots.size()) {
+        addMemoryUsage(m_slots.size() * sizeof(std::size_t));
+        rehash(m_slots.size() * 2);
+        slot = findSlot(keys, hash);
+    }
+
+    const auto groupIndex = m_groups.size();
+    auto& group = m_groups.emplace_back();
+    group.m_keys = std::move(keys);
+    group.m_states.resize(m_aggregateFunctions.size());
+    group.m_hash = hash;
+    m_slots[slot] = groupIndex + 1;
+    return std::make_pair(groupIndex, true);
+}
+
+void HashAggregator::setRowValues(
+        std::size_t groupIndex, std::vector<std::vector<Variant>>&& rowValues)
+{
+    std::size_t size = rowValues.size() * sizeof(std::vector<Variant>);
+    for (const auto& values : rowValues)
+        size += getMemoryUsage(values);
+    addMemoryUsage(size);
+    m_groups[groupIndex].m_rowValues = std::move(rowValues);
+}
+
+void HashAggregator::merge(HashAggregator&& other)
+{
+    for (auto& otherGroup : other.m_groups) {
+        const auto [groupIndex, isNewGroup] = findOrAddGroup(std::move(otherGroup.m_keys));
+        auto& group = m_groups[groupIndex];
+        if (isNewGroup) {
+            setRowValues(groupIndex, std::move(otherGroup.m_rowValues));
+            group.m_states = std::move(otherGroup.m_states);
+            continue;
+        }
+        for (std::size_t i = 0, n = m_aggregateFunctions.size(); i != n; ++i)
+            m_aggregateFunctions[i]->merge(group.m_states[i], otherGroup.m_states[i]);
+    }
+    other.m_groups.clear();
+    other.m_slots.assign(kInitialSlotCount, 0);
+    other.m_memoryUsage = kInitialSlotCount * sizeof(std::size_t);
+}
+
+// ---- internals ----
+
+std::size_t HashAggregator::findSlot(const std::vector<Variant>& keys, std::size_t hash) const
+{
+    const auto mask = m_slots.size() - 1;
+    auto slot = hash & mask;
+    while (m_slots[slot] != 0) {
+        const auto& group = m_groups[m_slots[slot] - 1];
+        if (group.m_hash == hash && areKeysEqual(group.m_keys, keys)) break;
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void HashAggregator::rehash(std::size_t slotCount)
+{
+    m_slots.assign(slotCount, 0);
+    const auto mask = slotCount - 1;
+    for (std::size_t i = 0, n = m_groups.size(); i != n; ++i) {
+        auto slot = m_groups[i].m_hash & mask;
+        while (m_slots[slot] != 0)
+            slot = (slot + 1) & mask;
+        m_slots[slot] = i + 1;
+    }
+}
+
+void HashAggregator::addMemoryUsage(std::size_t size)
+{
+    if (m_memoryUsage + size > m_memoryLimit) {
+        throwDatabaseError(IOManagerMessageId::kErrorGroupByMemoryLimitExceeded,
+                m_memoryLimit / (1024 * 1024));
+    }
+    m_memoryUsage += size;
+}
+
+std::size_t HashAggregator::getMemoryUsage(const std::vector<Variant>& values) noexcept
+{
+    std::size_t result = values.size() * sizeof(Variant);
+    for (const auto& value : values) {
+        if (value.isString())
+            result += value.getString().capacity();
+        else if (value.isBinary())
+            result += value.getBinary().size();
+    }
+    return result;
+}
+
+std::size_t HashAggregator::hashKeys(const std::vector<Variant>& keys)
+{
+    std::size_t result = keys.size();
+    for (const auto& key : keys)
+        result ^= hashValue(key) + 0x9e3779b97f4a7c15ULL + (result << 6) + (result >> 2);
+    // Mix bits, because slot is selected by the lowest bits of hash value
+    result ^= result >> 33;
+    result *= 0xff51afd7ed558ccdULL;
+    result ^= result >> 33;
+    return result;
+}
+
+std::size_t HashAggregator::hashValue(const Variant& value)
+{
+    const auto valueType = value.getValueType();
+    std::size_t result = 0;
+    if (isIntegerType(valueType) || valueType == VariantType::kBool)
+        result = std::hash<std::uint64_t>()(value.asUInt64());
+    else if (isFloatingPointType(valueType))
+        result = std::hash<double>()(value.asDouble());
+    else if (valueType == VariantType::kString)
+        result = std::hash<std::string>()(value.getString());
+    else if (valueType == VariantType::kBinary) {
+        const auto& binaryValue = value.getBinary();
+        result = std::hash<std::string_view>()(std::string_view(
+                reinterpret_cast<const char*>(binaryValue.data()), binaryValue.size()));
+    } else if (valueType == VariantType::kDateTime) {
+        std::uint8_t buffer[RawDateTime::kMaxSerializedSize];
+        const auto end = value.getDateTime().serialize(buffer);
+        result = std::hash<std::string_view>()(std::string_view(
+                reinterpret_cast<const char*>(buffer), end - buffer));
+    }
+    return result ^ static_cast<std::size_t>(valueType);
+}
+
+bool HashAggregator::areKeysEqual(
+        const std::vector<Variant>& left, const std::vector<Variant>& right)
+{
+    if (left.size() != right.size()) return false;
+    for (std::size_t i = 0, n = left.size(); i != n; ++i) {
+        if (left[i].getValueType() != right[i].getValueType()) return false;
+        if (left[i].isDateTime()) {
+            if (!left[i].compatibleEqual(right[i])) return false;
+        } else if (left[i] != right[i])
+            return false;
+    }
+    return true;
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,204 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "parser/expr/AggregateFunction.h"
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Hash aggregation operator for GROUP BY and aggregate functions.
+ * Groups are kept in the insertion order, lookup is done via open addressing
+ * hash table with linear probing. Partial results collected by independent
+ * aggregators (for example, by different threads) can be combined with merge().
+ * Memory used by groups is estimated, exceeding the memory limit fails the query,
+ * groups are never spilled to disk.
+ */
+class HashAggregator final {
+public:
+    /** Group of rows */
+    struct Group {
+        /** Group key values */
+        std::vector<Variant> m_keys;
+
+        /** Values of the first row of the group, per data set */
+        std::vector<std::vector<Variant>> m_rowValues;
+
+        /** Aggregate function states */
+        std::vector<requests::AggregateState> m_states;
+
+        /** Hash value of the group keys */
+        std::size_t m_hash;
+    };
+
+public:
+    /**
+     * Initializes object of class HashAggregator.
+     * @param aggregateFunctions Aggregate functions, ordered by aggregate index.
+     * @param memoryLimit Memory limit in bytes.
+     */
+    HashAggregator(const std::vector<const requests::AggregateFunction*>& aggregateFunctions,
+            std::size_t memoryLimit);
+
+    /**
+     * Returns number of groups.
+     * @return Number of groups.
+     */
+    std::size_t getGroupCount() const noexcept
+    {
+        return m_groups.size();
+    }
+
+    /**
+     * Returns group.
+     * @param groupIndex Group index.
+     * @return Group object.
+     */
+    Group& getGroup(std::size_t groupIndex) noexcept
+    {
+        return m_groups[groupIndex];
+    }
+
+    /**
+     * Returns group.
+     * @param groupIndex Group index.
+     * @return Group object.
+     */
+    const Group& getGroup(std::size_t groupIndex) const noexcept
+    {
+        return m_groups[groupIndex];
+    }
+
+    /**
+     * Returns estimated memory usage.
+     * @return Memory usage in bytes.
+     */
+    std::size_t getMemoryUsage() const noexcept
+    {
+        return m_memoryUsage;
+    }
+
+    /**
+     * Finds group with given keys, creates new group if it doesn't exist.
+     * @param keys Group key values.
+     * @return Pair of group index and indication that group was created.
+     * @throw DatabaseError if memory limit is exceeded.
+     */
+    std::pair<std::size_t, bool> findOrAddGroup(std::vector<Variant>&& keys);
+
+    /**
+     * Sets values of the first row of the group.
+     * @param groupIndex Group index.
+     * @param rowValues Row values, per data set.
+     * @throw DatabaseError if memory limit is exceeded.
+     */
+    void setRowValues(std::size_t groupIndex, std::vector<std::vector<Variant>>&& rowValues);
+
+    /**
+     * Adds argument value of the aggregate function to the group.
+     * @param groupIndex Group index.
+     * @param aggregateIndex Aggregate function index.
+     * @param value Argument value.
+     * @throw VariantLogicError if value can't be aggregated.
+     */
+    void accumulate(std::size_t groupIndex, std::size_t aggregateIndex, const Variant& value)
+    {
+        m_aggregateFunctions[aggregateIndex]->accumulate(
+                m_groups[groupIndex].m_states[aggregateIndex], value);
+    }
+
+    /**
+     * Returns aggregate function value for the group.
+     * @param groupIndex Group index.
+     * @param aggregateIndex Aggregate function index.
+     * @return Aggregate function value.
+     */
+    Variant getResult(std::size_t groupIndex, std::size_t aggregateIndex) const
+    {
+        return m_aggregateFunctions[aggregateIndex]->getResult(
+                m_groups[groupIndex].m_states[aggregateIndex]);
+    }
+
+    /**
+     * Merges groups collected by other aggregator with the same aggregate functions.
+     * @param other Other aggregator.
+     * @throw VariantLogicError if values can't be aggregated.
+     * @throw DatabaseError if memory limit is exceeded.
+     */
+    void merge(HashAggregator&& other);
+
+    /**
+     * Computes hash value of a single key value.
+     * @param value Key value.
+     * @return Hash value.
+     */
+    static std::size_t hashValue(const Variant& value);
+
+private:
+    /**
+     * Finds hash table slot for the given keys.
+     * @param keys Group key values.
+     * @param hash Hash value of the keys.
+     * @return Index of slot which contains matching group or index of the empty slot.
+     */
+    std::size_t findSlot(const std::vector<Variant>& keys, std::size_t hash) const;
+
+    /**
+     * Rebuilds hash table with the given number of slots.
+     * @param slotCount New number of slots, must be a power of 2.
+     */
+    void rehash(std::size_t slotCount);
+
+    /**
+     * Adds memory to the memory usage.
+     * @param size Memory size in bytes.
+     * @throw DatabaseError if memory limit is exceeded.
+     */
+    void addMemoryUsage(std::size_t size);
+
+    /**
+     * Estimates memory used by the values.
+     * @param values Values.
+     * @return Memory size in bytes.
+     */
+    static std::size_t getMemoryUsage(const std::vector<Variant>& values) noexcept;
+
+    /**
+     * Computes hash value of the group keys.
+     * @param keys Group key values.
+     * @return Hash value.
+     */
+    static std::size_t hashKeys(const std::vector<Variant>& keys);
+
+    /**
+     * Checks that group keys are equal. NULL keys are equal to each other.
+     * @param left Left keys.
+     * @param right Right keys.
+     * @return true if keys are equal, false otherwise.
+     */
+    static bool areKeysEqual(const std::vector<Variant>& left, const std::vector<Variant>& right);
+
+private:
+    /** Aggregate functions */
+    const std::vector<const requests::AggregateFunction*> m_aggregateFunctions;
+
+    /** Groups in the order of creation */
+    std::vector<Group> m_groups;
+
+    /** Hash table slots, contain group index + 1, zero means empty slot */
+    std::vector<std::size_t> m_slots;
+
+    /** Memory limit in bytes */
+    const std::size_t m_memoryLimit;
+
+    /** Estimated memory usage in bytes */
+    std::size_t m_memoryUsage;
+
+    /** Initial number of hash table slots */
+    static constexpr std::size_t kInitialSlotCount = 64;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -15,6 +15,9 @@
 #include <siodb/common/stl_wrap/filesystem_wrapper.h>
 #include <siodb/common/utils/FsUtils.h>
 
+// STL headers
+#include <cstring>
+
 namespace siodb::iomgr::dbengine {
 
 Index::Index(Table& table, IndexType type, const std::string& name, const IndexKeyTraits& keyTraits,
@@ -72,6 +75,24 @@ std::string Index::makeIndexFilePath(std::uint64_t fileId) const
     return utils::constructPath(m_dataDir, kIndexFilePrefix, fileId, kDataFileExtension);
 }
 
+bool Index::getDeletedValue([[maybe_unused]] const void* key, [[maybe_unused]] void* value)
+{
+    return false;
+}
+
+bool Index::getNthNextKey(const void* key, std::uint64_t distance, void* nextKey)
+{
+    if (distance == 0) throw std::invalid_argument("Key distance must be positive");
+    if (!getNextKey(key, nextKey)) return false;
+    if (distance == 1) return true;
+    BinaryValue currentKey(m_keySize);
+    for (; distance > 1; --distance) {
+        std::memcpy(currentKey.data(), nextKey, m_keySize);
+        if (!getNextKey(currentKey.data(), nextKey)) return false;
+    }
+    return true;
+}
+
 // --------- internal -----------
 
 void Index::createInitializationFlagFile() const
@@ -15,6 +15,9 @@
 // Common project headers
 #include <siodb/common/utils/HelperMacros.h>
 
+// STL headers
+#include <optional>
+
 namespace siodb::iomgr::dbengine {
 
 class IndexColumn;
@@ -246,6 +249,15 @@ public:
      */
     virtual std::uint64_t getValue(const void* key, void* value, std::size_t count) = 0;
 
+    /**
+     * Gets value stored for the key marked as deleted.
+     * Default implementation reports that index doesn't keep deleted keys.
+     * @param key A key buffer.
+     * @param value An output buffer.
+     * @return true if key is marked as deleted and value copied, false otherwise.
+     */
+    virtual bool getDeletedValue(const void* key, void* value);
+
     /**
      * Counts how much values available for this key.
      * @param key A key buffer.
@@ -253,6 +265,12 @@ public:
      */
     virtual std::uint64_t count(const void* key) = 0;
 
+    /**
+     * Returns number of live (not deleted) keys in the index.
+     * @return Number of keys or std::nullopt if index can't provide it.
+     */
+    virtual std::optional<std::uint64_t> getKeyCount() = 0;
+
     /**
      * Returns minimum key in the index.
      * @param key Buffer for storing key.
@@ -297,6 +315,16 @@ public:
      */
     virtual bool getNextKey(const void* key, void* nextKey) = 0;
 
+    /**
+     * Returns key which follows given key by the given number of keys in the index.
+     * Default implementation steps through the keys one by one.
+     * @param key Current key.
+     * @param distance Number of keys to step over, must be positive.
+     * @param nextKey Buffer for storing next key.
+     * @return true if key obtained, false if index has less keys after current one.
+     */
+    virtual bool getNthNextKey(const void* key, std::uint64_t distance, void* nextKey);
+
 protected:
     /** Creates initialization flag file. */
     void createInitializationFlagFile() const;
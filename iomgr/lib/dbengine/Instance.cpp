@@ -58,9 +58,12 @@ Instance::Instance(const config::InstanceOptions& options)
     , m_databaseCache(options.m_ioManagerOptions.m_databaseCacheCapacity)
     , m_tableCacheCapacity(options.m_ioManagerOptions.m_tableCacheCapacity)
     , m_blockCacheCapacity(options.m_ioManagerOptions.m_blockCacheCapacity)
+    , m_groupByMemoryLimit(options.m_ioManagerOptions.m_groupByMemoryLimit * 1024 * 1024)
+    , m_statementCache(options.m_ioManagerOptions.m_statementCacheCapacity)
     , m_metadataFile()
     , m_allowCreatingUserTablesInSystemDatabase(
               options.m_generalOptions.m_allowCreatingUserTablesInSystemDatabase)
+    , m_columnWriterPool(options.m_ioManagerOptions.m_writerThreadNumber)
 {
     if (fs::exists(utils::constructPath(m_dataDir, kInitializationFlagFile)))
         loadInstanceData();
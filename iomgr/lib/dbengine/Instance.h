@@ -5,9 +5,11 @@
 #pragma once
 
 // Project headers
+#include "ColumnWriterPool.h"
 #include "DatabaseCache.h"
 #include "InstancePtr.h"
 #include "UserCache.h"
+#include "parser/StatementCache.h"
 #include "reg/DatabaseRegistry.h"
 #include "reg/UserRegistry.h"
 #include "../main/ClientSession.h"
@@ -113,6 +115,33 @@ public:
         return m_allowCreatingUserTablesInSystemDatabase;
     }
 
+    /**
+     * Returns parsed statement cache.
+     * @return Statement cache.
+     */
+    parser::StatementCache& getStatementCache() noexcept
+    {
+        return m_statementCache;
+    }
+
+    /**
+     * Returns memory limit of the single GROUP BY.
+     * @return Memory limit in bytes.
+     */
+    std::size_t getGroupByMemoryLimit() const noexcept
+    {
+        return m_groupByMemoryLimit;
+    }
+
+    /**
+     * Returns column writer thread pool.
+     * @return Column writer thread pool.
+     */
+    ColumnWriterPool& getColumnWriterPool() noexcept
+    {
+        return m_columnWriterPool;
+    }
+
     /**
      * Retuns number of known databases.
      * @return Number of databases.
@@ -475,12 +504,21 @@ private:
     /** Block cache capacity */
     const std::size_t m_blockCacheCapacity;
 
+    /** Memory limit of the single GROUP BY in bytes */
+    const std::size_t m_groupByMemoryLimit;
+
+    /** Parsed statement cache */
+    parser::StatementCache m_statementCache;
+
     /* Metadata file descriptor */
     FileDescriptorGuard m_metadataFile;
 
     /** Flag which allows creating user tables in the system database */
     const bool m_allowCreatingUserTablesInSystemDatabase;
 
+    /** Column writer thread pool */
+    ColumnWriterPool m_columnWriterPool;
+
     /** Session mutex */
     mutable std::mutex m_sessionMutex;
 
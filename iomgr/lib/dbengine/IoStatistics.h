@@ -0,0 +1,67 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// CRT headers
+#include <cstdint>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Column data I/O counters. Counters are maintained per thread, so the query
+ * profiler can attribute I/O to the operator by the counter difference.
+ */
+struct IoStatistics {
+    /** Number of data block reads */
+    std::uint64_t m_readCount = 0;
+
+    /** Number of bytes read from data blocks */
+    std::uint64_t m_readByteCount = 0;
+
+    /** Number of blocks found in the block cache */
+    std::uint64_t m_blockCacheHitCount = 0;
+
+    /** Number of blocks loaded into the block cache */
+    std::uint64_t m_blockCacheMissCount = 0;
+
+    /**
+     * Adds other counters to these ones.
+     * @param other Other counters.
+     * @return This object.
+     */
+    IoStatistics& operator+=(const IoStatistics& other) noexcept
+    {
+        m_readCount += other.m_readCount;
+        m_readByteCount += other.m_readByteCount;
+        m_blockCacheHitCount += other.m_blockCacheHitCount;
+        m_blockCacheMissCount += other.m_blockCacheMissCount;
+        return *this;
+    }
+
+    /**
+     * Returns counter differences.
+     * @param other Earlier counters.
+     * @return Counter differences.
+     */
+    IoStatistics operator-(const IoStatistics& other) const noexcept
+    {
+        return IoStatistics {m_readCount - other.m_readCount,
+                m_readByteCount - other.m_readByteCount,
+                m_blockCacheHitCount - other.m_blockCacheHitCount,
+                m_blockCacheMissCount - other.m_blockCacheMissCount};
+    }
+};
+
+/**
+ * Returns I/O counters of the current thread.
+ * @return I/O counters of the current thread.
+ */
+inline IoStatistics& getThreadIoStatistics() noexcept
+{
+    thread_local IoStatistics statistics;
+    return statistics;
+}
+
+}  // namespace siodb::iomgr::dbengine
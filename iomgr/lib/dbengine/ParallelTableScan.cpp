@@ -0,0 +1,345 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "ParallelTableScan.h"
+
+// Project headers
+#include "Index.h"
+#include "TransactionSnapshot.h"
+
+// Common project headers
+#include <siodb/common/utils/PlainBinaryEncoding.h>
+
+// STL headers
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+
+namespace siodb::iomgr::dbengine {
+
+struct ParallelTableScan::State {
+    /** Table */
+    TablePtr m_table;
+
+    /** Table alias */
+    std::string m_tableAlias;
+
+    /** Transaction snapshot of the data set */
+    TransactionSnapshotPtr m_snapshot;
+
+    /** Column positions, names and aliases of the data set */
+    std::vector<std::tuple<std::size_t, std::string, std::string>> m_columns;
+
+    /** Row handler */
+    RowHandler m_rowHandler;
+
+    /** Indication that morsel scan statistics are collected */
+    bool m_collectStatistics;
+
+    /** Minimum TRID */
+    std::uint64_t m_minTrid;
+
+    /** Maximum TRID */
+    std::uint64_t m_maxTrid;
+
+    /** Number of morsels */
+    std::size_t m_morselCount;
+
+    /** Maximum number of processed but not consumed morsels */
+    std::size_t m_maxPendingMorselCount;
+
+    /** Number of collected rows after which scan stops */
+    std::optional<std::uint64_t> m_maxRowCount;
+
+    /** Number of processed morsels, which are not preceded by unprocessed morsels */
+    std::size_t m_processedMorselPrefixSize;
+
+    /** Number of rows collected from the processed morsel prefix */
+    std::uint64_t m_processedMorselPrefixRowCount;
+
+    /** State access synchronization object */
+    std::mutex m_mutex;
+
+    /** Signals that morsel is processed */
+    std::condition_variable m_morselProcessedCond;
+
+    /** Index of the next unclaimed morsel */
+    std::size_t m_nextMorselIndex;
+
+    /** Index of the next morsel which result should be consumed */
+    std::size_t m_nextResultIndex;
+
+    /** Number of morsels being processed */
+    std::size_t m_activeMorselCount;
+
+    /** Number of started worker requests */
+    std::size_t m_workerCount;
+
+    /** Processed morsel results and errors */
+    std::map<std::size_t, std::pair<MorselResult, std::exception_ptr>> m_results;
+
+    /** Indication that scan should be stopped */
+    std::atomic<bool> m_stopRequested;
+};
+
+struct ParallelTableScan::ThreadContext {
+    /**
+     * Initializes object of class ThreadContext.
+     * @param dataSet Table data set.
+     */
+    explicit ThreadContext(const std::shared_ptr<TableDataSet>& dataSet)
+        : m_dataSet(dataSet)
+        , m_context(std::vector<DataSetPtr> {dataSet})
+    {
+    }
+
+    /** Table data set */
+    const std::shared_ptr<TableDataSet> m_dataSet;
+
+    /** Expression evaluation context */
+    requests::DatabaseContext m_context;
+};
+
+class ParallelTableScan::ScanRequest final : public IORequest {
+public:
+    /**
+     * Initializes object of class ScanRequest.
+     * @param state Scan state.
+     */
+    explicit ScanRequest(const std::shared_ptr<State>& state) noexcept
+        : m_state(state)
+    {
+    }
+
+    /** Processes morsels while there are morsels to claim. */
+    void execute() override
+    {
+        std::unique_ptr<ThreadContext> threadContext;
+        while (processNextMorsel(*m_state, threadContext, true)) {
+        }
+        std::lock_guard lock(m_state->m_mutex);
+        --m_state->m_workerCount;
+    }
+
+private:
+    /** Scan state */
+    const std::shared_ptr<State> m_state;
+};
+
+ParallelTableScan::ParallelTableScan(UniversalWorkerPool& workerThreadPool,
+        const TableDataSet& dataSet, RowHandler&& rowHandler, bool collectStatistics,
+        std::optional<std::uint64_t> maxRowCount)
+    : m_workerThreadPool(workerThreadPool)
+    , m_state(std::make_shared<State>())
+{
+    auto& state = *m_state;
+    state.m_table = dataSet.getTable().shared_from_this();
+    state.m_tableAlias = dataSet.getAlias();
+    state.m_snapshot = dataSet.getSnapshot();
+    state.m_columns.reserve(dataSet.getColumnCount());
+    for (std::size_t i = 0, n = dataSet.getColumnCount(); i != n; ++i) {
+        state.m_columns.emplace_back(dataSet.getColumnPosition(i), dataSet.getColumnName(i),
+                dataSet.getColumnAlias(i));
+    }
+    state.m_rowHandler = std::move(rowHandler);
+    state.m_collectStatistics = collectStatistics;
+    std::tie(state.m_minTrid, state.m_maxTrid) = getTridRange(dataSet);
+    state.m_morselCount =
+            state.m_maxTrid == 0 ? 0 : (state.m_maxTrid - state.m_minTrid) / kMorselSize + 1;
+    state.m_maxPendingMorselCount =
+            (m_workerThreadPool.getSize() + 1) * kMaxPendingMorselCountPerThread;
+    state.m_maxRowCount = maxRowCount;
+    state.m_processedMorselPrefixSize = 0;
+    state.m_processedMorselPrefixRowCount = 0;
+    state.m_nextMorselIndex = 0;
+    state.m_nextResultIndex = 0;
+    state.m_activeMorselCount = 0;
+    state.m_workerCount = 0;
+    state.m_stopRequested = maxRowCount && *maxRowCount == 0;
+    startWorkers();
+}
+
+ParallelTableScan::~ParallelTableScan()
+{
+    // Worker requests may outlive this object, but they must not use row handler anymore
+    std::unique_lock lock(m_state->m_mutex);
+    m_state->m_stopRequested = true;
+    m_state->m_morselProcessedCond.wait(
+            lock, [this] { return m_state->m_activeMorselCount == 0; });
+}
+
+bool ParallelTableScan::isApplicable(
+        const UniversalWorkerPool* workerThreadPool, const std::vector<DataSetPtr>& dataSets)
+{
+    if (!workerThreadPool || workerThreadPool->getSize() == 0 || dataSets.size() != 1)
+        return false;
+    const auto tableDataSet = dynamic_cast<const TableDataSet*>(dataSets.front().get());
+    if (!tableDataSet) return false;
+    // Single morsel is processed faster by the calling thread alone
+    const auto [minTrid, maxTrid] = getTridRange(*tableDataSet);
+    return maxTrid - minTrid >= kMorselSize;
+}
+
+bool ParallelTableScan::getNextMorselResult(MorselResult& result)
+{
+    auto& state = *m_state;
+    std::pair<MorselResult, std::exception_ptr> morselResult;
+    while (true) {
+        {
+            std::lock_guard lock(state.m_mutex);
+            if (state.m_nextResultIndex == state.m_morselCount) return false;
+            const auto it = state.m_results.find(state.m_nextResultIndex);
+            if (it != state.m_results.end()) {
+                morselResult = std::move(it->second);
+                state.m_results.erase(it);
+                ++state.m_nextResultIndex;
+                break;
+            }
+            // Remaining morsels are not needed when scan is stopped by the row count
+            if (state.m_stopRequested) return false;
+        }
+
+        // Help worker threads while result is not ready
+        if (processNextMorsel(state, m_threadContext, false)) continue;
+
+        // Next morsel is being processed by a worker thread
+        std::unique_lock lock(state.m_mutex);
+        state.m_morselProcessedCond.wait(lock, [&state] {
+            return state.m_stopRequested || state.m_results.count(state.m_nextResultIndex) > 0;
+        });
+    }
+
+    if (morselResult.second) std::rethrow_exception(morselResult.second);
+    result = std::move(morselResult.first);
+    startWorkers();
+    return true;
+}
+
+// ---- internals ----
+
+void ParallelTableScan::startWorkers()
+{
+    std::size_t newWorkerCount = 0;
+    {
+        auto& state = *m_state;
+        std::lock_guard lock(state.m_mutex);
+        // Calling thread always processes one of unclaimed morsels
+        const auto unclaimedMorselCount = state.m_morselCount - state.m_nextMorselIndex;
+        const auto requiredWorkerCount = std::min<std::size_t>(m_workerThreadPool.getSize(),
+                unclaimedMorselCount > 0 ? unclaimedMorselCount - 1 : 0);
+        if (requiredWorkerCount <= state.m_workerCount) return;
+        newWorkerCount = requiredWorkerCount - state.m_workerCount;
+        state.m_workerCount = requiredWorkerCount;
+    }
+    for (std::size_t i = 0; i < newWorkerCount; ++i)
+        m_workerThreadPool.addRequest(std::make_unique<ScanRequest>(m_state));
+}
+
+bool ParallelTableScan::processNextMorsel(
+        State& state, std::unique_ptr<ThreadContext>& threadContext, bool isWorker)
+{
+    std::size_t morselIndex = 0;
+    {
+        std::lock_guard lock(state.m_mutex);
+        if (state.m_stopRequested || state.m_nextMorselIndex == state.m_morselCount
+                || state.m_nextMorselIndex
+                           >= state.m_nextResultIndex + state.m_maxPendingMorselCount)
+            return false;
+        morselIndex = state.m_nextMorselIndex++;
+        ++state.m_activeMorselCount;
+    }
+
+    std::pair<MorselResult, std::exception_ptr> morselResult;
+    morselResult.first.m_processedByWorker = isWorker;
+    try {
+        scanMorsel(state, threadContext, morselIndex, morselResult.first);
+    } catch (...) {
+        morselResult.second = std::current_exception();
+    }
+
+    {
+        std::lock_guard lock(state.m_mutex);
+        state.m_results.emplace(morselIndex, std::move(morselResult));
+        --state.m_activeMorselCount;
+
+        // Stop when morsels preceding unprocessed ones already provide enough rows.
+        // Results consumed by the calling thread are always inside of the prefix.
+        if (state.m_maxRowCount) {
+            auto it = state.m_results.find(state.m_processedMorselPrefixSize);
+            while (it != state.m_results.end() && it->first == state.m_processedMorselPrefixSize) {
+                state.m_processedMorselPrefixRowCount += it->second.first.m_rows.size();
+                ++state.m_processedMorselPrefixSize;
+                ++it;
+            }
+            if (state.m_processedMorselPrefixRowCount >= *state.m_maxRowCount)
+                state.m_stopRequested = true;
+        }
+    }
+    state.m_morselProcessedCond.notify_all();
+    return true;
+}
+
+void ParallelTableScan::scanMorsel(State& state, std::unique_ptr<ThreadContext>& threadContext,
+        std::size_t morselIndex, MorselResult& result)
+{
+    if (!threadContext) {
+        auto dataSet = std::make_shared<TableDataSet>(state.m_table, state.m_tableAlias);
+        dataSet->setSnapshot(state.m_snapshot);
+        for (const auto& [position, name, alias] : state.m_columns)
+            dataSet->emplaceColumnInfo(position, name, alias);
+        threadContext = std::make_unique<ThreadContext>(dataSet);
+    }
+
+    ExecutionTimer timer(state.m_collectStatistics ? &result.m_scanStatistics : nullptr, true);
+
+    const auto firstTrid = state.m_minTrid + morselIndex * kMorselSize;
+    const auto lastTrid = std::min(state.m_maxTrid, firstTrid + (kMorselSize - 1));
+
+    // Collect master column record addresses under the table lock, which is taken
+    // by the writers too, while rows are read concurrently
+    const auto mcrAddresses = state.m_table->getMasterColumnRecordAddresses(
+            firstTrid, lastTrid, state.m_snapshot.get());
+
+    for (const auto& mcrAddress : mcrAddresses) {
+        if (state.m_stopRequested) break;
+        // Single morsel never needs to provide more rows than whole scan
+        if (state.m_maxRowCount && result.m_rows.size() >= *state.m_maxRowCount) break;
+        if (!threadContext->m_dataSet->moveToMasterColumnRecord(mcrAddress)) continue;
+        ++result.m_scanStatistics.m_rowCount;
+        state.m_rowHandler(threadContext->m_context, result);
+    }
+}
+
+std::pair<std::uint64_t, std::uint64_t> ParallelTableScan::getTridRange(
+        const TableDataSet& dataSet)
+{
+    const auto masterColumn = dataSet.getTable().getMasterColumn();
+    if (dataSet.getSnapshot() && dataSet.getSnapshot()->isHistorical()) {
+        // Rows deleted long ago are outside of the index and the deleted row log
+        const auto lastTrid = masterColumn->getLastUserTrid();
+        return lastTrid == 0 ? std::make_pair(std::uint64_t(0), std::uint64_t(0))
+                             : std::make_pair(std::uint64_t(1), lastTrid);
+    }
+
+    const auto index = masterColumn->getMasterColumnMainIndex();
+    std::uint8_t key[16];
+    std::uint64_t minTrid = 0, maxTrid = 0;
+    if (index->getMinKey(key) && index->getMaxKey(&key[8])) {
+        ::pbeDecodeUInt64(key, &minTrid);
+        ::pbeDecodeUInt64(&key[8], &maxTrid);
+    }
+    if (minTrid > maxTrid) maxTrid = minTrid = 0;
+    if (dataSet.getSnapshot()) {
+        // Rows deleted after snapshot are outside of the index
+        if (const auto deletedTridRange = dataSet.getTable().getDeletedRowIdRange()) {
+            minTrid = maxTrid == 0 ? deletedTridRange->first
+                                   : std::min(minTrid, deletedTridRange->first);
+            maxTrid = std::max(maxTrid, deletedTridRange->second);
+        }
+    }
+    return std::make_pair(minTrid, maxTrid);
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,151 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "HashAggregator.h"
+#include "QueryProfile.h"
+#include "TableDataSet.h"
+#include "parser/DatabaseContext.h"
+#include "../main/UniversalWorkerPool.h"
+
+// STL headers
+#include <functional>
+#include <optional>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Parallel scan of a single table. TRID range of the table is split into morsels,
+ * which are read and processed by the worker threads and by the calling thread.
+ * Morsel results are returned to the calling thread in the TRID order,
+ * so the combined result is the same as of the sequential scan.
+ */
+class ParallelTableScan final {
+public:
+    /** Result of the morsel processing */
+    struct MorselResult {
+        /** Rows collected from the morsel */
+        std::vector<std::vector<Variant>> m_rows;
+
+        /** Partial aggregation result collected from the morsel */
+        std::unique_ptr<HashAggregator> m_aggregator;
+
+        /** Rows read, time and I/O of the morsel processing, if statistics are collected */
+        ExecutionStatistics m_scanStatistics;
+
+        /** Statistics collected by the row handler */
+        ExecutionStatistics m_rowHandlerStatistics;
+
+        /** Indication that morsel was processed by a worker thread */
+        bool m_processedByWorker = false;
+    };
+
+    /**
+     * Row handler. Called for each existing row of the morsel on the thread
+     * which processes the morsel. Current row is available via the context.
+     */
+    using RowHandler =
+            std::function<void(requests::DatabaseContext& context, MorselResult& result)>;
+
+public:
+    /**
+     * Initializes object of class ParallelTableScan and starts worker threads.
+     * @param workerThreadPool Worker thread pool.
+     * @param dataSet Table data set, which provides table and column information.
+     * @param rowHandler Row handler, must be safe to call concurrently.
+     * @param collectStatistics Indication that morsel scan statistics should be collected.
+     * @param maxRowCount Number of rows collected into morsel results, after which
+     *                    scan stops. Rows of the morsels are counted in the TRID order.
+     */
+    ParallelTableScan(UniversalWorkerPool& workerThreadPool, const TableDataSet& dataSet,
+            RowHandler&& rowHandler, bool collectStatistics = false,
+            std::optional<std::uint64_t> maxRowCount = std::nullopt);
+
+    /** Stops scan and waits until morsels being processed are finished. */
+    ~ParallelTableScan();
+
+    DECLARE_NONCOPYABLE(ParallelTableScan);
+
+    /**
+     * Returns indication that data sets can be scanned in parallel.
+     * @param workerThreadPool Worker thread pool, may be nullptr.
+     * @param dataSets Data sets.
+     * @return true if parallel scan can be used, false otherwise.
+     */
+    static bool isApplicable(const UniversalWorkerPool* workerThreadPool,
+            const std::vector<DataSetPtr>& dataSets);
+
+    /**
+     * Waits for the result of the next morsel in the TRID order. Calling thread
+     * processes morsels itself while the result is not ready.
+     * @param result Morsel result.
+     * @return true if result is available, false if all morsels are processed
+     *         or required number of rows is already returned.
+     * @throw DatabaseError and other exceptions thrown while processing morsel.
+     */
+    bool getNextMorselResult(MorselResult& result);
+
+private:
+    /** Scan state, which is shared with the worker threads */
+    struct State;
+
+    /** Scan context of the single thread */
+    struct ThreadContext;
+
+    /** IO request, which processes morsels on the worker thread */
+    class ScanRequest;
+
+private:
+    /**
+     * Starts worker threads, so that all unclaimed morsels are covered.
+     */
+    void startWorkers();
+
+    /**
+     * Claims next morsel and processes it.
+     * @param state Scan state.
+     * @param threadContext Scan context of the current thread.
+     * @param isWorker Indication that current thread is a worker thread.
+     * @return true if morsel was processed, false if there is no morsel to claim.
+     */
+    static bool processNextMorsel(
+            State& state, std::unique_ptr<ThreadContext>& threadContext, bool isWorker);
+
+    /**
+     * Reads rows of the morsel and passes them to the row handler.
+     * @param state Scan state.
+     * @param threadContext Scan context of the current thread.
+     * @param morselIndex Morsel index.
+     * @param result Morsel result.
+     */
+    static void scanMorsel(State& state, std::unique_ptr<ThreadContext>& threadContext,
+            std::size_t morselIndex, MorselResult& result);
+
+    /**
+     * Returns TRID range of the table.
+     * @param dataSet Table data set.
+     * @return Pair of min and max TRID, max TRID is zero if table is empty.
+     */
+    static std::pair<std::uint64_t, std::uint64_t> getTridRange(const TableDataSet& dataSet);
+
+private:
+    /** Worker thread pool */
+    UniversalWorkerPool& m_workerThreadPool;
+
+    /** Scan state */
+    const std::shared_ptr<State> m_state;
+
+    /** Scan context of the calling thread */
+    std::unique_ptr<ThreadContext> m_threadContext;
+
+    /** Number of TRIDs in the morsel */
+    static constexpr std::uint64_t kMorselSize = 16384;
+
+    /** Maximum number of processed but not consumed morsels per thread */
+    static constexpr std::size_t kMaxPendingMorselCountPerThread = 2;
+};
+
+}  // namespace siodb::iomgr::dbengine
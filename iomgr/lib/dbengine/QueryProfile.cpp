@@ -0,0 +1,51 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "QueryProfile.h"
+
+// CRT headers
+#include <ctime>
+
+namespace siodb::iomgr::dbengine {
+
+ExecutionStatistics& ExecutionStatistics::operator+=(const ExecutionStatistics& other) noexcept
+{
+    m_rowCount += other.m_rowCount;
+    m_wallTime += other.m_wallTime;
+    m_cpuTime += other.m_cpuTime;
+    m_evaluationTime += other.m_evaluationTime;
+    m_ioStatistics += other.m_ioStatistics;
+    return *this;
+}
+
+std::uint64_t ExecutionTimer::getThreadCpuTime() noexcept
+{
+    struct timespec ts;
+    if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0;
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+void QueryProfile::setQueryTotals(const ExecutionStatistics& queryStatistics)
+{
+    if (m_operators.empty()) return;
+    auto& root = m_operators.front();
+    root.m_wallTime = queryStatistics.m_wallTime;
+    root.m_cpuTime += queryStatistics.m_cpuTime;
+    for (auto it = m_operators.cbegin() + 1; it != m_operators.cend(); ++it) {
+        root.m_evaluationTime += it->m_evaluationTime;
+        root.m_ioStatistics += it->m_ioStatistics;
+    }
+}
+
+std::vector<std::size_t> QueryProfile::getOperatorDepths() const
+{
+    // Parent is always added before its children
+    std::vector<std::size_t> depths;
+    depths.reserve(m_operators.size());
+    for (const auto& op : m_operators)
+        depths.push_back(op.m_parentId == kNoParent ? 0 : depths.at(op.m_parentId) + 1);
+    return depths;
+}
+
+}  // namespace siodb::iomgr::dbengine
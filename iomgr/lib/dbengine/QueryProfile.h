@@ -0,0 +1,258 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "IoStatistics.h"
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace siodb::iomgr::dbengine {
+
+/** Execution statistics of the query operator */
+struct ExecutionStatistics {
+    /** Number of rows produced */
+    std::uint64_t m_rowCount = 0;
+
+    /** Wall time in nanoseconds */
+    std::uint64_t m_wallTime = 0;
+
+    /** CPU time in nanoseconds, measured only for some operators */
+    std::uint64_t m_cpuTime = 0;
+
+    /** Time spent in the expression evaluation in nanoseconds */
+    std::uint64_t m_evaluationTime = 0;
+
+    /** Column data I/O counters */
+    IoStatistics m_ioStatistics;
+
+    /**
+     * Adds other statistics to this one.
+     * @param other Other statistics.
+     * @return This object.
+     */
+    ExecutionStatistics& operator+=(const ExecutionStatistics& other) noexcept;
+};
+
+/**
+ * Measures wall time and I/O of the scope and adds them to the execution statistics.
+ * Does nothing if statistics are not collected.
+ */
+class ExecutionTimer final {
+public:
+    /**
+     * Initializes object of class ExecutionTimer and starts measurement.
+     * @param statistics Execution statistics, nullptr if they are not collected.
+     * @param measureCpuTime Indication that CPU time of the current thread
+     *                       should be measured too.
+     */
+    explicit ExecutionTimer(ExecutionStatistics* statistics, bool measureCpuTime = false) noexcept
+        : m_statistics(statistics)
+        , m_measureCpuTime(measureCpuTime && statistics)
+    {
+        if (!m_statistics) return;
+        m_ioStatistics = getThreadIoStatistics();
+        if (m_measureCpuTime) m_startCpuTime = getThreadCpuTime();
+        m_startTime = std::chrono::steady_clock::now();
+    }
+
+    /** Stops measurement and records results */
+    ~ExecutionTimer()
+    {
+        if (!m_statistics) return;
+        m_statistics->m_wallTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_startTime)
+                                            .count();
+        if (m_measureCpuTime) m_statistics->m_cpuTime += getThreadCpuTime() - m_startCpuTime;
+        m_statistics->m_ioStatistics += getThreadIoStatistics() - m_ioStatistics;
+    }
+
+    DECLARE_NONCOPYABLE(ExecutionTimer);
+
+    /**
+     * Returns CPU time of the current thread.
+     * @return CPU time in nanoseconds.
+     */
+    static std::uint64_t getThreadCpuTime() noexcept;
+
+private:
+    /** Execution statistics */
+    ExecutionStatistics* const m_statistics;
+
+    /** Indication that CPU time is measured */
+    const bool m_measureCpuTime;
+
+    /** I/O counters at start */
+    IoStatistics m_ioStatistics;
+
+    /** Thread CPU time at start */
+    std::uint64_t m_startCpuTime = 0;
+
+    /** Wall time at start */
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+/**
+ * Measures expression evaluation time of the scope and adds it to the execution statistics.
+ * Does nothing if statistics are not collected.
+ */
+class EvaluationTimer final {
+public:
+    /**
+     * Initializes object of class EvaluationTimer and starts measurement.
+     * @param statistics Execution statistics, nullptr if they are not collected.
+     */
+    explicit EvaluationTimer(ExecutionStatistics* statistics) noexcept
+        : m_statistics(statistics)
+    {
+        if (m_statistics) m_startTime = std::chrono::steady_clock::now();
+    }
+
+    /** Stops measurement and records result */
+    ~EvaluationTimer()
+    {
+        if (!m_statistics) return;
+        m_statistics->m_evaluationTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_startTime)
+                                                  .count();
+    }
+
+    DECLARE_NONCOPYABLE(EvaluationTimer);
+
+private:
+    /** Execution statistics */
+    ExecutionStatistics* const m_statistics;
+
+    /** Wall time at start */
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+/**
+ * Query execution plan as operator tree, optionally with the execution statistics
+ * of each operator, which are collected by EXPLAIN ANALYZE. Operator statistics
+ * are exclusive, i.e. don't include statistics of the child operators, except for
+ * the root operator, which reports totals of the query.
+ */
+class QueryProfile final {
+public:
+    /** Query plan operator */
+    struct Operator : public ExecutionStatistics {
+        /**
+         * Initializes object of class Operator.
+         * @param parentId Parent operator ID.
+         * @param name Operator name.
+         * @param details Operator details.
+         * @param hasCpuTime Indication that CPU time is measured for the operator.
+         */
+        Operator(std::size_t parentId, std::string&& name, std::string&& details,
+                bool hasCpuTime) noexcept
+            : m_parentId(parentId)
+            , m_name(std::move(name))
+            , m_details(std::move(details))
+            , m_hasCpuTime(hasCpuTime)
+        {
+        }
+
+        /** Parent operator ID, kNoParent for the root operator */
+        std::size_t m_parentId;
+
+        /** Operator name */
+        std::string m_name;
+
+        /** Operator details */
+        std::string m_details;
+
+        /** Indication that CPU time is measured for the operator */
+        bool m_hasCpuTime;
+    };
+
+    /** Parent ID of the root operator */
+    static constexpr std::size_t kNoParent = static_cast<std::size_t>(-1);
+
+public:
+    /**
+     * Initializes object of class QueryProfile.
+     * @param analyze Indication that query should be executed to collect statistics.
+     */
+    explicit QueryProfile(bool analyze) noexcept
+        : m_analyze(analyze)
+    {
+    }
+
+    DECLARE_NONCOPYABLE(QueryProfile);
+
+    /**
+     * Returns indication that query should be executed to collect statistics.
+     * @return true if query should be executed, false if only plan is required.
+     */
+    bool isAnalyze() const noexcept
+    {
+        return m_analyze;
+    }
+
+    /**
+     * Adds operator to the plan.
+     * @param parentId Parent operator ID, kNoParent for the root operator.
+     * @param name Operator name.
+     * @param details Operator details.
+     * @param hasCpuTime Indication that CPU time is measured for the operator.
+     * @return Operator ID.
+     */
+    std::size_t addOperator(std::size_t parentId, std::string&& name, std::string&& details,
+            bool hasCpuTime = false)
+    {
+        m_operators.emplace_back(parentId, std::move(name), std::move(details), hasCpuTime);
+        return m_operators.size() - 1;
+    }
+
+    /**
+     * Returns operator statistics if statistics are collected.
+     * Pointer is valid until next operator is added.
+     * @param operatorId Operator ID.
+     * @return Operator statistics or nullptr if statistics are not collected.
+     */
+    ExecutionStatistics* getStatistics(std::size_t operatorId) noexcept
+    {
+        return m_analyze ? &m_operators[operatorId] : nullptr;
+    }
+
+    /**
+     * Returns operators in the order they were added.
+     * @return Operators.
+     */
+    const std::vector<Operator>& getOperators() const noexcept
+    {
+        return m_operators;
+    }
+
+    /**
+     * Completes statistics of the root operator, which represents whole query: sets wall time
+     * and adds CPU time of the calling thread, adds expression evaluation time and I/O
+     * of all other operators.
+     * @param queryStatistics Wall time, CPU time of the thread which executed query.
+     */
+    void setQueryTotals(const ExecutionStatistics& queryStatistics);
+
+    /**
+     * Returns operator depths in the tree, root operator has depth 0.
+     * @return Operator depths.
+     */
+    std::vector<std::size_t> getOperatorDepths() const;
+
+private:
+    /** Indication that query should be executed to collect statistics */
+    const bool m_analyze;
+
+    /** Plan operators */
+    std::vector<Operator> m_operators;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,51 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "RowVersionIndex.h"
+
+// Project headers
+#include "Column.h"
+#include "MasterColumnRecord.h"
+
+namespace siodb::iomgr::dbengine {
+
+RowVersionIndex::RowVersionIndex(std::size_t capacity)
+    : m_rowVersions(capacity)
+{
+}
+
+RowVersionListPtr RowVersionIndex::getRowVersions(
+        Column& masterColumn, std::uint64_t trid, const ColumnDataAddress& mcrAddress)
+{
+    RowVersionListPtr cachedVersions;
+    {
+        std::lock_guard lock(m_mutex);
+        if (auto versions = m_rowVersions.get(trid)) cachedVersions = std::move(*versions);
+    }
+    if (cachedVersions && cachedVersions->front().m_mcrAddress == mcrAddress)
+        return cachedVersions;
+
+    // Records are read without lock, concurrent readers of the same row
+    // may both read it, last one stores its result.
+    auto versions = std::make_shared<RowVersionList>();
+    MasterColumnRecord mcr;
+    for (auto addr = mcrAddress; !addr.isNullValueAddress();
+            addr = mcr.getPreviousVersionAddress()) {
+        if (cachedVersions && cachedVersions->front().m_mcrAddress == addr) {
+            versions->insert(versions->end(), cachedVersions->cbegin(), cachedVersions->cend());
+            break;
+        }
+        masterColumn.readMasterColumnRecord(addr, mcr);
+        versions->push_back(RowVersion {mcr.getTransactionId(), mcr.getUpdateTimestamp(), addr,
+                mcr.getAtomicOperationType()});
+    }
+
+    if (!versions->empty()) {
+        std::lock_guard lock(m_mutex);
+        m_rowVersions.emplace(trid, versions, true);
+    }
+    return versions;
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,81 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "ColumnDataAddress.h"
+#include "DmlOperationType.h"
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+#include <siodb/common/utils/UnorderedLruCache.h>
+
+// STL headers
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace siodb::iomgr::dbengine {
+
+class Column;
+
+/** Version of the table row */
+struct RowVersion {
+    /** ID of the transaction which created version */
+    std::uint64_t m_transactionId;
+
+    /** Version timestamp */
+    std::uint64_t m_timestamp;
+
+    /** Version master column record address */
+    ColumnDataAddress m_mcrAddress;
+
+    /** Operation which created version */
+    DmlOperationType m_operationType;
+};
+
+/** Row versions, newest first */
+using RowVersionList = std::vector<RowVersion>;
+
+/** Row versions shared pointer */
+using RowVersionListPtr = std::shared_ptr<const RowVersionList>;
+
+/**
+ * In-memory index of the row versions of a table. Each row version is a master column record
+ * linked to the previous one, so finding version at some point of the past requires
+ * reading whole chain of records. Index keeps decoded chains of the recently accessed rows.
+ * Cached chain is valid while its newest version is the current version of the row,
+ * otherwise only versions written after it are read and prepended.
+ */
+class RowVersionIndex final {
+public:
+    /**
+     * Initializes object of class RowVersionIndex.
+     * @param capacity Maximum number of rows with cached versions.
+     */
+    explicit RowVersionIndex(std::size_t capacity);
+
+    DECLARE_NONCOPYABLE(RowVersionIndex);
+
+    /**
+     * Returns all versions of the row.
+     * @param masterColumn Master column of the table.
+     * @param trid Table row ID.
+     * @param mcrAddress Address of the current master column record of the row.
+     * @return Row versions, newest first.
+     * @throw DatabaseError if master column record can't be read.
+     */
+    RowVersionListPtr getRowVersions(
+            Column& masterColumn, std::uint64_t trid, const ColumnDataAddress& mcrAddress);
+
+private:
+    /** Cache access synchronization object */
+    std::mutex m_mutex;
+
+    /** Cached row versions by TRID */
+    utils::unordered_lru_cache<std::uint64_t, RowVersionListPtr> m_rowVersions;
+};
+
+}  // namespace siodb::iomgr::dbengine
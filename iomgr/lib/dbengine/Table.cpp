@@ -12,6 +12,7 @@
 #include "Index.h"
 #include "TableColumns.h"
 #include "ThrowDatabaseError.h"
+#include "TransactionSnapshot.h"
 #include "parser/EmptyContext.h"
 
 // Common project headers
@@ -20,6 +21,11 @@
 #include <siodb/common/utils/FsUtils.h>
 #include <siodb/common/utils/PlainBinaryEncoding.h>
 
+// STL headers
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
 namespace siodb::iomgr::dbengine {
 
 Table::Table(
@@ -33,7 +39,10 @@ Table::Table(
               utils::constructPath(database.getDataDir(), kTableDataDirPrefix, m_id), true))
     , m_columnSetCache(kColumnSetCacheCapacity)
     , m_currentColumnSet(createColumnSetUnlocked())
+    , m_currentColumns(std::make_shared<TableColumns>())
     , m_constraintCache(*this, kConstraintCacheCapacity)
+    , m_deletedRowPruneThreshold(kMinDeletedRowPruneThreshold)
+    , m_rowVersionIndex(kRowVersionIndexCapacity)
     , m_firstUserTrid(firstUserTrid)
 {
     createMasterColumn(firstUserTrid);
@@ -50,7 +59,10 @@ Table::Table(Database& database, const TableRecord& tableRecord)
               utils::constructPath(database.getDataDir(), kTableDataDirPrefix, m_id), false))
     , m_columnSetCache(kColumnSetCacheCapacity)
     , m_currentColumnSet(getColumnSetChecked(tableRecord.m_currentColumnSetId))
+    , m_currentColumns(std::make_shared<TableColumns>())
     , m_constraintCache(*this, kConstraintCacheCapacity)
+    , m_deletedRowPruneThreshold(kMinDeletedRowPruneThreshold)
+    , m_rowVersionIndex(kRowVersionIndexCapacity)
     , m_firstUserTrid(tableRecord.m_firstUserTrid)
 {
     // Populate columns from the current column set
@@ -80,8 +92,8 @@ std::uint32_t Table::getColumnCurrentPosition(std::uint64_t columnId) const
 
 std::vector<ColumnPtr> Table::getColumnsOrderedByPosition() const
 {
-    std::lock_guard lock(m_mutex);
-    const auto& index = m_currentColumns.byPosition();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byPosition();
     std::vector<ColumnPtr> columns;
     columns.reserve(index.size());
     // Columns are already sorted in index
@@ -130,14 +142,15 @@ ColumnPtr Table::createColumn(const ColumnSpecification& columnSpec, std::uint64
             m_currentColumnSet->addColumn(*column->getCurrentColumnDefinition());
 
     // Register column
-    m_currentColumns.emplace(TableColumn(column, columnSetColumnId, m_currentColumns.size()));
+    auto currentColumns = std::make_shared<TableColumns>(*m_currentColumns);
+    currentColumns->emplace(TableColumn(column, columnSetColumnId, currentColumns->size()));
+    setCurrentColumnsUnlocked(std::move(currentColumns));
     m_database.registerColumn(*column);
     return column;
 }
 
 IndexPtr Table::getMasterColumnMainIndex() const
 {
-    std::lock_guard lock(m_mutex);
     return m_masterColumn->getMasterColumnMainIndex();
 }
 
@@ -173,7 +186,7 @@ std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::insertRow(
         const TransactionParameters& transactionParameters, std::uint64_t customTrid)
 {
     std::lock_guard lock(m_mutex);
-    const auto columnCount = m_currentColumns.size();
+    const auto columnCount = m_currentColumns->size();
 
     // Check that number of columns matches number of values
     if (columnNames.size() != columnValues.size()) {
@@ -187,49 +200,10 @@ std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::insertRow(
                 m_name, columnValues.size(), columnCount - 1);
     }
 
-    auto columns = getColumnsOrderedByPosition();
-    std::vector<Variant> orderedColumnValues(columns.size() - 1);
-
-    // vector<bool> was always suboptimal, so use vector<char>
-    std::vector<char> columnPresent(columns.size());
-    std::vector<CompoundDatabaseError::ErrorRecord> errors;
-    const auto& columnsByName = m_currentColumns.byName();
-
-    // Check columns
-    for (std::size_t i = 0, n = columnNames.size(); i < n; ++i) {
-        const auto& columnName = columnNames[i];
-        if (!isValidDatabaseObjectName(columnName)) {
-            errors.push_back(std::move(
-                    makeDatabaseError(IOManagerMessageId::kErrorInvalidColumnName, columnName)));
-            continue;
-        }
-
-        const auto it = columnsByName.find(columnName);
-        if (it == columnsByName.end()) {
-            errors.push_back(makeDatabaseError(IOManagerMessageId::kErrorColumnDoesNotExist,
-                    columns[0]->getTable().getDatabaseName(), columns[0]->getTableName(),
-                    columnName));
-            continue;
-        }
-
-        if (it->m_column->isMasterColumn()) {
-            errors.push_back(
-                    makeDatabaseError(IOManagerMessageId::kErrorCannotInsertIntoMasterColumn));
-            continue;
-        }
-
-        auto& columnPresentFlag = columnPresent.at(it->m_column->getCurrentPosition());
-        if (columnPresentFlag) {
-            errors.push_back(makeDatabaseError(
-                    IOManagerMessageId::kErrorInsertDuplicateColumnName, columnName));
-            continue;
-        }
-
-        columnPresentFlag = 1;
-        orderedColumnValues[it->m_position - 1] = std::move(columnValues[i]);
-    }
-
-    if (!errors.empty()) throw CompoundDatabaseError(std::move(errors));
+    const auto valuePositions = getInsertValuePositionsUnlocked(columnNames);
+    std::vector<Variant> orderedColumnValues(columnCount - 1);
+    for (std::size_t i = 0, n = columnValues.size(); i < n; ++i)
+        orderedColumnValues[valuePositions[i]] = std::move(columnValues[i]);
 
     return doInsertRowUnlocked(orderedColumnValues, transactionParameters, customTrid);
 }
@@ -239,7 +213,7 @@ std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::insertRow(
         std::uint64_t customTrid)
 {
     std::lock_guard lock(m_mutex);
-    const auto columnCount = m_currentColumns.size();
+    const auto columnCount = m_currentColumns->size();
 
     // Check that number of column doesn't exceed number of columns in table except MC
     if (columnValues.size() >= columnCount) {
@@ -254,19 +228,108 @@ std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::insertRow(
         columnValues.resize(requiredValueCount);
         // Place a copy of a default value, if defined,
         // into the added elements of columnValues.
-        const auto& columns = m_currentColumnSet->getColumns();
-        for (std::size_t i = currentValueCount; i < requiredValueCount; ++i) {
-            const auto& columnSetColumn = columns.at(i + 1);
-            const auto column = getColumnChecked(columnSetColumn->getColumnId());
-            const auto columnDefinition =
-                    column->getColumnDefinitionChecked(columnSetColumn->getColumnDefinitionId());
-            columnValues.at(i) = columnDefinition->getDefaultValue();
-        }
+        for (std::size_t i = currentValueCount; i < requiredValueCount; ++i)
+            columnValues.at(i) = getDefaultValueUnlocked(i + 1);
     }
 
     return doInsertRowUnlocked(columnValues, transactionParameters, customTrid);
 }
 
+std::vector<std::uint64_t> Table::insertRows(const std::vector<std::string>& columnNames,
+        std::vector<std::vector<Variant>>& rows, const TransactionParameters& transactionParameters)
+{
+    std::lock_guard lock(m_mutex);
+    const auto columnCount = m_currentColumns->size();
+
+    // Check row sizes and columns once for all rows
+    std::size_t minRowSize = columnCount - 1;
+    for (const auto& row : rows) {
+        if (!columnNames.empty() && row.size() != columnNames.size()) {
+            throwDatabaseError(IOManagerMessageId::kErrorNumberOfValuesMistatchOnInsert,
+                    m_database.getName(), m_name, row.size(), columnNames.size());
+        }
+        if (row.size() >= columnCount) {
+            throwDatabaseError(IOManagerMessageId::kErrorTooManyColumnsToInsert,
+                    m_database.getName(), m_name, row.size(), columnCount - 1);
+        }
+        minRowSize = std::min(minRowSize, row.size());
+    }
+
+    std::vector<std::size_t> valuePositions;
+    if (columnNames.empty()) {
+        valuePositions.resize(columnCount - 1);
+        std::iota(valuePositions.begin(), valuePositions.end(), 0);
+    } else
+        valuePositions = getInsertValuePositionsUnlocked(columnNames);
+
+    // Collect values of each column. Missing values are NULL values,
+    // except trailing values of the rows without column list, which are default values.
+    const auto rowCount = rows.size();
+    std::vector<std::vector<Variant>> columnValues(columnCount - 1);
+    for (auto& values : columnValues)
+        values.resize(rowCount);
+    for (std::size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex) {
+        auto& row = rows[rowIndex];
+        for (std::size_t i = 0, n = row.size(); i < n; ++i)
+            columnValues[valuePositions[i]][rowIndex] = std::move(row[i]);
+    }
+    if (columnNames.empty()) {
+        for (std::size_t i = minRowSize; i < columnCount - 1; ++i) {
+            const auto defaultValue = getDefaultValueUnlocked(i + 1);
+            for (std::size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex) {
+                if (rows[rowIndex].size() <= i) columnValues[i][rowIndex] = defaultValue;
+            }
+        }
+    }
+
+    return doInsertColumnValuesUnlocked(columnValues, rowCount, transactionParameters);
+}
+
+std::vector<std::uint64_t> Table::insertColumnValues(const std::vector<std::string>& columnNames,
+        std::vector<std::vector<Variant>>& columnValues,
+        const TransactionParameters& transactionParameters)
+{
+    std::lock_guard lock(m_mutex);
+    const auto columnCount = m_currentColumns->size();
+
+    if (!columnNames.empty() && columnValues.size() != columnNames.size()) {
+        throwDatabaseError(IOManagerMessageId::kErrorNumberOfValuesMistatchOnInsert,
+                m_database.getName(), m_name, columnValues.size(), columnNames.size());
+    }
+    if (columnValues.size() >= columnCount) {
+        throwDatabaseError(IOManagerMessageId::kErrorTooManyColumnsToInsert,
+                m_database.getName(), m_name, columnValues.size(), columnCount - 1);
+    }
+    const auto rowCount = columnValues.empty() ? 0 : columnValues.front().size();
+    for (const auto& values : columnValues) {
+        if (values.size() != rowCount) throw std::invalid_argument("Column value count mismatch");
+    }
+    if (rowCount == 0) return {};
+
+    std::vector<std::size_t> valuePositions;
+    if (columnNames.empty()) {
+        valuePositions.resize(columnValues.size());
+        std::iota(valuePositions.begin(), valuePositions.end(), 0);
+    } else
+        valuePositions = getInsertValuePositionsUnlocked(columnNames);
+
+    // Missing values are NULL values, except trailing values when there is no column list,
+    // which are default values
+    std::vector<std::vector<Variant>> allColumnValues(columnCount - 1);
+    for (std::size_t i = 0; i < columnValues.size(); ++i)
+        allColumnValues[valuePositions[i]] = std::move(columnValues[i]);
+    for (std::size_t i = 0; i < columnCount - 1; ++i) {
+        auto& values = allColumnValues[i];
+        if (values.size() == rowCount) continue;
+        if (columnNames.empty())
+            values.resize(rowCount, getDefaultValueUnlocked(i + 1));
+        else
+            values.resize(rowCount);
+    }
+
+    return doInsertColumnValuesUnlocked(allColumnValues, rowCount, transactionParameters);
+}
+
 bool Table::deleteRow(std::uint64_t trid, const TransactionParameters& transactionParameters)
 {
     std::lock_guard lock(m_mutex);
@@ -296,11 +359,35 @@ void Table::deleteRow(const MasterColumnRecord& mcr, const ColumnDataAddress& mc
         const TransactionParameters& transactionParameters)
 {
     std::lock_guard lock(m_mutex);
+    checkRowIsNotChangedConcurrentlyUnlocked(
+            mcr, mcrAddress, transactionParameters.m_transactionId);
+
     MasterColumnRecord newMcr(*this, transactionParameters.m_transactionId,
             mcr.getCreateTimestamp(), transactionParameters.m_timestamp, DmlOperationType::kDelete,
             transactionParameters.m_userId, mcr.getTableRowId(), m_currentColumnSet->getId(),
             mcrAddress);
-    m_masterColumn->putMasterColumnRecord(newMcr);
+
+    // Row must be recorded before it disappears from the index,
+    // so that concurrent snapshot readers still find it
+    recordDeletedRow(
+            mcr.getTableRowId(), DeletedRow {transactionParameters.m_transactionId, mcrAddress});
+    try {
+        m_masterColumn->putMasterColumnRecord(newMcr);
+    } catch (...) {
+        std::lock_guard deletedRowsLock(m_deletedRowsMutex);
+        m_deletedRows.erase(mcr.getTableRowId());
+        throw;
+    }
+
+    // Deleted row values are not counted anymore
+    const auto tableColumns = getColumnsOrderedByPosition();
+    const auto& columnRecords = mcr.getColumnRecords();
+    for (std::size_t i = 0, n = std::min(columnRecords.size(), tableColumns.size() - 1); i != n;
+            ++i) {
+        // Normal column positions start from 1, column at position 0 is master column.
+        if (!columnRecords[i].isNullValueAddress())
+            tableColumns[i + 1]->decrementNonNullValueCount();
+    }
 }
 
 bool Table::updateRow(std::uint64_t trid, std::vector<Variant>&& columnValues,
@@ -341,6 +428,8 @@ void Table::updateRow(const MasterColumnRecord& mcr, const ColumnDataAddress& mc
                 m_database.getName(), m_name, columnValues.size(), columnRecords.size());
     }
 
+    checkRowIsNotChangedConcurrentlyUnlocked(mcr, mcrAddress, tp.m_transactionId);
+
     MasterColumnRecord newMcr(*this, tp.m_transactionId, mcr.getCreateTimestamp(), tp.m_timestamp,
             DmlOperationType::kUpdate, tp.m_userId, mcr.getTableRowId(),
             m_currentColumnSet->getId(), mcrAddress);
@@ -361,8 +450,21 @@ void Table::updateRow(const MasterColumnRecord& mcr, const ColumnDataAddress& mc
             nextBlockIds.push_back(res.second.getBlockId());
             ++valueIndex;
         }
+        const auto& oldColumnRecords = mcr.getColumnRecords();
         newMcr.setColumnRecords(std::move(columnRecords));
         m_masterColumn->putMasterColumnRecord(newMcr);
+
+        // Update non-null value counters of the updated columns
+        const auto& newColumnRecords = newMcr.getColumnRecords();
+        for (const auto columnPosition : columnPositions) {
+            if (columnPosition == 0) continue;
+            const bool wasNull = oldColumnRecords[columnPosition - 1].isNullValueAddress();
+            const bool isNull = newColumnRecords[columnPosition - 1].isNullValueAddress();
+            if (wasNull && !isNull)
+                tableColumns[columnPosition]->incrementNonNullValueCount();
+            else if (!wasNull && isNull)
+                tableColumns[columnPosition]->decrementNonNullValueCount();
+        }
     } catch (...) {
         // Rollback updated columns
         auto blockIt = nextBlockIds.cbegin();
@@ -384,6 +486,199 @@ void Table::updateRow(const MasterColumnRecord& mcr, const ColumnDataAddress& mc
     }
 }
 
+void Table::restoreRow(
+        std::uint64_t trid, const ColumnDataAddress& mcrAddress, const TransactionParameters& tp)
+{
+    std::lock_guard lock(m_mutex);
+
+    // Find current version of the row
+    std::uint8_t key[8], value[12];
+    ::pbeEncodeUInt64(trid, key);
+    const bool rowExists = m_masterColumn->getMasterColumnMainIndex()->getValue(key, value, 1);
+    ColumnDataAddress currentMcrAddress;
+    MasterColumnRecord currentMcr;
+    if (rowExists) {
+        currentMcrAddress.pbeDeserialize(value, sizeof(value));
+        m_masterColumn->readMasterColumnRecord(currentMcrAddress, currentMcr);
+    }
+
+    // Restored version keeps timestamp of the version it undoes, so that reader
+    // of the past state between change and rollback doesn't see the change.
+
+    // Row didn't exist before the change
+    if (mcrAddress.isNullValueAddress()) {
+        if (rowExists) {
+            auto deleteTp = tp;
+            deleteTp.m_timestamp = currentMcr.getUpdateTimestamp();
+            deleteRow(currentMcr, currentMcrAddress, deleteTp);
+        }
+        return;
+    }
+
+    // Write previous values as the new row version. Deleted row is inserted again.
+    MasterColumnRecord oldMcr;
+    m_masterColumn->readMasterColumnRecord(mcrAddress, oldMcr);
+    MasterColumnRecord newMcr(*this, tp.m_transactionId, oldMcr.getCreateTimestamp(),
+            oldMcr.getUpdateTimestamp(),
+            rowExists ? DmlOperationType::kUpdate : DmlOperationType::kInsert,
+            tp.m_userId, trid, oldMcr.getColumnSetId(),
+            rowExists ? currentMcrAddress : mcrAddress);
+    auto columnRecords = oldMcr.getColumnRecords();
+    newMcr.setColumnRecords(std::move(columnRecords));
+    m_masterColumn->putMasterColumnRecord(newMcr);
+
+    if (!rowExists) {
+        std::lock_guard deletedRowsLock(m_deletedRowsMutex);
+        m_deletedRows.erase(trid);
+    }
+
+    // Update non-null value counters
+    const auto tableColumns = getColumnsOrderedByPosition();
+    const auto columnCount = tableColumns.size() - 1;
+    if (rowExists) {
+        const auto& currentColumnRecords = currentMcr.getColumnRecords();
+        for (std::size_t i = 0, n = std::min(currentColumnRecords.size(), columnCount); i != n;
+                ++i) {
+            // Normal column positions start from 1, column at position 0 is master column.
+            if (!currentColumnRecords[i].isNullValueAddress())
+                tableColumns[i + 1]->decrementNonNullValueCount();
+        }
+    }
+    const auto& restoredColumnRecords = newMcr.getColumnRecords();
+    for (std::size_t i = 0, n = std::min(restoredColumnRecords.size(), columnCount); i != n; ++i) {
+        if (!restoredColumnRecords[i].isNullValueAddress())
+            tableColumns[i + 1]->incrementNonNullValueCount();
+    }
+}
+
+void Table::rollBackInterruptedTransactions(
+        const std::vector<std::uint64_t>& transactionIds, const TransactionParameters& tp)
+{
+    std::lock_guard lock(m_mutex);
+    const auto index = m_masterColumn->getMasterColumnMainIndex();
+    const auto isInterrupted = [&transactionIds](std::uint64_t transactionId) {
+        return std::binary_search(transactionIds.cbegin(), transactionIds.cend(), transactionId);
+    };
+
+    // Deleted rows are checked too, deletion could be interrupted
+    std::uint8_t key[8], value[12];
+    std::size_t restoredRowCount = 0;
+    for (std::uint64_t trid = 1, lastTrid = m_masterColumn->getLastUserTrid(); trid <= lastTrid;
+            ++trid) {
+        ::pbeEncodeUInt64(trid, key);
+        if (index->getValue(key, value, 1) != 1 && !index->getDeletedValue(key, value)) continue;
+        ColumnDataAddress mcrAddress;
+        mcrAddress.pbeDeserialize(value, sizeof(value));
+        MasterColumnRecord mcr;
+        m_masterColumn->readMasterColumnRecord(mcrAddress, mcr);
+        if (!isInterrupted(mcr.getTransactionId())) continue;
+
+        // Skip all versions written by the interrupted transactions
+        do {
+            mcrAddress = mcr.getPreviousVersionAddress();
+            if (mcrAddress.isNullValueAddress()) break;
+            m_masterColumn->readMasterColumnRecord(mcrAddress, mcr);
+        } while (isInterrupted(mcr.getTransactionId()));
+
+        restoreRow(trid, mcrAddress, tp);
+        ++restoredRowCount;
+    }
+
+    if (restoredRowCount > 0) {
+        LOG_INFO << "Table " << getDisplayName() << ": Restored " << restoredRowCount
+                 << " row(s) changed by interrupted transactions";
+    }
+}
+
+std::optional<Table::DeletedRow> Table::getDeletedRow(std::uint64_t trid) const
+{
+    std::lock_guard lock(m_deletedRowsMutex);
+    const auto it = m_deletedRows.find(trid);
+    if (it == m_deletedRows.end()) return std::nullopt;
+    return it->second;
+}
+
+std::optional<std::uint64_t> Table::findDeletedRow(
+        std::uint64_t minTrid, std::uint64_t maxTrid) const
+{
+    std::lock_guard lock(m_deletedRowsMutex);
+    const auto it = m_deletedRows.lower_bound(minTrid);
+    if (it == m_deletedRows.end() || it->first > maxTrid) return std::nullopt;
+    return it->first;
+}
+
+std::vector<ColumnDataAddress> Table::getMasterColumnRecordAddresses(
+        std::uint64_t firstTrid, std::uint64_t lastTrid, const TransactionSnapshot* snapshot) const
+{
+    std::vector<ColumnDataAddress> result;
+    std::uint8_t key[8];
+    std::uint8_t nextKey[8];
+    std::uint8_t value[12];
+
+    std::lock_guard lock(m_mutex);
+    const auto index = m_masterColumn->getMasterColumnMainIndex();
+
+    if (snapshot && snapshot->isHistorical()) {
+        // Rows deleted long ago are neither in the index nor in the deleted row log,
+        // so all TRIDs of the range are checked
+        for (auto trid = firstTrid; trid <= lastTrid; ++trid) {
+            ::pbeEncodeUInt64(trid, key);
+            if (index->getValue(key, value, 1) == 1 || index->getDeletedValue(key, value))
+                result.emplace_back().pbeDeserialize(value, sizeof(value));
+        }
+        return result;
+    }
+
+    // Rows deleted after snapshot are outside of the index and are merged in the TRID order
+    auto deletedTrid = snapshot ? findDeletedRow(firstTrid, lastTrid) : std::nullopt;
+    const auto addDeletedRowsBefore = [&](std::uint64_t trid) {
+        while (deletedTrid && *deletedTrid < trid) {
+            const auto deletedRow = getDeletedRow(*deletedTrid);
+            if (deletedRow && !snapshot->isVisible(deletedRow->m_transactionId))
+                result.push_back(deletedRow->m_mcrAddress);
+            deletedTrid = *deletedTrid < lastTrid ? findDeletedRow(*deletedTrid + 1, lastTrid)
+                                                  : std::nullopt;
+        }
+    };
+
+    // Walk live keys of the range
+    ::pbeEncodeUInt64(firstTrid > 0 ? firstTrid - 1 : 0, key);
+    bool hasKey = firstTrid == 0 ? index->getFirstKey(nextKey) : index->getNextKey(key, nextKey);
+    while (hasKey) {
+        std::uint64_t trid = 0;
+        ::pbeDecodeUInt64(nextKey, &trid);
+        if (trid > lastTrid) break;
+        addDeletedRowsBefore(trid);
+        if (deletedTrid && *deletedTrid == trid) {
+            // Row is recorded as deleted before it is removed from the index
+            deletedTrid = trid < lastTrid ? findDeletedRow(trid + 1, lastTrid) : std::nullopt;
+        }
+        if (index->getValue(nextKey, value, 1) == 1)
+            result.emplace_back().pbeDeserialize(value, sizeof(value));
+        std::memcpy(key, nextKey, sizeof(key));
+        hasKey = index->getNextKey(key, nextKey);
+    }
+    addDeletedRowsBefore(lastTrid + 1);
+    return result;
+}
+
+std::optional<std::pair<std::uint64_t, std::uint64_t>> Table::getDeletedRowIdRange() const
+{
+    std::lock_guard lock(m_deletedRowsMutex);
+    if (m_deletedRows.empty()) return std::nullopt;
+    return std::make_pair(m_deletedRows.cbegin()->first, m_deletedRows.crbegin()->first);
+}
+
+std::optional<RowVersion> Table::findVisibleRowVersion(std::uint64_t trid,
+        const ColumnDataAddress& mcrAddress, const TransactionSnapshot& snapshot)
+{
+    const auto versions = m_rowVersionIndex.getRowVersions(*m_masterColumn, trid, mcrAddress);
+    for (const auto& version : *versions) {
+        if (snapshot.isVisible(version.m_transactionId, version.m_timestamp)) return version;
+    }
+    return std::nullopt;
+}
+
 void Table::rollbackLastRow(
         const MasterColumnRecord& mcr, const std::vector<std::uint64_t>& nextBlockIds)
 {
@@ -394,7 +689,7 @@ void Table::rollbackLastRow(
     }
 
     std::lock_guard lock(m_mutex);
-    const auto columnCount = m_currentColumns.size();
+    const auto columnCount = m_currentColumns->size();
 
     if (columnRecords.size() >= columnCount) {
         throwDatabaseError(IOManagerMessageId::kErrorTooManyColumnsToRollback, m_database.getName(),
@@ -402,10 +697,11 @@ void Table::rollbackLastRow(
     }
 
     auto blockIt = nextBlockIds.cbegin();
-    auto columnIt = m_currentColumns.byPosition().cbegin();
+    auto columnIt = m_currentColumns->byPosition().cbegin();
     for (const auto& r : columnRecords) {
         if (columnIt->m_column->isMasterColumn()) ++columnIt;
         if (!r.isNullValueAddress()) {
+            columnIt->m_column->decrementNonNullValueCount();
             try {
                 columnIt->m_column->rollbackToAddress(r.getAddress(), *blockIt);
             } catch (std::exception& ex) {
@@ -417,12 +713,29 @@ void Table::rollbackLastRow(
     }
 }
 
+void Table::flushColumnData()
+{
+    for (const auto& column : getColumnsOrderedByPosition())
+        column->flushBlocks();
+}
+
 void Table::flushIndices()
 {
     std::lock_guard lock(m_mutex);
+    // Column data goes first, so that durable index never points to unflushed data
+    flushColumnData();
     m_masterColumn->getMasterColumnMainIndex()->flush();
 }
 
+void Table::flush()
+{
+    // Stored value counters never count unflushed values
+    flushColumnData();
+    for (const auto& column : getColumnsOrderedByPosition())
+        column->storeValueCounters();
+    flushIndices();
+}
+
 std::uint64_t Table::generateNextUserTrid()
 {
     // NOTE: This function cannot be moved to header or inlined due to compilation dependencies.
@@ -444,8 +757,8 @@ void Table::setLastSystemTrid(std::uint64_t lastSystemTrid)
 ColumnDefinitionPtr Table::getColumnDefinitionChecked(std::uint64_t columnDefinitionId)
 {
     const auto columnDefinitionRecord = m_database.getColumnDefinitionRecord(columnDefinitionId);
-    std::lock_guard lock(m_mutex);
-    const auto& index = m_currentColumns.byColumnId();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byColumnId();
     const auto it = index.find(columnDefinitionRecord.m_columnId);
     if (it == index.cend()) {
         throwDatabaseError(IOManagerMessageId::kErrorInvalidTableColumnDefinition,
@@ -478,16 +791,16 @@ void Table::loadColumnsUnlocked()
                 m_name, m_currentColumnSet->getId(), m_database.getUuid(), m_id);
     }
 
-    TableColumns currentColumns;
+    auto currentColumns = std::make_shared<TableColumns>();
     std::uint32_t position = 0;
     for (const auto& columnSetColumn : columns) {
         const auto columnDefinitionRecord =
                 m_database.getColumnDefinitionRecord(columnSetColumn->getColumnDefinitionId());
         const auto columnRecord = m_database.getColumnRecord(columnDefinitionRecord.m_columnId);
         auto column = std::make_shared<Column>(*this, columnRecord, m_firstUserTrid);
-        currentColumns.insert(TableColumn(column, columnSetColumn->getId(), position++));
+        currentColumns->insert(TableColumn(column, columnSetColumn->getId(), position++));
     }
-    m_currentColumns.swap(currentColumns);
+    setCurrentColumnsUnlocked(std::move(currentColumns));
 
     // Finally, update master column
     m_masterColumn = getColumnCheckedUnlocked(Database::kMasterColumnName);
@@ -528,7 +841,8 @@ ConstraintPtr Table::createConstraintUnlocked(
 
 TableColumn Table::getColumnByIdUnlocked(std::uint64_t columnId) const
 {
-    const auto& index = m_currentColumns.byColumnId();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byColumnId();
     const auto it = index.find(columnId);
     if (it != index.end()) return *it;
     throwDatabaseError(
@@ -537,7 +851,8 @@ TableColumn Table::getColumnByIdUnlocked(std::uint64_t columnId) const
 
 TableColumn Table::getColumnByPositionUnlocked(std::uint32_t position) const
 {
-    const auto& index = m_currentColumns.byPosition();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byPosition();
     const auto it = index.find(position);
     if (it != index.end()) return *it;
     throwDatabaseError(IOManagerMessageId::kErrorTableColumnIndexOutOfRange, m_database.getName(),
@@ -562,14 +877,16 @@ ColumnPtr Table::getColumnCheckedUnlocked(const std::string& columnName) const
 
 ColumnPtr Table::getColumnUnlocked(uint64_t columnId) const noexcept
 {
-    const auto& index = m_currentColumns.byColumnId();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byColumnId();
     const auto it = index.find(columnId);
     return it == index.cend() ? nullptr : it->m_column;
 }
 
 ColumnPtr Table::getColumnUnlocked(const std::string& columnName) const noexcept
 {
-    const auto& index = m_currentColumns.byName();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byName();
     const auto it = index.find(columnName);
     return it == index.cend() ? nullptr : it->m_column;
 }
@@ -577,7 +894,8 @@ ColumnPtr Table::getColumnUnlocked(const std::string& columnName) const noexcept
 std::optional<std::uint32_t> Table::getColumnPositionUnlocked(uint64_t columnId) const noexcept
 {
     std::optional<std::uint32_t> result;
-    const auto& index = m_currentColumns.byColumnId();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byColumnId();
     const auto it = index.find(columnId);
     if (it != index.cend()) result = it->m_position;
     return result;
@@ -587,7 +905,8 @@ std::optional<std::uint32_t> Table::getColumnPositionUnlocked(const std::string&
         noexcept
 {
     std::optional<std::uint32_t> result;
-    const auto& index = m_currentColumns.byName();
+    const auto currentColumns = getCurrentColumns();
+    const auto& index = currentColumns->byName();
     const auto it = index.find(columnName);
     if (it != index.cend()) result = it->m_position;
     return result;
@@ -644,6 +963,114 @@ void Table::createInitializationFlagFile() const
     }
 }
 
+std::vector<std::size_t> Table::getInsertValuePositionsUnlocked(
+        const std::vector<std::string>& columnNames) const
+{
+    std::vector<std::size_t> valuePositions;
+    valuePositions.reserve(columnNames.size());
+
+    // vector<bool> was always suboptimal, so use vector<char>
+    std::vector<char> columnPresent(m_currentColumns->size());
+    std::vector<CompoundDatabaseError::ErrorRecord> errors;
+    const auto& columnsByName = m_currentColumns->byName();
+
+    // Check columns
+    for (const auto& columnName : columnNames) {
+        if (!isValidDatabaseObjectName(columnName)) {
+            errors.push_back(std::move(
+                    makeDatabaseError(IOManagerMessageId::kErrorInvalidColumnName, columnName)));
+            continue;
+        }
+
+        const auto it = columnsByName.find(columnName);
+        if (it == columnsByName.end()) {
+            errors.push_back(makeDatabaseError(IOManagerMessageId::kErrorColumnDoesNotExist,
+                    m_database.getName(), m_name, columnName));
+            continue;
+        }
+
+        if (it->m_column->isMasterColumn()) {
+            errors.push_back(
+                    makeDatabaseError(IOManagerMessageId::kErrorCannotInsertIntoMasterColumn));
+            continue;
+        }
+
+        auto& columnPresentFlag = columnPresent.at(it->m_column->getCurrentPosition());
+        if (columnPresentFlag) {
+            errors.push_back(makeDatabaseError(
+                    IOManagerMessageId::kErrorInsertDuplicateColumnName, columnName));
+            continue;
+        }
+
+        columnPresentFlag = 1;
+        valuePositions.push_back(it->m_position - 1);
+    }
+
+    if (!errors.empty()) throw CompoundDatabaseError(std::move(errors));
+    return valuePositions;
+}
+
+Variant Table::getDefaultValueUnlocked(std::size_t position)
+{
+    const auto& columnSetColumn = m_currentColumnSet->getColumns().at(position);
+    const auto column = getColumnChecked(columnSetColumn->getColumnId());
+    const auto columnDefinition =
+            column->getColumnDefinitionChecked(columnSetColumn->getColumnDefinitionId());
+    return columnDefinition->getDefaultValue();
+}
+
+std::vector<std::uint64_t> Table::doInsertColumnValuesUnlocked(
+        std::vector<std::vector<Variant>>& columnValues, std::size_t rowCount,
+        const TransactionParameters& transactionParameters)
+{
+    // Write values column by column on the column writer threads,
+    // then write master column records.
+    const auto columns = getColumnsOrderedByPosition();
+    const auto columnCount = columnValues.size();
+    std::vector<ColumnWrite> columnWrites;
+    columnWrites.reserve(columnCount);
+    for (std::size_t i = 0; i < columnCount; ++i)
+        columnWrites.emplace_back(*columns[i + 1], std::move(columnValues[i]));
+    m_database.getInstance().getColumnWriterPool().write(columnWrites);
+
+    std::vector<std::uint64_t> trids;
+    trids.reserve(rowCount);
+    try {
+        for (const auto& columnWrite : columnWrites) {
+            if (columnWrite.m_error) std::rethrow_exception(columnWrite.m_error);
+        }
+
+        const auto& tp = transactionParameters;
+        std::vector<MasterColumnRecordPtr> mcrs;
+        mcrs.reserve(rowCount);
+        for (std::size_t rowIndex = 0; rowIndex < rowCount; ++rowIndex) {
+            auto& mcr = mcrs.emplace_back(std::make_unique<MasterColumnRecord>(*this,
+                    tp.m_transactionId, tp.m_timestamp, tp.m_timestamp, DmlOperationType::kInsert,
+                    tp.m_userId, 0, m_currentColumnSet->getId(), kNullValueAddress));
+            for (const auto& columnWrite : columnWrites) {
+                mcr->addColumnRecord(
+                        columnWrite.m_records[rowIndex].first, tp.m_timestamp, tp.m_timestamp);
+            }
+        }
+        m_masterColumn->putMasterColumnRecords(mcrs);
+        for (const auto& mcr : mcrs)
+            trids.push_back(mcr->getTableRowId());
+    } catch (...) {
+        for (const auto& columnWrite : columnWrites)
+            columnWrite.m_column.rollbackRecords(columnWrite.m_records);
+        throw;
+    }
+
+    for (const auto& columnWrite : columnWrites) {
+        for (const auto& record : columnWrite.m_records) {
+            if (!record.first.isNullValueAddress())
+                columnWrite.m_column.incrementNonNullValueCount();
+        }
+    }
+
+    return trids;
+}
+
 std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::doInsertRowUnlocked(
         std::vector<Variant>& columnValues, const TransactionParameters& tp,
         std::uint64_t customTrid)
@@ -653,12 +1080,14 @@ std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::doInsertRowU
             tp.m_timestamp, DmlOperationType::kInsert, tp.m_userId, customTrid,
             m_currentColumnSet->getId(), kNullValueAddress);
 
+    // Single value per column is cheaper to write on the calling thread
+    // than to hand over to the column writer threads
     std::vector<std::uint64_t> nextBlockIds;
     nextBlockIds.reserve(mcr->getColumnCount());
 
     try {
         std::size_t i = 0;
-        for (const auto& tableColumnRecord : m_currentColumns.byPosition()) {
+        for (const auto& tableColumnRecord : m_currentColumns->byPosition()) {
             if (tableColumnRecord.m_column->isMasterColumn()) continue;
             auto res = tableColumnRecord.m_column->putRecord(std::move(columnValues[i]));
             mcr->addColumnRecord(res.first, tp.m_timestamp, tp.m_timestamp);
@@ -671,7 +1100,52 @@ std::pair<MasterColumnRecordPtr, std::vector<std::uint64_t>> Table::doInsertRowU
         throw;
     }
 
+    std::size_t i = 0;
+    for (const auto& tableColumnRecord : m_currentColumns->byPosition()) {
+        if (tableColumnRecord.m_column->isMasterColumn()) continue;
+        if (!mcr->getColumnRecords()[i++].isNullValueAddress())
+            tableColumnRecord.m_column->incrementNonNullValueCount();
+    }
+
     return std::make_pair(std::move(mcr), std::move(nextBlockIds));
 }
 
+void Table::recordDeletedRow(std::uint64_t trid, const DeletedRow& deletedRow)
+{
+    std::lock_guard lock(m_deletedRowsMutex);
+    m_deletedRows.insert_or_assign(trid, deletedRow);
+    if (m_deletedRows.size() < m_deletedRowPruneThreshold) return;
+
+    // Deletions made before the oldest snapshot are seen by every reader
+    const auto minInvisibleTransactionId = m_database.getMinInvisibleTransactionId();
+    for (auto it = m_deletedRows.begin(); it != m_deletedRows.end();) {
+        if (it->second.m_transactionId < minInvisibleTransactionId)
+            it = m_deletedRows.erase(it);
+        else
+            ++it;
+    }
+    m_deletedRowPruneThreshold =
+            std::max(kMinDeletedRowPruneThreshold, m_deletedRows.size() * 2);
+}
+
+void Table::checkRowIsNotChangedConcurrentlyUnlocked(const MasterColumnRecord& mcr,
+        const ColumnDataAddress& mcrAddress, std::uint64_t transactionId) const
+{
+    // Snapshot reader may see older version, while the latest one is written
+    // by the transaction which has committed after snapshot or is still active
+    std::uint8_t key[8], value[12];
+    ::pbeEncodeUInt64(mcr.getTableRowId(), key);
+    ColumnDataAddress latestMcrAddress;
+    if (m_masterColumn->getMasterColumnMainIndex()->getValue(key, value, 1) == 1)
+        latestMcrAddress.pbeDeserialize(value, sizeof(value));
+    const bool isLatestVersion = latestMcrAddress.getBlockId() == mcrAddress.getBlockId()
+                                 && latestMcrAddress.getOffset() == mcrAddress.getOffset();
+    if (isLatestVersion
+            && (mcr.getTransactionId() == transactionId
+                    || !m_database.isTransactionActive(mcr.getTransactionId())))
+        return;
+    throwDatabaseError(IOManagerMessageId::kErrorRowChangedConcurrently, m_database.getName(),
+            m_name, mcr.getTableRowId());
+}
+
 }  // namespace siodb::iomgr::dbengine
@@ -13,18 +13,35 @@
 #include "ConstraintCache.h"
 #include "Database.h"
 #include "IndexPtr.h"
+#include "RowVersionIndex.h"
 #include "TableColumns.h"
 #include "TablePtr.h"
 #include "Variant.h"
 
+// STL headers
+#include <map>
+#include <mutex>
+#include <optional>
+
 namespace siodb::iomgr::dbengine {
 
 class ColumnSet;
 class ColumnDefinition;
 class Constraint;
+class TransactionSnapshot;
 
 /** Database table */
 class Table : public std::enable_shared_from_this<Table> {
+public:
+    /** Deleted row, which may still be visible to some snapshot */
+    struct DeletedRow {
+        /** Deleting transaction ID */
+        std::uint64_t m_transactionId;
+
+        /** Address of the last master column record before deletion */
+        ColumnDataAddress m_mcrAddress;
+    };
+
 public:
     /**
      * Initializes object of class Table for the new table.
@@ -143,8 +160,7 @@ public:
      */
     std::size_t getColumnCount() const
     {
-        std::lock_guard lock(m_mutex);
-        return m_currentColumns.size();
+        return getCurrentColumns()->size();
     }
 
     /**
@@ -154,7 +170,6 @@ public:
      */
     bool isColumnExists(const std::string& columnName) const
     {
-        std::lock_guard lock(m_mutex);
         return isColumnExistsUnlocked(columnName);
     }
 
@@ -166,7 +181,6 @@ public:
      */
     TableColumn getColumnById(std::uint64_t columnId) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnByIdUnlocked(columnId);
     }
 
@@ -178,7 +192,6 @@ public:
      */
     TableColumn getColumnByPosition(std::uint32_t position) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnByPositionUnlocked(position);
     }
 
@@ -245,9 +258,8 @@ public:
      * Returns existing master column object.
      * @return Corresponding column object.
      */
-    ColumnPtr getMasterColumn() const
+    ColumnPtr getMasterColumn() const noexcept
     {
-        std::lock_guard lock(m_mutex);
         return m_masterColumn;
     }
 
@@ -264,7 +276,6 @@ public:
      */
     ColumnPtr getColumnChecked(std::uint64_t columnId) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnCheckedUnlocked(columnId);
     }
 
@@ -275,7 +286,6 @@ public:
      */
     ColumnPtr getColumnChecked(const std::string& columnName) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnCheckedUnlocked(columnName);
     }
 
@@ -286,7 +296,6 @@ public:
      */
     ColumnPtr getColumn(std::uint64_t columnId) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnUnlocked(columnId);
     }
 
@@ -297,7 +306,6 @@ public:
      */
     ColumnPtr getColumn(const std::string& columnName) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnUnlocked(columnName);
     }
 
@@ -308,7 +316,6 @@ public:
      */
     std::optional<std::uint32_t> getColumnPosition(std::uint64_t columnId) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnPositionUnlocked(columnId);
     }
 
@@ -319,7 +326,6 @@ public:
      */
     std::optional<std::uint32_t> getColumnPosition(const std::string& columnName) const
     {
-        std::lock_guard lock(m_mutex);
         return getColumnPositionUnlocked(columnName);
     }
 
@@ -397,6 +403,35 @@ public:
             std::vector<Variant>& columnValues, const TransactionParameters& transactionParameters,
             std::uint64_t customTrid = 0);
 
+    /**
+     * Inserts new rows into the table. Columns are checked once for all rows,
+     * values are written column by column. Either all rows are inserted or none.
+     * @param columnNames Column names. If empty, values correspond to columns
+     *                    in the order they are in the table.
+     * @param rows Column values of each row. May be modified by this function.
+     * @param transactionParameters Transaction parameters.
+     * @return TRIDs of the inserted rows.
+     * @throw DatabaseError if operation has failed.
+     */
+    std::vector<std::uint64_t> insertRows(const std::vector<std::string>& columnNames,
+            std::vector<std::vector<Variant>>& rows,
+            const TransactionParameters& transactionParameters);
+
+    /**
+     * Inserts new rows into the table, given as the lists of values of each column.
+     * Either all rows are inserted or none.
+     * @param columnNames Column names. If empty, value lists correspond to columns
+     *                    in the order they are in the table.
+     * @param columnValues Values of each column, all lists must have the same length.
+     *                     May be modified by this function.
+     * @param transactionParameters Transaction parameters.
+     * @return TRIDs of the inserted rows.
+     * @throw DatabaseError if operation has failed.
+     */
+    std::vector<std::uint64_t> insertColumnValues(const std::vector<std::string>& columnNames,
+            std::vector<std::vector<Variant>>& columnValues,
+            const TransactionParameters& transactionParameters);
+
     /**
      * Deletes existing row from the table.
      * @param trid Table row ID.
@@ -441,6 +476,76 @@ public:
             std::vector<Variant>&& columnValues, const std::vector<std::size_t>& columnPositions,
             const TransactionParameters& tp);
 
+    /**
+     * Restores row version which existed before a change, by writing new version with
+     * the same values. Used to roll back changes of the transaction.
+     * @param trid Table row ID.
+     * @param mcrAddress Address of the MCR existed before the change or null address
+     *                   if row didn't exist, in which case it is deleted.
+     * @param tp Transaction parameters of the transaction that is rolled back.
+     * @throw DatabaseError if operation has failed.
+     */
+    void restoreRow(std::uint64_t trid, const ColumnDataAddress& mcrAddress,
+            const TransactionParameters& tp);
+
+    /**
+     * Restores rows changed by the transactions which were active when database
+     * was closed without shutdown, to the versions existed before these transactions.
+     * All TRIDs up to the last generated one are checked.
+     * @param transactionIds Sorted IDs of the interrupted transactions.
+     * @param tp Transaction parameters of the rollback.
+     * @throw DatabaseError if operation has failed.
+     */
+    void rollBackInterruptedTransactions(
+            const std::vector<std::uint64_t>& transactionIds, const TransactionParameters& tp);
+
+    /**
+     * Returns recently deleted row. Deleted rows are removed from the master column index,
+     * so snapshot readers use this to reach row versions which are still visible to them.
+     * @param trid Table row ID.
+     * @return Deleted row or nothing if row was not deleted or its deletion is visible
+     *         to all readers.
+     */
+    std::optional<DeletedRow> getDeletedRow(std::uint64_t trid) const;
+
+    /**
+     * Finds first recently deleted row in the given TRID range.
+     * @param minTrid Minimum TRID.
+     * @param maxTrid Maximum TRID.
+     * @return TRID of the deleted row or nothing if there is no such row.
+     */
+    std::optional<std::uint64_t> findDeletedRow(std::uint64_t minTrid, std::uint64_t maxTrid) const;
+
+    /**
+     * Collects master column record addresses of the rows in the TRID range,
+     * which may be visible to the snapshot. Index is accessed under the table lock,
+     * which serializes it with the writers.
+     * @param firstTrid First TRID of the range.
+     * @param lastTrid Last TRID of the range.
+     * @param snapshot Snapshot or nullptr to collect only current rows.
+     * @return Master column record addresses in the TRID order.
+     */
+    std::vector<ColumnDataAddress> getMasterColumnRecordAddresses(std::uint64_t firstTrid,
+            std::uint64_t lastTrid, const TransactionSnapshot* snapshot) const;
+
+    /**
+     * Returns TRID range of the recently deleted rows.
+     * @return Minimum and maximum TRID or nothing if there are no recently deleted rows.
+     */
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> getDeletedRowIdRange() const;
+
+    /**
+     * Finds latest version of the row visible to the snapshot.
+     * @param trid Table row ID.
+     * @param mcrAddress Address of the current master column record of the row.
+     * @param snapshot Transaction snapshot.
+     * @return Row version or nothing if row didn't exist for the snapshot.
+     *         Returned version may be deletion of the row.
+     * @throw DatabaseError if master column record can't be read.
+     */
+    std::optional<RowVersion> findVisibleRowVersion(std::uint64_t trid,
+            const ColumnDataAddress& mcrAddress, const TransactionSnapshot& snapshot);
+
     /**
      * Rolls back last recorded row.
      * @param mcr Master column record.
@@ -449,9 +554,22 @@ public:
     void rollbackLastRow(
             const MasterColumnRecord& mcr, const std::vector<std::uint64_t>& nextBlockIds);
 
-    /** Flushes all pending changes in indices to disk. */
+    /**
+     * Flushes written column data to disk. Index nodes are written only after this,
+     * so that index on disk never points to unflushed data.
+     * @throw DatabaseError if flush fails.
+     */
+    void flushColumnData();
+
+    /** Flushes column data and then all pending changes in indices to disk. */
     void flushIndices();
 
+    /**
+     * Flushes all written column data and pending changes in indices to disk.
+     * @throw DatabaseError if flush fails.
+     */
+    void flush();
+
     /**
      * Generates next TRID from the user TRID range.
      * @return Next user record TRID.
@@ -488,11 +606,14 @@ private:
 
     /**
      * Creates new master column object and writes all necessary on-disk data structures.
+     * Must be called only from constructor, sets master column reference.
      * @param firstUserTrid First user range TRID.
      */
     void createMasterColumn(std::uint64_t firstUserTrid);
 
-    /** Loads all columns. */
+    /**
+     * Loads all columns. Must be called only from constructor, sets master column reference.
+     */
     void loadColumnsUnlocked();
 
     /**
@@ -538,7 +659,26 @@ private:
      */
     bool isColumnExistsUnlocked(const std::string& columnName) const noexcept
     {
-        return m_currentColumns.byName().count(columnName) > 0;
+        return getCurrentColumns()->byName().count(columnName) > 0;
+    }
+
+    /**
+     * Returns snapshot of the current columns. Doesn't acquire column registry lock.
+     * @return Current columns.
+     */
+    std::shared_ptr<const TableColumns> getCurrentColumns() const noexcept
+    {
+        return std::atomic_load(&m_currentColumns);
+    }
+
+    /**
+     * Publishes new snapshot of the current columns. Must be called
+     * with column registry lock acquired.
+     * @param columns New current columns.
+     */
+    void setCurrentColumnsUnlocked(std::shared_ptr<const TableColumns> columns) noexcept
+    {
+        std::atomic_store(&m_currentColumns, std::move(columns));
     }
 
     /**
@@ -630,6 +770,54 @@ private:
             std::vector<Variant>& columnValues, const TransactionParameters& transactionParameters,
             std::uint64_t customTrid);
 
+    /**
+     * Checks insert column list and returns value positions for the listed columns.
+     * Does not obtain column registry lock.
+     * @param columnNames Column names.
+     * @return Positions of the column values, not including master column.
+     * @throw CompoundDatabaseError if some columns are invalid.
+     */
+    std::vector<std::size_t> getInsertValuePositionsUnlocked(
+            const std::vector<std::string>& columnNames) const;
+
+    /**
+     * Returns default value of the column. Does not obtain column registry lock.
+     * @param position Column position in the current column set.
+     * @return Default value.
+     */
+    Variant getDefaultValueUnlocked(std::size_t position);
+
+    /**
+     * Inserts new rows into the table. Does not obtain column registry lock.
+     * @param columnValues Values of each column except master column.
+     *                     May be modified by this function.
+     * @param rowCount Number of rows.
+     * @param transactionParameters Transaction parameters.
+     * @return TRIDs of the inserted rows.
+     * @throw DatabaseError if operation has failed.
+     */
+    std::vector<std::uint64_t> doInsertColumnValuesUnlocked(std::vector<std::vector<Variant>>& columnValues,
+            std::size_t rowCount, const TransactionParameters& transactionParameters);
+
+    /**
+     * Records deleted row. Drops deleted rows which are visible as deleted to all readers.
+     * @param trid Table row ID.
+     * @param deletedRow Deleted row.
+     */
+    void recordDeletedRow(std::uint64_t trid, const DeletedRow& deletedRow);
+
+    /**
+     * Checks that row version which is about to be changed is the latest one
+     * and it is not owned by another active transaction, so that concurrent change
+     * is never overwritten.
+     * @param mcr Master column record of the row version.
+     * @param mcrAddress Master column record address.
+     * @param transactionId ID of the transaction which changes the row.
+     * @throw DatabaseError if row was changed by another transaction.
+     */
+    void checkRowIsNotChangedConcurrentlyUnlocked(const MasterColumnRecord& mcr,
+            const ColumnDataAddress& mcrAddress, std::uint64_t transactionId) const;
+
 private:
     /** Database to which this table belongs */
     Database& m_database;
@@ -649,7 +837,10 @@ private:
     /** Table data directory */
     const std::string m_dataDir;
 
-    /** Column registry synchronization object */
+    /**
+     * Column registry synchronization object. Serializes modifications of the table,
+     * column metadata is read without it from the current columns snapshot.
+     */
     mutable std::recursive_mutex m_mutex;
 
     /** Column sets */
@@ -661,15 +852,37 @@ private:
     /** Previous column set */
     ColumnSetPtr m_prevColumnSet;
 
-    /** Current columns. Must be updated when column set changes. */
-    TableColumns m_currentColumns;
+    /**
+     * Current columns. Must be updated when column set changes. Snapshot is immutable,
+     * new snapshot is published atomically under column registry lock and readers
+     * access it without lock (RCU-like), old snapshot is released with the last reader.
+     */
+    std::shared_ptr<const TableColumns> m_currentColumns;
 
     /** Constraint cache */
     ConstraintCache m_constraintCache;
 
-    /** Master column reference */
+    /**
+     * Master column reference. Assigned only by the constructors, in createMasterColumn()
+     * for a new table or in loadColumnsUnlocked() for an existing one, and never changed
+     * afterwards: master column can't be dropped or replaced. Table object becomes
+     * reachable by other threads only after construction completes, through the database
+     * table cache under the database mutex, so readers access it without table lock.
+     */
     ColumnPtr m_masterColumn;
 
+    /** Recently deleted rows synchronization object */
+    mutable std::mutex m_deletedRowsMutex;
+
+    /** Recently deleted rows by TRID */
+    std::map<std::uint64_t, DeletedRow> m_deletedRows;
+
+    /** Number of recently deleted rows, above which visible deletions are dropped */
+    std::size_t m_deletedRowPruneThreshold;
+
+    /** Versions of the recently read historical rows */
+    RowVersionIndex m_rowVersionIndex;
+
     /** 
      * Cached first user TRID.
      * NOTE: We have to keep it here, to prevent some crashes.
@@ -687,6 +900,12 @@ private:
 
     /** Constraint cache capacity */
     static constexpr std::size_t kConstraintCacheCapacity = 256;
+
+    /** Minimum number of recently deleted rows, above which visible deletions are dropped */
+    static constexpr std::size_t kMinDeletedRowPruneThreshold = 1024;
+
+    /** Maximum number of rows with cached versions */
+    static constexpr std::size_t kRowVersionIndexCapacity = 16384;
 };
 
 }  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,240 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "TableAnalyzer.h"
+
+// Project headers
+#include "Database.h"
+#include "HashAggregator.h"
+#include "Index.h"
+#include "TransactionSnapshot.h"
+
+// STL headers
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <numeric>
+#include <unordered_set>
+
+namespace siodb::iomgr::dbengine {
+
+namespace {
+
+/**
+ * Returns width of the non-NULL value in bytes.
+ * @param value A value.
+ * @return Value width.
+ */
+std::size_t getValueWidth(const Variant& value) noexcept
+{
+    switch (value.getValueType()) {
+        case VariantType::kBool:
+        case VariantType::kInt8:
+        case VariantType::kUInt8: return 1;
+        case VariantType::kInt16:
+        case VariantType::kUInt16: return 2;
+        case VariantType::kInt32:
+        case VariantType::kUInt32:
+        case VariantType::kFloat: return 4;
+        case VariantType::kInt64:
+        case VariantType::kUInt64:
+        case VariantType::kDouble: return 8;
+        case VariantType::kString: return value.getString().size();
+        case VariantType::kBinary: return value.getBinary().size();
+        case VariantType::kClob: return value.getClob().getSize();
+        case VariantType::kBlob: return value.getBlob().getSize();
+        // Serialized size includes value type
+        default: return value.getSerializedSize() - 1;
+    }
+}
+
+/**
+ * Returns indication that values of this type are ordered and can be put into histogram.
+ * @param value A value.
+ * @return true if value can be put into histogram, false otherwise.
+ */
+bool isHistogramValue(const Variant& value) noexcept
+{
+    return value.isNumeric() || value.isString() || value.isBinary() || value.isDateTime();
+}
+
+/** Values of a column in the sampled rows */
+struct ColumnSample {
+    /** Number of NULL values */
+    std::uint64_t m_nullCount = 0;
+
+    /** Total width of non-NULL values */
+    double m_totalWidth = 0;
+
+    /** Number of occurrences of each non-NULL value by value hash */
+    std::unordered_map<std::size_t, std::uint64_t> m_valueCounts;
+
+    /** Non-NULL values which can be put into histogram */
+    std::vector<Variant> m_histogramValues;
+};
+
+}  // namespace
+
+TableAnalyzer::TableAnalyzer(
+        const TablePtr& table, const TransactionSnapshotPtr& snapshot, std::size_t sampleSize)
+    : m_table(table)
+    , m_snapshot(snapshot)
+    , m_sampleSize(sampleSize)
+{
+}
+
+TableStatistics TableAnalyzer::analyze()
+{
+    TableStatistics statistics;
+    statistics.m_tableId = m_table->getId();
+    statistics.m_analyzeTime = std::time(nullptr);
+
+    TableDataSet dataSet(m_table, std::string());
+    dataSet.setSnapshot(m_snapshot);
+    const auto& columns = dataSet.getColumns();
+    const auto columnCount = columns.size();
+    for (std::size_t i = 0; i < columnCount; ++i)
+        dataSet.emplaceColumnInfo(i, columns[i]->getName(), std::string());
+
+    const auto rowCount = countRows(dataSet);
+    std::mt19937_64 randomGenerator(std::random_device {}());
+    const auto samplePositions = selectSamplePositions(rowCount, randomGenerator);
+
+    // Only values of the sampled rows are read, other rows are skipped through the index
+    std::vector<ColumnSample> samples(columnCount);
+    std::uint64_t sampleRowCount = 0;
+    std::uint64_t currentPosition = 0;
+    dataSet.resetCursor();
+    for (const auto position : samplePositions) {
+        // Visible rows end earlier only if row count is not exact
+        if (!dataSet.skipRows(position - currentPosition)) break;
+        currentPosition = position;
+        ++sampleRowCount;
+        for (std::size_t i = 0; i < columnCount; ++i) {
+            const auto& value = dataSet.getColumnValue(i);
+            auto& sample = samples[i];
+            if (value.isNull()) {
+                ++sample.m_nullCount;
+                continue;
+            }
+            sample.m_totalWidth += getValueWidth(value);
+            ++sample.m_valueCounts[HashAggregator::hashValue(value)];
+            if (isHistogramValue(value)) sample.m_histogramValues.push_back(value);
+        }
+    }
+
+    statistics.m_rowCount = rowCount;
+    statistics.m_sampleRowCount = sampleRowCount;
+
+    for (std::size_t i = 0; i < columnCount; ++i) {
+        auto& sample = samples[i];
+        ColumnStatistics columnStatistics;
+        columnStatistics.m_columnId = columns[i]->getId();
+        const auto nonNullCount = sampleRowCount - sample.m_nullCount;
+        if (sampleRowCount > 0) {
+            columnStatistics.m_nullFraction =
+                    static_cast<double>(sample.m_nullCount) / static_cast<double>(sampleRowCount);
+        }
+        if (nonNullCount > 0) {
+            columnStatistics.m_averageWidth =
+                    sample.m_totalWidth / static_cast<double>(nonNullCount);
+            const auto totalNonNullCount = static_cast<std::uint64_t>(std::llround(
+                    static_cast<double>(rowCount) * (1.0 - columnStatistics.m_nullFraction)));
+            columnStatistics.m_distinctCount =
+                    estimateDistinctCount(sample.m_valueCounts, nonNullCount, totalNonNullCount);
+        }
+        columnStatistics.m_histogramBounds = buildHistogram(sample.m_histogramValues);
+        statistics.m_columns.emplace(columns[i]->getName(), std::move(columnStatistics));
+    }
+
+    return statistics;
+}
+
+// ----- internals -----
+
+std::uint64_t TableAnalyzer::countRows(TableDataSet& dataSet) const
+{
+    // Index contains uncommitted and recently deleted rows too, so its key count
+    // is checked against the snapshot after it is read
+    const auto keyCount = m_table->getMasterColumn()->getMasterColumnMainIndex()->getKeyCount();
+    if (keyCount && !m_table->getDeletedRowIdRange()
+            && m_table->getDatabase().isSnapshotCurrent(*m_snapshot))
+        return *keyCount;
+
+    std::uint64_t rowCount = 0;
+    dataSet.resetCursor();
+    for (bool hasRow = dataSet.hasCurrentRow(); hasRow; hasRow = dataSet.moveToNextRow())
+        ++rowCount;
+    return rowCount;
+}
+
+std::vector<std::uint64_t> TableAnalyzer::selectSamplePositions(
+        std::uint64_t rowCount, std::mt19937_64& randomGenerator) const
+{
+    std::vector<std::uint64_t> positions;
+    if (rowCount <= m_sampleSize) {
+        positions.resize(rowCount);
+        std::iota(positions.begin(), positions.end(), 0);
+        return positions;
+    }
+
+    // Floyd's algorithm: every subset of positions is selected with equal probability
+    std::unordered_set<std::uint64_t> selectedPositions;
+    selectedPositions.reserve(m_sampleSize);
+    for (auto j = rowCount - m_sampleSize; j < rowCount; ++j) {
+        const auto position =
+                std::uniform_int_distribution<std::uint64_t>(0, j)(randomGenerator);
+        if (!selectedPositions.insert(position).second) selectedPositions.insert(j);
+    }
+    positions.assign(selectedPositions.cbegin(), selectedPositions.cend());
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+std::uint64_t TableAnalyzer::estimateDistinctCount(
+        const std::unordered_map<std::size_t, std::uint64_t>& valueCounts,
+        std::uint64_t sampleValueCount, std::uint64_t totalValueCount)
+{
+    const std::uint64_t distinctCount = valueCounts.size();
+    if (sampleValueCount >= totalValueCount) return distinctCount;
+
+    std::uint64_t singleValueCount = 0;
+    for (const auto& e : valueCounts) {
+        if (e.second == 1) ++singleValueCount;
+    }
+
+    // No sampled value repeats, so values are likely unique
+    if (singleValueCount == sampleValueCount) return totalValueCount;
+
+    // Duj1 estimator of Haas and Stokes: n * d / (n - f1 + f1 * n / N)
+    const auto n = static_cast<double>(sampleValueCount);
+    const auto f1 = static_cast<double>(singleValueCount);
+    const auto estimate = n * static_cast<double>(distinctCount)
+                          / (n - f1 + f1 * n / static_cast<double>(totalValueCount));
+    return std::clamp<std::uint64_t>(std::llround(estimate), distinctCount, totalValueCount);
+}
+
+std::vector<Variant> TableAnalyzer::buildHistogram(std::vector<Variant>& values)
+{
+    std::vector<Variant> bounds;
+    if (values.size() < 2) return bounds;
+
+    try {
+        std::sort(values.begin(), values.end(), [](const Variant& left, const Variant& right) {
+            return left.compatibleLess(right);
+        });
+    } catch (VariantLogicError&) {
+        return bounds;
+    }
+
+    // Bound i is value at quantile i/bucketCount, so that buckets hold equal number of values
+    const auto bucketCount = std::min(kHistogramBucketCount, values.size() - 1);
+    bounds.reserve(bucketCount + 1);
+    const auto lastIndex = values.size() - 1;
+    for (std::size_t i = 0; i <= bucketCount; ++i)
+        bounds.push_back(std::move(values[i * lastIndex / bucketCount]));
+    return bounds;
+}
+
+}  // namespace siodb::iomgr::dbengine
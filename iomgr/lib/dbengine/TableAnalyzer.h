@@ -0,0 +1,101 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "TableDataSet.h"
+#include "TablePtr.h"
+#include "TableStatistics.h"
+#include "TransactionSnapshotPtr.h"
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <random>
+#include <unordered_map>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Collects table statistics for the ANALYZE statement from the rows visible to the snapshot.
+ * Row count is taken from the master column index when snapshot sees current state
+ * of the table, and only values of uniformly sampled rows are read: NULL fractions,
+ * average widths, histograms and distinct counts are estimated from the sample.
+ */
+class TableAnalyzer final {
+public:
+    /**
+     * Initializes object of class TableAnalyzer.
+     * @param table Table to analyze.
+     * @param snapshot Snapshot which defines visible rows.
+     * @param sampleSize Maximum number of sampled rows.
+     */
+    TableAnalyzer(const TablePtr& table, const TransactionSnapshotPtr& snapshot,
+            std::size_t sampleSize = kDefaultSampleSize);
+
+    DECLARE_NONCOPYABLE(TableAnalyzer);
+
+    /**
+     * Reads sampled rows of the table and computes statistics.
+     * @return Table statistics.
+     * @throw DatabaseError if some I/O error happened.
+     */
+    TableStatistics analyze();
+
+public:
+    /** Default maximum number of sampled rows */
+    static constexpr std::size_t kDefaultSampleSize = 30000;
+
+    /** Number of the histogram buckets */
+    static constexpr std::size_t kHistogramBucketCount = 100;
+
+private:
+    /**
+     * Returns number of rows in the table visible to the snapshot.
+     * @param dataSet Table dataset, used when index key count can't be used.
+     * @return Number of rows.
+     */
+    std::uint64_t countRows(TableDataSet& dataSet) const;
+
+    /**
+     * Selects positions of the sampled rows.
+     * @param rowCount Number of rows.
+     * @param randomGenerator Random number generator.
+     * @return Ascending positions of the sampled rows.
+     */
+    std::vector<std::uint64_t> selectSamplePositions(
+            std::uint64_t rowCount, std::mt19937_64& randomGenerator) const;
+
+    /**
+     * Estimates number of distinct values in the column from the sample.
+     * @param valueCounts Number of occurrences of each sampled value by value hash.
+     * @param sampleValueCount Number of sampled non-NULL values.
+     * @param totalValueCount Estimated number of non-NULL values in the column.
+     * @return Estimated number of distinct values.
+     */
+    static std::uint64_t estimateDistinctCount(
+            const std::unordered_map<std::size_t, std::uint64_t>& valueCounts,
+            std::uint64_t sampleValueCount, std::uint64_t totalValueCount);
+
+    /**
+     * Builds equi-depth histogram from the sampled values.
+     * @param values Sampled non-NULL values, reordered by this function.
+     * @return Histogram bounds, empty if values can't be ordered.
+     */
+    static std::vector<Variant> buildHistogram(std::vector<Variant>& values);
+
+private:
+    /** Table to analyze */
+    const TablePtr m_table;
+
+    /** Snapshot which defines visible rows */
+    const TransactionSnapshotPtr m_snapshot;
+
+    /** Maximum number of sampled rows */
+    const std::size_t m_sampleSize;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -10,10 +10,14 @@
 #include "DatabaseObjectName.h"
 #include "Index.h"
 #include "ThrowDatabaseError.h"
+#include "TransactionSnapshot.h"
 
 // Common project headers
 #include <siodb/common/utils/PlainBinaryEncoding.h>
 
+// STL headers
+#include <limits>
+
 namespace siodb::iomgr::dbengine {
 
 TableDataSet::TableDataSet(const TablePtr& table, const std::string& tableAlias)
@@ -94,6 +98,13 @@ void TableDataSet::resetCursor()
     m_valueReadMask.resize(m_columnInfos.size());
     m_values.resize(m_columnInfos.size());
 
+    if (m_snapshot) {
+        // Rows deleted after snapshot may precede first row in the index
+        m_hasCurrentRow = moveToNextVisibleRow(0);
+        if (m_hasCurrentRow) m_valueReadMask.fill(false);
+        return;
+    }
+
     m_hasCurrentRow = (maxTrid > 0);
     if (m_hasCurrentRow) {
         readMasterColumnRecord();
@@ -103,6 +114,14 @@ void TableDataSet::resetCursor()
 
 bool TableDataSet::moveToNextRow()
 {
+    if (m_snapshot) {
+        if (m_hasCurrentRow) {
+            m_hasCurrentRow = moveToNextVisibleRow(m_currentMcr.getTableRowId());
+            if (m_hasCurrentRow) m_valueReadMask.fill(false);
+        }
+        return m_hasCurrentRow;
+    }
+
     m_hasCurrentRow = m_masterColumnIndex->getNextKey(m_currentKey, m_nextKey);
     std::swap(m_currentKey, m_nextKey);
     if (m_hasCurrentRow) {
@@ -112,23 +131,200 @@ bool TableDataSet::moveToNextRow()
     return m_hasCurrentRow;
 }
 
-void TableDataSet::deleteCurrentRow(std::uint32_t currentUserId)
+bool TableDataSet::skipRows(std::uint64_t rowCount)
+{
+    if (rowCount == 0 || !m_hasCurrentRow) return m_hasCurrentRow;
+    if (m_snapshot) {
+        // Index doesn't know which rows are visible, so rows are stepped one by one
+        while (rowCount-- > 0 && moveToNextRow()) {
+        }
+        return m_hasCurrentRow;
+    }
+    m_hasCurrentRow = m_masterColumnIndex->getNthNextKey(m_currentKey, rowCount, m_nextKey);
+    std::swap(m_currentKey, m_nextKey);
+    if (m_hasCurrentRow) {
+        readMasterColumnRecord();
+        m_valueReadMask.fill(false);
+    }
+    return m_hasCurrentRow;
+}
+
+std::uint64_t TableDataSet::getCurrentRowId() const
+{
+    // Normally should never happen
+    if (!m_hasCurrentRow) throw std::runtime_error("No current row");
+    return m_currentMcr.getTableRowId();
+}
+
+bool TableDataSet::moveToRow(std::uint64_t rowId)
+{
+    // Cursor must be initialized before
+    if (m_currentKey == nullptr) resetCursor();
+
+    if (m_snapshot) {
+        m_hasCurrentRow = readVisibleRow(rowId);
+        if (m_hasCurrentRow) m_valueReadMask.fill(false);
+        return m_hasCurrentRow;
+    }
+
+    ::pbeEncodeUInt64(rowId, m_currentKey);
+    std::uint8_t value[12];
+    m_hasCurrentRow = m_masterColumnIndex->getValue(m_currentKey, value, 1) == 1;
+    if (m_hasCurrentRow) {
+        ColumnDataAddress mcrAddr;
+        mcrAddr.pbeDeserialize(value, sizeof(value));
+        readMasterColumnRecord(mcrAddr);
+        m_valueReadMask.fill(false);
+    }
+    return m_hasCurrentRow;
+}
+
+bool TableDataSet::moveToMasterColumnRecord(const ColumnDataAddress& mcrAddr)
 {
-    const TransactionParameters tp(
-            currentUserId, m_table->getDatabase().generateNextTransactionId());
-    m_table->deleteRow(m_currentMcr, m_currentMcrAddress, tp);
+    if (m_values.size() != m_columnInfos.size()) {
+        m_valueReadMask.resize(m_columnInfos.size());
+        m_values.resize(m_columnInfos.size());
+    }
+    if (m_snapshot)
+        m_hasCurrentRow = readVisibleVersion(mcrAddr);
+    else {
+        readMasterColumnRecord(mcrAddr);
+        m_hasCurrentRow = true;
+    }
+    if (m_hasCurrentRow) m_valueReadMask.fill(false);
+    return m_hasCurrentRow;
+}
+
+TableDataSet::SavedRow TableDataSet::saveCurrentRow() const
+{
+    // Normally should never happen
+    if (!m_hasCurrentRow) throw std::runtime_error("No current row");
+    return SavedRow {m_currentMcr, m_currentMcrAddress, m_values, m_valueReadMask};
+}
+
+void TableDataSet::readSavedRowValues(std::vector<SavedRow>& rows)
+{
+    for (std::size_t i = 0, n = m_columnInfos.size(); i != n; ++i) {
+        for (auto& row : rows) {
+            if (row.m_valueReadMask.getBit(i)) continue;
+            readColumnValue(i, row.m_mcr, row.m_values[i]);
+            row.m_valueReadMask.setBit(i, true);
+        }
+    }
+}
+
+void TableDataSet::restoreRow(SavedRow& row)
+{
+    std::swap(m_currentMcr, row.m_mcr);
+    m_currentMcrAddress = row.m_mcrAddress;
+    std::swap(m_values, row.m_values);
+    std::swap(m_valueReadMask, row.m_valueReadMask);
+    m_hasCurrentRow = true;
+}
+
+void TableDataSet::deleteCurrentRow(Transaction& transaction)
+{
+    m_table->deleteRow(
+            m_currentMcr, m_currentMcrAddress, transaction.getTransactionParameters());
+    transaction.recordChangedRow(m_table, m_currentMcr.getTableRowId(), m_currentMcrAddress);
 }
 
 void TableDataSet::updateCurrentRow(std::vector<Variant>&& values,
-        const std::vector<std::size_t>& columnPositions, std::uint32_t currentUserId)
+        const std::vector<std::size_t>& columnPositions, Transaction& transaction)
 {
-    const TransactionParameters tp(
-            currentUserId, m_table->getDatabase().generateNextTransactionId());
-    m_table->updateRow(m_currentMcr, m_currentMcrAddress, std::move(values), columnPositions, tp);
+    m_table->updateRow(m_currentMcr, m_currentMcrAddress, std::move(values), columnPositions,
+            transaction.getTransactionParameters());
+    transaction.recordChangedRow(m_table, m_currentMcr.getTableRowId(), m_currentMcrAddress);
 }
 
 // ---- internals ----
 
+bool TableDataSet::moveToNextVisibleRow(std::uint64_t trid)
+{
+    if (m_snapshot->isHistorical()) {
+        // Rows deleted long ago are neither in the index nor in the deleted row log,
+        // so all TRIDs ever allocated are checked
+        const auto lastTrid = m_masterColumn->getLastUserTrid();
+        while (trid < lastTrid) {
+            if (readVisibleRow(++trid)) return true;
+        }
+        return false;
+    }
+
+    while (true) {
+        // Find next row in the index
+        std::uint64_t indexTrid = 0, maxTrid = 0;
+        if (m_masterColumnIndex->getMaxKey(m_nextKey)) {
+            ::pbeDecodeUInt64(m_nextKey, &maxTrid);
+            if (trid == 0) {
+                if (m_masterColumnIndex->getMinKey(m_nextKey))
+                    ::pbeDecodeUInt64(m_nextKey, &indexTrid);
+            } else if (trid < maxTrid) {
+                ::pbeEncodeUInt64(trid, m_currentKey);
+                if (m_masterColumnIndex->getNextKey(m_currentKey, m_nextKey))
+                    ::pbeDecodeUInt64(m_nextKey, &indexTrid);
+            }
+        }
+
+        // Rows deleted from the index in between may still be visible to the snapshot
+        const auto deletedTrid = m_table->findDeletedRow(trid + 1,
+                indexTrid > 0 ? indexTrid - 1 : std::numeric_limits<std::uint64_t>::max());
+        const auto nextTrid = deletedTrid ? *deletedTrid : indexTrid;
+        if (nextTrid == 0) return false;
+        if (readVisibleRow(nextTrid)) return true;
+        trid = nextTrid;
+    }
+}
+
+bool TableDataSet::readVisibleRow(std::uint64_t trid)
+{
+    ColumnDataAddress mcrAddr;
+    std::uint8_t value[12];
+    ::pbeEncodeUInt64(trid, m_currentKey);
+    if (m_masterColumnIndex->getValue(m_currentKey, value, 1) == 1)
+        mcrAddr.pbeDeserialize(value, sizeof(value));
+    else if (m_snapshot->isHistorical()) {
+        // Deleted key keeps address of the deletion record
+        if (!m_masterColumnIndex->getDeletedValue(m_currentKey, value)) return false;
+        mcrAddr.pbeDeserialize(value, sizeof(value));
+    } else {
+        // Row is recorded as deleted before it is removed from the index
+        const auto deletedRow = m_table->getDeletedRow(trid);
+        if (!deletedRow || m_snapshot->isVisible(deletedRow->m_transactionId)) return false;
+        mcrAddr = deletedRow->m_mcrAddress;
+    }
+    return readVisibleVersion(mcrAddr);
+}
+
+bool TableDataSet::readVisibleVersion(ColumnDataAddress mcrAddr)
+{
+    if (m_snapshot->isHistorical()) {
+        // Head record may be deletion, which has no column records, so it is not validated
+        m_masterColumn->readMasterColumnRecord(mcrAddr, m_currentMcr);
+        if (!m_snapshot->isVisible(
+                    m_currentMcr.getTransactionId(), m_currentMcr.getUpdateTimestamp())) {
+            // Long version chains are not walked record by record
+            const auto version = m_table->findVisibleRowVersion(
+                    m_currentMcr.getTableRowId(), mcrAddr, *m_snapshot);
+            if (!version || version->m_operationType == DmlOperationType::kDelete) return false;
+            readMasterColumnRecord(version->m_mcrAddress);
+        } else if (m_currentMcr.getAtomicOperationType() == DmlOperationType::kDelete)
+            return false;
+        else
+            acceptMasterColumnRecord(mcrAddr);
+        return true;
+    }
+
+    while (true) {
+        readMasterColumnRecord(mcrAddr);
+        if (m_snapshot->isVisible(m_currentMcr.getTransactionId())) break;
+        // Version was written after snapshot, step to the previous one
+        mcrAddr = m_currentMcr.getPreviousVersionAddress();
+        if (mcrAddr.isNullValueAddress()) return false;
+    }
+    return m_currentMcr.getAtomicOperationType() != DmlOperationType::kDelete;
+}
+
 void TableDataSet::readMasterColumnRecord()
 {
     std::uint8_t value[12];
@@ -142,10 +338,18 @@ void TableDataSet::readMasterColumnRecord()
 
     ColumnDataAddress mcrAddr;
     mcrAddr.pbeDeserialize(value, sizeof(value));
+    readMasterColumnRecord(mcrAddr);
+}
 
+void TableDataSet::readMasterColumnRecord(const ColumnDataAddress& mcrAddr)
+{
     // Read and validate master column record
     m_masterColumn->readMasterColumnRecord(mcrAddr, m_currentMcr);
+    acceptMasterColumnRecord(mcrAddr);
+}
 
+void TableDataSet::acceptMasterColumnRecord(const ColumnDataAddress& mcrAddr)
+{
     // + TRID
     if (m_currentMcr.getColumnCount() + 1 != m_table->getColumnCount()) {
         throwDatabaseError(IOManagerMessageId::kErrorInvalidMasterColumnRecordColumnCount,
@@ -159,22 +363,26 @@ void TableDataSet::readMasterColumnRecord()
 
 void TableDataSet::readColumnValue(std::size_t index)
 {
-    auto& value = m_values.at(index);
+    readColumnValue(index, m_currentMcr, m_values.at(index));
+    m_valueReadMask.setBit(index, true);
+}
+
+void TableDataSet::readColumnValue(
+        std::size_t index, const MasterColumnRecord& mcr, Variant& value)
+{
     const auto pos = m_columnInfos.at(index).m_posInTable;
     auto& column = m_tableColumns.at(pos);
 
     if (column->isMasterColumn())
-        value = m_currentMcr.getTableRowId();
+        value = mcr.getTableRowId();
     else {
-        column->readRecord(m_currentMcr.getColumnRecords().at(pos - 1).getAddress(), value, false);
+        column->readRecord(mcr.getColumnRecords().at(pos - 1).getAddress(), value, false);
         if (value.isNull() && column->isNotNull()) {
             throwDatabaseError(IOManagerMessageId::kErrorUnexpectedNullValue,
                     m_table->getDatabaseName(), m_table->getName(), column->getName(),
-                    m_currentMcr.getTableRowId());
+                    mcr.getTableRowId());
         }
     }
-
-    m_valueReadMask.setBit(index, true);
 }
 
 }  // namespace siodb::iomgr::dbengine
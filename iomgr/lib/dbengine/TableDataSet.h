@@ -8,6 +8,8 @@
 #include "Column.h"
 #include "DataSet.h"
 #include "Table.h"
+#include "Transaction.h"
+#include "TransactionSnapshotPtr.h"
 
 // Common project headers
 #include <siodb/common/utils/HelperMacros.h>
@@ -21,6 +23,25 @@ namespace siodb::iomgr::dbengine {
  * Class for reading rows from table
  */
 class TableDataSet final : public DataSet {
+public:
+    /**
+     * Row saved from the cursor, which contains master column record
+     * and column values read so far.
+     */
+    struct SavedRow {
+        /** Master column record */
+        MasterColumnRecord m_mcr;
+
+        /** Master column record address */
+        ColumnDataAddress m_mcrAddress;
+
+        /** Column values */
+        std::vector<Variant> m_values;
+
+        /** Indicates which values are already read */
+        utils::Bitmask m_valueReadMask;
+    };
+
 public:
     /**
      * Initializes object of class TableDataSet.
@@ -53,6 +74,26 @@ public:
      */
     const std::string& getName() const noexcept override;
 
+    /**
+     * Returns snapshot used for reading rows.
+     * @return Transaction snapshot or nullptr if latest row versions are read.
+     */
+    const TransactionSnapshotPtr& getSnapshot() const noexcept
+    {
+        return m_snapshot;
+    }
+
+    /**
+     * Sets snapshot used for reading rows. Cursor then returns only rows and row versions
+     * visible to the snapshot, walking back the row version chain when row was changed
+     * by a newer transaction. Must be called before cursor is reset.
+     * @param snapshot Transaction snapshot or nullptr to read latest row versions.
+     */
+    void setSnapshot(const TransactionSnapshotPtr& snapshot) noexcept
+    {
+        m_snapshot = snapshot;
+    }
+
     /**
      * Returns current master column record.
      * @return Current master column record.
@@ -110,34 +151,131 @@ public:
      */
     bool moveToNextRow() override;
 
+    /**
+     * Moves dataset forward by the given number of rows. Without snapshot, skipped rows
+     * are located via the master column index, their master column records are not read.
+     * @param rowCount Number of rows to skip.
+     * @return true if row data available for reading, false otherwise
+     */
+    bool skipRows(std::uint64_t rowCount);
+
+    /**
+     * Returns TRID of the current row.
+     * @return Current row TRID.
+     * @throw std::runtime_error if row data is not avaliable.
+     */
+    std::uint64_t getCurrentRowId() const override;
+
+    /**
+     * Moves dataset to the row with given TRID.
+     * @param rowId Row TRID.
+     * @return true if row exists, false otherwise.
+     */
+    bool moveToRow(std::uint64_t rowId) override;
+
+    /**
+     * Moves dataset to the row with given master column record address.
+     * Unlike other cursor functions, doesn't access master column index.
+     * @param mcrAddr Master column record address.
+     * @return true if some version of the row is visible to the snapshot, false otherwise.
+     */
+    bool moveToMasterColumnRecord(const ColumnDataAddress& mcrAddr);
+
+    /**
+     * Saves current row, so that remaining column values can be read later.
+     * @return Saved row.
+     * @throw std::runtime_error if row data is not avaliable.
+     */
+    SavedRow saveCurrentRow() const;
+
+    /**
+     * Reads all not yet read column values of the saved rows. Values are read column
+     * by column, so that consecutive reads of the same column hit the same data blocks.
+     * @param rows Saved rows.
+     * @throw DatabaseError if some value can't be read.
+     */
+    void readSavedRowValues(std::vector<SavedRow>& rows);
+
+    /**
+     * Makes saved row current. Saved row is left in the unspecified state.
+     * @param row Saved row.
+     */
+    void restoreRow(SavedRow& row);
+
     /**
      * Deletes current row.
-     * @param currentUserId Current user ID.
+     * @param transaction Transaction which makes change.
      * @throw DatabaseError in case of database error.
      */
-    void deleteCurrentRow(std::uint32_t currentUserId);
+    void deleteCurrentRow(Transaction& transaction);
 
     /**
      * Updates dataset's current row
      * @param values New values.
      * @param columnPositions Positions of columns from the table, count must be equal to
      *                        values count.
-     * @param currentUserId Current user ID.
+     * @param transaction Transaction which makes change.
      * @throw DatabaseError in case of database error.
      */
     void updateCurrentRow(std::vector<Variant>&& values,
-            const std::vector<std::size_t>& columnPositions, std::uint32_t currentUserId);
+            const std::vector<std::size_t>& columnPositions, Transaction& transaction);
 
 private:
+    /**
+     * Moves to the next row visible to the snapshot. Historical snapshot
+     * checks every allocated TRID, since rows deleted long ago are still visible to it.
+     * @param trid TRID after which row is searched, zero to start from the first row.
+     * @return true if row found, false otherwise.
+     */
+    bool moveToNextVisibleRow(std::uint64_t trid);
+
+    /**
+     * Reads version of the row visible to the snapshot. Row may be already deleted
+     * from the master column index.
+     * @param trid Table row ID.
+     * @return true if row is visible, false otherwise.
+     */
+    bool readVisibleRow(std::uint64_t trid);
+
+    /**
+     * Reads version of the row visible to the snapshot, starting from the given
+     * master column record and walking back the version chain.
+     * @param mcrAddr Address of the newest master column record to consider.
+     * @return true if row is visible, false if it was created after snapshot
+     *         or deleted before it.
+     */
+    bool readVisibleVersion(ColumnDataAddress mcrAddr);
+
     /** Reads master column record of the current row. */
     void readMasterColumnRecord();
 
+    /**
+     * Reads master column record at the given address.
+     * @param mcrAddr Master column record address.
+     */
+    void readMasterColumnRecord(const ColumnDataAddress& mcrAddr);
+
+    /**
+     * Validates master column record that was read into the current one
+     * and makes it current row record.
+     * @param mcrAddr Master column record address.
+     */
+    void acceptMasterColumnRecord(const ColumnDataAddress& mcrAddr);
+
     /**
      * Reads value of the column.
      * @param index Column Index.
      */
     void readColumnValue(std::size_t index);
 
+    /**
+     * Reads value of the column from the given row.
+     * @param index Column Index.
+     * @param mcr Master column record of the row.
+     * @param value Value destination.
+     */
+    void readColumnValue(std::size_t index, const MasterColumnRecord& mcr, Variant& value);
+
 private:
     /** Table object */
     const TablePtr m_table;
@@ -165,6 +303,9 @@ private:
 
     /** Next row key from index */
     std::uint8_t* m_nextKey;
+
+    /** Transaction snapshot, nullptr if latest row versions are read */
+    TransactionSnapshotPtr m_snapshot;
 };
 
 }  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,283 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "TableStatistics.h"
+
+// Project headers
+#include "parser/expr/BetweenOperator.h"
+#include "parser/expr/ConstantExpression.h"
+#include "parser/expr/InOperator.h"
+#include "parser/expr/IsOperator.h"
+#include "parser/expr/SingleColumnExpression.h"
+#include "parser/expr/UnaryOperator.h"
+
+// Common project headers
+#include <siodb/common/utils/Base128VariantEncoding.h>
+
+// STL headers
+#include <algorithm>
+#include <cmath>
+
+namespace siodb::iomgr::dbengine {
+
+namespace {
+
+/**
+ * Returns statistics of the column referred by expression.
+ * @param tableStatistics Table statistics.
+ * @param expression An expression.
+ * @return Column statistics or nullptr if expression is not an analyzed column.
+ */
+const ColumnStatistics* getColumnStatistics(
+        const TableStatistics& tableStatistics, const requests::Expression& expression)
+{
+    if (expression.getType() != requests::ExpressionType::kSingleColumnReference) return nullptr;
+    return tableStatistics.findColumn(
+            static_cast<const requests::SingleColumnExpression&>(expression).getColumnName());
+}
+
+/**
+ * Returns value of the constant expression.
+ * @param expression An expression.
+ * @return Constant value or nullptr if expression is not a constant.
+ */
+const Variant* getConstantValue(const requests::Expression& expression) noexcept
+{
+    if (expression.getType() != requests::ExpressionType::kConstant) return nullptr;
+    return &static_cast<const requests::ConstantExpression&>(expression).getValue();
+}
+
+/**
+ * Returns comparison type with swapped operands.
+ * @param type Comparison type.
+ * @return Comparison type, which gives the same result with swapped operands.
+ */
+requests::ExpressionType getMirroredComparison(requests::ExpressionType type) noexcept
+{
+    switch (type) {
+        case requests::ExpressionType::kLessPredicate:
+            return requests::ExpressionType::kGreaterPredicate;
+        case requests::ExpressionType::kLessOrEqualPredicate:
+            return requests::ExpressionType::kGreaterOrEqualPredicate;
+        case requests::ExpressionType::kGreaterPredicate:
+            return requests::ExpressionType::kLessPredicate;
+        case requests::ExpressionType::kGreaterOrEqualPredicate:
+            return requests::ExpressionType::kLessOrEqualPredicate;
+        default: return type;
+    }
+}
+
+/**
+ * Returns estimated fraction of rows in which "column <comparison> value" is true.
+ * @param column Column statistics.
+ * @param type Comparison type.
+ * @param value Value compared with column.
+ * @return Selectivity.
+ */
+double estimateComparison(
+        const ColumnStatistics& column, requests::ExpressionType type, const Variant& value)
+{
+    // Comparison with NULL is never true
+    if (value.isNull()) return 0.0;
+    const auto nonNullFraction = 1.0 - column.m_nullFraction;
+    switch (type) {
+        case requests::ExpressionType::kEqualPredicate:
+            return column.getEqualSelectivity(value);
+        case requests::ExpressionType::kNotEqualPredicate:
+            return nonNullFraction - column.getEqualSelectivity(value);
+        case requests::ExpressionType::kLessPredicate:
+            return column.getLessSelectivity(value, false);
+        case requests::ExpressionType::kLessOrEqualPredicate:
+            return column.getLessSelectivity(value, true);
+        case requests::ExpressionType::kGreaterPredicate:
+            return nonNullFraction - column.getLessSelectivity(value, true);
+        case requests::ExpressionType::kGreaterOrEqualPredicate:
+            return nonNullFraction - column.getLessSelectivity(value, false);
+        default: return TableStatistics::kDefaultSelectivity;
+    }
+}
+
+}  // namespace
+
+double ColumnStatistics::getEqualSelectivity(const Variant& value) const
+{
+    if (value.isNull()) return 0.0;
+    if (!m_histogramBounds.empty()) {
+        try {
+            if (value.compatibleLess(m_histogramBounds.front())
+                    || m_histogramBounds.back().compatibleLess(value))
+                return 0.0;
+        } catch (VariantLogicError&) {
+            // Value is not comparable with column values, rely on distinct count
+        }
+    }
+    return m_distinctCount > 0 ? (1.0 - m_nullFraction) / m_distinctCount : 0.0;
+}
+
+double ColumnStatistics::getLessSelectivity(const Variant& value, bool orEqual) const
+{
+    if (value.isNull()) return 0.0;
+    const auto nonNullFraction = 1.0 - m_nullFraction;
+    if (m_histogramBounds.size() < 2) return nonNullFraction * TableStatistics::kDefaultSelectivity;
+
+    try {
+        // Find first bound which is greater than value (or not less than value)
+        const auto it = orEqual ? std::upper_bound(m_histogramBounds.cbegin(),
+                                          m_histogramBounds.cend(), value,
+                                          [](const Variant& v, const Variant& bound) {
+                                              return v.compatibleLess(bound);
+                                          })
+                                : std::lower_bound(m_histogramBounds.cbegin(),
+                                          m_histogramBounds.cend(), value,
+                                          [](const Variant& bound, const Variant& v) {
+                                              return bound.compatibleLess(v);
+                                          });
+        const auto boundCount = static_cast<std::size_t>(it - m_histogramBounds.cbegin());
+        if (boundCount == 0) return 0.0;
+        if (boundCount == m_histogramBounds.size()) return nonNullFraction;
+
+        // Values are assumed to be uniformly distributed inside the bucket
+        const auto& lower = *(it - 1);
+        const auto& upper = *it;
+        double position = 0.5;
+        if (value.isNumeric() && lower.isNumeric() && upper.isNumeric()) {
+            const auto lowerValue = lower.asDouble();
+            const auto upperValue = upper.asDouble();
+            if (upperValue > lowerValue) {
+                position = std::clamp(
+                        (value.asDouble() - lowerValue) / (upperValue - lowerValue), 0.0, 1.0);
+            }
+        }
+        const auto bucketCount = m_histogramBounds.size() - 1;
+        return nonNullFraction * (boundCount - 1 + position) / bucketCount;
+    } catch (VariantLogicError&) {
+        return nonNullFraction * TableStatistics::kDefaultSelectivity;
+    }
+}
+
+BinaryValue ColumnStatistics::serializeHistogram() const
+{
+    const auto boundCount = static_cast<std::uint32_t>(m_histogramBounds.size());
+    std::size_t size = ::getVarUInt32Size(boundCount);
+    for (const auto& bound : m_histogramBounds)
+        size += bound.getSerializedSize();
+
+    BinaryValue data(size);
+    auto p = ::encodeVarUInt32(boundCount, data.data());
+    for (const auto& bound : m_histogramBounds)
+        p = bound.serializeUnchecked(p);
+    return data;
+}
+
+void ColumnStatistics::deserializeHistogram(const BinaryValue& data)
+{
+    std::uint32_t boundCount = 0;
+    const int consumed = ::decodeVarUInt32(data.data(), data.size(), &boundCount);
+    if (consumed < 1) throw std::runtime_error("Invalid histogram bound count");
+
+    std::vector<Variant> bounds(boundCount);
+    std::size_t offset = consumed;
+    for (auto& bound : bounds)
+        offset += bound.deserialize(data.data() + offset, data.size() - offset);
+    m_histogramBounds = std::move(bounds);
+}
+
+double TableStatistics::estimateSelectivity(const requests::Expression& predicate) const
+{
+    double selectivity = kDefaultSelectivity;
+    switch (predicate.getType()) {
+        case requests::ExpressionType::kLogicalAndOperator: {
+            const auto& op = static_cast<const requests::BinaryOperator&>(predicate);
+            selectivity = estimateSelectivity(op.getLeftOperand())
+                          * estimateSelectivity(op.getRightOperand());
+            break;
+        }
+        case requests::ExpressionType::kLogicalOrOperator: {
+            const auto& op = static_cast<const requests::BinaryOperator&>(predicate);
+            const auto left = estimateSelectivity(op.getLeftOperand());
+            const auto right = estimateSelectivity(op.getRightOperand());
+            selectivity = left + right - left * right;
+            break;
+        }
+        case requests::ExpressionType::kLogicalNotOperator: {
+            const auto& op = static_cast<const requests::UnaryOperator&>(predicate);
+            selectivity = 1.0 - estimateSelectivity(op.getOperand());
+            break;
+        }
+        case requests::ExpressionType::kEqualPredicate:
+        case requests::ExpressionType::kNotEqualPredicate:
+        case requests::ExpressionType::kLessPredicate:
+        case requests::ExpressionType::kLessOrEqualPredicate:
+        case requests::ExpressionType::kGreaterPredicate:
+        case requests::ExpressionType::kGreaterOrEqualPredicate: {
+            const auto& op = static_cast<const requests::BinaryOperator&>(predicate);
+            auto type = predicate.getType();
+            auto column = getColumnStatistics(*this, op.getLeftOperand());
+            auto value = getConstantValue(op.getRightOperand());
+            if (!column || !value) {
+                column = getColumnStatistics(*this, op.getRightOperand());
+                value = getConstantValue(op.getLeftOperand());
+                type = getMirroredComparison(type);
+            }
+            if (column && value)
+                selectivity = estimateComparison(*column, type, *value);
+            else if (type == requests::ExpressionType::kEqualPredicate)
+                selectivity = kDefaultEqualSelectivity;
+            break;
+        }
+        case requests::ExpressionType::kBetweenPredicate: {
+            const auto& op = static_cast<const requests::BetweenOperator&>(predicate);
+            const auto column = getColumnStatistics(*this, op.getLeftOperand());
+            const auto lower = getConstantValue(op.getMiddleOperand());
+            const auto upper = getConstantValue(op.getRightOperand());
+            if (column && lower && upper) {
+                selectivity = std::max(0.0,
+                        estimateComparison(*column,
+                                requests::ExpressionType::kLessOrEqualPredicate, *upper)
+                                - estimateComparison(*column,
+                                        requests::ExpressionType::kLessPredicate, *lower));
+                if (op.isNotBetween()) selectivity = 1.0 - column->m_nullFraction - selectivity;
+            }
+            break;
+        }
+        case requests::ExpressionType::kInPredicate: {
+            const auto& op = static_cast<const requests::InOperator&>(predicate);
+            const auto column = getColumnStatistics(*this, op.getValue());
+            const auto& variants = op.getVariants();
+            if (column) {
+                double sum = 0.0;
+                for (const auto& variant : variants) {
+                    const auto value = getConstantValue(*variant);
+                    sum += value ? column->getEqualSelectivity(*value) : kDefaultEqualSelectivity;
+                }
+                const auto nonNullFraction = 1.0 - column->m_nullFraction;
+                selectivity = std::min(sum, nonNullFraction);
+                if (op.isNotIn()) selectivity = nonNullFraction - selectivity;
+            } else {
+                selectivity = std::min(1.0, variants.size() * kDefaultEqualSelectivity);
+                if (op.isNotIn()) selectivity = 1.0 - selectivity;
+            }
+            break;
+        }
+        case requests::ExpressionType::kIsPredicate: {
+            const auto& op = static_cast<const requests::IsOperator&>(predicate);
+            const auto column = getColumnStatistics(*this, op.getLeftOperand());
+            const auto value = getConstantValue(op.getRightOperand());
+            if (column && value && value->isNull())
+                selectivity = op.isNot() ? 1.0 - column->m_nullFraction : column->m_nullFraction;
+            break;
+        }
+        default: break;
+    }
+    return std::clamp(selectivity, 0.0, 1.0);
+}
+
+std::uint64_t TableStatistics::estimateRowCount(const requests::Expression* predicate) const
+{
+    if (!predicate || m_rowCount == 0) return m_rowCount;
+    const auto rowCount = std::llround(m_rowCount * estimateSelectivity(*predicate));
+    return std::max(static_cast<std::uint64_t>(rowCount), static_cast<std::uint64_t>(1));
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,120 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "parser/expr/Expression.h"
+
+// STL headers
+#include <memory>
+#include <unordered_map>
+
+namespace siodb::iomgr::dbengine {
+
+/** Column statistics collected by ANALYZE */
+struct ColumnStatistics {
+    /**
+     * Returns estimated fraction of rows in which column is equal to the value.
+     * @param value A value.
+     * @return Selectivity from 0 to 1.
+     */
+    double getEqualSelectivity(const Variant& value) const;
+
+    /**
+     * Returns estimated fraction of rows in which column is less than the value.
+     * @param value A value.
+     * @param orEqual Indication that equal values are counted too.
+     * @return Selectivity from 0 to 1.
+     */
+    double getLessSelectivity(const Variant& value, bool orEqual) const;
+
+    /**
+     * Serializes histogram bounds.
+     * @return Serialized histogram bounds.
+     * @throw VariantSerializationError if some value can't be serialized.
+     */
+    BinaryValue serializeHistogram() const;
+
+    /**
+     * Deserializes histogram bounds.
+     * @param data Serialized histogram bounds.
+     * @throw VariantDeserializationError, std::runtime_error if data is invalid.
+     */
+    void deserializeHistogram(const BinaryValue& data);
+
+    /** Column ID */
+    std::uint64_t m_columnId = 0;
+
+    /** Fraction of NULL values */
+    double m_nullFraction = 0.0;
+
+    /** Estimated number of distinct non-NULL values */
+    std::uint64_t m_distinctCount = 0;
+
+    /** Average width of non-NULL values in bytes */
+    double m_averageWidth = 0.0;
+
+    /**
+     * Equi-depth histogram of non-NULL values: each pair of adjacent bounds encloses
+     * the same number of sampled values. Empty if column type has no meaningful order
+     * or too few values were sampled.
+     */
+    std::vector<Variant> m_histogramBounds;
+};
+
+/** Table statistics collected by ANALYZE */
+struct TableStatistics {
+    /**
+     * Returns column statistics.
+     * @param columnName Column name.
+     * @return Column statistics or nullptr if column was not analyzed.
+     */
+    const ColumnStatistics* findColumn(const std::string& columnName) const noexcept
+    {
+        const auto it = m_columns.find(columnName);
+        return it == m_columns.end() ? nullptr : &it->second;
+    }
+
+    /**
+     * Returns estimated fraction of rows satisfying single table predicate.
+     * Conjuncts are assumed to be independent.
+     * @param predicate A predicate.
+     * @return Selectivity from 0 to 1.
+     */
+    double estimateSelectivity(const requests::Expression& predicate) const;
+
+    /**
+     * Returns estimated number of rows satisfying single table predicate.
+     * @param predicate A predicate, nullptr means all rows.
+     * @return Estimated number of rows, not less than 1 if table is not empty.
+     */
+    std::uint64_t estimateRowCount(const requests::Expression* predicate) const;
+
+    /** Table ID */
+    std::uint32_t m_tableId = 0;
+
+    /** Number of rows at the time of analysis */
+    std::uint64_t m_rowCount = 0;
+
+    /** Number of rows sampled for the histograms */
+    std::uint64_t m_sampleRowCount = 0;
+
+    /** Time of analysis, seconds since the epoch */
+    std::uint64_t m_analyzeTime = 0;
+
+    /** Column statistics by column name */
+    std::unordered_map<std::string, ColumnStatistics> m_columns;
+
+    /** Selectivity of the predicate which can't be estimated from the statistics */
+    static constexpr double kDefaultSelectivity = 1.0 / 3.0;
+
+    /** Selectivity of the equality, when column has no statistics */
+    static constexpr double kDefaultEqualSelectivity = 0.005;
+};
+
+/** Shared pointer to the table statistics */
+using TableStatisticsPtr = std::shared_ptr<const TableStatistics>;
+
+}  // namespace siodb::iomgr::dbengine
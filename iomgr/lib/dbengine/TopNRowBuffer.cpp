@@ -0,0 +1,85 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "TopNRowBuffer.h"
+
+// STL headers
+#include <algorithm>
+
+namespace siodb::iomgr::dbengine {
+
+TopNRowBuffer::TopNRowBuffer(
+        std::vector<bool>&& sortDescending, std::optional<std::uint64_t> maxRowCount)
+    : m_sortDescending(std::move(sortDescending))
+    , m_maxRowCount(maxRowCount)
+    , m_nextSequenceNumber(0)
+{
+    // Don't reserve huge amounts of memory for large limits in advance
+    constexpr std::uint64_t kMaxInitialCapacity = 1024;
+    if (m_maxRowCount) m_rows.reserve(std::min(*m_maxRowCount, kMaxInitialCapacity));
+}
+
+bool TopNRowBuffer::canAccept(const std::vector<Variant>& sortKeys) const
+{
+    if (!m_maxRowCount) return true;
+    if (*m_maxRowCount == 0) return false;
+    if (m_rows.size() < *m_maxRowCount) return true;
+    // Rows with equal keys arrived later go after the row on the heap top
+    return compareSortKeys(sortKeys, m_rows.front().m_sortKeys) < 0;
+}
+
+void TopNRowBuffer::addRow(std::vector<Variant>&& sortKeys, std::vector<std::uint64_t>&& rowIds)
+{
+    if (m_maxRowCount && *m_maxRowCount == 0) return;
+
+    const auto isBeforeFn = [this](const Row& left, const Row& right) {
+        return isBefore(left, right);
+    };
+
+    if (m_maxRowCount && m_rows.size() == *m_maxRowCount) {
+        // Drop last row from the heap top
+        std::pop_heap(m_rows.begin(), m_rows.end(), isBeforeFn);
+        m_rows.pop_back();
+    }
+
+    m_rows.push_back(Row {std::move(sortKeys), std::move(rowIds), m_nextSequenceNumber++});
+    if (m_maxRowCount) std::push_heap(m_rows.begin(), m_rows.end(), isBeforeFn);
+}
+
+std::vector<TopNRowBuffer::Row> TopNRowBuffer::takeSortedRows()
+{
+    const auto isBeforeFn = [this](const Row& left, const Row& right) {
+        return isBefore(left, right);
+    };
+
+    if (m_maxRowCount)
+        std::sort_heap(m_rows.begin(), m_rows.end(), isBeforeFn);
+    else
+        std::sort(m_rows.begin(), m_rows.end(), isBeforeFn);
+
+    std::vector<Row> result;
+    result.swap(m_rows);
+    return result;
+}
+
+int TopNRowBuffer::compareSortKeys(
+        const std::vector<Variant>& left, const std::vector<Variant>& right) const
+{
+    for (std::size_t i = 0; i < m_sortDescending.size(); ++i) {
+        const auto result = compareValues(left[i], right[i]);
+        if (result != 0) return m_sortDescending[i] ? -result : result;
+    }
+    return 0;
+}
+
+int TopNRowBuffer::compareValues(const Variant& left, const Variant& right)
+{
+    if (left.isNull()) return right.isNull() ? 0 : -1;
+    if (right.isNull()) return 1;
+    if (left.compatibleLess(right)) return -1;
+    if (right.compatibleLess(left)) return 1;
+    return 0;
+}
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,124 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "Variant.h"
+
+// STL headers
+#include <optional>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Collects rows for the ORDER BY clause. When maximum row count is given, only top N rows
+ * are kept in a bounded heap, so ORDER BY ... LIMIT takes O(rows * log N) time
+ * and O(N) memory. Otherwise all rows are kept and sorted at the end.
+ * Only sort keys and data set row identifiers are stored, other columns
+ * are expected to be read after sorting.
+ */
+class TopNRowBuffer final {
+public:
+    /** Collected row */
+    struct Row {
+        /** Sort key values */
+        std::vector<Variant> m_sortKeys;
+
+        /** Row identifiers, which allow to return to the row after sorting */
+        std::vector<std::uint64_t> m_rowIds;
+
+        /** Arrival sequence number, keeps original order of rows with equal keys */
+        std::uint64_t m_sequenceNumber;
+    };
+
+public:
+    /**
+     * Initializes object of class TopNRowBuffer.
+     * @param sortDescending Descending sort order indicators, one per sort key.
+     * @param maxRowCount Maximum number of rows to keep, no limit if not set.
+     */
+    TopNRowBuffer(std::vector<bool>&& sortDescending, std::optional<std::uint64_t> maxRowCount);
+
+    /**
+     * Returns number of collected rows.
+     * @return Number of collected rows.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_rows.size();
+    }
+
+    /**
+     * Returns indication that row with given sort keys would be accepted.
+     * Allows to avoid collecting row identifiers for rows that are dropped anyway.
+     * @param sortKeys Sort key values.
+     * @return true if row would be accepted, false otherwise.
+     * @throw VariantTypeCastError if sort keys can't be compared.
+     */
+    bool canAccept(const std::vector<Variant>& sortKeys) const;
+
+    /**
+     * Adds row to the buffer. If buffer is full, the last row in the sort order is dropped.
+     * Caller must check that row is accepted with canAccept() before.
+     * @param sortKeys Sort key values.
+     * @param rowIds Row identifiers in the each data set.
+     * @throw VariantTypeCastError if sort keys can't be compared.
+     */
+    void addRow(std::vector<Variant>&& sortKeys, std::vector<std::uint64_t>&& rowIds);
+
+    /**
+     * Returns collected rows in the sort order and clears buffer.
+     * @return Sorted rows.
+     * @throw VariantTypeCastError if sort keys can't be compared.
+     */
+    std::vector<Row> takeSortedRows();
+
+private:
+    /**
+     * Compares sort keys.
+     * @param left Left sort keys.
+     * @param right Right sort keys.
+     * @return Negative value if left keys go first, positive value if right keys go first,
+     *         zero if keys are equal.
+     */
+    int compareSortKeys(
+            const std::vector<Variant>& left, const std::vector<Variant>& right) const;
+
+    /**
+     * Compares two values in the ascending order. NULL goes before any other value.
+     * @param left Left value.
+     * @param right Right value.
+     * @return Negative value if left value is less, positive value if right value is less,
+     *         zero if values are equal.
+     */
+    static int compareValues(const Variant& left, const Variant& right);
+
+    /**
+     * Checks that left row goes before right row in the sort order.
+     * @param left Left row.
+     * @param right Right row.
+     * @return true if left row goes first, false otherwise.
+     */
+    bool isBefore(const Row& left, const Row& right) const
+    {
+        const auto result = compareSortKeys(left.m_sortKeys, right.m_sortKeys);
+        return result == 0 ? left.m_sequenceNumber < right.m_sequenceNumber : result < 0;
+    }
+
+private:
+    /** Descending sort order indicators */
+    const std::vector<bool> m_sortDescending;
+
+    /** Maximum number of rows */
+    const std::optional<std::uint64_t> m_maxRowCount;
+
+    /** Collected rows. When row count is limited, organized as heap with last row on top. */
+    std::vector<Row> m_rows;
+
+    /** Next row sequence number */
+    std::uint64_t m_nextSequenceNumber;
+};
+
+}  // namespace siodb::iomgr::dbengine
@@ -0,0 +1,137 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "Transaction.h"
+
+// Project headers
+#include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "Database.h"
+#include "Table.h"
+#include "ThrowDatabaseError.h"
+
+// Common project headers
+#include <siodb/common/log/Log.h>
+
+// STL headers
+#include <algorithm>
+#include <map>
+
+namespace siodb::iomgr::dbengine {
+
+Transaction::Transaction(const DatabasePtr& database, std::uint32_t userId)
+    : m_database(database)
+    , m_userId(userId)
+    , m_transactionId(database->beginTransaction())
+    , m_finished(false)
+{
+}
+
+Transaction::~Transaction()
+{
+    if (m_finished) return;
+    try {
+        rollback();
+    } catch (std::exception& ex) {
+        LOG_ERROR << "Database " << m_database->getName() << ": Can't roll back transaction #"
+                  << m_transactionId << ": " << ex.what();
+    }
+    finish();
+}
+
+void Transaction::recordInsertedRows(
+        const TablePtr& table, const std::vector<std::uint64_t>& trids)
+{
+    const auto tableIndex = getTableIndex(table);
+    m_undoLog.reserve(m_undoLog.size() + trids.size());
+    for (const auto trid : trids)
+        m_undoLog.push_back(UndoRecord {tableIndex, trid, ColumnDataAddress()});
+}
+
+void Transaction::recordChangedRow(
+        const TablePtr& table, std::uint64_t trid, const ColumnDataAddress& mcrAddress)
+{
+    m_undoLog.push_back(UndoRecord {getTableIndex(table), trid, mcrAddress});
+}
+
+void Transaction::rollbackTo(std::size_t undoPosition)
+{
+    if (undoPosition >= m_undoLog.size()) return;
+
+    // Each row is restored once, to the state it had at the given position
+    std::map<std::pair<std::size_t, std::uint64_t>, ColumnDataAddress> rows;
+    for (auto it = m_undoLog.cbegin() + undoPosition; it != m_undoLog.cend(); ++it)
+        rows.emplace(std::make_pair(it->m_tableIndex, it->m_trid), it->m_mcrAddress);
+
+    // Undo log is kept if rollback fails, restoring row again is harmless
+    const auto tp = getTransactionParameters();
+    for (const auto& row : rows)
+        m_tables[row.first.first]->restoreRow(row.first.second, row.second, tp);
+    m_undoLog.resize(undoPosition);
+}
+
+void Transaction::setSavepoint(const std::string& name)
+{
+    m_savepoints.emplace_back(name, m_undoLog.size());
+}
+
+void Transaction::releaseSavepoint(const std::string& name)
+{
+    m_savepoints.erase(findSavepoint(name), m_savepoints.end());
+}
+
+void Transaction::rollbackToSavepoint(const std::string& name)
+{
+    const auto it = findSavepoint(name);
+    rollbackTo(it->second);
+    m_savepoints.erase(it + 1, m_savepoints.end());
+}
+
+void Transaction::commit()
+{
+    flushTables();
+    finish();
+}
+
+void Transaction::rollback()
+{
+    rollbackTo(0);
+    m_savepoints.clear();
+    // Restored rows must reach disk too, otherwise rolled back changes reappear after restart
+    flushTables();
+    finish();
+}
+
+std::size_t Transaction::getTableIndex(const TablePtr& table)
+{
+    const auto it = std::find(m_tables.cbegin(), m_tables.cend(), table);
+    if (it != m_tables.cend()) return it - m_tables.cbegin();
+    m_tables.push_back(table);
+    return m_tables.size() - 1;
+}
+
+std::vector<std::pair<std::string, std::size_t>>::iterator Transaction::findSavepoint(
+        const std::string& name)
+{
+    // Latest savepoint with the given name is found first
+    const auto it = std::find_if(m_savepoints.rbegin(), m_savepoints.rend(),
+            [&name](const auto& savepoint) { return savepoint.first == name; });
+    if (it == m_savepoints.rend())
+        throwDatabaseError(IOManagerMessageId::kErrorSavepointDoesNotExist, name);
+    return std::prev(it.base());
+}
+
+void Transaction::flushTables() const
+{
+    for (const auto& table : m_tables)
+        table->flush();
+}
+
+void Transaction::finish() noexcept
+{
+    if (m_finished) return;
+    m_database->endTransaction(m_transactionId);
+    m_finished = true;
+}
+
+}  // namespace siodb::iomgr::dbengine
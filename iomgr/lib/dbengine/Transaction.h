@@ -0,0 +1,197 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "ColumnDataAddress.h"
+#include "DatabasePtr.h"
+#include "TablePtr.h"
+#include "TransactionParameters.h"
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Transaction, which spans one or more data modification statements.
+ * Changes become visible to the new snapshots and durable together, when transaction
+ * is committed. Data written by the transaction is flushed to disk once, on commit.
+ * Rolled back changes are undone by writing previous versions of the changed rows.
+ */
+class Transaction {
+public:
+    /**
+     * Initializes object of class Transaction. Begins new transaction.
+     * @param database Database in which transaction runs.
+     * @param userId ID of the user which runs transaction.
+     */
+    Transaction(const DatabasePtr& database, std::uint32_t userId);
+
+    /**
+     * Deinitializes object of class Transaction.
+     * Rolls back transaction, if it was neither committed nor rolled back.
+     */
+    ~Transaction();
+
+    DECLARE_NONCOPYABLE(Transaction);
+
+    /**
+     * Returns database in which transaction runs.
+     * @return Database object.
+     */
+    const DatabasePtr& getDatabase() const noexcept
+    {
+        return m_database;
+    }
+
+    /**
+     * Returns transaction ID.
+     * @return Transaction ID.
+     */
+    std::uint64_t getTransactionId() const noexcept
+    {
+        return m_transactionId;
+    }
+
+    /**
+     * Returns parameters for the next change made by this transaction.
+     * @return Transaction parameters.
+     */
+    TransactionParameters getTransactionParameters() const noexcept
+    {
+        return TransactionParameters(m_userId, m_transactionId);
+    }
+
+    /**
+     * Returns current position in the undo log, which can be used to roll back
+     * changes made after it.
+     * @return Undo log position.
+     */
+    std::size_t getUndoPosition() const noexcept
+    {
+        return m_undoLog.size();
+    }
+
+    /**
+     * Records rows inserted by this transaction.
+     * @param table Table.
+     * @param trids Inserted row IDs.
+     */
+    void recordInsertedRows(const TablePtr& table, const std::vector<std::uint64_t>& trids);
+
+    /**
+     * Records row updated or deleted by this transaction.
+     * @param table Table.
+     * @param trid Row ID.
+     * @param mcrAddress Address of the MCR which existed before the change.
+     */
+    void recordChangedRow(
+            const TablePtr& table, std::uint64_t trid, const ColumnDataAddress& mcrAddress);
+
+    /**
+     * Rolls back changes recorded after the given undo log position.
+     * @param undoPosition Undo log position.
+     * @throw DatabaseError if operation has failed.
+     */
+    void rollbackTo(std::size_t undoPosition);
+
+    /**
+     * Creates savepoint. Savepoint with the same name hides previous one until released.
+     * @param name Savepoint name.
+     */
+    void setSavepoint(const std::string& name);
+
+    /**
+     * Releases savepoint and all savepoints created after it.
+     * @param name Savepoint name.
+     * @throw DatabaseError if savepoint doesn't exist.
+     */
+    void releaseSavepoint(const std::string& name);
+
+    /**
+     * Rolls back changes made after the savepoint. Savepoint remains valid.
+     * @param name Savepoint name.
+     * @throw DatabaseError if savepoint doesn't exist or rollback has failed.
+     */
+    void rollbackToSavepoint(const std::string& name);
+
+    /**
+     * Flushes all changes to disk and makes them visible. If flush fails,
+     * transaction remains active and can be rolled back.
+     * @throw DatabaseError if flush has failed.
+     */
+    void commit();
+
+    /**
+     * Rolls back all changes and ends transaction.
+     * @throw DatabaseError if operation has failed.
+     */
+    void rollback();
+
+private:
+    /** Undo log record */
+    struct UndoRecord {
+        /** Index of the table in the list of changed tables */
+        std::size_t m_tableIndex;
+
+        /** Row ID */
+        std::uint64_t m_trid;
+
+        /** Address of the MCR existed before change, null address for inserted row */
+        ColumnDataAddress m_mcrAddress;
+    };
+
+    /**
+     * Returns index of the table in the list of changed tables, adds table if needed.
+     * @param table Table.
+     * @return Table index.
+     */
+    std::size_t getTableIndex(const TablePtr& table);
+
+    /**
+     * Finds savepoint by name.
+     * @param name Savepoint name.
+     * @return Savepoint iterator.
+     * @throw DatabaseError if savepoint doesn't exist.
+     */
+    std::vector<std::pair<std::string, std::size_t>>::iterator findSavepoint(
+            const std::string& name);
+
+    /** Flushes data of all changed tables to disk. */
+    void flushTables() const;
+
+    /** Ends transaction. */
+    void finish() noexcept;
+
+private:
+    /** Database in which transaction runs */
+    const DatabasePtr m_database;
+
+    /** User ID */
+    const std::uint32_t m_userId;
+
+    /** Transaction ID */
+    const std::uint64_t m_transactionId;
+
+    /** Tables changed by transaction */
+    std::vector<TablePtr> m_tables;
+
+    /** Undo log */
+    std::vector<UndoRecord> m_undoLog;
+
+    /** Savepoint names and undo log positions, in order of creation */
+    std::vector<std::pair<std::string, std::size_t>> m_savepoints;
+
+    /** Indicates that transaction is committed or rolled back */
+    bool m_finished;
+};
+
+}  // namespace siodb::iomgr::dbengine
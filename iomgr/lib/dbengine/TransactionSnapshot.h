@@ -0,0 +1,113 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+
+// STL headers
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace siodb::iomgr::dbengine {
+
+/**
+ * Set of transactions, which changes are visible to a reader.
+ * Transaction is visible if it has started before the snapshot
+ * and was not active at the moment of snapshot creation.
+ * Historical snapshot additionally limits visible row versions by timestamp.
+ */
+class TransactionSnapshot {
+public:
+    /**
+     * Initializes object of class TransactionSnapshot.
+     * @param horizon First transaction ID which was not started at the moment of snapshot
+     *                creation.
+     * @param activeTransactionIds Sorted IDs of the transactions which were active
+     *                             at the moment of snapshot creation.
+     * @param historical Indication that snapshot reads past state of the database.
+     * @param maxTimestamp Latest visible row version timestamp.
+     */
+    TransactionSnapshot(std::uint64_t horizon, std::vector<std::uint64_t>&& activeTransactionIds,
+            bool historical = false,
+            std::uint64_t maxTimestamp = std::numeric_limits<std::uint64_t>::max()) noexcept
+        : m_horizon(horizon)
+        , m_activeTransactionIds(std::move(activeTransactionIds))
+        , m_historical(historical)
+        , m_maxTimestamp(maxTimestamp)
+    {
+    }
+
+    DECLARE_NONCOPYABLE(TransactionSnapshot);
+
+    /**
+     * Returns first transaction ID which was not started at the moment of snapshot creation.
+     * @return Transaction ID.
+     */
+    std::uint64_t getHorizon() const noexcept
+    {
+        return m_horizon;
+    }
+
+    /**
+     * Returns indication that snapshot reads past state of the database.
+     * Rows deleted long ago may be visible to such snapshot.
+     * @return true if snapshot is historical, false otherwise.
+     */
+    bool isHistorical() const noexcept
+    {
+        return m_historical;
+    }
+
+    /**
+     * Returns smallest transaction ID which may be invisible to this snapshot.
+     * All transactions with smaller IDs are visible.
+     * @return Transaction ID.
+     */
+    std::uint64_t getMinInvisibleTransactionId() const noexcept
+    {
+        return m_activeTransactionIds.empty() ? m_horizon : m_activeTransactionIds.front();
+    }
+
+    /**
+     * Returns indication that changes made by the given transaction are visible.
+     * @param transactionId Transaction ID.
+     * @return true if transaction is visible, false otherwise.
+     */
+    bool isVisible(std::uint64_t transactionId) const noexcept
+    {
+        return transactionId < m_horizon
+               && !std::binary_search(m_activeTransactionIds.cbegin(),
+                       m_activeTransactionIds.cend(), transactionId);
+    }
+
+    /**
+     * Returns indication that row version is visible.
+     * @param transactionId ID of the transaction which created row version.
+     * @param timestamp Row version timestamp.
+     * @return true if row version is visible, false otherwise.
+     */
+    bool isVisible(std::uint64_t transactionId, std::uint64_t timestamp) const noexcept
+    {
+        return timestamp <= m_maxTimestamp && isVisible(transactionId);
+    }
+
+private:
+    /** First transaction ID which was not started at the moment of snapshot creation */
+    const std::uint64_t m_horizon;
+
+    /** Sorted IDs of the transactions which were active at the moment of snapshot creation */
+    const std::vector<std::uint64_t> m_activeTransactionIds;
+
+    /** Indication that snapshot reads past state of the database */
+    const bool m_historical;
+
+    /** Latest visible row version timestamp */
+    const std::uint64_t m_maxTimestamp;
+};
+
+}  // namespace siodb::iomgr::dbengine
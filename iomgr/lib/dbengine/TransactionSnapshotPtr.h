@@ -0,0 +1,17 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// STL headers
+#include <memory>
+
+namespace siodb::iomgr::dbengine {
+
+class TransactionSnapshot;
+
+/** Transaction snapshot shared pointer shortcut type */
+using TransactionSnapshotPtr = std::shared_ptr<const TransactionSnapshot>;
+
+}  // namespace siodb::iomgr::dbengine
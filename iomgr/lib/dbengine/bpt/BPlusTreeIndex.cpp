@@ -6,6 +6,7 @@
 
 // Project headers
 #include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "../Table.h"
 #include "../ThrowDatabaseError.h"
 
 // Common project headers
@@ -172,6 +173,11 @@ std::uint64_t BPlusTreeIndex::count(const void* key)
                    : 0;
 }
 
+std::optional<std::uint64_t> BPlusTreeIndex::getKeyCount()
+{
+    return std::nullopt;
+}
+
 bool BPlusTreeIndex::getMinKey([[maybe_unused]] void* key)
 {
     // TODO: Implement BPlusTreeIndex::getMinKey()
@@ -586,6 +592,12 @@ void BPlusTreeIndex::NodeCache::on_evict([[maybe_unused]] const key_type& key, m
 
 bool BPlusTreeIndex::NodeCache::on_last_chance_cleanup()
 {
+    // Index file is written through, so row data saved nodes point to must be on disk first
+    const bool hasModifiedNodes = std::any_of(map_internal().cbegin(), map_internal().cend(),
+            [](const auto& e) { return e.second.first->m_modified; });
+    if (!hasModifiedNodes) return false;
+    m_owner.m_table.flushColumnData();
+
     std::size_t savedCount = 0;
     for (const auto& e : map_internal()) {
         if (!e.second.first->m_modified) continue;
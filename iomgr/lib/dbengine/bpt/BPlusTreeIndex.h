@@ -120,6 +120,12 @@ public:
      */
     bool getMinKey(void* key) override;
 
+    /**
+     * Returns number of live (not deleted) keys in the index.
+     * @return Number of keys or std::nullopt if index can't provide it.
+     */
+    std::optional<std::uint64_t> getKeyCount() override;
+
     /**
      * Returns maximum key in the index.
      * @param key Buffer for storing key.
@@ -8,12 +8,16 @@
 #include "../DatabaseError.h"
 #include "../Instance.h"
 #include "../MasterColumnRecord.h"
+#include "../QueryProfile.h"
 #include "../TableDataSet.h"
+#include "../Transaction.h"
 #include "../Variant.h"
 #include "../parser/DBEngineRequest.h"
 #include "../parser/DatabaseContext.h"
+#include "../parser/expr/AggregateFunction.h"
 #include "../parser/expr/Expression.h"
 #include "../reg/ColumnRecord.h"
+#include "../../main/UniversalWorkerPool.h"
 
 // Common project headers
 #include <siodb/common/io/IoBase.h>
@@ -21,6 +25,9 @@
 // Protobuf message headers
 #include <siodb/common/proto/IOManagerProtocol.pb.h>
 
+// STL headers
+#include <functional>
+
 namespace siodb::iomgr::dbengine {
 
 /** Handles SQL based requests */
@@ -31,8 +38,11 @@ public:
      * @param instance DBMS instance.
      * @param connectionIo Connection with server file descriptor.
      * @param userId Current user ID.
+     * @param workerThreadPool Worker thread pool for the parallel table scan,
+     *                         nullptr means that tables are always scanned sequentially.
      */
-    RequestHandler(Instance& instance, siodb::io::IoBase& connectionIo, std::uint32_t userId);
+    RequestHandler(Instance& instance, siodb::io::IoBase& connectionIo, std::uint32_t userId,
+            UniversalWorkerPool* workerThreadPool = nullptr);
 
     /** De-initializes object of class RequestHandler */
     ~RequestHandler();
@@ -155,15 +165,34 @@ private:
     void executeRenameTableRequest(iomgr_protocol::DatabaseEngineResponse& response,
             const requests::RenameTableRequest& request);
 
+    /**
+     * Executes SQL analyze request.
+     * @param response Response object.
+     * @param request Request object.
+     */
+    void executeAnalyzeRequest(iomgr_protocol::DatabaseEngineResponse& response,
+            const requests::AnalyzeRequest& request);
+
     //** DML queries */
 
     /**
      * Executes SQL select request.
      * @param response Response object.
      * @param request Request object.
+     * @param profile Query profile, which receives query plan and, if query is analyzed,
+     *                execution statistics, while result rows are discarded.
+     *                nullptr means normal execution.
      */
     void executeSelectRequest(iomgr_protocol::DatabaseEngineResponse& response,
-            const requests::SelectRequest& request);
+            const requests::SelectRequest& request, QueryProfile* profile = nullptr);
+
+    /**
+     * Executes SQL EXPLAIN and EXPLAIN ANALYZE requests.
+     * @param response Response object.
+     * @param request Request object.
+     */
+    void executeExplainRequest(iomgr_protocol::DatabaseEngineResponse& response,
+            const requests::ExplainRequest& request);
 
     /**
      * Executes SQL update request.
@@ -189,6 +218,22 @@ private:
     void executeInsertRequest(iomgr_protocol::DatabaseEngineResponse& response,
             const requests::InsertRequest& request);
 
+    /**
+     * Executes SQL COPY FROM request.
+     * @param response Response object.
+     * @param request Request object.
+     */
+    void executeCopyFromRequest(iomgr_protocol::DatabaseEngineResponse& response,
+            const requests::CopyFromRequest& request);
+
+    /**
+     * Executes SQL COPY TO request.
+     * @param response Response object.
+     * @param request Request object.
+     */
+    void executeCopyToRequest(iomgr_protocol::DatabaseEngineResponse& response,
+            const requests::CopyToRequest& request);
+
     //** TCL queries */
 
     /**
@@ -287,6 +332,14 @@ private:
     void executeShowDatabasesRequest(iomgr_protocol::DatabaseEngineResponse& response,
             const requests::ShowDatabasesRequest& request);
 
+    /**
+     * Executes SQL SHOW STATEMENT CACHE request.
+     * @param response Response object.
+     * @param request Request object.
+     */
+    void executeShowStatementCacheRequest(iomgr_protocol::DatabaseEngineResponse& response,
+            const requests::ShowStatementCacheRequest& request);
+
     /**
      * Adds user visible database error to the response.
      * @param response Response object.
@@ -362,6 +415,50 @@ private:
             const requests::ConstExpressionPtr& expression,
             std::vector<CompoundDatabaseError::ErrorRecord>& errors) const;
 
+    /**
+     * Collects aggregate functions used in the expression and assigns indices to them.
+     * @param expression An expression.
+     * @param[out] aggregateFunctions List of aggregate functions.
+     * @param errors Vector with errors.
+     */
+    void collectAggregateFunctions(const requests::Expression& expression,
+            std::vector<const requests::AggregateFunction*>& aggregateFunctions,
+            std::vector<CompoundDatabaseError::ErrorRecord>& errors) const;
+
+    /**
+     * Adds operands of the expression to the list.
+     * @param expression An expression.
+     * @param[out] operands List of operands.
+     */
+    static void addOperands(const requests::Expression& expression,
+            std::vector<const requests::Expression*>& operands);
+
+    /**
+     * Executes data modification in the current explicit transaction, or in the new
+     * transaction which is committed right after modification. Changes of the failed
+     * modification are rolled back.
+     * @param database Database which is modified.
+     * @param operation Data modification operation.
+     * @throw DatabaseError if modification or commit has failed.
+     */
+    void executeInTransaction(const DatabasePtr& database,
+            const std::function<void(Transaction& transaction)>& operation);
+
+    /**
+     * Creates snapshot for the statement which reads the database. Changes of the current
+     * explicit transaction are visible to it.
+     * @param database Database which is read.
+     * @return Transaction snapshot.
+     */
+    TransactionSnapshotPtr createSnapshot(Database& database) const;
+
+    /**
+     * Returns ID of the current explicit transaction if it modifies the given database.
+     * @param database Database object.
+     * @return Transaction ID or zero if there is no such transaction.
+     */
+    std::uint64_t getOwnTransactionId(const Database& database) const noexcept;
+
     /**
      * Checks where expression.
      * @param whereExpression WHERE clause expression.
@@ -371,6 +468,45 @@ private:
     void checkWhereExpression(const requests::ConstExpressionPtr& whereExpression,
             requests::DatabaseContext& context);
 
+    /**
+     * Checks GROUP BY expressions.
+     * @param groupByExpressions GROUP BY clause expressions.
+     * @param context A context.
+     * @throw DatabaseError in case of invalid GROUP BY expression.
+     */
+    void checkGroupByExpressions(
+            const std::vector<requests::ConstExpressionPtr>& groupByExpressions,
+            requests::DatabaseContext& context);
+
+    /**
+     * Checks aggregate functions.
+     * @param aggregateFunctions Aggregate functions.
+     * @param context A context.
+     * @throw DatabaseError in case of invalid aggregate function.
+     */
+    void checkAggregateFunctions(
+            const std::vector<const requests::AggregateFunction*>& aggregateFunctions,
+            requests::DatabaseContext& context);
+
+    /**
+     * Checks HAVING expression.
+     * @param havingExpression HAVING clause expression.
+     * @param context A context.
+     * @throw DatabaseError in case of invalid HAVING expression.
+     */
+    void checkHavingExpression(const requests::ConstExpressionPtr& havingExpression,
+            requests::DatabaseContext& context);
+
+    /**
+     * Checks ORDER BY expressions.
+     * @param orderByExpressions ORDER BY clause expressions.
+     * @param context A context.
+     * @throw DatabaseError in case of invalid ORDER BY expression.
+     */
+    void checkOrderByExpressions(
+            const std::vector<requests::OrderByExpression>& orderByExpressions,
+            requests::DatabaseContext& context);
+
 private:
     /** DBMS instance */
     Instance& m_instance;
@@ -384,6 +520,12 @@ private:
     /** Current database */
     std::string m_currentDatabaseName;
 
+    /** Worker thread pool */
+    UniversalWorkerPool* const m_workerThreadPool;
+
+    /** Explicit transaction started by BEGIN TRANSACTION, if any */
+    std::unique_ptr<Transaction> m_transaction;
+
     /** Log context name */
     static constexpr const char* kLogContext = "RequestHandler: ";
 
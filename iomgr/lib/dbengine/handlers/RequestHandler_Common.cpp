@@ -10,6 +10,7 @@
 #include "../DatabaseError.h"
 #include "../Index.h"
 #include "../ThrowDatabaseError.h"
+#include "../parser/expr/AggregateFunction.h"
 #include "../parser/expr/BinaryOperator.h"
 #include "../parser/expr/ConstantExpression.h"
 #include "../parser/expr/InOperator.h"
@@ -31,12 +32,13 @@
 
 namespace siodb::iomgr::dbengine {
 
-RequestHandler::RequestHandler(
-        Instance& instance, siodb::io::IoBase& connectionIo, std::uint32_t userId)
+RequestHandler::RequestHandler(Instance& instance, siodb::io::IoBase& connectionIo,
+        std::uint32_t userId, UniversalWorkerPool* workerThreadPool)
     : m_instance(instance)
     , m_connectionIo(connectionIo)
     , m_userId(userId)
     , m_currentDatabaseName(Database::kSystemDatabaseName)
+    , m_workerThreadPool(workerThreadPool)
 {
     m_instance.getDatabaseChecked(m_currentDatabaseName)->use();
 }
@@ -68,16 +70,41 @@ void RequestHandler::executeRequest(const requests::DBEngineRequest& request,
                         response, dynamic_cast<const requests::SelectRequest&>(request));
                 break;
             }
+            case requests::DBEngineRequestType::kExplain: {
+                executeExplainRequest(
+                        response, dynamic_cast<const requests::ExplainRequest&>(request));
+                break;
+            }
             case requests::DBEngineRequestType::kShowDatabases: {
                 executeShowDatabasesRequest(
                         response, dynamic_cast<const requests::ShowDatabasesRequest&>(request));
                 break;
             }
+            case requests::DBEngineRequestType::kAnalyze: {
+                executeAnalyzeRequest(
+                        response, dynamic_cast<const requests::AnalyzeRequest&>(request));
+                break;
+            }
+            case requests::DBEngineRequestType::kShowStatementCache: {
+                executeShowStatementCacheRequest(response,
+                        dynamic_cast<const requests::ShowStatementCacheRequest&>(request));
+                break;
+            }
             case requests::DBEngineRequestType::kInsert: {
                 executeInsertRequest(
                         response, dynamic_cast<const requests::InsertRequest&>(request));
                 break;
             }
+            case requests::DBEngineRequestType::kCopyFrom: {
+                executeCopyFromRequest(
+                        response, dynamic_cast<const requests::CopyFromRequest&>(request));
+                break;
+            }
+            case requests::DBEngineRequestType::kCopyTo: {
+                executeCopyToRequest(
+                        response, dynamic_cast<const requests::CopyToRequest&>(request));
+                break;
+            }
             case requests::DBEngineRequestType::kUpdate: {
                 executeUpdateRequest(
                         response, dynamic_cast<const requests::UpdateRequest&>(request));
@@ -572,40 +599,98 @@ void RequestHandler::updateColumnsFromExpression(const std::vector<DataSetPtr>&
                 nonConstColumnExpression->setDatasetTableIndex(tableIndex);
                 nonConstColumnExpression->setDatasetColumnIndex(insertIter.first->second);
             }
-        } else if (expression->isUnaryOperator()) {
-            const auto unaryOperator = dynamic_cast<const requests::UnaryOperator*>(expression);
-            if (unaryOperator == nullptr) {
-                // Normally should never happen
-                throw std::runtime_error("UnaryOperator type cast failed");
-            }
-            expressions.push_back(&unaryOperator->getOperand());
-        } else if (expression->isBinaryOperator()) {
-            const auto binaryOperator = dynamic_cast<const requests::BinaryOperator*>(expression);
-            if (binaryOperator == nullptr) {
-                // Normally should never happen
-                throw std::runtime_error("BinaryOperator type cast failed");
-            }
-            expressions.push_back(&binaryOperator->getLeftOperand());
-            expressions.push_back(&binaryOperator->getRightOperand());
-        } else if (expression->isTernaryOperator()) {
-            const auto ternaryOperator = dynamic_cast<const requests::TernaryOperator*>(expression);
-            if (ternaryOperator == nullptr) {
-                // Normally should never happen
-                throw std::runtime_error("TernaryOperator type cast failed");
-            }
-            expressions.push_back(&ternaryOperator->getLeftOperand());
-            expressions.push_back(&ternaryOperator->getMiddleOperand());
-            expressions.push_back(&ternaryOperator->getRightOperand());
-        } else if (expression->getType() == requests::ExpressionType::kInPredicate) {
-            const auto inOperator = dynamic_cast<const requests::InOperator*>(expression);
-            if (inOperator == nullptr) {
-                // Normally should never happen
-                throw std::runtime_error("InOperator type cast failed");
+        } else
+            addOperands(*expression, expressions);
+    }
+}
+
+void RequestHandler::collectAggregateFunctions(const requests::Expression& expression,
+        std::vector<const requests::AggregateFunction*>& aggregateFunctions,
+        std::vector<CompoundDatabaseError::ErrorRecord>& errors) const
+{
+    std::vector<const requests::Expression*> expressions;
+    expressions.reserve(kReservedExpressionCount);
+    expressions.push_back(&expression);
+
+    while (!expressions.empty()) {
+        const auto expression = expressions.back();
+        expressions.pop_back();
+
+        if (!expression->isAggregateFunction()) {
+            addOperands(*expression, expressions);
+            continue;
+        }
+
+        const auto aggregateFunction =
+                dynamic_cast<const requests::AggregateFunction*>(expression);
+        if (aggregateFunction == nullptr) {
+            // Normally should never happen
+            throw std::runtime_error("AggregateFunction type cast failed");
+        }
+
+        if (aggregateFunction->getArgument()) {
+            std::vector<const requests::AggregateFunction*> nestedAggregateFunctions;
+            collectAggregateFunctions(
+                    *aggregateFunction->getArgument(), nestedAggregateFunctions, errors);
+            if (!nestedAggregateFunctions.empty()) {
+                errors.push_back(
+                        makeDatabaseError(IOManagerMessageId::kErrorInvalidAggregateFunction,
+                                "nested aggregate functions are not allowed"));
+                continue;
             }
-            expressions.push_back(&inOperator->getValue());
-            for (const auto& variant : inOperator->getVariants())
-                expressions.push_back(variant.get());
         }
+
+        // Required to set aggregate function index
+        stdext::as_mutable_ptr(aggregateFunction)->setAggregateIndex(aggregateFunctions.size());
+        aggregateFunctions.push_back(aggregateFunction);
+    }
+}
+
+void RequestHandler::addOperands(
+        const requests::Expression& expression, std::vector<const requests::Expression*>& operands)
+{
+    if (expression.isUnaryOperator()) {
+        const auto unaryOperator = dynamic_cast<const requests::UnaryOperator*>(&expression);
+        if (unaryOperator == nullptr) {
+            // Normally should never happen
+            throw std::runtime_error("UnaryOperator type cast failed");
+        }
+        operands.push_back(&unaryOperator->getOperand());
+    } else if (expression.isBinaryOperator()) {
+        const auto binaryOperator = dynamic_cast<const requests::BinaryOperator*>(&expression);
+        if (binaryOperator == nullptr) {
+            // Normally should never happen
+            throw std::runtime_error("BinaryOperator type cast failed");
+        }
+        operands.push_back(&binaryOperator->getLeftOperand());
+        operands.push_back(&binaryOperator->getRightOperand());
+    } else if (expression.isTernaryOperator()) {
+        const auto ternaryOperator = dynamic_cast<const requests::TernaryOperator*>(&expression);
+        if (ternaryOperator == nullptr) {
+            // Normally should never happen
+            throw std::runtime_error("TernaryOperator type cast failed");
+        }
+        operands.push_back(&ternaryOperator->getLeftOperand());
+        operands.push_back(&ternaryOperator->getMiddleOperand());
+        operands.push_back(&ternaryOperator->getRightOperand());
+    } else if (expression.getType() == requests::ExpressionType::kInPredicate) {
+        const auto inOperator = dynamic_cast<const requests::InOperator*>(&expression);
+        if (inOperator == nullptr) {
+            // Normally should never happen
+            throw std::runtime_error("InOperator type cast failed");
+        }
+        operands.push_back(&inOperator->getValue());
+        for (const auto& variant : inOperator->getVariants())
+            operands.push_back(variant.get());
+    } else if (expression.isAggregateFunction()) {
+        const auto aggregateFunction =
+                dynamic_cast<const requests::AggregateFunction*>(&expression);
+        if (aggregateFunction == nullptr) {
+            // Normally should never happen
+            throw std::runtime_error("AggregateFunction type cast failed");
+        }
+        if (aggregateFunction->getArgument())
+            operands.push_back(aggregateFunction->getArgument());
     }
 }
 
@@ -624,4 +709,68 @@ void RequestHandler::checkWhereExpression(
     }
 }
 
+void RequestHandler::checkGroupByExpressions(
+        const std::vector<requests::ConstExpressionPtr>& groupByExpressions,
+        requests::DatabaseContext& context)
+{
+    for (const auto& groupByExpression : groupByExpressions) {
+        try {
+            groupByExpression->validate(context);
+        } catch (std::exception& e) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidGroupByExpression, e.what());
+        }
+        const auto resultType = groupByExpression->getResultValueType(context);
+        if (resultType == VariantType::kClob || resultType == VariantType::kBlob) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidGroupByExpression,
+                    "LOB values can't be grouped");
+        }
+    }
+}
+
+void RequestHandler::checkAggregateFunctions(
+        const std::vector<const requests::AggregateFunction*>& aggregateFunctions,
+        requests::DatabaseContext& context)
+{
+    for (const auto aggregateFunction : aggregateFunctions) {
+        try {
+            aggregateFunction->validate(context);
+        } catch (std::exception& e) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidAggregateFunction, e.what());
+        }
+    }
+}
+
+void RequestHandler::checkHavingExpression(
+        const requests::ConstExpressionPtr& havingExpression, requests::DatabaseContext& context)
+{
+    if (!havingExpression) return;
+    try {
+        havingExpression->validate(context);
+    } catch (std::exception& e) {
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidHavingCondition, e.what());
+    }
+    if (!isBoolType(havingExpression->getResultValueType(context))) {
+        throwDatabaseError(
+                IOManagerMessageId::kErrorInvalidHavingCondition, "Result is not boolean value");
+    }
+}
+
+void RequestHandler::checkOrderByExpressions(
+        const std::vector<requests::OrderByExpression>& orderByExpressions,
+        requests::DatabaseContext& context)
+{
+    for (const auto& orderByExpression : orderByExpressions) {
+        try {
+            orderByExpression.m_subject->validate(context);
+        } catch (std::exception& e) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidOrderByExpression, e.what());
+        }
+        const auto resultType = orderByExpression.m_subject->getResultValueType(context);
+        if (resultType == VariantType::kClob || resultType == VariantType::kBlob) {
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidOrderByExpression,
+                    "LOB values can't be sorted");
+        }
+    }
+}
+
 }  // namespace siodb::iomgr::dbengine
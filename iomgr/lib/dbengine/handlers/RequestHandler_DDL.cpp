@@ -11,6 +11,7 @@
 #include "../DatabaseObjectName.h"
 #include "../MasterColumnRecord.h"
 #include "../Table.h"
+#include "../TableAnalyzer.h"
 #include "../ThrowDatabaseError.h"
 #include "../crypto/KeyGenerator.h"
 #include "../crypto/ciphers/Cipher.h"
@@ -93,6 +94,7 @@ void RequestHandler::executeCreateTableRequest(iomgr_protocol::DatabaseEngineRes
     // NOTE: Duplicate columns and columns with invalid names
     // are checked inside the createUserTable().
     db->createUserTable(request.m_table, TableType::kDisk, tableColumns, m_userId);
+    m_instance.getStatementCache().invalidateTable(request.m_table);
 
     protobuf::writeMessage(
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
@@ -155,6 +157,7 @@ void RequestHandler::executeDropDatabaseRequest(iomgr_protocol::DatabaseEngineRe
         throwDatabaseError(IOManagerMessageId::kErrorCannotDropCurrentDatabase, request.m_database);
 
     m_instance.dropDatabase(request.m_database, !request.m_ifExists, m_userId);
+    m_instance.getStatementCache().invalidateAll();
 
     protobuf::writeMessage(
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
@@ -286,4 +289,41 @@ void RequestHandler::executeRenameTableRequest(iomgr_protocol::DatabaseEngineRes
     sendNotImplementedYet(response);
 }
 
+void RequestHandler::executeAnalyzeRequest(iomgr_protocol::DatabaseEngineResponse& response,
+        const requests::AnalyzeRequest& request)
+{
+    response.set_has_affected_row_count(false);
+
+    const auto& dbName = request.m_database.empty() ? m_currentDatabaseName : request.m_database;
+    if (!isValidDatabaseObjectName(dbName))
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidDatabaseName, dbName);
+
+    const auto db = m_instance.getDatabaseChecked(dbName);
+    if (!db->isTableStatisticsSupported())
+        throwDatabaseError(IOManagerMessageId::kErrorTableStatisticsNotSupported, dbName);
+
+    std::vector<std::string> tableNames;
+    if (request.m_table.empty())
+        tableNames = db->getUserTableNames();
+    else {
+        if (!isValidDatabaseObjectName(request.m_table))
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidTableName, request.m_table);
+        if (db->isSystemTable(request.m_table)) {
+            throwDatabaseError(
+                    IOManagerMessageId::kErrorCannotAnalyzeSystemTable, dbName, request.m_table);
+        }
+        tableNames.push_back(request.m_table);
+    }
+
+    for (const auto& tableName : tableNames) {
+        const auto table = db->getTableChecked(tableName);
+        auto statistics = TableAnalyzer(table, createSnapshot(*db)).analyze();
+        const TransactionParameters tp(m_userId, db->generateNextTransactionId());
+        db->saveTableStatistics(std::move(statistics), tp);
+    }
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
+}
+
 }  // namespace siodb::iomgr::dbengine
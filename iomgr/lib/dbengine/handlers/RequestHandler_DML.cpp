@@ -6,13 +6,15 @@
 
 // Project headers
 #include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "../BulkDataExporter.h"
+#include "../BulkDataLoader.h"
 #include "../Column.h"
 #include "../Database.h"
 #include "../DatabaseObjectName.h"
 #include "../MasterColumnRecord.h"
 #include "../Table.h"
 #include "../ThrowDatabaseError.h"
-#include "../TransactionParameters.h"
+#include "../User.h"
 #include "../Variant.h"
 #include "../parser/DatabaseContext.h"
 #include "../parser/EmptyContext.h"
@@ -124,29 +126,35 @@ void RequestHandler::executeUpdateRequest(
     }
 
     std::uint64_t updatedRowCount = 0;
-    for (tableDataSet->resetCursor(); tableDataSet->hasCurrentRow();
-            tableDataSet->moveToNextRow()) {
-        // Read all columns required for where
-        if (request.m_where) {
-            try {
-                const auto rowFits = request.m_where->evaluate(dbContext);
-                if (!rowFits.getBool()) continue;
-            } catch (const std::runtime_error& e) {
-                // Catch exception from WHERE expression evaluation
-                throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, e.what());
-            } catch (const VariantLogicError& error) {
-                throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, error.what());
+    executeInTransaction(db, [&](Transaction& transaction) {
+        // Uncommitted rows of other transactions are not visible. Row changed concurrently
+        // after snapshot is rejected by the table, so that concurrent change is not lost.
+        tableDataSet->setSnapshot(db->createSnapshot(transaction.getTransactionId()));
+        for (tableDataSet->resetCursor(); tableDataSet->hasCurrentRow();
+                tableDataSet->moveToNextRow()) {
+            // Read all columns required for where
+            if (request.m_where) {
+                try {
+                    const auto rowFits = request.m_where->evaluate(dbContext);
+                    if (!rowFits.getBool()) continue;
+                } catch (const std::runtime_error& e) {
+                    // Catch exception from WHERE expression evaluation
+                    throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, e.what());
+                } catch (const VariantLogicError& error) {
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidWhereCondition, error.what());
+                }
             }
-        }
 
-        std::vector<Variant> values;
-        values.reserve(request.m_values.size());
-        for (const auto& value : request.m_values)
-            values.push_back(value->evaluate(dbContext));
+            std::vector<Variant> values;
+            values.reserve(request.m_values.size());
+            for (const auto& value : request.m_values)
+                values.push_back(value->evaluate(dbContext));
 
-        tableDataSet->updateCurrentRow(std::move(values), columnPositions, m_userId);
-        response.set_affected_row_count(++updatedRowCount);
-    }
+            tableDataSet->updateCurrentRow(std::move(values), columnPositions, transaction);
+            response.set_affected_row_count(++updatedRowCount);
+        }
+    });
 
     protobuf::writeMessage(
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
@@ -184,22 +192,28 @@ void RequestHandler::executeDeleteRequest(
     checkWhereExpression(request.m_where, dbContext);
 
     std::uint64_t deletedRowCount = 0;
-    for (tableDataSet->resetCursor(); tableDataSet->hasCurrentRow();
-            tableDataSet->moveToNextRow()) {
-        if (request.m_where) {
-            try {
-                const auto rowFits = request.m_where->evaluate(dbContext);
-                if (!rowFits.getBool()) continue;
-            } catch (const std::runtime_error& ex) {
-                // Catch exception from WHERE expression evaluation
-                throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, ex.what());
-            } catch (const VariantLogicError& error) {
-                throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, error.what());
+    executeInTransaction(db, [&](Transaction& transaction) {
+        // Uncommitted rows of other transactions are not visible. Row changed concurrently
+        // after snapshot is rejected by the table, so that concurrent change is not lost.
+        tableDataSet->setSnapshot(db->createSnapshot(transaction.getTransactionId()));
+        for (tableDataSet->resetCursor(); tableDataSet->hasCurrentRow();
+                tableDataSet->moveToNextRow()) {
+            if (request.m_where) {
+                try {
+                    const auto rowFits = request.m_where->evaluate(dbContext);
+                    if (!rowFits.getBool()) continue;
+                } catch (const std::runtime_error& ex) {
+                    // Catch exception from WHERE expression evaluation
+                    throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, ex.what());
+                } catch (const VariantLogicError& error) {
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidWhereCondition, error.what());
+                }
             }
+            tableDataSet->deleteCurrentRow(transaction);
+            response.set_affected_row_count(++deletedRowCount);
         }
-        tableDataSet->deleteCurrentRow(m_userId);
-        response.set_affected_row_count(++deletedRowCount);
-    }
+    });
 
     protobuf::writeMessage(
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
@@ -291,29 +305,97 @@ void RequestHandler::executeInsertRequest(
 
     if (!errors.empty()) throw CompoundDatabaseError(std::move(errors));
 
-    const TransactionParameters transactionParams(m_userId, db->generateNextTransactionId());
+    std::vector<std::vector<Variant>> rows(request.m_values.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const auto& row = request.m_values[i];
+        rows[i].reserve(row.size());
+        for (const auto& expression : row)
+            rows[i].push_back(expression->evaluate(context));
+    }
 
-    // Do not include TRID
-    const auto requestColumnCount =
-            requestHasColumns ? request.m_columns.size() : tableColumns.size() - 1;
+    // All rows are inserted at once
+    executeInTransaction(db, [&](Transaction& transaction) {
+        const auto trids = table->insertRows(
+                columnNames, rows, transaction.getTransactionParameters());
+        transaction.recordInsertedRows(table, trids);
+    });
+    response.set_affected_row_count(rows.size());
 
-    std::vector<Variant> rowValues;
-    rowValues.reserve(requestColumnCount);
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
+}
 
-    std::uint64_t insertedRowCount = 0;
-    for (const auto& row : request.m_values) {
-        rowValues.clear();
-        for (const auto& expression : row)
-            rowValues.push_back(expression->evaluate(context));
+void RequestHandler::executeCopyFromRequest(
+        iomgr_protocol::DatabaseEngineResponse& response, const requests::CopyFromRequest& request)
+{
+    response.set_affected_row_count(0);
+    response.set_has_affected_row_count(true);
+
+    // File is read by the server process, so only superuser may do it
+    if (m_userId != User::kSuperUserId)
+        throwDatabaseError(IOManagerMessageId::kErrorCopyFileAccessDenied);
+
+    const auto& dbName = request.m_database.empty() ? m_currentDatabaseName : request.m_database;
+    if (!isValidDatabaseObjectName(dbName))
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidDatabaseName, dbName);
+
+    const auto db = m_instance.getDatabaseChecked(dbName);
+
+    if (!isValidDatabaseObjectName(request.m_table))
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidTableName, request.m_table);
+
+    if (db->isSystemTable(request.m_table)) {
+        throwDatabaseError(
+                IOManagerMessageId::kErrorCannotCopyIntoSystemTable, dbName, request.m_table);
+    }
 
-        if (columnNames.empty())
-            table->insertRow(rowValues, transactionParams);
-        else
-            table->insertRow(columnNames, rowValues, transactionParams);
+    const auto table = db->getTableChecked(request.m_table);
 
-        response.set_affected_row_count(++insertedRowCount);
+    for (const auto& columnName : request.m_columns) {
+        if (columnName == Database::kMasterColumnName)
+            throwDatabaseError(IOManagerMessageId::kErrorCannotInsertIntoMasterColumn);
     }
 
+    // Values are parsed directly from the file, bypassing SQL parser and expressions
+    BulkDataLoader loader(table, request.m_columns, request.m_filePath, request.m_format,
+            request.m_delimiter, request.m_header);
+    // Rows are reported only after commit. COPY which fails at any point is rolled back
+    // completely, so the error response reports zero rows.
+    std::uint64_t rowCount = 0;
+    executeInTransaction(
+            db, [&](Transaction& transaction) { rowCount = loader.load(transaction); });
+    response.set_affected_row_count(rowCount);
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
+}
+
+void RequestHandler::executeCopyToRequest(
+        iomgr_protocol::DatabaseEngineResponse& response, const requests::CopyToRequest& request)
+{
+    response.set_affected_row_count(0);
+    response.set_has_affected_row_count(true);
+
+    // File is written by the server process, so only superuser may do it
+    if (m_userId != User::kSuperUserId)
+        throwDatabaseError(IOManagerMessageId::kErrorCopyFileAccessDenied);
+
+    const auto& dbName = request.m_database.empty() ? m_currentDatabaseName : request.m_database;
+    if (!isValidDatabaseObjectName(dbName))
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidDatabaseName, dbName);
+
+    const auto db = m_instance.getDatabaseChecked(dbName);
+
+    if (!isValidDatabaseObjectName(request.m_table))
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidTableName, request.m_table);
+
+    const auto table = db->getTableChecked(request.m_table);
+
+    // Values are read directly from the columns, bypassing expressions and query result encoding
+    BulkDataExporter exporter(table, request.m_columns, request.m_filePath, request.m_format,
+            request.m_delimiter, request.m_header, createSnapshot(*db));
+    response.set_affected_row_count(exporter.unload());
+
     protobuf::writeMessage(
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
 }
@@ -10,13 +10,20 @@
 #include "../ColumnSet.h"
 #include "../Database.h"
 #include "../DatabaseObjectName.h"
+#include "../HashAggregator.h"
 #include "../Index.h"
+#include "../ParallelTableScan.h"
+#include "../QueryProfile.h"
 #include "../Table.h"
 #include "../TableDataSet.h"
 #include "../ThrowDatabaseError.h"
+#include "../TopNRowBuffer.h"
+#include "../TransactionSnapshot.h"
 #include "../parser/DatabaseContext.h"
 #include "../parser/EmptyContext.h"
+#include "../parser/GroupContext.h"
 #include "../parser/expr/AllColumnsExpression.h"
+#include "../parser/expr/InOperator.h"
 #include "../parser/expr/SingleColumnExpression.h"
 
 // Common project headers
@@ -26,6 +33,11 @@
 #include <siodb/common/utils/EmptyString.h>
 #include <siodb/common/utils/PlainBinaryEncoding.h>
 
+// STL headers
+#include <ctime>
+#include <limits>
+#include <sstream>
+
 namespace siodb::iomgr::dbengine {
 
 namespace {
@@ -41,10 +53,403 @@ bool moveToNextRow(const std::vector<DataSetPtr>& tableDataSets)
     return tableDataSets.front()->hasCurrentRow();
 }
 
+/**
+ * Computes aggregate function values using table metadata only, without reading rows.
+ * This is possible for the single table SELECT without WHERE, GROUP BY, HAVING and ORDER BY,
+ * when result expressions are only COUNT(*), COUNT(column), MIN(TRID) and MAX(TRID).
+ * Metadata includes uncommitted and recently deleted rows, so it is used only when
+ * snapshot sees current state of the table.
+ * @param request SELECT request.
+ * @param aggregateFunctions Aggregate functions of the request.
+ * @param table Table object.
+ * @param snapshot Snapshot of the request.
+ * @param ownTransactionId ID of the explicit transaction which reads the snapshot, or zero.
+ * @return Aggregate function values or std::nullopt if they can't be obtained from metadata.
+ */
+std::optional<std::vector<Variant>> getAggregateValuesFromMetadata(
+        const requests::SelectRequest& request,
+        const std::vector<const requests::AggregateFunction*>& aggregateFunctions, Table& table,
+        const TransactionSnapshot& snapshot, std::uint64_t ownTransactionId)
+{
+    // Metadata describes only current state of the table
+    if (request.m_tables.size() != 1 || request.m_where || !request.m_groupBy.empty()
+            || request.m_having || !request.m_orderBy.empty()
+            || request.m_asOfType != requests::AsOfType::kNone)
+        return std::nullopt;
+
+    for (const auto& resultExpr : request.m_resultExpressions) {
+        if (!resultExpr.m_expression->isAggregateFunction()) return std::nullopt;
+    }
+
+    const auto masterColumn = table.getMasterColumn();
+    const auto mainIndex = masterColumn->getMasterColumnMainIndex();
+
+    std::vector<Variant> values;
+    values.reserve(aggregateFunctions.size());
+    for (const auto aggregateFunction : aggregateFunctions) {
+        // Only plain column arguments can be handled
+        const auto argument = aggregateFunction->getArgument();
+        const requests::SingleColumnExpression* columnExpression = nullptr;
+        if (argument) {
+            if (argument->getType() != requests::ExpressionType::kSingleColumnReference)
+                return std::nullopt;
+            columnExpression = static_cast<const requests::SingleColumnExpression*>(argument);
+        }
+        const bool isMasterColumnArgument =
+                columnExpression && columnExpression->getColumnName() == masterColumn->getName();
+
+        switch (aggregateFunction->getType()) {
+            case requests::ExpressionType::kCountFunction: {
+                // Master column value is never NULL
+                std::optional<std::uint64_t> count;
+                if (!columnExpression || isMasterColumnArgument)
+                    count = mainIndex->getKeyCount();
+                else {
+                    count = table.getColumnChecked(columnExpression->getColumnName())
+                                    ->getNonNullValueCount();
+                }
+                if (!count) return std::nullopt;
+                values.emplace_back(*count);
+                break;
+            }
+            case requests::ExpressionType::kMinFunction:
+            case requests::ExpressionType::kMaxFunction: {
+                if (!isMasterColumnArgument) return std::nullopt;
+                std::uint8_t key[8];
+                const bool keyFound =
+                        aggregateFunction->getType() == requests::ExpressionType::kMinFunction
+                                ? mainIndex->getMinKey(key)
+                                : mainIndex->getMaxKey(key);
+                if (keyFound) {
+                    std::uint64_t trid = 0;
+                    ::pbeDecodeUInt64(key, &trid);
+                    values.emplace_back(trid);
+                } else
+                    values.emplace_back();
+                break;
+            }
+            default: return std::nullopt;
+        }
+    }
+
+    // Checked after reading, so that concurrent writer which has started meanwhile is noticed
+    if (table.getDeletedRowIdRange()
+            || !table.getDatabase().isSnapshotCurrent(snapshot, ownTransactionId))
+        return std::nullopt;
+    return values;
+}
+
+/**
+ * Returns row IDs listed in the single table WHERE clause of the form "TRID IN (<constants>)".
+ * Such rows are read via the master column index instead of the table scan.
+ * @param request SELECT request.
+ * @param table Table object.
+ * @return Sorted row IDs or std::nullopt if WHERE clause is not of this form.
+ */
+std::optional<std::vector<std::uint64_t>> getRowIdsFromWhere(
+        const requests::SelectRequest& request, const Table& table)
+{
+    if (request.m_tables.size() != 1 || !request.m_where
+            || request.m_where->getType() != requests::ExpressionType::kInPredicate)
+        return std::nullopt;
+
+    const auto& inOperator = static_cast<const requests::InOperator&>(*request.m_where);
+    const auto& value = inOperator.getValue();
+    if (inOperator.isNotIn()
+            || value.getType() != requests::ExpressionType::kSingleColumnReference
+            || static_cast<const requests::SingleColumnExpression&>(value).getColumnName()
+                       != table.getMasterColumn()->getName())
+        return std::nullopt;
+
+    // Other values are compared one by one, so let the table scan handle them
+    const auto& valueSet = inOperator.getConstantValueSet();
+    if (!valueSet || !valueSet->isNumeric() || valueSet->hasNonIntegerValues())
+        return std::nullopt;
+
+    std::vector<std::uint64_t> rowIds;
+    for (const auto rowId : valueSet->getIntegerValues()) {
+        if (rowId > 0) rowIds.push_back(rowId);
+    }
+    return rowIds;
+}
+
+/**
+ * Estimated cost of the single row lookup via the master column index relative to reading
+ * of one row by the table scan. Lookup is chosen only when it reads less than 1/4 of the table.
+ */
+constexpr std::size_t kTridLookupCostFactor = 4;
+
+/**
+ * Maximum number of rows, which pass WHERE clause in the sequential scan, before their
+ * remaining result columns are read.
+ */
+constexpr std::size_t kLateMaterializationBatchSize = 1024;
+
+/** SELECT access path */
+enum class AccessPath {
+    /** Sequential scan of all tables */
+    kFullScan,
+
+    /** Sequential scan of the single table, which starts after OFFSET rows skipped via index */
+    kOffsetSkipScan,
+
+    /** Parallel scan of the single table */
+    kParallelScan,
+
+    /** Lookup of the rows listed in the WHERE clause via the master column index */
+    kTridLookup,
+
+    /** Aggregate function values are taken from the table metadata */
+    kMetadata,
+};
+
+/** Execution statistics of the SELECT plan operators, not set if operator is not used */
+struct SelectPlanStatistics {
+    /** Result rows */
+    ExecutionStatistics* m_select = nullptr;
+
+    /** LIMIT and OFFSET */
+    ExecutionStatistics* m_limit = nullptr;
+
+    /** Reading of the sorted rows */
+    ExecutionStatistics* m_rowLookup = nullptr;
+
+    /** Reading of the result columns of the filtered rows */
+    ExecutionStatistics* m_rowFetch = nullptr;
+
+    /** ORDER BY */
+    ExecutionStatistics* m_sort = nullptr;
+
+    /** HAVING */
+    ExecutionStatistics* m_having = nullptr;
+
+    /** GROUP BY and aggregate functions */
+    ExecutionStatistics* m_aggregate = nullptr;
+
+    /** WHERE */
+    ExecutionStatistics* m_where = nullptr;
+
+    /** Table scan or lookup */
+    ExecutionStatistics* m_scan = nullptr;
+};
+
+/**
+ * Adds SELECT plan operators to the query profile.
+ * @param profile Query profile.
+ * @param request SELECT request.
+ * @param dataSets Table data sets.
+ * @param accessPath Access path.
+ * @param isAggregation Indication that request has GROUP BY or aggregate functions.
+ * @param aggregateFunctionCount Number of the aggregate functions.
+ * @param rowIdCount Number of the rows listed in the WHERE clause.
+ * @param workerCount Number of the worker threads.
+ * @param limit LIMIT value.
+ * @param offset OFFSET value.
+ * @param maxRowCount Number of the rows kept by ORDER BY.
+ * @param lateMaterialization Indication that result columns are read after filtering.
+ * @param tableStatistics Statistics of the single table, nullptr if not available.
+ * @return Operator statistics, set only if statistics are collected.
+ */
+SelectPlanStatistics buildSelectPlan(QueryProfile& profile, const requests::SelectRequest& request,
+        const std::vector<DataSetPtr>& dataSets, AccessPath accessPath, bool isAggregation,
+        std::size_t aggregateFunctionCount, std::size_t rowIdCount, std::size_t workerCount,
+        std::optional<std::uint64_t> limit, std::optional<std::uint64_t> offset,
+        std::optional<std::uint64_t> maxRowCount, bool lateMaterialization,
+        const TableStatistics* tableStatistics)
+{
+    SelectPlanStatistics statistics;
+    std::vector<std::pair<std::size_t, ExecutionStatistics**>> operators;
+    const auto addOperator = [&profile, &operators](std::size_t parentId, const char* name,
+                                     std::string&& details, ExecutionStatistics** statistics,
+                                     bool hasCpuTime = false) {
+        const auto operatorId =
+                profile.addOperator(parentId, name, std::move(details), hasCpuTime);
+        operators.emplace_back(operatorId, statistics);
+        return operatorId;
+    };
+
+    auto parentId = addOperator(QueryProfile::kNoParent, "SELECT",
+            std::to_string(request.m_resultExpressions.size()) + " result expression(s)",
+            &statistics.m_select, true);
+
+    if (limit) {
+        std::ostringstream details;
+        details << "LIMIT " << *limit;
+        if (offset) details << " OFFSET " << *offset;
+        parentId = addOperator(parentId, "LIMIT", details.str(), &statistics.m_limit);
+    }
+
+    const auto getSortDetails = [&request, &maxRowCount]() {
+        std::ostringstream details;
+        details << request.m_orderBy.size() << " key(s)";
+        if (maxRowCount) details << ", top " << *maxRowCount << " row(s)";
+        return details.str();
+    };
+
+    if (isAggregation) {
+        if (!request.m_orderBy.empty())
+            parentId = addOperator(parentId, "SORT", getSortDetails(), &statistics.m_sort);
+        if (request.m_having)
+            parentId = addOperator(parentId, "FILTER", "HAVING", &statistics.m_having);
+        std::ostringstream details;
+        details << request.m_groupBy.size() << " group key(s), " << aggregateFunctionCount
+                << " aggregate function(s)";
+        if (accessPath == AccessPath::kMetadata) {
+            details << ", table " << dataSets.front()->getName();
+            addOperator(parentId, "METADATA AGGREGATE", details.str(), &statistics.m_aggregate);
+            parentId = QueryProfile::kNoParent;
+        } else {
+            parentId = addOperator(
+                    parentId, "HASH AGGREGATE", details.str(), &statistics.m_aggregate);
+        }
+    } else if (!request.m_orderBy.empty()) {
+        parentId = addOperator(parentId, "ROW LOOKUP", "by TRID after sorting",
+                &statistics.m_rowLookup);
+        parentId = addOperator(parentId, "SORT", getSortDetails(), &statistics.m_sort);
+    }
+
+    // Row count estimates are shown when table was analyzed
+    const auto getEstimate = [tableStatistics](std::uint64_t rowCount) {
+        return tableStatistics ? ", estimated " + std::to_string(rowCount) + " row(s)"
+                               : std::string();
+    };
+    const auto tableRowCount = tableStatistics ? tableStatistics->m_rowCount : 0;
+    const auto filteredRowCount =
+            tableStatistics ? tableStatistics->estimateRowCount(request.m_where.get()) : 0;
+
+    if (parentId != QueryProfile::kNoParent) {
+        if (lateMaterialization) {
+            parentId = addOperator(parentId, "ROW FETCH",
+                    "late materialization, batches of up to "
+                            + std::to_string(kLateMaterializationBatchSize) + " row(s)",
+                    &statistics.m_rowFetch);
+        }
+        if (request.m_where) {
+            parentId = addOperator(parentId, "FILTER", "WHERE" + getEstimate(filteredRowCount),
+                    &statistics.m_where);
+        }
+        switch (accessPath) {
+            case AccessPath::kParallelScan: {
+                addOperator(parentId, "PARALLEL SCAN",
+                        dataSets.front()->getName() + ", " + std::to_string(workerCount)
+                                + " worker thread(s)" + getEstimate(tableRowCount),
+                        &statistics.m_scan, true);
+                break;
+            }
+            case AccessPath::kTridLookup: {
+                addOperator(parentId, "INDEX LOOKUP",
+                        dataSets.front()->getName() + ", master column index, "
+                                + std::to_string(rowIdCount) + " TRID(s)"
+                                + getEstimate(std::min<std::uint64_t>(rowIdCount, tableRowCount)),
+                        &statistics.m_scan);
+                break;
+            }
+            default: {
+                std::string tables;
+                for (const auto& dataSet : dataSets) {
+                    if (!tables.empty()) tables += ", ";
+                    tables += dataSet->getName();
+                }
+                if (accessPath == AccessPath::kOffsetSkipScan) {
+                    tables += ", " + std::to_string(offset.value_or(0))
+                              + " row(s) skipped via master column index";
+                }
+                addOperator(parentId, dataSets.size() == 1 ? "FULL SCAN" : "NESTED LOOP SCAN",
+                        tables + getEstimate(tableRowCount), &statistics.m_scan);
+                break;
+            }
+        }
+    }
+
+    for (const auto& [operatorId, operatorStatistics] : operators)
+        *operatorStatistics = profile.getStatistics(operatorId);
+    return statistics;
+}
+
+/** Output which discards written data. Used when query is executed only to be profiled. */
+class DiscardingIo final : public siodb::io::IoBase {
+public:
+    std::size_t read([[maybe_unused]] void* buffer, [[maybe_unused]] std::size_t size) override
+    {
+        return 0;
+    }
+
+    std::size_t write([[maybe_unused]] const void* buffer, std::size_t size) override
+    {
+        return size;
+    }
+
+    off_t skip([[maybe_unused]] std::size_t size) override
+    {
+        return -1;
+    }
+
+    int close() override
+    {
+        return 0;
+    }
+
+    bool isValid() const override
+    {
+        return true;
+    }
+};
+
+/**
+ * Creates snapshot of the past database state requested by the AS OF clause.
+ * Timestamp is either date/time in the local time zone, like CURRENT_TIMESTAMP,
+ * or number of seconds since epoch.
+ * @param database Database object.
+ * @param request SELECT request with AS OF clause.
+ * @return Historical transaction snapshot.
+ * @throw DatabaseError if AS OF value is invalid.
+ */
+TransactionSnapshotPtr createAsOfSnapshot(
+        const Database& database, const requests::SelectRequest& request)
+{
+    requests::EmptyContext emptyContext;
+    request.m_asOf->validate(emptyContext);
+    const auto value = request.m_asOf->evaluate(emptyContext);
+
+    if (request.m_asOfType == requests::AsOfType::kTransaction) {
+        if (!value.isInteger() || value.isNegative() || value.asUInt64() == 0)
+            throwDatabaseError(IOManagerMessageId::kErrorInvalidAsOfTransactionId);
+        return database.createHistoricalSnapshot(
+                value.asUInt64(), std::numeric_limits<std::uint64_t>::max());
+    }
+
+    if (value.isInteger()) {
+        if (value.isNegative()) throwDatabaseError(IOManagerMessageId::kErrorInvalidAsOfTimestamp);
+        return database.createHistoricalSnapshot(
+                std::numeric_limits<std::uint64_t>::max(), value.asUInt64());
+    }
+
+    RawDateTime dateTime;
+    try {
+        dateTime = value.asDateTime();
+    } catch (std::exception&) {
+        throwDatabaseError(IOManagerMessageId::kErrorInvalidAsOfTimestamp);
+    }
+    std::tm tm {};
+    tm.tm_year = static_cast<int>(dateTime.m_datePart.m_year) - 1900;
+    tm.tm_mon = dateTime.m_datePart.m_month;
+    tm.tm_mday = dateTime.m_datePart.m_dayOfMonth + 1;
+    if (dateTime.m_datePart.m_hasTimePart) {
+        tm.tm_hour = dateTime.m_timePart.m_hours;
+        tm.tm_min = dateTime.m_timePart.m_minutes;
+        tm.tm_sec = dateTime.m_timePart.m_seconds;
+    }
+    tm.tm_isdst = -1;
+    const auto timestamp = std::mktime(&tm);
+    if (timestamp < 0) throwDatabaseError(IOManagerMessageId::kErrorInvalidAsOfTimestamp);
+    return database.createHistoricalSnapshot(
+            std::numeric_limits<std::uint64_t>::max(), timestamp);
+}
+
 }  // namespace
 
-void RequestHandler::executeSelectRequest(
-        iomgr_protocol::DatabaseEngineResponse& response, const requests::SelectRequest& request)
+void RequestHandler::executeSelectRequest(iomgr_protocol::DatabaseEngineResponse& response,
+        const requests::SelectRequest& request, QueryProfile* profile)
 {
     response.set_has_affected_row_count(false);
 
@@ -75,12 +480,21 @@ void RequestHandler::executeSelectRequest(
     if (!errors.empty()) throw CompoundDatabaseError(std::move(errors));
 
     std::unique_ptr<requests::DatabaseContext> dbContext;
+    TransactionSnapshotPtr snapshot;
     {
+        // Statement reads rows as of its start and doesn't wait for concurrent writers.
+        // Changes of the own explicit transaction are visible, except for AS OF reads,
+        // which see only committed past state.
+        snapshot = request.m_asOfType != requests::AsOfType::kNone
+                           ? createAsOfSnapshot(*db, request)
+                           : createSnapshot(*db);
         std::vector<DataSetPtr> tableDataSets;
         tableDataSets.reserve(request.m_tables.size());
         for (const auto& table : request.m_tables) {
-            tableDataSets.push_back(std::make_shared<TableDataSet>(
-                    db->getTableChecked(table.m_name), table.m_alias));
+            auto tableDataSet = std::make_shared<TableDataSet>(
+                    db->getTableChecked(table.m_name), table.m_alias);
+            tableDataSet->setSnapshot(snapshot);
+            tableDataSets.push_back(std::move(tableDataSet));
         }
         dbContext = std::make_unique<requests::DatabaseContext>(std::move(tableDataSets));
     }
@@ -234,8 +648,49 @@ void RequestHandler::executeSelectRequest(
 
     // Add remaining columns used in the WHERE clause
     if (request.m_where != nullptr) updateColumnsFromExpression(dataSets, request.m_where, errors);
+
+    // Add remaining columns used in the GROUP BY and HAVING clauses
+    for (const auto& groupByExpression : request.m_groupBy)
+        updateColumnsFromExpression(dataSets, groupByExpression, errors);
+    if (request.m_having != nullptr)
+        updateColumnsFromExpression(dataSets, request.m_having, errors);
+
+    // Add remaining columns used in the ORDER BY clause
+    for (const auto& orderByExpression : request.m_orderBy)
+        updateColumnsFromExpression(dataSets, orderByExpression.m_subject, errors);
+
+    // Collect aggregate functions
+    std::vector<const requests::AggregateFunction*> aggregateFunctions;
+    for (const auto& resultExpr : request.m_resultExpressions)
+        collectAggregateFunctions(*resultExpr.m_expression, aggregateFunctions, errors);
+    if (request.m_having != nullptr)
+        collectAggregateFunctions(*request.m_having, aggregateFunctions, errors);
+    for (const auto& orderByExpression : request.m_orderBy)
+        collectAggregateFunctions(*orderByExpression.m_subject, aggregateFunctions, errors);
+
+    // Aggregate functions can't be used in the WHERE and GROUP BY clauses
+    {
+        std::vector<const requests::AggregateFunction*> misplacedAggregateFunctions;
+        if (request.m_where != nullptr)
+            collectAggregateFunctions(*request.m_where, misplacedAggregateFunctions, errors);
+        if (!misplacedAggregateFunctions.empty()) {
+            errors.push_back(makeDatabaseError(
+                    IOManagerMessageId::kErrorAggregateFunctionNotAllowed, "WHERE"));
+        }
+        misplacedAggregateFunctions.clear();
+        for (const auto& groupByExpression : request.m_groupBy)
+            collectAggregateFunctions(*groupByExpression, misplacedAggregateFunctions, errors);
+        if (!misplacedAggregateFunctions.empty()) {
+            errors.push_back(makeDatabaseError(
+                    IOManagerMessageId::kErrorAggregateFunctionNotAllowed, "GROUP BY"));
+        }
+    }
     if (!errors.empty()) throw CompoundDatabaseError(std::move(errors));
 
+    const bool isAggregation =
+            !request.m_groupBy.empty() || !aggregateFunctions.empty()
+            || request.m_having != nullptr;
+
     utils::Bitmask nullMask;
     if (!notNull) nullMask.resize(columnCountToSend, false);
 
@@ -243,6 +698,12 @@ void RequestHandler::executeSelectRequest(
         tableDataSet->resetCursor();
 
     checkWhereExpression(request.m_where, *dbContext);
+    if (isAggregation) {
+        checkGroupByExpressions(request.m_groupBy, *dbContext);
+        checkAggregateFunctions(aggregateFunctions, *dbContext);
+        checkHavingExpression(request.m_having, *dbContext);
+    }
+    checkOrderByExpressions(request.m_orderBy, *dbContext);
 
     std::optional<std::uint64_t> limit;
     std::optional<std::uint64_t> offset;
@@ -273,49 +734,155 @@ void RequestHandler::executeSelectRequest(
         }
     }
 
+    bool rowDataAvailable = true;
+    for (auto& tableDataSet : dataSets) {
+        rowDataAvailable &= tableDataSet->hasCurrentRow();
+        if (!rowDataAvailable) break;
+    }
+
+    // With ORDER BY and LIMIT only first LIMIT + OFFSET rows are kept
+    std::optional<std::uint64_t> maxRowCount;
+    if (limit) {
+        const auto skipCount = offset.value_or(0);
+        if (*limit == 0)
+            maxRowCount = 0;
+        else if (*limit > std::numeric_limits<std::uint64_t>::max() - skipCount)
+            maxRowCount = std::numeric_limits<std::uint64_t>::max();
+        else
+            maxRowCount = *limit + skipCount;
+    }
+
+    // Choose access path
+    const auto firstTable = db->getTableChecked(dataSets.front()->getDataSourceId());
+
+    // Some aggregate functions can be computed without scanning rows
+    const auto metadataAggregateValues =
+            isAggregation ? getAggregateValuesFromMetadata(request, aggregateFunctions,
+                                    *firstTable, *snapshot,
+                                    getOwnTransactionId(*db))
+                          : std::nullopt;
+    if (metadataAggregateValues) rowDataAvailable = false;
+
+    // Statistics collected by ANALYZE, used for the single table queries
+    const auto tableStatistics =
+            dataSets.size() == 1 ? db->getTableStatistics(firstTable->getId()) : nullptr;
+
+    // Rows listed in the WHERE clause can be read without the table scan
+    auto rowIdsFromWhere = (isAggregation || !request.m_orderBy.empty())
+                                   ? std::nullopt
+                                   : getRowIdsFromWhere(request, *firstTable);
+
+    // Scan is cheaper than lookup when large part of the table is requested
+    if (rowIdsFromWhere && tableStatistics && tableStatistics->m_rowCount > 0
+            && rowIdsFromWhere->size() * kTridLookupCostFactor >= tableStatistics->m_rowCount)
+        rowIdsFromWhere.reset();
+
+    // Without WHERE clause, OFFSET rows are skipped using key counts of the master
+    // column index, so their master column records are not read
+    const bool skipOffsetByIndex = rowDataAvailable && !isAggregation
+                                   && request.m_orderBy.empty() && !request.m_where
+                                   && dataSets.size() == 1 && offset && *offset > 0
+                                   && *limit > 0;
+
+    const bool useParallelScan =
+            rowDataAvailable && !rowIdsFromWhere && !skipOffsetByIndex
+            && (isAggregation || (request.m_orderBy.empty() && (!limit || *limit > 0)))
+            && ParallelTableScan::isApplicable(m_workerThreadPool, dataSets);
+
+    // Sequential scan of the single table reads only columns used in the WHERE clause,
+    // remaining result columns are read in batches only for the rows which passed it
+    const bool useLateMaterialization = rowDataAvailable && !isAggregation
+                                        && request.m_orderBy.empty() && request.m_where
+                                        && dataSets.size() == 1 && !rowIdsFromWhere
+                                        && !useParallelScan;
+
+    AccessPath accessPath = AccessPath::kFullScan;
+    if (metadataAggregateValues)
+        accessPath = AccessPath::kMetadata;
+    else if (rowIdsFromWhere)
+        accessPath = AccessPath::kTridLookup;
+    else if (useParallelScan)
+        accessPath = AccessPath::kParallelScan;
+    else if (skipOffsetByIndex)
+        accessPath = AccessPath::kOffsetSkipScan;
+
+    SelectPlanStatistics plan;
+    if (profile) {
+        plan = buildSelectPlan(*profile, request, dataSets, accessPath, isAggregation,
+                aggregateFunctions.size(), rowIdsFromWhere ? rowIdsFromWhere->size() : 0,
+                m_workerThreadPool ? m_workerThreadPool->getSize() : 0, limit, offset,
+                maxRowCount, useLateMaterialization, tableStatistics.get());
+        if (!profile->isAnalyze()) return;
+        if (plan.m_scan && rowDataAvailable
+                && (accessPath == AccessPath::kFullScan
+                        || accessPath == AccessPath::kOffsetSkipScan))
+            plan.m_scan->m_rowCount = 1;
+    }
+
+    // When query is profiled, result rows are discarded
+    DiscardingIo discardingIo;
+    siodb::io::IoBase& output = profile ? static_cast<siodb::io::IoBase&>(discardingIo)
+                                        : m_connectionIo;
+
     utils::DefaultErrorCodeChecker errorChecker;
-    protobuf::CustomProtobufOutputStream rawOutput(m_connectionIo, errorChecker);
+    protobuf::CustomProtobufOutputStream rawOutput(output, errorChecker);
     protobuf::writeMessage(
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, rawOutput);
 
     google::protobuf::io::CodedOutputStream codedOutput(&rawOutput);
     try {
-        bool rowDataAvailable = true;
-        for (auto& tableDataSet : dataSets) {
-            rowDataAvailable &= tableDataSet->hasCurrentRow();
-            if (!rowDataAvailable) break;
-        }
         std::vector<Variant> values(columnCountToSend);
 
-        while (rowDataAvailable && (!limit.has_value() || *limit > 0)) {
-            std::size_t rowSize = 0;
-            if (request.m_where) {
-                try {
-                    if (isNullType(request.m_where->getResultValueType(*dbContext))) {
-                        rowDataAvailable = moveToNextRow(dataSets);
-                        continue;
-                    }
-
-                    const auto rowFits = request.m_where->evaluate(*dbContext);
-                    if (!rowFits.getBool()) {
-                        rowDataAvailable = moveToNextRow(dataSets);
-                        continue;
-                    }
-                } catch (const std::runtime_error& e) {
-                    // Catch exception from WHERE expression evaluation
-                    throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, e.what());
-                } catch (const VariantLogicError& error) {
-                    throwDatabaseError(
-                            IOManagerMessageId::kErrorInvalidWhereCondition, error.what());
-                }
-            }
-
-            if (offset && *offset > 0) {
-                --(*offset);
-                rowDataAvailable = moveToNextRow(dataSets);
-                continue;
+        // Checks that current row of the context satisfies WHERE condition.
+        // Can be called concurrently for the different contexts and statistics.
+        const auto doesCurrentRowFit = [&request](requests::DatabaseContext& context,
+                                               ExecutionStatistics* whereStatistics) {
+            if (!request.m_where) return true;
+            ExecutionTimer timer(whereStatistics);
+            EvaluationTimer evaluationTimer(whereStatistics);
+            try {
+                if (isNullType(request.m_where->getResultValueType(context))) return false;
+                const bool fits = request.m_where->evaluate(context).getBool();
+                if (fits && whereStatistics) ++whereStatistics->m_rowCount;
+                return fits;
+            } catch (const std::runtime_error& e) {
+                // Catch exception from WHERE expression evaluation
+                throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, e.what());
+            } catch (const VariantLogicError& error) {
+                throwDatabaseError(IOManagerMessageId::kErrorInvalidWhereCondition, error.what());
             }
-
+        };
+
+        // Moves to the next row of the sequential scan
+        const auto moveToNextScanRow = [&dataSets, &plan]() {
+            ExecutionTimer timer(plan.m_scan);
+            const bool rowAvailable = moveToNextRow(dataSets);
+            if (rowAvailable && plan.m_scan) ++plan.m_scan->m_rowCount;
+            return rowAvailable;
+        };
+
+        // Adds statistics of the parallel scan morsel to the plan statistics.
+        // Row handler statistics are the WHERE clause statistics.
+        const auto addMorselStatistics = [&plan](const ParallelTableScan::MorselResult& result) {
+            if (!plan.m_scan) return;
+            auto scanStatistics = result.m_scanStatistics;
+            const auto& whereStatistics = result.m_rowHandlerStatistics;
+            scanStatistics.m_wallTime -=
+                    std::min(scanStatistics.m_wallTime, whereStatistics.m_wallTime);
+            scanStatistics.m_ioStatistics =
+                    scanStatistics.m_ioStatistics - whereStatistics.m_ioStatistics;
+            *plan.m_scan += scanStatistics;
+            if (plan.m_where) *plan.m_where += whereStatistics;
+            // Calling thread CPU time is measured for the whole query
+            if (result.m_processedByWorker)
+                plan.m_select->m_cpuTime += result.m_scanStatistics.m_cpuTime;
+        };
+
+        // Sends row to the client. Row values are provided by the context and,
+        // for the all columns expressions, by the getTableRow(tableIndex) function.
+        const auto sendRow = [&](requests::Expression::Context& context,
+                                     const auto& getTableRow) {
+            std::size_t rowSize = 0;
             std::size_t valueIdx = 0;
             for (const auto& expr : request.m_resultExpressions) {
                 const auto exprType = expr.m_expression->getType();
@@ -324,7 +891,7 @@ void RequestHandler::executeSelectRequest(
                             dynamic_cast<const requests::AllColumnsExpression*>(
                                     expr.m_expression.get());
                     const auto tableIdx = *allColumnsExpression->getDatasetTableIndex();
-                    for (const auto& rowValue : dataSets[tableIdx]->getCurrentRow()) {
+                    for (const auto& rowValue : getTableRow(tableIdx)) {
                         values[valueIdx] = rowValue;
                         const auto valueSize = getVariantSize(values[valueIdx]);
                         rowSize += valueSize;
@@ -332,7 +899,10 @@ void RequestHandler::executeSelectRequest(
                         ++valueIdx;
                     }
                 } else {
-                    values[valueIdx] = expr.m_expression->evaluate(*dbContext);
+                    {
+                        EvaluationTimer evaluationTimer(plan.m_select);
+                        values[valueIdx] = expr.m_expression->evaluate(context);
+                    }
                     const auto valueSize = getVariantSize(values[valueIdx]);
                     rowSize += valueSize;
                     if (!notNull) nullMask.setBit(valueIdx, valueSize == 0);
@@ -355,14 +925,435 @@ void RequestHandler::executeSelectRequest(
                 protobuf::checkOutputStreamError(rawOutput);
             }
 
-            if (limit) --(*limit);
-            rowDataAvailable = moveToNextRow(dataSets);
+            if (plan.m_select) ++plan.m_select->m_rowCount;
+            if (plan.m_limit) ++plan.m_limit->m_rowCount;
+        };
+
+        // Sends current row of the data sets to the client
+        const auto sendCurrentRow = [&]() {
+            sendRow(*dbContext, [&dataSets](std::size_t tableIndex) -> const auto& {
+                return dataSets[tableIndex]->getCurrentRow();
+            });
+        };
+
+        // Returns sort directions of the ORDER BY expressions
+        const auto getSortDescending = [&request]() {
+            std::vector<bool> sortDescending;
+            sortDescending.reserve(request.m_orderBy.size());
+            for (const auto& orderByExpression : request.m_orderBy)
+                sortDescending.push_back(orderByExpression.m_sortDescending);
+            return sortDescending;
+        };
+
+        if (isAggregation) {
+            const auto groupByMemoryLimit = m_instance.getGroupByMemoryLimit();
+            HashAggregator aggregator(aggregateFunctions, groupByMemoryLimit);
+
+            // Accumulates aggregate function values of the current row of the context.
+            // Can be called concurrently for the different contexts, aggregators
+            // and statistics.
+            const auto aggregateCurrentRow = [&request, &aggregateFunctions, &doesCurrentRowFit](
+                                                     requests::DatabaseContext& context,
+                                                     HashAggregator& aggregator,
+                                                     ExecutionStatistics* whereStatistics,
+                                                     ExecutionStatistics* aggregateStatistics) {
+                if (!doesCurrentRowFit(context, whereStatistics)) return;
+
+                ExecutionTimer timer(aggregateStatistics);
+                std::vector<Variant> groupKeys;
+                try {
+                    EvaluationTimer evaluationTimer(aggregateStatistics);
+                    groupKeys.reserve(request.m_groupBy.size());
+                    for (const auto& groupByExpression : request.m_groupBy)
+                        groupKeys.push_back(groupByExpression->evaluate(context));
+                } catch (const std::runtime_error& e) {
+                    // Catch exception from GROUP BY expression evaluation
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidGroupByExpression, e.what());
+                } catch (const VariantLogicError& error) {
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidGroupByExpression, error.what());
+                }
+
+                const auto [groupIndex, isNewGroup] =
+                        aggregator.findOrAddGroup(std::move(groupKeys));
+                if (isNewGroup) {
+                    std::vector<std::vector<Variant>> rowValues;
+                    rowValues.reserve(context.getDataSets().size());
+                    for (const auto& dataSet : context.getDataSets())
+                        rowValues.push_back(dataSet->getCurrentRow());
+                    aggregator.setRowValues(groupIndex, std::move(rowValues));
+                }
+
+                try {
+                    for (std::size_t i = 0, n = aggregateFunctions.size(); i != n; ++i) {
+                        const auto argument = aggregateFunctions[i]->getArgument();
+                        Variant value;
+                        if (argument) {
+                            EvaluationTimer evaluationTimer(aggregateStatistics);
+                            value = argument->evaluate(context);
+                        }
+                        aggregator.accumulate(groupIndex, i, value);
+                    }
+                } catch (const std::runtime_error& e) {
+                    // Catch exception from aggregate function argument evaluation
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidAggregateFunction, e.what());
+                } catch (const VariantLogicError& error) {
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidAggregateFunction, error.what());
+                }
+            };
+
+            // Scan rows and accumulate aggregate function values per group.
+            // Large table is scanned by the worker threads, each morsel is pre-aggregated
+            // separately and partial results are merged in the TRID order.
+            // Pre-aggregation time is included in the parallel scan statistics.
+            if (useParallelScan) {
+                const bool collectStatistics = plan.m_scan != nullptr;
+                ParallelTableScan scan(
+                        *m_workerThreadPool, static_cast<const TableDataSet&>(*dataSets.front()),
+                        [&aggregateFunctions, &aggregateCurrentRow, groupByMemoryLimit,
+                                collectStatistics](requests::DatabaseContext& context,
+                                ParallelTableScan::MorselResult& result) {
+                            if (!result.m_aggregator) {
+                                result.m_aggregator = std::make_unique<HashAggregator>(
+                                        aggregateFunctions, groupByMemoryLimit);
+                            }
+                            aggregateCurrentRow(context, *result.m_aggregator,
+                                    collectStatistics ? &result.m_rowHandlerStatistics : nullptr,
+                                    nullptr);
+                        },
+                        collectStatistics);
+                ParallelTableScan::MorselResult morselResult;
+                while (scan.getNextMorselResult(morselResult)) {
+                    addMorselStatistics(morselResult);
+                    if (!morselResult.m_aggregator) continue;
+                    try {
+                        ExecutionTimer timer(plan.m_aggregate);
+                        aggregator.merge(std::move(*morselResult.m_aggregator));
+                    } catch (const VariantLogicError& error) {
+                        throwDatabaseError(
+                                IOManagerMessageId::kErrorInvalidAggregateFunction, error.what());
+                    }
+                }
+            } else {
+                while (rowDataAvailable) {
+                    aggregateCurrentRow(*dbContext, aggregator, plan.m_where, plan.m_aggregate);
+                    rowDataAvailable = moveToNextScanRow();
+                }
+            }
+
+            // Without GROUP BY there is always exactly one group, even if there are no rows
+            if (request.m_groupBy.empty() && aggregator.getGroupCount() == 0) {
+                const auto groupIndex = aggregator.findOrAddGroup({}).first;
+                std::vector<std::vector<Variant>> rowValues;
+                rowValues.reserve(dataSets.size());
+                for (const auto& dataSet : dataSets)
+                    rowValues.emplace_back(dataSet->getColumnCount());
+                aggregator.setRowValues(groupIndex, std::move(rowValues));
+            }
+            if (plan.m_aggregate) plan.m_aggregate->m_rowCount = aggregator.getGroupCount();
+
+            requests::GroupContext groupContext(*dbContext);
+
+            // Makes given group current in the group context
+            const auto setCurrentGroup = [&aggregator, &groupContext, &aggregateFunctions,
+                                                 &metadataAggregateValues](
+                                                 std::size_t groupIndex) {
+                std::vector<Variant> aggregateValues;
+                if (metadataAggregateValues)
+                    aggregateValues = *metadataAggregateValues;
+                else {
+                    aggregateValues.reserve(aggregateFunctions.size());
+                    for (std::size_t i = 0, n = aggregateFunctions.size(); i != n; ++i)
+                        aggregateValues.push_back(aggregator.getResult(groupIndex, i));
+                }
+                groupContext.setCurrentGroup(
+                        aggregator.getGroup(groupIndex).m_rowValues, std::move(aggregateValues));
+            };
+
+            // Checks that current group satisfies HAVING condition
+            const auto doesCurrentGroupFit = [&request, &groupContext, &plan]() {
+                if (!request.m_having) return true;
+                ExecutionTimer timer(plan.m_having);
+                EvaluationTimer evaluationTimer(plan.m_having);
+                try {
+                    if (isNullType(request.m_having->getResultValueType(groupContext)))
+                        return false;
+                    const bool fits = request.m_having->evaluate(groupContext).getBool();
+                    if (fits && plan.m_having) ++plan.m_having->m_rowCount;
+                    return fits;
+                } catch (const std::runtime_error& e) {
+                    // Catch exception from HAVING expression evaluation
+                    throwDatabaseError(IOManagerMessageId::kErrorInvalidHavingCondition, e.what());
+                } catch (const VariantLogicError& error) {
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidHavingCondition, error.what());
+                }
+            };
+
+            // Sends current group to the client
+            const auto sendCurrentGroup = [&]() {
+                sendRow(groupContext, [&groupContext](std::size_t tableIndex) -> const auto& {
+                    return groupContext.getTableRow(tableIndex);
+                });
+            };
+
+            const auto groupCount = aggregator.getGroupCount();
+            if (request.m_orderBy.empty()) {
+                for (std::size_t groupIndex = 0;
+                        groupIndex != groupCount && (!limit.has_value() || *limit > 0);
+                        ++groupIndex) {
+                    setCurrentGroup(groupIndex);
+                    if (!doesCurrentGroupFit()) continue;
+
+                    if (offset && *offset > 0) {
+                        --(*offset);
+                        continue;
+                    }
+
+                    sendCurrentGroup();
+                    if (limit) --(*limit);
+                }
+            } else {
+                TopNRowBuffer rowBuffer(getSortDescending(), maxRowCount);
+
+                std::vector<Variant> sortKeys;
+                for (std::size_t groupIndex = 0;
+                        groupIndex != groupCount && (!maxRowCount || *maxRowCount > 0);
+                        ++groupIndex) {
+                    setCurrentGroup(groupIndex);
+                    if (!doesCurrentGroupFit()) continue;
+                    ExecutionTimer timer(plan.m_sort);
+                    try {
+                        EvaluationTimer evaluationTimer(plan.m_sort);
+                        sortKeys.clear();
+                        sortKeys.reserve(request.m_orderBy.size());
+                        for (const auto& orderByExpression : request.m_orderBy)
+                            sortKeys.push_back(orderByExpression.m_subject->evaluate(groupContext));
+                    } catch (const std::runtime_error& e) {
+                        // Catch exception from ORDER BY expression evaluation
+                        throwDatabaseError(
+                                IOManagerMessageId::kErrorInvalidOrderByExpression, e.what());
+                    } catch (const VariantLogicError& error) {
+                        throwDatabaseError(
+                                IOManagerMessageId::kErrorInvalidOrderByExpression, error.what());
+                    }
+                    if (rowBuffer.canAccept(sortKeys))
+                        rowBuffer.addRow(std::move(sortKeys), {groupIndex});
+                }
+
+                std::vector<TopNRowBuffer::Row> sortedRows;
+                try {
+                    ExecutionTimer timer(plan.m_sort);
+                    sortedRows = rowBuffer.takeSortedRows();
+                } catch (const VariantLogicError& error) {
+                    throwDatabaseError(
+                            IOManagerMessageId::kErrorInvalidOrderByExpression, error.what());
+                }
+                if (plan.m_sort) plan.m_sort->m_rowCount = sortedRows.size();
+
+                const auto skipCount =
+                        std::min<std::uint64_t>(offset.value_or(0), sortedRows.size());
+                for (auto it = sortedRows.cbegin() + skipCount;
+                        it != sortedRows.cend() && (!limit.has_value() || *limit > 0); ++it) {
+                    setCurrentGroup(it->m_rowIds.front());
+                    sendCurrentGroup();
+                    if (limit) --(*limit);
+                }
+            }
+        } else if (rowIdsFromWhere) {
+            // Only listed rows are read via the master column index, in the TRID order
+            for (const auto rowId : *rowIdsFromWhere) {
+                if (limit && *limit == 0) break;
+                {
+                    ExecutionTimer timer(plan.m_scan);
+                    if (!dataSets.front()->moveToRow(rowId)) continue;
+                    if (plan.m_scan) ++plan.m_scan->m_rowCount;
+                }
+                if (!doesCurrentRowFit(*dbContext, plan.m_where)) continue;
+
+                if (offset && *offset > 0) {
+                    --(*offset);
+                    continue;
+                }
+
+                sendCurrentRow();
+                if (limit) --(*limit);
+            }
+        } else if (useParallelScan) {
+            // Large table is filtered by the worker threads,
+            // rows are sent in the TRID order.
+            const bool collectStatistics = plan.m_scan != nullptr;
+            ParallelTableScan scan(
+                    *m_workerThreadPool, static_cast<const TableDataSet&>(*dataSets.front()),
+                    [&doesCurrentRowFit, collectStatistics](requests::DatabaseContext& context,
+                            ParallelTableScan::MorselResult& result) {
+                        if (doesCurrentRowFit(context,
+                                    collectStatistics ? &result.m_rowHandlerStatistics : nullptr))
+                            result.m_rows.push_back(context.getDataSets().front()->getCurrentRow());
+                    },
+                    collectStatistics, maxRowCount);
+
+            // Filtered rows are provided to the result expressions via the group context
+            requests::GroupContext rowContext(*dbContext);
+            std::vector<std::vector<Variant>> rowValues(1);
+            ParallelTableScan::MorselResult morselResult;
+            while ((!limit.has_value() || *limit > 0) && scan.getNextMorselResult(morselResult)) {
+                addMorselStatistics(morselResult);
+                for (auto& row : morselResult.m_rows) {
+                    if (limit && *limit == 0) break;
+
+                    if (offset && *offset > 0) {
+                        --(*offset);
+                        continue;
+                    }
+
+                    rowValues.front() = std::move(row);
+                    rowContext.setCurrentGroup(rowValues, {});
+                    sendRow(rowContext, [&rowContext](std::size_t tableIndex) -> const auto& {
+                        return rowContext.getTableRow(tableIndex);
+                    });
+                    if (limit) --(*limit);
+                }
+            }
+        } else if (useLateMaterialization) {
+            auto& tableDataSet = static_cast<TableDataSet&>(*dataSets.front());
+            std::vector<TableDataSet::SavedRow> rows;
+            rows.reserve(kLateMaterializationBatchSize);
+            while (rowDataAvailable && (!limit.has_value() || *limit > 0)) {
+                // Collect rows which pass WHERE clause, reading only columns used in it
+                const auto batchSize = limit ? std::min<std::uint64_t>(
+                                               *limit, kLateMaterializationBatchSize)
+                                             : kLateMaterializationBatchSize;
+                rows.clear();
+                while (rowDataAvailable && rows.size() < batchSize) {
+                    if (doesCurrentRowFit(*dbContext, plan.m_where)) {
+                        if (offset && *offset > 0)
+                            --(*offset);
+                        else
+                            rows.push_back(tableDataSet.saveCurrentRow());
+                    }
+                    rowDataAvailable = moveToNextScanRow();
+                }
+
+                {
+                    ExecutionTimer timer(plan.m_rowFetch);
+                    tableDataSet.readSavedRowValues(rows);
+                }
+                if (plan.m_rowFetch) plan.m_rowFetch->m_rowCount += rows.size();
+
+                // Cursor has already moved past these rows, so it is restored
+                // after the batch is sent
+                auto cursorRow = rowDataAvailable
+                                         ? std::optional(tableDataSet.saveCurrentRow())
+                                         : std::nullopt;
+                for (auto& row : rows) {
+                    tableDataSet.restoreRow(row);
+                    sendCurrentRow();
+                    if (limit) --(*limit);
+                }
+                if (cursorRow) tableDataSet.restoreRow(*cursorRow);
+            }
+        } else if (request.m_orderBy.empty()) {
+            if (skipOffsetByIndex) {
+                ExecutionTimer timer(plan.m_scan);
+                rowDataAvailable =
+                        static_cast<TableDataSet&>(*dataSets.front()).skipRows(*offset);
+                if (!rowDataAvailable && plan.m_scan) plan.m_scan->m_rowCount = 0;
+                offset.reset();
+            }
+
+            while (rowDataAvailable && (!limit.has_value() || *limit > 0)) {
+                if (!doesCurrentRowFit(*dbContext, plan.m_where)) {
+                    rowDataAvailable = moveToNextScanRow();
+                    continue;
+                }
+
+                if (offset && *offset > 0) {
+                    --(*offset);
+                    rowDataAvailable = moveToNextScanRow();
+                    continue;
+                }
+
+                sendCurrentRow();
+                if (limit) --(*limit);
+                rowDataAvailable = moveToNextScanRow();
+            }
+        } else {
+            // Only sort keys and row IDs are collected during scan,
+            // result columns are read after sorting.
+            TopNRowBuffer rowBuffer(getSortDescending(), maxRowCount);
+
+            std::vector<Variant> sortKeys;
+            while (rowDataAvailable && (!maxRowCount || *maxRowCount > 0)) {
+                if (doesCurrentRowFit(*dbContext, plan.m_where)) {
+                    ExecutionTimer timer(plan.m_sort);
+                    try {
+                        sortKeys.clear();
+                        sortKeys.reserve(request.m_orderBy.size());
+                        {
+                            EvaluationTimer evaluationTimer(plan.m_sort);
+                            for (const auto& orderByExpression : request.m_orderBy) {
+                                sortKeys.push_back(
+                                        orderByExpression.m_subject->evaluate(*dbContext));
+                            }
+                        }
+
+                        if (rowBuffer.canAccept(sortKeys)) {
+                            std::vector<std::uint64_t> rowIds;
+                            rowIds.reserve(dataSets.size());
+                            for (const auto& dataSet : dataSets)
+                                rowIds.push_back(dataSet->getCurrentRowId());
+                            rowBuffer.addRow(std::move(sortKeys), std::move(rowIds));
+                        }
+                    } catch (const std::runtime_error& e) {
+                        // Catch exception from ORDER BY expression evaluation
+                        throwDatabaseError(
+                                IOManagerMessageId::kErrorInvalidOrderByExpression, e.what());
+                    } catch (const VariantLogicError& error) {
+                        throwDatabaseError(
+                                IOManagerMessageId::kErrorInvalidOrderByExpression, error.what());
+                    }
+                }
+                rowDataAvailable = moveToNextScanRow();
+            }
+
+            std::vector<TopNRowBuffer::Row> sortedRows;
+            try {
+                ExecutionTimer timer(plan.m_sort);
+                sortedRows = rowBuffer.takeSortedRows();
+            } catch (const VariantLogicError& error) {
+                throwDatabaseError(
+                        IOManagerMessageId::kErrorInvalidOrderByExpression, error.what());
+            }
+            if (plan.m_sort) plan.m_sort->m_rowCount = sortedRows.size();
+
+            const auto skipCount = std::min<std::uint64_t>(offset.value_or(0), sortedRows.size());
+            for (auto it = sortedRows.cbegin() + skipCount;
+                    it != sortedRows.cend() && (!limit.has_value() || *limit > 0); ++it) {
+                bool rowFound = true;
+                {
+                    ExecutionTimer timer(plan.m_rowLookup);
+                    for (std::size_t i = 0, n = dataSets.size(); i != n && rowFound; ++i)
+                        rowFound = dataSets[i]->moveToRow(it->m_rowIds[i]);
+                }
+                // Normally should never happen
+                if (!rowFound) continue;
+                if (plan.m_rowLookup) ++plan.m_rowLookup->m_rowCount;
+                sendCurrentRow();
+                if (limit) --(*limit);
+            }
         }
     } catch (DatabaseError& dberror) {
         LOG_ERROR << kLogContext << dberror.what();
         // DatabaseError exception is only possible before data serialization and writing,
         // Data shouldn't be sent to the server at this moment.
         // all other exceptions are caught on upper level.
+        // Nothing is sent to the server while query is profiled, so error can be reported
+        if (profile) throw;
+
         codedOutput.WriteVarint64(kNoMoreRows);
         protobuf::checkOutputStreamError(rawOutput);
 
@@ -374,6 +1365,107 @@ void RequestHandler::executeSelectRequest(
     protobuf::checkOutputStreamError(rawOutput);
 }
 
+void RequestHandler::executeExplainRequest(
+        iomgr_protocol::DatabaseEngineResponse& response, const requests::ExplainRequest& request)
+{
+    response.set_has_affected_row_count(false);
+    response.set_affected_row_count(0);
+
+    QueryProfile profile(request.m_analyze);
+    {
+        // Response of the explained request is discarded
+        iomgr_protocol::DatabaseEngineResponse selectResponse;
+        ExecutionStatistics queryStatistics;
+        {
+            ExecutionTimer timer(request.m_analyze ? &queryStatistics : nullptr, true);
+            executeSelectRequest(selectResponse,
+                    dynamic_cast<const requests::SelectRequest&>(*request.m_request), &profile);
+        }
+        if (request.m_analyze) profile.setQueryTotals(queryStatistics);
+    }
+
+    // Column name, type and indication that column is nullable
+    std::vector<std::tuple<const char*, ColumnDataType, bool>> columns {
+            {"ID", COLUMN_DATA_TYPE_UINT32, false},
+            {"PARENT_ID", COLUMN_DATA_TYPE_UINT32, true},
+            {"OPERATOR", COLUMN_DATA_TYPE_TEXT, false},
+            {"DETAILS", COLUMN_DATA_TYPE_TEXT, false},
+    };
+    if (request.m_analyze) {
+        const std::tuple<const char*, ColumnDataType, bool> statisticsColumns[] = {
+                {"ROWS", COLUMN_DATA_TYPE_UINT64, false},
+                {"WALL_TIME_US", COLUMN_DATA_TYPE_UINT64, false},
+                {"CPU_TIME_US", COLUMN_DATA_TYPE_UINT64, true},
+                {"EVAL_TIME_US", COLUMN_DATA_TYPE_UINT64, false},
+                {"READS", COLUMN_DATA_TYPE_UINT64, false},
+                {"BYTES_READ", COLUMN_DATA_TYPE_UINT64, false},
+                {"CACHE_HITS", COLUMN_DATA_TYPE_UINT64, false},
+                {"CACHE_MISSES", COLUMN_DATA_TYPE_UINT64, false},
+        };
+        columns.insert(columns.end(), std::cbegin(statisticsColumns),
+                std::cend(statisticsColumns));
+    }
+    for (const auto& [name, type, isNull] : columns) {
+        const auto columnDescription = response.add_column_description();
+        columnDescription->set_name(name);
+        columnDescription->set_type(type);
+        columnDescription->set_is_null(isNull);
+    }
+
+    utils::DefaultErrorCodeChecker errorChecker;
+    protobuf::CustomProtobufOutputStream rawOutput(m_connectionIo, errorChecker);
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, rawOutput);
+
+    google::protobuf::io::CodedOutputStream codedOutput(&rawOutput);
+    std::vector<Variant> values(columns.size());
+    utils::Bitmask nullMask(columns.size(), false);
+    const auto& operators = profile.getOperators();
+    const auto depths = profile.getOperatorDepths();
+    constexpr std::uint64_t kNanosecondsPerMicrosecond = 1000;
+    for (std::size_t i = 0; i < operators.size(); ++i) {
+        const auto& op = operators[i];
+        values[0] = static_cast<std::uint32_t>(i);
+        if (op.m_parentId == QueryProfile::kNoParent)
+            values[1].clear();
+        else
+            values[1] = static_cast<std::uint32_t>(op.m_parentId);
+        // Operator name is indented according to the tree depth
+        values[2] = std::string(depths[i] * 2, ' ') + op.m_name;
+        values[3] = op.m_details;
+        if (request.m_analyze) {
+            values[4] = op.m_rowCount;
+            values[5] = op.m_wallTime / kNanosecondsPerMicrosecond;
+            if (op.m_hasCpuTime)
+                values[6] = op.m_cpuTime / kNanosecondsPerMicrosecond;
+            else
+                values[6].clear();
+            values[7] = op.m_evaluationTime / kNanosecondsPerMicrosecond;
+            values[8] = op.m_ioStatistics.m_readCount;
+            values[9] = op.m_ioStatistics.m_readByteCount;
+            values[10] = op.m_ioStatistics.m_blockCacheHitCount;
+            values[11] = op.m_ioStatistics.m_blockCacheMissCount;
+        }
+
+        std::size_t rowSize = nullMask.getByteSize();
+        for (std::size_t j = 0; j < values.size(); ++j) {
+            nullMask.setBit(j, values[j].isNull());
+            rowSize += getVariantSize(values[j]);
+        }
+
+        codedOutput.WriteVarint64(rowSize);
+        codedOutput.WriteRaw(nullMask.getData(), nullMask.getByteSize());
+        protobuf::checkOutputStreamError(rawOutput);
+        for (const auto& value : values) {
+            writeVariant(codedOutput, value);
+            protobuf::checkOutputStreamError(rawOutput);
+        }
+    }
+
+    codedOutput.WriteVarint64(kNoMoreRows);
+    protobuf::checkOutputStreamError(rawOutput);
+}
+
 void RequestHandler::executeShowDatabasesRequest(iomgr_protocol::DatabaseEngineResponse& response,
         [[maybe_unused]] const requests::ShowDatabasesRequest& request)
 {
@@ -434,4 +1526,48 @@ void RequestHandler::executeShowDatabasesRequest(iomgr_protocol::DatabaseEngineR
     protobuf::checkOutputStreamError(rawOutput);
 }
 
+void RequestHandler::executeShowStatementCacheRequest(
+        iomgr_protocol::DatabaseEngineResponse& response,
+        [[maybe_unused]] const requests::ShowStatementCacheRequest& request)
+{
+    response.set_has_affected_row_count(false);
+    response.set_affected_row_count(0);
+
+    auto columnDescription = response.add_column_description();
+    columnDescription->set_name("NAME");
+    columnDescription->set_type(COLUMN_DATA_TYPE_TEXT);
+    columnDescription->set_is_null(false);
+    columnDescription = response.add_column_description();
+    columnDescription->set_name("VALUE");
+    columnDescription->set_type(COLUMN_DATA_TYPE_UINT64);
+    columnDescription->set_is_null(false);
+
+    const auto statistics = m_instance.getStatementCache().getStatistics();
+    const std::pair<const char*, std::uint64_t> rows[] = {
+            {"CAPACITY", statistics.m_capacity},
+            {"SIZE", statistics.m_size},
+            {"HITS", statistics.m_hitCount},
+            {"MISSES", statistics.m_missCount},
+            {"INVALIDATIONS", statistics.m_invalidationCount},
+    };
+
+    utils::DefaultErrorCodeChecker errorChecker;
+    protobuf::CustomProtobufOutputStream rawOutput(m_connectionIo, errorChecker);
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, rawOutput);
+
+    google::protobuf::io::CodedOutputStream codedOutput(&rawOutput);
+    for (const auto& row : rows) {
+        const Variant name(row.first);
+        const Variant value(row.second);
+        codedOutput.WriteVarint64(getVariantSize(name) + getVariantSize(value));
+        writeVariant(codedOutput, name);
+        writeVariant(codedOutput, value);
+        protobuf::checkOutputStreamError(rawOutput);
+    }
+
+    codedOutput.WriteVarint64(kNoMoreRows);
+    protobuf::checkOutputStreamError(rawOutput);
+}
+
 }  // namespace siodb::iomgr::dbengine
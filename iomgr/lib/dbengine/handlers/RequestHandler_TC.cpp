@@ -6,9 +6,11 @@
 
 // Project headers
 #include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "../Database.h"
 #include "../ThrowDatabaseError.h"
 
 // Common project headers
+#include <siodb/common/log/Log.h>
 #include <siodb/common/protobuf/ProtobufMessageIO.h>
 
 namespace siodb::iomgr::dbengine {
@@ -17,33 +19,109 @@ void RequestHandler::executeBeginTransactionRequest(
         iomgr_protocol::DatabaseEngineResponse& response,
         [[maybe_unused]] const requests::BeginTransactionRequest& request)
 {
-    sendNotImplementedYet(response);
+    if (m_transaction) throwDatabaseError(IOManagerMessageId::kErrorTransactionAlreadyStarted);
+
+    // Transaction is bound to the current database
+    m_transaction = std::make_unique<Transaction>(
+            m_instance.getDatabaseChecked(m_currentDatabaseName), m_userId);
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
 }
 
 void RequestHandler::executeCommitTransactionRequest(
         iomgr_protocol::DatabaseEngineResponse& response,
         [[maybe_unused]] const requests::CommitTransactionRequest& request)
 {
-    sendNotImplementedYet(response);
+    if (!m_transaction) throwDatabaseError(IOManagerMessageId::kErrorNoActiveTransaction);
+
+    // If commit fails, transaction remains active and can be rolled back
+    m_transaction->commit();
+    m_transaction.reset();
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
 }
 
 void RequestHandler::executeRollbackTransactionRequest(
         iomgr_protocol::DatabaseEngineResponse& response,
-        [[maybe_unused]] const requests::RollbackTransactionRequest& request)
+        const requests::RollbackTransactionRequest& request)
 {
-    sendNotImplementedYet(response);
+    if (!m_transaction) throwDatabaseError(IOManagerMessageId::kErrorNoActiveTransaction);
+
+    if (request.m_savepoint.empty()) {
+        // Transaction ends even if rollback fails
+        const auto transaction = std::move(m_transaction);
+        transaction->rollback();
+    } else
+        m_transaction->rollbackToSavepoint(request.m_savepoint);
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
+}
+
+void RequestHandler::executeSavepointRequest(
+        iomgr_protocol::DatabaseEngineResponse& response, const requests::SavepointRequest& request)
+{
+    if (!m_transaction) throwDatabaseError(IOManagerMessageId::kErrorNoActiveTransaction);
+
+    m_transaction->setSavepoint(request.m_savepoint);
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
+}
+
+void RequestHandler::executeReleaseRequest(
+        iomgr_protocol::DatabaseEngineResponse& response, const requests::ReleaseRequest& request)
+{
+    if (!m_transaction) throwDatabaseError(IOManagerMessageId::kErrorNoActiveTransaction);
+
+    m_transaction->releaseSavepoint(request.m_savepoint);
+
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, m_connectionIo);
+}
+
+void RequestHandler::executeInTransaction(const DatabasePtr& database,
+        const std::function<void(Transaction& transaction)>& operation)
+{
+    if (!m_transaction) {
+        // Without explicit transaction, each statement is committed on its own
+        Transaction transaction(database, m_userId);
+        operation(transaction);
+        transaction.commit();
+        return;
+    }
+
+    if (m_transaction->getDatabase() != database) {
+        throwDatabaseError(IOManagerMessageId::kErrorTransactionDatabaseMismatch,
+                m_transaction->getDatabase()->getName(), database->getName());
+    }
+
+    // Failed statement is rolled back alone, previous statements remain in transaction
+    const auto undoPosition = m_transaction->getUndoPosition();
+    try {
+        operation(*m_transaction);
+    } catch (...) {
+        try {
+            m_transaction->rollbackTo(undoPosition);
+        } catch (std::exception& ex) {
+            LOG_ERROR << kLogContext << "Can't roll back failed statement: " << ex.what();
+        }
+        throw;
+    }
 }
 
-void RequestHandler::executeSavepointRequest(iomgr_protocol::DatabaseEngineResponse& response,
-        [[maybe_unused]] const requests::SavepointRequest& request)
+TransactionSnapshotPtr RequestHandler::createSnapshot(Database& database) const
 {
-    sendNotImplementedYet(response);
+    return database.createSnapshot(getOwnTransactionId(database));
 }
 
-void RequestHandler::executeReleaseRequest(iomgr_protocol::DatabaseEngineResponse& response,
-        [[maybe_unused]] const requests::ReleaseRequest& request)
+std::uint64_t RequestHandler::getOwnTransactionId(const Database& database) const noexcept
 {
-    sendNotImplementedYet(response);
+    return m_transaction && m_transaction->getDatabase().get() == &database
+                   ? m_transaction->getTransactionId()
+                   : 0;
 }
 
 }  // namespace siodb::iomgr::dbengine
@@ -16,6 +16,7 @@
 
 // STL headers
 #include <sstream>
+#include <stdexcept>
 
 // Keep all these DEBUG_TRACEs in the code for a while. To be removed a bit later,
 // when we are completely confident that it works correctly with our real data.
@@ -37,7 +38,7 @@ EncryptedFile::EncryptedFile(const std::string& path, int extraFlags, int create
     , m_plaintextSize(initialSize)
     , m_encryptionContext(encryptionContext)
     , m_decryptionContext(decryptionContext)
-    , m_blockSize(encryptionContext->getBlockSizeInBytes())
+    , m_blockSize(checkBlockSize(encryptionContext->getBlockSizeInBytes()))
     , m_headerBuffer(utils::alignUp(kHeaderPlaintextSize, m_blockSize))
     , m_headerBufferBlockCount(m_headerBuffer.size() / m_blockSize)
     , m_dataBuffer(kDataBufferSize)
@@ -54,7 +55,7 @@ EncryptedFile::EncryptedFile(const std::string& path, int extraFlags,
     , m_plaintextSize(0)
     , m_encryptionContext(encryptionContext)
     , m_decryptionContext(decryptionContext)
-    , m_blockSize(encryptionContext->getBlockSizeInBytes())
+    , m_blockSize(checkBlockSize(encryptionContext->getBlockSizeInBytes()))
     , m_headerBuffer(utils::alignUp(kHeaderPlaintextSize, m_blockSize))
     , m_headerBufferBlockCount(m_headerBuffer.size() / m_blockSize)
     , m_dataBuffer(kDataBufferSize)
@@ -151,12 +152,22 @@ bool EncryptedFile::extend(off_t length) noexcept
 
 // ----- internals -----
 
+std::size_t EncryptedFile::checkBlockSize(std::size_t blockSize)
+{
+    if (blockSize == 0 || blockSize > kMaxBlockSize)
+        throw std::invalid_argument("Unsupported cipher block size");
+    return blockSize;
+}
+
 std::size_t EncryptedFile::readInternal(
         std::uint8_t* buffer, std::size_t size, off_t offset) noexcept
 {
     DEBUG_TRACE("EncryptedFile::readInternal: buffer=" << VOID_PTR(buffer) << " size=" << size
                                                        << " offset=" << offset);
 
+    // Partial blocks are decrypted in the local buffer, so that concurrent reads
+    // don't interfere with each other.
+    std::uint8_t blockBuffer[kMaxBlockSize];
     std::size_t totalBytesRead = 0;
     const auto alignedDownOffset = utils::alignDown(offset, m_blockSize);
     const auto offsetDiff = offset - alignedDownOffset;
@@ -164,17 +175,17 @@ std::size_t EncryptedFile::readInternal(
     if (offsetDiff > 0) {
         // Read partial amount of data from the first block
 
-        if (::preadExact(m_fd.getFd(), m_dataBuffer.data(), m_blockSize, alignedDownOffset,
+        if (::preadExact(m_fd.getFd(), blockBuffer, m_blockSize, alignedDownOffset,
                     kIgnoreSignals)
                 != m_blockSize) {
             m_lastError = errno;
             return 0;
         }
 
-        m_decryptionContext->transform(m_dataBuffer.data(), 1, m_dataBuffer.data());
+        m_decryptionContext->transform(blockBuffer, 1, blockBuffer);
 
         const auto partialBytes = std::min(m_blockSize - offsetDiff, size);
-        std::memcpy(buffer, m_dataBuffer.data() + offsetDiff, partialBytes);
+        std::memcpy(buffer, blockBuffer + offsetDiff, partialBytes);
 
         if (size == partialBytes) return partialBytes;
 
@@ -210,14 +221,14 @@ std::size_t EncryptedFile::readInternal(
     if (size > 0) {
         // Read part of the last block if applicable
 
-        if (::preadExact(m_fd.getFd(), m_dataBuffer.data(), m_blockSize, offset, kIgnoreSignals)
+        if (::preadExact(m_fd.getFd(), blockBuffer, m_blockSize, offset, kIgnoreSignals)
                 != m_blockSize) {
             m_lastError = errno;
             return totalBytesRead;
         }
 
-        m_decryptionContext->transform(m_dataBuffer.data(), 1, m_dataBuffer.data());
-        std::memcpy(buffer, m_dataBuffer.data(), size);
+        m_decryptionContext->transform(blockBuffer, 1, blockBuffer);
+        std::memcpy(buffer, blockBuffer, size);
         totalBytesRead += size;
     }
 
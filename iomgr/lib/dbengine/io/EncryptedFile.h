@@ -100,8 +100,17 @@ public:
     bool extend(off_t length) noexcept override;
 
 private:
+    /**
+     * Validates cipher block size.
+     * @param blockSize Block size.
+     * @return The same block size.
+     * @throw std::invalid_argument if block size is zero or exceeds kMaxBlockSize.
+     */
+    static std::size_t checkBlockSize(std::size_t blockSize);
+
     /**
      * Reads specified amount of data from file starting at a given offset.
+     * Doesn't modify any shared state except error code, so that concurrent reads are safe.
      * If pread() system call succeeds but reads less then specified, next attempts are taken
      * to read subsequent portion of data until specified number of bytes is read.
      * @param buffer A buffer for data.
@@ -202,6 +211,9 @@ private:
 
     /** I/O buffer size */
     static constexpr std::size_t kDataBufferSize = 8192;
+
+    /** Maximum supported cipher block size */
+    static constexpr std::size_t kMaxBlockSize = 64;
 };
 
 }  // namespace siodb::iomgr::dbengine::io
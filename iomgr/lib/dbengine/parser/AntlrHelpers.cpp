@@ -29,10 +29,13 @@ antlr4::tree::ParseTree* findStatement(const antlr4::tree::ParseTree* node,
     if (!context) return nullptr;
 
     if (context->getRuleIndex() == SiodbParser::RuleSql_stmt) {
-        // Found sql_stmt node
-        if (nextIndex == statementIndex)
-            return node->children.empty() ? nullptr : node->children.front();
-        else {
+        // Found sql_stmt node. Statement prefixed by EXPLAIN is represented by the node itself.
+        if (nextIndex == statementIndex) {
+            if (node->children.empty()) return nullptr;
+            return getTerminalType(node->children.front()) == SiodbParser::K_EXPLAIN
+                           ? const_cast<antlr4::tree::ParseTree*>(node)
+                           : node->children.front();
+        } else {
             ++nextIndex;
             return nullptr;
         }
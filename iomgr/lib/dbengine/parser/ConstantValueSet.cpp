@@ -0,0 +1,159 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "ConstantValueSet.h"
+
+// STL headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace siodb::iomgr::dbengine::requests {
+
+std::optional<ConstantValueSet> ConstantValueSet::create(
+        const std::vector<const Variant*>& values)
+{
+    ConstantValueSet result(Kind::kEmpty);
+    for (const auto value : values) {
+        if (value->isNull()) continue;
+        const auto valueType = value->getValueType();
+        Kind kind;
+        if (isNumericType(valueType))
+            kind = Kind::kNumeric;
+        else if (valueType == VariantType::kString)
+            kind = Kind::kString;
+        else if (valueType == VariantType::kBool)
+            kind = Kind::kBool;
+        else
+            return std::nullopt;
+
+        if (result.m_kind == Kind::kEmpty)
+            result.m_kind = kind;
+        else if (result.m_kind != kind)
+            return std::nullopt;
+
+        switch (kind) {
+            case Kind::kNumeric: {
+                const auto key = makeNumericKey(*value);
+                switch (key.m_kind) {
+                    case NumericKey::Kind::kInteger: {
+                        result.m_integerValues.push_back(key.m_integer);
+                        break;
+                    }
+                    case NumericKey::Kind::kLargeInteger: {
+                        result.m_largeIntegerValues.push_back(key.m_largeInteger);
+                        break;
+                    }
+                    case NumericKey::Kind::kFractional: {
+                        // NaN is not equal to anything
+                        if (!std::isnan(key.m_fractional))
+                            result.m_fractionalValues.push_back(key.m_fractional);
+                        break;
+                    }
+                }
+                break;
+            }
+            case Kind::kString: {
+                result.m_stringValues.insert(value->getString());
+                break;
+            }
+            case Kind::kBool: {
+                (value->getBool() ? result.m_hasTrue : result.m_hasFalse) = true;
+                break;
+            }
+            default: break;
+        }
+    }
+
+    const auto sortAndRemoveDuplicates = [](auto& v) {
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+    };
+    sortAndRemoveDuplicates(result.m_integerValues);
+    sortAndRemoveDuplicates(result.m_largeIntegerValues);
+    sortAndRemoveDuplicates(result.m_fractionalValues);
+    if (result.m_integerValues.size() > kMaxScannedIntegerCount) {
+        result.m_integerValueSet.insert(
+                result.m_integerValues.cbegin(), result.m_integerValues.cend());
+    }
+    return result;
+}
+
+std::optional<bool> ConstantValueSet::contains(const Variant& value) const
+{
+    const auto valueType = value.getValueType();
+    switch (m_kind) {
+        case Kind::kEmpty: return false;
+        case Kind::kNumeric: {
+            if (!isNumericType(valueType)) return std::nullopt;
+            const auto key = makeNumericKey(value);
+            switch (key.m_kind) {
+                case NumericKey::Kind::kInteger: return containsInteger(key.m_integer);
+                case NumericKey::Kind::kLargeInteger: {
+                    return std::binary_search(m_largeIntegerValues.cbegin(),
+                            m_largeIntegerValues.cend(), key.m_largeInteger);
+                }
+                case NumericKey::Kind::kFractional: {
+                    return std::binary_search(m_fractionalValues.cbegin(),
+                            m_fractionalValues.cend(), key.m_fractional);
+                }
+            }
+            return false;
+        }
+        case Kind::kString: {
+            if (valueType != VariantType::kString) return std::nullopt;
+            // UTF-8 strings are equal when they are equal byte by byte
+            return m_stringValues.count(value.getString()) > 0;
+        }
+        case Kind::kBool: {
+            if (valueType != VariantType::kBool) return std::nullopt;
+            return value.getBool() ? m_hasTrue : m_hasFalse;
+        }
+    }
+    return std::nullopt;
+}
+
+// ----- internals -----
+
+bool ConstantValueSet::containsInteger(std::int64_t value) const noexcept
+{
+    if (!m_integerValueSet.empty()) return m_integerValueSet.count(value) > 0;
+    // Loop without early exit is vectorized by the compiler
+    bool found = false;
+    for (const auto v : m_integerValues)
+        found |= v == value;
+    return found;
+}
+
+ConstantValueSet::NumericKey ConstantValueSet::makeNumericKey(const Variant& value)
+{
+    NumericKey key {NumericKey::Kind::kInteger, 0, 0, 0.0};
+    const auto valueType = value.getValueType();
+    if (valueType == VariantType::kUInt64) {
+        const auto v = value.getUInt64();
+        if (v > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) {
+            key.m_kind = NumericKey::Kind::kLargeInteger;
+            key.m_largeInteger = v;
+        } else
+            key.m_integer = static_cast<std::int64_t>(v);
+    } else if (isIntegerType(valueType))
+        key.m_integer = value.asInt64();
+    else {
+        // Integral floating-point value is equal to the integer value
+        constexpr double kTwoPow63 = 9223372036854775808.0;
+        const auto v = value.asDouble();
+        if (std::trunc(v) == v && v >= -kTwoPow63 && v < kTwoPow63)
+            key.m_integer = static_cast<std::int64_t>(v);
+        else if (std::trunc(v) == v && v >= kTwoPow63 && v < kTwoPow63 * 2.0) {
+            key.m_kind = NumericKey::Kind::kLargeInteger;
+            key.m_largeInteger = static_cast<std::uint64_t>(v);
+        } else {
+            key.m_kind = NumericKey::Kind::kFractional;
+            key.m_fractional = v;
+        }
+    }
+    return key;
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,167 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "../Variant.h"
+
+// STL headers
+#include <optional>
+#include <unordered_set>
+
+namespace siodb::iomgr::dbengine::requests {
+
+/**
+ * Set of the constant values for the fast membership checks, used by IN operator.
+ * Numeric values of any type are normalized to the common representation,
+ * so that values are found by the numeric value regardless of the value type.
+ * Small integer sets are checked by the branchless scan of the sorted array,
+ * larger ones by the hash set.
+ */
+class ConstantValueSet final {
+public:
+    /**
+     * Creates set from the constant values. NULL values are skipped.
+     * @param values Constant values.
+     * @return Value set or std::nullopt if values are of the different or unsupported kinds.
+     */
+    static std::optional<ConstantValueSet> create(const std::vector<const Variant*>& values);
+
+    /**
+     * Checks that set contains value equal to the given one.
+     * @param value A value, must not be NULL.
+     * @return true if value is found, false if not found, std::nullopt if value
+     *         is of the different kind than set values and should be compared
+     *         to the values one by one.
+     */
+    std::optional<bool> contains(const Variant& value) const;
+
+    /**
+     * Returns indication that set contains numeric values.
+     * @return true if set contains numeric values, false otherwise.
+     */
+    bool isNumeric() const noexcept
+    {
+        return m_kind == Kind::kNumeric;
+    }
+
+    /**
+     * Returns integer values of the set. Used for the index lookups.
+     * @return Sorted distinct integer values.
+     */
+    const std::vector<std::int64_t>& getIntegerValues() const noexcept
+    {
+        return m_integerValues;
+    }
+
+    /**
+     * Returns indication that set contains numeric values other than ones
+     * returned by getIntegerValues().
+     * @return true if there are other numeric values, false otherwise.
+     */
+    bool hasNonIntegerValues() const noexcept
+    {
+        return !m_largeIntegerValues.empty() || !m_fractionalValues.empty();
+    }
+
+private:
+    /** Kind of the set values */
+    enum class Kind {
+        /** Set has no values */
+        kEmpty,
+
+        /** Set contains numeric values */
+        kNumeric,
+
+        /** Set contains strings */
+        kString,
+
+        /** Set contains boolean values */
+        kBool,
+    };
+
+    /** Normalized numeric value */
+    struct NumericKey {
+        /** Value kind */
+        enum class Kind {
+            /** Integer value in the signed 64-bit integer range */
+            kInteger,
+
+            /** Integer value above the signed 64-bit integer range */
+            kLargeInteger,
+
+            /** Any other value */
+            kFractional,
+        };
+
+        /** Value kind */
+        Kind m_kind;
+
+        /** Value, when value kind is kInteger */
+        std::int64_t m_integer;
+
+        /** Value, when value kind is kLargeInteger */
+        std::uint64_t m_largeInteger;
+
+        /** Value, when value kind is kFractional */
+        double m_fractional;
+    };
+
+private:
+    /**
+     * Initializes object of class ConstantValueSet.
+     * @param kind Value kind.
+     */
+    explicit ConstantValueSet(Kind kind) noexcept
+        : m_kind(kind)
+        , m_hasTrue(false)
+        , m_hasFalse(false)
+    {
+    }
+
+    /**
+     * Checks that set contains integer value.
+     * @param value A value.
+     * @return true if value is found, false otherwise.
+     */
+    bool containsInteger(std::int64_t value) const noexcept;
+
+    /**
+     * Normalizes numeric value.
+     * @param value A numeric value.
+     * @return Normalized value.
+     */
+    static NumericKey makeNumericKey(const Variant& value);
+
+private:
+    /** Kind of values */
+    Kind m_kind;
+
+    /** Sorted integer values in the signed 64-bit integer range */
+    std::vector<std::int64_t> m_integerValues;
+
+    /** Integer values for the hash lookup, when there are many of them */
+    std::unordered_set<std::int64_t> m_integerValueSet;
+
+    /** Sorted integer values above the signed 64-bit integer range */
+    std::vector<std::uint64_t> m_largeIntegerValues;
+
+    /** Sorted non-integer floating-point values */
+    std::vector<double> m_fractionalValues;
+
+    /** String values */
+    std::unordered_set<std::string> m_stringValues;
+
+    /** Indication that set contains true */
+    bool m_hasTrue;
+
+    /** Indication that set contains false */
+    bool m_hasFalse;
+
+    /** Maximum number of integer values checked by the array scan */
+    static constexpr std::size_t kMaxScannedIntegerCount = 32;
+};
+
+}  // namespace siodb::iomgr::dbengine::requests
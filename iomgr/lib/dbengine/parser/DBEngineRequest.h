@@ -8,6 +8,7 @@
 #include "DBEngineRequestType.h"
 #include "expr/Expression.h"
 #include "../ConstraintType.h"
+#include "../DataFileFormat.h"
 
 // Common project headers
 #include <siodb/common/config/SiodbDefs.h>
@@ -46,6 +47,13 @@ enum class TableJoinType {
     kFullJoin,
 };
 
+/** Kind of the history point in the AS OF clause */
+enum class AsOfType {
+    kNone,
+    kTransaction,
+    kTimestamp,
+};
+
 /** Source table specification */
 struct SourceTable {
     /**
@@ -116,7 +124,7 @@ struct ResultExpression {
 /** Element of the ORDER BY clause */
 struct OrderByExpression {
     /**
-     * Initializes object of class OrderByElement.
+     * Initializes object of class OrderByExpression.
      * @param subject ORDER BY subject
      * @param sortDescending Indicator of the descending sort order.
      */
@@ -127,10 +135,10 @@ struct OrderByExpression {
     }
 
     /** ORDER BY subject */
-    const ConstExpressionPtr m_subject;
+    ConstExpressionPtr m_subject;
 
     /** Indicator of the descending sort order */
-    const bool m_sortDescending;
+    bool m_sortDescending;
 };
 
 /** SELECT request */
@@ -145,13 +153,16 @@ struct SelectRequest : public DBEngineRequest {
      * @param groupBy GROUP BY clause.
      * @param having HAVING condition.
      * @param orderBy ORDER BY clause.
+     * @param asOfType Kind of the history point in the AS OF clause.
+     * @param asOf History point in the AS OF clause.
      */
     SelectRequest(std::string&& database, std::vector<SourceTable>&& tables,
             std::vector<ResultExpression>&& columns, ConstExpressionPtr&& where = nullptr,
             std::vector<ConstExpressionPtr>&& groupBy = std::vector<ConstExpressionPtr>(),
             ConstExpressionPtr&& having = nullptr,
-            std::vector<ConstExpressionPtr>&& orderBy = std::vector<ConstExpressionPtr>(),
-            ConstExpressionPtr&& offset = nullptr, ConstExpressionPtr&& limit = nullptr) noexcept
+            std::vector<OrderByExpression>&& orderBy = std::vector<OrderByExpression>(),
+            ConstExpressionPtr&& offset = nullptr, ConstExpressionPtr&& limit = nullptr,
+            AsOfType asOfType = AsOfType::kNone, ConstExpressionPtr&& asOf = nullptr) noexcept
         : DBEngineRequest(DBEngineRequestType::kSelect)
         , m_database(std::move(database))
         , m_tables(std::move(tables))
@@ -162,6 +173,8 @@ struct SelectRequest : public DBEngineRequest {
         , m_orderBy(std::move(orderBy))
         , m_offset(std::move(offset))
         , m_limit(std::move(limit))
+        , m_asOfType(asOfType)
+        , m_asOf(std::move(asOf))
     {
     }
 
@@ -184,13 +197,19 @@ struct SelectRequest : public DBEngineRequest {
     const ConstExpressionPtr m_having;
 
     /** ORDER BY expressions, empty if absent */
-    const std::vector<ConstExpressionPtr> m_orderBy;
+    const std::vector<OrderByExpression> m_orderBy;
 
     /** OFFSET expression, empty if absent */
     const ConstExpressionPtr m_offset;
 
     /** LIMIT expression, empty if absent */
     const ConstExpressionPtr m_limit;
+
+    /** Kind of the history point, kNone if AS OF clause is absent */
+    const AsOfType m_asOfType;
+
+    /** AS OF history point expression, empty if absent */
+    const ConstExpressionPtr m_asOf;
 };
 
 /** INSERT request */
@@ -307,6 +326,101 @@ struct DeleteRequest : public DBEngineRequest {
     const ConstExpressionPtr m_where;
 };
 
+/** COPY FROM request */
+struct CopyFromRequest : public DBEngineRequest {
+    /**
+     * Initializes object of class CopyFromRequest.
+     * @param database Database name.
+     * @param table Table name.
+     * @param columns Column names.
+     * @param filePath Path to the data file on the server.
+     * @param format Data file format.
+     * @param delimiter CSV field delimiter.
+     * @param header Indication that CSV file starts with header line.
+     */
+    CopyFromRequest(std::string&& database, std::string&& table,
+            std::vector<std::string>&& columns, std::string&& filePath, DataFileFormat format,
+            char delimiter, bool header) noexcept
+        : DBEngineRequest(DBEngineRequestType::kCopyFrom)
+        , m_database(std::move(database))
+        , m_table(std::move(table))
+        , m_columns(std::move(columns))
+        , m_filePath(std::move(filePath))
+        , m_format(format)
+        , m_delimiter(delimiter)
+        , m_header(header)
+    {
+    }
+
+    /** Database name */
+    const std::string m_database;
+
+    /** Table name */
+    const std::string m_table;
+
+    /** Column names, may be empty. */
+    const std::vector<std::string> m_columns;
+
+    /** Path to the data file on the server */
+    const std::string m_filePath;
+
+    /** Data file format */
+    const DataFileFormat m_format;
+
+    /** CSV field delimiter */
+    const char m_delimiter;
+
+    /** Indication that CSV file starts with header line */
+    const bool m_header;
+};
+
+/** COPY TO request */
+struct CopyToRequest : public DBEngineRequest {
+    /**
+     * Initializes object of class CopyToRequest.
+     * @param database Database name.
+     * @param table Table name.
+     * @param columns Column names.
+     * @param filePath Path to the data file on the server.
+     * @param format Data file format.
+     * @param delimiter CSV field delimiter.
+     * @param header Indication that CSV file should start with header line.
+     */
+    CopyToRequest(std::string&& database, std::string&& table, std::vector<std::string>&& columns,
+            std::string&& filePath, DataFileFormat format, char delimiter, bool header) noexcept
+        : DBEngineRequest(DBEngineRequestType::kCopyTo)
+        , m_database(std::move(database))
+        , m_table(std::move(table))
+        , m_columns(std::move(columns))
+        , m_filePath(std::move(filePath))
+        , m_format(format)
+        , m_delimiter(delimiter)
+        , m_header(header)
+    {
+    }
+
+    /** Database name */
+    const std::string m_database;
+
+    /** Table name */
+    const std::string m_table;
+
+    /** Column names, may be empty. */
+    const std::vector<std::string> m_columns;
+
+    /** Path to the data file on the server */
+    const std::string m_filePath;
+
+    /** Data file format */
+    const DataFileFormat m_format;
+
+    /** CSV field delimiter */
+    const char m_delimiter;
+
+    /** Indication that CSV file should start with header line */
+    const bool m_header;
+};
+
 /** Transaction type */
 enum class TransactionType {
     kDeferred,
@@ -1178,4 +1292,55 @@ struct ShowDatabasesRequest : public DBEngineRequest {
     }
 };
 
+/** SHOW STATEMENT CACHE request */
+struct ShowStatementCacheRequest : public DBEngineRequest {
+    /** Initializes object of class ShowStatementCacheRequest */
+    ShowStatementCacheRequest() noexcept
+        : DBEngineRequest(DBEngineRequestType::kShowStatementCache)
+    {
+    }
+};
+
+/** EXPLAIN request */
+struct ExplainRequest : public DBEngineRequest {
+    /**
+     * Initializes object of class ExplainRequest.
+     * @param request Explained request.
+     * @param analyze Indication that request should be executed to collect statistics.
+     */
+    ExplainRequest(DBEngineRequestPtr&& request, bool analyze) noexcept
+        : DBEngineRequest(DBEngineRequestType::kExplain)
+        , m_request(std::move(request))
+        , m_analyze(analyze)
+    {
+    }
+
+    /** Explained request */
+    const DBEngineRequestPtr m_request;
+
+    /** Indication that request should be executed to collect statistics */
+    const bool m_analyze;
+};
+
+/** ANALYZE request */
+struct AnalyzeRequest : public DBEngineRequest {
+    /**
+     * Initializes object of class AnalyzeRequest.
+     * @param database Database name.
+     * @param table Table name, empty means all user tables of the database.
+     */
+    AnalyzeRequest(std::string&& database, std::string&& table) noexcept
+        : DBEngineRequest(DBEngineRequestType::kAnalyze)
+        , m_database(std::move(database))
+        , m_table(std::move(table))
+    {
+    }
+
+    /** Database name */
+    const std::string m_database;
+
+    /** Table name, empty means all user tables of the database */
+    const std::string m_table;
+};
+
 }  // namespace siodb::iomgr::dbengine::requests
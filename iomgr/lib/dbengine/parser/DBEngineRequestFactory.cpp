@@ -16,6 +16,7 @@
 // Boost headers
 #include <boost/algorithm/hex.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/uuid/string_generator.hpp>
 
 // Protobuf message headers
@@ -58,7 +59,16 @@ const std::unordered_map<std::string, siodb::ColumnDataType>
                 {"TIMESTAMP", siodb::COLUMN_DATA_TYPE_TIMESTAMP},
         };
 
-requests::DBEngineRequestPtr DBEngineRequestFactory::createRequest(antlr4::tree::ParseTree* node)
+requests::DBEngineRequestPtr DBEngineRequestFactory::createRequest(
+        antlr4::tree::ParseTree* node, const StatementParameters* parameters)
+{
+    return DBEngineRequestFactory(parameters).doCreateRequest(node);
+}
+
+// ----- internals -----
+
+requests::DBEngineRequestPtr DBEngineRequestFactory::doCreateRequest(
+        antlr4::tree::ParseTree* node) const
 {
     if (!node) throw std::out_of_range("Statement doesn't exist");
 
@@ -72,9 +82,15 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createRequest(antlr4::tree:
             return createSelectRequestForFactoredSelectStatement(node);
         case SiodbParser::RuleShow_databases_stmt:
             return std::make_unique<requests::ShowDatabasesRequest>();
+        case SiodbParser::RuleShow_statement_cache_stmt:
+            return std::make_unique<requests::ShowStatementCacheRequest>();
+        case SiodbParser::RuleSql_stmt: return createExplainRequest(node);
+        case SiodbParser::RuleAnalyze_stmt: return createAnalyzeRequest(node);
         case SiodbParser::RuleInsert_stmt: return createInsertRequest(node);
         case SiodbParser::RuleUpdate_stmt: return createUpdateRequest(node);
         case SiodbParser::RuleDelete_stmt: return createDeleteRequest(node);
+        case SiodbParser::RuleCopy_from_stmt: return createCopyRequest(node, false);
+        case SiodbParser::RuleCopy_to_stmt: return createCopyRequest(node, true);
         case SiodbParser::RuleBegin_stmt: return createBeginTransactionRequest(node);
         case SiodbParser::RuleCommit_stmt: return createCommitTransactionRequest(node);
         case SiodbParser::RuleRollback_stmt: return createRollbackTransactionRequest(node);
@@ -125,10 +141,8 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createRequest(antlr4::tree:
     }
 }
 
-// ----- internals -----
-
 requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForGeneralSelectStatement(
-        [[maybe_unused]] antlr4::tree::ParseTree* node)
+        [[maybe_unused]] antlr4::tree::ParseTree* node) const
 {
     throw std::runtime_error("SELECT: unsupported syntax");
 
@@ -141,20 +155,26 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForGener
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForSimpleSelectStatement(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
-    ExpressionFactory exprFactory(false);
+    ExpressionFactory exprFactory(false, m_parameters);
     std::string database;
     std::vector<requests::SourceTable> tables;
     std::vector<requests::ResultExpression> columns;
-    requests::ConstExpressionPtr where, offset, limit;
+    requests::ConstExpressionPtr where, having, offset, limit, asOf;
+    std::vector<requests::ConstExpressionPtr> groupBy;
+    std::vector<requests::OrderByExpression> orderBy;
+    auto asOfType = requests::AsOfType::kNone;
 
     for (std::size_t i = 0; i < node->children.size(); ++i) {
         const auto child = node->children[i];
         const auto childTerminalType = helpers::getNonTerminalType(child);
 
         if (childTerminalType == SiodbParser::RuleSelect_core)
-            parseSelectCore(child, database, tables, columns, where);
+            parseSelectCore(
+                    child, database, tables, columns, where, groupBy, having, asOfType, asOf);
+        else if (childTerminalType == SiodbParser::RuleOrdering_term)
+            orderBy.push_back(createOrderByExpression(child));
         else if (childTerminalType == kInvalidNodeType) {
             const auto terminalType = helpers::getTerminalType(child);
             switch (terminalType) {
@@ -163,7 +183,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForSimpl
                     if (i >= node->children.size())
                         throw std::runtime_error("SELECT: LIMIT does not contain expression");
 
-                    if (node->children.size() + 2 > i
+                    if (i + 2 < node->children.size()
                             && helpers::getTerminalType(node->children[i + 1])
                                        == SiodbParser::COMMA) {
                         // '... LIMIT <OFFSET> , <LIMIT> ...' case
@@ -189,22 +209,13 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForSimpl
         }
     }
 
-    // TODO: Capture GROUP BY values
-    std::vector<requests::ConstExpressionPtr> groupBy;
-
-    // TODO: Capture HAVING values
-    requests::ConstExpressionPtr having;
-
-    // TODO: Capture ORDER BY values
-    std::vector<requests::ConstExpressionPtr> orderBy;
-
     return std::make_unique<requests::SelectRequest>(std::move(database), std::move(tables),
             std::move(columns), std::move(where), std::move(groupBy), std::move(having),
-            std::move(orderBy), std::move(offset), std::move(limit));
+            std::move(orderBy), std::move(offset), std::move(limit), asOfType, std::move(asOf));
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForFactoredSelectStatement(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // TODO: Implement DBEngineRequestFactory::createSelectRequestForFactoredSelectStatement()
     const auto selectCoreCount = std::count_if(
@@ -220,11 +231,10 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createSelectRequestForFacto
     // TODO: Capture WHERE values
     // TODO: Capture GROUP BY values
     // TODO: Capture HAVING values
-    // TODO: Capture ORDER BY values
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createInsertRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -263,7 +273,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createInsertRequest(
 
     if (!valuesFound) throw std::runtime_error("INSERT missing VALUES keyword");
 
-    ExpressionFactory exprFactory(false);
+    ExpressionFactory exprFactory(false, m_parameters);
     std::vector<std::vector<requests::ConstExpressionPtr>> values;
     if (!columns.empty()) values.reserve(columns.size());
     bool inValueGroup = false;
@@ -300,9 +310,9 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createInsertRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createUpdateRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
-    const ExpressionFactory exprFactory(true);
+    const ExpressionFactory exprFactory(true, m_parameters);
     std::string database, tableName, tableAlias;
     requests::ConstExpressionPtr where;
     std::vector<requests::ColumnReference> columns;
@@ -428,7 +438,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createUpdateRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDeleteRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     std::string database;
     std::string tableName;
@@ -466,7 +476,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDeleteRequest(
                     if (i >= node->children.size())
                         throw std::runtime_error("DELETE, WHERE does not contain expression");
 
-                    ExpressionFactory exprFactory(true);
+                    ExpressionFactory exprFactory(true, m_parameters);
                     where = exprFactory.createExpression(node->children[i]);
                 }
                 break;
@@ -479,8 +489,129 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDeleteRequest(
             requests::SourceTable(std::move(tableName), std::move(tableAlias)), std::move(where));
 }
 
+requests::DBEngineRequestPtr DBEngineRequestFactory::createCopyRequest(
+        antlr4::tree::ParseTree* node, bool copyTo) const
+{
+    // Capture database ID
+    std::string database;
+    const auto databaseIdNode =
+            helpers::findTerminal(node, SiodbParser::RuleDatabase_name, SiodbParser::IDENTIFIER);
+    if (databaseIdNode) database = boost::to_upper_copy(databaseIdNode->getText());
+
+    // Capture table ID
+    std::string table;
+    const auto tableIdNode =
+            helpers::findTerminal(node, SiodbParser::RuleTable_name, SiodbParser::IDENTIFIER);
+    if (tableIdNode)
+        table = boost::to_upper_copy(tableIdNode->getText());
+    else
+        throw std::invalid_argument("COPY missing table ID");
+
+    std::vector<std::string> columns;
+    std::string filePath;
+    auto format = DataFileFormat::kCsv;
+    char delimiter = ',';
+    bool header = false;
+    for (std::size_t i = 0; i < node->children.size(); ++i) {
+        const auto e = node->children[i];
+        switch (helpers::getNonTerminalType(e)) {
+            case SiodbParser::RuleColumn_name: {
+                const auto columnIdNode = helpers::findTerminal(e, SiodbParser::IDENTIFIER);
+                if (!columnIdNode) throw std::invalid_argument("COPY missing column ID");
+                columns.push_back(boost::to_upper_copy(columnIdNode->getText()));
+                break;
+            }
+            case SiodbParser::RuleCopy_option_list: {
+                // skip comma (option ',' option ... )
+                for (std::size_t j = 0; j < e->children.size(); j += 2) {
+                    const auto optionNode = e->children[j];
+                    switch (helpers::getTerminalType(optionNode->children.at(0))) {
+                        case SiodbParser::K_FORMAT: {
+                            auto value = optionNode->children.at(2)->getText();
+                            // Remove quotes
+                            value.pop_back();
+                            value.erase(0, 1);
+                            boost::to_upper(value);
+                            if (value == "CSV")
+                                format = DataFileFormat::kCsv;
+                            else if (value == "BINARY")
+                                format = DataFileFormat::kBinary;
+                            else
+                                throw std::invalid_argument("COPY unsupported format");
+                            break;
+                        }
+                        case SiodbParser::K_DELIMITER: {
+                            const auto value = optionNode->children.at(2)->getText();
+                            // Single character in quotes, which is not used by CSV otherwise
+                            if (value.length() != 3 || value[1] == '"' || value[1] == '\n'
+                                    || value[1] == '\r')
+                                throw std::invalid_argument("COPY invalid delimiter");
+                            delimiter = value[1];
+                            break;
+                        }
+                        case SiodbParser::K_HEADER: {
+                            header = true;
+                            break;
+                        }
+                        default: throw std::invalid_argument("COPY invalid option");
+                    }
+                }
+                break;
+            }
+            case kInvalidNodeType: {
+                if (helpers::getTerminalType(e) == SiodbParser::STRING_LITERAL) {
+                    filePath = e->getText();
+                    // Remove quotes
+                    filePath.pop_back();
+                    filePath.erase(0, 1);
+                }
+                break;
+            }
+            default: break;
+        }
+    }
+
+    if (filePath.empty()) throw std::invalid_argument("COPY missing file path");
+
+    if (copyTo) {
+        return std::make_unique<requests::CopyToRequest>(std::move(database), std::move(table),
+                std::move(columns), std::move(filePath), format, delimiter, header);
+    }
+    return std::make_unique<requests::CopyFromRequest>(std::move(database), std::move(table),
+            std::move(columns), std::move(filePath), format, delimiter, header);
+}
+
+requests::DBEngineRequestPtr DBEngineRequestFactory::createExplainRequest(
+        antlr4::tree::ParseTree* node) const
+{
+    // Node is sql_stmt: K_EXPLAIN (K_QUERY K_PLAN | K_ANALYZE)? statement
+    const bool analyze = helpers::getTerminalType(node->children.at(1)) == SiodbParser::K_ANALYZE;
+    auto request = doCreateRequest(node->children.back());
+    if (request->m_requestType != requests::DBEngineRequestType::kSelect)
+        throw std::invalid_argument("EXPLAIN is supported only for SELECT statements");
+    return std::make_unique<requests::ExplainRequest>(std::move(request), analyze);
+}
+
+requests::DBEngineRequestPtr DBEngineRequestFactory::createAnalyzeRequest(
+        antlr4::tree::ParseTree* node) const
+{
+    // Capture database ID
+    std::string database;
+    const auto databaseIdNode =
+            helpers::findTerminal(node, SiodbParser::RuleDatabase_name, SiodbParser::IDENTIFIER);
+    if (databaseIdNode) database = boost::to_upper_copy(databaseIdNode->getText());
+
+    // Capture table ID, absent table means all tables of the database
+    std::string table;
+    const auto tableIdNode =
+            helpers::findTerminal(node, SiodbParser::RuleTable_name, SiodbParser::IDENTIFIER);
+    if (tableIdNode) table = boost::to_upper_copy(tableIdNode->getText());
+
+    return std::make_unique<requests::AnalyzeRequest>(std::move(database), std::move(table));
+}
+
 requests::DBEngineRequestPtr DBEngineRequestFactory::createBeginTransactionRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture transaction type. Default one is "deferred".
     requests::TransactionType transactionType = requests::TransactionType::kDeferred;
@@ -512,7 +643,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createBeginTransactionReque
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createCommitTransactionRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture transaction ID
     std::string transaction;
@@ -524,7 +655,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createCommitTransactionRequ
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createRollbackTransactionRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture transaction ID
     std::string transaction;
@@ -543,7 +674,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createRollbackTransactionRe
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createSavepointRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture savepoint ID
     std::string savepoint;
@@ -558,7 +689,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createSavepointRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createReleaseRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture savepoint ID
     std::string savepoint;
@@ -573,7 +704,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createReleaseRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createAttachDatabaseRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database UUID
     Uuid databaseUuid;
@@ -602,7 +733,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createAttachDatabaseRequest
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDetachDatabaseRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -621,7 +752,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDetachDatabaseRequest
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateDatabaseRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Normally should never happen
     if (node->children.size() < 3)
@@ -653,7 +784,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateDatabaseRequest
         // skip comma (option ',' option ... )
         for (std::size_t i = 0; i < optionsListNode->children.size(); i += 2) {
             auto optionNode = optionsListNode->children[i];
-            ExpressionFactory exprFactory(false);
+            ExpressionFactory exprFactory(false, m_parameters);
             switch (helpers::getTerminalType(optionNode->children.at(0))) {
                 case SiodbParser::K_CIPHER_ID: {
                     cipherId = exprFactory.createExpression(optionNode->children.at(2));
@@ -674,7 +805,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateDatabaseRequest
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDropDatabaseRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -693,7 +824,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDropDatabaseRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createUseDatabaseRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -708,7 +839,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createUseDatabaseRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateTableRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -861,7 +992,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateTableRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDropTableRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -887,7 +1018,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDropTableRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createRenameTableRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -922,7 +1053,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createRenameTableRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createAddColumnRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -961,7 +1092,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createAddColumnRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDropColumnRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -996,7 +1127,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDropColumnRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateIndexRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -1052,7 +1183,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateIndexRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDropIndexRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Capture database ID
     std::string database;
@@ -1078,7 +1209,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDropIndexRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateUserRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Normally should never happen
     if (node->children.size() < 3) throw std::invalid_argument("CREATE USER request is malformed");
@@ -1120,7 +1251,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createCreateUserRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDropUserRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Normally should never happen
     if (node->children.size() < 3) throw std::invalid_argument("DROP USER request is malformed");
@@ -1131,7 +1262,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDropUserRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createAlterUserRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Normally should never happen
     if (node->children.size() < 5)
@@ -1170,7 +1301,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createAlterUserRequest(
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createAddUserAccessKeyRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Get node text as is without 'GetAnyText' call.
     auto userName = boost::to_upper_copy(node->children.at(2)->getText());
@@ -1202,7 +1333,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createAddUserAccessKeyReque
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createDropUserAccessKeyRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Get node text as is without 'GetAnyText' call.
     auto userName = boost::to_upper_copy(node->children.at(2)->getText());
@@ -1212,7 +1343,7 @@ requests::DBEngineRequestPtr DBEngineRequestFactory::createDropUserAccessKeyRequ
 }
 
 requests::DBEngineRequestPtr DBEngineRequestFactory::createAlterUserAccessKeyRequest(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     // Get node text as is without 'GetAnyText' call.
     auto userName = boost::to_upper_copy(node->children.at(2)->getText());
@@ -1244,7 +1375,7 @@ siodb::ColumnDataType DBEngineRequestFactory::getColumnDataType(const std::strin
 }
 
 requests::ResultExpression DBEngineRequestFactory::createResultExpression(
-        antlr4::tree::ParseTree* node)
+        antlr4::tree::ParseTree* node) const
 {
     requests::ConstExpressionPtr expression;
     std::string alias;
@@ -1261,7 +1392,7 @@ requests::ResultExpression DBEngineRequestFactory::createResultExpression(
     // case: expr ( K_AS? column_alias)?
     else if (childrenCount > 0
              && helpers::getNonTerminalType(node->children[0]) == SiodbParser::RuleExpr) {
-        ExpressionFactory exprFactory(true);
+        ExpressionFactory exprFactory(true, m_parameters);
         expression = exprFactory.createExpression(node->children[0]);
 
         if (childrenCount > 1
@@ -1274,9 +1405,34 @@ requests::ResultExpression DBEngineRequestFactory::createResultExpression(
     return requests::ResultExpression(std::move(expression), std::move(alias));
 }
 
+requests::OrderByExpression DBEngineRequestFactory::createOrderByExpression(
+        antlr4::tree::ParseTree* node) const
+{
+    // ordering_term: expr (K_COLLATE collation_name)? (K_ASC | K_DESC)?
+    if (node->children.empty()
+            || helpers::getNonTerminalType(node->children[0]) != SiodbParser::RuleExpr)
+        throw std::runtime_error("ORDER BY: missing expression");
+
+    bool sortDescending = false;
+    for (std::size_t i = 1; i < node->children.size(); ++i) {
+        switch (helpers::getTerminalType(node->children[i])) {
+            case SiodbParser::K_ASC: sortDescending = false; break;
+            case SiodbParser::K_DESC: sortDescending = true; break;
+            case SiodbParser::K_COLLATE: throw std::runtime_error("ORDER BY: COLLATE not supported");
+            default: break;
+        }
+    }
+
+    ExpressionFactory exprFactory(true, m_parameters);
+    return requests::OrderByExpression(
+            exprFactory.createExpression(node->children[0]), sortDescending);
+}
+
 void DBEngineRequestFactory::parseSelectCore(antlr4::tree::ParseTree* node, std::string& database,
         std::vector<requests::SourceTable>& tables,
-        std::vector<requests::ResultExpression>& columns, requests::ConstExpressionPtr& where)
+        std::vector<requests::ResultExpression>& columns, requests::ConstExpressionPtr& where,
+        std::vector<requests::ConstExpressionPtr>& groupBy, requests::ConstExpressionPtr& having,
+        requests::AsOfType& asOfType, requests::ConstExpressionPtr& asOf) const
 {
     std::size_t i = 0;
     for (; i < node->children.size(); ++i) {
@@ -1315,8 +1471,49 @@ void DBEngineRequestFactory::parseSelectCore(antlr4::tree::ParseTree* node, std:
                     if (i >= node->children.size())
                         throw std::runtime_error("SELECT: WHERE does not contain expression");
 
-                    ExpressionFactory exprFactory(true);
+                    ExpressionFactory exprFactory(true, m_parameters);
                     where = exprFactory.createExpression(node->children[i]);
+                } else if (terminalType == SiodbParser::K_GROUP) {
+                    // Skip BY
+                    i += 2;
+                    if (i >= node->children.size())
+                        throw std::runtime_error("SELECT: GROUP BY does not contain expression");
+
+                    ExpressionFactory exprFactory(true, m_parameters);
+                    groupBy.push_back(exprFactory.createExpression(node->children[i]));
+                    while (i + 2 < node->children.size()
+                            && helpers::getTerminalType(node->children[i + 1])
+                                       == SiodbParser::COMMA) {
+                        i += 2;
+                        groupBy.push_back(exprFactory.createExpression(node->children[i]));
+                    }
+                } else if (terminalType == SiodbParser::K_HAVING) {
+                    ++i;
+                    if (i >= node->children.size())
+                        throw std::runtime_error("SELECT: HAVING does not contain expression");
+
+                    ExpressionFactory exprFactory(true, m_parameters);
+                    having = exprFactory.createExpression(node->children[i]);
+                } else if (terminalType == SiodbParser::K_AS) {
+                    // Skip OF
+                    i += 2;
+                    if (i + 1 >= node->children.size())
+                        throw std::runtime_error("SELECT: AS OF does not contain expression");
+
+                    // TIMESTAMP is not a keyword, so it comes as identifier
+                    const auto historyPointKind = node->children[i];
+                    if (helpers::getTerminalType(historyPointKind) == SiodbParser::K_TRANSACTION)
+                        asOfType = requests::AsOfType::kTransaction;
+                    else if (boost::iequals(historyPointKind->getText(), "TIMESTAMP"))
+                        asOfType = requests::AsOfType::kTimestamp;
+                    else {
+                        throw std::runtime_error("SELECT: AS OF supports only TRANSACTION and "
+                                                 "TIMESTAMP");
+                    }
+
+                    ++i;
+                    ExpressionFactory exprFactory(false, m_parameters);
+                    asOf = exprFactory.createExpression(node->children[i]);
                 }
                 break;
             };
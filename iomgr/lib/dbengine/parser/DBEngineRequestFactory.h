@@ -6,6 +6,7 @@
 
 // Project headers
 #include "DBEngineRequest.h"
+#include "StatementParameters.h"
 #include "antlr_wrappers/Antlr4RuntimeWrapper.h"
 
 namespace siodb::iomgr::dbengine::parser {
@@ -16,19 +17,37 @@ public:
     /**
      * Creates database engine request from a statement.
      * @param mode A statement node.
+     * @param parameters Values bound to the statement tokens, may be nullptr.
      * @return DBE request filled with the parsed data.
      */
-    static requests::DBEngineRequestPtr createRequest(antlr4::tree::ParseTree* node);
+    static requests::DBEngineRequestPtr createRequest(
+            antlr4::tree::ParseTree* node, const StatementParameters* parameters = nullptr);
 
 private:
+    /**
+     * Initializes object of class DBEngineRequestFactory.
+     * @param parameters Values bound to the statement tokens, may be nullptr.
+     */
+    explicit DBEngineRequestFactory(const StatementParameters* parameters) noexcept
+        : m_parameters(parameters)
+    {
+    }
+
+    /**
+     * Creates database engine request from a statement.
+     * @param mode A statement node.
+     * @return DBE request filled with the parsed data.
+     */
+    requests::DBEngineRequestPtr doCreateRequest(antlr4::tree::ParseTree* node) const;
+
     /**
      * Creates a SELECT request.
      * @param node Parse tree node with SQL statement.
      * @param tag Tag idicating general form of SELECT statement.
      * @return SELECT request.
      */
-    static requests::DBEngineRequestPtr createSelectRequestForGeneralSelectStatement(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createSelectRequestForGeneralSelectStatement(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a SELECT request.
@@ -36,8 +55,8 @@ private:
      * @param tag Tag idicating simple form of SELECT statement.
      * @return SELECT request.
      */
-    static requests::DBEngineRequestPtr createSelectRequestForSimpleSelectStatement(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createSelectRequestForSimpleSelectStatement(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a SELECT request.
@@ -45,210 +64,233 @@ private:
      * @param tag Tag idicating factored form of SELECT statement.
      * @return SELECT request.
      */
-    static requests::DBEngineRequestPtr createSelectRequestForFactoredSelectStatement(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createSelectRequestForFactoredSelectStatement(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an INSERT request.
      * @param node Parse tree node with SQL statement.
      * @return INSERT request.
      */
-    static requests::DBEngineRequestPtr createInsertRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createInsertRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an UPDATE request.
      * @param node Parse tree node with SQL statement.
      * @return UPDATE request.
      */
-    static requests::DBEngineRequestPtr createUpdateRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createUpdateRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a DELETE request.
      * @param node Parse tree node with SQL statement.
      * @return DELETE request.
      */
-    static requests::DBEngineRequestPtr createDeleteRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDeleteRequest(antlr4::tree::ParseTree* node) const;
+
+    /**
+     * Creates a COPY FROM or COPY TO request.
+     * @param node Parse tree node with SQL statement.
+     * @param copyTo Indication that statement is COPY TO.
+     * @return COPY FROM or COPY TO request.
+     */
+    requests::DBEngineRequestPtr createCopyRequest(
+            antlr4::tree::ParseTree* node, bool copyTo) const;
+
+    /**
+     * Creates an EXPLAIN request.
+     * @param node Parse tree node with SQL statement prefixed by EXPLAIN.
+     * @return EXPLAIN request.
+     */
+    requests::DBEngineRequestPtr createExplainRequest(antlr4::tree::ParseTree* node) const;
+
+    /**
+     * Creates an ANALYZE request.
+     * @param node Parse tree node with SQL statement.
+     * @return ANALYZE request.
+     */
+    requests::DBEngineRequestPtr createAnalyzeRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a BEGIN TRANSACTION request.
      * @param node Parse tree node with SQL statement.
      * @return BEGIN TRANSACTION request.
      */
-    static requests::DBEngineRequestPtr createBeginTransactionRequest(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createBeginTransactionRequest(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a COMMIT TRANSACTION request.
      * @param node Parse tree node with SQL statement.
      * @return COMMIT TRANSACTION request.
      */
-    static requests::DBEngineRequestPtr createCommitTransactionRequest(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createCommitTransactionRequest(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a ROLLBACK TRANSACTION request.
      * @param node Parse tree node with SQL statement.
      * @return ROLLBACK TRANSACTION request.
      */
-    static requests::DBEngineRequestPtr createRollbackTransactionRequest(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createRollbackTransactionRequest(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a SAVEPOINT request.
      * @param node Parse tree node with SQL statement.
      * @return SAVEPOINT request.
      */
-    static requests::DBEngineRequestPtr createSavepointRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createSavepointRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a RELEASE request.
      * @param node Parse tree node with SQL statement.
      * @return RELEASE request.
      */
-    static requests::DBEngineRequestPtr createReleaseRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createReleaseRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an ATTACH DATABASE request.
      * @param node Parse tree node with SQL statement.
      * @return ATTACH DATABASE request.
      */
-    static requests::DBEngineRequestPtr createAttachDatabaseRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAttachDatabaseRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a DETACH DATABASE request.
      * @param node Parse tree node with SQL statement.
      * @return DETACH DATABASE request.
      */
-    static requests::DBEngineRequestPtr createDetachDatabaseRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDetachDatabaseRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a CREATE DATABASE request.
      * @param node Parse tree node with SQL statement.
      * @return CREATE DATABASE request.
      */
-    static requests::DBEngineRequestPtr createCreateDatabaseRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createCreateDatabaseRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a DROP DATABASE request.
      * @param node Parse tree node with SQL statement.
      * @return DROP DATABASE request.
      */
-    static requests::DBEngineRequestPtr createDropDatabaseRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDropDatabaseRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a USE DATABASE request.
      * @param node Parse tree node with SQL statement.
      * @return USE DATABASE request.
      */
-    static requests::DBEngineRequestPtr createUseDatabaseRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createUseDatabaseRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a CREATE TABLE request.
      * @param node Parse tree node with SQL statement.
      * @return CREATE TABLE request.
      */
-    static requests::DBEngineRequestPtr createCreateTableRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createCreateTableRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a DROP TABLE request.
      * @param node Parse tree node with SQL statement.
      * @return DROP TABLE request.
      */
-    static requests::DBEngineRequestPtr createDropTableRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDropTableRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a ALTER TABLE request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER TABLE request.
      */
-    static requests::DBEngineRequestPtr createAlterTableRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAlterTableRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a CREATE INDEX request.
      * @param node Parse tree node with SQL statement.
      * @return CREATE INDEX request.
      */
-    static requests::DBEngineRequestPtr createCreateIndexRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createCreateIndexRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a DROP INDEX request.
      * @param node Parse tree node with SQL statement.
      * @return DROP INDEX request.
      */
-    static requests::DBEngineRequestPtr createDropIndexRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDropIndexRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a ALTER TABLE ADD COLUMN request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER TABLE ADD COLUMN request.
      */
-    static requests::DBEngineRequestPtr createAddColumnRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAddColumnRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a ALTER TABLE DROP COLUMN request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER TABLE DROP COLUMN request.
      */
-    static requests::DBEngineRequestPtr createDropColumnRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDropColumnRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a ALTER TABLE ALTER COLUMN request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER TABLE ALTER COLUMN request.
      */
-    static requests::DBEngineRequestPtr createAlterColumnRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAlterColumnRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a ALTER TABLE RENAME request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER TABLE RENAME request.
      */
-    static requests::DBEngineRequestPtr createRenameTableRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createRenameTableRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a CREATE USER request.
      * @param node Parse tree node with SQL statement.
      * @return CREATE USER request.
      */
-    static requests::DBEngineRequestPtr createCreateUserRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createCreateUserRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates a DROP USER request.
      * @param node Parse tree node with SQL statement.
      * @return DROP USER request.
      */
-    static requests::DBEngineRequestPtr createDropUserRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDropUserRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an ALTER USER SET OPTIONS_LIST request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER USER SET OPTIONS_LIST request.
      */
-    static requests::DBEngineRequestPtr createAlterUserRequest(antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAlterUserRequest(antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an ALTER USER ADD ACCESS KEY request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER USER ADD ACCESS KEY request.
      */
-    static requests::DBEngineRequestPtr createAddUserAccessKeyRequest(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAddUserAccessKeyRequest(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an ALTER USER DROP ACCESS KEY request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER USER DROP ACCESS KEY request.
      */
-    static requests::DBEngineRequestPtr createDropUserAccessKeyRequest(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createDropUserAccessKeyRequest(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Creates an ALTER USER ALTER ACCESS KEY SET OPTIONS_LIST request.
      * @param node Parse tree node with SQL statement.
      * @return ALTER USER ALTER ACCESS KEY SET OPTIONS_LIST request.
      */
-    static requests::DBEngineRequestPtr createAlterUserAccessKeyRequest(
-            antlr4::tree::ParseTree* node);
+    requests::DBEngineRequestPtr createAlterUserAccessKeyRequest(
+            antlr4::tree::ParseTree* node) const;
 
     /**
      * Parses SelectCore.
@@ -257,10 +299,25 @@ private:
      * @param[out] tables List of tables.
      * @param[out] columns List of columns.
      * @param[out] where WHERE condition.
+     * @param[out] groupBy GROUP BY expressions.
+     * @param[out] having HAVING condition.
+     * @param[out] asOfType Kind of the history point in the AS OF clause.
+     * @param[out] asOf History point in the AS OF clause.
+     * @throw std::runtime_error if AS OF clause is malformed.
      */
-    static void parseSelectCore(antlr4::tree::ParseTree* node, std::string& database,
+    void parseSelectCore(antlr4::tree::ParseTree* node, std::string& database,
             std::vector<requests::SourceTable>& tables,
-            std::vector<requests::ResultExpression>& columns, requests::ConstExpressionPtr& where);
+            std::vector<requests::ResultExpression>& columns, requests::ConstExpressionPtr& where,
+            std::vector<requests::ConstExpressionPtr>& groupBy, requests::ConstExpressionPtr& having,
+            requests::AsOfType& asOfType, requests::ConstExpressionPtr& asOf) const;
+
+    /**
+     * Creates an ORDER BY element from the ordering_term node.
+     * @param node Parse tree node with ordering_term statement.
+     * @return ORDER BY element.
+     * @throw std::runtime_error if ordering term is malformed.
+     */
+    requests::OrderByExpression createOrderByExpression(antlr4::tree::ParseTree* node) const;
 
     /**
      * Converts given type name into Siodb column data type.
@@ -275,9 +332,12 @@ private:
      * @param node Parse tree node with result_column statement.
      * @return requests::ResultExpression object.
      */
-    static requests::ResultExpression createResultExpression(antlr4::tree::ParseTree* node);
+    requests::ResultExpression createResultExpression(antlr4::tree::ParseTree* node) const;
 
 private:
+    /** Values bound to the statement tokens */
+    const StatementParameters* const m_parameters;
+
     /** Siodb data type map. */
     static const std::unordered_map<std::string, siodb::ColumnDataType> m_siodbDataTypeMap;
 };
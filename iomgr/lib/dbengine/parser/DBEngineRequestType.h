@@ -38,6 +38,11 @@ enum class DBEngineRequestType {
     kDropUserAccessKey,
     kAlterUserAccessKey,
     kShowDatabases,
+    kCopyFrom,
+    kCopyTo,
+    kShowStatementCache,
+    kExplain,
+    kAnalyze,
 };
 
 }  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,31 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "GroupContext.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+const std::vector<Variant>& GroupContext::getTableRow(std::size_t tableIndex) const
+{
+    if (!m_rowValues) throw std::runtime_error("Current group is not set");
+    return m_rowValues->at(tableIndex);
+}
+
+const Variant& GroupContext::getColumnValue(std::size_t tableIndex, std::size_t columnIndex)
+{
+    return getTableRow(tableIndex).at(columnIndex);
+}
+
+ColumnDataType GroupContext::getColumnDataType(
+        std::size_t tableIndex, std::size_t columnIndex) const
+{
+    return m_databaseContext.getColumnDataType(tableIndex, columnIndex);
+}
+
+const Variant& GroupContext::getAggregateValue(std::size_t aggregateIndex)
+{
+    return m_aggregateValues.at(aggregateIndex);
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,89 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "DatabaseContext.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+/**
+ * Context used for expression evaluation on the groups of rows.
+ * Column values are taken from the first row of the current group,
+ * aggregate function values are computed for the whole group.
+ */
+class GroupContext final : public Expression::Context {
+public:
+    /**
+     * Initializes object of class GroupContext
+     * @param databaseContext Database context, which provides column data types.
+     */
+    explicit GroupContext(const DatabaseContext& databaseContext) noexcept
+        : m_databaseContext(databaseContext)
+        , m_rowValues(nullptr)
+    {
+    }
+
+    /**
+     * Sets current group.
+     * @param rowValues Values of the first row of the group, per data set.
+     * @param aggregateValues Aggregate function values of the group.
+     */
+    void setCurrentGroup(const std::vector<std::vector<Variant>>& rowValues,
+            std::vector<Variant>&& aggregateValues) noexcept
+    {
+        m_rowValues = &rowValues;
+        m_aggregateValues = std::move(aggregateValues);
+    }
+
+    /**
+     * Returns values of the first row of the current group for the data set.
+     * @param tableIndex Table index.
+     * @return Row values.
+     * @throw std::out_of_range if table index is greater than or equal to number of tables.
+     * @throw std::runtime_error if current group is not set.
+     */
+    const std::vector<Variant>& getTableRow(std::size_t tableIndex) const;
+
+    /**
+     * Returns column value from the first row of the current group.
+     * @param tableIndex Table index.
+     * @param columnIndex Column index.
+     * @return Value of the specified column.
+     * @throw std::out_of_range if table or column index is greater than or equal
+     * to actual number of tables or columns
+     * @throw std::runtime_error if current group is not set.
+     */
+    const Variant& getColumnValue(std::size_t tableIndex, std::size_t columnIndex) override;
+
+    /**
+     * Returns column data type
+     * @param tableIndex Table index.
+     * @param columnIndex Column index.
+     * @return Column data type.
+     */
+    ColumnDataType getColumnDataType(
+            std::size_t tableIndex, std::size_t columnIndex) const override;
+
+    /**
+     * Returns value of the aggregate function for the current group.
+     * @param aggregateIndex Aggregate function index.
+     * @return Value of the aggregate function.
+     * @throw std::out_of_range if aggregate index is invalid.
+     */
+    const Variant& getAggregateValue(std::size_t aggregateIndex) override;
+
+private:
+    /** Database context */
+    const DatabaseContext& m_databaseContext;
+
+    /** Values of the first row of the current group */
+    const std::vector<std::vector<Variant>>* m_rowValues;
+
+    /** Aggregate function values of the current group */
+    std::vector<Variant> m_aggregateValues;
+};
+
+}  // namespace siodb::iomgr::dbengine::requests
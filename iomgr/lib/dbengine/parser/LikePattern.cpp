@@ -0,0 +1,197 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "LikePattern.h"
+
+// STL headers
+#include <algorithm>
+#include <cstring>
+
+// utf8cpp headers
+#include <utf8cpp/utf8.h>
+
+namespace siodb::iomgr::dbengine::requests {
+
+namespace {
+
+/**
+ * Returns indication that byte is UTF-8 continuation byte.
+ * @param c A byte.
+ * @return true if byte is continuation byte, false otherwise.
+ */
+inline bool isUtf8ContinuationByte(char c) noexcept
+{
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+/**
+ * Returns length of the UTF-8 character by its leading byte.
+ * @param c Leading byte.
+ * @return Character length in bytes.
+ */
+inline std::size_t getUtf8CharLength(char c) noexcept
+{
+    const auto b = static_cast<unsigned char>(c);
+    if ((b & 0xE0) == 0xC0) return 2;
+    if ((b & 0xF0) == 0xE0) return 3;
+    if ((b & 0xF8) == 0xF0) return 4;
+    return 1;
+}
+
+}  // anonymous namespace
+
+LikePattern::LikePattern(const std::string& pattern)
+    : m_anchoredStart(pattern.empty() || pattern.front() != kAnyCharSeq)
+    , m_anchoredEnd(pattern.empty() || pattern.back() != kAnyCharSeq)
+{
+    bool hasAnyCharSeq = false;
+    std::size_t pos = 0;
+    while (true) {
+        const auto nextPos = pattern.find(kAnyCharSeq, pos);
+        const auto endPos = (nextPos == std::string::npos) ? pattern.length() : nextPos;
+        // Empty segments are dropped, except for the pattern without '%'
+        if (endPos > pos || (nextPos == std::string::npos && !hasAnyCharSeq)) {
+            auto& segment = m_segments.emplace_back();
+            segment.m_text = pattern.substr(pos, endPos - pos);
+            segment.m_charCount = std::count_if(segment.m_text.cbegin(), segment.m_text.cend(),
+                    [](char c) noexcept { return !isUtf8ContinuationByte(c); });
+            segment.m_hasAnyChar = segment.m_text.find(kAnyChar) != std::string::npos;
+        }
+        if (nextPos == std::string::npos) break;
+        hasAnyCharSeq = true;
+        pos = nextPos + 1;
+    }
+
+    if (!hasAnyCharSeq)
+        m_kind = m_segments.front().m_hasAnyChar ? Kind::kGeneric : Kind::kExact;
+    else if (m_segments.empty())
+        m_kind = Kind::kMatchAll;
+    else if (m_segments.size() == 1 && !m_segments.front().m_hasAnyChar) {
+        // Single segment with '%' can't be anchored at both ends
+        if (m_anchoredStart)
+            m_kind = Kind::kPrefix;
+        else if (m_anchoredEnd)
+            m_kind = Kind::kSuffix;
+        else
+            m_kind = Kind::kSubstring;
+    } else
+        m_kind = Kind::kGeneric;
+}
+
+bool LikePattern::match(const std::string& str) const
+{
+    switch (m_kind) {
+        case Kind::kMatchAll: return true;
+        case Kind::kExact: return str == m_segments.front().m_text;
+        case Kind::kPrefix: {
+            const auto& text = m_segments.front().m_text;
+            return str.length() >= text.length()
+                   && std::memcmp(str.data(), text.data(), text.length()) == 0;
+        }
+        case Kind::kSuffix: {
+            const auto& text = m_segments.front().m_text;
+            return str.length() >= text.length()
+                   && std::memcmp(str.data() + (str.length() - text.length()), text.data(),
+                              text.length())
+                              == 0;
+        }
+        case Kind::kSubstring: {
+            // Valid UTF-8 needle can be found only at the character boundary
+            const auto& text = m_segments.front().m_text;
+            return ::memmem(str.data(), str.length(), text.data(), text.length()) != nullptr;
+        }
+        default: return matchGeneric(str.data(), str.data() + str.length());
+    }
+}
+
+// ----- internals -----
+
+bool LikePattern::matchGeneric(const char* str, const char* strEnd) const
+{
+    std::size_t first = 0, last = m_segments.size();
+
+    if (m_anchoredStart) {
+        if (!matchSegmentAt(str, strEnd, m_segments.front())) return false;
+        // Pattern without '%' must match whole string
+        if (last == 1 && m_anchoredEnd) return str == strEnd;
+        ++first;
+    }
+
+    if (m_anchoredEnd && first < last) {
+        // Segment has fixed number of characters, so its position is known
+        const auto& segment = m_segments[--last];
+        auto tailStart = strEnd;
+        for (std::size_t i = 0; i < segment.m_charCount; ++i) {
+            if (tailStart == str) return false;
+            do {
+                --tailStart;
+            } while (tailStart != str && isUtf8ContinuationByte(*tailStart));
+        }
+        auto tailEnd = tailStart;
+        if (!matchSegmentAt(tailEnd, strEnd, segment) || tailEnd != strEnd) return false;
+        strEnd = tailStart;
+    }
+
+    // Leftmost occurrence of the each segment leaves the most room for the next segments
+    for (; first != last; ++first) {
+        if (!findSegment(str, strEnd, m_segments[first])) return false;
+    }
+
+    return true;
+}
+
+bool LikePattern::matchSegmentAt(const char*& str, const char* strEnd, const Segment& segment)
+{
+    const auto& text = segment.m_text;
+    if (!segment.m_hasAnyChar) {
+        if (static_cast<std::size_t>(strEnd - str) < text.length()
+                || std::memcmp(str, text.data(), text.length()) != 0)
+            return false;
+        str += text.length();
+        return true;
+    }
+
+    auto s = str;
+    auto p = text.data();
+    const auto patternEnd = p + text.length();
+    while (p != patternEnd) {
+        if (s == strEnd) return false;
+        if (*p == kAnyChar) {
+            utf8::next(s, strEnd);
+            ++p;
+            continue;
+        }
+        const auto charLength = std::min<std::size_t>(getUtf8CharLength(*p), patternEnd - p);
+        if (static_cast<std::size_t>(strEnd - s) < charLength
+                || std::memcmp(s, p, charLength) != 0)
+            return false;
+        s += charLength;
+        p += charLength;
+    }
+    str = s;
+    return true;
+}
+
+bool LikePattern::findSegment(const char*& str, const char* strEnd, const Segment& segment)
+{
+    const auto& text = segment.m_text;
+    if (!segment.m_hasAnyChar) {
+        const auto found = static_cast<const char*>(
+                ::memmem(str, strEnd - str, text.data(), text.length()));
+        if (!found) return false;
+        str = found + text.length();
+        return true;
+    }
+
+    for (auto s = str; s != strEnd; utf8::next(s, strEnd)) {
+        auto matchEnd = s;
+        if (matchSegmentAt(matchEnd, strEnd, segment)) {
+            str = matchEnd;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,126 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// STL headers
+#include <string>
+#include <vector>
+
+namespace siodb::iomgr::dbengine::requests {
+
+/**
+ * Compiled LIKE pattern. Pattern is split by the '%' wildcards into segments,
+ * which are matched from left to right, each at the leftmost possible position.
+ * Frequent pattern shapes are matched with the plain byte comparisons.
+ * Pattern and matched strings are expected to be UTF-8 strings.
+ */
+class LikePattern final {
+public:
+    /** Pattern kind */
+    enum class Kind {
+        /** Any string matches, pattern is '%' */
+        kMatchAll,
+
+        /** Pattern has no wildcards, 'abc' */
+        kExact,
+
+        /** Pattern is prefix, 'abc%' */
+        kPrefix,
+
+        /** Pattern is suffix, '%abc' */
+        kSuffix,
+
+        /** Pattern is substring, '%abc%' */
+        kSubstring,
+
+        /** Any other pattern */
+        kGeneric,
+    };
+
+public:
+    /**
+     * Initializes object of class LikePattern.
+     * @param pattern Pattern text.
+     */
+    explicit LikePattern(const std::string& pattern);
+
+    /**
+     * Returns pattern kind.
+     * @return Pattern kind.
+     */
+    Kind getKind() const noexcept
+    {
+        return m_kind;
+    }
+
+    /**
+     * Matches string to the pattern.
+     * @param str A string to match.
+     * @return true if a string matches the pattern, false otherwise.
+     * @throw utf8::exception if string is not valid UTF-8 string.
+     */
+    bool match(const std::string& str) const;
+
+private:
+    /** Part of the pattern between the '%' wildcards */
+    struct Segment {
+        /** Segment text */
+        std::string m_text;
+
+        /** Number of characters in the segment */
+        std::size_t m_charCount;
+
+        /** Indication that segment contains the '_' wildcard */
+        bool m_hasAnyChar;
+    };
+
+private:
+    /**
+     * Matches the generic pattern.
+     * @param str String start.
+     * @param strEnd String end.
+     * @return true if a string matches the pattern, false otherwise.
+     */
+    bool matchGeneric(const char* str, const char* strEnd) const;
+
+    /**
+     * Matches segment exactly at the given position.
+     * @param str String position, advanced past the matched part on success.
+     * @param strEnd String end.
+     * @param segment Segment.
+     * @return true if segment matches, false otherwise.
+     */
+    static bool matchSegmentAt(const char*& str, const char* strEnd, const Segment& segment);
+
+    /**
+     * Finds leftmost occurrence of the segment.
+     * @param str Search start, advanced past the found occurrence on success.
+     * @param strEnd Search end.
+     * @param segment Segment.
+     * @return true if segment is found, false otherwise.
+     */
+    static bool findSegment(const char*& str, const char* strEnd, const Segment& segment);
+
+private:
+    /** Segments in the pattern order */
+    std::vector<Segment> m_segments;
+
+    /** Indication that pattern doesn't start with '%' */
+    bool m_anchoredStart;
+
+    /** Indication that pattern doesn't end with '%' */
+    bool m_anchoredEnd;
+
+    /** Pattern kind */
+    Kind m_kind;
+
+    /** Any single character wildcard */
+    static constexpr char kAnyChar = '_';
+
+    /** Any character sequence wildcard */
+    static constexpr char kAnyCharSeq = '%';
+};
+
+}  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,105 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "PreparedStatement.h"
+
+// Project headers
+#include "AntlrHelpers.h"
+#include "DBEngineRequestFactory.h"
+#include "StatementParameters.h"
+
+// STL headers
+#include <algorithm>
+
+namespace siodb::iomgr::dbengine::parser {
+
+PreparedStatement::PreparedStatement(std::string&& text, ParameterKind parameterKind)
+    : m_text(std::move(text))
+    , m_parser(m_text)
+    , m_statement(nullptr)
+    , m_parameterCount(0)
+{
+    m_parser.parse();
+    if (m_parser.getStatementCount() != 1)
+        throw std::invalid_argument("Prepared statement must contain exactly one statement");
+    m_statement = m_parser.findStatement(0);
+
+    if (parameterKind == ParameterKind::kLiteral) {
+        collectLiterals(m_statement);
+        return;
+    }
+
+    std::unordered_map<std::string, std::size_t> namedParameters;
+    collectBindParameters(m_statement, namedParameters);
+
+    // Grammar allows parameters only where expressions are, so there is nothing
+    // to check about them until values are known. Any placeholder value, like NULL,
+    // could be rejected by the checks done when request is created, for example in LIMIT.
+    // So statement without parameters is checked now, and with parameters at execution.
+    if (m_parameterCount == 0) createRequest(std::vector<Variant>());
+}
+
+requests::DBEngineRequestPtr PreparedStatement::createRequest(
+        const std::vector<Variant>& values, bool& allValuesUsed) const
+{
+    if (values.size() != m_parameterCount) {
+        throw std::invalid_argument("Expected " + std::to_string(m_parameterCount)
+                                    + " parameter values, but got "
+                                    + std::to_string(values.size()));
+    }
+    StatementParameters parameters;
+    for (const auto& parameter : m_parameters)
+        parameters.bind(parameter.first->getTokenIndex(), Variant(values[parameter.second]));
+    auto request = DBEngineRequestFactory::createRequest(m_statement, &parameters);
+    allValuesUsed = parameters.isAllUsed();
+    return request;
+}
+
+// ----- internals -----
+
+void PreparedStatement::collectBindParameters(antlr4::tree::ParseTree* node,
+        std::unordered_map<std::string, std::size_t>& namedParameters)
+{
+    if (helpers::getTerminalType(node) == SiodbParser::BIND_PARAMETER) {
+        const auto token = static_cast<antlr4::tree::TerminalNode*>(node)->getSymbol();
+        const auto name = token->getText();
+        std::size_t number;
+        if (name == "?")
+            number = m_parameterCount;
+        else if (name[0] == '?') {
+            const auto n = std::stoul(name.substr(1));
+            if (n < 1 || n > kMaxParameterNumber)
+                throw std::invalid_argument("Invalid parameter number: " + name);
+            number = n - 1;
+        } else {
+            const auto it = namedParameters.emplace(name, m_parameterCount).first;
+            number = it->second;
+        }
+        m_parameters.emplace_back(token, number);
+        m_parameterCount = std::max(m_parameterCount, number + 1);
+        return;
+    }
+
+    for (const auto child : node->children)
+        collectBindParameters(child, namedParameters);
+}
+
+void PreparedStatement::collectLiterals(antlr4::tree::ParseTree* node)
+{
+    switch (helpers::getTerminalType(node)) {
+        case SiodbParser::NUMERIC_LITERAL:
+        case SiodbParser::STRING_LITERAL:
+        case SiodbParser::BLOB_LITERAL: {
+            const auto token = static_cast<antlr4::tree::TerminalNode*>(node)->getSymbol();
+            m_parameters.emplace_back(token, m_parameterCount++);
+            return;
+        }
+        default: break;
+    }
+
+    for (const auto child : node->children)
+        collectLiterals(child);
+}
+
+}  // namespace siodb::iomgr::dbengine::parser
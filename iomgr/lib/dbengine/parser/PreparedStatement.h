@@ -0,0 +1,149 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "DBEngineRequest.h"
+#include "SqlParser.h"
+#include "../Variant.h"
+
+// STL headers
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace siodb::iomgr::dbengine::parser {
+
+/**
+ * Parsed SQL statement with bind parameters. Statement text is parsed once,
+ * and requests are created from the same parse tree with the values bound
+ * to the parameters at each execution.
+ * Parameters are numbered like in SQLite: "?" takes next number after the largest
+ * assigned one, "?N" takes number N, named parameters ":name", "@name", "$name"
+ * take same number for the same name.
+ * Alternatively, literals of the statement may be used as parameters, numbered
+ * in the order they appear in the text.
+ */
+class PreparedStatement final {
+public:
+    /** Kind of tokens used as parameters */
+    enum class ParameterKind {
+        /** Bind parameters */
+        kBindParameter,
+
+        /** Numeric, string and binary literals */
+        kLiteral,
+    };
+
+public:
+    /**
+     * Initializes object of class PreparedStatement.
+     * @param text Statement text.
+     * @param parameterKind Kind of tokens used as parameters.
+     * Statement with parameters is checked for other errors when it is executed.
+     * @throw std::runtime_error if statement has syntax error.
+     * @throw std::invalid_argument if text doesn't contain exactly one statement
+     *                              or parameter is invalid.
+     */
+    explicit PreparedStatement(
+            std::string&& text, ParameterKind parameterKind = ParameterKind::kBindParameter);
+
+    DECLARE_NONCOPYABLE(PreparedStatement);
+
+    /**
+     * Returns statement text.
+     * @return Statement text.
+     */
+    const std::string& getText() const noexcept
+    {
+        return m_text;
+    }
+
+    /**
+     * Returns statement node.
+     * @return Statement node.
+     */
+    antlr4::tree::ParseTree* getStatement() const noexcept
+    {
+        return m_statement;
+    }
+
+    /**
+     * Returns parameter tokens and zero-based parameter numbers in the text order.
+     * @return Parameter tokens and numbers.
+     */
+    const auto& getParameters() const noexcept
+    {
+        return m_parameters;
+    }
+
+    /**
+     * Returns number of parameters.
+     * @return Number of parameters.
+     */
+    std::size_t getParameterCount() const noexcept
+    {
+        return m_parameterCount;
+    }
+
+    /**
+     * Creates database engine request with the given parameter values.
+     * @param values Parameter values in the parameter number order.
+     * @return DBE request filled with the parsed data and parameter values.
+     * @throw std::invalid_argument if number of values doesn't match number of parameters.
+     */
+    requests::DBEngineRequestPtr createRequest(const std::vector<Variant>& values) const
+    {
+        bool allValuesUsed = false;
+        return createRequest(values, allValuesUsed);
+    }
+
+    /**
+     * Creates database engine request with the given parameter values.
+     * @param values Parameter values in the parameter number order.
+     * @param[out] allValuesUsed Indication that all parameter values were used
+     *                           when request was created.
+     * @return DBE request filled with the parsed data and parameter values.
+     * @throw std::invalid_argument if number of values doesn't match number of parameters.
+     */
+    requests::DBEngineRequestPtr createRequest(
+            const std::vector<Variant>& values, bool& allValuesUsed) const;
+
+private:
+    /**
+     * Finds bind parameters in the parse tree and assigns numbers to them.
+     * @param node Parse tree node.
+     * @param[in,out] namedParameters Numbers of the named parameters.
+     */
+    void collectBindParameters(antlr4::tree::ParseTree* node,
+            std::unordered_map<std::string, std::size_t>& namedParameters);
+
+    /**
+     * Finds literals in the parse tree and assigns numbers to them.
+     * @param node Parse tree node.
+     */
+    void collectLiterals(antlr4::tree::ParseTree* node);
+
+private:
+    /** Statement text. Must be declared before parser, which refers to it. */
+    const std::string m_text;
+
+    /** Parser that owns the parse tree */
+    SqlParser m_parser;
+
+    /** Statement node */
+    antlr4::tree::ParseTree* m_statement;
+
+    /** Parameter tokens and zero-based parameter numbers */
+    std::vector<std::pair<const antlr4::Token*, std::size_t>> m_parameters;
+
+    /** Number of parameters */
+    std::size_t m_parameterCount;
+
+    /** Maximum parameter number */
+    static constexpr std::size_t kMaxParameterNumber = 32766;
+};
+
+}  // namespace siodb::iomgr::dbengine::parser
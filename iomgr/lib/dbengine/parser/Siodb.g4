@@ -38,7 +38,7 @@ error:
 
 sql_stmt_list: ';'* sql_stmt ( ';'+ sql_stmt)* ';'*;
 
-sql_stmt: (K_EXPLAIN ( K_QUERY K_PLAN)?)? (
+sql_stmt: (K_EXPLAIN ( K_QUERY K_PLAN | K_ANALYZE)?)? (
 		alter_table_stmt
 		| alter_user_stmt
 		| analyze_stmt
@@ -46,6 +46,8 @@ sql_stmt: (K_EXPLAIN ( K_QUERY K_PLAN)?)? (
 		| begin_stmt
 		| commit_stmt
 		| compound_select_stmt
+		| copy_from_stmt
+		| copy_to_stmt
 		| create_database_stmt
 		| create_index_stmt
 		| create_table_stmt
@@ -72,6 +74,7 @@ sql_stmt: (K_EXPLAIN ( K_QUERY K_PLAN)?)? (
 		| simple_select_stmt
 		| select_stmt
 		| show_databases_stmt
+		| show_statement_cache_stmt
 		| update_stmt
 		| update_stmt_limited
 		| use_database_stmt
@@ -93,12 +96,7 @@ alter_user_stmt:
 		| K_ALTER K_ACCESS K_KEY user_access_key_name K_SET user_access_key_option_list
 	);
 
-analyze_stmt:
-	K_ANALYZE (
-		database_name
-		| table_or_index_name
-		| database_name '.' table_or_index_name
-	)?;
+analyze_stmt: K_ANALYZE ((database_name '.')? table_name)?;
 
 attach_stmt: K_ATTACH K_DATABASE? expr K_AS database_name;
 
@@ -119,6 +117,23 @@ compound_select_stmt: (
 		K_LIMIT simple_expr ( ( K_OFFSET | ',') simple_expr)?
 	)?;
 
+copy_from_stmt:
+	K_COPY (database_name '.')? table_name (
+		'(' column_name (',' column_name)* ')'
+	)? K_FROM STRING_LITERAL (K_WITH copy_option_list)?;
+
+copy_to_stmt:
+	K_COPY (database_name '.')? table_name (
+		'(' column_name (',' column_name)* ')'
+	)? K_TO STRING_LITERAL (K_WITH copy_option_list)?;
+
+copy_option:
+	K_FORMAT '=' STRING_LITERAL
+	| K_DELIMITER '=' STRING_LITERAL
+	| K_HEADER;
+
+copy_option_list: copy_option (',' copy_option)*;
+
 create_database_option:
 	K_CIPHER_ID '=' simple_expr
 	| K_CIPHER_KEY_SEED '=' simple_expr;
@@ -285,7 +300,7 @@ select_or_values:
 			table_or_subquery (',' table_or_subquery)*
 			| join_clause
 		)
-	)? (K_WHERE expr)? (
+	)? (K_AS K_OF (K_TRANSACTION | IDENTIFIER) expr)? (K_WHERE expr)? (
 		K_GROUP K_BY expr (',' expr)* (K_HAVING expr)?
 	)?
 	| K_VALUES '(' expr (',' expr)* ')' (
@@ -295,6 +310,8 @@ select_or_values:
 
 show_databases_stmt: K_SHOW K_DATABASES;
 
+show_statement_cache_stmt: K_SHOW K_STATEMENT K_CACHE;
+
 update_stmt:
 	with_clause? K_UPDATE (
 		K_OR K_ROLLBACK
@@ -412,15 +429,15 @@ simple_expr:
 	| K_CASE simple_expr? (K_WHEN simple_expr K_THEN simple_expr)+ (
 		K_ELSE simple_expr
 	)? K_END
-	| raise_function;
+	| raise_function
+	| function_call;
 
 expr:
 	K_NOT expr
 	| expr K_AND expr
 	| expr K_OR expr
 	| '(' expr ')'
-	| simple_expr
-	| function_call;
+	| simple_expr;
 
 foreign_key_clause:
 	K_REFERENCES foreign_table (
@@ -513,7 +530,7 @@ select_core:
 			table_or_subquery (',' table_or_subquery)*
 			| join_clause
 		)
-	)? (K_WHERE expr)? (
+	)? (K_AS K_OF (K_TRANSACTION | IDENTIFIER) expr)? (K_WHERE expr)? (
 		K_GROUP K_BY expr (',' expr)* (K_HAVING expr)?
 	)?
 	| K_VALUES '(' expr (',' expr)* ')' (
@@ -569,6 +586,7 @@ keyword:
 	| K_BEGIN
 	| K_BETWEEN
 	| K_BY
+	| K_CACHE
 	| K_CASCADE
 	| K_CASE
 	| K_CAST
@@ -580,6 +598,7 @@ keyword:
 	| K_COMMIT
 	| K_CONFLICT
 	| K_CONSTRAINT
+	| K_COPY
 	| K_CREATE
 	| K_CROSS
 	| K_CURRENT_DATE
@@ -591,6 +610,7 @@ keyword:
 	| K_DEFERRABLE
 	| K_DEFERRED
 	| K_DELETE
+	| K_DELIMITER
 	| K_DESC
 	| K_DETACH
 	| K_DISTINCT
@@ -607,12 +627,14 @@ keyword:
 	| K_FALSE
 	| K_FOR
 	| K_FOREIGN
+	| K_FORMAT
 	| K_FROM
 	| K_FULL
 	| K_REAL_NAME
 	| K_GLOB
 	| K_GROUP
 	| K_HAVING
+	| K_HEADER
 	| K_IF
 	| K_IGNORE
 	| K_IMMEDIATE
@@ -665,6 +687,7 @@ keyword:
 	| K_SELECT
 	| K_SET
 	| K_STATE
+	| K_STATEMENT
 	| K_TABLE
 	| K_TEMP
 	| K_TEMPORARY
@@ -777,6 +800,7 @@ K_BEFORE: B E F O R E;
 K_BEGIN: B E G I N;
 K_BETWEEN: B E T W E E N;
 K_BY: B Y;
+K_CACHE: C A C H E;
 K_CASCADE: C A S C A D E;
 K_CASE: C A S E;
 K_CAST: C A S T;
@@ -788,6 +812,7 @@ K_COLUMN: C O L U M N;
 K_COMMIT: C O M M I T;
 K_CONFLICT: C O N F L I C T;
 K_CONSTRAINT: C O N S T R A I N T;
+K_COPY: C O P Y;
 K_CREATE: C R E A T E;
 K_CROSS: C R O S S;
 K_CURRENT_DATE: C U R R E N T '_' D A T E;
@@ -799,6 +824,7 @@ K_DEFAULT: D E F A U L T;
 K_DEFERRABLE: D E F E R R A B L E;
 K_DEFERRED: D E F E R R E D;
 K_DELETE: D E L E T E;
+K_DELIMITER: D E L I M I T E R;
 K_DESC: D E S C;
 K_DETACH: D E T A C H;
 K_DISTINCT: D I S T I N C T;
@@ -815,12 +841,14 @@ K_FAIL: F A I L;
 K_FALSE: F A L S E;
 K_FOR: F O R;
 K_FOREIGN: F O R E I G N;
+K_FORMAT: F O R M A T;
 K_FROM: F R O M;
 K_FULL: F U L L;
 K_REAL_NAME: R E A L '_' N A M E;
 K_GLOB: G L O B;
 K_GROUP: G R O U P;
 K_HAVING: H A V I N G;
+K_HEADER: H E A D E R;
 K_IF: I F;
 K_IGNORE: I G N O R E;
 K_IMMEDIATE: I M M E D I A T E;
@@ -874,6 +902,7 @@ K_SELECT: S E L E C T;
 K_SET: S E T;
 K_SHOW: S H O W;
 K_STATE: S T A T E;
+K_STATEMENT: S T A T E M E N T;
 K_TABLE: T A B L E;
 K_TEMP: T E M P;
 K_TEMPORARY: T E M P O R A R Y;
@@ -0,0 +1,313 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "StatementCache.h"
+
+// Project headers
+#include "DBEngineRequestFactory.h"
+#include "PreparedStatement.h"
+#include "antlr_wrappers/SiodbParserWrapper.h"
+#include "expr/ConstantExpression.h"
+#include "expr/ExpressionFactory.h"
+
+// STL headers
+#include <algorithm>
+
+// Boost headers
+#include <boost/algorithm/string/case_conv.hpp>
+
+namespace siodb::iomgr::dbengine::parser {
+
+namespace {
+
+/**
+ * Returns indication that character can start unquoted identifier.
+ * @param c A character.
+ * @return true if character can start identifier, false otherwise.
+ */
+inline bool isIdentifierStart(char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+/**
+ * Returns indication that character is a decimal digit.
+ * @param c A character.
+ * @return true if character is digit, false otherwise.
+ */
+inline bool isDigit(char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Finds end of the quoted text, in which quote is escaped by doubling it.
+ * @param text A text.
+ * @param pos Position of the opening quote.
+ * @param quote Closing quote character.
+ * @return Position after closing quote or std::string::npos if text is not terminated.
+ */
+std::size_t findQuotedTextEnd(const std::string& text, std::size_t pos, char quote) noexcept
+{
+    ++pos;
+    while (true) {
+        pos = text.find(quote, pos);
+        if (pos == std::string::npos) return pos;
+        if (pos + 1 < text.size() && text[pos + 1] == quote)
+            pos += 2;
+        else
+            return pos + 1;
+    }
+}
+
+/** Statements that can be cached */
+constexpr const char* kCacheableStatements[] = {"SELECT", "INSERT", "UPDATE", "DELETE"};
+
+}  // namespace
+
+struct StatementCache::CachedStatement {
+    /**
+     * Initializes object of class CachedStatement.
+     * @param statement Parsed statement.
+     * @param tables Names of the tables referred by statement.
+     */
+    CachedStatement(std::unique_ptr<PreparedStatement>&& statement,
+            std::vector<std::string>&& tables) noexcept
+        : m_statement(std::move(statement))
+        , m_tables(std::move(tables))
+    {
+    }
+
+    /** Parsed statement with literals as parameters */
+    const std::unique_ptr<PreparedStatement> m_statement;
+
+    /** Names of the tables referred by statement */
+    const std::vector<std::string> m_tables;
+};
+
+StatementCache::StatementCache(std::size_t capacity)
+    : m_statements(capacity)
+    , m_hitCount(0)
+    , m_missCount(0)
+    , m_invalidationCount(0)
+{
+}
+
+requests::DBEngineRequestPtr StatementCache::createRequest(const std::string& text)
+{
+    if (m_statements.capacity() == 0) return nullptr;
+
+    std::string key;
+    std::vector<Literal> literals;
+    if (!normalize(text, key, literals)) return nullptr;
+
+    std::vector<Variant> values;
+    values.reserve(literals.size());
+    for (const auto& literal : literals)
+        values.push_back(createLiteralValue(literal));
+
+    CachedStatementPtr cachedStatement;
+    {
+        std::lock_guard lock(m_mutex);
+        const auto statement = m_statements.get(key);
+        if (statement) {
+            cachedStatement = *statement;
+            ++m_hitCount;
+        } else
+            ++m_missCount;
+    }
+    if (cachedStatement) return cachedStatement->m_statement->createRequest(values);
+
+    auto statement = std::make_unique<PreparedStatement>(
+            std::string(text), PreparedStatement::ParameterKind::kLiteral);
+
+    // Literals found by the parser must be exactly the ones found by normalize()
+    const auto& parameters = statement->getParameters();
+    const bool literalsMatch = std::equal(parameters.cbegin(), parameters.cend(),
+            literals.cbegin(), literals.cend(), [](const auto& parameter, const auto& literal) {
+                return parameter.first->getType() == literal.m_tokenType
+                       && parameter.first->getText() == literal.m_text;
+            });
+    if (!literalsMatch) return DBEngineRequestFactory::createRequest(statement->getStatement());
+
+    // Statement can be cached only if each literal is used as a constant value,
+    // and not, for example, as a name
+    bool allValuesUsed = false;
+    auto request = statement->createRequest(values, allValuesUsed);
+    if (allValuesUsed) {
+        auto cachedStatement = std::make_shared<const CachedStatement>(
+                std::move(statement), getTableNames(*request));
+        std::lock_guard lock(m_mutex);
+        m_statements.emplace(std::move(key), std::move(cachedStatement));
+    }
+    return request;
+}
+
+void StatementCache::invalidateTable(const std::string& table)
+{
+    std::lock_guard lock(m_mutex);
+    std::vector<std::string> keys;
+    for (const auto& e : m_statements) {
+        const auto& tables = e.second->m_tables;
+        if (std::find(tables.cbegin(), tables.cend(), table) != tables.cend())
+            keys.push_back(e.first);
+    }
+    for (const auto& key : keys)
+        m_statements.erase(key);
+    m_invalidationCount += keys.size();
+}
+
+void StatementCache::invalidateAll()
+{
+    std::lock_guard lock(m_mutex);
+    m_invalidationCount += m_statements.size();
+    m_statements.clear();
+}
+
+StatementCache::Statistics StatementCache::getStatistics() const
+{
+    std::lock_guard lock(m_mutex);
+    return Statistics {m_statements.capacity(), m_statements.size(), m_hitCount, m_missCount,
+            m_invalidationCount};
+}
+
+// ----- internals -----
+
+bool StatementCache::normalize(
+        const std::string& text, std::string& key, std::vector<Literal>& literals)
+{
+    key.reserve(text.size());
+    std::string firstWord;
+    bool separated = false;
+    bool statementEnded = false;
+    const auto n = text.size();
+    std::size_t pos = 0;
+    while (pos < n) {
+        const char c = text[pos];
+
+        // Whitespace and comments separate tokens
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v') {
+            separated = true;
+            ++pos;
+            continue;
+        }
+        if (c == '-' && pos + 1 < n && text[pos + 1] == '-') {
+            pos = text.find('\n', pos);
+            if (pos == std::string::npos) pos = n;
+            separated = true;
+            continue;
+        }
+        if (c == '/' && pos + 1 < n && text[pos + 1] == '*') {
+            pos = text.find("*/", pos + 2);
+            pos = (pos == std::string::npos) ? n : pos + 2;
+            separated = true;
+            continue;
+        }
+
+        // Only trailing semicolons are allowed
+        if (c == ';') {
+            statementEnded = true;
+            ++pos;
+            continue;
+        }
+        if (statementEnded) return false;
+
+        if (separated && !key.empty()) key += ' ';
+        separated = false;
+
+        std::size_t end = pos + 1;
+        if (c == '\'' || ((c == 'x' || c == 'X') && pos + 1 < n && text[pos + 1] == '\'')) {
+            // String or binary literal
+            end = findQuotedTextEnd(text, c == '\'' ? pos : pos + 1, '\'');
+            if (end == std::string::npos) return false;
+            literals.push_back(Literal {
+                    c == '\'' ? SiodbParser::STRING_LITERAL : SiodbParser::BLOB_LITERAL,
+                    text.substr(pos, end - pos)});
+            key += '?';
+        } else if (isDigit(c) || (c == '.' && pos + 1 < n && isDigit(text[pos + 1]))) {
+            // Numeric literal
+            end = pos;
+            while (end < n && isDigit(text[end]))
+                ++end;
+            if (end < n && text[end] == '.') {
+                ++end;
+                while (end < n && isDigit(text[end]))
+                    ++end;
+            }
+            if (end < n && (text[end] == 'e' || text[end] == 'E')) {
+                auto exponentEnd = end + 1;
+                if (exponentEnd < n && (text[exponentEnd] == '+' || text[exponentEnd] == '-'))
+                    ++exponentEnd;
+                if (exponentEnd < n && isDigit(text[exponentEnd])) {
+                    end = exponentEnd;
+                    while (end < n && isDigit(text[end]))
+                        ++end;
+                }
+            }
+            literals.push_back(
+                    Literal {SiodbParser::NUMERIC_LITERAL, text.substr(pos, end - pos)});
+            key += '?';
+        } else if (isIdentifierStart(c)) {
+            // Keyword or identifier, both are case insensitive
+            while (end < n && (isIdentifierStart(text[end]) || isDigit(text[end])))
+                ++end;
+            const auto word = boost::to_upper_copy(text.substr(pos, end - pos));
+            if (key.empty()) firstWord = word;
+            key += word;
+        } else if (c == '"' || c == '`' || c == '[') {
+            // Quoted identifier
+            end = (c == '[') ? text.find(']', pos + 1) : findQuotedTextEnd(text, pos, c);
+            if (end == std::string::npos) return false;
+            if (c == '[') ++end;
+            key.append(text, pos, end - pos);
+        } else if (c == '?' || c == ':' || c == '@' || c == '$') {
+            // Bind parameters have no values here, also '?' is used as a placeholder
+            return false;
+        } else
+            key += c;
+        pos = end;
+    }
+
+    return std::any_of(std::cbegin(kCacheableStatements), std::cend(kCacheableStatements),
+            [&firstWord](const char* statement) {
+                return firstWord == statement;
+            });
+}
+
+Variant StatementCache::createLiteralValue(const Literal& literal)
+{
+    antlr4::CommonToken token(literal.m_tokenType, literal.m_text);
+    const ExpressionFactory factory(false);
+    const auto expression = factory.createConstant(&token);
+    return dynamic_cast<const requests::ConstantExpression&>(*expression).getValue();
+}
+
+std::vector<std::string> StatementCache::getTableNames(const requests::DBEngineRequest& request)
+{
+    std::vector<std::string> tables;
+    switch (request.m_requestType) {
+        case requests::DBEngineRequestType::kSelect: {
+            for (const auto& table :
+                    dynamic_cast<const requests::SelectRequest&>(request).m_tables)
+                tables.push_back(table.m_name);
+            break;
+        }
+        case requests::DBEngineRequestType::kInsert: {
+            tables.push_back(dynamic_cast<const requests::InsertRequest&>(request).m_table);
+            break;
+        }
+        case requests::DBEngineRequestType::kUpdate: {
+            tables.push_back(dynamic_cast<const requests::UpdateRequest&>(request).m_table.m_name);
+            break;
+        }
+        case requests::DBEngineRequestType::kDelete: {
+            tables.push_back(dynamic_cast<const requests::DeleteRequest&>(request).m_table.m_name);
+            break;
+        }
+        default: break;
+    }
+    return tables;
+}
+
+}  // namespace siodb::iomgr::dbengine::parser
@@ -0,0 +1,139 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "DBEngineRequest.h"
+
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+#include <siodb/common/utils/UnorderedLruCache.h>
+
+// STL headers
+#include <memory>
+#include <mutex>
+
+namespace siodb::iomgr::dbengine::parser {
+
+/**
+ * LRU cache of the parsed statements shared by all sessions. Statements are looked up
+ * by the normalized text, in which whitespace and comments are collapsed and numeric,
+ * string and binary literals are replaced with placeholders. On a hit, request is created
+ * from the cached parse tree with the literal values of the new text, so that lexing
+ * and parsing by ANTLR are skipped. Only single SELECT, INSERT, UPDATE and DELETE
+ * statements, which use all their literals as expression constants, are cached.
+ */
+class StatementCache final {
+public:
+    /** Cache statistics */
+    struct Statistics {
+        /** Cache capacity */
+        std::size_t m_capacity;
+
+        /** Number of cached statements */
+        std::size_t m_size;
+
+        /** Number of requests created from cached statements */
+        std::uint64_t m_hitCount;
+
+        /** Number of cacheable texts not found in the cache */
+        std::uint64_t m_missCount;
+
+        /** Number of statements removed from cache because of DDL */
+        std::uint64_t m_invalidationCount;
+    };
+
+public:
+    /**
+     * Initializes object of class StatementCache.
+     * @param capacity Maximum number of cached statements. Zero disables cache.
+     */
+    explicit StatementCache(std::size_t capacity);
+
+    DECLARE_NONCOPYABLE(StatementCache);
+
+    /**
+     * Creates request from the cached statement, or parses text and caches statement
+     * if it can be cached.
+     * @param text Statement text.
+     * @return DBE request or nullptr if text can't be cached and must be parsed as usual.
+     * @throw std::exception if text contains invalid statement.
+     */
+    requests::DBEngineRequestPtr createRequest(const std::string& text);
+
+    /**
+     * Removes statements referring to the table.
+     * @param table Table name.
+     */
+    void invalidateTable(const std::string& table);
+
+    /** Removes all statements */
+    void invalidateAll();
+
+    /**
+     * Returns cache statistics.
+     * @return Cache statistics.
+     */
+    Statistics getStatistics() const;
+
+private:
+    /** Literal found in the statement text */
+    struct Literal {
+        /** Token type */
+        std::size_t m_tokenType;
+
+        /** Literal text */
+        std::string m_text;
+    };
+
+    /** Cached statement */
+    struct CachedStatement;
+
+    /** Cached statement shared pointer */
+    using CachedStatementPtr = std::shared_ptr<const CachedStatement>;
+
+private:
+    /**
+     * Normalizes statement text and extracts literals from it.
+     * @param text Statement text.
+     * @param[out] key Normalized text.
+     * @param[out] literals Literals in the text order.
+     * @return true if text contains single statement that can be cached, false otherwise.
+     */
+    static bool normalize(
+            const std::string& text, std::string& key, std::vector<Literal>& literals);
+
+    /**
+     * Converts literal into value.
+     * @param literal A literal.
+     * @return Literal value.
+     */
+    static Variant createLiteralValue(const Literal& literal);
+
+    /**
+     * Returns names of the tables referred by the request.
+     * @param request A request.
+     * @return Table names.
+     */
+    static std::vector<std::string> getTableNames(const requests::DBEngineRequest& request);
+
+private:
+    /** Cache access synchronization object */
+    mutable std::mutex m_mutex;
+
+    /** Cached statements by normalized text */
+    utils::unordered_lru_cache<std::string, CachedStatementPtr> m_statements;
+
+    /** Number of requests created from cached statements */
+    std::uint64_t m_hitCount;
+
+    /** Number of cacheable texts not found in the cache */
+    std::uint64_t m_missCount;
+
+    /** Number of statements removed from cache because of DDL */
+    std::uint64_t m_invalidationCount;
+};
+
+}  // namespace siodb::iomgr::dbengine::parser
@@ -0,0 +1,81 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "../Variant.h"
+
+// STL headers
+#include <unordered_map>
+
+namespace siodb::iomgr::dbengine::parser {
+
+/**
+ * Values bound to the tokens of the parsed statement. Allows to create requests
+ * with the different values from the same parse tree, which is not modified:
+ * bind parameter or literal token with bound value is replaced by that value.
+ */
+class StatementParameters {
+public:
+    /**
+     * Binds value to the token.
+     * @param tokenIndex Token index in the token stream.
+     * @param value A value.
+     */
+    void bind(std::size_t tokenIndex, Variant&& value)
+    {
+        m_values[tokenIndex] = BoundValue {std::move(value), false};
+    }
+
+    /**
+     * Returns value bound to the token and marks it as used.
+     * @param tokenIndex Token index in the token stream.
+     * @return Bound value or nullptr if no value is bound to the token.
+     */
+    const Variant* find(std::size_t tokenIndex) const noexcept
+    {
+        const auto it = m_values.find(tokenIndex);
+        if (it == m_values.end()) return nullptr;
+        it->second.m_used = true;
+        return &it->second.m_value;
+    }
+
+    /**
+     * Returns indication that all bound values were used.
+     * @return true if all bound values were used, false otherwise.
+     */
+    bool isAllUsed() const noexcept
+    {
+        for (const auto& e : m_values) {
+            if (!e.second.m_used) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Returns number of bound values.
+     * @return Number of bound values.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_values.size();
+    }
+
+private:
+    /** Bound value */
+    struct BoundValue {
+        /** Value */
+        Variant m_value;
+
+        /** Indication that value was used when request was created */
+        mutable bool m_used;
+    };
+
+private:
+    /** Bound values by token index */
+    std::unordered_map<std::size_t, BoundValue> m_values;
+};
+
+}  // namespace siodb::iomgr::dbengine::parser
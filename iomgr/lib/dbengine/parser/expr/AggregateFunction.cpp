@@ -0,0 +1,118 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "AggregateFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+AggregateFunction::AggregateFunction(ExpressionType type, ExpressionPtr&& argument) noexcept
+    : Expression(type)
+    , m_argument(std::move(argument))
+{
+}
+
+bool AggregateFunction::isAggregateFunction() const noexcept
+{
+    return true;
+}
+
+void AggregateFunction::validate(const Context& context) const
+{
+    if (!m_argument) return;
+    m_argument->validate(context);
+    const auto argumentType = m_argument->getResultValueType(context);
+    if (argumentType == VariantType::kClob || argumentType == VariantType::kBlob) {
+        throw std::runtime_error(
+                getExpressionText().asMutableString() + " function: LOB argument isn't supported");
+    }
+}
+
+Variant AggregateFunction::evaluate(Context& context) const
+{
+    if (!m_aggregateIndex) throw std::runtime_error("Aggregate function index is not set");
+    return context.getAggregateValue(*m_aggregateIndex);
+}
+
+std::size_t AggregateFunction::getSerializedSize() const noexcept
+{
+    return getExpressionTypeSerializedSize(m_type) + 1
+           + (m_argument ? m_argument->getSerializedSize() : 0);
+}
+
+std::uint8_t* AggregateFunction::serializeUnchecked(std::uint8_t* buffer) const
+{
+    buffer = serializeExpressionTypeUnchecked(m_type, buffer);
+    *buffer++ = m_argument ? 1 : 0;
+    return m_argument ? m_argument->serializeUnchecked(buffer) : buffer;
+}
+
+// ----- internals -----
+
+bool AggregateFunction::isEqualTo(const Expression& other) const noexcept
+{
+    const auto& otherArgument = static_cast<const AggregateFunction&>(other).m_argument;
+    if (!m_argument || !otherArgument) return !m_argument && !otherArgument;
+    return *m_argument == *otherArgument;
+}
+
+void AggregateFunction::dumpImpl(std::ostream& os) const
+{
+    os << " arg: ";
+    if (m_argument)
+        os << *m_argument;
+    else
+        os << '*';
+}
+
+void AggregateFunction::checkNumericArgument(const Context& context) const
+{
+    if (!m_argument) {
+        throw std::runtime_error(
+                getExpressionText().asMutableString() + " function: argument is required");
+    }
+    const auto argumentType = m_argument->getResultValueType(context);
+    if (!isNumericType(argumentType) && !isNullType(argumentType)) {
+        throw std::runtime_error(
+                getExpressionText().asMutableString() + " function: argument type isn't numeric");
+    }
+}
+
+VariantType AggregateFunction::getSumType(VariantType argumentType) noexcept
+{
+    if (!isNumericType(argumentType)) return VariantType::kNull;
+    if (isFloatingPointType(argumentType)) return VariantType::kDouble;
+    return isSignedType(argumentType) ? VariantType::kInt64 : VariantType::kUInt64;
+}
+
+void AggregateFunction::addToSum(AggregateState& state, const Variant& value)
+{
+    if (value.isNull()) return;
+
+    const auto valueType = value.getValueType();
+    Variant sumValue;
+    if (isFloatingPointType(valueType))
+        sumValue = value.asDouble();
+    else if (isSignedType(valueType))
+        sumValue = value.asInt64();
+    else
+        sumValue = value.asUInt64();
+
+    if (state.m_count == 0)
+        state.m_value = std::move(sumValue);
+    else
+        state.m_value = state.m_value + sumValue;
+    ++state.m_count;
+}
+
+void AggregateFunction::mergeSums(AggregateState& state, const AggregateState& other)
+{
+    if (other.m_count == 0) return;
+    if (state.m_count == 0)
+        state.m_value = other.m_value;
+    else
+        state.m_value = state.m_value + other.m_value;
+    state.m_count += other.m_count;
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
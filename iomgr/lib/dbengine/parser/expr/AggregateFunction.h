@@ -0,0 +1,189 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "Expression.h"
+
+// STL headers
+#include <optional>
+
+namespace siodb::iomgr::dbengine::requests {
+
+/** Intermediate state of an aggregate function for a group of rows */
+struct AggregateState {
+    /** Initializes object of class AggregateState. */
+    AggregateState() noexcept
+        : m_count(0)
+    {
+    }
+
+    /** Accumulated value */
+    Variant m_value;
+
+    /** Number of accumulated values */
+    std::uint64_t m_count;
+};
+
+/** Base class for the all aggregate functions */
+class AggregateFunction : public Expression {
+protected:
+    /**
+     * Initializes object of class AggregateFunction.
+     * @param type Expression type.
+     * @param argument Function argument, nullptr means all rows (*).
+     */
+    AggregateFunction(ExpressionType type, ExpressionPtr&& argument) noexcept;
+
+public:
+    /**
+     * Returns function argument.
+     * @return Function argument or nullptr if function is applied to all rows (*).
+     */
+    const Expression* getArgument() const noexcept
+    {
+        return m_argument.get();
+    }
+
+    /**
+     * Sets aggregate function index in the request.
+     * @param aggregateIndex Aggregate function index.
+     */
+    void setAggregateIndex(std::size_t aggregateIndex) noexcept
+    {
+        m_aggregateIndex = aggregateIndex;
+    }
+
+    /**
+     * Returns aggregate function index in the request.
+     * @return Aggregate function index.
+     */
+    const auto& getAggregateIndex() const noexcept
+    {
+        return m_aggregateIndex;
+    }
+
+    /**
+     * Returns indication that expression is aggregate function.
+     * @return true if expression type is aggregate function, false otherwise.
+     */
+    bool isAggregateFunction() const noexcept override final;
+
+    /**
+     * Checks if argument is valid.
+     * @param context Evaluation context.
+     * @throw std::runtime_error if argument is not valid.
+     */
+    void validate(const Context& context) const override;
+
+    /**
+     * Returns aggregate function value for the current group of rows.
+     * @param context Evaluation context.
+     * @return Resulting value.
+     * @throw std::runtime_error if context doesn't provide aggregate values.
+     */
+    Variant evaluate(Context& context) const override final;
+
+    /**
+     * Returns memory size in bytes required to serialize this expression.
+     * @return Memory size in bytes.
+     */
+    std::size_t getSerializedSize() const noexcept override final;
+
+    /**
+     * Serializes this expression, doesn't check memory buffer size.
+     * @param buffer Memory buffer address.
+     * @return Address after a last written byte.
+     * @throw std::runtime_error if serialization failed.
+     */
+    std::uint8_t* serializeUnchecked(std::uint8_t* buffer) const override final;
+
+    /**
+     * Adds argument value of the next row to the state.
+     * @param state Aggregate function state.
+     * @param value Argument value, ignored when function is applied to all rows.
+     */
+    virtual void accumulate(AggregateState& state, const Variant& value) const = 0;
+
+    /**
+     * Merges partial state, collected separately, into the state.
+     * @param state Aggregate function state.
+     * @param other Partial state.
+     */
+    virtual void merge(AggregateState& state, const AggregateState& other) const = 0;
+
+    /**
+     * Returns final aggregate function value.
+     * @param state Aggregate function state.
+     * @return Aggregate function value.
+     */
+    virtual Variant getResult(const AggregateState& state) const = 0;
+
+protected:
+    /**
+     * Compares structure of this expression with another one for equality.
+     * @param other Other expression. Guaranteed to be of the same type as this one.
+     * @return true if expressions structurally equal, false otherwise.
+     */
+    bool isEqualTo(const Expression& other) const noexcept override final;
+
+    /**
+     * Creates deep copy of this expression.
+     * @tparam Expr Expression class.
+     * @return New expression object.
+     */
+    template<class Expr>
+    Expression* cloneImpl() const;
+
+    /**
+     * Dumps expression-specific part to a stream.
+     * @param os Output stream.
+     */
+    void dumpImpl(std::ostream& os) const override final;
+
+    /**
+     * Checks that argument is present and its type is numeric.
+     * @param context Evaluation context.
+     * @throw std::runtime_error if argument is absent or isn't numeric.
+     */
+    void checkNumericArgument(const Context& context) const;
+
+    /**
+     * Returns type of the sum of values of given type.
+     * @param argumentType Argument value type.
+     * @return Sum value type.
+     */
+    static VariantType getSumType(VariantType argumentType) noexcept;
+
+    /**
+     * Adds non-null numeric value to the sum kept in the state.
+     * @param state Aggregate function state.
+     * @param value Value to add.
+     */
+    static void addToSum(AggregateState& state, const Variant& value);
+
+    /**
+     * Adds partial sum to the sum kept in the state.
+     * @param state Aggregate function state.
+     * @param other Partial state.
+     */
+    static void mergeSums(AggregateState& state, const AggregateState& other);
+
+protected:
+    /** Argument expression, nullptr means all rows (*) */
+    const ExpressionPtr m_argument;
+
+    /** Index of aggregate function in the request */
+    std::optional<std::size_t> m_aggregateIndex;
+};
+
+template<class Expr>
+Expression* AggregateFunction::cloneImpl() const
+{
+    ExpressionPtr argument(m_argument ? m_argument->clone() : nullptr);
+    return new Expr(std::move(argument));
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
@@ -7,6 +7,7 @@
 // Project headers
 #include "AddOperator.h"
 #include "AllColumnsExpression.h"
+#include "AvgFunction.h"
 #include "BetweenOperator.h"
 #include "BitwiseAndOperator.h"
 #include "BitwiseOrOperator.h"
@@ -15,6 +16,7 @@
 #include "ComplementOperator.h"
 #include "ConcatenationOperator.h"
 #include "ConstantExpression.h"
+#include "CountFunction.h"
 #include "DivideOperator.h"
 #include "EqualOperator.h"
 #include "GreaterOperator.h"
@@ -29,11 +31,14 @@
 #include "LogicalAndOperator.h"
 #include "LogicalNotOperator.h"
 #include "LogicalOrOperator.h"
+#include "MaxFunction.h"
+#include "MinFunction.h"
 #include "ModuloOperator.h"
 #include "MultiplyOperator.h"
 #include "NotEqualOperator.h"
 #include "RightShiftOperator.h"
 #include "SingleColumnExpression.h"
 #include "SubtractOperator.h"
+#include "SumFunction.h"
 #include "UnaryMinusOperator.h"
 #include "UnaryPlusOperator.h"
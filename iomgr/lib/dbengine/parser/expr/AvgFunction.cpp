@@ -0,0 +1,52 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "AvgFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+VariantType AvgFunction::getResultValueType(const Context& context) const
+{
+    const auto argumentType = m_argument->getResultValueType(context);
+    return isNumericType(argumentType) ? VariantType::kDouble : VariantType::kNull;
+}
+
+ColumnDataType AvgFunction::getColumnDataType(const Context& context) const
+{
+    return convertVariantTypeToColumnDataType(getResultValueType(context));
+}
+
+MutableOrConstantString AvgFunction::getExpressionText() const
+{
+    return "AVG";
+}
+
+void AvgFunction::validate(const Context& context) const
+{
+    checkNumericArgument(context);
+    AggregateFunction::validate(context);
+}
+
+void AvgFunction::accumulate(AggregateState& state, const Variant& value) const
+{
+    addToSum(state, value);
+}
+
+void AvgFunction::merge(AggregateState& state, const AggregateState& other) const
+{
+    mergeSums(state, other);
+}
+
+Variant AvgFunction::getResult(const AggregateState& state) const
+{
+    if (state.m_count == 0) return nullptr;
+    return state.m_value.asDouble() / static_cast<double>(state.m_count);
+}
+
+Expression* AvgFunction::clone() const
+{
+    return cloneImpl<AvgFunction>();
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,44 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "CountFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+VariantType CountFunction::getResultValueType([[maybe_unused]] const Context& context) const
+{
+    return VariantType::kUInt64;
+}
+
+ColumnDataType CountFunction::getColumnDataType(const Context& context) const
+{
+    return convertVariantTypeToColumnDataType(getResultValueType(context));
+}
+
+MutableOrConstantString CountFunction::getExpressionText() const
+{
+    return "COUNT";
+}
+
+void CountFunction::accumulate(AggregateState& state, const Variant& value) const
+{
+    if (!m_argument || !value.isNull()) ++state.m_count;
+}
+
+void CountFunction::merge(AggregateState& state, const AggregateState& other) const
+{
+    state.m_count += other.m_count;
+}
+
+Variant CountFunction::getResult(const AggregateState& state) const
+{
+    return state.m_count;
+}
+
+Expression* CountFunction::clone() const
+{
+    return cloneImpl<CountFunction>();
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
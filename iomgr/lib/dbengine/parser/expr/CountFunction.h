@@ -0,0 +1,72 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "AggregateFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+/** Aggregate function COUNT(X). Counts rows or non-null argument values. */
+class CountFunction final : public AggregateFunction {
+public:
+    /**
+     * Initializes object of class CountFunction.
+     * @param argument Function argument, nullptr means all rows (*).
+     */
+    explicit CountFunction(ExpressionPtr&& argument) noexcept
+        : AggregateFunction(ExpressionType::kCountFunction, std::move(argument))
+    {
+    }
+
+    /**
+     * Returns value type of expression.
+     * @param context Evaluation context.
+     * @return Evaluated expression value type.
+     */
+    VariantType getResultValueType(const Context& context) const override;
+
+    /**
+     * Returns type of generated column from this expression.
+     * @param context Evaluation context.
+     * @return Column data type.
+     */
+    ColumnDataType getColumnDataType(const Context& context) const override;
+
+    /**
+     * Returns expression text.
+     * @return Expression text.
+     */
+    MutableOrConstantString getExpressionText() const override;
+
+    /**
+     * Adds argument value of the next row to the state.
+     * @param state Aggregate function state.
+     * @param value Argument value.
+     */
+    void accumulate(AggregateState& state, const Variant& value) const override;
+
+    /**
+     * Merges partial state, collected separately, into the state.
+     * @param state Aggregate function state.
+     * @param other Partial state.
+     */
+    void merge(AggregateState& state, const AggregateState& other) const override;
+
+    /**
+     * Returns final aggregate function value.
+     * @param state Aggregate function state.
+     * @return Aggregate function value.
+     */
+    Variant getResult(const AggregateState& state) const override;
+
+    /**
+     * Creates deep copy of this expression.
+     * @return New expression object.
+     */
+    Expression* clone() const override;
+};
+
+}  // namespace siodb::iomgr::dbengine::requests
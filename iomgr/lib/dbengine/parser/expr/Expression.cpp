@@ -9,6 +9,11 @@
 
 namespace siodb::iomgr::dbengine::requests {
 
+const Variant& Expression::Context::getAggregateValue([[maybe_unused]] std::size_t aggregateIndex)
+{
+    throw std::runtime_error("Aggregate functions are not allowed here");
+}
+
 bool Expression::isConstant() const noexcept
 {
     return false;
@@ -29,6 +34,11 @@ bool Expression::isTernaryOperator() const noexcept
     return false;
 }
 
+bool Expression::isAggregateFunction() const noexcept
+{
+    return false;
+}
+
 bool Expression::canCastAsDateTime(const Context& context) const noexcept
 {
     return isDateTimeType(getResultValueType(context));
@@ -77,6 +87,23 @@ std::size_t deserializeTernaryExpression(
     return consumed;
 }
 
+template<class ExprT>
+std::size_t deserializeAggregateFunction(
+        const std::uint8_t* buffer, std::size_t length, ExpressionPtr& result)
+{
+    if (SIODB_UNLIKELY(length == 0))
+        throw VariantDeserializationError("Not enough data for the hasArgument attribute");
+    if (SIODB_UNLIKELY(buffer[0] > 1))
+        throw VariantDeserializationError("Invalid hasArgument attribute");
+
+    std::size_t consumed = 1;
+    ExpressionPtr argument;
+    if (buffer[0] == 1) consumed += Expression::deserialize(buffer + 1, length - 1, argument);
+
+    result = std::make_unique<ExprT>(std::move(argument));
+    return consumed;
+}
+
 }  // anonymous namespace
 
 std::size_t Expression::deserialize(
@@ -352,6 +379,31 @@ std::size_t Expression::deserialize(
                    + deserializeBinaryExpression<CastOperator>(
                            buffer + consumed, length - consumed, result);
         }
+        case ExpressionType::kMaxFunction: {
+            return consumed
+                   + deserializeAggregateFunction<MaxFunction>(
+                           buffer + consumed, length - consumed, result);
+        }
+        case ExpressionType::kMinFunction: {
+            return consumed
+                   + deserializeAggregateFunction<MinFunction>(
+                           buffer + consumed, length - consumed, result);
+        }
+        case ExpressionType::kSumFunction: {
+            return consumed
+                   + deserializeAggregateFunction<SumFunction>(
+                           buffer + consumed, length - consumed, result);
+        }
+        case ExpressionType::kAvgFunction: {
+            return consumed
+                   + deserializeAggregateFunction<AvgFunction>(
+                           buffer + consumed, length - consumed, result);
+        }
+        case ExpressionType::kCountFunction: {
+            return consumed
+                   + deserializeAggregateFunction<CountFunction>(
+                           buffer + consumed, length - consumed, result);
+        }
         default: {
             throw std::runtime_error("Deserailization of the expression type #"
                                      + std::to_string(expressionType) + " is not supported");
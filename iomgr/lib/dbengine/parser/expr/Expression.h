@@ -52,6 +52,14 @@ public:
          */
         virtual ColumnDataType getColumnDataType(
                 std::size_t tableIndex, std::size_t columnIndex) const = 0;
+
+        /**
+         * Returns value of the aggregate function for the current group of rows.
+         * @param aggregateIndex Aggregate function index.
+         * @return Value of the aggregate function.
+         * @throw std::runtime_error if aggregate functions are not allowed in this context.
+         */
+        virtual const Variant& getAggregateValue(std::size_t aggregateIndex);
     };
 
     /** De-initializes object of class Expression. */
@@ -90,6 +98,12 @@ public:
      */
     virtual bool isTernaryOperator() const noexcept;
 
+    /**
+     * Returns indication that expression is aggregate function.
+     * @return true if expression type is aggregate function, false otherwise.
+     */
+    virtual bool isAggregateFunction() const noexcept;
+
     /**
      * Returns indication that expression result value type can be DateTime.
      * @param context Evaluation context.
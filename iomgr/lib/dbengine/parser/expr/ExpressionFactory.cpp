@@ -19,8 +19,10 @@
 
 namespace siodb::iomgr::dbengine::parser {
 
-ExpressionFactory::ExpressionFactory(bool allowColumnExpressions) noexcept
+ExpressionFactory::ExpressionFactory(
+        bool allowColumnExpressions, const StatementParameters* parameters) noexcept
     : m_allowColumnExpressions(allowColumnExpressions)
+    , m_parameters(parameters)
 {
 }
 
@@ -64,10 +66,7 @@ requests::ExpressionPtr ExpressionFactory::createExpression(antlr4::tree::ParseT
             }
             throw std::runtime_error("Expression is invalid");
         }
-        case SiodbParser::RuleFunction_call: {
-            // TODO: Support functions
-            throw std::runtime_error("Functions aren't not supported now");
-        }
+        case SiodbParser::RuleFunction_call: return createFunctionCall(node);
         case SiodbParser::RuleSimple_expr: return createSimpleExpression(node);
         default: break;
     }
@@ -158,6 +157,11 @@ requests::ExpressionPtr ExpressionFactory::createBinaryConstant(const antlr4::To
 
 requests::ExpressionPtr ExpressionFactory::createConstant(const antlr4::Token* token) const
 {
+    if (m_parameters) {
+        if (const auto value = m_parameters->find(token->getTokenIndex()))
+            return std::make_unique<requests::ConstantExpression>(Variant(*value));
+    }
+
     auto tokenType = token->getType();
 
     switch (tokenType) {
@@ -183,6 +187,13 @@ requests::ExpressionPtr ExpressionFactory::createConstant(const antlr4::Token* t
     }
 }
 
+requests::ExpressionPtr ExpressionFactory::createParameterValue(const antlr4::Token* token) const
+{
+    const auto value = m_parameters ? m_parameters->find(token->getTokenIndex()) : nullptr;
+    if (!value) throw std::invalid_argument("Parameter value is not bound: " + token->getText());
+    return std::make_unique<requests::ConstantExpression>(Variant(*value));
+}
+
 requests::ExpressionPtr ExpressionFactory::createConstant(const antlr4::tree::ParseTree* node) const
 {
     const auto terminal = dynamic_cast<antlr4::tree::TerminalNode*>(node->children.front());
@@ -232,6 +243,66 @@ bool ExpressionFactory::isLogicalBinaryOperator(std::size_t terminalType) const
     }
 }
 
+requests::ExpressionPtr ExpressionFactory::createFunctionCall(antlr4::tree::ParseTree* node) const
+{
+    const auto functionName =
+            boost::to_upper_copy(helpers::getAnyNameText(node->children.at(0)->children.at(0)));
+
+    // Aggregate functions are applied to the column values
+    if (!m_allowColumnExpressions) {
+        throw std::invalid_argument(utils::StringBuilder()
+                                    << "Function " << functionName
+                                    << " is not allowed in this context");
+    }
+
+    // function_name '(' (K_DISTINCT? expr ( ',' expr)* | '*')? ')'
+    std::vector<requests::ExpressionPtr> arguments;
+    bool allRows = false;
+    for (std::size_t i = 2, n = node->children.size(); i + 1 < n; ++i) {
+        const auto childNode = node->children[i];
+        if (helpers::getNonTerminalType(childNode) == SiodbParser::RuleExpr) {
+            arguments.push_back(createExpression(childNode));
+            continue;
+        }
+        switch (helpers::getTerminalType(childNode)) {
+            case SiodbParser::COMMA: break;
+            case SiodbParser::STAR: allRows = true; break;
+            case SiodbParser::K_DISTINCT: {
+                throw std::runtime_error(utils::StringBuilder()
+                                         << "Function " << functionName
+                                         << ": DISTINCT is not supported");
+            }
+            default: throw std::invalid_argument("Invalid function argument");
+        }
+    }
+
+    if (allRows) {
+        if (functionName == "COUNT") return std::make_unique<requests::CountFunction>(nullptr);
+        throw std::invalid_argument(utils::StringBuilder()
+                                    << "Function " << functionName << " doesn't accept '*'");
+    }
+
+    if (arguments.size() != 1) {
+        throw std::invalid_argument(utils::StringBuilder()
+                                    << "Function " << functionName
+                                    << " requires exactly one argument");
+    }
+
+    if (functionName == "COUNT")
+        return std::make_unique<requests::CountFunction>(std::move(arguments[0]));
+    else if (functionName == "SUM")
+        return std::make_unique<requests::SumFunction>(std::move(arguments[0]));
+    else if (functionName == "AVG")
+        return std::make_unique<requests::AvgFunction>(std::move(arguments[0]));
+    else if (functionName == "MIN")
+        return std::make_unique<requests::MinFunction>(std::move(arguments[0]));
+    else if (functionName == "MAX")
+        return std::make_unique<requests::MaxFunction>(std::move(arguments[0]));
+
+    throw std::runtime_error(
+            utils::StringBuilder() << "Function " << functionName << " is not supported");
+}
+
 requests::ExpressionPtr ExpressionFactory::createColumnValueExpression(
         antlr4::tree::ParseTree* tableNode, antlr4::tree::ParseTree* columnNode) const
 {
@@ -467,6 +538,12 @@ requests::ExpressionPtr ExpressionFactory::createSimpleExpression(
             return createConstant(childNode);
         else if (rule == SiodbParser::RuleColumn_name)
             return createColumnValueExpression(nullptr, childNode);
+        else if (rule == SiodbParser::RuleFunction_call)
+            return createFunctionCall(childNode);
+        else if (helpers::getTerminalType(childNode) == SiodbParser::BIND_PARAMETER) {
+            return createParameterValue(
+                    static_cast<antlr4::tree::TerminalNode*>(childNode)->getSymbol());
+        }
 
     } else if (childCount == 2) {
         // the only case with 2 childs is: unary_operator, [expression, column_name]
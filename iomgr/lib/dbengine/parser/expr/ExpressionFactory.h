@@ -6,6 +6,7 @@
 
 // Project headers
 #include "Expression.h"
+#include "../StatementParameters.h"
 #include "../antlr_wrappers/Antlr4RuntimeWrapper.h"
 
 namespace siodb::iomgr::dbengine::parser {
@@ -15,8 +16,10 @@ public:
     /**
      * Initializes object of class ExpressionFactory.
      * @param allowColumnExpressions Indication that parser should allow columns in expressions.
+     * @param parameters Values bound to the statement tokens, may be nullptr.
      */
-    explicit ExpressionFactory(bool allowColumnExpressions) noexcept;
+    explicit ExpressionFactory(
+            bool allowColumnExpressions, const StatementParameters* parameters = nullptr) noexcept;
 
     /**
      * Creates an expression from expression node.
@@ -28,6 +31,14 @@ public:
      */
     requests::ExpressionPtr createExpression(antlr4::tree::ParseTree* node) const;
 
+    /**
+     * Creates constant expression from a token.
+     * @param token Token with value.
+     * @return New constant expression object.
+     * @throw std::invalid_argument if any argument is invalid.
+     */
+    requests::ExpressionPtr createConstant(const antlr4::Token* token) const;
+
 private:
     /**
      * Creates a numeric constant.
@@ -55,12 +66,12 @@ private:
     requests::ExpressionPtr createBinaryConstant(const antlr4::Token* token) const;
 
     /**
-     * Creates constant expression from a token.
-     * @param token Token with value.
+     * Creates constant expression from a bind parameter token.
+     * @param token Bind parameter token.
      * @return New constant expression object.
-     * @throw std::invalid_argument if any argument is invalid.
+     * @throw std::invalid_argument if no value is bound to the parameter.
      */
-    requests::ExpressionPtr createConstant(const antlr4::Token* token) const;
+    requests::ExpressionPtr createParameterValue(const antlr4::Token* token) const;
 
     /**
      * Creates constant expression from a node.
@@ -94,6 +105,15 @@ private:
     requests::ExpressionPtr createColumnValueExpression(
             antlr4::tree::ParseTree* tableNode, antlr4::tree::ParseTree* columnNode) const;
 
+    /**
+     * Creates function call expression. Only aggregate functions are supported now.
+     * @param node A node with function call.
+     * @return New function expression object.
+     * @throw std::invalid_argument if function arguments are invalid.
+     * @throw runtime_error if function is not supported.
+     */
+    requests::ExpressionPtr createFunctionCall(antlr4::tree::ParseTree* node) const;
+
     /**
      * Creates between expression.
      * @param expression Expression with value.
@@ -167,6 +187,9 @@ private:
 private:
     /* Indication that parser should allow columns in expressions */
     const bool m_allowColumnExpressions;
+
+    /** Values bound to the statement tokens */
+    const StatementParameters* const m_parameters;
 };
 
 }  // namespace siodb::iomgr::dbengine::parser
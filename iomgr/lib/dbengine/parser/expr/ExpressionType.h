@@ -85,11 +85,11 @@ enum class ExpressionType {
     kForSomePredicate,  // NOT SUPPORTED YET
 
     // Aggreation functions
-    kMaxFunction,  // NOT SUPPORTED YET
-    kMinFunction,  // NOT SUPPORTED YET
-    kSumFunction,  // NOT SUPPORTED YET
-    kAvgFunction,  // NOT SUPPORTED YET
-    kCountFunction,  // NOT SUPPORTED YET
+    kMaxFunction,
+    kMinFunction,
+    kSumFunction,
+    kAvgFunction,
+    kCountFunction,
     kDistinctFunction,  // NOT SUPPORTED YET
 
     // Text functions
@@ -4,6 +4,9 @@
 
 #include "InOperator.h"
 
+// Project headers
+#include "ConstantExpression.h"
+
 // Common project headers
 #include <siodb/common/utils/Base128VariantEncoding.h>
 
@@ -13,12 +16,12 @@
 
 namespace siodb::iomgr::dbengine::requests {
 
-InOperator::InOperator(
-        ExpressionPtr&& value, std::vector<ExpressionPtr>&& variants, bool notIn) noexcept
+InOperator::InOperator(ExpressionPtr&& value, std::vector<ExpressionPtr>&& variants, bool notIn)
     : Expression(ExpressionType::kInPredicate)
     , m_value(std::move(value))
     , m_variants(std::move(variants))
     , m_notIn(notIn)
+    , m_constantValueSet(createConstantValueSet(m_variants))
 {
 }
 
@@ -109,6 +112,11 @@ Variant InOperator::evaluate(Context& context) const
         return false;
     }
 
+    if (m_constantValueSet) {
+        const auto found = m_constantValueSet->contains(value);
+        if (found) return m_notIn != *found;
+    }
+
     const auto variantIter =
             std::find_if(m_variants.begin(), m_variants.end(), [&](const auto& variantExpr) {
                 const auto variantValue = variantExpr->evaluate(context);
@@ -158,6 +166,18 @@ Expression* InOperator::clone() const
 
 // ----- internals -----
 
+std::optional<ConstantValueSet> InOperator::createConstantValueSet(
+        const std::vector<ExpressionPtr>& variants)
+{
+    std::vector<const Variant*> values;
+    values.reserve(variants.size());
+    for (const auto& variant : variants) {
+        if (variant->getType() != ExpressionType::kConstant) return std::nullopt;
+        values.push_back(&static_cast<const ConstantExpression&>(*variant).getValue());
+    }
+    return ConstantValueSet::create(values);
+}
+
 bool InOperator::isEqualTo(const Expression& other) const noexcept
 {
     const auto& otherInOperator = static_cast<const InOperator&>(other);
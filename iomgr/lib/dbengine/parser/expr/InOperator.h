@@ -6,6 +6,7 @@
 
 // Project headers
 #include "Expression.h"
+#include "../ConstantValueSet.h"
 
 namespace siodb::iomgr::dbengine::requests {
 
@@ -22,7 +23,7 @@ public:
      * @throw std::invalid_argument if value is nullptr.
      * @throw std::invalid_argument if variants is empty.
      */
-    InOperator(ExpressionPtr&& value, std::vector<ExpressionPtr>&& variants, bool notIn) noexcept;
+    InOperator(ExpressionPtr&& value, std::vector<ExpressionPtr>&& variants, bool notIn);
 
     /**
      * Returns indication that this is NOT IN operator.
@@ -51,6 +52,15 @@ public:
         return m_variants;
     }
 
+    /**
+     * Returns set of the variant values, available when all variants are constants.
+     * @return Variant value set or std::nullopt.
+     */
+    const auto& getConstantValueSet() const noexcept
+    {
+        return m_constantValueSet;
+    }
+
     /**
      * Returns value type of expression.
      * @param context Evaluation context.
@@ -118,6 +128,15 @@ protected:
      */
     void dumpImpl(std::ostream& os) const override final;
 
+private:
+    /**
+     * Creates set of the variant values, if all variants are constants.
+     * @param variants Variants.
+     * @return Variant value set or std::nullopt.
+     */
+    static std::optional<ConstantValueSet> createConstantValueSet(
+            const std::vector<ExpressionPtr>& variants);
+
 private:
     /** Value expression */
     const ExpressionPtr m_value;
@@ -127,6 +146,9 @@ private:
 
     /** true in case of NOT IN operator, false otherwise */
     const bool m_notIn;
+
+    /** Variant values, prepared once for all evaluations */
+    const std::optional<ConstantValueSet> m_constantValueSet;
 };
 
 }  // namespace siodb::iomgr::dbengine::requests
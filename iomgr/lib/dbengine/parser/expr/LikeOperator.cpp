@@ -5,13 +5,19 @@
 // Project headers
 #include "LikeOperator.h"
 #include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
+#include "ConstantExpression.h"
 #include "../../ColumnDataType.h"
 #include "../../ThrowDatabaseError.h"
 
-#include <utf8cpp/utf8.h>
-
 namespace siodb::iomgr::dbengine::requests {
 
+LikeOperator::LikeOperator(ExpressionPtr&& left, ExpressionPtr&& right, bool notLike)
+    : BinaryOperator(ExpressionType::kLikePredicate, std::move(left), std::move(right))
+    , m_notLike(notLike)
+    , m_compiledPattern(compileConstantPattern(*m_right))
+{
+}
+
 VariantType LikeOperator::getResultValueType([[maybe_unused]] const Context& context) const
 {
     return VariantType::kBool;
@@ -49,9 +55,10 @@ void LikeOperator::validate(const Context& context) const
 Variant LikeOperator::evaluate(Context& context) const
 {
     const auto value = m_left->evaluate(context);
-    const auto pattern = m_right->evaluate(context);
+    // Constant pattern is compiled once, others are compiled for each value
+    const auto pattern = m_compiledPattern ? Variant() : m_right->evaluate(context);
 
-    if (value.isNull() || pattern.isNull()) {
+    if (value.isNull() || (!m_compiledPattern && pattern.isNull())) {
         // TODO: SIODB-172
         return false;
     }
@@ -61,16 +68,14 @@ Variant LikeOperator::evaluate(Context& context) const
                 getColumnDataTypeName(convertVariantTypeToColumnDataType(value.getValueType())));
     }
 
+    if (m_compiledPattern) return m_compiledPattern->match(value.getString()) != m_notLike;
+
     if (!pattern.isString()) {
         throwDatabaseError(IOManagerMessageId::kErrorLikePatternTypeIsWrong,
                 getColumnDataTypeName(convertVariantTypeToColumnDataType(pattern.getValueType())));
     }
 
-    const auto& valueStr = value.getString();
-    const auto& patternStr = pattern.getString();
-    return matchPattern(valueStr.c_str(), valueStr.c_str() + valueStr.length(), patternStr.c_str(),
-                   patternStr.c_str() + patternStr.length())
-           != m_notLike;
+    return LikePattern(pattern.getString()).match(value.getString()) != m_notLike;
 }
 
 std::uint8_t* LikeOperator::serializeUnchecked(std::uint8_t* buffer) const
@@ -95,48 +100,12 @@ bool LikeOperator::isEqualTo(const Expression& other) const noexcept
            && *m_right == *otherLikeOperator.m_right;
 }
 
-bool LikeOperator::matchPattern(
-        const char* str, const char* strEnd, const char* pattern, const char* patternEnd)
+std::optional<LikePattern> LikeOperator::compileConstantPattern(const Expression& pattern)
 {
-    if (str == strEnd) return pattern == patternEnd;
-
-    constexpr char kAnyChar = '_';
-    constexpr char kAnyCharSeq = '%';
-
-    // Last occurrences of the '%'
-    const char* strLastAnyCharSeq = nullptr;
-    const char* patternLastAnyCharSeq = nullptr;
-
-    while (str < strEnd) {
-        const auto patternStart = pattern;
-        const auto patternChar = (pattern != patternEnd) ? utf8::next(pattern, patternEnd) : 0;
-        if (patternChar == kAnyChar)
-            utf8::next(str, strEnd);
-        else if (patternChar == kAnyCharSeq) {
-            // Remember last point where '%' has occurred
-            strLastAnyCharSeq = str;
-            patternLastAnyCharSeq = patternStart;
-        } else if (utf8::next(str, strEnd) == patternChar)
-            continue;
-        else if (patternLastAnyCharSeq != nullptr) {
-            // If pattern character is not equal to the str character,
-            // go back to the last '%' point and advance 'str' to a next character
-            str = strLastAnyCharSeq;
-            pattern = patternLastAnyCharSeq;
-            utf8::next(str, strEnd);
-            strLastAnyCharSeq = str;
-        } else
-            return false;
-    }
-
-    // Skip all '%'
-    while (pattern < patternEnd) {
-        const auto patternChar = utf8::next(pattern, patternEnd);
-        if (patternChar != kAnyCharSeq) return false;
-    }
-
-    // Pattern is empty, string is empty, so string is matched
-    return true;
+    if (pattern.getType() != ExpressionType::kConstant) return std::nullopt;
+    const auto& value = static_cast<const ConstantExpression&>(pattern).getValue();
+    if (!value.isString()) return std::nullopt;
+    return LikePattern(value.getString());
 }
 
 }  // namespace siodb::iomgr::dbengine::requests
@@ -6,6 +6,10 @@
 
 // Project headers
 #include "BinaryOperator.h"
+#include "../LikePattern.h"
+
+// STL headers
+#include <optional>
 
 namespace siodb::iomgr::dbengine::requests {
 
@@ -19,11 +23,7 @@ public:
      * @param notLike Indicates that this is NOT LIKE statement.
      * @throw std::invalid_argument if any operand is nullptr
      */
-    LikeOperator(ExpressionPtr&& left, ExpressionPtr&& right, bool notLike) noexcept
-        : BinaryOperator(ExpressionType::kLikePredicate, std::move(left), std::move(right))
-        , m_notLike(notLike)
-    {
-    }
+    LikeOperator(ExpressionPtr&& left, ExpressionPtr&& right, bool notLike);
 
     /**
      * Returns indication that this is NOT LIKE operator
@@ -98,19 +98,18 @@ protected:
 
 private:
     /**
-     * Matches string to pattern. Assumes pattern and string are UTF-8 strings.
-     * @param str A string to match.
-     * @param strEnd String end.
-     * @param pattern A pattern.
-     * @param patternEnd Pattern end.
-     * @return true if a string matches to a pattern, false otherwise.
+     * Compiles pattern if it is a constant string.
+     * @param pattern Pattern expression.
+     * @return Compiled pattern or empty value if pattern isn't a constant string.
      */
-    static bool matchPattern(
-            const char* str, const char* strEnd, const char* pattern, const char* patternEnd);
+    static std::optional<LikePattern> compileConstantPattern(const Expression& pattern);
 
 private:
     /* Indicates NOT LIKE operator. */
     const bool m_notLike;
+
+    /** Pattern compiled once, if it is a constant string */
+    const std::optional<LikePattern> m_compiledPattern;
 };
 
 }  // namespace siodb::iomgr::dbengine::requests
@@ -0,0 +1,56 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "MaxFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+VariantType MaxFunction::getResultValueType(const Context& context) const
+{
+    return m_argument->getResultValueType(context);
+}
+
+ColumnDataType MaxFunction::getColumnDataType(const Context& context) const
+{
+    return convertVariantTypeToColumnDataType(getResultValueType(context));
+}
+
+MutableOrConstantString MaxFunction::getExpressionText() const
+{
+    return "MAX";
+}
+
+void MaxFunction::validate(const Context& context) const
+{
+    if (!m_argument) throw std::runtime_error("MAX function: argument is required");
+    AggregateFunction::validate(context);
+}
+
+void MaxFunction::accumulate(AggregateState& state, const Variant& value) const
+{
+    if (value.isNull()) return;
+    if (state.m_count == 0 || state.m_value.compatibleLess(value)) state.m_value = value;
+    ++state.m_count;
+}
+
+void MaxFunction::merge(AggregateState& state, const AggregateState& other) const
+{
+    if (other.m_count == 0) return;
+    const auto count = state.m_count;
+    accumulate(state, other.m_value);
+    state.m_count = count + other.m_count;
+}
+
+Variant MaxFunction::getResult(const AggregateState& state) const
+{
+    if (state.m_count == 0) return nullptr;
+    return state.m_value;
+}
+
+Expression* MaxFunction::clone() const
+{
+    return cloneImpl<MaxFunction>();
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
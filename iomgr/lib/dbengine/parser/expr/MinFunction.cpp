@@ -0,0 +1,56 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "MinFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+VariantType MinFunction::getResultValueType(const Context& context) const
+{
+    return m_argument->getResultValueType(context);
+}
+
+ColumnDataType MinFunction::getColumnDataType(const Context& context) const
+{
+    return convertVariantTypeToColumnDataType(getResultValueType(context));
+}
+
+MutableOrConstantString MinFunction::getExpressionText() const
+{
+    return "MIN";
+}
+
+void MinFunction::validate(const Context& context) const
+{
+    if (!m_argument) throw std::runtime_error("MIN function: argument is required");
+    AggregateFunction::validate(context);
+}
+
+void MinFunction::accumulate(AggregateState& state, const Variant& value) const
+{
+    if (value.isNull()) return;
+    if (state.m_count == 0 || value.compatibleLess(state.m_value)) state.m_value = value;
+    ++state.m_count;
+}
+
+void MinFunction::merge(AggregateState& state, const AggregateState& other) const
+{
+    if (other.m_count == 0) return;
+    const auto count = state.m_count;
+    accumulate(state, other.m_value);
+    state.m_count = count + other.m_count;
+}
+
+Variant MinFunction::getResult(const AggregateState& state) const
+{
+    if (state.m_count == 0) return nullptr;
+    return state.m_value;
+}
+
+Expression* MinFunction::clone() const
+{
+    return cloneImpl<MinFunction>();
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
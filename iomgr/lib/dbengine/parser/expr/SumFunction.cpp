@@ -0,0 +1,51 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "SumFunction.h"
+
+namespace siodb::iomgr::dbengine::requests {
+
+VariantType SumFunction::getResultValueType(const Context& context) const
+{
+    return getSumType(m_argument->getResultValueType(context));
+}
+
+ColumnDataType SumFunction::getColumnDataType(const Context& context) const
+{
+    return convertVariantTypeToColumnDataType(getResultValueType(context));
+}
+
+MutableOrConstantString SumFunction::getExpressionText() const
+{
+    return "SUM";
+}
+
+void SumFunction::validate(const Context& context) const
+{
+    checkNumericArgument(context);
+    AggregateFunction::validate(context);
+}
+
+void SumFunction::accumulate(AggregateState& state, const Variant& value) const
+{
+    addToSum(state, value);
+}
+
+void SumFunction::merge(AggregateState& state, const AggregateState& other) const
+{
+    mergeSums(state, other);
+}
+
+Variant SumFunction::getResult(const AggregateState& state) const
+{
+    if (state.m_count == 0) return nullptr;
+    return state.m_value;
+}
+
+Expression* SumFunction::clone() const
+{
+    return cloneImpl<SumFunction>();
+}
+
+}  // namespace siodb::iomgr::dbengine::requests
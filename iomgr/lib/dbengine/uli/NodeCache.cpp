@@ -9,11 +9,15 @@
 #include "FileData.h"
 #include "Node.h"
 #include "UniqueLinearIndex.h"
+#include "../Table.h"
 #include "../ThrowDatabaseError.h"
 
 // Common project headers
 #include <siodb/common/log/Log.h>
 
+// STL headers
+#include <algorithm>
+
 namespace siodb::iomgr::dbengine::uli {
 
 NodeCache::~NodeCache()
@@ -78,6 +82,12 @@ void NodeCache::on_evict([[maybe_unused]] const key_type& key, mapped_type& valu
 bool NodeCache::on_last_chance_cleanup()
 {
     ULI_DBG_LOG_DEBUG("NodeCache " << m_owner.m_index.getDisplayName() << ": Last chance cleanup");
+    // Index file is written through, so row data saved nodes point to must be on disk first
+    const bool hasModifiedNodes = std::any_of(map_internal().cbegin(), map_internal().cend(),
+            [](const auto& e) { return e.second.first->m_modified; });
+    if (!hasModifiedNodes) return false;
+    m_owner.m_index.getTable().flushColumnData();
+
     std::size_t savedCount = 0;
     for (const auto& e : map_internal()) {
         if (!e.second.first->m_modified) continue;
@@ -47,6 +47,7 @@ UniqueLinearIndex::UniqueLinearIndex(Table& table, IndexType type, const std::st
     , m_fileCache(*this, kFileCacheCapacity)
     , m_minKey(getLeadingKey())
     , m_maxKey(getTrailingKey())
+    , m_keyCount(0)
 {
     createInitializationFlagFile();
 
@@ -74,13 +75,26 @@ UniqueLinearIndex::UniqueLinearIndex(Table& table, const IndexRecord& indexRecor
     , m_fileCache(*this, kFileCacheCapacity)
     , m_minKey(getLeadingKey())
     , m_maxKey(getTrailingKey())
+    , m_keyCount(kUnknownKeyCount)
 {
+    loadFileKeyCounts();
+
     // Log this always
     LOG_DEBUG << "Index " << getDisplayName() << ": fileCount=" << m_fileIds.size()
               << ", minKey=" << decodeKey(m_minKey.data())
               << ", maxKey=" << decodeKey(m_maxKey.data());
 }
 
+UniqueLinearIndex::~UniqueLinearIndex()
+{
+    // Key counts are stored on clean shutdown
+    try {
+        flush();
+    } catch (std::exception& ex) {
+        LOG_ERROR << "Index " << getDisplayName() << ": " << ex.what();
+    }
+}
+
 std::uint32_t UniqueLinearIndex::getDataFileSize() const noexcept
 {
     return m_dataFileSize;
@@ -102,9 +116,15 @@ bool UniqueLinearIndex::insert(const void* key, const void* value, bool replaceE
                                << (keyDoesntExist ? "doesn't exist" : "exists") << ')');
 
     if (keyDoesntExist || replaceExisting) {
+        std::unique_lock keyCountLock(m_keyCountMutex, std::defer_lock);
+        if (keyDoesntExist) {
+            keyCountLock.lock();
+            invalidateStoredKeyCount(getFileIdForNode(nodeId));
+        }
         // Store value
         ::memcpy(record + 1, value, m_valueSize);
         *record = kValueStateExists;
+        if (keyDoesntExist) updateKeyCounts(nodeId, true);
         node->m_modified = true;
         // Update min and max keys
         if (m_keyCompare(key, m_minKey.data()) < 0) std::memcpy(m_minKey.data(), key, m_keySize);
@@ -131,10 +151,13 @@ std::uint64_t UniqueLinearIndex::erase(const void* key)
     if (!keyExists) return 0;
 
     updateMinMaxKeysAfterRemoval(key);
+    std::lock_guard keyCountLock(m_keyCountMutex);
+    invalidateStoredKeyCount(getFileIdForNode(node->m_nodeId));
 
     // Mark record as free
     *record = kValueStateFree;
     node->m_modified = true;
+    updateKeyCounts(node->m_nodeId, false);
     return 1;
 }
 
@@ -176,9 +199,12 @@ bool UniqueLinearIndex::markAsDeleted(const void* key, const void* value)
 
     if (keyExists) {
         updateMinMaxKeysAfterRemoval(key);
+        std::lock_guard keyCountLock(m_keyCountMutex);
+        invalidateStoredKeyCount(getFileIdForNode(node->m_nodeId));
         ::memcpy(record + 1, value, m_valueSize);
         *record = kValueStateDeleted;
         node->m_modified = true;
+        updateKeyCounts(node->m_nodeId, false);
     }
     return keyExists;
 }
@@ -194,6 +220,14 @@ void UniqueLinearIndex::flush()
                     ex.what());
         }
     }
+
+    // Key counts are stored after nodes, so stored key count always matches nodes on disk
+    std::lock_guard lock(m_keyCountMutex);
+    for (const auto& e : m_fileKeyCounts) {
+        if (m_fileIdsWithStoredKeyCount.count(e.first) > 0) continue;
+        writeIndexFileHeader(*getFileData(e.first), e.second);
+        m_fileIdsWithStoredKeyCount.insert(e.first);
+    }
 }
 
 std::uint64_t UniqueLinearIndex::getValue(const void* key, void* value, std::size_t count)
@@ -218,6 +252,18 @@ std::uint64_t UniqueLinearIndex::getValue(const void* key, void* value, std::siz
     return 0;
 }
 
+bool UniqueLinearIndex::getDeletedValue(const void* key, void* value)
+{
+    const auto numericKey = decodeKey(key);
+    auto node = getNode(getNodeIdForKey(numericKey));
+    if (!node) return false;
+    const auto offset = (numericKey % m_numberOfRecordsPerNode) * m_recordSize;
+    const auto record = node->m_data + offset;
+    if (*record != kValueStateDeleted) return false;
+    ::memcpy(value, record + 1, m_valueSize);
+    return true;
+}
+
 std::uint64_t UniqueLinearIndex::count(const void* key)
 {
     const auto numericKey = decodeKey(key);
@@ -235,6 +281,24 @@ std::uint64_t UniqueLinearIndex::count(const void* key)
     return keyExists ? 1 : 0;
 }
 
+std::optional<std::uint64_t> UniqueLinearIndex::getKeyCount()
+{
+    const auto keyCount = m_keyCount.load();
+    if (keyCount != kUnknownKeyCount) return keyCount;
+
+    // Some files lost key count due to unclean shutdown, count their keys once
+    std::lock_guard lock(m_keyCountMutex);
+    std::uint64_t totalKeyCount = 0;
+    for (const auto fileId : m_fileIds) {
+        auto it = m_fileKeyCounts.find(fileId);
+        if (it == m_fileKeyCounts.end())
+            it = m_fileKeyCounts.emplace(fileId, countFileKeys(fileId)).first;
+        totalKeyCount += it->second;
+    }
+    m_keyCount = totalKeyCount;
+    return totalKeyCount;
+}
+
 bool UniqueLinearIndex::getMinKey(void* key)
 {
     // Check that we have min and max keys
@@ -273,6 +337,15 @@ bool UniqueLinearIndex::getNextKey(const void* key, void* nextKey)
     return m_isSortDescending ? getKeyBefore(key, nextKey) : getKeyAfter(key, nextKey);
 }
 
+bool UniqueLinearIndex::getNthNextKey(const void* key, std::uint64_t distance, void* nextKey)
+{
+    if (distance == 0) throw std::invalid_argument("Key distance must be positive");
+    if (distance == 1) return getNextKey(key, nextKey);
+    // Descending indices are not used for the table scans, step through the keys
+    if (m_isSortDescending) return Index::getNthNextKey(key, distance, nextKey);
+    return getNthKeyAfter(key, distance, nextKey);
+}
+
 io::FilePtr UniqueLinearIndex::createIndexFile(std::uint64_t fileId) const
 {
     std::string tmpFilePath;
@@ -357,6 +430,67 @@ io::FilePtr UniqueLinearIndex::openIndexFile(std::uint64_t fileId) const
     return file;
 }
 
+uli::FileDataPtr UniqueLinearIndex::getFileData(std::uint64_t fileId)
+{
+    auto maybeFileData = m_fileCache.get(fileId);
+    if (maybeFileData) return *maybeFileData;
+    auto fileData = std::make_shared<uli::FileData>(*this, openIndexFile(fileId), fileId);
+    m_fileCache.emplace(fileId, fileData);
+    return fileData;
+}
+
+void UniqueLinearIndex::writeIndexFileHeader(
+        const uli::FileData& fileData, const std::optional<std::uint64_t>& keyCount) const
+{
+    IndexFileHeader indexFileHeader;
+    if (keyCount) {
+        indexFileHeader.m_flags |= IndexFileHeader::kKeyCountValidFlag;
+        indexFileHeader.m_keyCount = *keyCount;
+    }
+    std::uint8_t buffer[IndexFileHeader::kSerializedSize];
+    indexFileHeader.serialize(buffer);
+    if (fileData.m_file->write(buffer, sizeof(buffer), 0) != sizeof(buffer)) {
+        throwDatabaseError(IOManagerMessageId::kErrorCannotWriteIndexFile,
+                makeIndexFilePath(fileData.getFileId()), getDatabaseName(), m_table.getName(),
+                m_name, getDatabaseUuid(), m_table.getId(), m_id, 0, sizeof(buffer),
+                fileData.m_file->getLastError(), std::strerror(fileData.m_file->getLastError()));
+    }
+}
+
+void UniqueLinearIndex::loadFileKeyCounts()
+{
+    std::uint64_t keyCount = 0;
+    bool allKeyCountsKnown = true;
+    for (const auto fileId : m_fileIds) {
+        const auto fileData = getFileData(fileId);
+        std::uint8_t buffer[IndexFileHeader::kSerializedSize];
+        if (fileData->m_file->read(buffer, sizeof(buffer), 0) != sizeof(buffer)) {
+            throwDatabaseError(IOManagerMessageId::kErrorCannotReadIndexFile,
+                    makeIndexFilePath(fileId), getDatabaseName(), m_table.getName(), m_name,
+                    getDatabaseUuid(), m_table.getId(), m_id, 0, sizeof(buffer),
+                    fileData->m_file->getLastError(),
+                    std::strerror(fileData->m_file->getLastError()));
+        }
+        // Files created before key counts were introduced have no valid key count
+        IndexFileHeader indexFileHeader;
+        if (indexFileHeader.deserialize(buffer)
+                && (indexFileHeader.m_flags & IndexFileHeader::kKeyCountValidFlag) != 0) {
+            m_fileKeyCounts.emplace(fileId, indexFileHeader.m_keyCount);
+            m_fileIdsWithStoredKeyCount.insert(fileId);
+            keyCount += indexFileHeader.m_keyCount;
+        } else
+            allKeyCountsKnown = false;
+    }
+    m_keyCount = allKeyCountsKnown ? keyCount : kUnknownKeyCount;
+}
+
+void UniqueLinearIndex::invalidateStoredKeyCount(std::uint64_t fileId)
+{
+    if (m_fileIdsWithStoredKeyCount.count(fileId) == 0) return;
+    writeIndexFileHeader(*getFileData(fileId), std::nullopt);
+    m_fileIdsWithStoredKeyCount.erase(fileId);
+}
+
 uli::NodePtr UniqueLinearIndex::getNodeChecked(std::uint64_t nodeId)
 {
     auto node = getNode(nodeId);
@@ -374,14 +508,7 @@ uli::NodePtr UniqueLinearIndex::getNode(std::uint64_t nodeId)
     const auto fileId = getFileIdForNode(nodeId);
     if (m_fileIds.count(fileId) == 0) return nullptr;
 
-    uli::FileDataPtr fileData;
-    auto maybeFileData = m_fileCache.get(fileId);
-    if (maybeFileData)
-        fileData = *maybeFileData;
-    else {
-        fileData = std::make_shared<uli::FileData>(*this, openIndexFile(fileId), fileId);
-        m_fileCache.emplace(fileId, fileData);
-    }
+    const auto fileData = getFileData(fileId);
 
     ULI_DBG_LOG_DEBUG("Index " << getDisplayName() << ": Getting node " << nodeId << " from file #"
                                << fileData->getFileId());
@@ -397,6 +524,10 @@ uli::NodePtr UniqueLinearIndex::makeNode(std::uint64_t nodeId)
     auto fileData = std::make_shared<uli::FileData>(*this, std::move(indexFile), fileId);
     m_fileIds.insert(fileId);
     m_fileCache.emplace(fileId, fileData);
+    {
+        std::lock_guard lock(m_keyCountMutex);
+        m_fileKeyCounts.emplace(fileId, 0);
+    }
     return fileData->getNode(nodeId);
 }
 
@@ -637,6 +768,21 @@ bool UniqueLinearIndex::getTrailingKey(void* key)
     return false;
 }
 
+std::uint64_t UniqueLinearIndex::countFileKeys(std::uint64_t fileId)
+{
+    ULI_DBG_LOG_DEBUG("Index " << getDisplayName() << ": countFileKeys: file #" << fileId);
+    std::uint64_t keyCount = 0;
+    std::uint64_t nodeId = (fileId - 1) * m_numberOfNodesPerFile + 1;
+    for (std::size_t j = 0; j < m_numberOfNodesPerFile; ++j, ++nodeId) {
+        const auto node = getNodeChecked(nodeId);
+        auto record = node->m_data;
+        for (std::size_t i = 0; i < m_numberOfRecordsPerNode; ++i, record += m_recordSize) {
+            if (*record == kValueStateExists) ++keyCount;
+        }
+    }
+    return keyCount;
+}
+
 bool UniqueLinearIndex::getKeyBefore(const void* key, void* keyBefore)
 {
     ULI_DBG_LOG_DEBUG("Index " << getDisplayName() << ": getKeyBefore()");
@@ -804,6 +950,139 @@ bool UniqueLinearIndex::getKeyAfter(const void* key, void* keyAfter)
     }
 }
 
+bool UniqueLinearIndex::getNthKeyAfter(const void* key, std::uint64_t distance, void* keyAfter)
+{
+    ULI_DBG_LOG_DEBUG("Index " << getDisplayName() << ": getNthKeyAfter() distance=" << distance);
+
+    // Check that next key exists
+    if (m_keyCompare(key, m_maxKey.data()) >= 0
+            || m_keyCompare(key, m_maxPossibleKey.data()) == 0) {
+        ULI_DBG_LOG_DEBUG("Index " << getDisplayName() << ": getNthKeyAfter: key is out of range");
+        return false;
+    }
+
+    // Determine node ID
+    const auto numericKey = decodeKey(key);
+    auto nodeId = getNodeIdForKey(numericKey);
+    if (nodeId > getMaxAvailableNodeId()) return false;
+
+    // Get record ID for the given key
+    auto recordId = numericKey % m_numberOfRecordsPerNode;
+
+    // Step to valid file
+    auto fileId = getFileIdForNode(nodeId);
+    auto fileIter = std::as_const(m_fileIds).lower_bound(fileId);
+    if (fileIter == m_fileIds.cend()) {
+        // Key belongs to a file before first available file
+        fileIter = m_fileIds.cbegin();
+        fileId = *fileIter;
+        nodeId = (fileId - 1) * m_numberOfNodesPerFile + 1;
+        recordId = 0;
+    } else if (*fileIter > fileId) {
+        // Key belongs to a not available file in the middle
+        fileId = *fileIter;
+        nodeId = (fileId - 1) * m_numberOfNodesPerFile + 1;
+        recordId = 0;
+    } else {
+        // File is available, step to next record in the node
+        ++recordId;
+    }
+
+    while (true) {
+        const auto lastNodeId = fileId * m_numberOfNodesPerFile;
+
+        // Skip whole file if it has not enough keys. Key count of the file becomes known
+        // after all its nodes are skipped, so that no extra nodes are read.
+        const bool isWholeFile = recordId == 0 && nodeId == lastNodeId - m_numberOfNodesPerFile + 1;
+        std::uint64_t fileKeyCount = 0;
+        if (isWholeFile) {
+            std::lock_guard lock(m_keyCountMutex);
+            const auto it = m_fileKeyCounts.find(fileId);
+            if (it != m_fileKeyCounts.end() && it->second < distance) {
+                distance -= it->second;
+                nodeId = lastNodeId + 1;
+            }
+        }
+
+        for (; nodeId <= lastNodeId; ++nodeId, recordId = 0) {
+            // Skip whole node if it has not enough keys
+            if (recordId == 0) {
+                std::unique_lock lock(m_keyCountMutex);
+                const auto nodeKeyCount = getNodeKeyCount(nodeId);
+                lock.unlock();
+                if (nodeKeyCount < distance) {
+                    distance -= nodeKeyCount;
+                    fileKeyCount += nodeKeyCount;
+                    continue;
+                }
+            }
+
+            // Scan node
+            const auto node = getNodeChecked(nodeId);
+            for (auto record = node->m_data + recordId * m_recordSize;
+                    recordId < m_numberOfRecordsPerNode; ++recordId, record += m_recordSize) {
+                if (*record == kValueStateExists && --distance == 0) {
+                    const std::uint64_t numericKey =
+                            (nodeId - 1) * m_numberOfRecordsPerNode + recordId;
+                    encodeKey(numericKey, keyAfter);
+                    ULI_DBG_LOG_DEBUG("Index " << getDisplayName()
+                                               << ": getNthKeyAfter: result=" << numericKey);
+                    return true;
+                }
+            }
+        }
+
+        if (isWholeFile) {
+            std::lock_guard lock(m_keyCountMutex);
+            m_fileKeyCounts.emplace(fileId, fileKeyCount);
+        }
+
+        // Step to next file
+        if (++fileIter == m_fileIds.cend()) {
+            ULI_DBG_LOG_DEBUG("Index " << getDisplayName() << ": getNthKeyAfter: no more files");
+            return false;
+        }
+        fileId = *fileIter;
+        nodeId = (fileId - 1) * m_numberOfNodesPerFile + 1;
+        recordId = 0;
+    }
+}
+
+std::uint64_t UniqueLinearIndex::getNodeKeyCount(std::uint64_t nodeId)
+{
+    const auto it = m_nodeKeyCounts.find(nodeId);
+    if (it != m_nodeKeyCounts.end()) return it->second;
+
+    const auto node = getNodeChecked(nodeId);
+    std::uint64_t keyCount = 0;
+    auto record = node->m_data;
+    for (std::size_t i = 0; i < m_numberOfRecordsPerNode; ++i, record += m_recordSize) {
+        if (*record == kValueStateExists) ++keyCount;
+    }
+    m_nodeKeyCounts.emplace(nodeId, keyCount);
+    return keyCount;
+}
+
+void UniqueLinearIndex::updateKeyCounts(std::uint64_t nodeId, bool inserted)
+{
+    const auto keyCount = m_keyCount.load();
+    if (keyCount != kUnknownKeyCount) m_keyCount = inserted ? keyCount + 1 : keyCount - 1;
+    const auto nodeIt = m_nodeKeyCounts.find(nodeId);
+    if (nodeIt != m_nodeKeyCounts.end()) {
+        if (inserted)
+            ++nodeIt->second;
+        else
+            --nodeIt->second;
+    }
+    const auto fileIt = m_fileKeyCounts.find(getFileIdForNode(nodeId));
+    if (fileIt != m_fileKeyCounts.end()) {
+        if (inserted)
+            ++fileIt->second;
+        else
+            --fileIt->second;
+    }
+}
+
 void UniqueLinearIndex::updateMinMaxKeysAfterRemoval(const void* key)
 {
     // Update min and max keys
@@ -903,13 +1182,18 @@ std::uint64_t UniqueLinearIndex::computeMaxPossibleNodeId() const noexcept
 
 std::uint8_t* UniqueLinearIndex::IndexFileHeader::serialize(std::uint8_t* buffer) const noexcept
 {
-    return IndexFileHeaderBase::serialize(buffer);
+    buffer = IndexFileHeaderBase::serialize(buffer);
+    buffer = ::pbeEncodeUInt32(m_flags, buffer);
+    return ::pbeEncodeUInt64(m_keyCount, buffer);
 }
 
 const std::uint8_t* UniqueLinearIndex::IndexFileHeader::deserialize(
         const std::uint8_t* buffer) noexcept
 {
-    return IndexFileHeaderBase::deserialize(buffer);
+    buffer = IndexFileHeaderBase::deserialize(buffer);
+    if (!buffer) return nullptr;
+    buffer = ::pbeDecodeUInt32(buffer, &m_flags);
+    return ::pbeDecodeUInt64(buffer, &m_keyCount);
 }
 
 }  // namespace siodb::iomgr::dbengine
@@ -15,7 +15,11 @@
 
 // STL headers
 #include <atomic>
+#include <limits>
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace siodb::iomgr::dbengine {
 
@@ -53,6 +57,9 @@ protected:
             std::size_t valueSize, KeyCompareFunction keyCompare);
 
 public:
+    /** De-initializes object of class UniqueLinearIndex. */
+    ~UniqueLinearIndex();
+
     /**
      * Returns number of nodes per file.
      * @return Number of nodes per file.
@@ -113,6 +120,14 @@ public:
      */
     std::uint64_t getValue(const void* key, void* value, std::size_t count) override;
 
+    /**
+     * Gets value stored for the key marked as deleted.
+     * @param key A key buffer.
+     * @param value An output buffer.
+     * @return true if key is marked as deleted and value copied, false otherwise.
+     */
+    bool getDeletedValue(const void* key, void* value) override;
+
     /**
      * Counts how much values available for this key.
      * @param key A key buffer.
@@ -120,6 +135,14 @@ public:
      */
     std::uint64_t count(const void* key) override;
 
+    /**
+     * Returns number of live (not deleted) keys in the index.
+     * Key counts of the index files are stored in the file headers. Files which lost
+     * key count due to unclean shutdown are counted on the first call.
+     * @return Number of keys.
+     */
+    std::optional<std::uint64_t> getKeyCount() override;
+
     /**
      * Returns minimum key in the index.
      * @param key Buffer for storing key.
@@ -164,12 +187,24 @@ public:
      */
     bool getNextKey(const void* key, void* nextKey) override;
 
+    /**
+     * Returns key which follows given key by the given number of keys in the index.
+     * Nodes and files, which have not enough keys, are skipped using key counts.
+     * @param key Current key.
+     * @param distance Number of keys to step over, must be positive.
+     * @param nextKey Buffer for storing next key.
+     * @return true if key obtained, false if index has less keys after current one.
+     */
+    bool getNthNextKey(const void* key, std::uint64_t distance, void* nextKey) override;
+
 private:
     /** Index file header */
     struct IndexFileHeader : public IndexFileHeaderBase {
         /** Initialized object of class Header */
         IndexFileHeader()
             : IndexFileHeaderBase(IndexType::kBPlusTreeIndex)
+            , m_flags(0)
+            , m_keyCount(0)
         {
         }
 
@@ -186,8 +221,18 @@ private:
          */
         const std::uint8_t* deserialize(const std::uint8_t* buffer) noexcept;
 
+        /** Header flags */
+        std::uint32_t m_flags;
+
+        /** Number of live keys in the file, valid only if kKeyCountValidFlag is set */
+        std::uint64_t m_keyCount;
+
+        /** Flag indicating that key count matches nodes stored in the file */
+        static constexpr std::uint32_t kKeyCountValidFlag = 1;
+
         /** Serialized size */
-        static constexpr std::size_t kSerializedSize = IndexFileHeaderBase::kSerializedSize;
+        static constexpr std::size_t kSerializedSize =
+                IndexFileHeaderBase::kSerializedSize + sizeof(m_flags) + sizeof(m_keyCount);
     };
 
 private:
@@ -213,6 +258,32 @@ private:
      */
     io::FilePtr openIndexFile(std::uint64_t fileId) const;
 
+    /**
+     * Returns data of the existing index file.
+     * @param fileId File ID.
+     * @return File data object.
+     */
+    uli::FileDataPtr getFileData(std::uint64_t fileId);
+
+    /**
+     * Writes index file header.
+     * @param fileData Index file data.
+     * @param keyCount Number of keys in the file or std::nullopt if it is not valid.
+     */
+    void writeIndexFileHeader(
+            const uli::FileData& fileData, const std::optional<std::uint64_t>& keyCount) const;
+
+    /** Reads key counts from headers of the existing index files. */
+    void loadFileKeyCounts();
+
+    /**
+     * Invalidates key count stored in the index file header before the number of keys
+     * in the file changes, so that key count is never valid for the nodes written to disk
+     * after last flush. Must be called with key count mutex locked.
+     * @param fileId File ID.
+     */
+    void invalidateStoredKeyCount(std::uint64_t fileId);
+
     /**
      * Returns node with given ID.
      * @param nodeId A node Id.
@@ -405,6 +476,39 @@ private:
      */
     bool getKeyAfter(const void* key, void* keyAfter);
 
+    /**
+     * Gets key after given key by the given number of keys in the index.
+     * @param key A key.
+     * @param distance Number of keys to step over, must be greater than 1.
+     * @param keyAfter Buffer for a key after.
+     * @return true if key after exists, false if not.
+     */
+    bool getNthKeyAfter(const void* key, std::uint64_t distance, void* keyAfter);
+
+    /**
+     * Returns number of live keys in the node. Counts keys on the first call,
+     * after that counter is maintained by the index modification operations.
+     * Must be called with key count mutex locked.
+     * @param nodeId Node ID.
+     * @return Number of keys.
+     */
+    std::uint64_t getNodeKeyCount(std::uint64_t nodeId);
+
+    /**
+     * Updates known key counts of the index, node and file after key insertion or removal.
+     * Must be called with key count mutex locked.
+     * @param nodeId Node ID.
+     * @param inserted Indication that key was inserted, otherwise it was removed.
+     */
+    void updateKeyCounts(std::uint64_t nodeId, bool inserted);
+
+    /**
+     * Counts live keys in the index file.
+     * @param fileId File ID.
+     * @return Number of keys.
+     */
+    std::uint64_t countFileKeys(std::uint64_t fileId);
+
     /**
      * Updates min and max keys after erasing/deletion.
      * @param key A deleteable key.
@@ -490,6 +594,27 @@ private:
     /** Actual maximum key */
     BinaryValue m_maxKey;
 
+    /** Number of live keys, kUnknownKeyCount until key counts of all files are known */
+    std::atomic<std::uint64_t> m_keyCount;
+
+    /** Key counts synchronization object */
+    mutable std::mutex m_keyCountMutex;
+
+    /** Numbers of live keys per node, known only for nodes requested before */
+    std::unordered_map<std::uint64_t, std::uint64_t> m_nodeKeyCounts;
+
+    /**
+     * Numbers of live keys per file, known for files with valid key count in the header
+     * and for files counted or skipped before.
+     */
+    std::unordered_map<std::uint64_t, std::uint64_t> m_fileKeyCounts;
+
+    /** Files which headers store valid key count */
+    std::unordered_set<std::uint64_t> m_fileIdsWithStoredKeyCount;
+
+    /** Key count value which indicates that actual value is not known */
+    static constexpr std::uint64_t kUnknownKeyCount = std::numeric_limits<std::uint64_t>::max();
+
     /** File cache capacity */
     static constexpr std::size_t kFileCacheCapacity = 20;
 };
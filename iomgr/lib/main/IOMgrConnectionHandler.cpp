@@ -8,54 +8,114 @@
 #include "../dbengine/SessionGuard.h"
 #include "../dbengine/handlers/RequestHandler.h"
 #include "../dbengine/parser/DBEngineRequestFactory.h"
+#include "../dbengine/parser/PreparedStatement.h"
 #include "../dbengine/parser/SqlParser.h"
 
 // Common project headers
-#include <siodb/common/io/FdIo.h>
 #include <siodb/common/log/Log.h>
 #include <siodb/common/net/ConnectionError.h>
-#include <siodb/common/net/EpollHelpers.h>
 #include <siodb/common/protobuf/ProtobufMessageIO.h>
-#include <siodb/common/utils/ErrorCodeChecker.h>
 #include <siodb/common/utils/SignalHandlers.h>
 
 // Protobuf message headers
 #include <siodb/common/proto/IOManagerProtocol.pb.h>
 
-// System headers
-#include <sys/epoll.h>
-
 namespace siodb::iomgr {
 
+namespace {
+
+/**
+ * Converts protocol value into variant.
+ * @param value Protocol value.
+ * @return Variant with the same value.
+ */
+dbengine::Variant convertParameterValue(const TypedValue& value)
+{
+    switch (value.value_case()) {
+        case TypedValue::kBoolValue: return dbengine::Variant(value.bool_value());
+        case TypedValue::kIntValue: return dbengine::Variant(value.int_value());
+        case TypedValue::kUintValue: return dbengine::Variant(value.uint_value());
+        case TypedValue::kFloatValue: return dbengine::Variant(value.float_value());
+        case TypedValue::kDoubleValue: return dbengine::Variant(value.double_value());
+        case TypedValue::kStringValue: return dbengine::Variant(value.string_value());
+        case TypedValue::kBinaryValue: {
+            const auto& data = value.binary_value();
+            return dbengine::Variant(data.data(), data.size());
+        }
+        default: return dbengine::Variant();
+    }
+}
+
+}  // namespace
+
 IOMgrConnectionHandler::IOMgrConnectionHandler(
-        FileDescriptorGuard&& clientFd, const dbengine::InstancePtr& instance)
-    : m_instance(instance)
+        std::unique_ptr<net::MultiplexedSessionIo>&& clientIo,
+        const dbengine::InstancePtr& instance, UniversalWorkerPool& workerThreadPool)
+    : m_clientIo(std::move(clientIo))
+    , m_connected(true)
+    , m_state(State::kBeginAuthentication)
+    , m_instance(instance)
+    , m_workerThreadPool(workerThreadPool)
+    , m_lastStatementId(0)
 {
-    auto clientIo = std::make_unique<siodb::io::FdIo>(clientFd.getFd(), false);
-    m_clientEpollFd.reset(net::createEpollFd(clientFd.getFd(), EPOLLIN));
-    clientFd.release();
-    clientIo->setAutoClose(true);
-    m_clientIo = std::move(clientIo);
-
-    // Start thread only after IO is initialized
-    m_thread = std::make_unique<std::thread>(&IOMgrConnectionHandler::threadMain, this);
 }
 
 IOMgrConnectionHandler::~IOMgrConnectionHandler()
 {
     closeConnection();
-
-    if (m_thread->joinable()) {
-        ::pthread_kill(m_thread->native_handle(), SIGUSR1);
-        m_thread->join();
-    }
 }
 
 void IOMgrConnectionHandler::closeConnection() noexcept
 {
+    if (!m_connected) return;
     LOG_DEBUG << kLogContext << "Closing connection";
-    m_clientEpollFd.reset();
+    // Request handler refers to the client IO, so it goes first
+    m_requestHandler.reset();
+    m_sessionGuard.reset();
     m_clientIo.reset();
+    m_connected = false;
+}
+
+void IOMgrConnectionHandler::handleRequest()
+{
+    if (!m_connected) return;
+
+    switch (m_state) {
+        case State::kBeginAuthentication: {
+            try {
+                beginUserAuthentication();
+                m_state = State::kAuthentication;
+            } catch (std::exception& ex) {
+                LOG_DEBUG << kLogContext << ex.what();
+                closeConnection();
+            }
+            break;
+        }
+        case State::kAuthentication: {
+            try {
+                const auto authPair = authenticateUser();
+                m_sessionGuard = std::make_unique<dbengine::SessionGuard>(
+                        m_instance, authPair.second);
+                m_requestHandler = std::make_unique<dbengine::RequestHandler>(
+                        *m_instance, *m_clientIo, authPair.first, &m_workerThreadPool);
+                m_state = State::kSession;
+            } catch (std::exception& ex) {
+                LOG_DEBUG << kLogContext << ex.what();
+                closeConnection();
+            }
+            break;
+        }
+        case State::kSession: {
+            try {
+                handleDatabaseEngineRequest();
+            } catch (std::exception& ex) {
+                LOG_ERROR << kLogContext << ex.what() << '.';
+                // Session is closed when client doesn't read responses for too long
+                if (!m_clientIo->isValid()) closeConnection();
+            }
+            break;
+        }
+    }
 }
 
 void IOMgrConnectionHandler::respondToServerWithError(int requestId, const char* text, int errCode)
@@ -69,14 +129,97 @@ void IOMgrConnectionHandler::respondToServerWithError(int requestId, const char*
             protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, *m_clientIo);
 }
 
+void IOMgrConnectionHandler::prepareStatement(const iomgr_protocol::DatabaseEngineRequest& request)
+{
+    if (m_preparedStatements.size() >= kMaxPreparedStatementCount) {
+        respondToServerWithError(
+                request.request_id(), "Too many prepared statements", kInternalError);
+        return;
+    }
+
+    std::unique_ptr<dbengine::parser::PreparedStatement> statement;
+    try {
+        statement = std::make_unique<dbengine::parser::PreparedStatement>(
+                std::string(request.text()));
+    } catch (std::exception& ex) {
+        LOG_DEBUG << kLogContext << "Sending prepare error: " << ex.what();
+        respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
+        return;
+    }
+
+    const auto statementId = ++m_lastStatementId;
+    iomgr_protocol::DatabaseEngineResponse response;
+    response.set_request_id(request.request_id());
+    response.set_statement_id(statementId);
+    response.set_parameter_count(statement->getParameterCount());
+    m_preparedStatements.emplace(statementId, std::move(statement));
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, *m_clientIo);
+}
+
+void IOMgrConnectionHandler::executePreparedStatement(
+        const iomgr_protocol::DatabaseEngineRequest& request,
+        dbengine::RequestHandler& requestHandler)
+{
+    const auto it = m_preparedStatements.find(request.statement_id());
+    if (it == m_preparedStatements.end()) {
+        respondToServerWithError(
+                request.request_id(), "Prepared statement doesn't exist", kSqlParseError);
+        return;
+    }
+
+    dbengine::requests::DBEngineRequestPtr dbeRequest;
+    try {
+        std::vector<dbengine::Variant> values;
+        values.reserve(request.parameter_size());
+        for (const auto& parameter : request.parameter())
+            values.push_back(convertParameterValue(parameter));
+        dbeRequest = it->second->createRequest(values);
+    } catch (std::exception& ex) {
+        LOG_DEBUG << kLogContext << "Sending parameter binding error " << ex.what();
+        respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
+        return;
+    }
+
+    try {
+        LOG_DEBUG << kLogContext << "Executing prepared statement #" << request.statement_id();
+        requestHandler.executeRequest(*dbeRequest, request.request_id(), 0, 1);
+    } catch (std::exception& ex) {
+        LOG_ERROR << kLogContext << "Request execution exception: " << ex.what() << '.';
+        respondToServerWithError(request.request_id(), ex.what(), kInternalError);
+    }
+}
+
+void IOMgrConnectionHandler::closePreparedStatement(
+        const iomgr_protocol::DatabaseEngineRequest& request)
+{
+    if (m_preparedStatements.erase(request.statement_id()) == 0) {
+        respondToServerWithError(
+                request.request_id(), "Prepared statement doesn't exist", kSqlParseError);
+        return;
+    }
+
+    iomgr_protocol::DatabaseEngineResponse response;
+    response.set_request_id(request.request_id());
+    protobuf::writeMessage(
+            protobuf::ProtocolMessageType::kDatabaseEngineResponse, response, *m_clientIo);
+}
+
+void IOMgrConnectionHandler::readClientMessage(
+        protobuf::ProtocolMessageType messageType, google::protobuf::MessageLite& message)
+{
+    std::vector<std::uint8_t> messageData;
+    if (!m_clientIo->readMessage(messageData))
+        throw net::ConnectionError("Client session is closed");
+    protobuf::parseMessage(messageType, message, messageData.data(), messageData.size());
+}
+
 void IOMgrConnectionHandler::beginUserAuthentication()
 {
-    // Allow EINTR to cause I/O error when exit signal detected.
-    const utils::ExitSignalAwareErrorCodeChecker errorCodeChecker;
     iomgr_protocol::BeginAuthenticateUserRequest beginUserAuthenticationRequest;
-    LOG_DEBUG << kLogContext << "Waiting for BeginAuthenticateUserRequest...";
-    protobuf::readMessage(protobuf::ProtocolMessageType::kBeginAuthenticateUserRequest,
-            beginUserAuthenticationRequest, *m_clientIo, errorCodeChecker);
+    LOG_DEBUG << kLogContext << "Reading BeginAuthenticateUserRequest...";
+    readClientMessage(protobuf::ProtocolMessageType::kBeginAuthenticateUserRequest,
+            beginUserAuthenticationRequest);
 
     LOG_DEBUG << kLogContext << "BeginAuthenticateUserRequest received";
 
@@ -105,12 +248,9 @@ void IOMgrConnectionHandler::beginUserAuthentication()
 
 std::pair<std::uint32_t, Uuid> IOMgrConnectionHandler::authenticateUser()
 {
-    // Allow EINTR to cause I/O error when exit signal detected.
-    const utils::ExitSignalAwareErrorCodeChecker errorCodeChecker;
     iomgr_protocol::AuthenticateUserRequest authRequest;
-    LOG_DEBUG << kLogContext << "Waiting for authentication request...";
-    protobuf::readMessage(protobuf::ProtocolMessageType::kAuthenticateUserRequest, authRequest,
-            *m_clientIo, errorCodeChecker);
+    LOG_DEBUG << kLogContext << "Reading authentication request...";
+    readClientMessage(protobuf::ProtocolMessageType::kAuthenticateUserRequest, authRequest);
 
     LOG_DEBUG << kLogContext << "Client authentication request received";
 
@@ -140,93 +280,105 @@ std::pair<std::uint32_t, Uuid> IOMgrConnectionHandler::authenticateUser()
     return authPair;
 }
 
-void IOMgrConnectionHandler::threadMain()
+void IOMgrConnectionHandler::handleDatabaseEngineRequest()
 {
-    std::pair<std::uint32_t, Uuid> authPair;
+    // Read message from client
+    iomgr_protocol::DatabaseEngineRequest request;
+    LOG_DEBUG << kLogContext << "Reading request...";
     try {
-        beginUserAuthentication();
-        authPair = authenticateUser();
-    } catch (std::exception& e) {
+        readClientMessage(protobuf::ProtocolMessageType::kDatabaseEngineRequest, request);
+    } catch (net::ConnectionError& err) {
+        LOG_DEBUG << kLogContext << "Client disconnected.";
+        // Connection was closed or hangup. No reading operation was in progress
+        closeConnection();
+        return;
+    } catch (std::exception& ex) {
         closeConnection();
+        if (!utils::isExitEventSignaled()) LOG_ERROR << kLogContext << ex.what() << '.';
         return;
     }
 
-    dbengine::SessionGuard guard(m_instance, authPair.second);
-    // Allow EINTR to cause I/O error when exit signal detected.
-    const utils::ExitSignalAwareErrorCodeChecker errorCodeChecker;
-    dbengine::RequestHandler requestHandler(*m_instance, *m_clientIo, authPair.first);
-    while (m_clientIo->isValid()) {
+    LOG_DEBUG << kLogContext << "Received request: id: " << request.request_id()
+              << ", text: " << request.text();
+
+    if (request.close_statement()) {
+        closePreparedStatement(request);
+        return;
+    }
+
+    if (request.prepare()) {
+        prepareStatement(request);
+        return;
+    }
+
+    auto& requestHandler = *m_requestHandler;
+    if (request.statement_id() != 0) {
+        executePreparedStatement(request, requestHandler);
+        return;
+    }
+
+    // Single DML statements are taken from the statement cache
+    dbengine::requests::DBEngineRequestPtr cachedRequest;
+    try {
+        cachedRequest = m_instance->getStatementCache().createRequest(request.text());
+    } catch (std::exception& ex) {
+        LOG_DEBUG << kLogContext << "Sending request parse error " << ex.what();
+        respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
+        return;
+    }
+
+    if (cachedRequest) {
         try {
-            // Read message from client
-            iomgr_protocol::DatabaseEngineRequest request;
-            LOG_DEBUG << kLogContext << "Waiting for request...";
-            try {
-                // NOTE: In case of the TCP connection close or abort,
-                // we can receive an empty message
-                net::epollWaitForData(m_clientEpollFd.getFd(), true);
-                protobuf::readMessage(protobuf::ProtocolMessageType::kDatabaseEngineRequest,
-                        request, *m_clientIo, errorCodeChecker);
-            } catch (net::ConnectionError& err) {
-                LOG_DEBUG << kLogContext << "Client disconnected.";
-                // Connection was closed or hangup. No reading operation was in progress
-                closeConnection();
-                return;
-            } catch (std::exception& ex) {
-                closeConnection();
-                if (!utils::isExitEventSignaled()) LOG_ERROR << kLogContext << ex.what() << '.';
-                return;
-            }
+            requestHandler.executeRequest(*cachedRequest, request.request_id(), 0, 1);
+        } catch (std::exception& ex) {
+            LOG_ERROR << kLogContext << "Request execution exception: " << ex.what() << '.';
+            respondToServerWithError(request.request_id(), ex.what(), kInternalError);
+        }
+        return;
+    }
 
-            LOG_DEBUG << kLogContext << "Received request: id: " << request.request_id()
-                      << ", text: " << request.text();
+    dbengine::parser::SqlParser parser(request.text());
+    try {
+        parser.parse();
+    } catch (std::exception& ex) {
+        LOG_DEBUG << kLogContext << "Sending common parse error: " << ex.what();
+        respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
+        LOG_DEBUG << kLogContext << "Sent common parse error.";
+        return;
+    }
 
-            dbengine::parser::SqlParser parser(request.text());
-            try {
-                parser.parse();
-            } catch (std::exception& ex) {
-                LOG_DEBUG << kLogContext << "Sending common parse error: " << ex.what();
-                respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
-                LOG_DEBUG << kLogContext << "Sent common parse error.";
-                continue;
-            }
+    // For now just dump each statement
+    const auto statementCount = parser.getStatementCount();
+    for (std::size_t i = 0; i < statementCount; ++i) {
+        // Fill request
+        dbengine::requests::DBEngineRequestPtr dbeRequest;
+        try {
+            LOG_DEBUG << [i, &parser]() {
+                std::ostringstream oss;
+                oss << kLogContext << "Statement #" << i << ":\n";
+                parser.dump(parser.findStatement(i), oss);
+                return oss.str();
+            }();
+            LOG_DEBUG << kLogContext << "Parsing statement #" << i;
+            dbeRequest = dbengine::parser::DBEngineRequestFactory::createRequest(
+                    parser.findStatement(i));
+        } catch (std::exception& ex) {
+            LOG_DEBUG << kLogContext << "Sending request parse error " << ex.what();
+            respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
+            LOG_DEBUG << kLogContext << "Sent request parse error";
+            // Stop loop  after response with an error
+            break;
+        }
 
-            // For now just dump each statement
-            const auto statementCount = parser.getStatementCount();
-            for (std::size_t i = 0; i < statementCount; ++i) {
-                // Fill request
-                dbengine::requests::DBEngineRequestPtr dbeRequest;
-                try {
-                    LOG_DEBUG << [i, &parser]() {
-                        std::ostringstream oss;
-                        oss << kLogContext << "Statement #" << i << ":\n";
-                        parser.dump(parser.findStatement(i), oss);
-                        return oss.str();
-                    }();
-                    LOG_DEBUG << kLogContext << "Parsing statement #" << i;
-                    dbeRequest = dbengine::parser::DBEngineRequestFactory::createRequest(
-                            parser.findStatement(i));
-                } catch (std::exception& ex) {
-                    LOG_DEBUG << kLogContext << "Sending request parse error " << ex.what();
-                    respondToServerWithError(request.request_id(), ex.what(), kSqlParseError);
-                    LOG_DEBUG << kLogContext << "Sent request parse error";
-                    // Stop loop  after response with an error
-                    break;
-                }
-
-                // Execute request
-                try {
-                    LOG_DEBUG << kLogContext << "Executing statement #" << i;
-                    requestHandler.executeRequest(
-                            *dbeRequest, request.request_id(), i, statementCount);
-                } catch (std::exception& ex) {
-                    LOG_ERROR << kLogContext << "Request execution exception: " << ex.what() << '.';
-                    respondToServerWithError(request.request_id(), ex.what(), kInternalError);
-                    // Stop loop  after response with an error
-                    break;
-                }
-            }
+        // Execute request
+        try {
+            LOG_DEBUG << kLogContext << "Executing statement #" << i;
+            requestHandler.executeRequest(*dbeRequest, request.request_id(), i, statementCount);
         } catch (std::exception& ex) {
-            LOG_ERROR << kLogContext << ex.what() << '.';
+            LOG_ERROR << kLogContext << "Request execution exception: " << ex.what() << '.';
+            respondToServerWithError(request.request_id(), ex.what(), kInternalError);
+            // Stop loop  after response with an error
+            break;
         }
     }
 }
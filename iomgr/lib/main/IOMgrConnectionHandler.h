@@ -6,28 +6,52 @@
 
 // Project headers
 #include "ClientSession.h"
+#include "UniversalWorkerPool.h"
 #include "../dbengine/InstancePtr.h"
 
 // Common project headers
-#include <siodb/common/io/IoBase.h>
-#include <siodb/common/utils/FileDescriptorGuard.h>
+#include <siodb/common/net/MultiplexedSessionIo.h>
+#include <siodb/common/protobuf/SiodbProtocolMessageType.h>
 #include <siodb/common/utils/HelperMacros.h>
 
 // STL headers
 #include <atomic>
-#include <thread>
+#include <unordered_map>
+
+namespace google::protobuf {
+class MessageLite;
+}  // namespace google::protobuf
+
+namespace siodb::iomgr_protocol {
+class DatabaseEngineRequest;
+}  // namespace siodb::iomgr_protocol
+
+namespace siodb::iomgr::dbengine {
+class RequestHandler;
+class SessionGuard;
+}  // namespace siodb::iomgr::dbengine
+
+namespace siodb::iomgr::dbengine::parser {
+class PreparedStatement;
+}  // namespace siodb::iomgr::dbengine::parser
 
 namespace siodb::iomgr {
 
-/** Handler for the Siodb server connection */
+/**
+ * Handler for the Siodb server session. Doesn't own a thread: connection manager
+ * waits until complete message of the session is received and calls handleRequest()
+ * on a worker thread.
+ */
 class IOMgrConnectionHandler final {
 public:
     /**
      * Initializes object of class IOMgrConnectionHandler.
-     * @param clientFd Client connection file descriptor guard.
+     * @param clientIo Client session IO.
      * @param instance Instance
+     * @param workerThreadPool Worker thread pool used for the parallel request execution.
      */
-    IOMgrConnectionHandler(FileDescriptorGuard&& clientFd, const dbengine::InstancePtr& instance);
+    IOMgrConnectionHandler(std::unique_ptr<net::MultiplexedSessionIo>&& clientIo,
+            const dbengine::InstancePtr& instance, UniversalWorkerPool& workerThreadPool);
 
     /**
      * Cleans up object
@@ -36,14 +60,22 @@ public:
 
     DECLARE_NONCOPYABLE(IOMgrConnectionHandler);
 
-    /** returns wheiter thread body is active or not
-     * @return wheiter thread body is active or not
+    /** returns wheiter connection is active or not
+     * @return wheiter connection is active or not
      */
-    bool isConnected() noexcept
+    bool isConnected() const noexcept
     {
-        return m_clientIo->isValid();
+        return m_connected;
     }
 
+    /**
+     * Reads next message from the client and handles it: authentication messages
+     * until user is authenticated, database engine requests after that.
+     * Must be called only when complete client message is received or session is closed,
+     * and never concurrently.
+     */
+    void handleRequest();
+
     /**
      * Closes connection with Siodb server
      */
@@ -62,6 +94,16 @@ private:
      */
     void respondToServerWithError(int requestId, const char* text, int errCode);
 
+    /**
+     * Takes next client message, which is already received completely.
+     * @param messageType Expected message type.
+     * @param message Message object.
+     * @throw ConnectionError if session is closed.
+     * @throw SiodbProtocolError if message is invalid.
+     */
+    void readClientMessage(
+            protobuf::ProtocolMessageType messageType, google::protobuf::MessageLite& message);
+
     /**
      * Receives BeginAuthenticateUser request and verifies user name and active keys count.
      */
@@ -73,11 +115,43 @@ private:
      */
     std::pair<std::uint32_t, Uuid> authenticateUser();
 
-    /** Thread body of connection handler, waits for command, executes it and sends response.
+    /**
+     * Prepares statement from the request text and responds with statement ID
+     * and number of parameters.
+     * @param request Request from the server.
+     */
+    void prepareStatement(const iomgr_protocol::DatabaseEngineRequest& request);
+
+    /**
+     * Executes prepared statement with parameter values from the request.
+     * @param request Request from the server.
+     * @param requestHandler Request handler.
+     */
+    void executePreparedStatement(const iomgr_protocol::DatabaseEngineRequest& request,
+            dbengine::RequestHandler& requestHandler);
+
+    /**
+     * Closes prepared statement.
+     * @param request Request from the server.
      */
-    void threadMain();
+    void closePreparedStatement(const iomgr_protocol::DatabaseEngineRequest& request);
+
+    /** Reads database engine request, executes it and sends response. */
+    void handleDatabaseEngineRequest();
 
 private:
+    /** Connection handler states */
+    enum class State {
+        /** Waiting for BeginAuthenticateUser request */
+        kBeginAuthentication,
+
+        /** Waiting for AuthenticateUser request */
+        kAuthentication,
+
+        /** User is authenticated, waiting for database engine requests */
+        kSession,
+    };
+
     /** Error codes enumeration */
     enum {
         /** SQL parsing error */
@@ -87,11 +161,14 @@ private:
         kInternalError = 3,
     };
 
-    /** A file descriptor for polling connection with Client */
-    FileDescriptorGuard m_clientEpollFd;
+    /** Client session IO */
+    std::unique_ptr<net::MultiplexedSessionIo> m_clientIo;
+
+    /** Connection status */
+    std::atomic<bool> m_connected;
 
-    /** Client connection IO */
-    std::unique_ptr<siodb::io::IoBase> m_clientIo;
+    /** Connection handler state */
+    State m_state;
 
     /** User name */
     std::string m_userName;
@@ -99,8 +176,24 @@ private:
     /** DBMS instance */
     dbengine::InstancePtr m_instance;
 
-    /** Thread for protobuf commmunication with Siodb */
-    std::unique_ptr<std::thread> m_thread;
+    /** Worker thread pool */
+    UniversalWorkerPool& m_workerThreadPool;
+
+    /** Session guard, ends session when connection is closed */
+    std::unique_ptr<dbengine::SessionGuard> m_sessionGuard;
+
+    /** Request handler of the authenticated session */
+    std::unique_ptr<dbengine::RequestHandler> m_requestHandler;
+
+    /** Prepared statements of the session */
+    std::unordered_map<std::uint64_t, std::unique_ptr<dbengine::parser::PreparedStatement>>
+            m_preparedStatements;
+
+    /** Last prepared statement ID */
+    std::uint64_t m_lastStatementId;
+
+    /** Maximum number of prepared statements per session */
+    static constexpr std::size_t kMaxPreparedStatementCount = 1024;
 
     /** Log context name */
     static constexpr const char* kLogContext = "IOMgrConnectionHandler: ";
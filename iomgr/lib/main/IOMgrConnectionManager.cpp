@@ -7,19 +7,77 @@
 // Common project headers
 #include <siodb/common/log/Log.h>
 #include <siodb/common/net/ConnectionError.h>
+#include <siodb/common/net/MultiplexedSessionIo.h>
 #include <siodb/common/net/TcpServer.h>
 #include <siodb/common/utils/Debug.h>
 #include <siodb/common/utils/FileDescriptorGuard.h>
 
+// STL headers
+#include <array>
+
 // System headers
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <pthread.h>
 #include <signal.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 
 namespace siodb::iomgr {
 
+namespace {
+
+/**
+ * Creates epoll file descriptor.
+ * @return epoll file descriptor.
+ * @throw std::system_error if epoll file descriptor could not be created.
+ */
+int createReactorEpollFd()
+{
+    const int fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (fd < 0) {
+        const int errorCode = errno;
+        throw std::system_error(errorCode, std::generic_category(), "epoll_create1() failed");
+    }
+    return fd;
+}
+
+}  // namespace
+
+class IOMgrConnectionManager::SessionRequest final : public IORequest {
+public:
+    /**
+     * Initializes object of class SessionRequest.
+     * @param connectionManager Connection manager.
+     * @param sessionKey Session key.
+     * @param connectionHandler Session handler.
+     */
+    SessionRequest(IOMgrConnectionManager& connectionManager, const SessionKey& sessionKey,
+            const std::shared_ptr<IOMgrConnectionHandler>& connectionHandler) noexcept
+        : m_connectionManager(connectionManager)
+        , m_sessionKey(sessionKey)
+        , m_connectionHandler(connectionHandler)
+    {
+    }
+
+    /** Handles incoming data, then schedules session again or removes closed session. */
+    void execute() override
+    {
+        m_connectionHandler->handleRequest();
+        m_connectionManager.finishSessionRequest(m_sessionKey);
+    }
+
+private:
+    /** Connection manager */
+    IOMgrConnectionManager& m_connectionManager;
+
+    /** Session key */
+    const SessionKey m_sessionKey;
+
+    /** Session handler */
+    const std::shared_ptr<IOMgrConnectionHandler> m_connectionHandler;
+};
+
 IOMgrConnectionManager::IOMgrConnectionManager(int socketDomain,
         const config::ConstInstaceOptionsPtr& instanceOptions,
         const dbengine::InstancePtr& instance)
@@ -28,11 +86,13 @@ IOMgrConnectionManager::IOMgrConnectionManager(int socketDomain,
     , m_dbOptions(instanceOptions)
     , m_exitRequested(false)
     , m_instance(instance)
+    , m_epollFd(createReactorEpollFd())
+    , m_lastConnectionId(0)
     // IMPORTANT: all next class members must be declared and initialized
     // exactly in this order and after all other members
-    , m_workerThreadPool(
-              createWorkerThreadPool(instanceOptions->m_ioManagerOptions.m_workerThreadNumber))
+    , m_workerThreadPool(instanceOptions->m_ioManagerOptions.m_workerThreadNumber)
     , m_connectionListenerThread(&IOMgrConnectionManager::connectionListenerThreadMain, this)
+    , m_reactorThread(&IOMgrConnectionManager::reactorThreadMain, this)
     , m_deadConnectionRecyclerThread(&IOMgrConnectionManager::removeDeadConnections, this)
 {
 }
@@ -48,6 +108,12 @@ IOMgrConnectionManager::~IOMgrConnectionManager()
         m_connectionListenerThread.join();
     }
 
+    // Stop reactor thread
+    if (m_reactorThread.joinable()) {
+        ::pthread_kill(m_reactorThread.native_handle(), SIGUSR1);
+        m_reactorThread.join();
+    }
+
     // Stop dead connection recycler thread
     if (m_deadConnectionRecyclerThread.joinable()) {
         ::pthread_kill(m_deadConnectionRecyclerThread.native_handle(), SIGUSR1);
@@ -102,10 +168,182 @@ void IOMgrConnectionManager::connectionListenerThreadMain()
         // Validate connection file descriptor
         if (!fdGuard.isValidFd()) continue;
 
-        m_connectionHandlers.emplace_back(std::move(fdGuard), m_instance);
+        try {
+            addConnection(std::move(fdGuard));
+        } catch (std::exception& ex) {
+            LOG_ERROR << m_socketTypeName << kLogContext << "Can't add connection: " << ex.what()
+                      << '.';
+        }
+    }
+}
+
+void IOMgrConnectionManager::reactorThreadMain()
+{
+    std::array<struct epoll_event, kMaxEpollEventCount> events;
+    while (!m_exitRequested) {
+        const int eventCount =
+                ::epoll_wait(m_epollFd.getFd(), events.data(), kMaxEpollEventCount, -1);
+        if (eventCount < 0) {
+            const int errorCode = errno;
+            if (errorCode == EINTR) continue;
+            LOG_FATAL << m_socketTypeName << kLogContext
+                      << "epoll_wait() failed: " << std::strerror(errorCode) << '.';
+            if (kill(::getpid(), SIGTERM) < 0) {
+                LOG_ERROR << kLogContext << "Sending SIGTERM to IoMgr process failed: "
+                          << std::strerror(errno);
+            }
+            return;
+        }
+
+        for (int i = 0; i < eventCount; ++i) {
+            const auto connectionId = events[i].data.u64;
+            std::shared_ptr<net::MultiplexedConnection> connection;
+            {
+                std::lock_guard lock(m_connectionHandlersMutex);
+                const auto it = m_connections.find(connectionId);
+                if (it == m_connections.end()) continue;
+                connection = it->second;
+            }
+
+            // Socket is readable, so receiving doesn't block. Frames are only buffered
+            // in sessions, so reactor never waits for the session handlers.
+            // Errors and hangups are handled too, they are detected when receiving.
+            try {
+                if (connection->receive()) continue;
+                LOG_INFO << m_socketTypeName << kLogContext << "Connection #" << connectionId
+                         << " closed.";
+            } catch (std::exception& ex) {
+                LOG_ERROR << m_socketTypeName << kLogContext << "Connection #" << connectionId
+                          << ": " << ex.what() << '.';
+            }
+            removeConnection(connectionId);
+        }
     }
 }
 
+void IOMgrConnectionManager::addConnection(FileDescriptorGuard&& clientFd)
+{
+    std::uint64_t connectionId = 0;
+    {
+        std::lock_guard lock(m_connectionHandlersMutex);
+        connectionId = ++m_lastConnectionId;
+    }
+
+    // Workers read only complete messages and don't wait for the send window
+    net::MultiplexedConnectionSettings settings;
+    settings.m_messageInput = true;
+    settings.m_maxPendingSendSize = kMaxPendingResponseSize;
+    auto connection = std::make_shared<net::MultiplexedConnection>(
+            std::move(clientFd),
+            [this, connectionId](std::unique_ptr<net::MultiplexedSessionIo>&& sessionIo) {
+                addSession(connectionId, std::move(sessionIo));
+            },
+            [this, connectionId](std::uint64_t sessionId) {
+                scheduleSession(connectionId, sessionId);
+            },
+            settings);
+    const auto fd = connection->getFd();
+    {
+        std::lock_guard lock(m_connectionHandlersMutex);
+        m_connections.emplace(connectionId, std::move(connection));
+    }
+
+    // Level-triggered, connection is watched only by the reactor thread
+    struct epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.u64 = connectionId;
+    if (::epoll_ctl(m_epollFd.getFd(), EPOLL_CTL_ADD, fd, &event) < 0) {
+        const int errorCode = errno;
+        removeConnection(connectionId);
+        throw std::system_error(errorCode, std::generic_category(), "epoll_ctl() failed");
+    }
+}
+
+void IOMgrConnectionManager::removeConnection(std::uint64_t connectionId)
+{
+    std::shared_ptr<net::MultiplexedConnection> connection;
+    {
+        std::lock_guard lock(m_connectionHandlersMutex);
+        const auto it = m_connections.find(connectionId);
+        if (it == m_connections.end()) return;
+        connection = std::move(it->second);
+        m_connections.erase(it);
+    }
+
+    // Socket stays open while sessions refer to the connection, so it must be unwatched
+    ::epoll_ctl(m_epollFd.getFd(), EPOLL_CTL_DEL, connection->getFd(), nullptr);
+
+    // Closing reports session events, so it is done outside of the lock
+    connection->close();
+}
+
+void IOMgrConnectionManager::addSession(
+        std::uint64_t connectionId, std::unique_ptr<net::MultiplexedSessionIo>&& sessionIo)
+{
+    const SessionKey sessionKey(connectionId, sessionIo->getSessionId());
+    auto connectionHandler = std::make_shared<IOMgrConnectionHandler>(
+            std::move(sessionIo), m_instance, m_workerThreadPool);
+    {
+        std::lock_guard lock(m_connectionHandlersMutex);
+        m_sessions[sessionKey].m_handler = std::move(connectionHandler);
+    }
+    LOG_DEBUG << m_socketTypeName << kLogContext << "Connection #" << sessionKey.first
+              << ": Opened session #" << sessionKey.second;
+}
+
+void IOMgrConnectionManager::scheduleSession(std::uint64_t connectionId, std::uint64_t sessionId)
+{
+    // Connections report closing of their sessions during destruction too
+    if (m_exitRequested) return;
+
+    std::lock_guard lock(m_connectionHandlersMutex);
+    const auto it = m_sessions.find(SessionKey(connectionId, sessionId));
+    if (it == m_sessions.end()) return;
+    auto& session = it->second;
+    // Running request checks for the new data when it finishes
+    if (session.m_scheduled || !isSessionReadyUnlocked(it->first)) return;
+    session.m_scheduled = true;
+    m_workerThreadPool.addRequest(
+            std::make_unique<SessionRequest>(*this, it->first, session.m_handler));
+}
+
+void IOMgrConnectionManager::finishSessionRequest(const SessionKey& sessionKey)
+{
+    // Handler is destroyed outside of the lock, if this was the last reference
+    std::shared_ptr<IOMgrConnectionHandler> removedHandler;
+    std::lock_guard lock(m_connectionHandlersMutex);
+    const auto it = m_sessions.find(sessionKey);
+    if (it == m_sessions.end()) return;
+    auto& session = it->second;
+
+    if (!session.m_handler->isConnected() || m_exitRequested) {
+        removedHandler = std::move(session.m_handler);
+        m_sessions.erase(it);
+        LOG_DEBUG << m_socketTypeName << kLogContext << "Connection #" << sessionKey.first
+                  << ": Closed session #" << sessionKey.second;
+        return;
+    }
+
+    // Data which arrived during request is not reported again. Session with queued
+    // responses is scheduled again when they are sent.
+    if (isSessionReadyUnlocked(sessionKey)) {
+        m_workerThreadPool.addRequest(
+                std::make_unique<SessionRequest>(*this, sessionKey, session.m_handler));
+    } else {
+        session.m_scheduled = false;
+    }
+}
+
+bool IOMgrConnectionManager::isSessionReadyUnlocked(const SessionKey& sessionKey) const
+{
+    // Missing connection means it is closed, so handler reads end of the session immediately
+    const auto it = m_connections.find(sessionKey.first);
+    if (it == m_connections.end()) return true;
+    const auto& connection = *it->second;
+    return !connection.hasPendingSendData(sessionKey.second)
+           && connection.hasReadableMessage(sessionKey.second);
+}
+
 void IOMgrConnectionManager::deadConnectionRecyclerThreadMain()
 {
     while (!m_exitRequested) {
@@ -122,22 +360,34 @@ void IOMgrConnectionManager::deadConnectionRecyclerThreadMain()
 void IOMgrConnectionManager::removeDeadConnections()
 {
     LOG_DEBUG << m_socketTypeName << kLogContext << "Recycling dead connections...";
-    std::lock_guard lock(m_connectionHandlersMutex);
+    std::vector<std::uint64_t> deadConnectionIds;
+    {
+        std::lock_guard lock(m_connectionHandlersMutex);
 
-    LOG_DEBUG << m_socketTypeName << kLogContext
-              << "Number of connections before recycling: " << m_connectionHandlers.size();
+        LOG_DEBUG << m_socketTypeName << kLogContext
+                  << "Number of connections before recycling: " << m_connections.size()
+                  << ", sessions: " << m_sessions.size();
 
-    auto connectionHandlerIt = m_connectionHandlers.begin();
-    while (connectionHandlerIt != m_connectionHandlers.end() && !m_exitRequested) {
-        if (!connectionHandlerIt->isConnected()) {
-            m_connectionHandlers.erase(connectionHandlerIt++);
-        } else {
-            ++connectionHandlerIt;
+        // Scheduled sessions are removed when their requests finish
+        auto sessionIt = m_sessions.begin();
+        while (sessionIt != m_sessions.end() && !m_exitRequested) {
+            if (!sessionIt->second.m_scheduled && !sessionIt->second.m_handler->isConnected())
+                m_sessions.erase(sessionIt++);
+            else
+                ++sessionIt;
+        }
+
+        for (const auto& connection : m_connections) {
+            if (!connection.second->isConnected()) deadConnectionIds.push_back(connection.first);
         }
     }
 
-    LOG_DEBUG << m_socketTypeName << kLogContext
-              << "Number of connections after recycling: " << m_connectionHandlers.size();
+    for (const auto connectionId : deadConnectionIds)
+        removeConnection(connectionId);
+
+    std::lock_guard lock(m_connectionHandlersMutex);
+    LOG_DEBUG << m_socketTypeName << kLogContext << "Number of connections after recycling: "
+              << m_connections.size() << ", sessions: " << m_sessions.size();
 }
 
 int IOMgrConnectionManager::acceptTcpConnection(int serverFd)
@@ -188,14 +438,4 @@ int IOMgrConnectionManager::checkSocketDomain(int socketDomain)
     }
 }
 
-std::vector<std::unique_ptr<UniversalWorker>> IOMgrConnectionManager::createWorkerThreadPool(
-        std::size_t size)
-{
-    std::vector<std::unique_ptr<UniversalWorker>> pool;
-    pool.reserve(size);
-    for (std::size_t id = 0; id < size; ++id)
-        pool.push_back(std::make_unique<UniversalWorker>(id));
-    return pool;
-}
-
 }  // namespace siodb::iomgr
@@ -6,17 +6,28 @@
 
 // Project headers
 #include "IOMgrConnectionHandler.h"
-#include "UniversalWorker.h"
+#include "UniversalWorkerPool.h"
 
 // Common project headers
+#include <siodb/common/net/MultiplexedConnection.h>
 #include <siodb/common/options/InstanceOptions.h>
+#include <siodb/common/utils/FileDescriptorGuard.h>
 #include <siodb/common/utils/HelperMacros.h>
 
 // STL headers
-#include <list>
+#include <map>
+#include <unordered_map>
 
 namespace siodb::iomgr {
 
+/**
+ * Accepts connections from the Siodb server and dispatches their requests.
+ * Each connection is multiplexed and carries many client sessions. Connections
+ * are watched by the single epoll reactor thread, which receives session data
+ * and queues request of the session with complete message to the worker thread pool.
+ * Responses which don't fit into the session send window are queued, and session
+ * waits until they are sent, so that worker never waits for the client.
+ */
 class IOMgrConnectionManager {
 public:
     /**
@@ -34,14 +45,77 @@ public:
     DECLARE_NONCOPYABLE(IOMgrConnectionManager);
 
 private:
+    /** IO request, which handles incoming data of the session */
+    class SessionRequest;
+
+    /** Session key: (connection ID, session ID) */
+    using SessionKey = std::pair<std::uint64_t, std::uint64_t>;
+
+    /** Session of the multiplexed connection */
+    struct Session {
+        /** Session handler */
+        std::shared_ptr<IOMgrConnectionHandler> m_handler;
+
+        /** Indication that session request is queued or executed */
+        bool m_scheduled = false;
+    };
+
     /** Connection listener thread entry point */
     void connectionListenerThreadMain();
 
+    /** Reactor thread entry point, waits for incoming data on all connections */
+    void reactorThreadMain();
+
+    /**
+     * Creates multiplexed connection and starts watching it.
+     * @param clientFd Client connection file descriptor guard.
+     */
+    void addConnection(FileDescriptorGuard&& clientFd);
+
+    /**
+     * Closes and removes connection. Its sessions are closed
+     * and removed after their handlers detect that.
+     * @param connectionId Connection ID.
+     */
+    void removeConnection(std::uint64_t connectionId);
+
+    /**
+     * Creates handler for the new session of the connection.
+     * @param connectionId Connection ID.
+     * @param sessionIo Session IO.
+     */
+    void addSession(
+            std::uint64_t connectionId, std::unique_ptr<net::MultiplexedSessionIo>&& sessionIo);
+
+    /**
+     * Queues request of the session with the new data, unless it is already queued
+     * or session is not ready.
+     * @param connectionId Connection ID.
+     * @param sessionId Session ID.
+     */
+    void scheduleSession(std::uint64_t connectionId, std::uint64_t sessionId);
+
+    /**
+     * Returns indication that session request doesn't block: complete message is received
+     * and all previous responses are sent, or session is closed.
+     * Connections and sessions must be locked.
+     * @param sessionKey Session key.
+     * @return true if session is ready, false otherwise.
+     */
+    bool isSessionReadyUnlocked(const SessionKey& sessionKey) const;
+
+    /**
+     * Queues session request again if more session data is available,
+     * or removes session if it is closed.
+     * @param sessionKey Session key.
+     */
+    void finishSessionRequest(const SessionKey& sessionKey);
+
     /** Dead connection recycler thread entry point */
     void deadConnectionRecyclerThreadMain();
 
     /**
-     * Removes dead connection handlers.
+     * Removes closed connections and sessions.
      */
     void removeDeadConnections();
 
@@ -60,12 +134,6 @@ private:
      */
     static int checkSocketDomain(int socketDomain);
 
-    /**
-     * Creates worker thread pool.
-     * @param size Pool size (number of threads in the pool).
-     */
-    static std::vector<std::unique_ptr<UniversalWorker>> createWorkerThreadPool(std::size_t size);
-
 private:
     /** Socket domain */
     const int m_socketDomain;
@@ -79,21 +147,33 @@ private:
     /** Exit request flag */
     std::atomic<bool> m_exitRequested;
 
-    /** Connection threads access synchronization object */
+    /** Connections and sessions access synchronization object */
     std::mutex m_connectionHandlersMutex;
 
     /** DBMS instance */
     const dbengine::InstancePtr m_instance;
 
-    /** Worker thread pool */
-    std::vector<std::unique_ptr<UniversalWorker>> m_workerThreadPool;
+    /** Reactor epoll file descriptor */
+    FileDescriptorGuard m_epollFd;
+
+    /** Multiplexed connections by connection ID */
+    std::unordered_map<std::uint64_t, std::shared_ptr<net::MultiplexedConnection>> m_connections;
+
+    /** Sessions of all connections. Destroyed before connections, which report session events. */
+    std::map<SessionKey, Session> m_sessions;
 
-    /** Connection handlers */
-    std::list<IOMgrConnectionHandler> m_connectionHandlers;
+    /** Last connection ID */
+    std::uint64_t m_lastConnectionId;
+
+    /** Worker thread pool, executes requests of all connections */
+    UniversalWorkerPool m_workerThreadPool;
 
     /** Connection listener thread */
     std::thread m_connectionListenerThread;
 
+    /** Reactor thread */
+    std::thread m_reactorThread;
+
     /** Dead connection recycling thread awake condition */
     std::condition_variable m_deadConnectionRecyclerThreadAwakeCondition;
 
@@ -103,6 +183,12 @@ private:
     /** Log context name */
     static constexpr const char* kLogContext = "IOMgrConnectionManager: ";
 
+    /** Maximum number of events received by reactor at once */
+    static constexpr int kMaxEpollEventCount = 64;
+
+    /** Maximum size of the queued responses of the session */
+    static constexpr std::size_t kMaxPendingResponseSize = 16 * 1024 * 1024;
+
     /** Period of checking that IO manager connection handler is active */
     static constexpr std::chrono::seconds kDeadConnectionsRecyclePeriod = std::chrono::seconds(30);
 };
@@ -4,12 +4,28 @@
 
 #pragma once
 
+// Common project headers
+#include <siodb/common/utils/HelperMacros.h>
+
 namespace siodb::iomgr {
 
-/** IO request */
+/** IO request, unit of work executed by the worker thread */
 class IORequest {
-    // just something for now
-    int dummy;
+protected:
+    /** Initializes object of class IORequest. */
+    IORequest() noexcept = default;
+
+public:
+    /** De-initializes object of class IORequest. */
+    virtual ~IORequest() = default;
+
+    DECLARE_NONCOPYABLE(IORequest);
+
+    /**
+     * Executes request. Called on the worker thread.
+     * Exceptions thrown by this function are logged and ignored.
+     */
+    virtual void execute() = 0;
 };
 
 }  // namespace siodb::iomgr
@@ -0,0 +1,69 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "IORequestQueue.h"
+
+namespace siodb::iomgr {
+
+void IORequestQueue::push(std::unique_ptr<IORequest>&& request)
+{
+    if (m_closed) return;
+
+    // While older requests wait in the overflow list, newer ones go there too to keep order
+    if (m_overflowRequestCount.load(std::memory_order_acquire) == 0
+            && m_requests.try_push(std::move(request)))
+        return;
+
+    std::lock_guard lock(m_overflowMutex);
+    m_overflowRequests.push_back(std::move(request));
+    m_overflowRequestCount.fetch_add(1, std::memory_order_relaxed);
+    // Pairs with the fence in the pop(): either worker sees the overflow request,
+    // or this thread sees slot freed by the worker
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    moveOverflowRequestsUnlocked();
+}
+
+std::unique_ptr<IORequest> IORequestQueue::pop()
+{
+    std::unique_ptr<IORequest> request;
+    try {
+        request = m_requests.pop();
+    } catch (utils::WaitInterruptedException&) {
+        return nullptr;
+    }
+
+    // Freed slot is given to the oldest overflow request
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_overflowRequestCount.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard lock(m_overflowMutex);
+        moveOverflowRequestsUnlocked();
+    }
+    return request;
+}
+
+void IORequestQueue::close()
+{
+    m_closed = true;
+    m_requests.request_interrupt();
+    // Requests pushed concurrently with close are destroyed together with the queue
+    std::unique_ptr<IORequest> request;
+    while (m_requests.try_pop(request))
+        request.reset();
+    std::lock_guard lock(m_overflowMutex);
+    m_overflowRequests.clear();
+    m_overflowRequestCount = 0;
+}
+
+// ----- internals -----
+
+void IORequestQueue::moveOverflowRequestsUnlocked()
+{
+    while (!m_overflowRequests.empty()
+            && m_requests.try_push(std::move(m_overflowRequests.front()))) {
+        m_overflowRequests.pop_front();
+        m_overflowRequestCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace siodb::iomgr
@@ -0,0 +1,83 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "IORequest.h"
+
+// Common project headers
+#include <siodb/common/utils/MpmcQueue.h>
+
+// STL headers
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace siodb::iomgr {
+
+/**
+ * IO request queue shared by the worker threads. Requests are handed over
+ * through the lock-free ring buffer, workers park only when the queue is empty.
+ * Push never blocks: requests which don't fit into the ring buffer wait in the overflow
+ * list and are moved into the ring buffer as workers free its slots.
+ */
+class IORequestQueue final {
+public:
+    /** Initializes object of class IORequestQueue. */
+    IORequestQueue()
+        : m_requests(kCapacity)
+        , m_closed(false)
+        , m_overflowRequestCount(0)
+    {
+    }
+
+    DECLARE_NONCOPYABLE(IORequestQueue);
+
+    /**
+     * Adds request to the end of the queue and wakes up one waiting worker.
+     * Doesn't wait for free space, so it is safe to call with locks held.
+     * Requests added after the queue is closed are discarded.
+     * @param request IO request.
+     */
+    void push(std::unique_ptr<IORequest>&& request);
+
+    /**
+     * Waits for the next request and removes it from the queue.
+     * @return Next request or nullptr if queue is closed.
+     */
+    std::unique_ptr<IORequest> pop();
+
+    /** Closes queue and wakes up all waiting workers. Pending requests are discarded. */
+    void close();
+
+private:
+    /** Moves overflow requests into the ring buffer while it has free space. */
+    void moveOverflowRequestsUnlocked();
+
+private:
+    /** Pending requests */
+    utils::MpmcQueue<std::unique_ptr<IORequest>> m_requests;
+
+    /** Indication that queue is closed */
+    std::atomic<bool> m_closed;
+
+    /** Overflow list access synchronization object */
+    std::mutex m_overflowMutex;
+
+    /** Requests which didn't fit into the ring buffer, in the push order */
+    std::deque<std::unique_ptr<IORequest>> m_overflowRequests;
+
+    /** Number of the overflow requests, checked without lock */
+    std::atomic<std::size_t> m_overflowRequestCount;
+
+    /**
+     * Size of the ring buffer. Each connection has at most one pending request
+     * and each parallel scan at most one per worker, so overflow is rare.
+     */
+    static constexpr std::size_t kCapacity = 65536;
+};
+
+}  // namespace siodb::iomgr
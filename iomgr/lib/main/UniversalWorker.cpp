@@ -4,10 +4,13 @@
 
 #include "UniversalWorker.h"
 
+// Common project headers
+#include <siodb/common/log/Log.h>
+
 namespace siodb::iomgr {
 
-UniversalWorker::UniversalWorker(std::size_t workerId)
-    : WorkerBase("UW", workerId)
+UniversalWorker::UniversalWorker(std::size_t workerId, IORequestQueue& requestQueue)
+    : WorkerBase("UW", workerId, requestQueue)
 {
     start();
 }
@@ -18,12 +21,16 @@ UniversalWorker::~UniversalWorker()
 
 void UniversalWorker::workerThreadMain()
 {
-    // Stub code
-    while (!isExitRequested()) {
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+    while (true) {
+        const auto request = waitForRequest();
+        if (!request) break;
+        try {
+            request->execute();
+        } catch (std::exception& ex) {
+            LOG_ERROR << m_logContext << "IO request failed: " << ex.what();
+        }
     }
-
-    // TODO: implement UniversalWorker::workerThreadMain()
+    LOG_INFO << m_logContext << "Worker thread is exiting.";
 }
 
 }  // namespace siodb::iomgr
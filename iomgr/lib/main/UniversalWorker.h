@@ -15,8 +15,9 @@ public:
     /**
      * Initializes object of class UniversalWorker.
      * @param workerId Worker ID.
+     * @param requestQueue IO request queue.
      */
-    explicit UniversalWorker(std::size_t workerId);
+    UniversalWorker(std::size_t workerId, IORequestQueue& requestQueue);
 
     /** De-initializes object of class UniversalWorker. */
     virtual ~UniversalWorker();
@@ -0,0 +1,28 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#include "UniversalWorkerPool.h"
+
+namespace siodb::iomgr {
+
+UniversalWorkerPool::UniversalWorkerPool(std::size_t size)
+{
+    m_workers.reserve(size);
+    for (std::size_t id = 0; id < size; ++id)
+        m_workers.push_back(std::make_unique<UniversalWorker>(id, m_requestQueue));
+}
+
+UniversalWorkerPool::~UniversalWorkerPool()
+{
+    m_requestQueue.close();
+    m_workers.clear();
+}
+
+void UniversalWorkerPool::addRequest(std::unique_ptr<IORequest>&& request)
+{
+    if (m_workers.empty()) throw std::runtime_error("Worker thread pool is empty");
+    m_requestQueue.push(std::move(request));
+}
+
+}  // namespace siodb::iomgr
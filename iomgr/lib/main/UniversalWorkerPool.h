@@ -0,0 +1,54 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+#pragma once
+
+// Project headers
+#include "UniversalWorker.h"
+
+// STL headers
+#include <vector>
+
+namespace siodb::iomgr {
+
+/** Pool of the universal worker threads */
+class UniversalWorkerPool final {
+public:
+    /**
+     * Initializes object of class UniversalWorkerPool.
+     * @param size Pool size (number of threads in the pool).
+     */
+    explicit UniversalWorkerPool(std::size_t size);
+
+    /** De-initializes object of class UniversalWorkerPool. Stops all worker threads. */
+    ~UniversalWorkerPool();
+
+    DECLARE_NONCOPYABLE(UniversalWorkerPool);
+
+    /**
+     * Returns number of worker threads in the pool.
+     * @return Number of worker threads.
+     */
+    std::size_t getSize() const noexcept
+    {
+        return m_workers.size();
+    }
+
+    /**
+     * Adds request to the queue shared by all workers, request is executed
+     * by the first worker which becomes free.
+     * @param request IO request.
+     * @throw std::runtime_error if pool is empty.
+     */
+    void addRequest(std::unique_ptr<IORequest>&& request);
+
+private:
+    /** IO request queue */
+    IORequestQueue m_requestQueue;
+
+    /** Worker threads */
+    std::vector<std::unique_ptr<UniversalWorker>> m_workers;
+};
+
+}  // namespace siodb::iomgr
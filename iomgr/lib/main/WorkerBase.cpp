@@ -16,9 +16,11 @@
 
 namespace siodb::iomgr {
 
-WorkerBase::WorkerBase(const char* workerType, std::size_t workerId)
+WorkerBase::WorkerBase(
+        const char* workerType, std::size_t workerId, IORequestQueue& requestQueue)
     : m_workerId(workerId)
     , m_logContext(createLogContextString(workerType, workerId))
+    , m_ioRequestQueue(requestQueue)
     , m_exitRequested(false)
 {
 }
@@ -41,6 +43,12 @@ void WorkerBase::start()
     m_thread = std::make_unique<std::thread>(&WorkerBase::workerThreadEntryPoint, this);
 }
 
+std::unique_ptr<IORequest> WorkerBase::waitForRequest()
+{
+    if (m_exitRequested) return nullptr;
+    return m_ioRequestQueue.pop();
+}
+
 void WorkerBase::workerThreadEntryPoint()
 {
     LOG_INFO << m_logContext << "Worker thread started.";
@@ -5,17 +5,14 @@
 #pragma once
 
 // Project headers
-#include "IORequest.h"
+#include "IORequestQueue.h"
 
 // Common project headers
 #include <siodb/common/utils/HelperMacros.h>
 
 // STL header
 #include <atomic>
-#include <condition_variable>
-#include <deque>
 #include <memory>
-#include <mutex>
 #include <thread>
 
 namespace siodb::iomgr {
@@ -27,10 +24,14 @@ public:
      * Initializes object of class Worker.
      * @param workerType Worker type.
      * @param workerId Worker identifier.
+     * @param requestQueue IO request queue, from which worker takes requests.
      */
-    WorkerBase(const char* workerType, std::size_t workerId);
+    WorkerBase(const char* workerType, std::size_t workerId, IORequestQueue& requestQueue);
 
-    /** De-initializes object */
+    /**
+     * De-initializes object. Request queue must be closed before,
+     * otherwise worker thread can't be stopped while it waits for request.
+     */
     virtual ~WorkerBase();
 
     DECLARE_NONCOPYABLE(WorkerBase);
@@ -59,6 +60,12 @@ protected:
      */
     void start();
 
+    /**
+     * Waits for the next request in the IO request queue.
+     * @return Next request or nullptr if exit was requested or queue is closed.
+     */
+    std::unique_ptr<IORequest> waitForRequest();
+
 private:
     /** Worker thread entry point */
     void workerThreadEntryPoint();
@@ -77,14 +84,8 @@ protected:
     /** Log context */
     const std::string m_logContext;
 
-    /** IO request queue access synchronization object */
-    mutable std::mutex m_ioRequestQueueMutex;
-
-    /** IO request queue signaling facility */
-    std::condition_variable m_ioRequestQueueCond;
-
     /** IO request queue */
-    std::deque<std::unique_ptr<IORequest>> m_ioRequestQueue;
+    IORequestQueue& m_ioRequestQueue;
 
 private:
     /** Worker thread exit request */
@@ -12,9 +12,12 @@
 #include <siodb/common/utils/Debug.h>
 
 // STL headers
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <random>
 #include <sstream>
+#include <thread>
 
 // CRT headers
 #include <cstdio>
@@ -553,6 +556,47 @@ TEST(EncryptedFile, RandomReadWrite)
     }
 }
 
+// Test does:
+// 1) Creates a file with known content
+// 2) Reads unaligned ranges of the file from several threads concurrently
+// 3) Checks that each thread reads correct data
+TEST(EncryptedFile, ConcurrentUnalignedReads)
+{
+    using namespace siodb;
+    using namespace siodb::iomgr::dbengine;
+
+    constexpr off_t kFileSize = 64 * 1024;
+    siodb::BinaryValue content(kFileSize);
+    for (off_t i = 0; i < kFileSize; ++i)
+        content[i] = static_cast<std::uint8_t>(i * 7 + i / 256);
+
+    io::EncryptedFile efile(g_testEnv->makeNewFilePath(), 0, kFileCreationMode,
+            g_testEnv->getEncryptionContext(), g_testEnv->getDecryptionContext(), kFileSize);
+    ASSERT_EQ(efile.write(content.data(), content.size(), 0), content.size());
+
+    constexpr unsigned kThreadCount = 4;
+    constexpr int kRepeatCount = 2000;
+    std::atomic<unsigned> mismatchCount(0);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&efile, &content, &mismatchCount, t] {
+            std::mt19937 gen(t);
+            std::uniform_int_distribution<off_t> positionDist(0, kFileSize - 1);
+            std::uint8_t buffer[37];
+            for (int i = 0; i < kRepeatCount; ++i) {
+                const auto pos = positionDist(gen);
+                const auto len = std::min<std::size_t>(sizeof(buffer), kFileSize - pos);
+                if (efile.read(buffer, len, pos) != len
+                        || std::memcmp(buffer, content.data() + pos, len) != 0)
+                    ++mismatchCount;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ASSERT_EQ(mismatchCount.load(), 0U);
+}
+
 int main(int argc, char** argv)
 {
     DEBUG_SYSCALLS_LIBRARY_GUARD;
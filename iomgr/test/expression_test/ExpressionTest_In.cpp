@@ -50,6 +50,65 @@ TEST(InOperator, Int32)
     }
 }
 
+// In operator test with value and variants of the different numeric types
+TEST(InOperator, MixedNumericTypes)
+{
+    TestContext context;
+    for (bool notIn : {true, false}) {
+        auto expr = makeIn<double, std::int64_t>(300.0, {100, 200, 300}, notIn);
+        auto result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), !notIn);
+
+        expr = makeIn<double, std::int64_t>(300.5, {100, 200, 300}, notIn);
+        result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), notIn);
+
+        expr = makeIn<std::int16_t, double>(-5, {1.5, -5.0, 7.25}, notIn);
+        result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), !notIn);
+
+        expr = makeIn<float, double>(7.25f, {1.5, -5.0, 7.25}, notIn);
+        result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), !notIn);
+
+        expr = makeIn<std::uint64_t, std::uint64_t>(
+                std::numeric_limits<std::uint64_t>::max(), {1, 2, 3}, notIn);
+        result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), notIn);
+
+        expr = makeIn<std::uint64_t, std::uint64_t>(std::numeric_limits<std::uint64_t>::max(),
+                {1, std::numeric_limits<std::uint64_t>::max()}, notIn);
+        result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), !notIn);
+    }
+}
+
+// In operator test with the long list of variants
+TEST(InOperator, LongList)
+{
+    TestContext context;
+    for (bool notIn : {true, false}) {
+        for (std::int32_t value : {-1, 0, 999, 1000, 1001, 1500, 1998, 1999}) {
+            std::vector<requests::ExpressionPtr> variants;
+            for (std::int32_t i = 1000; i < 2000; i += 2)
+                variants.push_back(makeConstant(i));
+            variants.push_back(makeConstant(dbengine::Variant()));
+            const auto expr = std::make_unique<requests::InOperator>(
+                    makeConstant(value), std::move(variants), notIn);
+            const auto result = expr->evaluate(context);
+            ASSERT_TRUE(result.isBool());
+            const bool found = value >= 1000 && value < 2000 && value % 2 == 0;
+            EXPECT_EQ(result.getBool(), notIn != found);
+        }
+    }
+}
+
 // In operator test with string value type
 TEST(InOperator, String)
 {
@@ -128,3 +128,55 @@ TEST(LikeOperator, MultiLanguage)
     ASSERT_TRUE(result.isBool());
     EXPECT_EQ(result.getBool(), true);
 }
+
+// Like operator pattern matching test for the patterns with fast matching path
+TEST(LikeOperator, FastPaths)
+{
+    TestContext context;
+    const std::string str = "ATestString";
+
+    const std::vector<std::tuple<std::string, std::string, bool>> testCases {
+            // Any string matches '%', including empty one
+            {str, "%", true},
+            {"", "%", true},
+            {"", "%%", true},
+            // Exact match
+            {str, "ATestString", true},
+            {str, "ATestStrin", false},
+            {"", "", true},
+            // Prefix
+            {str, "ATest%", true},
+            {str, "ATest%%", true},
+            {str, "Test%", false},
+            {"AT", "ATest%", false},
+            // Suffix
+            {str, "%String", true},
+            {str, "%Strin", false},
+            {"ng", "%String", false},
+            // Substring
+            {str, "%tSt%", true},
+            {str, "%%tSt%%", true},
+            {str, "%tst%", false},
+            {"EnglishРусский한국어", "%ский한%", true},
+            // Generic pattern with the both ends anchored
+            {str, "AT%ing", true},
+            {str, "ATestS%String", false},
+            {str, "A%_t%g", true},
+    };
+
+    for (const auto& [value, pattern, expectedResult] : testCases) {
+        auto expr = makeLike(value, pattern, false);
+        expr->validate(context);
+        auto result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), expectedResult)
+                << '\'' << value << "' LIKE '" << pattern << '\'';
+
+        expr = makeLike(value, pattern, true);
+        expr->validate(context);
+        result = expr->evaluate(context);
+        ASSERT_TRUE(result.isBool());
+        EXPECT_EQ(result.getBool(), !expectedResult)
+                << '\'' << value << "' NOT LIKE '" << pattern << '\'';
+    }
+}
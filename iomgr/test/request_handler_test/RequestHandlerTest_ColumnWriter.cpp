@@ -0,0 +1,127 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+// Project headers
+#include "RequestHandlerTest_TestEnv.h"
+#include "dbengine/Column.h"
+#include "dbengine/ColumnWriterPool.h"
+#include "dbengine/Table.h"
+
+// STL headers
+#include <thread>
+
+TEST(ColumnWriter, FailingValueInBatch)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"B", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+
+    const auto table = instance->getDatabase("SYS")->createUserTable("COLUMN_WRITER_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+    const auto columnA = table->getColumnChecked("A");
+    const auto columnB = table->getColumnChecked("B");
+
+    // NULL in the middle of the batch fails only write to the column A
+    std::vector<dbengine::ColumnWrite> writes;
+    writes.emplace_back(*columnA, std::vector<dbengine::Variant> {dbengine::Variant(1),
+                                          dbengine::Variant(2), dbengine::Variant(),
+                                          dbengine::Variant(4)});
+    writes.emplace_back(*columnB,
+            std::vector<dbengine::Variant> {dbengine::Variant(10), dbengine::Variant(20),
+                    dbengine::Variant(30), dbengine::Variant(40)});
+    instance->getColumnWriterPool().write(writes);
+
+    EXPECT_NE(writes[0].m_error, nullptr);
+    EXPECT_TRUE(writes[0].m_records.empty());
+
+    ASSERT_EQ(writes[1].m_error, nullptr);
+    ASSERT_EQ(writes[1].m_records.size(), 4U);
+    dbengine::Variant value;
+    for (std::size_t i = 0; i < writes[1].m_records.size(); ++i) {
+        columnB->readRecord(writes[1].m_records[i].first, value);
+        EXPECT_EQ(value.asInt32(), static_cast<std::int32_t>((i + 1) * 10));
+    }
+    columnB->rollbackRecords(writes[1].m_records);
+
+    // Failed write leaves column usable
+    writes.clear();
+    writes.emplace_back(*columnA, std::vector<dbengine::Variant> {dbengine::Variant(5)});
+    instance->getColumnWriterPool().write(writes);
+    ASSERT_EQ(writes[0].m_error, nullptr);
+    ASSERT_EQ(writes[0].m_records.size(), 1U);
+    columnA->readRecord(writes[0].m_records[0].first, value);
+    EXPECT_EQ(value.asInt32(), 5);
+    columnA->rollbackRecords(writes[0].m_records);
+}
+
+TEST(ColumnWriter, ConcurrentWritersToDifferentColumns)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    // create table
+    constexpr std::size_t kColumnCount = 8;
+    std::vector<dbengine::SimpleColumnSpecification> tableColumns;
+    for (std::size_t i = 0; i < kColumnCount; ++i)
+        tableColumns.push_back({"C" + std::to_string(i), siodb::COLUMN_DATA_TYPE_INT64, true});
+
+    const auto table = instance->getDatabase("SYS")->createUserTable("COLUMN_WRITER_2",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    // Each thread writes its own column in several batches
+    constexpr std::size_t kBatchCount = 10;
+    constexpr std::size_t kBatchSize = 1000;
+    std::vector<dbengine::ColumnPtr> columns;
+    for (std::size_t i = 0; i < kColumnCount; ++i)
+        columns.push_back(table->getColumnChecked("C" + std::to_string(i)));
+
+    std::vector<std::vector<std::vector<std::pair<dbengine::ColumnDataAddress,
+            dbengine::ColumnDataAddress>>>>
+            records(kColumnCount);
+    std::vector<std::exception_ptr> errors(kColumnCount);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < kColumnCount; ++i) {
+        threads.emplace_back([&, i] {
+            for (std::size_t batch = 0; batch < kBatchCount; ++batch) {
+                std::vector<dbengine::Variant> values;
+                for (std::size_t j = 0; j < kBatchSize; ++j) {
+                    values.emplace_back(static_cast<std::int64_t>(
+                            (i * kBatchCount + batch) * kBatchSize + j));
+                }
+                std::vector<dbengine::ColumnWrite> writes;
+                writes.emplace_back(*columns[i], std::move(values));
+                instance->getColumnWriterPool().write(writes);
+                if (writes[0].m_error) {
+                    errors[i] = writes[0].m_error;
+                    return;
+                }
+                records[i].push_back(std::move(writes[0].m_records));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    dbengine::Variant value;
+    for (std::size_t i = 0; i < kColumnCount; ++i) {
+        ASSERT_EQ(errors[i], nullptr);
+        ASSERT_EQ(records[i].size(), kBatchCount);
+        for (std::size_t batch = 0; batch < kBatchCount; ++batch) {
+            ASSERT_EQ(records[i][batch].size(), kBatchSize);
+            for (std::size_t j = 0; j < kBatchSize; ++j) {
+                columns[i]->readRecord(records[i][batch][j].first, value);
+                EXPECT_EQ(value.asInt64(),
+                        static_cast<std::int64_t>((i * kBatchCount + batch) * kBatchSize + j));
+            }
+        }
+        // Last records are rolled back first
+        for (auto it = records[i].rbegin(); it != records[i].rend(); ++it)
+            columns[i]->rollbackRecords(*it);
+    }
+}
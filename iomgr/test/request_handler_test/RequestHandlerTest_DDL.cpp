@@ -6,6 +6,7 @@
 #include "RequestHandlerTest_TestEnv.h"
 #include "dbengine/DatabaseError.h"
 #include "dbengine/Table.h"
+#include "dbengine/TableAnalyzer.h"
 #include "dbengine/handlers/RequestHandler.h"
 #include "dbengine/parser/DBEngineRequestFactory.h"
 #include "dbengine/parser/SqlParser.h"
@@ -583,3 +584,184 @@ TEST(DDL, CreateTable)
         ASSERT_EQ(rowLength, 0U);
     }
 }
+
+TEST(DDL, AnalyzeTable)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, false},
+    };
+
+    const auto db = instance->getDatabase("SYS");
+    const auto table = db->createUserTable("ANALYZE_TEST_1", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    {
+        // A takes 10 distinct values, B is NULL in every second row
+        std::ostringstream ss;
+        ss << "INSERT INTO SYS.ANALYZE_TEST_1 VALUES ";
+        for (int i = 0; i < 100; ++i) {
+            if (i > 0) ss << ", ";
+            ss << '(' << (i % 10) << ", ";
+            if (i % 2 == 0)
+                ss << "'value " << i << '\'';
+            else
+                ss << "NULL";
+            ss << ')';
+        }
+
+        parser_ns::SqlParser parser(ss.str());
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.affected_row_count(), 100U);
+    }
+
+    EXPECT_EQ(db->getTableStatistics(table->getId()), nullptr);
+
+    /// ----------- ANALYZE -----------
+    {
+        const std::string statement("ANALYZE SYS.ANALYZE_TEST_1");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto analyzeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*analyzeRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+    }
+
+    const auto statistics = db->getTableStatistics(table->getId());
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_EQ(statistics->m_rowCount, 100U);
+    EXPECT_EQ(statistics->m_sampleRowCount, 100U);
+
+    const auto a = statistics->findColumn("A");
+    ASSERT_NE(a, nullptr);
+    EXPECT_DOUBLE_EQ(a->m_nullFraction, 0.0);
+    EXPECT_NEAR(a->m_distinctCount, 10U, 1U);
+    EXPECT_DOUBLE_EQ(a->m_averageWidth, 4.0);
+    ASSERT_FALSE(a->m_histogramBounds.empty());
+    EXPECT_EQ(a->m_histogramBounds.front().asInt32(), 0);
+    EXPECT_EQ(a->m_histogramBounds.back().asInt32(), 9);
+
+    const auto b = statistics->findColumn("B");
+    ASSERT_NE(b, nullptr);
+    EXPECT_DOUBLE_EQ(b->m_nullFraction, 0.5);
+    EXPECT_NEAR(b->m_distinctCount, 50U, 2U);
+
+    // Selectivity of "A < 5" is estimated from the histogram
+    parser_ns::SqlParser parser("SELECT * FROM SYS.ANALYZE_TEST_1 WHERE A < 5");
+    parser.parse();
+    const auto selectRequest =
+            parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+    const auto& where =
+            *dynamic_cast<const dbengine::requests::SelectRequest&>(*selectRequest).m_where;
+    EXPECT_NEAR(statistics->estimateSelectivity(where), 0.5, 0.1);
+}
+
+TEST(DDL, AnalyzeTableSample)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT64, true},
+            {"B", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"C", siodb::COLUMN_DATA_TYPE_TEXT, false},
+    };
+
+    const auto db = instance->getDatabase("SYS");
+    const auto table = db->createUserTable("ANALYZE_TEST_2", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    // A is unique, B takes 10 distinct values, C is NULL in every second row
+    constexpr int kRowCount = 2000;
+    constexpr int kInsertRowCount = 500;
+    for (int firstRow = 0; firstRow < kRowCount; firstRow += kInsertRowCount) {
+        std::ostringstream ss;
+        ss << "INSERT INTO SYS.ANALYZE_TEST_2 VALUES ";
+        for (int i = firstRow; i < firstRow + kInsertRowCount; ++i) {
+            if (i > firstRow) ss << ", ";
+            ss << '(' << i << ", " << (i % 10) << ", ";
+            if (i % 2 == 0)
+                ss << "'value " << i << '\'';
+            else
+                ss << "NULL";
+            ss << ')';
+        }
+
+        parser_ns::SqlParser parser(ss.str());
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.affected_row_count(), static_cast<std::uint64_t>(kInsertRowCount));
+    }
+
+    // Only 10% of rows are read
+    const auto statistics = dbengine::TableAnalyzer(
+            table, table->getDatabase().createSnapshot(), kRowCount / 10).analyze();
+    EXPECT_EQ(statistics.m_rowCount, static_cast<std::uint64_t>(kRowCount));
+    EXPECT_EQ(statistics.m_sampleRowCount, static_cast<std::uint64_t>(kRowCount / 10));
+
+    const auto a = statistics.findColumn("A");
+    ASSERT_NE(a, nullptr);
+    EXPECT_DOUBLE_EQ(a->m_nullFraction, 0.0);
+    EXPECT_EQ(a->m_distinctCount, static_cast<std::uint64_t>(kRowCount));
+    EXPECT_DOUBLE_EQ(a->m_averageWidth, 8.0);
+    ASSERT_FALSE(a->m_histogramBounds.empty());
+    EXPECT_GE(a->m_histogramBounds.front().asInt64(), 0);
+    EXPECT_LT(a->m_histogramBounds.back().asInt64(), kRowCount);
+
+    // Every value repeats in the sample, so sample has all of them
+    const auto b = statistics.findColumn("B");
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(b->m_distinctCount, 10U);
+
+    const auto c = statistics.findColumn("C");
+    ASSERT_NE(c, nullptr);
+    EXPECT_NEAR(c->m_nullFraction, 0.5, 0.2);
+}
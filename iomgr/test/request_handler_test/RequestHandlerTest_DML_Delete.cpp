@@ -4,6 +4,8 @@
 
 // Project headers
 #include "RequestHandlerTest_TestEnv.h"
+#include "dbengine/TableDataSet.h"
+#include "dbengine/TransactionSnapshot.h"
 #include "dbengine/parser/DBEngineRequestFactory.h"
 #include "dbengine/parser/SqlParser.h"
 
@@ -554,3 +556,79 @@ TEST(DML_Delete, DeleteByMutlipleColumnsExpression)
         EXPECT_EQ(rowLength, 0U);
     }
 }
+
+TEST(DML_Delete, SnapshotSeesDeletedAndUpdatedRows)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"U16", siodb::COLUMN_DATA_TYPE_UINT16, true},
+    };
+
+    const auto db = instance->getDatabase("SYS");
+    const auto table = db->createUserTable("DELETE_TEST_SNAPSHOT", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    const auto executeDml = [&](const std::string& statement, std::uint64_t expectedRowCount) {
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto request =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*request, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), expectedRowCount);
+    };
+
+    const auto readValues = [&table](const dbengine::TransactionSnapshotPtr& snapshot) {
+        dbengine::TableDataSet dataSet(table, "");
+        dataSet.emplaceColumnInfo(1, "U16", "");
+        dataSet.setSnapshot(snapshot);
+        std::vector<std::uint16_t> values;
+        for (dataSet.resetCursor(); dataSet.hasCurrentRow(); dataSet.moveToNextRow())
+            values.push_back(dataSet.getColumnValue(0).getUInt16());
+        return values;
+    };
+
+    executeDml("INSERT INTO DELETE_TEST_SNAPSHOT VALUES (0), (1), (2), (3), (4), (5)", 6);
+
+    const auto snapshot = db->createSnapshot();
+
+    executeDml("DELETE FROM DELETE_TEST_SNAPSHOT WHERE U16 = 0 OR U16 = 3", 2);
+    executeDml("UPDATE DELETE_TEST_SNAPSHOT SET U16 = 100 WHERE U16 = 4", 1);
+    executeDml("INSERT INTO DELETE_TEST_SNAPSHOT VALUES (6)", 1);
+
+    // Snapshot sees rows as they were before changes
+    const std::vector<std::uint16_t> expectedSnapshotValues {0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(readValues(snapshot), expectedSnapshotValues);
+
+    // New snapshot and reader without snapshot see all changes
+    const std::vector<std::uint16_t> expectedLatestValues {1, 2, 100, 5, 6};
+    EXPECT_EQ(readValues(db->createSnapshot()), expectedLatestValues);
+    EXPECT_EQ(readValues(nullptr), expectedLatestValues);
+
+    // Row lookup by TRID also respects snapshot
+    dbengine::TableDataSet dataSet(table, "");
+    dataSet.emplaceColumnInfo(1, "U16", "");
+    dataSet.setSnapshot(snapshot);
+    ASSERT_TRUE(dataSet.moveToRow(1));
+    EXPECT_EQ(dataSet.getColumnValue(0).getUInt16(), 0U);
+    ASSERT_TRUE(dataSet.moveToRow(5));
+    EXPECT_EQ(dataSet.getColumnValue(0).getUInt16(), 4U);
+    EXPECT_FALSE(dataSet.moveToRow(7));
+}
@@ -16,6 +16,13 @@
 #include <boost/date_time.hpp>
 #include <boost/endian/conversion.hpp>
 
+// STL headers
+#include <filesystem>
+#include <fstream>
+
+// System headers
+#include <unistd.h>
+
 namespace requests = dbengine::requests;
 namespace parser_ns = dbengine::parser;
 
@@ -841,3 +848,448 @@ TEST(DML_Insert, InsertDefaultNullValueTest)
         ASSERT_TRUE(rowLength == 0);
     }
 }
+
+// INSERT INTO SYS.TEST_BULK_INSERT VALUES (1, 'V1'), ..., (1000, 'V1000')
+// INSERT INTO SYS.TEST_BULK_INSERT VALUES (1001, 'V1001'), (1002, 'V1002'), (NULL, 'V1003')
+// SELECT COUNT(*), COUNT(B), MAX(TRID) FROM SYS.TEST_BULK_INSERT
+// SELECT A, B FROM SYS.TEST_BULK_INSERT WHERE TRID IN (1000, 1, 500)
+TEST(DML_Insert, InsertManyRowsAtOnce)
+{
+    constexpr std::uint64_t kRowCount = 1000;
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT64, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, false},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("TEST_BULK_INSERT", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    /// ----------- INSERT -----------
+    {
+        std::ostringstream ss;
+        ss << "INSERT INTO SYS.TEST_BULK_INSERT VALUES ";
+        for (std::uint64_t i = 1; i <= kRowCount; ++i) {
+            if (i > 1) ss << ", ";
+            ss << '(' << i << ", 'V" << i << "')";
+        }
+        const std::string statement(ss.str());
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), kRowCount);
+    }
+
+    /// ----------- INSERT with invalid last row -----------
+    {
+        const std::string statement(
+                "INSERT INTO SYS.TEST_BULK_INSERT VALUES (1001, 'V1001'), (1002, 'V1002'), "
+                "(NULL, 'V1003')");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 1);  // message "Cannot insert NULL value"
+    }
+
+    /// ----------- SELECT -----------
+    {
+        // No rows of the failed INSERT are visible
+        const std::string statement(
+                "SELECT COUNT(*), COUNT(B), MAX(TRID) FROM SYS.TEST_BULK_INSERT");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.column_description_size(), 3);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        ASSERT_TRUE(rowLength > 0);
+
+        // Null bitmask
+        std::uint8_t nullMask = 0xFF;
+        ASSERT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+        EXPECT_EQ(nullMask, 0U);
+
+        for (std::size_t i = 0; i < 3; ++i) {
+            std::uint64_t value = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(&value));
+            EXPECT_EQ(value, kRowCount);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+
+    {
+        const std::string statement(
+                "SELECT A, B FROM SYS.TEST_BULK_INSERT WHERE TRID IN (1000, 1, 500)");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.column_description_size(), 2);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        for (const std::int64_t expectedValue : {1, 500, 1000}) {
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            // Null bitmask
+            std::uint8_t nullMask = 0xFF;
+            ASSERT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+            EXPECT_EQ(nullMask, 0U);
+
+            std::int64_t a = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(reinterpret_cast<std::uint64_t*>(&a)));
+            EXPECT_EQ(a, expectedValue);
+
+            const auto expectedB = "V" + std::to_string(expectedValue);
+            std::uint32_t bLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&bLength));
+            std::string b(bLength, '\0');
+            ASSERT_TRUE(codedInput.ReadRaw(b.data(), bLength));
+            EXPECT_EQ(b, expectedB);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(DML_Insert, CopyFromCsvFile)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT64, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, false},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("TEST_COPY_FROM", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    // create data file
+    const auto filePath =
+            std::filesystem::temp_directory_path() / ("siodb_copy_" + std::to_string(::getpid()));
+    {
+        std::ofstream ofs(filePath);
+        ofs << "A,B\n1,\"x, y\"\r\n2,\n3,\"multi\nline \"\"quoted\"\"\"";
+    }
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    /// ----------- COPY -----------
+    {
+        const std::string statement(
+                "COPY SYS.TEST_COPY_FROM FROM '" + filePath.string() + "' WITH HEADER");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto copyRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*copyRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), 3U);
+    }
+
+    std::filesystem::remove(filePath);
+
+    /// ----------- SELECT -----------
+    {
+        const std::string statement("SELECT B FROM SYS.TEST_COPY_FROM");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.column_description_size(), 1);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        const std::string expectedValues[] = {"x, y", "", "multi\nline \"quoted\""};
+        for (const auto& expectedValue : expectedValues) {
+            std::uint64_t rowLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            std::uint8_t nullMask = 0xFF;
+            ASSERT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+            if (expectedValue.empty()) {
+                // Empty unquoted field is NULL
+                EXPECT_EQ(nullMask, 1U);
+                continue;
+            }
+            EXPECT_EQ(nullMask, 0U);
+
+            std::string value;
+            std::uint32_t valueLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&valueLength));
+            ASSERT_TRUE(codedInput.ReadString(&value, valueLength));
+            EXPECT_EQ(value, expectedValue);
+        }
+
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(DML_Insert, CopyFromCsvFileWithInvalidRow)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT64, true},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("TEST_COPY_FROM_INVALID",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    // create data file, invalid row goes after more than one full batch of valid rows
+    const auto filePath = std::filesystem::temp_directory_path()
+                          / ("siodb_copy_invalid_" + std::to_string(::getpid()));
+    {
+        std::ofstream ofs(filePath);
+        for (int i = 0; i < 100000; ++i)
+            ofs << i << '\n';
+        ofs << "invalid\n";
+    }
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    /// ----------- COPY -----------
+    {
+        const std::string statement(
+                "COPY SYS.TEST_COPY_FROM_INVALID FROM '" + filePath.string() + "'");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto copyRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*copyRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        // Whole COPY is rolled back, so no rows are reported along with the error
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 1);
+        EXPECT_TRUE(response.has_affected_row_count());
+        EXPECT_EQ(response.affected_row_count(), 0U);
+    }
+
+    std::filesystem::remove(filePath);
+
+    /// ----------- SELECT -----------
+    {
+        const std::string statement("SELECT A FROM SYS.TEST_COPY_FROM_INVALID");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.column_description_size(), 1);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(DML_Insert, CopyToAndBackFromFile)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, false},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("TEST_COPY_TO", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    const auto executeStatement = [&](const std::string& statement,
+                                          std::uint64_t expectedAffectedRowCount) {
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto request =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*request, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        EXPECT_EQ(response.affected_row_count(), expectedAffectedRowCount);
+    };
+
+    executeStatement(
+            "INSERT INTO SYS.TEST_COPY_TO VALUES (1, 'a'), (2, NULL), (-3, 'x,\"y\"'), (4, '')",
+            4);
+
+    const auto baseFilePath = std::filesystem::temp_directory_path()
+                              / ("siodb_copy_to_" + std::to_string(::getpid()));
+
+    /// ----------- COPY TO CSV -----------
+    {
+        const auto filePath = baseFilePath.string() + ".csv";
+        executeStatement("COPY SYS.TEST_COPY_TO TO '" + filePath + "' WITH HEADER", 4);
+
+        std::ifstream ifs(filePath);
+        const std::string content(
+                (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(content, "A,B\n1,a\n2,\n-3,\"x,\"\"y\"\"\"\n4,\"\"\n");
+        std::filesystem::remove(filePath);
+    }
+
+    /// ----------- COPY TO binary and back -----------
+    {
+        const auto filePath = baseFilePath.string() + ".bin";
+        executeStatement(
+                "COPY SYS.TEST_COPY_TO TO '" + filePath + "' WITH FORMAT = 'binary'", 4);
+        executeStatement(
+                "COPY SYS.TEST_COPY_TO FROM '" + filePath + "' WITH FORMAT = 'binary'", 4);
+        std::filesystem::remove(filePath);
+    }
+
+    /// ----------- SELECT -----------
+    {
+        // Each value now appears twice
+        const std::string statement(
+                "SELECT COUNT(*) FROM SYS.TEST_COPY_TO WHERE B = 'x,\"y\"' OR B = ''");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.column_description_size(), 1);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        ASSERT_TRUE(rowLength > 0);
+
+        std::uint8_t nullMask = 0xFF;
+        ASSERT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+        EXPECT_EQ(nullMask, 0U);
+
+        std::uint64_t count = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&count));
+        EXPECT_EQ(count, 4U);
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
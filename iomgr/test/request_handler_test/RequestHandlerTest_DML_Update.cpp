@@ -610,3 +610,73 @@ TEST(DML_Update, UpdateConcatString)
         EXPECT_EQ(rowLength, 0U);
     }
 }
+
+TEST(DML_Update, UpdateRowChangedByOtherTransaction)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+    const auto otherRequestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // Create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+    instance->getDatabase("SYS")->createUserTable("UPDATE_CONCURRENT_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    const auto executeStatement = [&](dbengine::RequestHandler& handler,
+                                          const std::string& statement) {
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto request =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+        handler.executeRequest(*request, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        return response;
+    };
+
+    ASSERT_EQ(executeStatement(*requestHandler, "INSERT INTO UPDATE_CONCURRENT_1 VALUES (1), (2)")
+                      .message_size(),
+            0);
+
+    // Other transaction changes row 1 and inserts row 3
+    ASSERT_EQ(executeStatement(*otherRequestHandler, "BEGIN TRANSACTION").message_size(), 0);
+    ASSERT_EQ(executeStatement(*otherRequestHandler,
+                      "UPDATE UPDATE_CONCURRENT_1 SET A = 10 WHERE TRID = 1")
+                      .message_size(),
+            0);
+    ASSERT_EQ(executeStatement(*otherRequestHandler, "INSERT INTO UPDATE_CONCURRENT_1 VALUES (3)")
+                      .message_size(),
+            0);
+
+    // Row owned by the other transaction can't be changed
+    auto response = executeStatement(
+            *requestHandler, "UPDATE UPDATE_CONCURRENT_1 SET A = 20 WHERE TRID = 1");
+    EXPECT_EQ(response.message_size(), 1);
+    EXPECT_EQ(response.affected_row_count(), 0U);
+    response = executeStatement(*requestHandler, "DELETE FROM UPDATE_CONCURRENT_1 WHERE TRID = 1");
+    EXPECT_EQ(response.message_size(), 1);
+    EXPECT_EQ(response.affected_row_count(), 0U);
+
+    // Uncommitted row 3 is not visible, row 2 is not changed by anyone else
+    response = executeStatement(
+            *requestHandler, "UPDATE UPDATE_CONCURRENT_1 SET A = A WHERE A > 1");
+    EXPECT_EQ(response.message_size(), 0);
+    EXPECT_EQ(response.affected_row_count(), 1U);
+
+    // Committed change is visible, so row can be changed again
+    ASSERT_EQ(executeStatement(*otherRequestHandler, "COMMIT").message_size(), 0);
+    response = executeStatement(
+            *requestHandler, "UPDATE UPDATE_CONCURRENT_1 SET A = 20 WHERE A = 10");
+    EXPECT_EQ(response.message_size(), 0);
+    EXPECT_EQ(response.affected_row_count(), 1U);
+}
@@ -3,7 +3,10 @@
 // in the LICENSE file.
 
 // Project headers
+#include <siodb-generated/iomgr/lib/messages/IOManagerMessageId.h>
 #include "RequestHandlerTest_TestEnv.h"
+#include "dbengine/DatabaseError.h"
+#include "dbengine/HashAggregator.h"
 #include "dbengine/parser/DBEngineRequestFactory.h"
 #include "dbengine/parser/SqlParser.h"
 
@@ -1903,4 +1906,823 @@ TEST(Query, SelectWithWhere_LimitAndOffset)
         ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
         EXPECT_EQ(rowLength, 0U);
     }
-}
\ No newline at end of file
+}
+
+TEST(Query, SelectWithWhereLateMaterialization)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, true},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("SELECT_WITH_WHERE_LATE_MATERIALIZATION_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    // Filtered rows don't fit into single batch
+    constexpr int kRowCount = 3000;
+    {
+        std::stringstream ss;
+        ss << "INSERT INTO SYS.SELECT_WITH_WHERE_LATE_MATERIALIZATION_1 VALUES ";
+        for (int i = 0; i < kRowCount; ++i) {
+            if (i > 0) ss << ", ";
+            ss << "(" << i << ", 'B" << i << "')";
+        }
+
+        const std::string statement(ss.str());
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), static_cast<std::uint64_t>(kRowCount));
+    }
+
+    /// ----------- SELECT -----------
+    {
+        const std::string statement(
+                "SELECT B, A FROM SYS.SELECT_WITH_WHERE_LATE_MATERIALIZATION_1 WHERE A >= 500 "
+                "LIMIT 2000 OFFSET 10");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+        ASSERT_EQ(response.column_description_size(), 2);
+        EXPECT_EQ(response.column_description(0).name(), "B");
+        EXPECT_EQ(response.column_description(1).name(), "A");
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        for (int i = 510; i < 2510; ++i) {
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            std::string b;
+            std::uint32_t bLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&bLength));
+            ASSERT_TRUE(codedInput.ReadString(&b, bLength));
+            EXPECT_EQ(b, "B" + std::to_string(i));
+
+            std::int32_t a = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(reinterpret_cast<std::uint32_t*>(&a)));
+            ASSERT_EQ(a, i);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(Query, SelectWithLargeOffsetAfterDelete)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("SELECT_WITH_LARGE_OFFSET_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    // Rows take more than one master column index node
+    constexpr int kRowCount = 2000;
+    {
+        std::stringstream ss;
+        ss << "INSERT INTO SYS.SELECT_WITH_LARGE_OFFSET_1 VALUES ";
+        for (int i = 0; i < kRowCount; ++i) {
+            if (i > 0) ss << ", ";
+            ss << '(' << i << ')';
+        }
+
+        const std::string statement(ss.str());
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.affected_row_count(), static_cast<std::uint64_t>(kRowCount));
+    }
+
+    /// ----------- DELETE -----------
+    {
+        const std::string statement(
+                "DELETE FROM SYS.SELECT_WITH_LARGE_OFFSET_1 WHERE A < 100 OR A BETWEEN 500 AND "
+                "1099");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto deleteRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*deleteRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.affected_row_count(), 700U);
+    }
+
+    /// ----------- SELECT -----------
+    // Remaining rows are 100..499 and 1100..1999, OFFSET skips 400 + 500 rows
+    {
+        const std::string statement(
+                "SELECT A FROM SYS.SELECT_WITH_LARGE_OFFSET_1 LIMIT 5 OFFSET 900");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+        ASSERT_EQ(response.column_description_size(), 1);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        for (int i = 1600; i < 1605; ++i) {
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            std::int32_t a = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(reinterpret_cast<std::uint32_t*>(&a)));
+            ASSERT_EQ(a, i);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+
+    /// ----------- SELECT -----------
+    // OFFSET beyond the last row
+    {
+        const std::string statement(
+                "SELECT A FROM SYS.SELECT_WITH_LARGE_OFFSET_1 LIMIT 5 OFFSET 1300");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(Query, SelectWithOrderByLimitAndOffset)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, true},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("SELECT_WITH_ORDER_BY_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    {
+        const std::string statement(
+                "INSERT INTO SYS.SELECT_WITH_ORDER_BY_1 VALUES (3, 'c'), (7, 'g'), (1, 'a'), "
+                "(9, 'i'), (5, 'e'), (0, 'z'), (8, 'h'), (2, 'b'), (6, 'f'), (4, 'd')");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), 10U);
+    }
+
+    /// ----------- SELECT -----------
+    {
+        const std::string statement(
+                "SELECT B FROM SYS.SELECT_WITH_ORDER_BY_1 WHERE A > 0 ORDER BY A DESC LIMIT 3 "
+                "OFFSET 2");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+        ASSERT_EQ(response.column_description_size(), 1);
+        ASSERT_EQ(response.column_description(0).type(), siodb::COLUMN_DATA_TYPE_TEXT);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        for (const char* expected : {"g", "f", "e"}) {
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            std::uint32_t textLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&textLength));
+            ASSERT_EQ(textLength, 1U);
+            std::string text(1, '\0');
+            ASSERT_TRUE(codedInput.ReadRaw(text.data(), textLength));
+            EXPECT_EQ(text, expected);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(Query, SelectWithGroupByAndHaving)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"G", siodb::COLUMN_DATA_TYPE_TEXT, true},
+            {"V", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("SELECT_WITH_GROUP_BY_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    {
+        const std::string statement(
+                "INSERT INTO SYS.SELECT_WITH_GROUP_BY_1 VALUES ('a', 1), ('b', 4), ('a', 7), "
+                "('c', 2), ('b', 3), ('c', 1)");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), 6U);
+    }
+
+    /// ----------- SELECT -----------
+    {
+        const std::string statement(
+                "SELECT G, COUNT(*), SUM(V) FROM SYS.SELECT_WITH_GROUP_BY_1 GROUP BY G "
+                "HAVING SUM(V) > 5 ORDER BY G");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+        ASSERT_EQ(response.column_description_size(), 3);
+        ASSERT_EQ(response.column_description(0).type(), siodb::COLUMN_DATA_TYPE_TEXT);
+        ASSERT_EQ(response.column_description(1).type(), siodb::COLUMN_DATA_TYPE_UINT64);
+        ASSERT_EQ(response.column_description(2).type(), siodb::COLUMN_DATA_TYPE_INT64);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        const std::vector<std::tuple<const char*, std::uint64_t, std::int64_t>> expectedRows {
+                {"a", 2, 8},
+                {"b", 2, 7},
+        };
+        for (const auto& [expectedGroup, expectedCount, expectedSum] : expectedRows) {
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            // Null bitmask
+            std::uint8_t nullMask = 0xFF;
+            ASSERT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+            EXPECT_EQ(nullMask, 0U);
+
+            std::uint32_t textLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&textLength));
+            ASSERT_EQ(textLength, 1U);
+            std::string text(1, '\0');
+            ASSERT_TRUE(codedInput.ReadRaw(text.data(), textLength));
+            EXPECT_EQ(text, expectedGroup);
+
+            std::uint64_t count = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(&count));
+            EXPECT_EQ(count, expectedCount);
+
+            std::int64_t sum = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(reinterpret_cast<std::uint64_t*>(&sum)));
+            EXPECT_EQ(sum, expectedSum);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(Query, GroupByMemoryLimit)
+{
+    constexpr std::size_t kMemoryLimit = 64 * 1024;
+    dbengine::HashAggregator aggregator({}, kMemoryLimit);
+
+    // Groups with distinct keys are added until the limit is reached
+    std::size_t groupCount = 0;
+    try {
+        for (; groupCount < kMemoryLimit; ++groupCount) {
+            std::vector<dbengine::Variant> keys;
+            keys.emplace_back(std::to_string(groupCount) + std::string(100, 'x'));
+            aggregator.findOrAddGroup(std::move(keys));
+        }
+        FAIL() << "Memory limit is not checked";
+    } catch (dbengine::DatabaseError& ex) {
+        EXPECT_EQ(ex.getErrorCode(), static_cast<int>(siodb::iomgr::IOManagerMessageId::
+                                                     kErrorGroupByMemoryLimitExceeded));
+    }
+    EXPECT_GT(groupCount, 0U);
+    EXPECT_EQ(aggregator.getGroupCount(), groupCount);
+    EXPECT_LE(aggregator.getMemoryUsage(), kMemoryLimit);
+
+    // Existing groups are still found
+    std::vector<dbengine::Variant> keys;
+    keys.emplace_back(std::string("0") + std::string(100, 'x'));
+    const auto [groupIndex, isNewGroup] = aggregator.findOrAddGroup(std::move(keys));
+    EXPECT_EQ(groupIndex, 0U);
+    EXPECT_FALSE(isNewGroup);
+}
+
+TEST(Query, SelectCountAndMinMaxTridFromMetadata)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+            {"B", siodb::COLUMN_DATA_TYPE_TEXT, false},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("SELECT_COUNT_FROM_METADATA_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    {
+        const std::string statement(
+                "INSERT INTO SYS.SELECT_COUNT_FROM_METADATA_1 VALUES (1, 'x'), (2, NULL), "
+                "(3, 'y'), (4, NULL), (5, 'z')");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), 5U);
+    }
+
+    /// ----------- DELETE -----------
+    {
+        const std::string statement("DELETE FROM SYS.SELECT_COUNT_FROM_METADATA_1 WHERE TRID = 1");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto deleteRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*deleteRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_TRUE(response.has_affected_row_count());
+        ASSERT_EQ(response.affected_row_count(), 1U);
+    }
+
+    /// ----------- SELECT -----------
+    {
+        const std::string statement(
+                "SELECT COUNT(*), COUNT(B), MIN(TRID), MAX(TRID) FROM "
+                "SYS.SELECT_COUNT_FROM_METADATA_1");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto selectRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*selectRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+        ASSERT_EQ(response.column_description_size(), 4);
+        for (int i = 0; i < 4; ++i)
+            ASSERT_EQ(response.column_description(i).type(), siodb::COLUMN_DATA_TYPE_UINT64);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        ASSERT_TRUE(rowLength > 0);
+
+        // Null bitmask
+        std::uint8_t nullMask = 0xFF;
+        ASSERT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+        EXPECT_EQ(nullMask, 0U);
+
+        for (const std::uint64_t expectedValue : {4, 2, 2, 5}) {
+            std::uint64_t value = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(&value));
+            EXPECT_EQ(value, expectedValue);
+        }
+
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
+
+TEST(Query, SelectCountIgnoresUncommittedRows)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+    const auto otherRequestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+    instance->getDatabase("SYS")->createUserTable("SELECT_COUNT_UNCOMMITTED_1",
+            dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+
+    const auto executeStatement = [&](dbengine::RequestHandler& handler,
+                                          const std::string& statement) {
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto request =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+        handler.executeRequest(*request, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        return response;
+    };
+
+    const auto selectCount = [&]() {
+        const auto response = executeStatement(
+                *requestHandler, "SELECT COUNT(*) FROM SELECT_COUNT_UNCOMMITTED_1");
+        EXPECT_EQ(response.message_size(), 0);
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        EXPECT_TRUE(codedInput.ReadVarint64(&rowLength));
+        std::uint8_t nullMask = 0xFF;
+        EXPECT_TRUE(codedInput.ReadRaw(&nullMask, 1));
+        std::uint64_t count = 0;
+        EXPECT_TRUE(codedInput.ReadVarint64(&count));
+        EXPECT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+        return count;
+    };
+
+    ASSERT_EQ(executeStatement(*requestHandler,
+                      "INSERT INTO SELECT_COUNT_UNCOMMITTED_1 VALUES (1), (2), (3)")
+                      .message_size(),
+            0);
+    EXPECT_EQ(selectCount(), 3U);
+
+    // Rows inserted by the other session are counted only after commit
+    ASSERT_EQ(executeStatement(*otherRequestHandler, "BEGIN TRANSACTION").message_size(), 0);
+    ASSERT_EQ(executeStatement(*otherRequestHandler,
+                      "INSERT INTO SELECT_COUNT_UNCOMMITTED_1 VALUES (4), (5)")
+                      .message_size(),
+            0);
+    EXPECT_EQ(selectCount(), 3U);
+    ASSERT_EQ(executeStatement(*otherRequestHandler, "COMMIT").message_size(), 0);
+    EXPECT_EQ(selectCount(), 5U);
+}
+
+TEST(Query, SelectAsOfTransactionAndTimestamp)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"U16", siodb::COLUMN_DATA_TYPE_UINT16, true},
+    };
+    const auto db = instance->getDatabase("SYS");
+    db->createUserTable("SELECT_AS_OF_1", dbengine::TableType::kDisk, tableColumns,
+            dbengine::User::kSuperUserId);
+
+    const auto executeStatement = [&](const std::string& statement) {
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto request =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+        requestHandler->executeRequest(*request, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        return response;
+    };
+
+    const auto selectValues = [&](const std::string& statement) {
+        std::vector<std::uint16_t> values;
+        const auto response = executeStatement(statement);
+        EXPECT_EQ(response.message_size(), 0);
+        if (response.message_size() != 0) return values;
+        EXPECT_EQ(response.column_description_size(), 1);
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        std::uint64_t rowLength = 0;
+        while (codedInput.ReadVarint64(&rowLength) && rowLength > 0) {
+            std::uint32_t u16 = 0;
+            EXPECT_TRUE(codedInput.ReadVarint32(&u16));
+            values.push_back(static_cast<std::uint16_t>(u16));
+        }
+        return values;
+    };
+
+    /// ----------- INSERT, UPDATE, DELETE -----------
+    ASSERT_EQ(executeStatement("INSERT INTO SELECT_AS_OF_1 VALUES (1), (2)").message_size(), 0);
+    // Empty transaction marks point in history
+    const auto insertedTransactionId = db->beginTransaction();
+    db->endTransaction(insertedTransactionId);
+
+    ASSERT_EQ(executeStatement("UPDATE SELECT_AS_OF_1 SET U16 = 10 WHERE U16 = 1").message_size(),
+            0);
+    ASSERT_EQ(executeStatement("DELETE FROM SELECT_AS_OF_1 WHERE U16 = 2").message_size(), 0);
+    const auto changedTransactionId = db->beginTransaction();
+    db->endTransaction(changedTransactionId);
+
+    // Rolled back changes never become visible
+    ASSERT_EQ(executeStatement("BEGIN TRANSACTION").message_size(), 0);
+    ASSERT_EQ(executeStatement("UPDATE SELECT_AS_OF_1 SET U16 = 20 WHERE U16 = 10").message_size(),
+            0);
+    ASSERT_EQ(executeStatement("ROLLBACK").message_size(), 0);
+
+    /// ----------- SELECT AS OF -----------
+    const std::vector<std::uint16_t> expectedInsertedValues {1, 2};
+    EXPECT_EQ(selectValues("SELECT U16 FROM SELECT_AS_OF_1 AS OF TRANSACTION "
+                           + std::to_string(insertedTransactionId)),
+            expectedInsertedValues);
+
+    const std::vector<std::uint16_t> expectedChangedValues {10};
+    EXPECT_EQ(selectValues("SELECT U16 FROM SELECT_AS_OF_1 AS OF TRANSACTION "
+                           + std::to_string(changedTransactionId)),
+            expectedChangedValues);
+    EXPECT_EQ(selectValues("SELECT U16 FROM SELECT_AS_OF_1 AS OF TIMESTAMP "
+                           + std::to_string(std::numeric_limits<std::int64_t>::max())),
+            expectedChangedValues);
+    EXPECT_EQ(selectValues("SELECT U16 FROM SELECT_AS_OF_1"), expectedChangedValues);
+
+    // Nothing existed before the epoch
+    EXPECT_TRUE(selectValues("SELECT U16 FROM SELECT_AS_OF_1 AS OF TIMESTAMP 0").empty());
+
+    // Transaction IDs start from 1
+    EXPECT_EQ(executeStatement("SELECT U16 FROM SELECT_AS_OF_1 AS OF TRANSACTION 0").message_size(),
+            1);
+}
+
+TEST(Query, ExplainAnalyzeSelect)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    // create table
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+
+    instance->getDatabase("SYS")->createUserTable("EXPLAIN_ANALYZE_1", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    /// ----------- INSERT -----------
+    {
+        const std::string statement(
+                "INSERT INTO SYS.EXPLAIN_ANALYZE_1 VALUES (1), (2), (3), (4), (5)");
+
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto insertRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        requestHandler->executeRequest(*insertRequest, TestEnvironment::kTestRequestId, 0, 1);
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        ASSERT_EQ(response.affected_row_count(), 5U);
+    }
+
+    /// ----------- EXPLAIN ANALYZE -----------
+    {
+        const std::string statement(
+                "EXPLAIN ANALYZE SELECT A FROM SYS.EXPLAIN_ANALYZE_1 WHERE A > 2");
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+
+        const auto explainRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        siodb::iomgr_protocol::DatabaseEngineResponse response;
+        requestHandler->executeRequest(*explainRequest, TestEnvironment::kTestRequestId, 0, 1);
+        siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+                response, inputStream);
+
+        EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+        ASSERT_EQ(response.message_size(), 0);
+        EXPECT_FALSE(response.has_affected_row_count());
+        ASSERT_EQ(response.column_description_size(), 12);
+        EXPECT_EQ(response.column_description(2).name(), "OPERATOR");
+        EXPECT_EQ(response.column_description(4).name(), "ROWS");
+
+        // SELECT <- ROW FETCH <- FILTER <- SCAN, each operator produces expected number of rows
+        const std::vector<std::pair<std::string, std::uint64_t>> expectedOperators {
+                {"SELECT", 3}, {"  ROW FETCH", 3}, {"    FILTER", 3}, {"      ", 5}};
+
+        google::protobuf::io::CodedInputStream codedInput(&inputStream);
+        for (std::size_t i = 0; i < expectedOperators.size(); ++i) {
+            std::uint64_t rowLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+            ASSERT_TRUE(rowLength > 0);
+
+            std::uint8_t nullMask[2] = {0xFF, 0xFF};
+            ASSERT_TRUE(codedInput.ReadRaw(nullMask, sizeof(nullMask)));
+
+            std::uint32_t id = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&id));
+            EXPECT_EQ(id, i);
+
+            // PARENT_ID is NULL only for the root operator
+            EXPECT_EQ((nullMask[0] & 2) != 0, i == 0);
+            if (i > 0) {
+                std::uint32_t parentId = 0;
+                ASSERT_TRUE(codedInput.ReadVarint32(&parentId));
+                EXPECT_EQ(parentId, i - 1);
+            }
+
+            std::string text;
+            std::uint32_t textLength = 0;
+            ASSERT_TRUE(codedInput.ReadVarint32(&textLength));
+            ASSERT_TRUE(codedInput.ReadString(&text, textLength));
+            EXPECT_EQ(text.compare(0, expectedOperators[i].first.size(),
+                              expectedOperators[i].first),
+                    0);
+            ASSERT_TRUE(codedInput.ReadVarint32(&textLength));
+            ASSERT_TRUE(codedInput.ReadString(&text, textLength));
+
+            std::uint64_t rowCount = 0;
+            ASSERT_TRUE(codedInput.ReadVarint64(&rowCount));
+            EXPECT_EQ(rowCount, expectedOperators[i].second);
+
+            // Remaining statistics, CPU time is present only for some operators
+            const int statisticCount = (nullMask[0] & 0x40) ? 6 : 7;
+            for (int j = 0; j < statisticCount; ++j) {
+                std::uint64_t value = 0;
+                ASSERT_TRUE(codedInput.ReadVarint64(&value));
+            }
+        }
+
+        std::uint64_t rowLength = 0;
+        ASSERT_TRUE(codedInput.ReadVarint64(&rowLength));
+        EXPECT_EQ(rowLength, 0U);
+    }
+}
@@ -4,6 +4,8 @@
 
 // Project headers
 #include "RequestHandlerTest_TestEnv.h"
+#include "dbengine/TableDataSet.h"
+#include "dbengine/UserDatabase.h"
 #include "dbengine/parser/DBEngineRequestFactory.h"
 #include "dbengine/parser/SqlParser.h"
 
@@ -11,6 +13,193 @@
 #include <siodb/common/protobuf/ProtobufMessageIO.h>
 #include <siodb/common/protobuf/RawDateTimeIO.h>
 
+// STL headers
+#include <algorithm>
+
 namespace parser_ns = dbengine::parser;
 
-// TODO: Add TC test
+namespace {
+
+/**
+ * Executes statement and checks that it succeeded.
+ * @param requestHandler Request handler.
+ * @param inputStream Response input stream.
+ * @param statement SQL statement.
+ * @return Number of error messages in the response.
+ */
+int executeStatement(dbengine::RequestHandler& requestHandler,
+        siodb::protobuf::CustomProtobufInputStream& inputStream, const std::string& statement)
+{
+    parser_ns::SqlParser parser(statement);
+    parser.parse();
+
+    const auto request = parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+    requestHandler.executeRequest(*request, TestEnvironment::kTestRequestId, 0, 1);
+
+    siodb::iomgr_protocol::DatabaseEngineResponse response;
+    siodb::protobuf::readMessage(siodb::protobuf::ProtocolMessageType::kDatabaseEngineResponse,
+            response, inputStream);
+    EXPECT_EQ(response.request_id(), TestEnvironment::kTestRequestId);
+    return response.message_size();
+}
+
+/**
+ * Reads all values of the single column table.
+ * @param table Table.
+ * @param snapshot Transaction snapshot, nullptr to read latest row versions.
+ * @return Column values.
+ */
+std::vector<std::uint16_t> readValues(
+        const dbengine::TablePtr& table, const dbengine::TransactionSnapshotPtr& snapshot = nullptr)
+{
+    dbengine::TableDataSet dataSet(table, "");
+    dataSet.emplaceColumnInfo(1, "U16", "");
+    dataSet.setSnapshot(snapshot);
+    std::vector<std::uint16_t> values;
+    for (dataSet.resetCursor(); dataSet.hasCurrentRow(); dataSet.moveToNextRow())
+        values.push_back(dataSet.getColumnValue(0).getUInt16());
+    return values;
+}
+
+}  // namespace
+
+TEST(TC, RollbackTransaction)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"U16", siodb::COLUMN_DATA_TYPE_UINT16, true},
+    };
+    const auto db = instance->getDatabase("SYS");
+    const auto table = db->createUserTable("TC_TEST_ROLLBACK", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_ROLLBACK VALUES (1), (2)"),
+            0);
+
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "BEGIN TRANSACTION"), 0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_ROLLBACK VALUES (3)"),
+            0);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream,
+                      "UPDATE TC_TEST_ROLLBACK SET U16 = 10 WHERE U16 = 1"),
+            0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "DELETE FROM TC_TEST_ROLLBACK WHERE U16 = 2"),
+            0);
+
+    // Uncommitted changes are seen by the transaction itself, but not by snapshot readers
+    const std::vector<std::uint16_t> expectedChangedValues {10, 3};
+    EXPECT_EQ(readValues(table), expectedChangedValues);
+    {
+        dbengine::TableDataSet dataSet(table, "");
+        dataSet.emplaceColumnInfo(1, "U16", "");
+        dataSet.setSnapshot(db->createSnapshot());
+        std::vector<std::uint16_t> values;
+        for (dataSet.resetCursor(); dataSet.hasCurrentRow(); dataSet.moveToNextRow())
+            values.push_back(dataSet.getColumnValue(0).getUInt16());
+        const std::vector<std::uint16_t> expectedCommittedValues {1, 2};
+        EXPECT_EQ(values, expectedCommittedValues);
+    }
+
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "ROLLBACK"), 0);
+    const std::vector<std::uint16_t> expectedValues {1, 2};
+    EXPECT_EQ(readValues(table), expectedValues);
+
+    // No transaction anymore
+    EXPECT_EQ(executeStatement(*requestHandler, inputStream, "COMMIT"), 1);
+}
+
+TEST(TC, CommitTransactionWithSavepoints)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    const auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"U16", siodb::COLUMN_DATA_TYPE_UINT16, true},
+    };
+    const auto db = instance->getDatabase("SYS");
+    const auto table = db->createUserTable("TC_TEST_COMMIT", dbengine::TableType::kDisk,
+            tableColumns, dbengine::User::kSuperUserId);
+
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "BEGIN TRANSACTION"), 0);
+    EXPECT_EQ(executeStatement(*requestHandler, inputStream, "BEGIN TRANSACTION"), 1);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_COMMIT VALUES (1)"),
+            0);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "SAVEPOINT SP1"), 0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_COMMIT VALUES (2)"),
+            0);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "ROLLBACK TO SAVEPOINT SP1"), 0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_COMMIT VALUES (3)"),
+            0);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "RELEASE SP1"), 0);
+    EXPECT_EQ(executeStatement(*requestHandler, inputStream, "ROLLBACK TO SAVEPOINT SP1"), 1);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "COMMIT"), 0);
+
+    const std::vector<std::uint16_t> expectedValues {1, 3};
+    EXPECT_EQ(readValues(table), expectedValues);
+}
+
+TEST(TC, RollbackInterruptedTransactionOnOpen)
+{
+    const auto instance = TestEnvironment::getInstance();
+    ASSERT_NE(instance, nullptr);
+
+    auto requestHandler = TestEnvironment::makeRequestHandler();
+
+    siodb::protobuf::CustomProtobufInputStream inputStream(
+            TestEnvironment::getInputStream(), siodb::utils::DefaultErrorCodeChecker());
+
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"U16", siodb::COLUMN_DATA_TYPE_UINT16, true},
+    };
+    const auto db = instance->createDatabase(
+            "TC_TEST_RECOVERY", "none", siodb::BinaryValue(), dbengine::User::kSuperUserId);
+    db->createUserTable("TC_TEST_RECOVERY", dbengine::TableType::kDisk, tableColumns,
+            dbengine::User::kSuperUserId);
+
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "USE DATABASE TC_TEST_RECOVERY"), 0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_RECOVERY VALUES (1), (2)"),
+            0);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream, "BEGIN TRANSACTION"), 0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "INSERT INTO TC_TEST_RECOVERY VALUES (3)"),
+            0);
+    ASSERT_EQ(executeStatement(*requestHandler, inputStream,
+                      "UPDATE TC_TEST_RECOVERY SET U16 = 10 WHERE U16 = 1"),
+            0);
+    ASSERT_EQ(executeStatement(
+                      *requestHandler, inputStream, "DELETE FROM TC_TEST_RECOVERY WHERE U16 = 2"),
+            0);
+
+    // Uncommitted changes reach disk, then process "crashes": transaction never ends
+    db->flushTables();
+    static_cast<void>(requestHandler.release());
+
+    const auto databaseRecords = instance->getDatabaseRecordsOrderedByName();
+    const auto it = std::find_if(databaseRecords.cbegin(), databaseRecords.cend(),
+            [](const auto& record) { return record.m_name == "TC_TEST_RECOVERY"; });
+    ASSERT_NE(it, databaseRecords.cend());
+    const auto reopenedDb = std::make_shared<dbengine::UserDatabase>(*instance, *it, 0);
+    const auto table = reopenedDb->getTableChecked("TC_TEST_RECOVERY");
+
+    const std::vector<std::uint16_t> expectedValues {1, 2};
+    EXPECT_EQ(readValues(table, reopenedDb->createSnapshot()), expectedValues);
+    EXPECT_EQ(readValues(table), expectedValues);
+}
@@ -0,0 +1,148 @@
+// Copyright (C) 2019-2020 Siodb GmbH. All rights reserved.
+// Use of this source code is governed by a license that can be found
+// in the LICENSE file.
+
+// Project headers
+#include "RequestHandlerTest_TestEnv.h"
+#include "dbengine/Column.h"
+#include "dbengine/Table.h"
+
+// Common project headers
+#include <siodb/common/utils/FsUtils.h>
+
+// STL headers
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace {
+
+/**
+ * Creates table with single column.
+ * @param tableName Table name.
+ * @return Table object.
+ */
+dbengine::TablePtr createTable(const std::string& tableName)
+{
+    const auto instance = TestEnvironment::getInstance();
+    const std::vector<dbengine::SimpleColumnSpecification> tableColumns {
+            {"A", siodb::COLUMN_DATA_TYPE_INT32, true},
+    };
+    return instance->getDatabase("SYS")->createUserTable(
+            tableName, dbengine::TableType::kDisk, tableColumns, dbengine::User::kSuperUserId);
+}
+
+/**
+ * Opens master column of the table from disk, like it is opened when table is loaded.
+ * Master column of the table object itself must not be used meanwhile.
+ * @param table Table object.
+ * @return Master column object.
+ */
+dbengine::ColumnPtr openMasterColumn(dbengine::Table& table)
+{
+    const auto columnRecord =
+            table.getDatabase().getColumnRecord(table.getMasterColumn()->getId());
+    return std::make_shared<dbengine::Column>(table, columnRecord, table.getFirstUserTrid());
+}
+
+/**
+ * Reads content of the TRID counters file.
+ * @param column Master column.
+ * @return File content.
+ */
+std::string readTridCountersFile(const dbengine::Column& column)
+{
+    std::ifstream file(siodb::utils::constructPath(column.getDataDir(), "trid"),
+            std::ios::in | std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST(TridCounters, ContinueAfterCleanReopen)
+{
+    const auto table = createTable("TRID_COUNTERS_1");
+
+    std::uint64_t lastTrid = 0;
+    {
+        const auto column = openMasterColumn(*table);
+        const auto firstTrid = column->getLastUserTrid() + 1;
+        for (std::uint64_t i = 0; i < 10; ++i) {
+            lastTrid = column->generateNextUserTrid();
+            EXPECT_EQ(lastTrid, firstTrid + i);
+        }
+    }
+
+    // Unused part of the reserved range is returned on close
+    const auto column = openMasterColumn(*table);
+    EXPECT_EQ(column->getLastUserTrid(), lastTrid);
+    EXPECT_EQ(column->generateNextUserTrid(), lastTrid + 1);
+}
+
+TEST(TridCounters, ResumePastReservedRangeAfterCrash)
+{
+    const auto table = createTable("TRID_COUNTERS_2");
+
+    std::uint64_t lastTrid = 0;
+    std::string tridCountersFileContent;
+    std::string tridCountersFilePath;
+    {
+        const auto column = openMasterColumn(*table);
+        for (std::uint64_t i = 0; i < 10; ++i)
+            lastTrid = column->generateNextUserTrid();
+        // Counters on disk at this point are what survives crash
+        tridCountersFileContent = readTridCountersFile(*column);
+        tridCountersFilePath = siodb::utils::constructPath(column->getDataDir(), "trid");
+    }
+    {
+        std::ofstream file(tridCountersFilePath, std::ios::out | std::ios::binary);
+        file.write(tridCountersFileContent.data(), tridCountersFileContent.size());
+    }
+
+    // Last user TRID follows the marker
+    std::uint64_t lastReservedTrid = 0;
+    ASSERT_GE(tridCountersFileContent.size(), 2 * sizeof(std::uint64_t));
+    std::memcpy(&lastReservedTrid, tridCountersFileContent.data() + sizeof(std::uint64_t),
+            sizeof(lastReservedTrid));
+    EXPECT_GE(lastReservedTrid, lastTrid);
+
+    const auto column = openMasterColumn(*table);
+    const auto trid = column->generateNextUserTrid();
+    EXPECT_GT(trid, lastTrid);
+    EXPECT_EQ(trid, lastReservedTrid + 1);
+}
+
+TEST(TridCounters, ConcurrentGeneration)
+{
+    const auto table = createTable("TRID_COUNTERS_3");
+    const auto column = openMasterColumn(*table);
+    const auto firstTrid = column->getLastUserTrid() + 1;
+
+    // Threads together cross several reserved ranges
+    constexpr std::size_t kThreadCount = 4;
+    constexpr std::size_t kTridCountPerThread = 5000;
+    std::vector<std::vector<std::uint64_t>> trids(kThreadCount);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([&, i] {
+            trids[i].reserve(kTridCountPerThread);
+            for (std::size_t j = 0; j < kTridCountPerThread; ++j)
+                trids[i].push_back(column->generateNextUserTrid());
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<std::uint64_t> allTrids;
+    for (const auto& threadTrids : trids) {
+        // Each thread gets increasing TRIDs
+        EXPECT_TRUE(std::is_sorted(threadTrids.cbegin(), threadTrids.cend()));
+        allTrids.insert(allTrids.end(), threadTrids.cbegin(), threadTrids.cend());
+    }
+    std::sort(allTrids.begin(), allTrids.end());
+    ASSERT_EQ(allTrids.size(), kThreadCount * kTridCountPerThread);
+    for (std::size_t i = 0; i < allTrids.size(); ++i)
+        ASSERT_EQ(allTrids[i], firstTrid + i);
+    EXPECT_EQ(column->getLastUserTrid(), allTrids.back());
+}
@@ -471,3 +471,28 @@ TEST(DDL, DropIndexIfExists)
     EXPECT_EQ(request.m_index, "MY_INDEX");
     EXPECT_TRUE(request.m_ifExists);
 }
+
+TEST(DDL, Analyze)
+{
+    const std::vector<std::tuple<std::string, std::string, std::string>> testCases {
+            {"ANALYZE;", "", ""},
+            {"ANALYZE my_table;", "", "MY_TABLE"},
+            {"ANALYZE my_database.my_table;", "MY_DATABASE", "MY_TABLE"},
+    };
+
+    for (const auto& [statement, database, table] : testCases) {
+        // Parse statement and prepare request
+        parser_ns::SqlParser parser(statement);
+        parser.parse();
+        const auto dbeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        // Check request type
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kAnalyze);
+
+        // Check request
+        const auto& request = dynamic_cast<const requests::AnalyzeRequest&>(*dbeRequest);
+        EXPECT_EQ(request.m_database, database);
+        EXPECT_EQ(request.m_table, table);
+    }
+}
@@ -5,7 +5,9 @@
 // Project headers
 #include "TestContext.h"
 #include "dbengine/parser/DBEngineRequestFactory.h"
+#include "dbengine/parser/PreparedStatement.h"
 #include "dbengine/parser/SqlParser.h"
+#include "dbengine/parser/StatementCache.h"
 #include "dbengine/parser/expr/AllExpressions.h"
 
 // Google Test
@@ -327,3 +329,184 @@ TEST(DML, InsertColumnName_2)
     ASSERT_THROW(parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0)),
             std::invalid_argument);
 }
+
+TEST(DML, CopyFrom)
+{
+    // Parse statement and prepare request
+    const std::string statement(
+            "COPY my_database.my_table (col1, col2) FROM '/tmp/data.csv'"
+            " WITH FORMAT = 'CSV', DELIMITER = ';', HEADER");
+    parser_ns::SqlParser parser(statement);
+    parser.parse();
+    const auto dbeRequest =
+            parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+    // Check request type
+    ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kCopyFrom);
+
+    // Check request
+    const auto& request = dynamic_cast<const requests::CopyFromRequest&>(*dbeRequest);
+    EXPECT_EQ(request.m_database, "MY_DATABASE");
+    EXPECT_EQ(request.m_table, "MY_TABLE");
+    ASSERT_EQ(request.m_columns.size(), 2U);
+    EXPECT_EQ(request.m_columns[0], "COL1");
+    EXPECT_EQ(request.m_columns[1], "COL2");
+    EXPECT_EQ(request.m_filePath, "/tmp/data.csv");
+    EXPECT_EQ(request.m_format, dbengine::DataFileFormat::kCsv);
+    EXPECT_EQ(request.m_delimiter, ';');
+    EXPECT_TRUE(request.m_header);
+}
+
+TEST(DML, CopyFrom_InvalidDelimiter)
+{
+    const std::string statement("COPY my_table FROM '/tmp/data.csv' WITH DELIMITER = ';;'");
+    parser_ns::SqlParser parser(statement);
+    parser.parse();
+    ASSERT_THROW(parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0)),
+            std::invalid_argument);
+}
+
+TEST(DML, CopyTo)
+{
+    // Parse statement and prepare request
+    const std::string statement("COPY my_table TO '/tmp/data.bin' WITH FORMAT = 'binary'");
+    parser_ns::SqlParser parser(statement);
+    parser.parse();
+    const auto dbeRequest =
+            parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+    // Check request type
+    ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kCopyTo);
+
+    // Check request
+    const auto& request = dynamic_cast<const requests::CopyToRequest&>(*dbeRequest);
+    EXPECT_TRUE(request.m_database.empty());
+    EXPECT_EQ(request.m_table, "MY_TABLE");
+    EXPECT_TRUE(request.m_columns.empty());
+    EXPECT_EQ(request.m_filePath, "/tmp/data.bin");
+    EXPECT_EQ(request.m_format, dbengine::DataFileFormat::kBinary);
+    EXPECT_EQ(request.m_delimiter, ',');
+    EXPECT_FALSE(request.m_header);
+}
+
+TEST(DML, PreparedInsert)
+{
+    // Prepare statement
+    const parser_ns::PreparedStatement statement(
+            "INSERT INTO my_table (col0, col1, col2, col3) VALUES (?, :name, ?, :name)");
+    ASSERT_EQ(statement.getParameterCount(), 3U);
+
+    // Execute with different values
+    for (std::uint32_t i = 0; i < 2; ++i) {
+        const auto dbeRequest = statement.createRequest(
+                {dbengine::Variant(i), dbengine::Variant("Bill"), dbengine::Variant()});
+
+        // Check request type
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kInsert);
+
+        // Check values
+        const auto& request = dynamic_cast<const requests::InsertRequest&>(*dbeRequest);
+        ASSERT_EQ(request.m_values.size(), 1U);
+        ASSERT_EQ(request.m_values[0].size(), 4U);
+
+        dbengine::Variant v;
+        TestContext context;
+
+        v = request.m_values[0][0]->evaluate(context);
+        EXPECT_EQ(v.getValueType(), siodb::iomgr::dbengine::VariantType::kUInt32);
+        EXPECT_EQ(v.getUInt32(), i);
+
+        v = request.m_values[0][1]->evaluate(context);
+        EXPECT_EQ(v.getValueType(), siodb::iomgr::dbengine::VariantType::kString);
+        EXPECT_EQ(v.getString(), "Bill");
+
+        v = request.m_values[0][2]->evaluate(context);
+        EXPECT_TRUE(v.isNull());
+
+        v = request.m_values[0][3]->evaluate(context);
+        EXPECT_EQ(v.getString(), "Bill");
+    }
+
+    // Check number of values
+    ASSERT_THROW(statement.createRequest({dbengine::Variant()}), std::invalid_argument);
+}
+
+TEST(DML, PreparedSelect)
+{
+    const parser_ns::PreparedStatement statement("SELECT * FROM my_table WHERE col0 > ?2");
+    ASSERT_EQ(statement.getParameterCount(), 2U);
+
+    const auto dbeRequest =
+            statement.createRequest({dbengine::Variant(), dbengine::Variant(std::int64_t(10))});
+    ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+    const auto& request = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+    ASSERT_NE(request.m_where, nullptr);
+}
+
+TEST(DML, PreparedSelectWithLimitAndOffset)
+{
+    // Values are unknown when statement is prepared, so they are checked at execution
+    const parser_ns::PreparedStatement statement("SELECT * FROM my_table LIMIT ? OFFSET ?");
+    ASSERT_EQ(statement.getParameterCount(), 2U);
+
+    const auto dbeRequest = statement.createRequest(
+            {dbengine::Variant(std::int64_t(5)), dbengine::Variant(std::int64_t(10))});
+    ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+    const auto& request = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+    ASSERT_NE(request.m_limit, nullptr);
+    ASSERT_NE(request.m_offset, nullptr);
+
+    TestContext context;
+    EXPECT_EQ(request.m_limit->evaluate(context).getInt64(), 5);
+    EXPECT_EQ(request.m_offset->evaluate(context).getInt64(), 10);
+}
+
+TEST(DML, PreparedMultipleStatements)
+{
+    ASSERT_THROW(parser_ns::PreparedStatement("SELECT * FROM t1; SELECT * FROM t2"),
+            std::invalid_argument);
+}
+
+TEST(DML, StatementCache)
+{
+    parser_ns::StatementCache cache(10);
+
+    const auto dbeRequest1 = cache.createRequest("INSERT INTO t1 VALUES (1, 'Bill')");
+    ASSERT_NE(dbeRequest1, nullptr);
+    const auto dbeRequest2 =
+            cache.createRequest("insert  into t1 values (2, /* name */ 'John');");
+    ASSERT_NE(dbeRequest2, nullptr);
+
+    // Second request must be created from the cached statement with own values
+    auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.m_size, 1U);
+    EXPECT_EQ(stats.m_missCount, 1U);
+    EXPECT_EQ(stats.m_hitCount, 1U);
+
+    ASSERT_EQ(dbeRequest2->m_requestType, requests::DBEngineRequestType::kInsert);
+    const auto& request = dynamic_cast<const requests::InsertRequest&>(*dbeRequest2);
+    ASSERT_EQ(request.m_table, "T1");
+    ASSERT_EQ(request.m_values.size(), 1U);
+    ASSERT_EQ(request.m_values[0].size(), 2U);
+
+    TestContext context;
+    auto v = request.m_values[0][0]->evaluate(context);
+    EXPECT_EQ(v.getValueType(), siodb::iomgr::dbengine::VariantType::kUInt32);
+    EXPECT_EQ(v.getUInt32(), 2U);
+    v = request.m_values[0][1]->evaluate(context);
+    EXPECT_EQ(v.getValueType(), siodb::iomgr::dbengine::VariantType::kString);
+    EXPECT_EQ(v.getString(), "John");
+
+    // Statements that can't be cached
+    EXPECT_EQ(cache.createRequest("SELECT * FROM t1; SELECT * FROM t2"), nullptr);
+    EXPECT_EQ(cache.createRequest("SELECT * FROM t1 WHERE a = ?"), nullptr);
+    EXPECT_EQ(cache.createRequest("CREATE TABLE t2 (a INT32)"), nullptr);
+
+    // DDL invalidation
+    cache.invalidateTable("T2");
+    EXPECT_EQ(cache.getStatistics().m_size, 1U);
+    cache.invalidateTable("T1");
+    stats = cache.getStatistics();
+    EXPECT_EQ(stats.m_size, 0U);
+    EXPECT_EQ(stats.m_invalidationCount, 1U);
+}
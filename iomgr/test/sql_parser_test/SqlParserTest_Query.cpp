@@ -5,6 +5,7 @@
 // Project headers
 #include "TestContext.h"
 #include "dbengine/parser/DBEngineRequestFactory.h"
+#include "dbengine/parser/EmptyContext.h"
 #include "dbengine/parser/SqlParser.h"
 #include "dbengine/parser/expr/AllExpressions.h"
 
@@ -53,8 +54,6 @@ TEST(SqlParser_Query, Select)
 
     checkColumnNameAndAlias(request.m_resultExpressions[0], "COLUMN1", "");
     checkColumnNameAndAlias(request.m_resultExpressions[1], "COLUMN2", "COLUMN_2222");
-
-    // TODO: implement: ORDER BY, GROUP BY, HAVING, LIMIT
 }
 
 TEST(SqlParser_Query, SelectWithExpression)
@@ -1360,4 +1359,183 @@ TEST(SqlParser_Query, SelectWithLimitAndOffset_2)
     const auto& limitExpr =
             dynamic_cast<const requests::ConstantExpression&>(*selectRequest.m_limit);
     ASSERT_TRUE(limitExpr.getValue().compatibleEqual(10));
-}
\ No newline at end of file
+}
+
+/**
+ * Test checks SELECT statement with ORDER BY clause.
+ */
+TEST(SqlParser_Query, SelectWithOrderBy)
+{
+    // Parse statement
+    const std::string statement = "SELECT c1 FROM t1 ORDER BY c1 DESC, c2 + 1, c3 ASC LIMIT 5";
+
+    parser_ns::SqlParser parser(statement);
+    parser.parse();
+
+    const auto dbeRequest =
+            parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+    ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+    const auto& selectRequest = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+    ASSERT_EQ(selectRequest.m_orderBy.size(), 3U);
+
+    ASSERT_EQ(selectRequest.m_orderBy[0].m_subject->getType(),
+            requests::ExpressionType::kSingleColumnReference);
+    const auto& columnExpr = dynamic_cast<const requests::SingleColumnExpression&>(
+            *selectRequest.m_orderBy[0].m_subject);
+    EXPECT_EQ(columnExpr.getColumnName(), "C1");
+    EXPECT_TRUE(selectRequest.m_orderBy[0].m_sortDescending);
+
+    EXPECT_EQ(selectRequest.m_orderBy[1].m_subject->getType(),
+            requests::ExpressionType::kAddOperator);
+    EXPECT_FALSE(selectRequest.m_orderBy[1].m_sortDescending);
+
+    EXPECT_EQ(selectRequest.m_orderBy[2].m_subject->getType(),
+            requests::ExpressionType::kSingleColumnReference);
+    EXPECT_FALSE(selectRequest.m_orderBy[2].m_sortDescending);
+
+    ASSERT_TRUE(selectRequest.m_limit != nullptr);
+}
+
+/**
+ * Test checks SELECT statement with aggregate functions, GROUP BY and HAVING clauses.
+ */
+TEST(SqlParser_Query, SelectWithGroupByAndHaving)
+{
+    // Parse statement
+    const std::string statement =
+            "SELECT c1, COUNT(*), SUM(c2), avg(c3) FROM t1 WHERE c4 > 0 GROUP BY c1, c5 + 1 "
+            "HAVING MAX(c2) > 10";
+
+    parser_ns::SqlParser parser(statement);
+    parser.parse();
+
+    const auto dbeRequest =
+            parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+    ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+    const auto& selectRequest = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+    ASSERT_EQ(selectRequest.m_resultExpressions.size(), 4U);
+
+    const auto& countFunction = dynamic_cast<const requests::CountFunction&>(
+            *selectRequest.m_resultExpressions[1].m_expression);
+    EXPECT_EQ(countFunction.getArgument(), nullptr);
+    EXPECT_EQ(selectRequest.m_resultExpressions[2].m_expression->getType(),
+            requests::ExpressionType::kSumFunction);
+    EXPECT_EQ(selectRequest.m_resultExpressions[3].m_expression->getType(),
+            requests::ExpressionType::kAvgFunction);
+
+    ASSERT_TRUE(selectRequest.m_where != nullptr);
+
+    ASSERT_EQ(selectRequest.m_groupBy.size(), 2U);
+    EXPECT_EQ(selectRequest.m_groupBy[0]->getType(),
+            requests::ExpressionType::kSingleColumnReference);
+    EXPECT_EQ(selectRequest.m_groupBy[1]->getType(), requests::ExpressionType::kAddOperator);
+
+    ASSERT_TRUE(selectRequest.m_having != nullptr);
+    const auto& havingExpr =
+            dynamic_cast<const requests::GreaterOperator&>(*selectRequest.m_having);
+    EXPECT_EQ(havingExpr.getLeftOperand().getType(), requests::ExpressionType::kMaxFunction);
+}
+
+/**
+ * Test checks EXPLAIN and EXPLAIN ANALYZE statements.
+ */
+TEST(SqlParser_Query, Explain)
+{
+    {
+        parser_ns::SqlParser parser("EXPLAIN SELECT c1 FROM t1 WHERE c2 > 0");
+        parser.parse();
+
+        const auto dbeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kExplain);
+        const auto& explainRequest = dynamic_cast<const requests::ExplainRequest&>(*dbeRequest);
+        EXPECT_FALSE(explainRequest.m_analyze);
+        ASSERT_EQ(explainRequest.m_request->m_requestType, requests::DBEngineRequestType::kSelect);
+        const auto& selectRequest =
+                dynamic_cast<const requests::SelectRequest&>(*explainRequest.m_request);
+        ASSERT_EQ(selectRequest.m_tables.size(), 1U);
+        EXPECT_EQ(selectRequest.m_tables[0].m_name, "T1");
+        EXPECT_TRUE(selectRequest.m_where != nullptr);
+    }
+
+    {
+        parser_ns::SqlParser parser("EXPLAIN ANALYZE SELECT * FROM t1");
+        parser.parse();
+
+        const auto dbeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kExplain);
+        const auto& explainRequest = dynamic_cast<const requests::ExplainRequest&>(*dbeRequest);
+        EXPECT_TRUE(explainRequest.m_analyze);
+        EXPECT_EQ(explainRequest.m_request->m_requestType, requests::DBEngineRequestType::kSelect);
+    }
+
+    {
+        parser_ns::SqlParser parser("EXPLAIN INSERT INTO t1 VALUES (1)");
+        parser.parse();
+        ASSERT_THROW(parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0)),
+                std::invalid_argument);
+    }
+}
+
+TEST(SqlParser_Query, SelectAsOf)
+{
+    {
+        parser_ns::SqlParser parser("SELECT c1 FROM t1 AS OF TRANSACTION 10 WHERE c2 > 0");
+        parser.parse();
+
+        const auto dbeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+        const auto& selectRequest = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+        ASSERT_EQ(selectRequest.m_tables.size(), 1U);
+        EXPECT_EQ(selectRequest.m_tables[0].m_name, "T1");
+        EXPECT_TRUE(selectRequest.m_tables[0].m_alias.empty());
+        EXPECT_TRUE(selectRequest.m_where != nullptr);
+        EXPECT_EQ(selectRequest.m_asOfType, requests::AsOfType::kTransaction);
+        ASSERT_TRUE(selectRequest.m_asOf != nullptr);
+        requests::EmptyContext emptyContext;
+        EXPECT_EQ(selectRequest.m_asOf->evaluate(emptyContext).asUInt64(), 10U);
+    }
+
+    {
+        parser_ns::SqlParser parser(
+                "SELECT * FROM t1 AS a AS OF TIMESTAMP '2020-01-01 10:00:00'");
+        parser.parse();
+
+        const auto dbeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+        const auto& selectRequest = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+        ASSERT_EQ(selectRequest.m_tables.size(), 1U);
+        EXPECT_EQ(selectRequest.m_tables[0].m_alias, "A");
+        EXPECT_EQ(selectRequest.m_asOfType, requests::AsOfType::kTimestamp);
+        EXPECT_TRUE(selectRequest.m_asOf != nullptr);
+    }
+
+    {
+        parser_ns::SqlParser parser("SELECT * FROM t1");
+        parser.parse();
+
+        const auto dbeRequest =
+                parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0));
+
+        ASSERT_EQ(dbeRequest->m_requestType, requests::DBEngineRequestType::kSelect);
+        const auto& selectRequest = dynamic_cast<const requests::SelectRequest&>(*dbeRequest);
+        EXPECT_EQ(selectRequest.m_asOfType, requests::AsOfType::kNone);
+        EXPECT_TRUE(selectRequest.m_asOf == nullptr);
+    }
+
+    {
+        parser_ns::SqlParser parser("SELECT * FROM t1 AS OF VERSION 10");
+        parser.parse();
+        ASSERT_THROW(parser_ns::DBEngineRequestFactory::createRequest(parser.findStatement(0)),
+                std::runtime_error);
+    }
+}
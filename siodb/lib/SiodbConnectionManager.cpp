@@ -6,6 +6,7 @@
 
 // Common project headers
 #include <siodb/common/log/Log.h>
+#include <siodb/common/net/FileDescriptorPassing.h>
 #include <siodb/common/net/TcpServer.h>
 #include <siodb/common/net/UnixServer.h>
 #include <siodb/common/options/DatabaseInstanceSocket.h>
@@ -16,10 +17,12 @@
 #include <siodb/common/utils/FileDescriptorGuard.h>
 
 // STL headers
+#include <algorithm>
 #include <chrono>
 
 // System headers
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <netinet/in.h>
 #include <pthread.h>
 #include <signal.h>
@@ -60,6 +63,9 @@ SiodbConnectionManager::~SiodbConnectionManager()
         m_connectionListenerThread.join();
     }
 
+    // Pooled workers exit when their channels are closed and all clients disconnect
+    m_workerPool.clear();
+
     // Signal dead connection recycler thread and wait for it to finish
     {
         std::lock_guard lock(m_connectionHandlersMutex);
@@ -154,6 +160,9 @@ void SiodbConnectionManager::connectionListenerThreadMain()
         return;
     }
 
+    // Pre-start connection workers, so that accepted connections are served immediately
+    fillWorkerPool();
+
     while (!m_exitRequested) {
         // Accept connection
         FileDescriptorGuard client(m_socketDomain == AF_UNIX ? acceptUnixConnection(server.getFd())
@@ -165,48 +174,146 @@ void SiodbConnectionManager::connectionListenerThreadMain()
             continue;
         }
 
-        // Prepare user connection worker command-line parameters
-        std::vector<std::string> args;
-        args.reserve(10);
-        args.push_back(m_workerExecutablePath);
-        args.push_back("--instance");
-        args.push_back(m_dbOptions->m_generalOptions.m_name);
-        args.push_back("--client-fd");
-        args.push_back(std::to_string(client.getFd()));
-        if (m_checkUser && m_socketDomain == AF_UNIX) {
-            args.push_back("--admin");
+        // Pass connection to the pooled worker, if there is one which can accept it,
+        // otherwise start dedicated worker for this connection.
+        if (passConnectionToPooledWorker(client.getFd())) continue;
+        startWorkerProcess("--client-fd", client.getFd());
+    }
+}
+
+pid_t SiodbConnectionManager::startWorkerProcess(const char* fdOptionName, int fd)
+{
+    // Prepare user connection worker command-line parameters
+    std::vector<std::string> args;
+    args.reserve(10);
+    args.push_back(m_workerExecutablePath);
+    args.push_back("--instance");
+    args.push_back(m_dbOptions->m_generalOptions.m_name);
+    args.push_back(fdOptionName);
+    args.push_back(std::to_string(fd));
+    if (m_checkUser && m_socketDomain == AF_UNIX) {
+        args.push_back("--admin");
+    }
+    std::vector<char*> execArgs(args.size() + 1);
+    std::transform(args.cbegin(), args.cend(), execArgs.begin(),
+            [](auto& s) noexcept { return stdext::as_mutable_ptr(s.c_str()); });
+    char* envp[] = {nullptr};
+
+    // Start worker process
+    const auto pid = fork();
+    if (pid < 0) {
+        // Error occurred
+        const int errorCode = errno;
+        LOG_ERROR << m_socketTypeName << kLogContext
+                  << "Can't create new process: " << std::strerror(errorCode);
+        return -1;
+    }
+
+    if (pid > 0) {
+        // Parent process
+        {
+            std::lock_guard lock(m_connectionHandlersMutex);
+            m_connectionHandlers.insert(pid);
         }
-        std::vector<char*> execArgs(args.size() + 1);
-        std::transform(
-                args.cbegin(), args.cend(), execArgs.begin(),
-                [](auto& s) noexcept { return stdext::as_mutable_ptr(s.c_str()); });
-        char* envp[] = {nullptr};
-
-        // Start worker process
-        const auto pid = fork();
-        if (pid < 0) {
-            // Error occurred
+        LOG_INFO << kLogContext << "Started new user connection worker, PID " << pid;
+        return pid;
+    }
+
+    // Child process. All descriptors are opened with FD_CLOEXEC,
+    // so only the one intended for this worker must be inherited.
+    if (::fcntl(fd, F_SETFD, 0) < 0) _exit(5);
+    execve(execArgs.front(), execArgs.data(), envp);
+    // If we have reached here, execve() failed.
+    _exit(5);
+}
+
+void SiodbConnectionManager::fillWorkerPool()
+{
+    while (m_workerPool.size() < m_dbOptions->m_generalOptions.m_connectionWorkerPoolSize) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) < 0) {
             const int errorCode = errno;
             LOG_ERROR << m_socketTypeName << kLogContext
-                      << "Can't create new process: " << std::strerror(errorCode);
-            continue;
+                      << "Can't create connection worker channel: " << std::strerror(errorCode);
+            return;
         }
+        FileDescriptorGuard channel(fds[0]), workerChannel(fds[1]);
+        const auto pid = startWorkerProcess("--worker-fd", workerChannel.getFd());
+        if (pid < 0) return;
+        m_workerPool.push_back(PooledWorker {pid, std::move(channel), 0, 0});
+    }
+}
 
-        if (pid > 0) {
-            // Parent process
-            {
-                std::lock_guard lock(m_connectionHandlersMutex);
-                m_connectionHandlers.insert(pid);
+void SiodbConnectionManager::updateWorkerPool()
+{
+    auto it = m_workerPool.begin();
+    while (it != m_workerPool.end()) {
+        // Each notification is a single byte message about disconnected client
+        bool exited = false;
+        while (true) {
+            char data = 0;
+            const auto n = ::recv(it->m_channel.getFd(), &data, sizeof(data), MSG_DONTWAIT);
+            if (n > 0) {
+                if (it->m_activeClientCount > 0) --it->m_activeClientCount;
+                continue;
             }
-            LOG_INFO << kLogContext << "Started new user connection worker, PID " << pid;
+            if (n < 0 && errno == EINTR) continue;
+            exited = n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+            break;
+        }
+
+        if (exited) {
+            LOG_WARNING << m_socketTypeName << kLogContext << "Pooled connection worker PID "
+                        << it->m_pid << " exited unexpectedly.";
+            it = m_workerPool.erase(it);
+        } else
+            ++it;
+    }
+}
+
+bool SiodbConnectionManager::passConnectionToPooledWorker(int clientFd)
+{
+    if (m_dbOptions->m_generalOptions.m_connectionWorkerPoolSize == 0) return false;
+
+    updateWorkerPool();
+    fillWorkerPool();
+
+    const auto maxClients = m_dbOptions->m_generalOptions.m_maxClientsPerConnectionWorker;
+    const auto maxLifetimeClients =
+            m_dbOptions->m_generalOptions.m_maxConnectionWorkerLifetimeClients;
+    while (!m_workerPool.empty()) {
+        const auto it = std::min_element(m_workerPool.begin(), m_workerPool.end(),
+                [](const auto& left, const auto& right) noexcept {
+                    return left.m_activeClientCount < right.m_activeClientCount;
+                });
+        if (it->m_activeClientCount >= maxClients) return false;
+
+        try {
+            net::sendFileDescriptor(it->m_channel.getFd(), clientFd);
+        } catch (std::exception& ex) {
+            LOG_WARNING << m_socketTypeName << kLogContext
+                        << "Can't pass connection to pooled connection worker PID " << it->m_pid
+                        << ": " << ex.what();
+            m_workerPool.erase(it);
             continue;
         }
 
-        // Child process
-        execve(execArgs.front(), execArgs.data(), envp);
-        // If we have reached here, execve() failed.
-        _exit(5);
+        ++it->m_activeClientCount;
+        ++it->m_servedClientCount;
+        LOG_INFO << m_socketTypeName << kLogContext
+                 << "Passed connection to pooled connection worker PID " << it->m_pid << '.';
+
+        // Worker which served enough clients is replaced. Closing channel makes it exit
+        // after its current clients disconnect.
+        if (maxLifetimeClients > 0 && it->m_servedClientCount >= maxLifetimeClients) {
+            LOG_INFO << m_socketTypeName << kLogContext << "Retiring pooled connection worker PID "
+                     << it->m_pid << '.';
+            m_workerPool.erase(it);
+            fillWorkerPool();
+        }
+        return true;
     }
+    return false;
 }
 
 void SiodbConnectionManager::deadConnectionRecyclerThreadMain()
@@ -266,10 +373,10 @@ int SiodbConnectionManager::acceptTcpConnection(int serverFd)
 
     socklen_t addrLength = m_socketDomain == AF_INET ? sizeof(addr.v4) : sizeof(addr.v6);
 
-    // Note that last parameter of the accept4() is zero, so we intentionally want
-    // resulting file descriptor to be inherited by child process.
-    FileDescriptorGuard client(
-            ::accept4(serverFd, reinterpret_cast<sockaddr*>(&addr), &addrLength, 0));
+    // Connection is passed to the pooled worker or explicitly made inheritable
+    // by the dedicated worker process, so it must not leak to any other child process.
+    FileDescriptorGuard client(::accept4(
+            serverFd, reinterpret_cast<sockaddr*>(&addr), &addrLength, SOCK_CLOEXEC));
 
     if (!client.isValidFd()) {
         const int errorCode = errno;
@@ -294,9 +401,9 @@ int SiodbConnectionManager::acceptTcpConnection(int serverFd)
 
 int SiodbConnectionManager::acceptUnixConnection(int serverFd)
 {
-    // Note that last parameter of the accept4() is zero, so we intentionally want
-    // resulting file descriptor to be inherited by child process.
-    FileDescriptorGuard client(::accept4(serverFd, nullptr, nullptr, 0));
+    // Connection is passed to the pooled worker or explicitly made inheritable
+    // by the dedicated worker process, so it must not leak to any other child process.
+    FileDescriptorGuard client(::accept4(serverFd, nullptr, nullptr, SOCK_CLOEXEC));
 
     if (!client.isValidFd()) {
         const int errorCode = errno;
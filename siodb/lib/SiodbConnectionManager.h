@@ -6,6 +6,7 @@
 
 // Common project headers
 #include <siodb/common/options/InstanceOptions.h>
+#include <siodb/common/utils/FileDescriptorGuard.h>
 #include <siodb/common/utils/HelperMacros.h>
 
 // STL headers
@@ -14,6 +15,7 @@
 #include <mutex>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 // System headers
 #include <unistd.h>
@@ -36,10 +38,52 @@ public:
 
     DECLARE_NONCOPYABLE(SiodbConnectionManager);
 
+private:
+    /** Pre-started connection worker, which receives client connections via channel */
+    struct PooledWorker {
+        /** Worker process ID */
+        pid_t m_pid;
+
+        /** Channel to the worker */
+        FileDescriptorGuard m_channel;
+
+        /** Number of clients currently served by the worker */
+        unsigned m_activeClientCount;
+
+        /** Number of clients passed to the worker */
+        unsigned m_servedClientCount;
+    };
+
 private:
     /** Connection listener thread entry point */
     void connectionListenerThreadMain();
 
+    /**
+     * Starts connection worker process. Only given file descriptor is inherited
+     * by the worker process.
+     * @param fdOptionName Command line option for the inherited file descriptor.
+     * @param fd File descriptor inherited by the worker process.
+     * @return Worker process ID or -1 on error.
+     */
+    pid_t startWorkerProcess(const char* fdOptionName, int fd);
+
+    /** Starts pre-started connection workers until pool is full. */
+    void fillWorkerPool();
+
+    /**
+     * Collects client disconnection notifications from pooled workers
+     * and removes exited workers from the pool.
+     */
+    void updateWorkerPool();
+
+    /**
+     * Passes client connection to the least loaded pooled worker.
+     * @param clientFd Client connection file descriptor.
+     * @return true if connection was passed, false if there is no worker
+     *         which can accept connection.
+     */
+    bool passConnectionToPooledWorker(int clientFd);
+
     /** Dead connection recycler thread entry point */
     void deadConnectionRecyclerThreadMain();
 
@@ -103,6 +147,9 @@ private:
     /** Connection handlers */
     std::unordered_set<pid_t> m_connectionHandlers;
 
+    /** Pre-started connection workers, accessed only by the connection listener thread */
+    std::vector<PooledWorker> m_workerPool;
+
     /** Dead connection monitor thread */
     std::thread m_deadConnectionRecyclerThread;
 